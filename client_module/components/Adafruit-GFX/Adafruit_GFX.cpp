@@ -771,6 +771,9 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
                               int16_t w, int16_t h, uint16_t color)
 {
 
+  if (blitBitmap(x, y, bitmap, w, h, color, 0, true))
+    return;
+
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -809,6 +812,9 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
                               uint16_t bg)
 {
 
+  if (blitBitmap(x, y, bitmap, w, h, color, bg, false))
+    return;
+
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -843,6 +849,9 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
                               int16_t h, uint16_t color)
 {
 
+  if (blitBitmap(x, y, bitmap, w, h, color, 0, true))
+    return;
+
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -880,6 +889,9 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
                               int16_t h, uint16_t color, uint16_t bg)
 {
 
+  if (blitBitmap(x, y, bitmap, w, h, color, bg, false))
+    return;
+
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -898,6 +910,37 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+   @brief      Hook for drivers that can blit 1-bit images straight into their
+   framebuffer. The generic version declines, so drawBitmap() falls back to
+   writePixel() per pixel.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color 16-bit 5-6-5 Color to draw pixels with
+    @param    bg 16-bit 5-6-5 Color to draw background with
+    @param    transparent true to leave pixels of unset bits untouched
+    @returns  true if the bitmap was drawn
+*/
+/**************************************************************************/
+bool Adafruit_GFX::blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                              int16_t w, int16_t h, uint16_t color,
+                              uint16_t bg, bool transparent)
+{
+  (void)x;
+  (void)y;
+  (void)bitmap;
+  (void)w;
+  (void)h;
+  (void)color;
+  (void)bg;
+  (void)transparent;
+  return false;
+}
+
 /**************************************************************************/
 /*!
    @brief      Draw PROGMEM-resident XBitMap Files (*.xbm), exported from GIMP.
@@ -1292,7 +1335,7 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
     int8_t xo = pgm_read_byte(&glyph->xOffset),
            yo = pgm_read_byte(&glyph->yOffset);
-    uint8_t xx, yy, bits = 0, bit = 0;
+    uint8_t yy, bits = 0, bit = 0;
     int16_t xo16 = 0, yo16 = 0;
 
     if (size_x > 1 || size_y > 1)
@@ -1319,28 +1362,44 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
 
+    // Glyph rows are decoded into runs of set bits and each run is drawn as
+    // one span, so drivers with a fast writeFastHLine()/writeFillRect() fill
+    // whole bytes instead of taking one writePixel() call per pixel.
     startWrite();
     for (yy = 0; yy < h; yy++)
     {
-      for (xx = 0; xx < w; xx++)
+      int16_t run = -1; // first column of the current run of set bits
+      // xx == w acts as a clear bit that closes a run touching the right edge
+      for (int16_t xx = 0; xx <= w; xx++)
       {
-        if (!(bit++ & 7))
+        bool set = false;
+        if (xx < w)
         {
-          bits = pgm_read_byte(&bitmap[bo++]);
-        }
-        if (bits & 0x80)
-        {
-          if (size_x == 1 && size_y == 1)
+          if (!(bit++ & 7))
           {
-            writePixel(x + xo + xx, y + yo + yy, color);
-          }
-          else
-          {
-            writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y,
-                          size_x, size_y, color);
+            bits = pgm_read_byte(&bitmap[bo++]);
           }
+          set = bits & 0x80;
+          bits <<= 1;
+        }
+        if (set)
+        {
+          if (run < 0)
+            run = xx;
+          continue;
+        }
+        if (run < 0)
+          continue;
+        if (size_x == 1 && size_y == 1)
+        {
+          writeFastHLine(x + xo + run, y + yo + yy, xx - run, color);
+        }
+        else
+        {
+          writeFillRect(x + (xo16 + run) * size_x, y + (yo16 + yy) * size_y,
+                        (xx - run) * size_x, size_y, color);
         }
-        bits <<= 1;
+        run = -1;
       }
     }
     endWrite();
@@ -54,6 +54,11 @@ public:
       // Optional and probably not necessary to change
       drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color),
       drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  // Optional framebuffer blit behind drawBitmap(); return false to use the
+  // generic per-pixel loop. bg is ignored when transparent is true.
+  virtual bool blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                          int16_t w, int16_t h, uint16_t color, uint16_t bg,
+                          bool transparent);
 
   // These exist only with Adafruit_GFX (no subclass overrides)
   void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color),
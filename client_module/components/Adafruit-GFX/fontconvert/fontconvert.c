@@ -8,11 +8,19 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+With -r as the first argument the bitmaps are run-length coded and the
+output is a GFXfontRLE named e.g. FreeSans18pt7bRLE (see gfxfont.h):
+  ./fontconvert -r ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7bRLE.h
+
+-u takes a list of Unicode code points and ranges instead of first and
+last; characters the font lacks are skipped.  The output is a GFXfontRLE
+with a range table, named e.g. FreeSans18ptuRLE:
+  ./fontconvert -u 0x20-0x7E,0xA0-0x17F ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18ptuRLE.h
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
-Currently this only extracts the printable 7-bit ASCII chars of a font.
-Will eventually extend with some int'l chars a la ftGFX, not there yet.
-Keep 7-bit fonts around as an option in that case, more compact.
+Without -u this only extracts the printable 7-bit ASCII chars of a font.
+Keep 7-bit fonts around as an option, more compact.
 
 See notes at end for glyph nomenclature & other tidbits.
 */
@@ -22,10 +30,13 @@ See notes at end for glyph nomenclature & other tidbits.
 #include <ft2build.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include FT_GLYPH_H
 #include FT_MODULE_H
 #include FT_TRUETYPE_DRIVER_H
 #include "../gfxfont.h" // Adafruit_GFX font structures
+#include "font_rle.h"     // Run-length coding, from badge_layout
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
@@ -50,26 +61,77 @@ void enbit(uint8_t value) {
   }
 }
 
+// Code points of a -u list such as 0x20-0x7E,0xA0-0x17F, in order, into
+// codes unless NULL.  Returns how many, or -1 if the list is malformed.
+int parseRanges(const char *spec, uint32_t *codes) {
+  long from, to, prev = -1;
+  char *end;
+  int count = 0;
+  do {
+    from = to = strtol(spec, &end, 0);
+    if (end == spec)
+      return -1;
+    if (*end == '-') {
+      spec = end + 1;
+      to = strtol(spec, &end, 0);
+      if (end == spec)
+        return -1;
+    }
+    if (from <= prev || to < from || to > 0x10FFFF)
+      return -1;
+    for (; from <= to; from++, count++) {
+      if (codes)
+        codes[count] = from;
+    }
+    prev = to;
+    spec = end;
+  } while (*spec++ == ',');
+  return spec[-1] ? -1 : count;
+}
+
 int main(int argc, char *argv[]) {
-  int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
-  char *fontName, c, *ptr;
+  int i, j, k, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
+  int rle = 0, rawSize = 0, count, rangeCount = 0;
+  char *fontName, c, *ptr, *ranges = NULL;
+  uint32_t *codes;
   FT_Library library;
   FT_Face face;
   FT_Glyph glyph;
   FT_Bitmap *bitmap;
   FT_BitmapGlyphRec *g;
   GFXglyph *table;
-  uint8_t bit;
+  uint8_t bit, *bits, *runs;
+  size_t n;
 
   // Parse command line.  Valid syntaxes are:
   //   fontconvert [filename] [size]
   //   fontconvert [filename] [size] [last char]
   //   fontconvert [filename] [size] [first char] [last char]
   // Unless overridden, default first and last chars are
-  // ' ' (space) and '~', respectively
+  // ' ' (space) and '~', respectively.  Any of them may start
+  // with -r for a run-length coded font, or with -u [code points]
+  // for a run-length coded font of those, in place of first and last.
+
+  while (argc > 1 && argv[1][0] == '-') {
+    if (!strcmp(argv[1], "-r")) {
+      rle = 1;
+      argv++;
+      argc--;
+    } else if (!strcmp(argv[1], "-u") && argc > 2) {
+      ranges = argv[2];
+      rle = 1;
+      argv += 2;
+      argc -= 2;
+    } else {
+      break;
+    }
+  }
 
-  if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+  if (argc < 3 || (ranges && argc > 3)) {
+    fprintf(stderr,
+            "Usage: %s [-r] fontfile size [first] [last]\n"
+            "       %s -u first-last,... fontfile size\n",
+            argv[0], argv[0]);
     return 1;
   }
 
@@ -94,12 +156,26 @@ int main(int argc, char *argv[]) {
   else
     ptr = argv[1]; // No path; font in local dir.
 
-  // Allocate space for font name and glyph table
+  // Characters to convert: first to last, or those of -u
+  count = ranges ? parseRanges(ranges, NULL) : last - first + 1;
+  if (count < 1) {
+    fprintf(stderr, "Bad code point list: %s\n", ranges);
+    return 1;
+  }
+
+  // Allocate space for font name, glyph table and code points
   if ((!(fontName = malloc(strlen(ptr) + 20))) ||
-      (!(table = (GFXglyph *)malloc((last - first + 1) * sizeof(GFXglyph))))) {
+      (!(table = (GFXglyph *)malloc(count * sizeof(GFXglyph)))) ||
+      (!(codes = (uint32_t *)malloc(count * sizeof(uint32_t))))) {
     fprintf(stderr, "Malloc error\n");
     return 1;
   }
+  if (ranges) {
+    parseRanges(ranges, codes);
+  } else {
+    for (i = 0; i < count; i++)
+      codes[i] = first + i;
+  }
 
   // Derive font table names from filename.  Period (filename
   // extension) is truncated and replaced with the font size & bits.
@@ -109,7 +185,10 @@ int main(int argc, char *argv[]) {
     ptr = &fontName[strlen(fontName)]; // If none, append
   // Insert font size and 7/8 bit.  fontName was alloc'd w/extra
   // space to allow this, we're not sprintfing into Forbidden Zone.
-  sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+  if (ranges)
+    sprintf(ptr, "%dptuRLE", size);
+  else
+    sprintf(ptr, "%dpt%db%s", size, (last > 127) ? 8 : 7, rle ? "RLE" : "");
   // Space and punctuation chars in name replaced w/ underscores.
   for (i = 0; (c = fontName[i]); i++) {
     if (isspace(c) || ispunct(c))
@@ -139,16 +218,26 @@ int main(int argc, char *argv[]) {
   // << 6 because '26dot6' fixed-point format
   FT_Set_Char_Size(face, size << 6, 0, DPI, 0);
 
-  // Currently all symbols from 'first' to 'last' are processed.
-  // Fonts may contain WAY more glyphs than that, but this code
-  // will need to handle encoding stuff to deal with extracting
-  // the right symbols, and that's not done yet.
+  // All symbols from 'first' to 'last' are processed.  Of a -u
+  // list, only those the font has; the range table maps the rest
+  // to no glyph.
   // fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
+  if (ranges) {
+    for (i = j = 0; i < count; i++) {
+      if (FT_Get_Char_Index(face, codes[i]))
+        codes[j++] = codes[i];
+    }
+    if (!(count = j)) {
+      fprintf(stderr, "Font has none of %s\n", ranges);
+      return 1;
+    }
+  }
 
   printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
 
   // Process glyphs and output huge bitmap data array
-  for (i = first, j = 0; i <= last; i++, j++) {
+  for (j = 0; j < count; j++) {
+    i = codes[j];
     // MONO renderer provides clean image with perfect crop
     // (no wasted pixels) via bitmap struct.
     if ((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
@@ -184,22 +273,34 @@ int main(int argc, char *argv[]) {
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
+    // Pack the glyph as in a plain font, padded to the next byte
+    n = (bitmap->width * bitmap->rows + 7) / 8;
+    if (!(bits = calloc(n ? n : 1, 1)) ||
+        !(runs = malloc(FONT_RLE_ENCODED_MAX(bitmap->width, bitmap->rows)))) {
+      fprintf(stderr, "Malloc error\n");
+      return 1;
+    }
     for (y = 0; y < bitmap->rows; y++) {
       for (x = 0; x < bitmap->width; x++) {
         byte = x / 8;
         bit = 0x80 >> (x & 7);
-        enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+        if (bitmap->buffer[y * bitmap->pitch + byte] & bit)
+          bits[(y * bitmap->width + x) / 8] |= 0x80 >> ((y * bitmap->width + x) & 7);
       }
     }
+    rawSize += n;
 
-    // Pad end of char bitmap to next byte boundary if needed
-    int n = (bitmap->width * bitmap->rows) & 7;
-    if (n) {     // Pixel count not an even multiple of 8?
-      n = 8 - n; // # bits to next multiple
-      while (n--)
-        enbit(0);
-    }
-    bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
+    // Either bytes go out through enbit(), so the table formatting holds
+    if (rle)
+      n = font_rle_encode(bits, bitmap->width, bitmap->rows, runs);
+    for (x = 0; x < (int)n * 8; x++)
+      enbit((rle ? runs : bits)[x / 8] & (0x80 >> (x & 7)));
+    bitmapOffset += n;
+    if (bitmapOffset > 0xFFFF)
+      fprintf(stderr, "Bitmaps exceed 64K, offsets will wrap\n");
+
+    free(bits);
+    free(runs);
 
     FT_Done_Glyph(glyph);
   }
@@ -208,11 +309,12 @@ int main(int argc, char *argv[]) {
 
   // Output glyph attributes table (one per character)
   printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
-  for (i = first, j = 0; i <= last; i++, j++) {
+  for (j = 0; j < count; j++) {
+    i = codes[j];
     printf("  { %5d, %3d, %3d, %3d, %4d, %4d }", table[j].bitmapOffset,
            table[j].width, table[j].height, table[j].xAdvance, table[j].xOffset,
            table[j].yOffset);
-    if (i < last) {
+    if (j < count - 1) {
       printf(",   // 0x%02X", i);
       if ((i >= ' ') && (i <= '~')) {
         printf(" '%c'", i);
@@ -220,23 +322,47 @@ int main(int argc, char *argv[]) {
       putchar('\n');
     }
   }
-  printf(" }; // 0x%02X", last);
-  if ((last >= ' ') && (last <= '~'))
-    printf(" '%c'", last);
+  i = codes[count - 1];
+  printf(" }; // 0x%02X", i);
+  if ((i >= ' ') && (i <= '~'))
+    printf(" '%c'", i);
   printf("\n\n");
 
+  // Output the runs of consecutive code points (see GFXrange)
+  if (ranges) {
+    printf("const GFXrange %sRanges[] PROGMEM = {\n", fontName);
+    for (j = 0; j < count; j = k, rangeCount++) {
+      for (k = j + 1; k < count && codes[k] == codes[k - 1] + 1; k++)
+        ;
+      printf("  { 0x%04X, %3d, %5d }%s\n", codes[j], k - j, j,
+             (k < count) ? "," : " };");
+    }
+    printf("\n");
+    first = last = 0; // Unused with a range table
+  }
+
   // Output font structure
-  printf("const GFXfont %s PROGMEM = {\n", fontName);
+  if (rle)
+    printf("const GFXfontRLE %s PROGMEM = { {\n", fontName);
+  else
+    printf("const GFXfont %s PROGMEM = {\n", fontName);
   printf("  (uint8_t  *)%sBitmaps,\n", fontName);
   printf("  (GFXglyph *)%sGlyphs,\n", fontName);
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
-    printf("  0x%02X, 0x%02X, %d };\n\n", first, last, table[0].height);
+    printf("  0x%02X, 0x%02X, %d", first, last, table[0].height);
   } else {
-    printf("  0x%02X, 0x%02X, %ld };\n\n", first, last,
+    printf("  0x%02X, 0x%02X, %ld", first, last,
            face->size->metrics.height >> 6);
   }
-  printf("// Approx. %d bytes\n", bitmapOffset + (last - first + 1) * 7 + 7);
+  if (ranges)
+    printf(" },\n  %d, %d,\n  %sRanges, %d };\n\n", rawSize, bitmapOffset,
+           fontName, rangeCount);
+  else if (rle)
+    printf(" },\n  %d, %d };\n\n", rawSize, bitmapOffset);
+  else
+    printf(" };\n\n");
+  printf("// Approx. %d bytes\n", bitmapOffset + count * 7 + rangeCount * 8 + 7);
   // Size estimate is based on AVR struct and pointer sizes;
   // actual size may vary.
 
@@ -21,4 +21,28 @@ typedef struct { // Data stored for FONT AS A WHOLE:
 	uint8_t   yAdvance;    // Newline distance (y axis)
 } GFXfont;
 
+// Consecutive Unicode code points of a GFXfontRLE with a range table
+typedef struct {
+	uint32_t first; // First code point
+	uint16_t count; // Code points in the range
+	uint16_t glyph; // Glyph of the first one
+} GFXrange;
+
+// Run-length coded variant, written by 'fontconvert -r'. Glyph metrics are
+// the same; each glyph's bitmap is XORed row by row with the row above it,
+// then stored as alternating runs of 0 and 1 bits, starting with 0. Run
+// lengths are varints (7 bits per byte, low first, 0x80 = more follows).
+// A trailing run of 0 bits is left out. drawChar() cannot draw these: use
+// font_rle_draw() of the badge_layout component.
+// Fonts with a range table, written by 'fontconvert -u' or subsetted by the
+// badge_layout font_pack tool, have glyphs only for the code points listed
+// there; font.first and font.last are unused then.
+typedef struct {
+	GFXfont  font;       // font.bitmap holds the runs
+	uint32_t rawSize;    // Bytes the plain 1bpp bitmaps would take
+	uint32_t size;       // Bytes of runs
+	const GFXrange *range; // Ascending, NULL: every character first to last
+	uint16_t rangeCount;
+} GFXfontRLE;
+
 #endif // _GFXFONT_H_
@@ -10,6 +10,26 @@ size_t Epd::write(uint8_t v){
   Adafruit_GFX::write(v);
   return 1;
 }
+void Epd::writeBitmapBytes(uint32_t offset, const uint8_t *data, uint32_t len, uint16_t color, uint16_t bg){
+  uint32_t rowBytes = (width() + 7) / 8;
+  while (len > 0) {
+    int16_t y = offset / rowBytes;
+    if (y >= height()) {
+      return;
+    }
+    uint32_t col = offset % rowBytes;
+    uint32_t n = rowBytes - col;
+    if (n > len) {
+      n = len;
+    }
+    // One row slice at a time, so models with a blitBitmap() fast path use it
+    drawBitmap(col * 8, y, data, n * 8, 1, color, bg);
+    data += n;
+    offset += n;
+    len -= n;
+  }
+}
+
 uint8_t Epd::_unicodeEasy(uint8_t c) {
   if (c<191 && c>131 && c!=176) { // 176 is °W 
     c+=64;
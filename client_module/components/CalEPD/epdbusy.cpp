@@ -0,0 +1,113 @@
+/* Event driven wait on the EPD BUSY line */
+#include <epdbusy.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+
+static const char *TAG = "EpdBusy";
+static const char *const op_names[EPD_BUSY_OPS] = {"power on", "full refresh", "partial refresh", "power off"};
+// Upper bound for adapted timeouts: a stuck BUSY line must not hang the badge forever
+#define EPD_BUSY_MAX_TIMEOUT_MS 60000
+
+EpdBusy::EpdBusy(gpio_num_t pin, int idleLevel, const uint32_t defaultTimeoutMs[EPD_BUSY_OPS])
+    : _pin(pin), _idleLevel(idleLevel)
+{
+    memcpy(_defaultTimeoutMs, defaultTimeoutMs, sizeof(_defaultTimeoutMs));
+}
+
+void EpdBusy::begin()
+{
+    if (_idle) return;
+    _idle = xSemaphoreCreateBinary();
+    assert(_idle);
+
+    // The ISR service may already be installed by another driver
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_ERROR_CHECK(ret);
+    }
+    gpio_intr_disable(_pin);
+    ESP_ERROR_CHECK(gpio_isr_handler_add(_pin, _isr, this));
+}
+
+// Level triggered so the same setting also wakes the chip from light sleep;
+// the ISR disarms itself to avoid firing continuously while the line is idle
+void IRAM_ATTR EpdBusy::_isr(void *arg)
+{
+    EpdBusy *self = (EpdBusy *)arg;
+    gpio_intr_disable(self->_pin);
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(self->_idle, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+uint32_t EpdBusy::timeoutMs(epd_busy_op_t op) const
+{
+    uint32_t timeout = _stats[op].maxMs * 3;
+    if (timeout < _defaultTimeoutMs[op]) timeout = _defaultTimeoutMs[op];
+    if (timeout > EPD_BUSY_MAX_TIMEOUT_MS) timeout = EPD_BUSY_MAX_TIMEOUT_MS;
+    return timeout;
+}
+
+int32_t EpdBusy::wait(epd_busy_op_t op, const char *message)
+{
+    int64_t start = esp_timer_get_time();
+    uint32_t timeout = timeoutMs(op);
+    gpio_int_type_t idle_intr = _idleLevel ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL;
+
+    if (!_idle) {
+        // begin() not called: fall back to polling
+        while (gpio_get_level(_pin) != _idleLevel &&
+               esp_timer_get_time() - start < (int64_t)timeout * 1000) {
+            vTaskDelay(1);
+        }
+    } else {
+        xSemaphoreTake(_idle, 0); // drop a stale wake-up
+        gpio_set_intr_type(_pin, idle_intr);
+        gpio_wakeup_enable(_pin, idle_intr);
+        esp_sleep_enable_gpio_wakeup();
+        // Armed before checking the level, so an edge right now is not missed
+        gpio_intr_enable(_pin);
+        while (gpio_get_level(_pin) != _idleLevel) {
+            int64_t left_ms = timeout - (esp_timer_get_time() - start) / 1000;
+            if (left_ms <= 0 || xSemaphoreTake(_idle, pdMS_TO_TICKS(left_ms) + 1) != pdTRUE) {
+                break;
+            }
+            gpio_intr_enable(_pin); // re-arm in case that was a glitch
+        }
+        gpio_intr_disable(_pin);
+        gpio_wakeup_disable(_pin);
+    }
+
+    uint32_t elapsed = (esp_timer_get_time() - start) / 1000;
+    epd_busy_stats_t *st = &_stats[op];
+    if (gpio_get_level(_pin) != _idleLevel) {
+        st->timeouts++;
+        ESP_LOGW(TAG, "%s: %s timed out after %lu ms", message, op_names[op], (unsigned long)elapsed);
+        return -1;
+    }
+
+    st->avgMs = st->count ? (st->avgMs * 3 + elapsed) / 4 : elapsed;
+    st->count++;
+    st->lastMs = elapsed;
+    if (elapsed > st->maxMs) st->maxMs = elapsed;
+    if (debug_enabled) {
+        ESP_LOGI(TAG, "%s: %s took %lu ms (avg %lu, max %lu)", message, op_names[op],
+                 (unsigned long)elapsed, (unsigned long)st->avgMs, (unsigned long)st->maxMs);
+    }
+    return elapsed;
+}
+
+void EpdBusy::report() const
+{
+    for (int op = 0; op < EPD_BUSY_OPS; op++) {
+        const epd_busy_stats_t *st = &_stats[op];
+        ESP_LOGI(TAG, "%-15s n=%lu last=%lu avg=%lu max=%lu ms timeouts=%lu (timeout now %lu ms)",
+                 op_names[op], (unsigned long)st->count, (unsigned long)st->lastMs,
+                 (unsigned long)st->avgMs, (unsigned long)st->maxMs,
+                 (unsigned long)st->timeouts, (unsigned long)timeoutMs((epd_busy_op_t)op));
+    }
+}
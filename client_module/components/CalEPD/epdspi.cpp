@@ -3,6 +3,7 @@
 #include <string.h>
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
 #ifdef CONFIG_IDF_TARGET_ESP32
     #define EPD_HOST    HSPI_HOST
     #define DMA_CHAN    2
@@ -40,7 +41,7 @@ void EpdSpi::init(uint8_t frequency=4,bool debug=false){
         .sclk_io_num=CONFIG_EINK_SPI_CLK,
         .quadwp_io_num=-1,
         .quadhd_io_num=-1,
-        .max_transfer_sz=4094
+        .max_transfer_sz=EPD_SPI_MAX_TRANSFER
     };
     // max_transfer_sz   4Kb is the defaut SPI transfer size if 0
     // debug: 50000  0.5 Mhz so we can sniff the SPI commands with a Slave
@@ -156,6 +157,95 @@ void EpdSpi::data(const uint8_t *data, int len)
     assert(ret==ESP_OK);            //Should have had no issues.
 }
 
+/* Send a long data phase (a whole framebuffer) with queued DMA transactions.
+ *
+ * Unlike data(), the CPU is not spinning while the bus runs: up to
+ * EPD_SPI_INFLIGHT transactions are queued so the next one starts as soon as
+ * the previous one finishes, and the caller only blocks on completions.
+ * Every queued transaction is collected before returning, so polling
+ * transactions (cmd/data) can follow right away.
+ */
+void EpdSpi::dataQueued(const uint8_t *data, uint32_t len)
+{
+    spi_transaction_t t[EPD_SPI_INFLIGHT];
+    spi_transaction_t *done;
+    uint8_t queued = 0, next = 0;
+    uint32_t offset = 0;
+
+    while (offset < len || queued > 0) {
+        if (offset < len && queued < EPD_SPI_INFLIGHT) {
+            uint32_t n = len - offset;
+            if (n > EPD_SPI_MAX_TRANSFER) n = EPD_SPI_MAX_TRANSFER;
+            spi_transaction_t *tr = &t[next];
+            next = (next + 1) % EPD_SPI_INFLIGHT;
+            memset(tr, 0, sizeof(*tr));
+            tr->length = n * 8;
+            tr->tx_buffer = data + offset;
+            ESP_ERROR_CHECK(spi_device_queue_trans(spi, tr, portMAX_DELAY));
+            offset += n;
+            queued++;
+            continue;
+        }
+        ESP_ERROR_CHECK(spi_device_get_trans_result(spi, &done, portMAX_DELAY));
+        queued--;
+    }
+}
+
+/* Double-buffered variant of dataQueued() for data that is not laid out
+ * contiguously in memory (windows, rotated or packed rows): fill() prepares
+ * chunk N+1 in one DMA buffer while chunk N is sent from the other.
+ * Falls back to polling data() through a small stack buffer when no DMA
+ * memory is available.
+ */
+void EpdSpi::dataPipelined(uint32_t len, epd_fill_cb_t fill, void *ctx)
+{
+    uint32_t chunk = len < EPD_SPI_MAX_TRANSFER ? len : EPD_SPI_MAX_TRANSFER;
+    if (chunk == 0) return;
+    uint8_t *buf[EPD_SPI_INFLIGHT] = {};
+    bool dma = true;
+    for (int i = 0; i < EPD_SPI_INFLIGHT; i++) {
+        buf[i] = (uint8_t *)heap_caps_malloc(chunk, MALLOC_CAP_DMA);
+        dma = dma && buf[i];
+    }
+
+    if (!dma) {
+        ESP_LOGW(TAG, "dataPipelined: no DMA memory, polling");
+        uint8_t line[128];
+        for (uint32_t offset = 0; offset < len; offset += sizeof(line)) {
+            uint32_t n = len - offset < sizeof(line) ? len - offset : sizeof(line);
+            fill(ctx, offset, line, n);
+            data(line, n);
+        }
+    } else {
+        spi_transaction_t t[EPD_SPI_INFLIGHT];
+        spi_transaction_t *done;
+        uint8_t queued = 0, next = 0;
+        for (uint32_t offset = 0; offset < len; offset += chunk) {
+            if (queued == EPD_SPI_INFLIGHT) {
+                // Wait until the oldest buffer is free again
+                ESP_ERROR_CHECK(spi_device_get_trans_result(spi, &done, portMAX_DELAY));
+                queued--;
+            }
+            uint32_t n = len - offset < chunk ? len - offset : chunk;
+            fill(ctx, offset, buf[next], n);
+            spi_transaction_t *tr = &t[next];
+            memset(tr, 0, sizeof(*tr));
+            tr->length = n * 8;
+            tr->tx_buffer = buf[next];
+            ESP_ERROR_CHECK(spi_device_queue_trans(spi, tr, portMAX_DELAY));
+            next = (next + 1) % EPD_SPI_INFLIGHT;
+            queued++;
+        }
+        while (queued--) {
+            ESP_ERROR_CHECK(spi_device_get_trans_result(spi, &done, portMAX_DELAY));
+        }
+    }
+
+    for (int i = 0; i < EPD_SPI_INFLIGHT; i++) {
+        heap_caps_free(buf[i]);
+    }
+}
+
 void EpdSpi::reset(uint8_t millis=20) {
     gpio_set_level((gpio_num_t)CONFIG_EINK_RST, 0);
     vTaskDelay(millis / portTICK_PERIOD_MS);
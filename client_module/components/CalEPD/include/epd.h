@@ -123,6 +123,9 @@ public:
     virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0; // Override GFX own drawPixel method
     virtual void init(bool debug = false) = 0;
     virtual void update() = 0;
+    // Refresh only what changed since the last refresh, where the model supports
+    // partial updates; the default is a full update()
+    virtual void updateChanged() { update(); }
 
     // This are common methods every MODELX will inherit
     // hook to Adafruit_GFX::write
@@ -134,6 +137,13 @@ public:
     void newline();
     void draw_centered_text(const GFXfont *font, int16_t x, int16_t y, uint16_t w, uint16_t h, const char *format, ...);
 
+    // Streaming sink for a full-screen 1bpp bitmap in drawBitmap() layout (rows of
+    // (width()+7)/8 bytes, MSB is the leftmost pixel, current rotation). offset is
+    // the byte position of data inside the bitmap, so an image can be written slice
+    // by slice as it arrives. Set bits are painted color, clear bits bg.
+    // The default draws row slices with drawBitmap(); models may copy whole bytes.
+    virtual void writeBitmapBytes(uint32_t offset, const uint8_t *data, uint32_t len, uint16_t color, uint16_t bg);
+
     // Methods that should be accesible by inheriting this abstract class
 protected:
     // This should be inherited from this abstract class so we don't repeat in every model
@@ -0,0 +1,61 @@
+/* Event driven wait on the EPD BUSY line, shared by the models */
+#ifndef epdbusy_h
+#define epdbusy_h
+
+#include <stdint.h>
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// Controller operations that are timed separately: a cold full refresh takes
+// several times longer than a power-on, so each gets its own statistics
+typedef enum
+{
+    EPD_BUSY_POWER_ON,
+    EPD_BUSY_REFRESH_FULL,
+    EPD_BUSY_REFRESH_PARTIAL,
+    EPD_BUSY_POWER_OFF,
+    EPD_BUSY_OPS
+} epd_busy_op_t;
+
+typedef struct
+{
+    uint32_t count;    // completed waits
+    uint32_t timeouts; // waits that gave up
+    uint32_t lastMs;
+    uint32_t maxMs;
+    uint32_t avgMs; // moving average (1/4 weight for the newest sample)
+} epd_busy_stats_t;
+
+class EpdBusy
+{
+  public:
+    // idleLevel: BUSY level while the controller is ready (1 on UC8179/GD7965, 0 on SSD16xx)
+    // defaultTimeoutMs: per-op timeout until there are measurements, indexed by epd_busy_op_t
+    EpdBusy(gpio_num_t pin, int idleLevel, const uint32_t defaultTimeoutMs[EPD_BUSY_OPS]);
+
+    // Installs the GPIO interrupt; call once the BUSY pin is configured as input
+    void begin();
+    // Blocks until BUSY returns to idle. The task sleeps on a semaphore, so with
+    // power management enabled the chip can light-sleep and is woken by the pin.
+    // Returns the measured duration in ms, or -1 on timeout.
+    int32_t wait(epd_busy_op_t op, const char *message);
+    // Current timeout: 3x the longest refresh seen so far (cold panels are slower),
+    // never below the model default
+    uint32_t timeoutMs(epd_busy_op_t op) const;
+    const epd_busy_stats_t &stats(epd_busy_op_t op) const { return _stats[op]; }
+    // Logs the statistics of every operation
+    void report() const;
+
+    bool debug_enabled = false;
+
+  private:
+    static void _isr(void *arg);
+
+    gpio_num_t _pin;
+    int _idleLevel;
+    uint32_t _defaultTimeoutMs[EPD_BUSY_OPS];
+    epd_busy_stats_t _stats[EPD_BUSY_OPS] = {};
+    SemaphoreHandle_t _idle = nullptr;
+};
+#endif
@@ -7,6 +7,15 @@ using namespace std;
 
 #ifndef epdspi_h
 #define epdspi_h
+
+// Largest DMA transaction (bus max_transfer_sz), kept a multiple of 4 for DMA
+#define EPD_SPI_MAX_TRANSFER 4092
+// Queued transactions in flight: one on the wire, one ready behind it
+#define EPD_SPI_INFLIGHT 2
+
+// Producer for EpdSpi::dataPipelined(): writes bytes [offset, offset + len) of
+// the data phase into buf while the previous chunk is still being clocked out
+typedef void (*epd_fill_cb_t)(void *ctx, uint32_t offset, uint8_t *buf, uint32_t len);
 // : IoInterface
 class EpdSpi 
 {
@@ -18,6 +27,12 @@ class EpdSpi
     void data(uint8_t data) ;
     void dataBuffer(uint8_t data);
     void data(const uint8_t *data, int len) ;
+    // Large data phases as queued DMA transactions of up to EPD_SPI_MAX_TRANSFER
+    // bytes. data must be DMA capable (internal RAM, 4 byte aligned) and stay
+    // untouched until the call returns.
+    void dataQueued(const uint8_t *data, uint32_t len);
+    // Same, but the bytes are produced chunk by chunk into two DMA buffers
+    void dataPipelined(uint32_t len, epd_fill_cb_t fill, void *ctx);
     // Deprecated
     void dataVector(vector<uint8_t> _buffer);
     void reset(uint8_t millis) ;
@@ -14,6 +14,7 @@
 #include <epd.h>
 #include <Adafruit_GFX.h>
 #include <epdspi.h>
+#include <epdbusy.h>
 // Note in S3 rtc_wdt has errors: https://github.com/espressif/esp-idf/issues/8038
 #if defined CONFIG_IDF_TARGET_ESP32 && ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)
   #include "soc/rtc_wdt.h"
@@ -27,6 +28,17 @@
 // EPD comment: Pixel number expressed in bytes; this is neither the buffer size nor the size of the buffer in the controller
 // We are not adding page support so here this is our Buffer size
 #define GDEW075T7_BUFFER_SIZE (uint32_t(GDEW075T7_WIDTH) * uint32_t(GDEW075T7_HEIGHT) / 8)
+// updateChanged() policy, see Kconfig
+#ifndef CONFIG_EINK_PARTIAL_FULL_EVERY
+#define CONFIG_EINK_PARTIAL_FULL_EVERY 5
+#endif
+#ifndef CONFIG_EINK_PARTIAL_MAX_AREA
+#define CONFIG_EINK_PARTIAL_MAX_AREA 40
+#endif
+// Dirty bands refreshed one by one; more are merged into the last band
+#define GDEW075T7_MAX_DIRTY 4
+// Clean rows that still join two dirty bands (each partial refresh costs a waveform)
+#define GDEW075T7_BAND_GAP 24
 // 8 pix of this color in a buffer byte:
 #define GDEW075T7_8PIX_BLACK 0x00
 #define GDEW075T7_8PIX_WHITE 0xFF
@@ -49,23 +61,59 @@ class Gdew075T7 : public Epd
     void fillScreen(uint16_t color);
     void fillRawBufferPos(uint16_t index, uint8_t value);
     void fillRawBufferImage(uint8_t image[], uint16_t size);
+    // Plain byte copy for black/white bitmaps in rotation 0 and 2
+    void writeBitmapBytes(uint32_t offset, const uint8_t *data, uint32_t len, uint16_t color, uint16_t bg);
+    // drawBitmap() straight into _buffer, a byte at a time in every rotation
+    bool blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+                    uint16_t color, uint16_t bg, bool transparent);
+    // Lines and rectangles (text spans, QR modules) filled byte-wise in _buffer
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
     void update();
+    // Diff _buffer against the frame on the panel and refresh only the dirty bands
+    void updateChanged();
+    // fullEvery: partial refreshes before a forced full one (0: always full)
+    // maxAreaPercent: changed area above which a full refresh is used instead
+    void setRefreshPolicy(uint8_t fullEvery, uint8_t maxAreaPercent);
 
   private:
     EpdSpi& IO;
+    EpdBusy _busy;
 
-    uint8_t _buffer[GDEW075T7_BUFFER_SIZE];
+    // Word aligned so update() can DMA it to the controller without a bounce buffer
+    uint8_t _buffer[GDEW075T7_BUFFER_SIZE] __attribute__((aligned(4)));
     // Place _buffer in external RAM
     //uint8_t* _buffer = (uint8_t*)heap_caps_malloc(GDEW075T7_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
 
     bool _using_partial_mode = false;
     bool _initial = true;
+
+    // Dirty region in buffer coordinates: byte columns xb0..xb1, rows y0..y1 (inclusive)
+    typedef struct
+    {
+      uint16_t xb0, y0, xb1, y1;
+    } dirty_rect_t;
+    // Frame currently on the panel (heap, nullptr if it could not be allocated):
+    // diffed by updateChanged() and uploaded as "old" data for partial waveforms
+    uint8_t *_shown = nullptr;
+    bool _shownValid = false;
+    uint8_t _partialCount = 0;
+    uint8_t _fullEvery = CONFIG_EINK_PARTIAL_FULL_EVERY;
+    uint8_t _maxAreaPercent = CONFIG_EINK_PARTIAL_MAX_AREA;
+    uint8_t _findDirty(dirty_rect_t *rects);
+    void _refreshWindow(uint16_t xb0, uint16_t y0, uint16_t xb1, uint16_t y1);
+    void _sendWindow(uint8_t cmd, const uint8_t *src, uint16_t xb0, uint16_t y0, uint16_t xb1, uint16_t y1);
     
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _wakeUp();
     void _sleep();
     void _waitBusy(const char* message);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
+    void _fillPhysRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool white);
     
     // Command & data structs
     // LUT tables for this display are filled with zeroes at the end with writeLuts()
@@ -6,6 +6,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <inttypes.h>
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
 /*
  The EPD needs a bunch of command/data values to be initialized. They are send using the IO class
  Manufacturer sample: https://github.com/waveshare/e-Paper/blob/master/Arduino/epd7in5_V2/epd7in5_V2.cpp
@@ -68,9 +70,14 @@ DRAM_ATTR const epd_init_4 Gdew075T7::epd_resolution = {
            GDEW075T7_HEIGHT % 256},
     4};
 
+// BUSY timeouts before any refresh was measured, indexed by epd_busy_op_t.
+// A full refresh takes ~4 s at room temperature and much longer in the cold.
+static const uint32_t busy_timeouts_ms[EPD_BUSY_OPS] = {1000, 10000, 3000, 1000};
+
 // Constructor
 Gdew075T7::Gdew075T7(EpdSpi &dio) : Adafruit_GFX(GDEW075T7_WIDTH, GDEW075T7_HEIGHT),
-                                    Epd(GDEW075T7_WIDTH, GDEW075T7_HEIGHT), IO(dio)
+                                    Epd(GDEW075T7_WIDTH, GDEW075T7_HEIGHT), IO(dio),
+                                    _busy((gpio_num_t)CONFIG_EINK_BUSY, 1, busy_timeouts_ms)
 {
   printf("Gdew075T7() constructor injects IO and extends Adafruit_GFX(%d,%d) Pix Buffer[%d]\n",
          GDEW075T7_WIDTH, GDEW075T7_HEIGHT, (int)GDEW075T7_BUFFER_SIZE);
@@ -124,10 +131,25 @@ void Gdew075T7::init(bool debug)
     printf("Gdew075T7::init(debug:%d)\n", debug);
   //Initialize SPI at 4MHz frequency. true for debug
   IO.init(4, false);
+  _busy.debug_enabled = debug;
+  _busy.begin();
   fillScreen(EPD_WHITE);
+  if (!_shown)
+  {
+    // DMA capable, so partial refreshes can send old data straight from it
+    _shown = (uint8_t *)heap_caps_malloc(sizeof(_buffer), MALLOC_CAP_DMA);
+    if (!_shown)
+      ESP_LOGW(TAG, "No memory to retain the shown frame, partial refresh disabled");
+  }
   _wakeUp();
 }
 
+void Gdew075T7::setRefreshPolicy(uint8_t fullEvery, uint8_t maxAreaPercent)
+{
+  _fullEvery = fullEvery;
+  _maxAreaPercent = maxAreaPercent;
+}
+
 void Gdew075T7::fillScreen(uint16_t color)
 {
   uint8_t data = (color == EPD_BLACK) ? GDEW075T7_8PIX_BLACK : GDEW075T7_8PIX_WHITE;
@@ -151,7 +173,7 @@ void Gdew075T7::_wakeUp()
   }
 
   IO.cmd(0x04);
-  _waitBusy("_wakeUp power on");
+  _busy.wait(EPD_BUSY_POWER_ON, "_wakeUp");
 
   IO.cmd(epd_panel_setting_full.cmd);
   for (int i = 0; i < epd_panel_setting_full.databytes; ++i)
@@ -187,35 +209,29 @@ void Gdew075T7::update()
   IO.cmd(0x13);
   printf("Sending a %d bytes buffer via SPI\n", sizeof(_buffer));
 
-  // v2 SPI optimizing. Check: https://github.com/martinberlin/cale-idf/wiki/About-SPI-optimization
-  uint16_t i = 0;
-  uint8_t xLineBytes = GDEW075T7_WIDTH / 8;
-  uint8_t x1buf[xLineBytes];
-  for (uint16_t y = 1; y <= GDEW075T7_HEIGHT; y++)
-  {
-    for (uint16_t x = 1; x <= xLineBytes; x++)
-    {
-      uint8_t data = i < sizeof(_buffer) ? _buffer[i] : 0x00;
-      x1buf[x - 1] = data;
-      if (x == xLineBytes)
-      { // Flush the X line buffer to SPI
-        IO.data(x1buf, sizeof(x1buf));
-      }
-      ++i;
-    }
-  }
+  // v3 SPI optimizing: _buffer already has the controller's layout, so DMA it
+  // straight out in max_transfer_sz chunks (12 queued transactions instead of
+  // 480 polled 100-byte lines copied through a stack buffer)
+  IO.dataQueued(_buffer, sizeof(_buffer));
 
   uint64_t endTime = esp_timer_get_time();
   IO.cmd(0x12);
-  _waitBusy("update");
+  _busy.wait(EPD_BUSY_REFRESH_FULL, "update");
+  if (_shown)
+  {
+    memcpy(_shown, _buffer, sizeof(_buffer));
+    _shownValid = true;
+  }
+  _partialCount = 0;
   uint64_t updateTime = esp_timer_get_time();
   printf("\n\nSTATS (ms)\n%llu _wakeUp settings+send Buffer\n%llu update \n%llu total time in millis\n",
          (endTime - startTime) / 1000, (updateTime - endTime) / 1000, (updateTime - startTime) / 1000);
-  
-  // Additional 2 seconds wait before sleeping since in low temperatures full update takes longer
-  vTaskDelay(2000 / portTICK_PERIOD_MS);
 
+  // No extra settle delay: the wait above lasts exactly as long as the
+  // refresh, however long the cold takes (see EpdBusy timeouts)
   _sleep();
+  if (debug_enabled)
+    _busy.report();
 }
 
 uint16_t Gdew075T7::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye)
@@ -247,74 +263,181 @@ void Gdew075T7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, boo
   uint16_t xe = gx_uint16_min(GDEW075T7_WIDTH, x + w) - 1;
   uint16_t ye = gx_uint16_min(GDEW075T7_HEIGHT, y + h) - 1;
 
-  // x &= 0xFFF8; // byte boundary, need to test this
-  uint16_t xs_bx = x / 8;
-  uint16_t xe_bx = (xe + 7) / 8;
   if (!_using_partial_mode) {
     _wakeUp();
     }
 
   _using_partial_mode = true;
   initPartialUpdate();
+  _refreshWindow(x / 8, y, xe / 8, ye);
+  if (debug_enabled)
+    _busy.report();
 
-  {               // leave both controller buffers equal
-    IO.cmd(0x91); // partial in
-    _setPartialRamArea(x, y, xe, ye);
-    IO.cmd(0x13);
+  vTaskDelay(GDEW075T7_PU_DELAY / portTICK_PERIOD_MS);
+}
 
-    for (int16_t y1 = y; y1 <= ye; y1++)
-    {
-      for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-      {
-        uint16_t idx = y1 * (GDEW075T7_WIDTH / 8) + x1;
-        // white is 0x00 in buffer
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        // white is 0xFF on device
-        IO.data(data);
-
-        if (idx % 8 == 0)
-        {
-          #if defined CONFIG_IDF_TARGET_ESP32 && ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)
-          rtc_wdt_feed();
-          #endif
-          vTaskDelay(pdMS_TO_TICKS(1));
-        }
-      }
-    }
-    IO.cmd(0x12); // display refresh
-    _waitBusy("updateWindow");
-    IO.cmd(0x92); // partial out
+// A window of the framebuffer, read row after row by fillWindow()
+typedef struct
+{
+  const uint8_t *first; // first byte of the window's top row
+  uint16_t rowBytes;
+} window_src_t;
+
+static void fillWindow(void *ctx, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+  const window_src_t *w = (const window_src_t *)ctx;
+  while (len > 0)
+  {
+    uint32_t row = offset / w->rowBytes, col = offset % w->rowBytes;
+    uint32_t n = w->rowBytes - col;
+    if (n > len)
+      n = len;
+    memcpy(buf, w->first + row * (GDEW075T7_WIDTH / 8) + col, n);
+    buf += n;
+    offset += n;
+    len -= n;
   }
+}
 
-  vTaskDelay(GDEW075T7_PU_DELAY / portTICK_PERIOD_MS);
+// Sends rows y0..y1, byte columns xb0..xb1 of src after cmd (0x10 old / 0x13 new data)
+void Gdew075T7::_sendWindow(uint8_t cmd, const uint8_t *src, uint16_t xb0, uint16_t y0, uint16_t xb1, uint16_t y1)
+{
+  const uint16_t lineBytes = GDEW075T7_WIDTH / 8;
+  window_src_t w = {src + y0 * lineBytes + xb0, (uint16_t)(xb1 - xb0 + 1)};
+  uint32_t len = (uint32_t)w.rowBytes * (y1 - y0 + 1);
+
+  IO.cmd(cmd);
+  if (w.rowBytes == lineBytes && esp_ptr_dma_capable(w.first))
+  {
+    // Full-width rows are contiguous: DMA them straight out of the buffer
+    IO.dataQueued(w.first, len);
+  }
+  else
+  {
+    // Narrower windows are gathered row by row into DMA chunks while the previous one is sent
+    IO.dataPipelined(len, fillWindow, &w);
+  }
 }
 
-void Gdew075T7::_waitBusy(const char *message)
+// Partial refresh of one byte-aligned window; expects initPartialUpdate() to be done
+void Gdew075T7::_refreshWindow(uint16_t xb0, uint16_t y0, uint16_t xb1, uint16_t y1)
 {
-  if (debug_enabled)
+  uint64_t startTime = esp_timer_get_time();
+  IO.cmd(0x91); // partial in
+  _setPartialRamArea(xb0 * 8, y0, xb1 * 8 + 7, y1);
+  // The controller forgets its "old" RAM in deep sleep, but the partial
+  // waveform depends on it: upload what is really on the panel when known
+  if (_shown && _shownValid)
+  {
+    _sendWindow(0x10, _shown, xb0, y0, xb1, y1);
+  }
+  _sendWindow(0x13, _buffer, xb0, y0, xb1, y1);
+  uint64_t sentTime = esp_timer_get_time();
+  IO.cmd(0x12); // display refresh
+  _busy.wait(EPD_BUSY_REFRESH_PARTIAL, "updateWindow");
+  IO.cmd(0x92); // partial out
+  uint64_t refreshTime = esp_timer_get_time();
+  printf("\n\nSTATS window %dx%d at (%d,%d) (ms)\n%llu send window\n%llu partial refresh\n%llu total time in millis\n",
+         (xb1 - xb0 + 1) * 8, y1 - y0 + 1, xb0 * 8, y0,
+         (sentTime - startTime) / 1000, (refreshTime - sentTime) / 1000, (refreshTime - startTime) / 1000);
+
+  if (_shown && _shownValid)
   {
-    ESP_LOGI(TAG, "_waitBusy for %s", message);
+    for (uint16_t y = y0; y <= y1; y++)
+    {
+      uint32_t idx = (uint32_t)y * (GDEW075T7_WIDTH / 8) + xb0;
+      memcpy(_shown + idx, _buffer + idx, xb1 - xb0 + 1);
+    }
   }
-  int64_t time_since_boot = esp_timer_get_time();
+}
 
-  while (1)
+// Collects the rows that differ from the shown frame into bands, each with
+// the byte-column extent of its changes. Returns the number of bands.
+uint8_t Gdew075T7::_findDirty(dirty_rect_t *rects)
+{
+  const uint16_t lineBytes = GDEW075T7_WIDTH / 8;
+  uint8_t n = 0;
+  for (uint16_t y = 0; y < GDEW075T7_HEIGHT; y++)
   {
-    if (gpio_get_level((gpio_num_t)CONFIG_EINK_BUSY) == 1)
-      break;
-    vTaskDelay(1);
-    if (esp_timer_get_time() - time_since_boot > 2000000)
+    const uint8_t *now = _buffer + y * lineBytes;
+    const uint8_t *old = _shown + y * lineBytes;
+    if (memcmp(now, old, lineBytes) == 0)
+      continue;
+    uint16_t l = 0, r = lineBytes - 1;
+    while (now[l] == old[l])
+      l++;
+    while (now[r] == old[r])
+      r--;
+
+    if (n > 0 && (y - rects[n - 1].y1 <= GDEW075T7_BAND_GAP || n == GDEW075T7_MAX_DIRTY))
     {
-      if (debug_enabled)
-        ESP_LOGI(TAG, "Busy Timeout");
-      break;
+      dirty_rect_t *band = &rects[n - 1];
+      band->xb0 = gx_uint16_min(band->xb0, l);
+      band->xb1 = gx_uint16_max(band->xb1, r);
+      band->y1 = y;
+    }
+    else
+    {
+      rects[n++] = {l, y, r, y};
     }
   }
+  return n;
+}
+
+void Gdew075T7::updateChanged()
+{
+  if (!_shown || !_shownValid || _fullEvery == 0 || _partialCount >= _fullEvery)
+  {
+    update();
+    return;
+  }
+
+  dirty_rect_t rects[GDEW075T7_MAX_DIRTY];
+  uint8_t n = _findDirty(rects);
+  if (n == 0)
+  {
+    if (debug_enabled)
+      ESP_LOGI(TAG, "updateChanged: nothing changed");
+    return;
+  }
+  uint32_t area = 0;
+  for (uint8_t i = 0; i < n; i++)
+  {
+    area += (uint32_t)(rects[i].xb1 - rects[i].xb0 + 1) * 8 * (rects[i].y1 - rects[i].y0 + 1);
+  }
+  if (area * 100 > (uint32_t)GDEW075T7_WIDTH * GDEW075T7_HEIGHT * _maxAreaPercent)
+  {
+    update();
+    return;
+  }
+
+  uint64_t startTime = esp_timer_get_time();
+  _wakeUp();
+  initPartialUpdate();
+  for (uint8_t i = 0; i < n; i++)
+  {
+    _refreshWindow(rects[i].xb0, rects[i].y0, rects[i].xb1, rects[i].y1);
+  }
+  _sleep();
+  _using_partial_mode = false;
+  _partialCount++;
+
+  printf("updateChanged: %d band(s), %lu px, partial %d/%d in %llu ms\n", n, (unsigned long)area,
+         _partialCount, _fullEvery, (esp_timer_get_time() - startTime) / 1000);
+  if (debug_enabled)
+    _busy.report();
+}
+
+void Gdew075T7::_waitBusy(const char *message)
+{
+  // Generic waits get the most generous timeout
+  _busy.wait(EPD_BUSY_REFRESH_FULL, message);
 }
 
 void Gdew075T7::_sleep()
 {
   IO.cmd(0x02);
-  _waitBusy("power_off");
+  _busy.wait(EPD_BUSY_POWER_OFF, "_sleep");
   IO.cmd(0x07); // Deep sleep
   IO.data(0xA5);
 }
@@ -370,3 +493,267 @@ void Gdew075T7::drawPixel(int16_t x, int16_t y, uint16_t color)
     _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
   }
 }
+
+static inline uint8_t reverseBits(uint8_t b)
+{
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  return (b & 0xAA) >> 1 | (b & 0x55) << 1;
+}
+
+void Gdew075T7::writeBitmapBytes(uint32_t offset, const uint8_t *data, uint32_t len, uint16_t color, uint16_t bg)
+{
+  // Buffer bit 1 is white, so black-on-white bitmaps are stored inverted
+  bool inverted = (color == EPD_BLACK && bg == EPD_WHITE);
+  bool plain = (color == EPD_WHITE && bg == EPD_BLACK);
+  uint8_t rotation = getRotation();
+  if (!(inverted || plain))
+  {
+    Epd::writeBitmapBytes(offset, data, len, color, bg);
+    return;
+  }
+  if (offset >= sizeof(_buffer))
+    return;
+  if (len > sizeof(_buffer) - offset)
+    len = sizeof(_buffer) - offset;
+
+  uint8_t mask = inverted ? 0xFF : 0x00;
+  if (rotation & 1)
+  {
+    // 90°/270°: a bitmap row is a buffer column, so the 8 pixels of a byte
+    // land on 8 consecutive buffer rows. Scattered bit by bit here: through
+    // drawBitmap() every slice would be a 1-row blit, slower than drawPixel().
+    const uint32_t rowBytes = GDEW075T7_HEIGHT / 8;
+    const int32_t step = (rotation == 1) ? GDEW075T7_WIDTH / 8 : -(GDEW075T7_WIDTH / 8);
+    for (uint32_t i = 0; i < len; i++)
+    {
+      uint32_t ly = (offset + i) / rowBytes, lx = (offset + i) % rowBytes * 8;
+      uint32_t px = (rotation == 1) ? GDEW075T7_WIDTH - 1 - ly : ly;
+      uint32_t py = (rotation == 1) ? lx : GDEW075T7_HEIGHT - 1 - lx;
+      uint8_t *dst = _buffer + py * (GDEW075T7_WIDTH / 8) + px / 8;
+      uint8_t bit = 0x80 >> (px & 7);
+      uint8_t white = data[i] ^ mask;
+      for (uint8_t b = 0; b < 8; b++, dst += step)
+      {
+        *dst = (white & (0x80 >> b)) ? (*dst | bit) : (*dst & ~bit);
+      }
+    }
+  }
+  else if (rotation == 0)
+  {
+    for (uint32_t i = 0; i < len; i++)
+    {
+      _buffer[offset + i] = data[i] ^ mask;
+    }
+  }
+  else
+  {
+    // 180°: rows and pixels within a row are mirrored, so the bitmap runs
+    // backwards through the buffer with the bits of every byte reversed
+    uint8_t *dst = _buffer + sizeof(_buffer) - 1 - offset;
+    for (uint32_t i = 0; i < len; i++)
+    {
+      *dst-- = reverseBits(data[i]) ^ mask;
+    }
+  }
+}
+
+// 8 bitmap pixels of row starting at column c, MSB first; columns outside
+// the row read as 0. c may be as low as -7 for the first, partial byte.
+static inline uint8_t rowBits(const uint8_t *row, int16_t c, int16_t byteWidth)
+{
+  int16_t k = ((c + 8) >> 3) - 1;
+  uint8_t s = (c + 8) & 7;
+  uint8_t hi = (k >= 0 && k < byteWidth) ? row[k] : 0;
+  if (s == 0)
+    return hi;
+  uint8_t lo = (k + 1 < byteWidth) ? row[k + 1] : 0;
+  return (uint8_t)((hi << s) | (lo >> (8 - s)));
+}
+
+// Bits of buffer byte db that fall inside the pixel span [xs, xe]
+static inline uint8_t spanMask(int16_t db, int16_t xs, int16_t xe)
+{
+  int16_t lo = xs - db * 8, hi = xe - db * 8;
+  uint8_t mask = 0xFF;
+  if (lo > 0)
+    mask &= 0xFF >> lo;
+  if (hi < 7)
+    mask &= 0xFF << (7 - hi);
+  return mask;
+}
+
+// bits: 1 = foreground pixel; only positions in mask are touched
+static inline void blendByte(uint8_t &dst, uint8_t bits, uint8_t mask, bool fgWhite, bool bgWhite, bool transparent)
+{
+  uint8_t fg = bits & mask;
+  dst = fgWhite ? (dst | fg) : (dst & ~fg);
+  if (!transparent)
+  {
+    uint8_t bg = ~bits & mask;
+    dst = bgWhite ? (dst | bg) : (dst & ~bg);
+  }
+}
+
+bool Gdew075T7::blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+                           uint16_t color, uint16_t bg, bool transparent)
+{
+  // Clip to the logical screen: bitmap columns [i0, i1) and rows [j0, j1)
+  int16_t i0 = x < 0 ? -x : 0;
+  int16_t j0 = y < 0 ? -y : 0;
+  int16_t i1 = (x + w > width()) ? width() - x : w;
+  int16_t j1 = (y + h > height()) ? height() - y : h;
+  if (i0 >= i1 || j0 >= j1)
+    return true;
+
+  const int16_t byteWidth = (w + 7) / 8;
+  const int16_t lineBytes = GDEW075T7_WIDTH / 8;
+  // Same polarity as drawPixel(): any non-zero color sets the bit (white)
+  const bool fgWhite = color != 0, bgWhite = bg != 0;
+  const uint8_t rotation = getRotation();
+
+  if ((rotation & 1) == 0)
+  {
+    // Bitmap rows are buffer rows; 180° mirrors them, so bytes are gathered
+    // from the opposite end and bit-reversed
+    for (int16_t j = j0; j < j1; j++)
+    {
+      const uint8_t *row = bitmap + j * byteWidth;
+      int16_t ly = y + j;
+      int16_t py = (rotation == 0) ? ly : GDEW075T7_HEIGHT - 1 - ly;
+      int16_t xs = (rotation == 0) ? x + i0 : GDEW075T7_WIDTH - x - i1;
+      int16_t xe = (rotation == 0) ? x + i1 - 1 : GDEW075T7_WIDTH - 1 - x - i0;
+      uint8_t *line = _buffer + py * lineBytes;
+      for (int16_t db = xs / 8; db <= xe / 8; db++)
+      {
+        uint8_t bits = (rotation == 0) ? rowBits(row, db * 8 - x, byteWidth)
+                                       : reverseBits(rowBits(row, GDEW075T7_WIDTH - 8 - db * 8 - x, byteWidth));
+        blendByte(line[db], bits, spanMask(db, xs, xe), fgWhite, bgWhite, transparent);
+      }
+    }
+    return true;
+  }
+
+  // 90°/270°: a bitmap column becomes a buffer row, so every buffer byte
+  // gathers 8 vertically adjacent bitmap pixels
+  for (int16_t i = i0; i < i1; i++)
+  {
+    int16_t lx = x + i;
+    int16_t py = (rotation == 1) ? lx : GDEW075T7_HEIGHT - 1 - lx;
+    int16_t xs = (rotation == 3) ? y + j0 : GDEW075T7_WIDTH - y - j1;
+    int16_t xe = (rotation == 3) ? y + j1 - 1 : GDEW075T7_WIDTH - 1 - y - j0;
+    const uint8_t *col = bitmap + i / 8;
+    const uint8_t srcBit = 0x80 >> (i & 7);
+    uint8_t *line = _buffer + py * lineBytes;
+    for (int16_t db = xs / 8; db <= xe / 8; db++)
+    {
+      uint8_t mask = spanMask(db, xs, xe);
+      uint8_t bits = 0;
+      for (uint8_t b = 0; b < 8; b++)
+      {
+        if (!(mask & (0x80 >> b)))
+          continue;
+        int16_t px = db * 8 + b;
+        int16_t j = ((rotation == 3) ? px : GDEW075T7_WIDTH - 1 - px) - y;
+        if (col[j * byteWidth] & srcBit)
+          bits |= 0x80 >> b;
+      }
+      blendByte(line[db], bits, mask, fgWhite, bgWhite, transparent);
+    }
+  }
+  return true;
+}
+
+// Fills the inclusive, already clipped buffer rectangle (x0,y0)-(x1,y1)
+void Gdew075T7::_fillPhysRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool white)
+{
+  const int16_t lineBytes = GDEW075T7_WIDTH / 8;
+  int16_t b0 = x0 / 8, b1 = x1 / 8;
+  uint8_t head = 0xFF >> (x0 & 7);
+  uint8_t tail = 0xFF << (7 - (x1 & 7));
+  if (b0 == b1)
+  {
+    head &= tail;
+  }
+  uint8_t fill = white ? GDEW075T7_8PIX_WHITE : GDEW075T7_8PIX_BLACK;
+
+  for (int16_t y = y0; y <= y1; y++)
+  {
+    uint8_t *line = _buffer + y * lineBytes;
+    line[b0] = white ? (line[b0] | head) : (line[b0] & ~head);
+    if (b1 > b0)
+    {
+      memset(line + b0 + 1, fill, b1 - b0 - 1);
+      line[b1] = white ? (line[b1] | tail) : (line[b1] & ~tail);
+    }
+  }
+}
+
+void Gdew075T7::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if (w < 0)
+  {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0)
+  {
+    y += h + 1;
+    h = -h;
+  }
+  // Clip in logical coordinates (inclusive corners)
+  int32_t x0 = x, y0 = y, x1 = (int32_t)x + w - 1, y1 = (int32_t)y + h - 1;
+  if (x0 < 0)
+    x0 = 0;
+  if (y0 < 0)
+    y0 = 0;
+  if (x1 >= width())
+    x1 = width() - 1;
+  if (y1 >= height())
+    y1 = height() - 1;
+  if (w == 0 || h == 0 || x0 > x1 || y0 > y1)
+    return;
+
+  // A rectangle stays a rectangle in every rotation; map its corners like drawPixel()
+  switch (getRotation())
+  {
+  case 1:
+    _fillPhysRect(GDEW075T7_WIDTH - 1 - y1, x0, GDEW075T7_WIDTH - 1 - y0, x1, color);
+    break;
+  case 2:
+    _fillPhysRect(GDEW075T7_WIDTH - 1 - x1, GDEW075T7_HEIGHT - 1 - y1,
+                  GDEW075T7_WIDTH - 1 - x0, GDEW075T7_HEIGHT - 1 - y0, color);
+    break;
+  case 3:
+    _fillPhysRect(y0, GDEW075T7_HEIGHT - 1 - x1, y1, GDEW075T7_HEIGHT - 1 - x0, color);
+    break;
+  default:
+    _fillPhysRect(x0, y0, x1, y1, color);
+    break;
+  }
+}
+
+void Gdew075T7::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  fillRect(x, y, w, h, color);
+}
+
+void Gdew075T7::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
+
+void Gdew075T7::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
+
+void Gdew075T7::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void Gdew075T7::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
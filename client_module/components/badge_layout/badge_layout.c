@@ -0,0 +1,375 @@
+#include "badge_layout.h"
+#include <string.h>
+#include "text_layout.h"
+#include "utf8.h"
+
+// One field wrapped in one of its fonts
+typedef struct
+{
+    uint8_t font_idx;
+    bool hyphenate; // words may be split
+    uint8_t count;
+    uint16_t height;
+    layout_line_t lines[LAYOUT_FIELD_LINES];
+    text_bounds_t bounds[LAYOUT_FIELD_LINES];
+} field_state_t;
+
+// Bounds of a span, with a '-' drawn after it if hyphen is set
+static void span_bounds(const font_chain_t *chain, const char *text, size_t len, bool hyphen, text_bounds_t *b)
+{
+    text_measure_n(chain, text, len, b);
+    const GFXglyph *hy = font_chain_glyph(chain, '-', NULL, NULL);
+    if (!hyphen || !hy || !hy->width)
+    {
+        return;
+    }
+    int16_t pen = 0;
+    for (const char *p = text, *end = text + len; p < end;)
+    {
+        const GFXglyph *g = font_chain_lookup(chain, utf8_next(&p, end), NULL, NULL);
+        pen += g ? g->xAdvance : 0;
+    }
+    int16_t x1 = pen + hy->xOffset, x2 = x1 + hy->width - 1;
+    int16_t y1 = hy->yOffset, y2 = y1 + hy->height - 1;
+    int16_t bx2 = b->x1 + b->w - 1, by2 = b->y1 + b->h - 1;
+    if (b->w)
+    {
+        x1 = b->x1 < x1 ? b->x1 : x1;
+        x2 = bx2 > x2 ? bx2 : x2;
+    }
+    if (b->h)
+    {
+        y1 = b->y1 < y1 ? b->y1 : y1;
+        y2 = by2 > y2 ? by2 : y2;
+    }
+    b->x1 = x1;
+    b->w = x2 - x1 + 1;
+    b->y1 = y1;
+    b->h = y2 - y1 + 1;
+}
+
+// Longest prefix of a line that fits width with a '-' after it, breaking the
+// word that starts at word and ends the line at len. Found in one pass over
+// the cumulative ink edges. Prefers leaving two letters of the word on either
+// side; a prefix ending in '-' gets no second one. 0 if not even one letter
+// of the word fits. Letters are code points, and so are the breaks.
+static size_t hyphen_point(const font_chain_t *chain, const char *line, size_t word, size_t len, uint16_t width,
+                           bool *hyphen)
+{
+    const GFXglyph *hy = font_chain_glyph(chain, '-', NULL, NULL);
+    int16_t pen = 0, minx = INT16_MAX, maxx = INT16_MIN;
+    size_t best = 0, best_any = 0, letters = 0, taken = 0;
+    const char *end = line + len;
+    for (const char *p = line + word; p < end; letters++)
+    {
+        utf8_next(&p, end);
+    }
+    for (const char *p = line; p < end;)
+    {
+        uint32_t c = utf8_next(&p, end);
+        size_t k = p - line;
+        if (k == len)
+        {
+            break;
+        }
+        const GFXglyph *g = font_chain_lookup(chain, c, NULL, NULL);
+        if (g && g->width)
+        {
+            int16_t x1 = pen + g->xOffset, x2 = x1 + g->width - 1;
+            minx = x1 < minx ? x1 : minx;
+            maxx = x2 > maxx ? x2 : maxx;
+        }
+        pen += g ? g->xAdvance : 0;
+
+        if (k <= word)
+        {
+            continue;
+        }
+        taken++;
+        int16_t lo = minx, hi = maxx;
+        if (line[k - 1] != '-' && hy && hy->width)
+        {
+            int16_t x1 = pen + hy->xOffset, x2 = x1 + hy->width - 1;
+            lo = x1 < lo ? x1 : lo;
+            hi = x2 > hi ? x2 : hi;
+        }
+        if (hi >= lo && hi - lo + 1 > width)
+        {
+            break; // prefixes only get wider
+        }
+        best_any = k;
+        if (taken >= 2 && letters - taken >= 2)
+        {
+            best = k;
+        }
+    }
+    best = best ? best : best_any;
+    *hyphen = best && line[best - 1] != '-';
+    return best;
+}
+
+static void add_line(field_state_t *st, size_t start, size_t len, bool hyphen, const text_bounds_t *b)
+{
+    layout_line_t *l = &st->lines[st->count];
+    l->start = (uint16_t)start;
+    l->len = (uint16_t)len;
+    l->hyphen = hyphen;
+    st->bounds[st->count] = *b;
+    st->count++;
+}
+
+static size_t word_end(const char *text, size_t len, size_t pos)
+{
+    while (pos < len && text[pos] != ' ')
+    {
+        pos++;
+    }
+    return pos;
+}
+
+// Greedy wrap at spaces. Stops at max_lines, so a failed attempt is cheap.
+static layout_status_t wrap(const char *text, const font_chain_t *chain, uint16_t width, uint8_t max_lines, bool hyphenate,
+                            field_state_t *st)
+{
+    size_t len = strlen(text), pos = 0;
+    st->count = 0;
+    while (true)
+    {
+        while (pos < len && text[pos] == ' ')
+        {
+            pos++;
+        }
+        if (pos == len)
+        {
+            return LAYOUT_OK;
+        }
+        if (st->count == max_lines)
+        {
+            return LAYOUT_TOO_LONG;
+        }
+
+        size_t end = word_end(text, len, pos);
+        size_t word = pos; // where a word too long for any line starts
+        text_bounds_t b;
+        span_bounds(chain, text + pos, end - pos, false, &b);
+        bool overlong = b.w > width;
+
+        // Take in words while the line stays narrow enough
+        while (!overlong)
+        {
+            size_t next = end;
+            while (next < len && text[next] == ' ')
+            {
+                next++;
+            }
+            if (next == len)
+            {
+                break;
+            }
+            size_t next_end = word_end(text, len, next);
+            text_bounds_t nb;
+            span_bounds(chain, text + pos, next_end - pos, false, &nb);
+            if (nb.w <= width)
+            {
+                end = next_end;
+                b = nb;
+                continue;
+            }
+            // A word too long for any line is broken here, not on a line of its own
+            span_bounds(chain, text + next, next_end - next, false, &nb);
+            if (hyphenate && nb.w > width)
+            {
+                overlong = true;
+                word = next;
+                end = next_end;
+            }
+            break;
+        }
+
+        bool hyphen = false;
+        if (overlong)
+        {
+            size_t k = hyphenate ? hyphen_point(chain, text + pos, word - pos, end - pos, width, &hyphen) : 0;
+            if (k)
+            {
+                end = pos + k;
+            }
+            else if (word > pos)
+            {
+                // Not even a piece of it fits after the others: next line
+                for (end = word; text[end - 1] == ' '; end--)
+                {
+                }
+            }
+            else
+            {
+                return LAYOUT_TOO_WIDE;
+            }
+            span_bounds(chain, text + pos, end - pos, hyphen, &b);
+        }
+        add_line(st, pos, end - pos, hyphen, &b);
+        pos = end;
+    }
+}
+
+static void measure_height(field_state_t *st, uint16_t line_gap)
+{
+    st->height = 0;
+    for (uint8_t i = 0; i < st->count; i++)
+    {
+        st->height += st->bounds[i].h + (i ? line_gap : 0);
+    }
+}
+
+// Largest font the field fits the width in, whole words first
+static layout_status_t choose_font(const layout_field_t *f, const layout_box_t *box, field_state_t *st)
+{
+    uint8_t max_lines = f->max_lines < LAYOUT_FIELD_LINES ? f->max_lines : LAYOUT_FIELD_LINES;
+    layout_status_t status = LAYOUT_OK;
+    for (int hyphenate = 0; hyphenate < 2; hyphenate++)
+    {
+        for (uint8_t i = 0; i < f->font_count; i++)
+        {
+            status = wrap(f->text, &f->fonts[i], box->width, max_lines, hyphenate, st);
+            if (status == LAYOUT_OK)
+            {
+                st->font_idx = i;
+                st->hyphenate = hyphenate;
+                measure_height(st, box->line_gap);
+                return LAYOUT_OK;
+            }
+        }
+    }
+    // Best effort: the lines that fit, in the smallest font
+    st->font_idx = f->font_count - 1;
+    st->hyphenate = true;
+    wrap(f->text, &f->fonts[st->font_idx], box->width, max_lines, true, st);
+    measure_height(st, box->line_gap);
+    return status;
+}
+
+// Moves the field to the next smaller font it still fits in. Greedy breaks
+// differ between fonts, so that is not always the very next one. False, with
+// the field unchanged, if there is none.
+static bool step_down(const layout_field_t *f, const layout_box_t *box, field_state_t *st)
+{
+    uint8_t max_lines = f->max_lines < LAYOUT_FIELD_LINES ? f->max_lines : LAYOUT_FIELD_LINES;
+    field_state_t trial;
+    for (uint8_t i = st->font_idx + 1; i < f->font_count; i++)
+    {
+        for (int hyphenate = st->hyphenate; hyphenate < 2; hyphenate++)
+        {
+            if (wrap(f->text, &f->fonts[i], box->width, max_lines, hyphenate, &trial) == LAYOUT_OK)
+            {
+                trial.font_idx = i;
+                trial.hyphenate = hyphenate;
+                measure_height(&trial, box->line_gap);
+                *st = trial;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Height of the fields stacked at one anchor
+static uint16_t block_height(const layout_field_t *fields, const field_state_t *st, size_t count, uint8_t anchor,
+                             uint16_t field_gap)
+{
+    uint16_t h = 0;
+    bool any = false;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fields[i].anchor == anchor && st[i].count)
+        {
+            h += st[i].height + (any ? field_gap : 0);
+            any = true;
+        }
+    }
+    return h;
+}
+
+bool layout_fit(const layout_field_t *fields, size_t count, const layout_box_t *box, layout_result_t *out)
+{
+    field_state_t st[LAYOUT_MAX_FIELDS];
+    bool smallest[LAYOUT_MAX_FIELDS]; // no smaller font to step down to
+    memset(out, 0, sizeof(*out));
+    out->status = LAYOUT_OK;
+    out->overflow = -1;
+    count = count < LAYOUT_MAX_FIELDS ? count : LAYOUT_MAX_FIELDS;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        layout_status_t status = choose_font(&fields[i], box, &st[i]);
+        smallest[i] = status != LAYOUT_OK || st[i].font_idx + 1 == fields[i].font_count;
+        if (status != LAYOUT_OK && out->status == LAYOUT_OK)
+        {
+            out->status = status;
+            out->overflow = i;
+        }
+    }
+
+    // Too tall together: shrink the field in the largest font, one step at a time
+    uint16_t avail = box->height - box->top - box->bottom;
+    while (true)
+    {
+        uint16_t top = block_height(fields, st, count, LAYOUT_TOP, box->field_gap);
+        uint16_t bottom = block_height(fields, st, count, LAYOUT_BOTTOM, box->field_gap);
+        if (top + bottom + ((top && bottom) ? box->field_gap : 0) <= avail)
+        {
+            break;
+        }
+        int victim = -1, tallest = -1;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!st[i].count)
+            {
+                continue;
+            }
+            tallest = (tallest < 0 || st[i].height > st[tallest].height) ? (int)i : tallest;
+            if (!smallest[i] &&
+                (victim < 0 || fields[i].fonts[st[i].font_idx].fonts[0]->font.yAdvance >
+                                   fields[victim].fonts[st[victim].font_idx].fonts[0]->font.yAdvance))
+            {
+                victim = i;
+            }
+        }
+        if (victim < 0)
+        {
+            if (out->status == LAYOUT_OK)
+            {
+                out->status = LAYOUT_TOO_TALL;
+                out->overflow = tallest;
+            }
+            break;
+        }
+        smallest[victim] = !step_down(&fields[victim], box, &st[victim]) ||
+                           st[victim].font_idx + 1 == fields[victim].font_count;
+    }
+
+    // Place the lines, centered horizontally
+    int16_t y_top = box->top;
+    int16_t y_bottom = box->height - box->bottom -
+                       block_height(fields, st, count, LAYOUT_BOTTOM, box->field_gap);
+    for (size_t i = 0; i < count; i++)
+    {
+        out->font[i] = &fields[i].fonts[st[i].font_idx];
+        if (!st[i].count)
+        {
+            continue;
+        }
+        int16_t *y = fields[i].anchor == LAYOUT_BOTTOM ? &y_bottom : &y_top;
+        for (uint8_t j = 0; j < st[i].count; j++)
+        {
+            const text_bounds_t *b = &st[i].bounds[j];
+            layout_line_t *l = &out->lines[out->line_count++];
+            *l = st[i].lines[j];
+            l->field = i;
+            l->x = (int16_t)(((int32_t)box->width - b->w) / 2 - b->x1);
+            l->y = *y - b->y1; // baseline below the top of the ink
+            *y += b->h + box->line_gap;
+        }
+        *y += box->field_gap - box->line_gap;
+    }
+    return out->status == LAYOUT_OK;
+}
@@ -0,0 +1,293 @@
+#include "font_rle.h"
+#include <stdlib.h>
+#include <string.h>
+#include "utf8.h"
+
+typedef struct
+{
+    const GFXfontRLE *font; // NULL: free
+    uint16_t index;
+    uint16_t size;
+    uint32_t last_use;
+    uint8_t *bitmap;
+} cached_glyph_t;
+
+// Only the display worker draws, no locking needed
+static cached_glyph_t s_glyphs[FONT_RLE_CACHE_GLYPHS];
+static uint32_t s_use;
+static font_rle_stats_t s_stats;
+// Glyphs the cache has no memory for are decoded here and drawn at once
+static uint8_t s_scratch[FONT_RLE_GLYPH_MAX];
+
+static inline int get_bit(const uint8_t *bits, size_t i)
+{
+    return (bits[i >> 3] >> (7 - (i & 7))) & 1;
+}
+
+static size_t put_varint(uint8_t *out, uint32_t value)
+{
+    size_t len = 0;
+    while (value >= 0x80)
+    {
+        out[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[len++] = (uint8_t)value;
+    return len;
+}
+
+static uint32_t get_varint(const uint8_t **p, const uint8_t *end)
+{
+    uint32_t value = 0;
+    for (int shift = 0; *p < end && shift < 32; shift += 7)
+    {
+        uint8_t b = *(*p)++;
+        value |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+        {
+            break;
+        }
+    }
+    return value;
+}
+
+size_t font_rle_encode(const uint8_t *bits, uint16_t w, uint16_t h, uint8_t *out)
+{
+    size_t n = (size_t)w * h, len = 0;
+    uint32_t run = 0;
+    int color = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        int v = get_bit(bits, i) ^ (i >= w ? get_bit(bits, i - w) : 0);
+        if (v != color)
+        {
+            len += put_varint(out + len, run);
+            run = 0;
+            color = v;
+        }
+        run++;
+    }
+    if (color)
+    {
+        len += put_varint(out + len, run); // a trailing 0 run is implied
+    }
+    return len;
+}
+
+static void set_bits(uint8_t *row, uint16_t from, uint16_t count)
+{
+    uint16_t end = from + count;
+    for (; from < end && (from & 7); from++)
+    {
+        row[from >> 3] |= 0x80 >> (from & 7);
+    }
+    for (; end - from >= 8; from += 8)
+    {
+        row[from >> 3] = 0xFF;
+    }
+    for (; from < end; from++)
+    {
+        row[from >> 3] |= 0x80 >> (from & 7);
+    }
+}
+
+uint16_t font_rle_glyph_count(const GFXfontRLE *font)
+{
+    if (!font->range)
+    {
+        return font->font.last - font->font.first + 1;
+    }
+    const GFXrange *r = &font->range[font->rangeCount - 1];
+    return r->glyph + r->count;
+}
+
+int32_t font_rle_index(const GFXfontRLE *font, uint32_t c)
+{
+    if (!font->range)
+    {
+        return (c < font->font.first || c > font->font.last) ? -1 : (int32_t)(c - font->font.first);
+    }
+    int lo = 0, hi = font->rangeCount - 1;
+    while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        const GFXrange *r = &font->range[mid];
+        if (c < r->first)
+        {
+            hi = mid - 1;
+        }
+        else if (c - r->first >= r->count)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            return r->glyph + (c - r->first);
+        }
+    }
+    return -1;
+}
+
+const GFXglyph *font_chain_glyph(const font_chain_t *chain, uint32_t c, const GFXfontRLE **font,
+                                 uint16_t *index)
+{
+    for (uint8_t i = 0; i < chain->count; i++)
+    {
+        int32_t found = font_rle_index(chain->fonts[i], c);
+        if (found >= 0)
+        {
+            if (font)
+            {
+                *font = chain->fonts[i];
+            }
+            if (index)
+            {
+                *index = found;
+            }
+            return &chain->fonts[i]->font.glyph[found];
+        }
+    }
+    return NULL;
+}
+
+const GFXglyph *font_chain_lookup(const font_chain_t *chain, uint32_t c, const GFXfontRLE **font,
+                                  uint16_t *index)
+{
+    const GFXglyph *g = font_chain_glyph(chain, c, font, index);
+    char plain;
+    if (!g && c >= 0x80 && (plain = utf8_fallback(c)))
+    {
+        g = font_chain_glyph(chain, (unsigned char)plain, font, index);
+    }
+    return g;
+}
+
+void font_rle_decode(const GFXfontRLE *font, uint16_t index, uint8_t *out)
+{
+    const GFXglyph *g = &font->font.glyph[index];
+    uint16_t w = g->width, h = g->height, stride = (w + 7) / 8;
+    size_t n = (size_t)w * h, pos = 0;
+    const uint8_t *p = font->font.bitmap + g->bitmapOffset;
+    const uint8_t *end = font->font.bitmap +
+                         (index + 1 < font_rle_glyph_count(font) ? g[1].bitmapOffset : font->size);
+    memset(out, 0, (size_t)stride * h);
+
+    // Runs of 1 set the row differences...
+    bool color = false;
+    while (p < end && pos < n)
+    {
+        uint32_t run = get_varint(&p, end);
+        run = run < n - pos ? run : n - pos;
+        for (uint32_t left = run; color && left;)
+        {
+            uint16_t x = pos % w, seg = left < (uint32_t)(w - x) ? left : (uint32_t)(w - x);
+            set_bits(out + (pos / w) * stride, x, seg);
+            pos += seg;
+            left -= seg;
+        }
+        pos += color ? 0 : run;
+        color = !color;
+    }
+    // ...which add up down the rows; padding bits stay 0
+    for (size_t i = stride; i < (size_t)stride * h; i++)
+    {
+        out[i] ^= out[i - stride];
+    }
+}
+
+// Caller checked size <= FONT_RLE_GLYPH_MAX
+static const uint8_t *glyph_bitmap(const GFXfontRLE *font, uint16_t index, uint16_t size)
+{
+    cached_glyph_t *free_slot = NULL;
+    for (int i = 0; i < FONT_RLE_CACHE_GLYPHS; i++)
+    {
+        cached_glyph_t *e = &s_glyphs[i];
+        if (e->font == font && e->index == index)
+        {
+            e->last_use = ++s_use;
+            s_stats.hits++;
+            return e->bitmap;
+        }
+        if (!e->font && !free_slot)
+        {
+            free_slot = e;
+        }
+    }
+    s_stats.misses++;
+
+    // Evict the least recently drawn glyphs until it fits
+    while (!free_slot || s_stats.bytes + size > FONT_RLE_CACHE_BYTES)
+    {
+        cached_glyph_t *victim = NULL;
+        for (int i = 0; i < FONT_RLE_CACHE_GLYPHS; i++)
+        {
+            cached_glyph_t *e = &s_glyphs[i];
+            if (e->font && (!victim || e->last_use < victim->last_use))
+            {
+                victim = e;
+            }
+        }
+        if (!victim)
+        {
+            break;
+        }
+        free(victim->bitmap);
+        s_stats.bytes -= victim->size;
+        s_stats.evictions++;
+        victim->font = NULL;
+        free_slot = (!free_slot || victim < free_slot) ? victim : free_slot;
+    }
+
+    uint8_t *bitmap = free_slot ? malloc(size) : NULL;
+    if (!bitmap)
+    {
+        font_rle_decode(font, index, s_scratch);
+        return s_scratch;
+    }
+    font_rle_decode(font, index, bitmap);
+    free_slot->font = font;
+    free_slot->index = index;
+    free_slot->size = size;
+    free_slot->last_use = ++s_use;
+    free_slot->bitmap = bitmap;
+    s_stats.bytes += size;
+    return bitmap;
+}
+
+int16_t font_rle_draw(const font_chain_t *chain, const char *text, size_t len, int16_t x, int16_t y,
+                      font_rle_blit_t blit, void *ctx)
+{
+    for (const char *p = text, *end = text + len; p < end;)
+    {
+        const GFXfontRLE *font;
+        uint16_t index;
+        const GFXglyph *g = font_chain_lookup(chain, utf8_next(&p, end), &font, &index);
+        if (!g)
+        {
+            continue;
+        }
+        uint16_t size = (g->width + 7) / 8 * g->height;
+        if (size && size <= FONT_RLE_GLYPH_MAX)
+        {
+            blit(ctx, x + g->xOffset, y + g->yOffset, glyph_bitmap(font, index, size), g->width, g->height);
+        }
+        x += g->xAdvance;
+    }
+    return x;
+}
+
+void font_rle_get_stats(font_rle_stats_t *stats)
+{
+    *stats = s_stats;
+}
+
+void font_rle_flush(void)
+{
+    for (int i = 0; i < FONT_RLE_CACHE_GLYPHS; i++)
+    {
+        free(s_glyphs[i].bitmap);
+        s_glyphs[i].bitmap = NULL;
+        s_glyphs[i].font = NULL;
+    }
+    s_stats.bytes = 0;
+}
@@ -0,0 +1,3139 @@
+// Generated by font_pack, do not edit
+#include <stddef.h>
+#include "badge_fonts.h"
+
+static const uint8_t Roboto_Condensed_SemiBold75pt7bRLEBitmaps[] = {
+    0x01, 0x13, 0xB8, 0x03, 0x01, 0xFE, 0x01, 0x01, 0x88, 0x04, 0x01, 0xEB,
+    0x01, 0x01, 0x54, 0x0F, 0xF1, 0x01, 0x07, 0x0C, 0x02, 0x07, 0x02, 0x08,
+    0x02, 0x0B, 0x01, 0x06, 0x01, 0x0E, 0x01, 0x15, 0x01, 0x03, 0x01, 0x11,
+    0x01, 0x16, 0x01, 0x68, 0x01, 0x3F, 0x01, 0x11, 0x01, 0x13, 0x01, 0x04,
+    0x01, 0x0E, 0x01, 0x06, 0x02, 0x0B, 0x01, 0x09, 0x02, 0x07, 0x02, 0x00,
+    0x0D, 0x09, 0x0E, 0xAF, 0x03, 0x01, 0xE4, 0x01, 0x01, 0xA5, 0x01, 0x01,
+    0xC0, 0x01, 0x01, 0xC9, 0x01, 0x01, 0x19, 0x0C, 0x0B, 0x0C, 0x43, 0x01,
+    0x37, 0x01, 0x38, 0x01, 0x37, 0x01, 0xED, 0x01, 0x01, 0x37, 0x01, 0x70,
+    0x01, 0x0B, 0x01, 0xA5, 0x02, 0x01, 0x37, 0x01, 0x38, 0x01, 0x37, 0x01,
+    0xB1, 0x02, 0x01, 0x37, 0x01, 0x38, 0x01, 0x37, 0x01, 0xED, 0x01, 0x01,
+    0x37, 0x01, 0x38, 0x01, 0x28, 0x10, 0x0B, 0x0B, 0x0C, 0x0D, 0xF1, 0x05,
+    0x0E, 0x0C, 0x0A, 0x0C, 0x0F, 0x1E, 0x01, 0x37, 0x01, 0xED, 0x01, 0x01,
+    0x37, 0x01, 0x38, 0x01, 0x37, 0x01, 0xB1, 0x02, 0x01, 0x37, 0x01, 0x38,
+    0x01, 0x37, 0x01, 0xB1, 0x02, 0x01, 0x37, 0x01, 0x38, 0x01, 0x28, 0x10,
+    0x0B, 0x0B, 0x0C, 0x0D, 0xF1, 0x05, 0x0E, 0x0B, 0x0B, 0x0C, 0x0F, 0x12,
+    0x01, 0xA5, 0x02, 0x01, 0x0B, 0x01, 0x70, 0x01, 0x37, 0x01, 0xED, 0x01,
+    0x01, 0x37, 0x01, 0x38, 0x01, 0x37, 0x01, 0xB1, 0x02, 0x01, 0x37, 0x01,
+    0x38, 0x01, 0x37, 0x01, 0xA5, 0x02, 0x01, 0x0B, 0x01, 0x64, 0x01, 0x0B,
+    0x01, 0x1B, 0x0A, 0xF9, 0x06, 0x01, 0x36, 0x05, 0x0B, 0x04, 0x26, 0x02,
+    0x14, 0x03, 0x21, 0x02, 0x19, 0x02, 0x1D, 0x02, 0x1D, 0x01, 0x1B, 0x01,
+    0x20, 0x01, 0x19, 0x01, 0x22, 0x02, 0x15, 0x02, 0x25, 0x01, 0x13, 0x01,
+    0x28, 0x01, 0x3C, 0x01, 0x10, 0x01, 0x3A, 0x01, 0x2C, 0x01, 0x0D, 0x01,
+    0x2E, 0x01, 0x47, 0x01, 0x30, 0x01, 0x5B, 0x08, 0x15, 0x01, 0x08, 0x01,
+    0x14, 0x01, 0x08, 0x01, 0x31, 0x01, 0x0A, 0x01, 0x2F, 0x01, 0x0C, 0x01,
+    0x13, 0x01, 0x06, 0x01, 0x12, 0x01, 0x0E, 0x01, 0x78, 0x01, 0x2A, 0x01,
+    0x23, 0x01, 0x7C, 0x01, 0x24, 0x01, 0xC6, 0x01, 0x01, 0x7B, 0x01, 0x8A,
+    0x01, 0x01, 0x12, 0x13, 0x8F, 0x01, 0x01, 0x3C, 0x01, 0x27, 0x01, 0x14,
+    0x01, 0x3C, 0x01, 0x3C, 0x01, 0x25, 0x01, 0x16, 0x01, 0x3C, 0x02, 0x23,
+    0x01, 0x18, 0x01, 0x3C, 0x02, 0x21, 0x01, 0x1A, 0x02, 0x20, 0x01, 0x1B,
+    0x02, 0x1F, 0x01, 0x1C, 0x02, 0x1E, 0x01, 0x1D, 0x02, 0x3C, 0x02, 0x1B,
+    0x01, 0x20, 0x01, 0x1B, 0x02, 0x1F, 0x02, 0x1B, 0x01, 0x20, 0x01, 0x1B,
+    0x01, 0x20, 0x02, 0x1A, 0x02, 0x20, 0x01, 0x1B, 0x02, 0x1F, 0x01, 0x1C,
+    0x01, 0x1F, 0x01, 0x1C, 0x02, 0x1E, 0x01, 0x1D, 0x02, 0x3C, 0x02, 0x1B,
+    0x01, 0x20, 0x02, 0x1A, 0x01, 0x21, 0x02, 0x3C, 0x02, 0x17, 0x01, 0x24,
+    0x02, 0x3C, 0x01, 0x15, 0x01, 0x26, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x13,
+    0x01, 0x64, 0x01, 0x78, 0x01, 0x13, 0x12, 0x29, 0x01, 0x8A, 0x01, 0x01,
+    0x99, 0x02, 0x01, 0x4E, 0x01, 0x63, 0x01, 0x28, 0x01, 0x27, 0x01, 0x28,
+    0x01, 0x25, 0x01, 0x29, 0x01, 0x3C, 0x01, 0x0F, 0x01, 0x13, 0x01, 0x03,
+    0x01, 0x14, 0x01, 0x0D, 0x01, 0x2E, 0x02, 0x09, 0x02, 0x1A, 0x01, 0x16,
+    0x09, 0x16, 0x01, 0x42, 0x01, 0x33, 0x01, 0x44, 0x01, 0x31, 0x01, 0x0A,
+    0x01, 0x2F, 0x01, 0x0C, 0x01, 0x2D, 0x01, 0x4A, 0x01, 0x2B, 0x01, 0x10,
+    0x02, 0x28, 0x01, 0x13, 0x01, 0x25, 0x02, 0x15, 0x01, 0x23, 0x01, 0x18,
+    0x02, 0x1F, 0x02, 0x1B, 0x02, 0x1B, 0x02, 0x1F, 0x03, 0x15, 0x03, 0x24,
+    0x04, 0x0D, 0x04, 0x2B, 0x01, 0x0B, 0x01, 0x0F, 0x09, 0x44, 0x03, 0x09,
+    0x03, 0x3F, 0x02, 0x0F, 0x02, 0x3B, 0x02, 0x13, 0x02, 0x38, 0x01, 0x17,
+    0x01, 0x36, 0x01, 0x19, 0x01, 0x34, 0x01, 0x1B, 0x01, 0x32, 0x01, 0x1D,
+    0x01, 0x80, 0x01, 0x01, 0x1F, 0x01, 0x2E, 0x01, 0x5F, 0x03, 0x0F, 0x01,
+    0x3B, 0x02, 0x03, 0x02, 0x21, 0x03, 0x16, 0x01, 0x0D, 0x01, 0x07, 0x01,
+    0x23, 0x02, 0x21, 0x01, 0x09, 0x01, 0x0C, 0x01, 0x11, 0x01, 0x05, 0x01,
+    0x48, 0x01, 0x07, 0x02, 0x1D, 0x01, 0x0B, 0x01, 0x26, 0x02, 0x0E, 0x01,
+    0x34, 0x01, 0x0B, 0x01, 0x84, 0x01, 0x01, 0x0D, 0x01, 0x0B, 0x01, 0x6B,
+    0x01, 0x26, 0x01, 0x0B, 0x01, 0x92, 0x01, 0x01, 0x0B, 0x01, 0x92, 0x01,
+    0x01, 0x0B, 0x01, 0x92, 0x01, 0x01, 0x0B, 0x01, 0x4E, 0x01, 0x20, 0x01,
+    0x22, 0x01, 0x46, 0x01, 0x13, 0x01, 0x43, 0x01, 0x21, 0x01, 0x38, 0x01,
+    0x23, 0x01, 0x0B, 0x01, 0x13, 0x01, 0x4E, 0x01, 0x0B, 0x01, 0x25, 0x01,
+    0x09, 0x01, 0x0C, 0x01, 0x2B, 0x01, 0x0D, 0x01, 0x07, 0x01, 0x13, 0x01,
+    0x0B, 0x01, 0x28, 0x02, 0x03, 0x02, 0x3B, 0x01, 0x0F, 0x03, 0x0F, 0x01,
+    0x05, 0x01, 0x0B, 0x01, 0x6C, 0x01, 0x1F, 0x01, 0x05, 0x01, 0x0B, 0x01,
+    0x6E, 0x01, 0x1D, 0x01, 0x05, 0x01, 0x0B, 0x01, 0x20, 0x01, 0x1B, 0x01,
+    0x34, 0x01, 0x19, 0x01, 0x06, 0x01, 0x0B, 0x01, 0x23, 0x01, 0x17, 0x01,
+    0x12, 0x01, 0x25, 0x02, 0x13, 0x02, 0x07, 0x01, 0x33, 0x02, 0x0F, 0x02,
+    0x14, 0x01, 0x2A, 0x03, 0x09, 0x03, 0x0A, 0x01, 0x39, 0x09, 0x18, 0x01,
+    0x43, 0x01, 0x5A, 0x01, 0x43, 0x01, 0x4E, 0x01, 0x0B, 0x01, 0x92, 0x01,
+    0x01, 0x0B, 0x01, 0x92, 0x01, 0x01, 0x0B, 0x01, 0x5B, 0x0A, 0x2D, 0x01,
+    0x0B, 0x01, 0x09, 0x03, 0x0A, 0x03, 0x3E, 0x02, 0x10, 0x02, 0x27, 0x01,
+    0x0B, 0x01, 0x07, 0x01, 0x14, 0x01, 0x38, 0x02, 0x16, 0x01, 0x24, 0x01,
+    0x0B, 0x01, 0x05, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x21, 0x01, 0x21, 0x01,
+    0x11, 0x01, 0x1C, 0x01, 0x2B, 0x01, 0x05, 0x01, 0x1E, 0x01, 0x1E, 0x01,
+    0x5A, 0x01, 0x05, 0x01, 0x20, 0x01, 0x1C, 0x01, 0x20, 0x04, 0x2A, 0x01,
+    0x0B, 0x01, 0x05, 0x01, 0x0D, 0x02, 0x04, 0x02, 0x0D, 0x01, 0x39, 0x01,
+    0x08, 0x01, 0x26, 0x01, 0x0B, 0x01, 0x55, 0x01, 0x0C, 0x01, 0x0A, 0x01,
+    0x0C, 0x01, 0x17, 0x01, 0x0B, 0x01, 0x62, 0x01, 0x2F, 0x01, 0x0B, 0x01,
+    0x20, 0x01, 0x71, 0x01, 0x0B, 0x01, 0x92, 0x01, 0x01, 0x0B, 0x01, 0x92,
+    0x01, 0x01, 0x0B, 0x01, 0x4E, 0x01, 0x43, 0x01, 0x5A, 0x01, 0x43, 0x01,
+    0x5A, 0x01, 0x43, 0x01, 0x4E, 0x01, 0x0B, 0x01, 0x1A, 0x01, 0x0C, 0x01,
+    0x6A, 0x01, 0x0B, 0x01, 0x5F, 0x01, 0x0C, 0x01, 0x17, 0x01, 0x0E, 0x02,
+    0x09, 0x01, 0x1E, 0x01, 0x09, 0x01, 0x1D, 0x01, 0x28, 0x01, 0x07, 0x01,
+    0x1F, 0x02, 0x05, 0x01, 0x12, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x0D, 0x01,
+    0x14, 0x02, 0x26, 0x04, 0x26, 0x03, 0x14, 0x01, 0x20, 0x01, 0x7F, 0x01,
+    0x1E, 0x01, 0x31, 0x01, 0x1C, 0x01, 0x4E, 0x01, 0x34, 0x01, 0x50, 0x02,
+    0x16, 0x02, 0x38, 0x01, 0x14, 0x01, 0x3B, 0x02, 0x10, 0x02, 0x3E, 0x03,
+    0x0A, 0x03, 0x1A, 0x0B, 0x3D, 0x04, 0x0B, 0x03, 0x38, 0x02, 0x12, 0x02,
+    0x34, 0x02, 0x16, 0x02, 0x31, 0x01, 0x1A, 0x01, 0x2F, 0x01, 0x1C, 0x02,
+    0x2C, 0x01, 0x1F, 0x01, 0x2A, 0x01, 0x21, 0x01, 0x28, 0x01, 0x4A, 0x01,
+    0x24, 0x01, 0x25, 0x01, 0x26, 0x01, 0x6F, 0x01, 0x28, 0x01, 0x6D, 0x01,
+    0x2A, 0x01, 0x36, 0x02, 0x33, 0x01, 0x13, 0x03, 0x02, 0x02, 0x44, 0x01,
+    0x07, 0x01, 0x11, 0x01, 0x30, 0x01, 0x09, 0x01, 0x40, 0x01, 0x0B, 0x01,
+    0x79, 0x01, 0x10, 0x01, 0x0D, 0x01, 0xA7, 0x01, 0x01, 0x97, 0x01, 0x01,
+    0xEB, 0x02, 0x01, 0x3D, 0x01, 0x58, 0x01, 0x0F, 0x01, 0x1D, 0x01, 0x5D,
+    0x01, 0x0A, 0x01, 0x4A, 0x01, 0x10, 0x01, 0x1F, 0x01, 0x11, 0x01, 0x07,
+    0x01, 0x4A, 0x01, 0x11, 0x01, 0x33, 0x01, 0x03, 0x02, 0x11, 0x01, 0x22,
+    0x01, 0x12, 0x01, 0x01, 0x01, 0x4A, 0x01, 0x13, 0x01, 0x24, 0x01, 0x25,
+    0x01, 0x4A, 0x01, 0x27, 0x01, 0x6E, 0x01, 0x29, 0x01, 0x20, 0x01, 0x49,
+    0x02, 0x2C, 0x01, 0x1C, 0x01, 0x2F, 0x01, 0x1A, 0x01, 0x4A, 0x01, 0x32,
+    0x01, 0x17, 0x01, 0x33, 0x01, 0x15, 0x02, 0x33, 0x01, 0x16, 0x01, 0x33,
+    0x01, 0x4A, 0x01, 0x19, 0x01, 0x30, 0x01, 0x1B, 0x01, 0x2E, 0x01, 0x2B,
+    0x10, 0x0F, 0x01, 0x1E, 0x01, 0x2B, 0x01, 0x20, 0x01, 0x29, 0x01, 0x4A,
+    0x01, 0x23, 0x01, 0x26, 0x01, 0x25, 0x01, 0x24, 0x01, 0x27, 0x01, 0x36,
+    0x02, 0x36, 0x01, 0x12, 0x01, 0x16, 0x01, 0x33, 0x01, 0x03, 0x01, 0x14,
+    0x01, 0x1F, 0x01, 0x17, 0x01, 0x1A, 0x01, 0x0F, 0x01, 0x1A, 0x01, 0x1A,
+    0x01, 0x1D, 0x01, 0x19, 0x01, 0x14, 0x01, 0x37, 0x01, 0x42, 0x01, 0x1D,
+    0x01, 0x02, 0x01, 0x17, 0x01, 0x1C, 0x01, 0x14, 0x01, 0x37, 0x01, 0x14,
+    0x01, 0x10, 0x01, 0x65, 0x01, 0x0C, 0x01, 0x4C, 0x01, 0x4C, 0x01, 0x21,
+    0x01, 0x76, 0x01, 0x4C, 0x01, 0x1E, 0x01, 0x67, 0x01, 0x11, 0x01, 0x4C,
+    0x01, 0x1B, 0x01, 0x7C, 0x01, 0x19, 0x01, 0x1E, 0x01, 0x13, 0x01, 0x24,
+    0x01, 0x3E, 0x01, 0x20, 0x01, 0x13, 0x01, 0x15, 0x01, 0x22, 0x01, 0x28,
+    0x01, 0x34, 0x02, 0x24, 0x01, 0x14, 0x02, 0x0E, 0x01, 0x18, 0x01, 0x24,
+    0x01, 0x0B, 0x02, 0x1A, 0x01, 0x0D, 0x01, 0x16, 0x04, 0x02, 0x05, 0x45,
+    0x02, 0x22, 0x01, 0x0D, 0x01, 0x3E, 0x01, 0x4C, 0x01, 0x0C, 0x01, 0x4C,
+    0x01, 0x3E, 0x01, 0x0D, 0x01, 0x3E, 0x01, 0x59, 0x01, 0x3E, 0x01, 0x0D,
+    0x02, 0x27, 0x02, 0x14, 0x01, 0x0E, 0x01, 0x25, 0x01, 0x26, 0x01, 0x22,
+    0x02, 0x03, 0x01, 0x14, 0x01, 0x0F, 0x02, 0x1E, 0x02, 0x06, 0x01, 0x14,
+    0x01, 0x10, 0x02, 0x1A, 0x02, 0x09, 0x01, 0x14, 0x01, 0x11, 0x03, 0x14,
+    0x03, 0x35, 0x04, 0x0C, 0x04, 0x0F, 0x15, 0x00, 0x0E, 0xC1, 0x02, 0x01,
+    0xC2, 0x01, 0x01, 0x1E, 0x01, 0x1F, 0x02, 0x1F, 0x01, 0x20, 0x01, 0x04,
+    0x01, 0x1B, 0x01, 0x20, 0x01, 0x20, 0x01, 0x08, 0x01, 0x17, 0x01, 0x20,
+    0x01, 0x20, 0x01, 0x0C, 0x01, 0x13, 0x01, 0x20, 0x01, 0x0E, 0x01, 0x20,
+    0x01, 0x12, 0x01, 0x20, 0x01, 0x0E, 0x01, 0x20, 0x01, 0x12, 0x01, 0x0D,
+    0x01, 0x12, 0x01, 0x2F, 0x01, 0x12, 0x01, 0x0D, 0x01, 0x12, 0x01, 0x2F,
+    0x01, 0x12, 0x01, 0x2F, 0x01, 0x12, 0x01, 0x2F, 0x01, 0x12, 0x01, 0x2F,
+    0x01, 0x34, 0x01, 0x2F, 0x01, 0x12, 0x01, 0x51, 0x01, 0x12, 0x01, 0x51,
+    0x01, 0x12, 0x01, 0x64, 0x01, 0x0E, 0x01, 0x55, 0x01, 0x30, 0x01, 0x77,
+    0x01, 0x52, 0x01, 0x55, 0x01, 0x96, 0x01, 0x01, 0x55, 0x01, 0xFB, 0x07,
+    0x01, 0x75, 0x01, 0x78, 0x01, 0x75, 0x01, 0x34, 0x01, 0x97, 0x01, 0x01,
+    0x12, 0x01, 0x66, 0x01, 0x0E, 0x01, 0x57, 0x01, 0x30, 0x01, 0x35, 0x01,
+    0x30, 0x01, 0x35, 0x01, 0x30, 0x01, 0x13, 0x01, 0x52, 0x01, 0x13, 0x01,
+    0x30, 0x01, 0x13, 0x01, 0x30, 0x01, 0x13, 0x01, 0x30, 0x01, 0x13, 0x01,
+    0x22, 0x01, 0x0D, 0x01, 0x22, 0x01, 0x13, 0x01, 0x30, 0x01, 0x13, 0x01,
+    0x0E, 0x01, 0x13, 0x01, 0x22, 0x01, 0x0D, 0x01, 0x22, 0x01, 0x13, 0x01,
+    0x0E, 0x01, 0x13, 0x01, 0x22, 0x01, 0x22, 0x01, 0x0B, 0x01, 0x16, 0x01,
+    0x22, 0x01, 0x22, 0x01, 0x07, 0x01, 0x1A, 0x01, 0x22, 0x01, 0x22, 0x01,
+    0x03, 0x01, 0x1E, 0x02, 0x03, 0x01, 0x23, 0x02, 0x23, 0x01, 0x1E, 0x01,
+    0x04, 0x01, 0x23, 0x02, 0x23, 0x01, 0x19, 0x01, 0x09, 0x01, 0x23, 0x01,
+    0x39, 0x01, 0x0C, 0x01, 0x23, 0x01, 0x14, 0x01, 0x0E, 0x01, 0x14, 0x01,
+    0x0E, 0x01, 0x14, 0x01, 0x0E, 0x01, 0x37, 0x01, 0x0E, 0x01, 0x14, 0x01,
+    0x0E, 0x01, 0x37, 0x01, 0x0E, 0x01, 0x14, 0x01, 0x31, 0x01, 0x14, 0x01,
+    0x0E, 0x01, 0x37, 0x01, 0x0E, 0x01, 0x37, 0x01, 0x0E, 0x01, 0x46, 0x01,
+    0x13, 0x01, 0x32, 0x01, 0x13, 0x01, 0x55, 0x01, 0x13, 0x01, 0x55, 0x01,
+    0x13, 0x01, 0x32, 0x01, 0x59, 0x01, 0x32, 0x01, 0x59, 0x01, 0x0F, 0x01,
+    0x8C, 0x01, 0x01, 0x12, 0x01, 0x9C, 0x01, 0x01, 0x58, 0x01, 0xBF, 0x01,
+    0x01, 0xD3, 0x07, 0x01, 0x9D, 0x01, 0x01, 0x78, 0x01, 0x7A, 0x01, 0x32,
+    0x01, 0x7A, 0x01, 0x0F, 0x01, 0x67, 0x01, 0x35, 0x01, 0x54, 0x01, 0x12,
+    0x01, 0x54, 0x01, 0x35, 0x01, 0x0E, 0x01, 0x35, 0x01, 0x31, 0x01, 0x35,
+    0x01, 0x0E, 0x01, 0x35, 0x01, 0x0E, 0x01, 0x35, 0x01, 0x0E, 0x01, 0x35,
+    0x01, 0x0E, 0x01, 0x21, 0x01, 0x13, 0x01, 0x30, 0x01, 0x13, 0x01, 0x21,
+    0x01, 0x0E, 0x01, 0x21, 0x01, 0x13, 0x01, 0x21, 0x01, 0x0E, 0x01, 0x12,
+    0x01, 0x0E, 0x01, 0x12, 0x01, 0x0E, 0x01, 0x21, 0x01, 0x14, 0x01, 0x2F,
+    0x01, 0x21, 0x01, 0x17, 0x01, 0x09, 0x01, 0x21, 0x01, 0x20, 0x02, 0x1B,
+    0x01, 0x04, 0x01, 0x21, 0x01, 0x20, 0x02, 0x19, 0x0D, 0xA8, 0x05, 0x01,
+    0x87, 0x02, 0x01, 0x1D, 0x01, 0x3F, 0x02, 0x32, 0x02, 0x07, 0x01, 0x03,
+    0x03, 0x2D, 0x02, 0x10, 0x02, 0x28, 0x03, 0x04, 0x01, 0x0F, 0x03, 0x22,
+    0x03, 0x0D, 0x01, 0x0C, 0x02, 0x1E, 0x02, 0x1F, 0x03, 0x18, 0x03, 0x24,
+    0x02, 0x14, 0x02, 0x10, 0x01, 0x03, 0x01, 0x14, 0x03, 0x0E, 0x03, 0x2E,
+    0x01, 0x0B, 0x02, 0x55, 0x01, 0x01, 0x01, 0x7D, 0x03, 0x3B, 0x01, 0x03,
+    0x03, 0x35, 0x04, 0x06, 0x04, 0x2E, 0x03, 0x0E, 0x03, 0x27, 0x04, 0x14,
+    0x03, 0x21, 0x03, 0x1B, 0x04, 0x19, 0x04, 0x22, 0x02, 0x14, 0x03, 0x27,
+    0x01, 0x12, 0x02, 0x3D, 0x01, 0x2A, 0x01, 0x14, 0x01, 0x28, 0x01, 0x16,
+    0x01, 0x26, 0x01, 0x18, 0x01, 0x24, 0x01, 0x59, 0x01, 0x22, 0x01, 0x0D,
+    0x02, 0x0D, 0x01, 0x20, 0x01, 0x0D, 0x01, 0x10, 0x01, 0x1E, 0x01, 0x11,
+    0x01, 0x3A, 0x01, 0x04, 0x01, 0x0D, 0x01, 0x1C, 0x01, 0x0D, 0x01, 0x14,
+    0x01, 0x1A, 0x01, 0x15, 0x01, 0x0E, 0x01, 0x18, 0x01, 0x0E, 0x01, 0x08,
+    0x01, 0x25, 0x01, 0x0E, 0x01, 0x18, 0x01, 0x30, 0x01, 0x0E, 0x01, 0x14,
+    0x01, 0x0E, 0x01, 0x1B, 0x01, 0x12, 0x01, 0x1C, 0x01, 0x0F, 0x01, 0x10,
+    0x01, 0x0F, 0x01, 0x0E, 0x01, 0x1F, 0x01, 0x0E, 0x01, 0x30, 0x01, 0x1E,
+    0x01, 0x0D, 0x01, 0x12, 0x02, 0x0A, 0x01, 0x12, 0x01, 0x0B, 0x01, 0x15,
+    0x01, 0x08, 0x01, 0x1D, 0x02, 0x17, 0x02, 0x1B, 0x01, 0x07, 0x01, 0x1B,
+    0x01, 0x04, 0x01, 0x1B, 0x02, 0x1D, 0x02, 0x01, 0x01, 0x17, 0x01, 0x03,
+    0x01, 0x21, 0x01, 0x19, 0x01, 0x01, 0x01, 0x15, 0x12, 0xA5, 0x0D, 0x15,
+    0x12, 0x15, 0xC0, 0x07, 0x15, 0x12, 0x15, 0x08, 0x10, 0xB7, 0x03, 0x01,
+    0x27, 0x01, 0x4E, 0x01, 0x0F, 0x01, 0x36, 0x01, 0x0F, 0x01, 0x1E, 0x01,
+    0x0F, 0x01, 0x1E, 0x01, 0x0F, 0x01, 0x1E, 0x01, 0x0F, 0x01, 0x16, 0x01,
+    0x07, 0x01, 0x16, 0x01, 0x0F, 0x01, 0x07, 0x02, 0x0D, 0x01, 0x0A, 0x02,
+    0x0A, 0x01, 0x0D, 0x02, 0x07, 0x01, 0x10, 0x02, 0x04, 0x01, 0x13, 0x02,
+    0x01, 0x01, 0x00, 0x21, 0x09, 0x05, 0x0E, 0x03, 0x05, 0x03, 0x09, 0x02,
+    0x0B, 0x02, 0x06, 0x01, 0x0F, 0x01, 0x04, 0x01, 0x27, 0x01, 0x02, 0x01,
+    0x29, 0x01, 0x16, 0x01, 0x41, 0x01, 0x56, 0x01, 0x01, 0x01, 0x16, 0x01,
+    0x11, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x06, 0x01, 0x0D, 0x01, 0x08, 0x03,
+    0x07, 0x03, 0x21, 0x0E, 0x4F, 0x01, 0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20,
+    0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B,
+    0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B, 0x01, 0x01,
+    0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01,
+    0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01,
+    0x01, 0x20, 0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20,
+    0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B,
+    0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B, 0x01, 0x01,
+    0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01,
+    0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01,
+    0x01, 0x20, 0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20,
+    0x01, 0x8B, 0x01, 0x01, 0x0D, 0x01, 0x8B, 0x01, 0x01, 0x20, 0x01, 0x8B,
+    0x01, 0x01, 0x0D, 0x01, 0x7D, 0x01, 0x0D, 0x01, 0xAC, 0x01, 0x01, 0x0D,
+    0x01, 0x7D, 0x01, 0x0D, 0x01, 0x18, 0x0C, 0x2C, 0x04, 0x0C, 0x04, 0x26,
+    0x02, 0x14, 0x02, 0x22, 0x02, 0x18, 0x02, 0x1E, 0x02, 0x1C, 0x02, 0x1B,
+    0x01, 0x20, 0x01, 0x19, 0x01, 0x22, 0x01, 0x17, 0x01, 0x24, 0x01, 0x15,
+    0x01, 0x26, 0x01, 0x13, 0x01, 0x28, 0x01, 0x11, 0x01, 0x2A, 0x01, 0x4B,
+    0x01, 0x2C, 0x01, 0x0D, 0x01, 0x6A, 0x01, 0x0B, 0x01, 0x17, 0x02, 0x17,
+    0x01, 0x1F, 0x03, 0x02, 0x03, 0x32, 0x02, 0x08, 0x02, 0x1C, 0x01, 0x12,
+    0x01, 0x0C, 0x01, 0x12, 0x01, 0x43, 0x01, 0x12, 0x01, 0x0E, 0x01, 0x12,
+    0x01, 0x54, 0x01, 0x10, 0x01, 0x17, 0x01, 0x4D, 0x01, 0x24, 0x01, 0x29,
+    0x01, 0x8D, 0x01, 0x01, 0x11, 0x01, 0x50, 0x01, 0x11, 0x01, 0xAD, 0x02,
+    0x01, 0xEE, 0x01, 0x01, 0xC3, 0x0E, 0x01, 0x3C, 0x01, 0x8F, 0x03, 0x01,
+    0x26, 0x01, 0x26, 0x01, 0x02, 0x01, 0xC6, 0x01, 0x01, 0x12, 0x01, 0x16,
+    0x01, 0x36, 0x01, 0x53, 0x01, 0x10, 0x01, 0x4D, 0x01, 0x06, 0x01, 0x12,
+    0x01, 0x0E, 0x01, 0x56, 0x01, 0x12, 0x01, 0x0C, 0x01, 0x12, 0x01, 0x1C,
+    0x02, 0x08, 0x02, 0x32, 0x03, 0x02, 0x03, 0x14, 0x01, 0x0A, 0x01, 0x17,
+    0x02, 0x23, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x2C, 0x01, 0x3A, 0x01, 0x10,
+    0x01, 0x3C, 0x01, 0x28, 0x01, 0x13, 0x01, 0x26, 0x01, 0x15, 0x01, 0x24,
+    0x01, 0x17, 0x01, 0x22, 0x01, 0x19, 0x01, 0x1F, 0x02, 0x1B, 0x02, 0x1C,
+    0x01, 0x1F, 0x02, 0x18, 0x02, 0x22, 0x02, 0x13, 0x03, 0x26, 0x04, 0x0B,
+    0x04, 0x24, 0x03, 0x21, 0x03, 0x22, 0x02, 0x23, 0x02, 0x22, 0x03, 0x22,
+    0x02, 0x23, 0x02, 0x22, 0x03, 0x22, 0x02, 0x22, 0x03, 0x22, 0x02, 0x23,
+    0x02, 0x22, 0x03, 0x22, 0x02, 0x22, 0x03, 0x22, 0x02, 0xC9, 0x02, 0x02,
+    0x23, 0x02, 0x22, 0x03, 0x22, 0x02, 0x22, 0x03, 0x22, 0x02, 0x22, 0x03,
+    0x22, 0x02, 0x23, 0x02, 0x18, 0x0D, 0x2D, 0x04, 0x0D, 0x04, 0x27, 0x02,
+    0x15, 0x03, 0x22, 0x02, 0x1A, 0x02, 0x1E, 0x02, 0x1E, 0x02, 0x1B, 0x01,
+    0x22, 0x01, 0x18, 0x02, 0x24, 0x01, 0x16, 0x01, 0x27, 0x01, 0x14, 0x01,
+    0x29, 0x01, 0x12, 0x01, 0x2B, 0x01, 0x10, 0x01, 0x2D, 0x01, 0x3E, 0x01,
+    0x0D, 0x01, 0x3C, 0x01, 0x31, 0x01, 0x48, 0x01, 0x18, 0x02, 0x19, 0x01,
+    0x08, 0x01, 0x15, 0x04, 0x02, 0x04, 0x33, 0x01, 0x0A, 0x01, 0x15, 0x01,
+    0x1B, 0x01, 0x0C, 0x01, 0x1B, 0x01, 0x13, 0x01, 0x0E, 0x01, 0x2D, 0x01,
+    0x29, 0x01, 0x12, 0x01, 0x11, 0x01, 0x13, 0x01, 0x68, 0x01, 0x29, 0x01,
+    0x2A, 0x01, 0xA3, 0x01, 0x01, 0x27, 0x01, 0xE1, 0x02, 0x12, 0x54, 0x01,
+    0x8D, 0x01, 0x01, 0x68, 0x01, 0x8D, 0x01, 0x01, 0x2A, 0x01, 0x7A, 0x01,
+    0x12, 0x01, 0x67, 0x01, 0x12, 0x01, 0x29, 0x01, 0x50, 0x01, 0x29, 0x01,
+    0x50, 0x01, 0x29, 0x01, 0x3C, 0x01, 0x13, 0x01, 0x66, 0x01, 0x13, 0x01,
+    0x28, 0x01, 0x13, 0x01, 0x28, 0x01, 0x51, 0x01, 0x28, 0x01, 0x13, 0x01,
+    0x28, 0x01, 0x3C, 0x01, 0x14, 0x01, 0x3C, 0x01, 0x28, 0x01, 0x13, 0x01,
+    0x28, 0x01, 0x3C, 0x01, 0x14, 0x01, 0x27, 0x01, 0x14, 0x01, 0x3C, 0x01,
+    0x28, 0x01, 0x13, 0x01, 0x28, 0x01, 0x3C, 0x01, 0x14, 0x01, 0x3C, 0x01,
+    0x28, 0x01, 0x13, 0x01, 0x28, 0x01, 0x3C, 0x01, 0x14, 0x01, 0x27, 0x01,
+    0x14, 0x01, 0x3C, 0x01, 0x28, 0x01, 0x3C, 0x01, 0x14, 0x01, 0x27, 0x01,
+    0x14, 0x01, 0x65, 0x01, 0x14, 0x01, 0x27, 0x01, 0x14, 0x01, 0x27, 0x01,
+    0x14, 0x01, 0x27, 0x01, 0x52, 0x01, 0x27, 0x01, 0x14, 0x01, 0x27, 0x01,
+    0x3C, 0x01, 0x15, 0x01, 0x3C, 0x01, 0x27, 0x01, 0x14, 0x01, 0x27, 0x01,
+    0x3C, 0x01, 0x16, 0x25, 0x01, 0x01, 0x18, 0x0D, 0x2C, 0x04, 0x0D, 0x04,
+    0x26, 0x02, 0x15, 0x03, 0x21, 0x02, 0x1A, 0x02, 0x1D, 0x02, 0x1E, 0x02,
+    0x19, 0x02, 0x22, 0x01, 0x17, 0x01, 0x25, 0x01, 0x15, 0x01, 0x27, 0x02,
+    0x12, 0x01, 0x2A, 0x01, 0x10, 0x01, 0x3B, 0x01, 0x2D, 0x01, 0x3D, 0x01,
+    0x0C, 0x01, 0x30, 0x01, 0x0A, 0x01, 0x6F, 0x01, 0x08, 0x01, 0x19, 0x01,
+    0x38, 0x04, 0x01, 0x04, 0x16, 0x01, 0x06, 0x01, 0x14, 0x02, 0x09, 0x02,
+    0x2F, 0x01, 0x0D, 0x01, 0x2D, 0x01, 0x0F, 0x01, 0x13, 0x01, 0x04, 0x01,
+    0x4F, 0x01, 0x11, 0x01, 0x66, 0x01, 0x13, 0x01, 0x52, 0x01, 0x39, 0x01,
+    0xB9, 0x01, 0x13, 0xD8, 0x02, 0x01, 0xA3, 0x01, 0x01, 0x4E, 0x01, 0x29,
+    0x01, 0x4E, 0x01, 0x29, 0x01, 0x3B, 0x01, 0x12, 0x01, 0x27, 0x02, 0x39,
+    0x02, 0x14, 0x01, 0x19, 0x0D, 0x15, 0x01, 0x78, 0x01, 0x3B, 0x01, 0x3A,
+    0x02, 0x3A, 0x01, 0x3B, 0x01, 0x3B, 0x01, 0x3C, 0x02, 0x3D, 0x02, 0x3D,
+    0x01, 0x3D, 0x02, 0x3D, 0x01, 0x7A, 0x01, 0x19, 0x0D, 0x17, 0x01, 0x25,
+    0x03, 0x15, 0x01, 0x27, 0x02, 0x3D, 0x01, 0x13, 0x01, 0x29, 0x01, 0x7A,
+    0x01, 0x12, 0x01, 0x67, 0x01, 0x8C, 0x01, 0x01, 0xA4, 0x01, 0x01, 0xC9,
+    0x01, 0x13, 0x91, 0x01, 0x01, 0x12, 0x01, 0xC9, 0x01, 0x01, 0x28, 0x01,
+    0x29, 0x01, 0x27, 0x01, 0x50, 0x01, 0x15, 0x01, 0x13, 0x01, 0x11, 0x01,
+    0x13, 0x01, 0x17, 0x01, 0x3D, 0x01, 0x0D, 0x02, 0x18, 0x01, 0x15, 0x02,
+    0x0A, 0x01, 0x15, 0x01, 0x1C, 0x03, 0x02, 0x05, 0x1C, 0x01, 0x19, 0x02,
+    0x1A, 0x01, 0x44, 0x01, 0x33, 0x01, 0x09, 0x01, 0x31, 0x01, 0x48, 0x01,
+    0x2F, 0x01, 0x0D, 0x01, 0x2D, 0x01, 0x0F, 0x01, 0x2B, 0x01, 0x11, 0x01,
+    0x28, 0x02, 0x13, 0x02, 0x25, 0x01, 0x17, 0x01, 0x22, 0x02, 0x19, 0x02,
+    0x1F, 0x01, 0x1D, 0x02, 0x1B, 0x02, 0x20, 0x03, 0x15, 0x03, 0x25, 0x04,
+    0x0C, 0x05, 0x24, 0x14, 0x6D, 0x01, 0x80, 0x01, 0x01, 0x80, 0x01, 0x01,
+    0x80, 0x01, 0x01, 0x80, 0x01, 0x01, 0x80, 0x01, 0x01, 0x80, 0x01, 0x01,
+    0x80, 0x01, 0x01, 0x80, 0x01, 0x01, 0x80, 0x01, 0x01, 0x80, 0x01, 0x01,
+    0x80, 0x01, 0x01, 0x80, 0x01, 0x01, 0x80, 0x01, 0x01, 0x3F, 0x01, 0x0E,
+    0x01, 0x71, 0x01, 0x0E, 0x01, 0x71, 0x01, 0x0E, 0x01, 0x71, 0x01, 0x0E,
+    0x01, 0x71, 0x01, 0x0E, 0x01, 0x71, 0x01, 0x0E, 0x01, 0x71, 0x01, 0x4F,
+    0x01, 0x30, 0x01, 0x4F, 0x01, 0x30, 0x01, 0x4F, 0x01, 0x30, 0x01, 0x4F,
+    0x01, 0x30, 0x01, 0x4F, 0x01, 0x30, 0x01, 0x4F, 0x01, 0x30, 0x01, 0x80,
+    0x01, 0x01, 0x0F, 0x01, 0x70, 0x01, 0x0F, 0x01, 0x2F, 0x01, 0x50, 0x01,
+    0x2F, 0x01, 0x50, 0x01, 0x2F, 0x01, 0x50, 0x01, 0x2F, 0x01, 0x50, 0x01,
+    0x2F, 0x01, 0x51, 0x12, 0x13, 0x09, 0x01, 0x01, 0x80, 0x01, 0x01, 0x40,
+    0x01, 0xCB, 0x05, 0x24, 0x13, 0x09, 0x07, 0x31, 0xF2, 0x02, 0x01, 0xAB,
+    0x04, 0x22, 0x09, 0x01, 0xEF, 0x03, 0x01, 0x66, 0x01, 0xB3, 0x04, 0x0A,
+    0x2A, 0x01, 0x04, 0x03, 0x0A, 0x04, 0x15, 0x01, 0x13, 0x02, 0x11, 0x02,
+    0x25, 0x02, 0x15, 0x02, 0x22, 0x01, 0x19, 0x02, 0x3C, 0x01, 0x3C, 0x01,
+    0x3C, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x78, 0x01, 0x08, 0x01, 0x33, 0x01,
+    0x78, 0x01, 0x1B, 0x09, 0x31, 0x02, 0x09, 0x02, 0x16, 0x01, 0x05, 0x02,
+    0x10, 0x01, 0x0D, 0x02, 0x1C, 0x04, 0x0B, 0x01, 0x10, 0x01, 0x1F, 0x04,
+    0x06, 0x01, 0x26, 0x01, 0x0E, 0x04, 0x01, 0x01, 0x13, 0x01, 0x26, 0x01,
+    0x15, 0x01, 0x78, 0x01, 0x12, 0x01, 0xDD, 0x01, 0x01, 0xBE, 0x02, 0x01,
+    0xA3, 0x03, 0x13, 0x8E, 0x01, 0x01, 0x61, 0x01, 0x8C, 0x01, 0x01, 0x12,
+    0x01, 0x01, 0x01, 0x12, 0x01, 0x78, 0x01, 0x11, 0x01, 0x12, 0x01, 0x27,
+    0x01, 0x17, 0x01, 0x13, 0x01, 0x3C, 0x01, 0x0D, 0x01, 0x13, 0x01, 0x05,
+    0x01, 0x14, 0x02, 0x09, 0x02, 0x31, 0x03, 0x02, 0x04, 0x15, 0x01, 0x07,
+    0x01, 0x18, 0x02, 0x54, 0x01, 0x09, 0x01, 0x3C, 0x01, 0x2F, 0x01, 0x0C,
+    0x01, 0x2D, 0x01, 0x3A, 0x01, 0x0F, 0x01, 0x2A, 0x01, 0x11, 0x01, 0x3C,
+    0x02, 0x25, 0x02, 0x15, 0x01, 0x23, 0x01, 0x18, 0x01, 0x21, 0x01, 0x1A,
+    0x02, 0x1D, 0x02, 0x1D, 0x02, 0x19, 0x02, 0x21, 0x03, 0x14, 0x02, 0x26,
+    0x04, 0x0C, 0x04, 0x25, 0x0A, 0x2D, 0x05, 0x34, 0x03, 0x36, 0x03, 0x37,
+    0x02, 0x38, 0x02, 0x39, 0x01, 0x39, 0x02, 0x39, 0x01, 0x3A, 0x01, 0x3A,
+    0x01, 0x3A, 0x01, 0x3A, 0x01, 0x3A, 0x01, 0x3A, 0x01, 0x3A, 0x01, 0x57,
+    0x08, 0x17, 0x01, 0x18, 0x04, 0x1E, 0x01, 0x17, 0x02, 0x38, 0x02, 0x23,
+    0x01, 0x14, 0x02, 0x24, 0x01, 0x14, 0x01, 0x3A, 0x01, 0x26, 0x01, 0x13,
+    0x01, 0x3A, 0x01, 0x63, 0x01, 0x12, 0x01, 0x3A, 0x01, 0x28, 0x01, 0x4D,
+    0x01, 0x64, 0x01, 0x11, 0x01, 0xA0, 0x01, 0x01, 0x11, 0x01, 0x81, 0x01,
+    0x0A, 0x27, 0x01, 0x07, 0x03, 0x0A, 0x04, 0x29, 0x02, 0x11, 0x02, 0x0F,
+    0x01, 0x15, 0x02, 0x15, 0x01, 0x23, 0x01, 0x18, 0x02, 0x20, 0x01, 0x1B,
+    0x01, 0x1E, 0x01, 0x1D, 0x01, 0x1C, 0x01, 0x1F, 0x01, 0x3C, 0x01, 0x07,
+    0x01, 0x70, 0x01, 0x3C, 0x01, 0x78, 0x01, 0x5C, 0x03, 0x19, 0x01, 0x1C,
+    0x03, 0x03, 0x03, 0x32, 0x01, 0x09, 0x02, 0x15, 0x01, 0x18, 0x02, 0x0C,
+    0x01, 0x2C, 0x01, 0x0F, 0x01, 0x66, 0x01, 0x11, 0x01, 0x13, 0x01, 0x14,
+    0x01, 0x4F, 0x01, 0x62, 0x01, 0x15, 0x01, 0x4E, 0x01, 0xDD, 0x01, 0x01,
+    0xC8, 0x03, 0x01, 0x29, 0x01, 0x64, 0x01, 0x9D, 0x01, 0x01, 0x27, 0x01,
+    0x01, 0x01, 0x62, 0x01, 0x27, 0x01, 0x4E, 0x01, 0x12, 0x01, 0x03, 0x01,
+    0x12, 0x01, 0x4C, 0x01, 0x18, 0x01, 0x12, 0x01, 0x22, 0x01, 0x19, 0x01,
+    0x0D, 0x01, 0x2E, 0x01, 0x0B, 0x01, 0x1B, 0x01, 0x14, 0x01, 0x08, 0x02,
+    0x14, 0x01, 0x1D, 0x08, 0x1F, 0x01, 0x31, 0x01, 0x0A, 0x01, 0x6B, 0x01,
+    0x0C, 0x01, 0x2D, 0x01, 0x0E, 0x01, 0x2B, 0x01, 0x10, 0x01, 0x65, 0x01,
+    0x12, 0x01, 0x27, 0x01, 0x14, 0x02, 0x24, 0x01, 0x17, 0x01, 0x21, 0x02,
+    0x19, 0x01, 0x1F, 0x01, 0x1C, 0x02, 0x1B, 0x02, 0x1F, 0x02, 0x17, 0x02,
+    0x23, 0x02, 0x13, 0x02, 0x27, 0x04, 0x0B, 0x04, 0x00, 0x3F, 0xB4, 0x05,
+    0x01, 0xBB, 0x01, 0x01, 0x01, 0x2B, 0x7D, 0x01, 0x11, 0x01, 0x7C, 0x01,
+    0x2C, 0x01, 0x8E, 0x01, 0x01, 0x2C, 0x01, 0x7C, 0x01, 0x11, 0x01, 0xA9,
+    0x01, 0x01, 0x11, 0x01, 0xA9, 0x01, 0x01, 0x11, 0x01, 0x6A, 0x01, 0x11,
+    0x01, 0xA9, 0x01, 0x01, 0x11, 0x01, 0xA9, 0x01, 0x01, 0x11, 0x01, 0x6A,
+    0x01, 0x50, 0x01, 0x6A, 0x01, 0x50, 0x01, 0x6A, 0x01, 0x11, 0x01, 0x6A,
+    0x01, 0x50, 0x01, 0x6A, 0x01, 0x50, 0x01, 0x6A, 0x01, 0x50, 0x01, 0x2B,
+    0x01, 0x8F, 0x01, 0x01, 0x2B, 0x01, 0x50, 0x01, 0x6A, 0x01, 0x50, 0x01,
+    0x2B, 0x01, 0x8F, 0x01, 0x01, 0x2B, 0x01, 0x7C, 0x01, 0x12, 0x01, 0xA8,
+    0x01, 0x01, 0x12, 0x01, 0x7C, 0x01, 0x2B, 0x01, 0x7C, 0x01, 0x12, 0x01,
+    0xA8, 0x01, 0x01, 0x12, 0x01, 0xA8, 0x01, 0x01, 0x12, 0x01, 0x69, 0x01,
+    0x51, 0x01, 0x69, 0x01, 0x12, 0x01, 0xA8, 0x01, 0x01, 0x12, 0x01, 0x69,
+    0x01, 0x51, 0x01, 0x69, 0x01, 0x51, 0x01, 0x69, 0x01, 0x51, 0x01, 0x2A,
+    0x01, 0x51, 0x01, 0x18, 0x0C, 0x2B, 0x04, 0x0C, 0x04, 0x24, 0x03, 0x14,
+    0x03, 0x1F, 0x02, 0x1A, 0x02, 0x1C, 0x01, 0x1E, 0x01, 0x19, 0x02, 0x20,
+    0x02, 0x16, 0x01, 0x24, 0x01, 0x14, 0x01, 0x26, 0x01, 0x12, 0x01, 0x28,
+    0x01, 0x10, 0x01, 0x2A, 0x01, 0x0E, 0x01, 0x67, 0x01, 0x0C, 0x01, 0x2E,
+    0x01, 0x45, 0x01, 0x30, 0x01, 0x43, 0x01, 0x15, 0x08, 0x15, 0x01, 0x1C,
+    0x01, 0x08, 0x01, 0x30, 0x01, 0x0A, 0x01, 0x1A, 0x01, 0x13, 0x01, 0x0C,
+    0x01, 0x13, 0x01, 0x18, 0x01, 0x49, 0x01, 0x65, 0x01, 0x27, 0x01, 0x23,
+    0x01, 0x4D, 0x01, 0x9C, 0x03, 0x01, 0x3E, 0x01, 0x99, 0x01, 0x01, 0x29,
+    0x01, 0x28, 0x01, 0x34, 0x01, 0x27, 0x01, 0x2B, 0x01, 0x20, 0x01, 0x07,
+    0x01, 0x12, 0x01, 0x0C, 0x01, 0x2E, 0x01, 0x0A, 0x01, 0x12, 0x01, 0x09,
+    0x01, 0x13, 0x01, 0x08, 0x01, 0x1E, 0x01, 0x13, 0x03, 0x02, 0x03, 0x13,
+    0x01, 0x22, 0x02, 0x23, 0x01, 0x2C, 0x01, 0x0E, 0x01, 0x2A, 0x01, 0x10,
+    0x01, 0x28, 0x01, 0x12, 0x01, 0x26, 0x01, 0x14, 0x01, 0x24, 0x01, 0x16,
+    0x02, 0x20, 0x02, 0x52, 0x02, 0x20, 0x02, 0x16, 0x01, 0x24, 0x01, 0x14,
+    0x01, 0x26, 0x01, 0x11, 0x02, 0x28, 0x01, 0x3B, 0x01, 0x0E, 0x01, 0x2C,
+    0x01, 0x0C, 0x01, 0x2E, 0x01, 0x0A, 0x01, 0x15, 0x06, 0x15, 0x01, 0x1D,
+    0x02, 0x06, 0x02, 0x1C, 0x01, 0x12, 0x02, 0x0A, 0x01, 0x13, 0x01, 0x06,
+    0x01, 0x12, 0x01, 0x0D, 0x01, 0x3B, 0x01, 0x12, 0x01, 0x04, 0x01, 0x12,
+    0x01, 0x10, 0x01, 0x4D, 0x01, 0x15, 0x01, 0x12, 0x01, 0x14, 0x01, 0x73,
+    0x01, 0x13, 0x01, 0x4F, 0x01, 0x88, 0x01, 0x01, 0x9C, 0x03, 0x01, 0x27,
+    0x01, 0x25, 0x01, 0xB1, 0x01, 0x01, 0x12, 0x01, 0x4D, 0x01, 0x01, 0x01,
+    0x13, 0x01, 0x10, 0x01, 0x2A, 0x01, 0x0E, 0x01, 0x2C, 0x01, 0x0C, 0x01,
+    0x18, 0x01, 0x15, 0x01, 0x0A, 0x01, 0x15, 0x01, 0x1A, 0x04, 0x02, 0x04,
+    0x1B, 0x01, 0x19, 0x02, 0x19, 0x01, 0x41, 0x01, 0x32, 0x01, 0x39, 0x01,
+    0x09, 0x01, 0x3B, 0x01, 0x2E, 0x01, 0x0C, 0x01, 0x2C, 0x01, 0x0E, 0x01,
+    0x2A, 0x01, 0x10, 0x01, 0x28, 0x01, 0x12, 0x01, 0x26, 0x01, 0x14, 0x02,
+    0x22, 0x02, 0x17, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x1F, 0x02,
+    0x15, 0x03, 0x23, 0x05, 0x0C, 0x04, 0x18, 0x0B, 0x2C, 0x04, 0x0B, 0x03,
+    0x27, 0x02, 0x12, 0x03, 0x22, 0x02, 0x17, 0x01, 0x1F, 0x02, 0x1A, 0x02,
+    0x1C, 0x01, 0x1E, 0x01, 0x1A, 0x01, 0x20, 0x01, 0x17, 0x02, 0x22, 0x01,
+    0x15, 0x01, 0x25, 0x01, 0x3B, 0x01, 0x12, 0x01, 0x28, 0x01, 0x10, 0x01,
+    0x2A, 0x01, 0x0E, 0x01, 0x67, 0x01, 0x0C, 0x01, 0x2E, 0x01, 0x23, 0x01,
+    0x21, 0x01, 0x14, 0x04, 0x01, 0x03, 0x14, 0x01, 0x1D, 0x01, 0x08, 0x01,
+    0x1C, 0x01, 0x13, 0x01, 0x0A, 0x01, 0x13, 0x01, 0x1A, 0x01, 0x0C, 0x01,
+    0x19, 0x01, 0x21, 0x01, 0x2B, 0x01, 0x21, 0x01, 0x17, 0x01, 0x10, 0x01,
+    0x16, 0x01, 0x71, 0x01, 0x15, 0x01, 0x12, 0x01, 0x4F, 0x01, 0x61, 0x01,
+    0x11, 0x01, 0x4E, 0x01, 0xCE, 0x02, 0x01, 0xD9, 0x01, 0x01, 0x9A, 0x01,
+    0x01, 0xD9, 0x01, 0x01, 0x4D, 0x01, 0x14, 0x01, 0x74, 0x01, 0x27, 0x01,
+    0x27, 0x01, 0x13, 0x01, 0x10, 0x01, 0x39, 0x01, 0x2B, 0x01, 0x0D, 0x01,
+    0x18, 0x01, 0x14, 0x01, 0x0B, 0x01, 0x2F, 0x02, 0x07, 0x02, 0x1B, 0x01,
+    0x16, 0x07, 0x59, 0x01, 0x35, 0x01, 0x40, 0x01, 0x3B, 0x01, 0x76, 0x01,
+    0x3B, 0x01, 0x1E, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0x1E, 0x01, 0x1A, 0x01,
+    0x13, 0x01, 0x0C, 0x02, 0x17, 0x01, 0x23, 0x01, 0x14, 0x02, 0x25, 0x03,
+    0x10, 0x01, 0x05, 0x01, 0x24, 0x03, 0x0A, 0x03, 0x2E, 0x0A, 0x1A, 0x01,
+    0x9E, 0x01, 0x01, 0x4B, 0x01, 0x28, 0x01, 0x74, 0x01, 0x11, 0x01, 0x62,
+    0x01, 0x11, 0x01, 0x62, 0x01, 0x39, 0x01, 0x12, 0x01, 0x26, 0x01, 0x38,
+    0x02, 0x13, 0x01, 0x24, 0x01, 0x38, 0x02, 0x15, 0x01, 0x21, 0x02, 0x16,
+    0x01, 0x1D, 0x05, 0x2F, 0x07, 0x1C, 0x01, 0x39, 0x01, 0x39, 0x01, 0x39,
+    0x01, 0x39, 0x01, 0x73, 0x02, 0x38, 0x01, 0x39, 0x01, 0x38, 0x02, 0x38,
+    0x01, 0x38, 0x02, 0x37, 0x02, 0x36, 0x03, 0x35, 0x03, 0x33, 0x05, 0x09,
+    0x05, 0x0E, 0x03, 0x05, 0x03, 0x09, 0x02, 0x0B, 0x01, 0x07, 0x01, 0x0E,
+    0x01, 0x05, 0x01, 0x10, 0x01, 0x16, 0x01, 0x02, 0x01, 0x29, 0x02, 0x6D,
+    0x01, 0x40, 0x01, 0x01, 0x01, 0x16, 0x01, 0x11, 0x01, 0x04, 0x01, 0x0F,
+    0x01, 0x06, 0x01, 0x0C, 0x02, 0x08, 0x02, 0x08, 0x02, 0x0C, 0x08, 0xD4,
+    0x06, 0x05, 0x0E, 0x03, 0x05, 0x03, 0x09, 0x02, 0x0B, 0x02, 0x06, 0x01,
+    0x0F, 0x01, 0x04, 0x01, 0x27, 0x01, 0x02, 0x01, 0x29, 0x01, 0x16, 0x01,
+    0x41, 0x01, 0x56, 0x01, 0x01, 0x01, 0x16, 0x01, 0x11, 0x01, 0x04, 0x01,
+    0x0F, 0x01, 0x06, 0x01, 0x0D, 0x01, 0x08, 0x03, 0x07, 0x03, 0x0C, 0x06,
+    0x11, 0x03, 0x06, 0x03, 0x0D, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0E, 0x01,
+    0x09, 0x01, 0x10, 0x01, 0x07, 0x01, 0x12, 0x01, 0x1F, 0x01, 0x2E, 0x01,
+    0x86, 0x01, 0x01, 0x14, 0x01, 0x1F, 0x01, 0x12, 0x01, 0x18, 0x01, 0x08,
+    0x01, 0x0F, 0x01, 0x0A, 0x02, 0x0C, 0x01, 0x0D, 0x02, 0x08, 0x02, 0x10,
+    0x08, 0xB8, 0x08, 0x11, 0xD3, 0x03, 0x01, 0x56, 0x01, 0x29, 0x01, 0x32,
+    0x01, 0x09, 0x01, 0x32, 0x01, 0x0F, 0x01, 0x22, 0x01, 0x0F, 0x01, 0x22,
+    0x01, 0x0F, 0x01, 0x18, 0x01, 0x09, 0x01, 0x28, 0x01, 0x09, 0x01, 0x0E,
+    0x01, 0x0A, 0x02, 0x1A, 0x02, 0x0A, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x11,
+    0x02, 0x05, 0x01, 0x14, 0x02, 0x02, 0x01, 0x32, 0x01, 0x30, 0x02, 0x2F,
+    0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x30, 0x01, 0x30,
+    0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F,
+    0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x22,
+    0x02, 0x0B, 0x02, 0x22, 0x02, 0x0B, 0x02, 0x22, 0x02, 0x0B, 0x02, 0x22,
+    0x02, 0x0B, 0x02, 0x22, 0x02, 0x0B, 0x02, 0x21, 0x03, 0x0B, 0x02, 0x21,
+    0x02, 0x0D, 0x01, 0x21, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x2E,
+    0x03, 0x2E, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0x30, 0x01, 0x32, 0x03, 0x33,
+    0x02, 0x33, 0x02, 0x33, 0x02, 0x33, 0x02, 0x33, 0x03, 0x33, 0x02, 0x11,
+    0x01, 0x21, 0x02, 0x10, 0x02, 0x21, 0x02, 0x10, 0x02, 0x21, 0x03, 0x0F,
+    0x02, 0x22, 0x02, 0x0F, 0x02, 0x22, 0x02, 0x0F, 0x02, 0x22, 0x02, 0x0F,
+    0x02, 0x22, 0x02, 0x0F, 0x02, 0x22, 0x02, 0x0F, 0x02, 0x33, 0x02, 0x33,
+    0x02, 0x33, 0x02, 0x33, 0x02, 0x33, 0x02, 0x33, 0x02, 0x33, 0x02, 0x33,
+    0x02, 0x33, 0x02, 0x33, 0x01, 0x33, 0x02, 0x33, 0x02, 0x33, 0x02, 0x33,
+    0x02, 0x33, 0x02, 0x33, 0x02, 0x33, 0x02, 0x00, 0x35, 0x9B, 0x06, 0x35,
+    0xE6, 0x05, 0x35, 0x00, 0x01, 0x35, 0x02, 0x35, 0x02, 0x35, 0x02, 0x35,
+    0x02, 0x35, 0x02, 0x35, 0x02, 0x35, 0x02, 0x35, 0x02, 0x35, 0x02, 0x35,
+    0x02, 0x35, 0x02, 0x35, 0x02, 0x35, 0x02, 0x35, 0x02, 0x35, 0x02, 0x35,
+    0x02, 0x35, 0x02, 0x35, 0x02, 0x10, 0x02, 0x23, 0x02, 0x10, 0x03, 0x22,
+    0x02, 0x11, 0x02, 0x22, 0x02, 0x11, 0x02, 0x22, 0x02, 0x11, 0x02, 0x22,
+    0x02, 0x11, 0x03, 0x21, 0x02, 0x12, 0x02, 0x21, 0x02, 0x12, 0x02, 0x21,
+    0x02, 0x12, 0x02, 0x35, 0x03, 0x35, 0x02, 0x35, 0x02, 0x35, 0x02, 0x35,
+    0x03, 0x35, 0x02, 0x34, 0x01, 0x32, 0x02, 0x31, 0x02, 0x31, 0x02, 0x30,
+    0x03, 0x30, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x21, 0x02, 0x0D,
+    0x03, 0x21, 0x02, 0x0D, 0x02, 0x22, 0x02, 0x0D, 0x02, 0x22, 0x02, 0x0D,
+    0x02, 0x22, 0x02, 0x0D, 0x02, 0x22, 0x02, 0x0C, 0x03, 0x22, 0x02, 0x0C,
+    0x02, 0x23, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31,
+    0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31,
+    0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31,
+    0x02, 0x31, 0x02, 0x16, 0x0C, 0x27, 0x04, 0x0C, 0x04, 0x20, 0x03, 0x14,
+    0x03, 0x1B, 0x02, 0x1A, 0x02, 0x17, 0x02, 0x1E, 0x02, 0x14, 0x01, 0x22,
+    0x01, 0x12, 0x01, 0x24, 0x01, 0x10, 0x01, 0x26, 0x01, 0x0E, 0x01, 0x28,
+    0x01, 0x0C, 0x01, 0x2A, 0x01, 0x0A, 0x01, 0x2C, 0x01, 0x08, 0x01, 0x65,
+    0x01, 0x06, 0x01, 0x67, 0x01, 0x04, 0x01, 0x4D, 0x06, 0x2F, 0x02, 0x06,
+    0x02, 0x14, 0x01, 0x02, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x2A, 0x01, 0x0C,
+    0x01, 0x28, 0x01, 0x21, 0x01, 0x23, 0x01, 0x26, 0x01, 0x23, 0x01, 0x91,
+    0x01, 0x01, 0x80, 0x01, 0x13, 0xED, 0x01, 0x01, 0xB6, 0x01, 0x01, 0x23,
+    0x01, 0x6C, 0x01, 0x12, 0x01, 0x22, 0x01, 0x6C, 0x01, 0x13, 0x01, 0x21,
+    0x01, 0x4A, 0x01, 0x21, 0x01, 0x13, 0x01, 0x21, 0x01, 0x35, 0x01, 0x14,
+    0x01, 0x20, 0x01, 0x14, 0x01, 0x20, 0x01, 0x4B, 0x01, 0x20, 0x01, 0x14,
+    0x01, 0x20, 0x01, 0x14, 0x01, 0x20, 0x01, 0x14, 0x01, 0x35, 0x01, 0x21,
+    0x01, 0x4A, 0x01, 0x21, 0x01, 0x13, 0x01, 0x35, 0x01, 0x22, 0x01, 0x12,
+    0x01, 0x6C, 0x01, 0x23, 0x01, 0x11, 0x01, 0x6C, 0x01, 0x92, 0x01, 0x01,
+    0x47, 0x01, 0xA6, 0x03, 0x11, 0x87, 0x05, 0x09, 0x2C, 0x02, 0x09, 0x02,
+    0x29, 0x01, 0x0D, 0x01, 0x27, 0x01, 0x0F, 0x01, 0x37, 0x01, 0x24, 0x01,
+    0x80, 0x01, 0x01, 0x92, 0x02, 0x01, 0x5A, 0x01, 0x48, 0x01, 0x25, 0x01,
+    0x37, 0x01, 0x0E, 0x01, 0x28, 0x01, 0x0B, 0x02, 0x2A, 0x02, 0x07, 0x02,
+    0x2E, 0x0F, 0x51, 0x05, 0x0F, 0x05, 0x49, 0x03, 0x19, 0x03, 0x43, 0x03,
+    0x1F, 0x02, 0x3F, 0x02, 0x24, 0x03, 0x3A, 0x02, 0x29, 0x01, 0x38, 0x01,
+    0x2C, 0x02, 0x34, 0x02, 0x2F, 0x02, 0x31, 0x01, 0x33, 0x01, 0x2E, 0x02,
+    0x35, 0x01, 0x2C, 0x01, 0x38, 0x01, 0x2A, 0x01, 0x18, 0x0A, 0x18, 0x02,
+    0x27, 0x01, 0x15, 0x04, 0x0A, 0x05, 0x15, 0x01, 0x25, 0x01, 0x13, 0x03,
+    0x13, 0x03, 0x37, 0x01, 0x12, 0x02, 0x19, 0x03, 0x10, 0x01, 0x22, 0x01,
+    0x11, 0x02, 0x1E, 0x02, 0x0F, 0x01, 0x20, 0x01, 0x10, 0x02, 0x22, 0x01,
+    0x0F, 0x01, 0x1E, 0x01, 0x10, 0x01, 0x25, 0x02, 0x0E, 0x01, 0x1C, 0x01,
+    0x0F, 0x02, 0x28, 0x01, 0x39, 0x01, 0x2B, 0x01, 0x0D, 0x01, 0x1A, 0x01,
+    0x0E, 0x01, 0x2D, 0x01, 0x0D, 0x01, 0x18, 0x01, 0x0E, 0x01, 0x2F, 0x01,
+    0x33, 0x01, 0x31, 0x01, 0x0C, 0x01, 0x16, 0x01, 0x0D, 0x01, 0x33, 0x01,
+    0x21, 0x01, 0x0D, 0x01, 0x41, 0x01, 0x58, 0x01, 0x1F, 0x01, 0x0D, 0x01,
+    0x37, 0x01, 0x0B, 0x01, 0x1F, 0x01, 0x56, 0x01, 0x47, 0x01, 0x0B, 0x01,
+    0x1D, 0x01, 0x56, 0x01, 0x49, 0x01, 0x0B, 0x01, 0x1B, 0x01, 0x1B, 0x0A,
+    0x31, 0x01, 0x0C, 0x01, 0x19, 0x03, 0x0A, 0x04, 0x14, 0x01, 0x3D, 0x02,
+    0x11, 0x02, 0x1E, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x17, 0x01, 0x15, 0x02,
+    0x4B, 0x02, 0x18, 0x01, 0x10, 0x01, 0x38, 0x01, 0x1B, 0x01, 0x1B, 0x01,
+    0x09, 0x01, 0x0C, 0x01, 0x14, 0x01, 0x1D, 0x02, 0x44, 0x01, 0x20, 0x01,
+    0x0D, 0x01, 0x20, 0x01, 0x13, 0x01, 0x43, 0x01, 0x1F, 0x01, 0x63, 0x01,
+    0x3D, 0x01, 0x13, 0x01, 0x57, 0x01, 0x1E, 0x01, 0x10, 0x08, 0x1B, 0x01,
+    0x3F, 0x02, 0x41, 0x01, 0x11, 0x01, 0x0E, 0x01, 0x54, 0x01, 0x0E, 0x01,
+    0x32, 0x01, 0x04, 0x01, 0x2B, 0x01, 0x55, 0x01, 0x0D, 0x01, 0x45, 0x01,
+    0x38, 0x01, 0x0F, 0x01, 0x39, 0x01, 0x0D, 0x01, 0x2B, 0x01, 0x1C, 0x01,
+    0x71, 0x01, 0x56, 0x01, 0xB9, 0x01, 0x01, 0x1C, 0x01, 0x56, 0x01, 0x48,
+    0x01, 0xF2, 0x01, 0x01, 0x56, 0x01, 0xF4, 0x01, 0x01, 0x2A, 0x01, 0x2C,
+    0x01, 0xAA, 0x01, 0x01, 0x0D, 0x01, 0xEA, 0x02, 0x01, 0xA1, 0x02, 0x01,
+    0x8B, 0x01, 0x01, 0x48, 0x01, 0x84, 0x02, 0x01, 0x0C, 0x01, 0x75, 0x01,
+    0x0D, 0x01, 0xC6, 0x01, 0x01, 0x81, 0x01, 0x01, 0x3B, 0x01, 0x46, 0x01,
+    0x28, 0x01, 0x10, 0x01, 0x80, 0x01, 0x01, 0x2B, 0x01, 0x46, 0x01, 0x81,
+    0x01, 0x01, 0x0B, 0x01, 0x2E, 0x01, 0x0B, 0x01, 0x49, 0x01, 0x19, 0x01,
+    0x10, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x06, 0x01, 0x29, 0x01, 0x65, 0x01,
+    0x06, 0x02, 0x1D, 0x01, 0x0B, 0x01, 0x14, 0x01, 0x0D, 0x01, 0x10, 0x03,
+    0x01, 0x02, 0x14, 0x01, 0x09, 0x01, 0x43, 0x01, 0x17, 0x01, 0x06, 0x02,
+    0x0C, 0x01, 0x50, 0x06, 0x18, 0x01, 0x1A, 0x01, 0x3E, 0x01, 0x17, 0x01,
+    0x2A, 0x02, 0x1F, 0x01, 0x27, 0x01, 0x1A, 0x01, 0x20, 0x01, 0x29, 0x01,
+    0x1C, 0x01, 0x1C, 0x01, 0x1B, 0x01, 0x27, 0x01, 0x04, 0x01, 0x1A, 0x01,
+    0x0F, 0x01, 0x1C, 0x01, 0x16, 0x01, 0x1F, 0x01, 0x2E, 0x01, 0x14, 0x01,
+    0x07, 0x01, 0x17, 0x01, 0x1F, 0x01, 0x10, 0x02, 0x10, 0x02, 0x09, 0x02,
+    0x13, 0x02, 0x13, 0x01, 0x1F, 0x01, 0x0D, 0x02, 0x0D, 0x01, 0x10, 0x02,
+    0x36, 0x03, 0x08, 0x02, 0x10, 0x03, 0x0A, 0x03, 0x25, 0x01, 0x15, 0x08,
+    0x15, 0x0A, 0x1B, 0x01, 0x72, 0x01, 0x57, 0x01, 0x0D, 0x01, 0xCA, 0x01,
+    0x01, 0x56, 0x01, 0x73, 0x01, 0x56, 0x01, 0x0E, 0x01, 0x56, 0x01, 0x0E,
+    0x01, 0x65, 0x01, 0x55, 0x01, 0x0F, 0x01, 0x65, 0x01, 0x54, 0x01, 0x10,
+    0x02, 0x53, 0x01, 0x11, 0x01, 0x53, 0x01, 0x11, 0x02, 0x22, 0x03, 0x2D,
+    0x01, 0x12, 0x02, 0x1D, 0x03, 0x45, 0x02, 0x18, 0x03, 0x34, 0x01, 0x15,
+    0x04, 0x10, 0x04, 0x38, 0x01, 0x18, 0x10, 0x3D, 0x02, 0x33, 0x01, 0x31,
+    0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x02, 0x2F, 0x01, 0x35, 0x02, 0x2C,
+    0x02, 0x37, 0x02, 0x29, 0x01, 0x3B, 0x02, 0x25, 0x02, 0x3E, 0x02, 0x20,
+    0x03, 0x42, 0x04, 0x19, 0x03, 0x49, 0x05, 0x0E, 0x06, 0x21, 0x11, 0x41,
+    0x01, 0x11, 0x01, 0xE5, 0x01, 0x01, 0x13, 0x01, 0xF9, 0x01, 0x01, 0x3C,
+    0x01, 0xBC, 0x01, 0x01, 0x3A, 0x01, 0xF7, 0x01, 0x01, 0x19, 0x01, 0xDD,
+    0x01, 0x01, 0x1B, 0x01, 0xDB, 0x01, 0x01, 0x1D, 0x01, 0xD9, 0x01, 0x01,
+    0x1F, 0x01, 0xE8, 0x01, 0x01, 0x10, 0x01, 0x30, 0x01, 0xB7, 0x01, 0x01,
+    0x3F, 0x01, 0x10, 0x01, 0x12, 0x01, 0xD3, 0x01, 0x01, 0x14, 0x01, 0x10,
+    0x01, 0x3D, 0x01, 0x93, 0x01, 0x01, 0x27, 0x01, 0x3B, 0x01, 0x05, 0x01,
+    0x8D, 0x01, 0x01, 0x29, 0x01, 0x41, 0x01, 0x4A, 0x01, 0x6C, 0x01, 0x26,
+    0x01, 0x6D, 0x01, 0x48, 0x01, 0x1B, 0x01, 0x24, 0x01, 0xB6, 0x01, 0x01,
+    0x0B, 0x01, 0x34, 0x01, 0x2F, 0x01, 0xC7, 0x01, 0x01, 0x11, 0x01, 0x0D,
+    0x01, 0x11, 0x01, 0xC5, 0x01, 0x01, 0x21, 0x01, 0x11, 0x01, 0x30, 0x01,
+    0xC8, 0x01, 0x01, 0x1C, 0x01, 0x11, 0x01, 0x11, 0x01, 0xB8, 0x01, 0x01,
+    0x1A, 0x01, 0x64, 0x01, 0x13, 0x01, 0x65, 0x01, 0x18, 0x01, 0x65, 0x15,
+    0x7D, 0x01, 0x3B, 0x01, 0xBB, 0x01, 0x01, 0x3D, 0x01, 0xB9, 0x01, 0x01,
+    0x3F, 0x01, 0xF9, 0x01, 0x01, 0x10, 0x01, 0xE8, 0x01, 0x01, 0x0E, 0x01,
+    0x65, 0x1F, 0x73, 0x01, 0x45, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x71, 0x01,
+    0x47, 0x01, 0x70, 0x01, 0x21, 0x01, 0x1C, 0x01, 0x49, 0x01, 0x92, 0x01,
+    0x01, 0x2E, 0x01, 0x37, 0x01, 0x06, 0x01, 0xB8, 0x01, 0x01, 0x25, 0x01,
+    0x13, 0x01, 0x04, 0x01, 0xF4, 0x01, 0x01, 0x02, 0x01, 0x13, 0x01, 0x27,
+    0x01, 0xBB, 0x01, 0x01, 0x3D, 0x01, 0x13, 0x01, 0x14, 0x01, 0x00, 0x28,
+    0x42, 0x05, 0x42, 0x03, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x01,
+    0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x84, 0x01,
+    0x01, 0x84, 0x01, 0x01, 0x17, 0x11, 0x42, 0x03, 0x42, 0x02, 0x15, 0x01,
+    0x2C, 0x01, 0x42, 0x01, 0x84, 0x01, 0x01, 0x13, 0x01, 0xF4, 0x01, 0x01,
+    0xCD, 0x03, 0x01, 0x54, 0x01, 0xB1, 0x01, 0x01, 0x12, 0x01, 0x6F, 0x01,
+    0x40, 0x01, 0x13, 0x01, 0x2C, 0x01, 0x3F, 0x02, 0x14, 0x01, 0x28, 0x03,
+    0x15, 0x01, 0x19, 0x10, 0x17, 0x01, 0x81, 0x01, 0x02, 0x3F, 0x01, 0x40,
+    0x01, 0x3F, 0x02, 0x82, 0x01, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x01,
+    0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x18, 0x13, 0x17, 0x01, 0x2A, 0x03,
+    0x42, 0x01, 0x14, 0x01, 0x2D, 0x01, 0x42, 0x01, 0x13, 0x01, 0x2E, 0x01,
+    0x97, 0x01, 0x01, 0x2E, 0x01, 0x9B, 0x02, 0x01, 0x70, 0x01, 0xC5, 0x01,
+    0x01, 0x9A, 0x02, 0x01, 0x6F, 0x01, 0x82, 0x01, 0x01, 0x82, 0x01, 0x01,
+    0x14, 0x01, 0x2B, 0x01, 0x3F, 0x02, 0x3E, 0x02, 0x17, 0x01, 0x15, 0x13,
+    0x5A, 0x01, 0x82, 0x01, 0x01, 0x40, 0x01, 0x82, 0x01, 0x01, 0x40, 0x01,
+    0x40, 0x01, 0x40, 0x01, 0x3F, 0x02, 0x3F, 0x01, 0x3F, 0x02, 0x3E, 0x02,
+    0x3D, 0x03, 0x3A, 0x05, 0x1E, 0x0E, 0x35, 0x05, 0x0E, 0x05, 0x2D, 0x03,
+    0x18, 0x03, 0x28, 0x02, 0x1E, 0x02, 0x24, 0x02, 0x22, 0x02, 0x21, 0x01,
+    0x26, 0x01, 0x1E, 0x02, 0x28, 0x02, 0x1B, 0x01, 0x2C, 0x01, 0x19, 0x01,
+    0x2E, 0x01, 0x17, 0x01, 0x30, 0x01, 0x15, 0x01, 0x32, 0x01, 0x13, 0x01,
+    0x34, 0x01, 0x11, 0x01, 0x36, 0x01, 0x0F, 0x01, 0x80, 0x01, 0x01, 0x0D,
+    0x01, 0x60, 0x0A, 0x18, 0x01, 0x0B, 0x01, 0x16, 0x03, 0x0A, 0x03, 0x20,
+    0x01, 0x15, 0x02, 0x10, 0x02, 0x14, 0x01, 0x1E, 0x01, 0x14, 0x01, 0x31,
+    0x01, 0x16, 0x01, 0x13, 0x01, 0x07, 0x01, 0x13, 0x01, 0x60, 0x01, 0x19,
+    0x01, 0x13, 0x01, 0x2D, 0x01, 0x18, 0x01, 0x1B, 0x01, 0x5F, 0x01, 0x5A,
+    0x01, 0x1D, 0x01, 0x12, 0x01, 0x92, 0x01, 0x01, 0x12, 0x01, 0x8A, 0x02,
+    0x01, 0x7C, 0x01, 0x48, 0x14, 0x5A, 0x01, 0xEC, 0x11, 0x01, 0x12, 0x01,
+    0x68, 0x14, 0xD7, 0x01, 0x01, 0x91, 0x01, 0x01, 0x12, 0x01, 0xAE, 0x01,
+    0x01, 0x5E, 0x01, 0x12, 0x01, 0x30, 0x01, 0x5F, 0x01, 0x1B, 0x01, 0x18,
+    0x01, 0x41, 0x01, 0x19, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x33, 0x01, 0x14,
+    0x01, 0x16, 0x01, 0x13, 0x01, 0x1D, 0x01, 0x14, 0x01, 0x1D, 0x01, 0x15,
+    0x01, 0x11, 0x02, 0x35, 0x03, 0x0B, 0x03, 0x16, 0x01, 0x0A, 0x01, 0x18,
+    0x0B, 0x18, 0x01, 0x54, 0x01, 0x39, 0x01, 0x0E, 0x01, 0x48, 0x01, 0x36,
+    0x01, 0x46, 0x01, 0x12, 0x01, 0x33, 0x01, 0x14, 0x01, 0x31, 0x01, 0x16,
+    0x02, 0x2E, 0x01, 0x19, 0x01, 0x2C, 0x01, 0x1B, 0x01, 0x29, 0x02, 0x1D,
+    0x02, 0x26, 0x01, 0x21, 0x02, 0x22, 0x02, 0x24, 0x02, 0x1D, 0x03, 0x28,
+    0x03, 0x17, 0x03, 0x2E, 0x04, 0x0F, 0x04, 0x00, 0x22, 0x43, 0x05, 0x43,
+    0x03, 0x43, 0x03, 0x43, 0x02, 0x43, 0x02, 0x43, 0x01, 0x43, 0x02, 0x43,
+    0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x01, 0x43,
+    0x01, 0x5E, 0x0D, 0x1B, 0x01, 0x27, 0x04, 0x43, 0x02, 0x16, 0x01, 0x2C,
+    0x02, 0x15, 0x01, 0x2D, 0x01, 0x43, 0x01, 0x14, 0x01, 0x2E, 0x01, 0x43,
+    0x01, 0x56, 0x01, 0x2F, 0x01, 0x86, 0x01, 0x01, 0x12, 0x01, 0xB6, 0x01,
+    0x01, 0x55, 0x01, 0xFF, 0x02, 0x01, 0x12, 0x01, 0x89, 0x10, 0x01, 0x12,
+    0x01, 0xFD, 0x02, 0x01, 0x55, 0x01, 0xB4, 0x01, 0x01, 0x12, 0x01, 0x71,
+    0x01, 0x55, 0x01, 0x2E, 0x01, 0x41, 0x01, 0x41, 0x01, 0x14, 0x01, 0x2C,
+    0x01, 0x40, 0x02, 0x15, 0x01, 0x29, 0x02, 0x16, 0x01, 0x27, 0x03, 0x32,
+    0x0E, 0x1A, 0x01, 0x84, 0x01, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x40, 0x02, 0x40, 0x01, 0x40, 0x02,
+    0x3F, 0x02, 0x3E, 0x03, 0x3D, 0x03, 0x3B, 0x05, 0x00, 0x3B, 0x88, 0x07,
+    0x28, 0x91, 0x0C, 0x22, 0x8E, 0x07, 0x22, 0xC8, 0x0D, 0x28, 0x00, 0x39,
+    0xEA, 0x06, 0x26, 0xCF, 0x0C, 0x22, 0xEE, 0x06, 0x22, 0x1E, 0x0F, 0x34,
+    0x05, 0x0F, 0x05, 0x2C, 0x03, 0x19, 0x03, 0x27, 0x02, 0x1F, 0x02, 0x23,
+    0x02, 0x23, 0x02, 0x1F, 0x02, 0x27, 0x01, 0x1D, 0x01, 0x2A, 0x02, 0x1A,
+    0x01, 0x2D, 0x01, 0x17, 0x02, 0x2F, 0x01, 0x15, 0x01, 0x32, 0x01, 0x13,
+    0x01, 0x34, 0x01, 0x48, 0x01, 0x10, 0x01, 0x46, 0x01, 0x38, 0x01, 0x0D,
+    0x01, 0x3A, 0x01, 0x53, 0x01, 0x1A, 0x09, 0x19, 0x01, 0x22, 0x03, 0x09,
+    0x03, 0x20, 0x01, 0x16, 0x02, 0x0F, 0x02, 0x15, 0x01, 0x1D, 0x02, 0x13,
+    0x01, 0x1C, 0x01, 0x14, 0x01, 0x16, 0x01, 0x48, 0x01, 0x13, 0x01, 0x1A,
+    0x01, 0x32, 0x01, 0x13, 0x01, 0x1A, 0x01, 0x73, 0x01, 0x1C, 0x01, 0x12,
+    0x01, 0x03, 0x01, 0xA2, 0x01, 0x01, 0x66, 0x01, 0x14, 0x01, 0x8D, 0x01,
+    0x01, 0x14, 0x01, 0xB0, 0x01, 0x13, 0xD8, 0x01, 0x01, 0xCC, 0x07, 0x23,
+    0x95, 0x08, 0x10, 0x5B, 0x01, 0xC3, 0x03, 0x01, 0x7C, 0x01, 0xA3, 0x01,
+    0x01, 0xC4, 0x01, 0x01, 0x13, 0x01, 0x90, 0x01, 0x01, 0x33, 0x01, 0x14,
+    0x01, 0x7B, 0x01, 0x14, 0x01, 0x48, 0x01, 0x18, 0x02, 0x18, 0x01, 0x15,
+    0x02, 0x15, 0x01, 0x32, 0x02, 0x11, 0x02, 0x1C, 0x01, 0x18, 0x03, 0x0B,
+    0x03, 0x3A, 0x0B, 0x22, 0x01, 0x48, 0x01, 0x86, 0x01, 0x01, 0x09, 0x01,
+    0x3C, 0x01, 0x0B, 0x01, 0x3A, 0x01, 0x0D, 0x01, 0x38, 0x01, 0x0F, 0x01,
+    0x35, 0x02, 0x11, 0x01, 0x33, 0x01, 0x14, 0x02, 0x30, 0x01, 0x17, 0x01,
+    0x2D, 0x02, 0x19, 0x02, 0x29, 0x02, 0x1D, 0x02, 0x25, 0x02, 0x21, 0x02,
+    0x20, 0x03, 0x25, 0x03, 0x1A, 0x03, 0x2B, 0x05, 0x0F, 0x06, 0x00, 0x13,
+    0x22, 0x13, 0xE3, 0x17, 0x22, 0xDE, 0x08, 0x22, 0x00, 0x13, 0x28, 0x13,
+    0xD3, 0x21, 0x13, 0x80, 0x02, 0x01, 0x88, 0x01, 0x01, 0x13, 0x01, 0x4D,
+    0x01, 0x4F, 0x01, 0x13, 0x01, 0x4B, 0x01, 0x13, 0x01, 0x16, 0x01, 0x0E,
+    0x01, 0x2C, 0x01, 0x0C, 0x01, 0x18, 0x01, 0x15, 0x01, 0x0A, 0x01, 0x15,
+    0x01, 0x1A, 0x02, 0x06, 0x02, 0x1B, 0x01, 0x17, 0x06, 0x17, 0x01, 0x41,
+    0x01, 0x32, 0x01, 0x43, 0x01, 0x30, 0x01, 0x0A, 0x01, 0x2E, 0x01, 0x39,
+    0x01, 0x0D, 0x01, 0x2B, 0x01, 0x0F, 0x01, 0x29, 0x01, 0x11, 0x01, 0x27,
+    0x01, 0x13, 0x02, 0x24, 0x01, 0x16, 0x01, 0x21, 0x02, 0x18, 0x02, 0x1E,
+    0x01, 0x1C, 0x02, 0x1A, 0x02, 0x1F, 0x03, 0x14, 0x03, 0x24, 0x04, 0x0C,
+    0x04, 0x00, 0x13, 0x1D, 0x17, 0x30, 0x01, 0x16, 0x01, 0x77, 0x01, 0x16,
+    0x01, 0x2F, 0x01, 0x16, 0x01, 0x77, 0x01, 0x16, 0x01, 0x2F, 0x01, 0x16,
+    0x01, 0x77, 0x01, 0x16, 0x01, 0x46, 0x01, 0x30, 0x01, 0x46, 0x01, 0x16,
+    0x01, 0x46, 0x01, 0x30, 0x01, 0x5D, 0x01, 0x30, 0x01, 0x15, 0x01, 0x30,
+    0x01, 0x5D, 0x01, 0x30, 0x01, 0x15, 0x01, 0x78, 0x01, 0x15, 0x01, 0x30,
+    0x01, 0x15, 0x01, 0x78, 0x01, 0x15, 0x01, 0x46, 0x01, 0x31, 0x01, 0x46,
+    0x01, 0x15, 0x01, 0x46, 0x01, 0x31, 0x01, 0x5C, 0x01, 0x31, 0x01, 0x14,
+    0x01, 0x31, 0x01, 0x5C, 0x01, 0x31, 0x01, 0x14, 0x01, 0x31, 0x01, 0x5C,
+    0x01, 0x31, 0x01, 0x14, 0x01, 0x79, 0x01, 0x14, 0x01, 0x31, 0x01, 0x14,
+    0x01, 0x79, 0x01, 0x14, 0x01, 0x31, 0x01, 0x14, 0x01, 0x79, 0x01, 0x14,
+    0x01, 0x79, 0x01, 0x5D, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x48, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01,
+    0x01, 0x7A, 0x02, 0x14, 0x01, 0x78, 0x01, 0x02, 0x01, 0x14, 0x01, 0x2E,
+    0x01, 0x19, 0x01, 0x2C, 0x01, 0x05, 0x01, 0x40, 0x01, 0x1C, 0x01, 0x29,
+    0x01, 0x08, 0x01, 0x5D, 0x01, 0x27, 0x01, 0x0A, 0x01, 0x3B, 0x01, 0x21,
+    0x01, 0x24, 0x01, 0x0D, 0x01, 0x5D, 0x01, 0x32, 0x01, 0x5D, 0x01, 0x32,
+    0x01, 0x5D, 0x01, 0x32, 0x01, 0x15, 0x01, 0x7A, 0x01, 0x15, 0x01, 0x7A,
+    0x01, 0x15, 0x01, 0x7A, 0x01, 0x15, 0x01, 0x7A, 0x01, 0x15, 0x01, 0x7A,
+    0x01, 0x15, 0x01, 0x48, 0x01, 0x31, 0x01, 0x5E, 0x01, 0x31, 0x01, 0x5E,
+    0x01, 0x31, 0x01, 0x5E, 0x01, 0x31, 0x01, 0x5E, 0x01, 0x31, 0x01, 0x5E,
+    0x01, 0x31, 0x01, 0x16, 0x01, 0x79, 0x01, 0x16, 0x01, 0x00, 0x13, 0xD1,
+    0x27, 0x26, 0x00, 0x18, 0x2D, 0x18, 0x75, 0x01, 0x2B, 0x01, 0xEB, 0x01,
+    0x01, 0x86, 0x01, 0x01, 0x90, 0x01, 0x01, 0x84, 0x01, 0x01, 0xEF, 0x01,
+    0x01, 0x25, 0x01, 0xF1, 0x01, 0x01, 0x80, 0x01, 0x01, 0x96, 0x01, 0x01,
+    0x7E, 0x01, 0xF5, 0x01, 0x01, 0x1F, 0x01, 0xF7, 0x01, 0x01, 0x7A, 0x01,
+    0x9C, 0x01, 0x01, 0x78, 0x01, 0x9E, 0x01, 0x01, 0x76, 0x01, 0x0F, 0x01,
+    0xED, 0x01, 0x01, 0x27, 0x01, 0x4C, 0x01, 0x91, 0x01, 0x01, 0x10, 0x01,
+    0x25, 0x01, 0x4C, 0x01, 0x11, 0x01, 0x81, 0x01, 0x01, 0x10, 0x01, 0x70,
+    0x01, 0x0F, 0x01, 0x85, 0x01, 0x01, 0x6D, 0x01, 0x21, 0x01, 0x4C, 0x01,
+    0x3A, 0x01, 0x6D, 0x01, 0x6C, 0x01, 0x0F, 0x01, 0x89, 0x01, 0x01, 0x10,
+    0x01, 0x6A, 0x01, 0x0F, 0x01, 0x8B, 0x01, 0x01, 0x6D, 0x01, 0x1B, 0x01,
+    0x4C, 0x01, 0x40, 0x01, 0x6D, 0x01, 0x66, 0x01, 0x0F, 0x01, 0x32, 0x01,
+    0x55, 0x01, 0x17, 0x01, 0x64, 0x01, 0x0F, 0x01, 0x34, 0x01, 0x6D, 0x01,
+    0x72, 0x01, 0x4C, 0x01, 0x46, 0x01, 0x2E, 0x01, 0x3E, 0x01, 0x60, 0x01,
+    0x0F, 0x01, 0x38, 0x01, 0x6D, 0x01, 0x5E, 0x01, 0x0F, 0x01, 0x3A, 0x01,
+    0x6D, 0x01, 0xA9, 0x01, 0x01, 0x1F, 0x01, 0xF7, 0x01, 0x01, 0x1D, 0x01,
+    0x95, 0x02, 0x01, 0x40, 0x01, 0x97, 0x02, 0x01, 0x19, 0x01, 0xFD, 0x01,
+    0x01, 0x17, 0x01, 0xFF, 0x01, 0x01, 0x72, 0x01, 0x81, 0x02, 0x01, 0x13,
+    0x01, 0x83, 0x02, 0x01, 0x11, 0x01, 0x85, 0x02, 0x01, 0x6C, 0x01, 0x00,
+    0x13, 0x23, 0x12, 0x5B, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x90, 0x01, 0x01, 0x7E, 0x01, 0x11, 0x01, 0x7E, 0x01, 0x11,
+    0x01, 0x7E, 0x01, 0x11, 0x01, 0x7E, 0x01, 0x11, 0x01, 0x7E, 0x01, 0x11,
+    0x01, 0x7E, 0x01, 0x11, 0x01, 0x48, 0x01, 0x35, 0x01, 0x90, 0x01, 0x01,
+    0x11, 0x01, 0x48, 0x01, 0x35, 0x01, 0x5A, 0x01, 0x35, 0x01, 0x5A, 0x01,
+    0x35, 0x01, 0x5A, 0x01, 0x35, 0x01, 0x5A, 0x01, 0x35, 0x01, 0x5A, 0x01,
+    0x35, 0x01, 0x5A, 0x01, 0x35, 0x01, 0x5A, 0x01, 0x35, 0x01, 0x5A, 0x01,
+    0x35, 0x01, 0x5A, 0x01, 0x35, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01,
+    0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x48, 0x01, 0x90, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x90, 0x01, 0x01, 0x90, 0x01, 0x01, 0x1F, 0x0D, 0x38, 0x05,
+    0x0D, 0x04, 0x31, 0x03, 0x16, 0x03, 0x2C, 0x02, 0x1C, 0x03, 0x27, 0x02,
+    0x21, 0x02, 0x23, 0x02, 0x25, 0x01, 0x21, 0x01, 0x28, 0x02, 0x1E, 0x01,
+    0x2B, 0x01, 0x1B, 0x02, 0x2D, 0x01, 0x19, 0x01, 0x30, 0x01, 0x17, 0x01,
+    0x32, 0x01, 0x15, 0x01, 0x34, 0x01, 0x4A, 0x01, 0x12, 0x01, 0x37, 0x01,
+    0x10, 0x01, 0x48, 0x01, 0x3A, 0x01, 0x29, 0x06, 0x1B, 0x01, 0x0C, 0x01,
+    0x17, 0x04, 0x06, 0x04, 0x3A, 0x02, 0x0E, 0x02, 0x16, 0x01, 0x0A, 0x01,
+    0x15, 0x01, 0x12, 0x01, 0x35, 0x01, 0x14, 0x02, 0x14, 0x01, 0x08, 0x01,
+    0x14, 0x01, 0x48, 0x01, 0x18, 0x01, 0x14, 0x01, 0x35, 0x01, 0x1A, 0x01,
+    0x13, 0x01, 0x65, 0x01, 0x13, 0x01, 0x18, 0x01, 0x35, 0x01, 0x31, 0x01,
+    0x2A, 0x01, 0x7C, 0x01, 0x36, 0x01, 0x15, 0x01, 0x5C, 0x01, 0xC8, 0x01,
+    0x01, 0x36, 0x01, 0xA7, 0x01, 0x01, 0xF0, 0x01, 0x01, 0x83, 0x0F, 0x01,
+    0xCA, 0x01, 0x01, 0x93, 0x02, 0x01, 0x5C, 0x01, 0x14, 0x01, 0x80, 0x01,
+    0x01, 0x7D, 0x01, 0x29, 0x01, 0x32, 0x01, 0x4D, 0x01, 0x31, 0x01, 0x2B,
+    0x01, 0x4A, 0x01, 0x1B, 0x01, 0x13, 0x01, 0x05, 0x01, 0x5E, 0x01, 0x19,
+    0x01, 0x13, 0x01, 0x07, 0x01, 0x14, 0x01, 0x17, 0x01, 0x32, 0x01, 0x15,
+    0x01, 0x1E, 0x01, 0x15, 0x01, 0x12, 0x02, 0x15, 0x01, 0x20, 0x02, 0x0E,
+    0x02, 0x22, 0x01, 0x17, 0x04, 0x07, 0x03, 0x18, 0x01, 0x27, 0x07, 0x1A,
+    0x01, 0x0D, 0x01, 0x4A, 0x01, 0x39, 0x01, 0x48, 0x01, 0x11, 0x01, 0x4A,
+    0x01, 0x35, 0x01, 0x14, 0x01, 0x33, 0x01, 0x16, 0x01, 0x31, 0x01, 0x18,
+    0x01, 0x2E, 0x02, 0x1A, 0x02, 0x2B, 0x01, 0x1E, 0x01, 0x29, 0x01, 0x20,
+    0x02, 0x25, 0x02, 0x23, 0x02, 0x21, 0x02, 0x27, 0x02, 0x1D, 0x02, 0x2B,
+    0x03, 0x17, 0x03, 0x30, 0x04, 0x0E, 0x05, 0x00, 0x2A, 0x45, 0x04, 0x45,
+    0x03, 0x45, 0x02, 0x45, 0x02, 0x45, 0x02, 0x45, 0x01, 0x45, 0x01, 0x45,
+    0x02, 0x45, 0x01, 0x8A, 0x01, 0x01, 0x45, 0x01, 0x45, 0x01, 0x8A, 0x01,
+    0x01, 0x18, 0x14, 0x19, 0x01, 0x2B, 0x03, 0x45, 0x01, 0x45, 0x01, 0x15,
+    0x01, 0x2F, 0x01, 0x45, 0x01, 0x14, 0x01, 0x75, 0x01, 0x8A, 0x01, 0x01,
+    0x13, 0x01, 0x80, 0x02, 0x01, 0xA7, 0x02, 0x01, 0x89, 0x01, 0x01, 0xC4,
+    0x02, 0x01, 0xCD, 0x01, 0x01, 0x58, 0x01, 0x2F, 0x01, 0x88, 0x01, 0x01,
+    0x14, 0x01, 0x2E, 0x01, 0x42, 0x02, 0x40, 0x03, 0x17, 0x01, 0x16, 0x14,
+    0x5E, 0x01, 0x43, 0x01, 0x88, 0x01, 0x01, 0x43, 0x01, 0x43, 0x01, 0x43,
+    0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x01, 0x42, 0x02, 0x41, 0x02, 0x41,
+    0x02, 0x40, 0x03, 0x3D, 0x05, 0x29, 0x17, 0x1E, 0x0E, 0x39, 0x04, 0x0E,
+    0x04, 0x32, 0x03, 0x16, 0x03, 0x2D, 0x02, 0x1C, 0x03, 0x28, 0x02, 0x21,
+    0x02, 0x24, 0x02, 0x25, 0x01, 0x22, 0x01, 0x28, 0x02, 0x1E, 0x02, 0x2B,
+    0x01, 0x1C, 0x01, 0x2E, 0x01, 0x1A, 0x01, 0x30, 0x01, 0x18, 0x01, 0x32,
+    0x01, 0x16, 0x01, 0x34, 0x01, 0x14, 0x01, 0x36, 0x01, 0x4B, 0x01, 0x11,
+    0x01, 0x49, 0x01, 0x3A, 0x01, 0x2A, 0x06, 0x1B, 0x01, 0x0D, 0x01, 0x17,
+    0x04, 0x06, 0x04, 0x24, 0x01, 0x16, 0x02, 0x0E, 0x02, 0x16, 0x01, 0x21,
+    0x01, 0x12, 0x01, 0x20, 0x01, 0x15, 0x01, 0x14, 0x01, 0x15, 0x01, 0x1E,
+    0x01, 0x16, 0x01, 0x32, 0x01, 0x18, 0x01, 0x1C, 0x01, 0x13, 0x01, 0x1A,
+    0x01, 0x13, 0x01, 0x65, 0x01, 0x1C, 0x01, 0x19, 0x01, 0x44, 0x01, 0x37,
+    0x01, 0x2B, 0x01, 0x7D, 0x01, 0x03, 0x01, 0x5D, 0x01, 0x20, 0x01, 0xF6,
+    0x01, 0x01, 0x48, 0x01, 0x5F, 0x01, 0x22, 0x01, 0x87, 0x13, 0x01, 0x22,
+    0x01, 0x14, 0x01, 0x93, 0x01, 0x01, 0xF6, 0x01, 0x01, 0x20, 0x01, 0x16,
+    0x01, 0x91, 0x01, 0x01, 0x17, 0x01, 0x69, 0x01, 0x18, 0x01, 0x5E, 0x01,
+    0x1C, 0x01, 0x13, 0x01, 0x51, 0x01, 0x13, 0x01, 0x1A, 0x01, 0x13, 0x01,
+    0x1C, 0x01, 0x18, 0x01, 0x1D, 0x01, 0x14, 0x01, 0x16, 0x01, 0x34, 0x01,
+    0x14, 0x01, 0x15, 0x01, 0x0A, 0x01, 0x15, 0x01, 0x12, 0x01, 0x38, 0x02,
+    0x0E, 0x02, 0x16, 0x01, 0x0C, 0x01, 0x17, 0x04, 0x07, 0x03, 0x41, 0x07,
+    0x1A, 0x01, 0x0E, 0x01, 0x3A, 0x01, 0x10, 0x01, 0x83, 0x01, 0x01, 0x12,
+    0x01, 0x36, 0x01, 0x14, 0x01, 0x34, 0x01, 0x16, 0x01, 0x32, 0x01, 0x18,
+    0x01, 0x30, 0x01, 0x1A, 0x01, 0x2E, 0x01, 0x1C, 0x02, 0x2C, 0x01, 0x1E,
+    0x01, 0x2C, 0x01, 0x1E, 0x02, 0x2B, 0x01, 0x1F, 0x02, 0x2A, 0x02, 0x1F,
+    0x02, 0x2A, 0x01, 0x20, 0x03, 0x28, 0x01, 0x22, 0x04, 0x25, 0x01, 0x25,
+    0x0F, 0x17, 0x01, 0x33, 0x01, 0x17, 0x01, 0x33, 0x01, 0x17, 0x01, 0x33,
+    0x01, 0x17, 0x01, 0x33, 0x01, 0x17, 0x01, 0x33, 0x01, 0x17, 0x02, 0x32,
+    0x01, 0x17, 0x01, 0x33, 0x01, 0x15, 0x01, 0x35, 0x01, 0x13, 0x01, 0x37,
+    0x01, 0x11, 0x01, 0x39, 0x01, 0x0F, 0x01, 0x3B, 0x02, 0x0C, 0x01, 0x3E,
+    0x01, 0x09, 0x02, 0x40, 0x01, 0x07, 0x01, 0x43, 0x01, 0x05, 0x01, 0x45,
+    0x01, 0x03, 0x01, 0x47, 0x01, 0x01, 0x01, 0x00, 0x28, 0x45, 0x05, 0x45,
+    0x03, 0x45, 0x02, 0x45, 0x02, 0x45, 0x02, 0x45, 0x01, 0x45, 0x01, 0x45,
+    0x01, 0x45, 0x01, 0x45, 0x01, 0x45, 0x01, 0x8A, 0x01, 0x01, 0x45, 0x01,
+    0x5F, 0x12, 0x19, 0x01, 0x2B, 0x02, 0x45, 0x02, 0x45, 0x01, 0x15, 0x01,
+    0x2F, 0x01, 0x45, 0x01, 0x59, 0x01, 0x30, 0x01, 0xCF, 0x01, 0x01, 0xC5,
+    0x07, 0x01, 0x57, 0x01, 0x30, 0x01, 0x88, 0x01, 0x01, 0x58, 0x01, 0x2F,
+    0x01, 0x43, 0x01, 0x42, 0x02, 0x15, 0x01, 0x2A, 0x03, 0x31, 0x11, 0x19,
+    0x01, 0x88, 0x01, 0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x01,
+    0x43, 0x01, 0x43, 0x01, 0x43, 0x01, 0x42, 0x02, 0x42, 0x01, 0x44, 0x01,
+    0x8A, 0x01, 0x01, 0x69, 0x0D, 0x59, 0x01, 0x30, 0x01, 0x59, 0x01, 0x30,
+    0x01, 0x59, 0x01, 0x30, 0x01, 0x9E, 0x01, 0x01, 0x30, 0x01, 0x59, 0x01,
+    0x30, 0x01, 0x59, 0x01, 0x30, 0x01, 0x59, 0x01, 0x75, 0x01, 0x59, 0x01,
+    0x30, 0x01, 0x59, 0x01, 0x75, 0x01, 0x14, 0x01, 0x75, 0x01, 0x59, 0x01,
+    0x30, 0x01, 0x59, 0x01, 0x75, 0x01, 0x14, 0x01, 0x75, 0x01, 0x14, 0x01,
+    0x75, 0x01, 0x59, 0x01, 0x75, 0x01, 0x14, 0x01, 0x75, 0x01, 0x14, 0x01,
+    0x1B, 0x0D, 0x31, 0x05, 0x0D, 0x05, 0x29, 0x03, 0x17, 0x03, 0x24, 0x02,
+    0x1D, 0x02, 0x20, 0x02, 0x21, 0x02, 0x1D, 0x01, 0x25, 0x01, 0x1A, 0x02,
+    0x27, 0x01, 0x18, 0x01, 0x2A, 0x02, 0x15, 0x01, 0x2D, 0x01, 0x13, 0x01,
+    0x2F, 0x01, 0x11, 0x01, 0x31, 0x01, 0x0F, 0x01, 0x41, 0x01, 0x34, 0x01,
+    0x43, 0x01, 0x0B, 0x01, 0x37, 0x01, 0x09, 0x01, 0x5A, 0x0A, 0x18, 0x01,
+    0x1E, 0x02, 0x0A, 0x03, 0x1D, 0x01, 0x15, 0x01, 0x0F, 0x01, 0x15, 0x01,
+    0x1B, 0x01, 0x11, 0x01, 0x1A, 0x01, 0x14, 0x01, 0x13, 0x01, 0x2D, 0x01,
+    0x15, 0x01, 0x13, 0x01, 0x5A, 0x01, 0x17, 0x01, 0x99, 0x01, 0x01, 0x02,
+    0x01, 0x6F, 0x01, 0xA1, 0x02, 0x01, 0x2D, 0x13, 0x16, 0x01, 0x86, 0x01,
+    0x01, 0x43, 0x01, 0x2D, 0x01, 0x15, 0x01, 0x43, 0x01, 0x43, 0x02, 0x2A,
+    0x01, 0x18, 0x01, 0x43, 0x02, 0x28, 0x01, 0x1A, 0x02, 0x27, 0x01, 0x1B,
+    0x03, 0x43, 0x02, 0x23, 0x01, 0x1F, 0x03, 0x21, 0x01, 0x21, 0x02, 0x20,
+    0x01, 0x22, 0x02, 0x1F, 0x01, 0x23, 0x02, 0x1E, 0x01, 0x24, 0x02, 0x1D,
+    0x01, 0x25, 0x02, 0x1C, 0x02, 0x25, 0x01, 0x1D, 0x01, 0x25, 0x02, 0x1C,
+    0x02, 0x25, 0x01, 0x1D, 0x01, 0x25, 0x01, 0x1D, 0x02, 0x24, 0x02, 0x1D,
+    0x02, 0x24, 0x01, 0x1E, 0x02, 0x23, 0x01, 0x1F, 0x03, 0x43, 0x02, 0x1F,
+    0x01, 0x23, 0x02, 0x1E, 0x01, 0x24, 0x03, 0x1C, 0x01, 0x26, 0x02, 0x43,
+    0x02, 0x19, 0x01, 0x29, 0x02, 0x43, 0x01, 0x17, 0x01, 0x2B, 0x02, 0x43,
+    0x01, 0x43, 0x01, 0x14, 0x01, 0x71, 0x01, 0x43, 0x01, 0x57, 0x13, 0x2F,
+    0x01, 0x72, 0x01, 0xB2, 0x02, 0x01, 0x5E, 0x01, 0x56, 0x01, 0x13, 0x01,
+    0x2D, 0x01, 0x58, 0x01, 0x18, 0x01, 0x15, 0x01, 0x57, 0x01, 0x16, 0x01,
+    0x2C, 0x02, 0x13, 0x01, 0x14, 0x01, 0x03, 0x01, 0x16, 0x01, 0x10, 0x02,
+    0x31, 0x03, 0x0B, 0x02, 0x16, 0x01, 0x05, 0x01, 0x19, 0x0B, 0x1F, 0x01,
+    0x3A, 0x01, 0x4B, 0x01, 0x38, 0x01, 0x0A, 0x01, 0x36, 0x01, 0x0C, 0x01,
+    0x43, 0x01, 0x33, 0x01, 0x0F, 0x01, 0x31, 0x01, 0x11, 0x01, 0x2F, 0x01,
+    0x13, 0x01, 0x2C, 0x02, 0x15, 0x02, 0x29, 0x01, 0x19, 0x02, 0x26, 0x01,
+    0x1C, 0x01, 0x22, 0x03, 0x1E, 0x03, 0x1D, 0x02, 0x24, 0x03, 0x17, 0x03,
+    0x29, 0x05, 0x0D, 0x05, 0x00, 0x47, 0xA9, 0x08, 0x1A, 0x13, 0x1A, 0x00,
+    0x13, 0x1E, 0x13, 0x94, 0x27, 0x01, 0xF2, 0x01, 0x01, 0x2F, 0x01, 0x44,
+    0x01, 0x72, 0x01, 0x28, 0x01, 0x88, 0x01, 0x01, 0x18, 0x01, 0x13, 0x01,
+    0x02, 0x01, 0x58, 0x01, 0x16, 0x01, 0x2D, 0x01, 0x14, 0x01, 0x14, 0x01,
+    0x04, 0x01, 0x15, 0x02, 0x10, 0x02, 0x32, 0x03, 0x0A, 0x03, 0x16, 0x01,
+    0x06, 0x01, 0x19, 0x0A, 0x5C, 0x01, 0x08, 0x01, 0x44, 0x01, 0x38, 0x01,
+    0x42, 0x01, 0x0C, 0x01, 0x44, 0x01, 0x34, 0x01, 0x0F, 0x01, 0x32, 0x01,
+    0x11, 0x01, 0x30, 0x01, 0x13, 0x01, 0x2D, 0x02, 0x15, 0x02, 0x2A, 0x01,
+    0x19, 0x01, 0x27, 0x02, 0x1B, 0x02, 0x23, 0x02, 0x1F, 0x03, 0x1E, 0x02,
+    0x24, 0x03, 0x18, 0x03, 0x29, 0x04, 0x0F, 0x05, 0x00, 0x15, 0x27, 0x14,
+    0x3C, 0x01, 0x15, 0x01, 0xB6, 0x01, 0x01, 0x39, 0x01, 0x02, 0x01, 0x38,
+    0x01, 0xB5, 0x01, 0x01, 0x18, 0x01, 0x3C, 0x01, 0x36, 0x01, 0x64, 0x01,
+    0x57, 0x01, 0x13, 0x01, 0x71, 0x01, 0x64, 0x01, 0x59, 0x01, 0x13, 0x01,
+    0x6F, 0x01, 0x13, 0x01, 0x5B, 0x01, 0x64, 0x01, 0x6D, 0x01, 0x13, 0x01,
+    0x5D, 0x01, 0x64, 0x01, 0x2E, 0x01, 0x3C, 0x01, 0x22, 0x01, 0xB5, 0x01,
+    0x01, 0x2C, 0x01, 0x10, 0x01, 0x2B, 0x01, 0xB4, 0x01, 0x01, 0x25, 0x01,
+    0x3D, 0x01, 0x29, 0x01, 0x63, 0x01, 0x65, 0x01, 0x12, 0x01, 0x65, 0x01,
+    0x63, 0x01, 0x67, 0x01, 0x12, 0x01, 0x63, 0x01, 0x12, 0x01, 0x69, 0x01,
+    0x63, 0x01, 0x61, 0x01, 0x12, 0x01, 0x6B, 0x01, 0x63, 0x01, 0x21, 0x01,
+    0x3D, 0x01, 0x2F, 0x01, 0xB4, 0x01, 0x01, 0x1F, 0x01, 0x1E, 0x01, 0x1E,
+    0x01, 0xB3, 0x01, 0x01, 0x32, 0x01, 0x3E, 0x01, 0x1C, 0x01, 0x62, 0x01,
+    0x73, 0x01, 0x11, 0x01, 0x59, 0x01, 0x62, 0x01, 0x75, 0x01, 0x11, 0x01,
+    0x57, 0x01, 0x11, 0x01, 0x77, 0x01, 0x62, 0x01, 0x55, 0x01, 0x11, 0x01,
+    0x79, 0x01, 0x62, 0x01, 0x14, 0x01, 0x3E, 0x01, 0x3C, 0x01, 0x75, 0x01,
+    0x3D, 0x01, 0x3F, 0x01, 0x11, 0x01, 0xB2, 0x01, 0x01, 0x7F, 0x01, 0x71,
+    0x01, 0x81, 0x01, 0x01, 0xC0, 0x01, 0x01, 0x83, 0x01, 0x01, 0x6D, 0x01,
+    0x85, 0x01, 0x01, 0xBC, 0x01, 0x01, 0x87, 0x01, 0x01, 0x69, 0x01, 0x89,
+    0x01, 0x01, 0x67, 0x01, 0x8B, 0x01, 0x01, 0xB6, 0x01, 0x01, 0x00, 0x13,
+    0x18, 0x11, 0x18, 0x13, 0x9C, 0x03, 0x01, 0x12, 0x01, 0x28, 0x01, 0x16,
+    0x01, 0x12, 0x01, 0x2A, 0x01, 0xF2, 0x02, 0x01, 0x3B, 0x01, 0x27, 0x01,
+    0x15, 0x01, 0x14, 0x01, 0x8F, 0x01, 0x01, 0xA0, 0x02, 0x01, 0x2A, 0x01,
+    0x25, 0x01, 0x3B, 0x01, 0x7E, 0x01, 0x3B, 0x01, 0xBB, 0x01, 0x01, 0x2A,
+    0x01, 0x23, 0x01, 0x3B, 0x01, 0xE7, 0x01, 0x01, 0x90, 0x01, 0x01, 0x0F,
+    0x01, 0x1A, 0x01, 0x21, 0x01, 0xA2, 0x01, 0x01, 0xE9, 0x01, 0x01, 0x29,
+    0x01, 0x4A, 0x01, 0x29, 0x01, 0x1C, 0x01, 0x5B, 0x01, 0x95, 0x02, 0x01,
+    0x48, 0x01, 0x48, 0x01, 0x11, 0x01, 0x81, 0x01, 0x01, 0x1A, 0x01, 0x11,
+    0x01, 0xF7, 0x01, 0x01, 0x1F, 0x01, 0x57, 0x01, 0x39, 0x01, 0x11, 0x01,
+    0x18, 0x01, 0x2C, 0x01, 0x54, 0x01, 0xC4, 0x01, 0x01, 0x44, 0x01, 0x12,
+    0x01, 0x39, 0x01, 0x28, 0x01, 0x93, 0x01, 0x01, 0x22, 0x01, 0x31, 0x01,
+    0x5F, 0x01, 0x42, 0x01, 0x14, 0x01, 0x60, 0x01, 0x3F, 0x01, 0x53, 0x01,
+    0x8B, 0x01, 0x01, 0x1B, 0x01, 0x0E, 0x01, 0x40, 0x01, 0x2A, 0x01, 0x4A,
+    0x01, 0x41, 0x01, 0xB8, 0x01, 0x01, 0x42, 0x01, 0x0E, 0x01, 0x3B, 0x01,
+    0x02, 0x01, 0x0E, 0x01, 0x82, 0x01, 0x01, 0x8E, 0x01, 0x01, 0x4F, 0x01,
+    0x44, 0x01, 0x0E, 0x01, 0x3C, 0x01, 0x0E, 0x01, 0xBD, 0x01, 0x01, 0x55,
+    0x01, 0x3C, 0x01, 0x57, 0x01, 0x1F, 0x01, 0x38, 0x01, 0xFC, 0x02, 0x01,
+    0x2D, 0x01, 0x1D, 0x01, 0x38, 0x01, 0xFE, 0x02, 0x01, 0x2D, 0x01, 0x54,
+    0x01, 0x2D, 0x01, 0x80, 0x03, 0x01, 0x38, 0x01, 0x19, 0x01, 0x2D, 0x01,
+    0xEC, 0x02, 0x01, 0x15, 0x01, 0x38, 0x01, 0xAC, 0x01, 0x01, 0x85, 0x02,
+    0x01, 0x17, 0x01, 0x38, 0x01, 0xAA, 0x01, 0x01, 0x85, 0x02, 0x01, 0x19,
+    0x01, 0x9F, 0x01, 0x01, 0xA8, 0x01, 0x01, 0x01, 0x16, 0x1F, 0x15, 0x36,
+    0x01, 0x17, 0x01, 0x15, 0x01, 0x32, 0x01, 0x4F, 0x01, 0x15, 0x01, 0x1B,
+    0x01, 0x14, 0x01, 0x51, 0x01, 0x2F, 0x01, 0x14, 0x01, 0x1C, 0x01, 0x36,
+    0x01, 0x2D, 0x01, 0x14, 0x01, 0x1E, 0x01, 0x36, 0x01, 0x40, 0x01, 0x20,
+    0x01, 0x15, 0x01, 0x20, 0x01, 0x3E, 0x01, 0x22, 0x01, 0x13, 0x01, 0x22,
+    0x01, 0x3C, 0x01, 0x36, 0x01, 0x24, 0x01, 0x14, 0x01, 0x25, 0x01, 0x5D,
+    0x01, 0x14, 0x01, 0x0F, 0x01, 0x13, 0x01, 0x5F, 0x01, 0x14, 0x01, 0x0D,
+    0x01, 0x13, 0x01, 0x61, 0x01, 0x14, 0x01, 0x0B, 0x01, 0x13, 0x01, 0x63,
+    0x01, 0x32, 0x01, 0x2D, 0x01, 0x09, 0x01, 0x2D, 0x01, 0x30, 0x01, 0x2F,
+    0x01, 0x07, 0x01, 0x2F, 0x01, 0x2E, 0x01, 0x31, 0x01, 0x05, 0x01, 0x31,
+    0x01, 0x2C, 0x01, 0x33, 0x01, 0x37, 0x01, 0x17, 0x01, 0x12, 0x01, 0x6D,
+    0x01, 0x13, 0x01, 0x01, 0x01, 0x12, 0x01, 0x6F, 0x01, 0x13, 0x01, 0x5E,
+    0x01, 0x25, 0x01, 0x70, 0x01, 0x27, 0x01, 0x6E, 0x01, 0x29, 0x01, 0x6C,
+    0x01, 0x2B, 0x01, 0x6A, 0x01, 0x2D, 0x01, 0x68, 0x01, 0x2F, 0x01, 0x66,
+    0x01, 0x31, 0x01, 0x64, 0x01, 0x97, 0x01, 0x01, 0x32, 0x01, 0x65, 0x01,
+    0x30, 0x01, 0x67, 0x01, 0x2E, 0x01, 0x69, 0x01, 0x2C, 0x01, 0x6B, 0x01,
+    0x2A, 0x01, 0x6D, 0x01, 0x28, 0x01, 0x6F, 0x01, 0x26, 0x01, 0x96, 0x01,
+    0x01, 0x26, 0x01, 0x37, 0x01, 0x37, 0x01, 0x14, 0x01, 0x13, 0x01, 0x35,
+    0x01, 0x37, 0x01, 0x16, 0x01, 0x13, 0x01, 0x33, 0x01, 0x37, 0x01, 0x18,
+    0x01, 0x13, 0x01, 0x69, 0x01, 0x13, 0x01, 0x1A, 0x01, 0x37, 0x01, 0x2F,
+    0x01, 0x13, 0x01, 0x1C, 0x01, 0x37, 0x01, 0x2D, 0x01, 0x13, 0x01, 0x1E,
+    0x01, 0x37, 0x01, 0x2B, 0x01, 0x34, 0x01, 0x2A, 0x01, 0x36, 0x01, 0x21,
+    0x01, 0x14, 0x01, 0x28, 0x01, 0x36, 0x01, 0x23, 0x01, 0x14, 0x01, 0x26,
+    0x01, 0x36, 0x01, 0x25, 0x01, 0x14, 0x01, 0x24, 0x01, 0x36, 0x01, 0x27,
+    0x01, 0x14, 0x01, 0x59, 0x01, 0x14, 0x01, 0x29, 0x01, 0x36, 0x01, 0x20,
+    0x01, 0x14, 0x01, 0x2B, 0x01, 0x36, 0x01, 0x1E, 0x01, 0x14, 0x01, 0x2D,
+    0x01, 0x36, 0x01, 0x1C, 0x01, 0x44, 0x01, 0x1B, 0x01, 0x35, 0x01, 0x30,
+    0x01, 0x15, 0x01, 0x19, 0x01, 0x35, 0x01, 0x32, 0x01, 0x15, 0x01, 0x17,
+    0x01, 0x35, 0x01, 0x34, 0x01, 0x15, 0x01, 0x01, 0x15, 0x21, 0x16, 0x4C,
+    0x01, 0x4E, 0x01, 0x14, 0x01, 0x1F, 0x01, 0x14, 0x01, 0x50, 0x01, 0x47,
+    0x01, 0x19, 0x01, 0x1D, 0x01, 0x1A, 0x01, 0x92, 0x01, 0x01, 0x1B, 0x01,
+    0x1B, 0x01, 0x1C, 0x01, 0x43, 0x01, 0x56, 0x01, 0x13, 0x01, 0x19, 0x01,
+    0x13, 0x01, 0x58, 0x01, 0x13, 0x01, 0x64, 0x01, 0x13, 0x01, 0x5A, 0x01,
+    0x13, 0x01, 0x15, 0x01, 0x13, 0x01, 0x5C, 0x01, 0x3B, 0x01, 0x24, 0x01,
+    0x13, 0x01, 0x25, 0x01, 0x86, 0x01, 0x01, 0x26, 0x01, 0x11, 0x01, 0x27,
+    0x01, 0x37, 0x01, 0x62, 0x01, 0x12, 0x01, 0x0F, 0x01, 0x12, 0x01, 0x64,
+    0x01, 0x5F, 0x01, 0x0D, 0x01, 0x12, 0x01, 0x66, 0x01, 0x12, 0x01, 0x1E,
+    0x01, 0x39, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x09, 0x01, 0x30,
+    0x01, 0x7A, 0x01, 0x31, 0x01, 0x07, 0x01, 0x32, 0x01, 0x2B, 0x01, 0x6E,
+    0x01, 0x11, 0x01, 0x05, 0x01, 0x11, 0x01, 0x70, 0x01, 0x5E, 0x01, 0x03,
+    0x01, 0x11, 0x01, 0x72, 0x01, 0x25, 0x01, 0x38, 0x01, 0x01, 0x01, 0x39,
+    0x01, 0x23, 0x01, 0x3A, 0x01, 0x3B, 0x01, 0x6E, 0x01, 0x78, 0x01, 0x1F,
+    0x01, 0x7A, 0x01, 0x1D, 0x01, 0x7C, 0x01, 0x68, 0x01, 0x7E, 0x01, 0x19,
+    0x01, 0x80, 0x01, 0x01, 0x17, 0x01, 0x82, 0x01, 0x01, 0x62, 0x01, 0x84,
+    0x01, 0x01, 0x13, 0x01, 0x00, 0x42, 0xA3, 0x06, 0x01, 0x84, 0x01, 0x01,
+    0x45, 0x2B, 0x14, 0x01, 0x41, 0x01, 0x2E, 0x01, 0x55, 0x01, 0x2E, 0x01,
+    0x55, 0x01, 0x2E, 0x01, 0x41, 0x01, 0x13, 0x01, 0x70, 0x01, 0x13, 0x01,
+    0x41, 0x01, 0x2E, 0x01, 0x55, 0x01, 0x2E, 0x01, 0x41, 0x01, 0x13, 0x01,
+    0x70, 0x01, 0x13, 0x01, 0x41, 0x01, 0x2E, 0x01, 0x55, 0x01, 0x2E, 0x01,
+    0x41, 0x01, 0x13, 0x01, 0x70, 0x01, 0x13, 0x01, 0x41, 0x01, 0x2E, 0x01,
+    0x55, 0x01, 0x2E, 0x01, 0x55, 0x01, 0x2E, 0x01, 0x41, 0x01, 0x13, 0x01,
+    0x70, 0x01, 0x13, 0x01, 0x41, 0x01, 0x2E, 0x01, 0x55, 0x01, 0x2E, 0x01,
+    0x41, 0x01, 0x13, 0x01, 0x70, 0x01, 0x13, 0x01, 0x41, 0x01, 0x2E, 0x01,
+    0x55, 0x01, 0x2E, 0x01, 0x41, 0x01, 0x13, 0x01, 0x70, 0x01, 0x13, 0x01,
+    0x41, 0x01, 0x2E, 0x01, 0x55, 0x01, 0x2E, 0x01, 0x41, 0x01, 0x13, 0x01,
+    0x70, 0x01, 0x13, 0x01, 0x41, 0x01, 0x2E, 0x01, 0x55, 0x01, 0x2E, 0x01,
+    0x41, 0x01, 0x13, 0x01, 0x70, 0x01, 0x13, 0x01, 0x70, 0x01, 0x13, 0x01,
+    0x41, 0x01, 0x2E, 0x01, 0x41, 0x01, 0x13, 0x01, 0x70, 0x01, 0x13, 0x01,
+    0x70, 0x01, 0x13, 0x01, 0x41, 0x01, 0x2E, 0x01, 0x41, 0x01, 0x13, 0x01,
+    0x42, 0x2D, 0x01, 0x01, 0x84, 0x01, 0x01, 0x00, 0x1B, 0x8D, 0x03, 0x08,
+    0x99, 0x18, 0x08, 0x01, 0x12, 0x38, 0x01, 0x5D, 0x01, 0x82, 0x01, 0x01,
+    0x25, 0x01, 0x82, 0x01, 0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A,
+    0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A,
+    0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x82, 0x01, 0x01, 0x25, 0x01,
+    0x82, 0x01, 0x01, 0x25, 0x01, 0x82, 0x01, 0x01, 0x25, 0x01, 0x82, 0x01,
+    0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A,
+    0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x82,
+    0x01, 0x01, 0x25, 0x01, 0x82, 0x01, 0x01, 0x25, 0x01, 0x82, 0x01, 0x01,
+    0x25, 0x01, 0x82, 0x01, 0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A,
+    0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A,
+    0x01, 0x5D, 0x01, 0x82, 0x01, 0x01, 0x25, 0x01, 0x82, 0x01, 0x01, 0x25,
+    0x01, 0x82, 0x01, 0x01, 0x25, 0x01, 0x82, 0x01, 0x01, 0x5D, 0x01, 0x4A,
+    0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A, 0x01, 0x5D, 0x01, 0x4A,
+    0x01, 0x5D, 0x01, 0x82, 0x01, 0x01, 0x25, 0x01, 0x00, 0x1B, 0xFA, 0x02,
+    0x09, 0x98, 0x18, 0x09, 0x12, 0x0D, 0x23, 0x01, 0x0D, 0x01, 0x83, 0x01,
+    0x01, 0x0F, 0x01, 0x81, 0x01, 0x01, 0x11, 0x01, 0x7F, 0x01, 0x13, 0x01,
+    0x7D, 0x01, 0x15, 0x01, 0x7B, 0x01, 0x17, 0x01, 0x79, 0x01, 0x0C, 0x01,
+    0x0C, 0x01, 0x46, 0x01, 0x1B, 0x01, 0x23, 0x01, 0x2E, 0x01, 0x22, 0x01,
+    0x1D, 0x01, 0x50, 0x01, 0x03, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x4E, 0x01,
+    0x05, 0x01, 0x1C, 0x01, 0x21, 0x01, 0x54, 0x01, 0x1A, 0x01, 0x0D, 0x01,
+    0x15, 0x01, 0x6D, 0x01, 0x0D, 0x01, 0x09, 0x01, 0x0D, 0x01, 0x6B, 0x01,
+    0x19, 0x01, 0x0D, 0x01, 0x16, 0x01, 0x52, 0x01, 0x29, 0x01, 0x14, 0x01,
+    0x0D, 0x01, 0x13, 0x01, 0x5C, 0x01, 0x12, 0x01, 0x0F, 0x01, 0x11, 0x01,
+    0x2D, 0x01, 0x53, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x20, 0x01, 0x00, 0x37,
+    0x00, 0x15, 0x0E, 0x01, 0x14, 0x01, 0x0E, 0x01, 0x14, 0x01, 0x0E, 0x01,
+    0x23, 0x01, 0x13, 0x01, 0x0F, 0x01, 0x13, 0x01, 0x0F, 0x01, 0x36, 0x01,
+    0x0F, 0x01, 0x23, 0x01, 0x12, 0x01, 0x10, 0x01, 0x12, 0x01, 0x10, 0x01,
+    0x23, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x23, 0x01,
+    0x10, 0x01, 0x23, 0x01, 0x11, 0x01, 0x23, 0x01, 0x10, 0x01, 0x12, 0x01,
+    0x10, 0x01, 0x12, 0x01, 0x23, 0x01, 0x0F, 0x01, 0x17, 0x0C, 0x2A, 0x04,
+    0x0C, 0x05, 0x22, 0x03, 0x15, 0x03, 0x1D, 0x02, 0x1B, 0x02, 0x19, 0x02,
+    0x1F, 0x01, 0x17, 0x01, 0x22, 0x02, 0x14, 0x01, 0x25, 0x01, 0x12, 0x01,
+    0x27, 0x01, 0x10, 0x01, 0x29, 0x01, 0x0E, 0x01, 0x38, 0x01, 0x2C, 0x01,
+    0x0B, 0x01, 0x2E, 0x01, 0x43, 0x01, 0x30, 0x01, 0x41, 0x01, 0x14, 0x09,
+    0x30, 0x01, 0x09, 0x01, 0x14, 0x01, 0x05, 0x01, 0x13, 0x01, 0x0B, 0x01,
+    0x2C, 0x01, 0x0D, 0x01, 0x64, 0x01, 0x0F, 0x01, 0x16, 0x01, 0xAD, 0x01,
+    0x13, 0x23, 0x01, 0xAF, 0x03, 0x0E, 0x27, 0x05, 0x32, 0x03, 0x35, 0x02,
+    0x36, 0x02, 0x36, 0x02, 0x37, 0x01, 0x38, 0x01, 0x38, 0x01, 0x38, 0x01,
+    0x38, 0x01, 0x55, 0x05, 0x18, 0x01, 0x16, 0x06, 0x32, 0x02, 0x22, 0x01,
+    0x13, 0x02, 0x37, 0x01, 0x25, 0x01, 0x4C, 0x01, 0x38, 0x01, 0x26, 0x01,
+    0xBF, 0x01, 0x01, 0xE7, 0x01, 0x01, 0x85, 0x01, 0x01, 0x28, 0x01, 0x48,
+    0x02, 0x16, 0x01, 0x13, 0x01, 0x0C, 0x01, 0x2D, 0x02, 0x07, 0x03, 0x30,
+    0x07, 0x57, 0x01, 0x74, 0x01, 0x3A, 0x01, 0x74, 0x01, 0x20, 0x01, 0x12,
+    0x01, 0x06, 0x01, 0x3A, 0x01, 0x1D, 0x01, 0x1C, 0x01, 0x1B, 0x01, 0x1E,
+    0x02, 0x18, 0x01, 0x03, 0x01, 0x12, 0x01, 0x0A, 0x01, 0x15, 0x02, 0x23,
+    0x03, 0x10, 0x02, 0x28, 0x03, 0x0A, 0x03, 0x09, 0x13, 0x00, 0x12, 0xB1,
+    0x0E, 0x0A, 0x2D, 0x04, 0x0A, 0x03, 0x28, 0x02, 0x11, 0x03, 0x24, 0x01,
+    0x16, 0x02, 0x21, 0x01, 0x19, 0x01, 0x1F, 0x01, 0x1B, 0x01, 0x1D, 0x01,
+    0x1D, 0x01, 0x1B, 0x01, 0x1F, 0x01, 0x19, 0x01, 0x21, 0x01, 0x76, 0x01,
+    0x3B, 0x01, 0x76, 0x01, 0x91, 0x01, 0x0A, 0x16, 0x01, 0x18, 0x02, 0x0A,
+    0x02, 0x2C, 0x01, 0x0E, 0x01, 0x2A, 0x01, 0x10, 0x01, 0x13, 0x01, 0x14,
+    0x01, 0x4D, 0x01, 0x26, 0x01, 0x4F, 0x01, 0x4D, 0x01, 0x9E, 0x01, 0x01,
+    0xFD, 0x0B, 0x01, 0xC2, 0x01, 0x01, 0x27, 0x01, 0x25, 0x01, 0x76, 0x01,
+    0x12, 0x01, 0x28, 0x01, 0x10, 0x01, 0x13, 0x01, 0x16, 0x01, 0x0E, 0x01,
+    0x2C, 0x02, 0x0B, 0x01, 0x2F, 0x0B, 0x15, 0x01, 0xAF, 0x01, 0x01, 0x74,
+    0x01, 0x39, 0x01, 0x52, 0x01, 0x21, 0x01, 0x17, 0x01, 0x01, 0x01, 0x1F,
+    0x01, 0x1B, 0x01, 0x1D, 0x01, 0x1D, 0x01, 0x1B, 0x01, 0x1F, 0x01, 0x18,
+    0x02, 0x21, 0x01, 0x16, 0x01, 0x24, 0x02, 0x11, 0x03, 0x0D, 0x11, 0x09,
+    0x04, 0x0A, 0x03, 0x17, 0x0D, 0x28, 0x04, 0x0D, 0x04, 0x21, 0x03, 0x15,
+    0x02, 0x1D, 0x02, 0x1A, 0x02, 0x1A, 0x01, 0x1E, 0x02, 0x16, 0x02, 0x21,
+    0x01, 0x14, 0x01, 0x24, 0x02, 0x11, 0x01, 0x27, 0x01, 0x0F, 0x01, 0x37,
+    0x01, 0x2A, 0x01, 0x0C, 0x01, 0x2C, 0x01, 0x39, 0x01, 0x09, 0x01, 0x37,
+    0x01, 0x30, 0x01, 0x3F, 0x01, 0x18, 0x03, 0x17, 0x01, 0x1A, 0x04, 0x03,
+    0x03, 0x2E, 0x01, 0x0A, 0x02, 0x17, 0x01, 0x13, 0x01, 0x0D, 0x01, 0x12,
+    0x01, 0x16, 0x01, 0x0F, 0x01, 0x27, 0x01, 0x25, 0x01, 0x24, 0x01, 0x11,
+    0x01, 0x13, 0x01, 0x97, 0x01, 0x01, 0x26, 0x01, 0x5C, 0x01, 0xC0, 0x01,
+    0x11, 0xD5, 0x09, 0x11, 0x4B, 0x01, 0x26, 0x01, 0x98, 0x01, 0x01, 0x24,
+    0x01, 0x26, 0x01, 0x4B, 0x01, 0x11, 0x01, 0x11, 0x01, 0x25, 0x01, 0x15,
+    0x01, 0x12, 0x01, 0x0E, 0x01, 0x2A, 0x02, 0x0B, 0x01, 0x13, 0x01, 0x19,
+    0x04, 0x03, 0x04, 0x19, 0x01, 0x18, 0x03, 0x17, 0x01, 0x3F, 0x01, 0x30,
+    0x01, 0x08, 0x01, 0x67, 0x01, 0x0A, 0x01, 0x2C, 0x01, 0x0C, 0x01, 0x2A,
+    0x01, 0x0E, 0x01, 0x28, 0x01, 0x10, 0x01, 0x26, 0x01, 0x12, 0x01, 0x24,
+    0x01, 0x14, 0x02, 0x21, 0x01, 0x17, 0x01, 0x1E, 0x02, 0x19, 0x02, 0x1A,
+    0x02, 0x1D, 0x03, 0x14, 0x03, 0x22, 0x05, 0x0C, 0x03, 0x29, 0x13, 0x9C,
+    0x0E, 0x0A, 0x2F, 0x03, 0x0A, 0x03, 0x29, 0x03, 0x10, 0x02, 0x26, 0x01,
+    0x15, 0x02, 0x22, 0x02, 0x18, 0x01, 0x20, 0x01, 0x1B, 0x01, 0x1E, 0x01,
+    0x1D, 0x01, 0x1C, 0x01, 0x1F, 0x01, 0x1A, 0x01, 0x76, 0x01, 0x3A, 0x01,
+    0x76, 0x01, 0xB2, 0x01, 0x01, 0x16, 0x0A, 0x30, 0x02, 0x0A, 0x01, 0x2E,
+    0x01, 0x0D, 0x02, 0x17, 0x01, 0x13, 0x01, 0x4C, 0x01, 0x29, 0x01, 0x12,
+    0x01, 0x50, 0x01, 0x12, 0x01, 0xEE, 0x01, 0x01, 0xA0, 0x01, 0x01, 0xAF,
+    0x09, 0x01, 0x82, 0x02, 0x01, 0xA1, 0x01, 0x01, 0x12, 0x01, 0x78, 0x01,
+    0x12, 0x01, 0x51, 0x01, 0x13, 0x01, 0x10, 0x01, 0x2B, 0x01, 0x0D, 0x02,
+    0x2D, 0x02, 0x0A, 0x01, 0x1A, 0x01, 0x16, 0x0A, 0x58, 0x01, 0x78, 0x01,
+    0x78, 0x01, 0x3C, 0x01, 0x21, 0x01, 0x56, 0x01, 0x1F, 0x01, 0x1C, 0x01,
+    0x1D, 0x01, 0x02, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x20, 0x02, 0x18, 0x01,
+    0x23, 0x02, 0x14, 0x02, 0x26, 0x02, 0x10, 0x02, 0x2A, 0x03, 0x0A, 0x03,
+    0x0A, 0x11, 0x19, 0x0C, 0x2A, 0x05, 0x0C, 0x04, 0x24, 0x02, 0x15, 0x03,
+    0x1F, 0x02, 0x1A, 0x02, 0x1B, 0x02, 0x1E, 0x01, 0x18, 0x02, 0x21, 0x01,
+    0x16, 0x01, 0x24, 0x02, 0x13, 0x01, 0x27, 0x01, 0x11, 0x01, 0x29, 0x01,
+    0x0F, 0x01, 0x39, 0x01, 0x2C, 0x01, 0x3B, 0x01, 0x0B, 0x01, 0x39, 0x01,
+    0x30, 0x01, 0x43, 0x01, 0x18, 0x03, 0x17, 0x01, 0x1C, 0x04, 0x03, 0x04,
+    0x1A, 0x01, 0x14, 0x01, 0x0B, 0x01, 0x13, 0x01, 0x19, 0x01, 0x0D, 0x01,
+    0x2B, 0x01, 0x0F, 0x01, 0x16, 0x01, 0x12, 0x01, 0x23, 0x01, 0x28, 0x01,
+    0x27, 0x01, 0x27, 0x01, 0x61, 0x01, 0x25, 0x01, 0x26, 0x01, 0xB1, 0x01,
+    0x01, 0xFE, 0x01, 0x16, 0xE8, 0x05, 0x29, 0x4D, 0x01, 0x94, 0x02, 0x01,
+    0x4D, 0x01, 0xB1, 0x01, 0x01, 0x1D, 0x01, 0x09, 0x01, 0x2F, 0x01, 0x01,
+    0x01, 0x1C, 0x01, 0x1A, 0x01, 0x20, 0x01, 0x18, 0x01, 0x04, 0x01, 0x08,
+    0x01, 0x14, 0x01, 0x15, 0x02, 0x06, 0x01, 0x1D, 0x01, 0x13, 0x01, 0x11,
+    0x01, 0x15, 0x02, 0x0E, 0x03, 0x0A, 0x01, 0x1F, 0x05, 0x04, 0x05, 0x0E,
+    0x01, 0x07, 0x01, 0x1B, 0x04, 0x14, 0x01, 0x42, 0x01, 0x33, 0x01, 0x07,
+    0x01, 0x76, 0x01, 0x31, 0x01, 0x09, 0x01, 0x2F, 0x01, 0x0B, 0x01, 0x2C,
+    0x02, 0x0D, 0x01, 0x2A, 0x01, 0x10, 0x02, 0x27, 0x01, 0x13, 0x01, 0x24,
+    0x02, 0x15, 0x02, 0x21, 0x01, 0x19, 0x02, 0x1C, 0x03, 0x1C, 0x03, 0x17,
+    0x02, 0x22, 0x04, 0x0E, 0x05, 0x1D, 0x0B, 0x1C, 0x04, 0x0B, 0x03, 0x17,
+    0x02, 0x27, 0x02, 0x27, 0x02, 0x28, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29,
+    0x01, 0x29, 0x01, 0x54, 0x01, 0x54, 0x01, 0x7F, 0x01, 0x15, 0x0A, 0x20,
+    0x01, 0x29, 0x01, 0x29, 0x01, 0x16, 0x01, 0x3D, 0x01, 0x7F, 0x01, 0x91,
+    0x03, 0x0A, 0x12, 0x0D, 0xB1, 0x04, 0x0A, 0x12, 0x0D, 0x15, 0x0B, 0x2F,
+    0x03, 0x0B, 0x03, 0x09, 0x11, 0x0F, 0x03, 0x11, 0x02, 0x25, 0x02, 0x16,
+    0x02, 0x22, 0x01, 0x1A, 0x01, 0x20, 0x01, 0x1C, 0x01, 0x1E, 0x01, 0x1E,
+    0x01, 0x01, 0x01, 0x1A, 0x01, 0x20, 0x01, 0x1A, 0x01, 0x3B, 0x01, 0x3B,
+    0x01, 0x78, 0x01, 0x78, 0x01, 0x90, 0x01, 0x0A, 0x1B, 0x01, 0x15, 0x02,
+    0x0A, 0x02, 0x2E, 0x01, 0x0E, 0x01, 0x2C, 0x01, 0x10, 0x01, 0x16, 0x01,
+    0x13, 0x01, 0x12, 0x01, 0x65, 0x01, 0x65, 0x01, 0x12, 0x01, 0xAF, 0x02,
+    0x01, 0x9D, 0x02, 0x01, 0xDB, 0x05, 0x01, 0x80, 0x03, 0x01, 0xE1, 0x01,
+    0x01, 0x12, 0x01, 0x7A, 0x01, 0x66, 0x01, 0x13, 0x01, 0x12, 0x01, 0x2A,
+    0x01, 0x10, 0x01, 0x2C, 0x01, 0x0E, 0x01, 0x18, 0x01, 0x15, 0x02, 0x0A,
+    0x02, 0x31, 0x0A, 0x59, 0x01, 0x7A, 0x01, 0x3D, 0x01, 0x7A, 0x01, 0x3D,
+    0x01, 0x3D, 0x01, 0x1F, 0x01, 0x1D, 0x01, 0x1D, 0x01, 0x1F, 0x01, 0x1B,
+    0x01, 0x21, 0x02, 0x18, 0x01, 0x24, 0x01, 0x15, 0x02, 0x26, 0x03, 0x10,
+    0x02, 0x2B, 0x03, 0x0A, 0x03, 0x30, 0x0A, 0xCE, 0x02, 0x01, 0x29, 0x01,
+    0x98, 0x01, 0x03, 0x1A, 0x01, 0x22, 0x01, 0x2C, 0x01, 0x0B, 0x01, 0x04,
+    0x02, 0x16, 0x01, 0x26, 0x01, 0x14, 0x01, 0x1F, 0x01, 0x08, 0x03, 0x0F,
+    0x02, 0x14, 0x01, 0x17, 0x03, 0x09, 0x03, 0x21, 0x01, 0x0F, 0x09, 0x18,
+    0x01, 0x47, 0x01, 0x30, 0x01, 0x47, 0x01, 0x30, 0x01, 0x3B, 0x01, 0x3B,
+    0x01, 0x0D, 0x01, 0x2D, 0x01, 0x0F, 0x02, 0x2A, 0x01, 0x12, 0x01, 0x28,
+    0x01, 0x14, 0x02, 0x24, 0x02, 0x17, 0x02, 0x20, 0x02, 0x1B, 0x02, 0x1C,
+    0x02, 0x1F, 0x03, 0x16, 0x03, 0x24, 0x05, 0x0C, 0x05, 0x00, 0x12, 0xD4,
+    0x0D, 0x0A, 0x2B, 0x03, 0x0A, 0x03, 0x26, 0x02, 0x10, 0x02, 0x22, 0x02,
+    0x14, 0x02, 0x1F, 0x01, 0x18, 0x01, 0x1D, 0x01, 0x1A, 0x01, 0x1B, 0x01,
+    0x1C, 0x01, 0x19, 0x01, 0x1E, 0x01, 0x17, 0x01, 0x20, 0x01, 0x70, 0x01,
+    0x70, 0x01, 0xA8, 0x01, 0x01, 0x18, 0x0A, 0x2D, 0x01, 0x0A, 0x01, 0x2B,
+    0x01, 0x0C, 0x01, 0x29, 0x01, 0x0E, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10,
+    0x01, 0x25, 0x01, 0xBA, 0x01, 0x01, 0x06, 0x08, 0x0A, 0x02, 0x08, 0x02,
+    0x07, 0x01, 0x0C, 0x01, 0x05, 0x01, 0x0E, 0x01, 0x03, 0x01, 0x10, 0x01,
+    0x15, 0x01, 0x12, 0x01, 0x8C, 0x01, 0x01, 0x12, 0x01, 0x15, 0x01, 0x10,
+    0x01, 0x03, 0x01, 0x0E, 0x01, 0x05, 0x01, 0x0C, 0x01, 0x07, 0x02, 0x08,
+    0x02, 0x0A, 0x08, 0xBB, 0x01, 0x12, 0x11, 0x07, 0x16, 0x02, 0x07, 0x02,
+    0x12, 0x02, 0x0B, 0x02, 0x1F, 0x01, 0x0E, 0x01, 0x1D, 0x01, 0x11, 0x01,
+    0x5D, 0x01, 0x0A, 0x01, 0x3D, 0x01, 0x32, 0x01, 0x49, 0x01, 0x11, 0x01,
+    0x0D, 0x01, 0x2E, 0x01, 0x0F, 0x02, 0x0B, 0x02, 0x12, 0x02, 0x07, 0x02,
+    0x16, 0x07, 0xAA, 0x02, 0x12, 0xF6, 0x14, 0x01, 0x5B, 0x01, 0x31, 0x01,
+    0x09, 0x02, 0x15, 0x08, 0x52, 0x01, 0x5B, 0x01, 0x3C, 0x01, 0x1D, 0x01,
+    0x1D, 0x01, 0x1D, 0x01, 0x1D, 0x01, 0x1D, 0x01, 0x1C, 0x02, 0x1B, 0x02,
+    0x0C, 0x03, 0x0B, 0x03, 0x00, 0x12, 0xB3, 0x0F, 0x16, 0x26, 0x01, 0x15,
+    0x01, 0x25, 0x01, 0x15, 0x01, 0x3B, 0x01, 0x26, 0x01, 0x3B, 0x01, 0x15,
+    0x01, 0x3B, 0x01, 0x26, 0x01, 0x3B, 0x01, 0x15, 0x01, 0x3B, 0x01, 0x26,
+    0x01, 0x14, 0x01, 0x63, 0x01, 0x14, 0x01, 0x26, 0x01, 0x14, 0x01, 0x3B,
+    0x01, 0x27, 0x01, 0x3B, 0x01, 0x14, 0x01, 0x3B, 0x01, 0x27, 0x01, 0x3B,
+    0x01, 0x14, 0x01, 0x3B, 0x01, 0x27, 0x01, 0x13, 0x01, 0x64, 0x01, 0x13,
+    0x01, 0x27, 0x01, 0x13, 0x01, 0x64, 0x01, 0x13, 0x01, 0x27, 0x01, 0x13,
+    0x01, 0x27, 0x01, 0x13, 0x01, 0x78, 0x01, 0x3B, 0x01, 0x79, 0x01, 0x7A,
+    0x01, 0x7A, 0x01, 0x7A, 0x01, 0x7A, 0x01, 0x7A, 0x01, 0x3D, 0x01, 0x7A,
+    0x01, 0x28, 0x02, 0x3A, 0x01, 0x15, 0x01, 0x29, 0x01, 0x38, 0x01, 0x17,
+    0x01, 0x23, 0x01, 0x05, 0x01, 0x35, 0x01, 0x1A, 0x01, 0x20, 0x01, 0x08,
+    0x01, 0x13, 0x01, 0x66, 0x01, 0x13, 0x01, 0x66, 0x01, 0x13, 0x01, 0x66,
+    0x01, 0x13, 0x01, 0x66, 0x01, 0x13, 0x01, 0x3D, 0x01, 0x28, 0x01, 0x51,
+    0x01, 0x28, 0x01, 0x51, 0x01, 0x28, 0x01, 0x51, 0x01, 0x28, 0x01, 0x51,
+    0x01, 0x28, 0x01, 0x14, 0x01, 0x65, 0x01, 0x14, 0x01, 0x65, 0x01, 0x14,
+    0x01, 0x65, 0x01, 0x14, 0x01, 0x00, 0x12, 0x1F, 0x0A, 0x1A, 0x0A, 0x10,
+    0x11, 0x0A, 0x04, 0x0A, 0x03, 0x14, 0x03, 0x0A, 0x04, 0x25, 0x02, 0x11,
+    0x02, 0x0F, 0x03, 0x11, 0x02, 0x21, 0x02, 0x15, 0x01, 0x0D, 0x01, 0x16,
+    0x01, 0x1A, 0x01, 0x04, 0x01, 0x18, 0x02, 0x09, 0x02, 0x18, 0x02, 0x1C,
+    0x01, 0x1B, 0x01, 0x07, 0x01, 0x1C, 0x01, 0x1A, 0x01, 0x23, 0x01, 0x37,
+    0x01, 0x1E, 0x01, 0x04, 0x01, 0x1F, 0x01, 0x17, 0x01, 0x20, 0x01, 0x02,
+    0x01, 0x21, 0x01, 0x95, 0x01, 0x02, 0x23, 0x01, 0xBA, 0x01, 0x01, 0xBA,
+    0x01, 0x01, 0x76, 0x09, 0x1C, 0x09, 0x2D, 0x02, 0x09, 0x01, 0x1A, 0x01,
+    0x09, 0x02, 0x2A, 0x01, 0x0C, 0x01, 0x18, 0x01, 0x0C, 0x01, 0x13, 0x01,
+    0x14, 0x01, 0x0E, 0x01, 0x16, 0x01, 0x35, 0x01, 0x35, 0x01, 0x37, 0x01,
+    0x14, 0x01, 0x35, 0x01, 0x25, 0x01, 0xCB, 0x01, 0x01, 0x1F, 0x0A, 0x0F,
+    0x11, 0x0A, 0x04, 0x0A, 0x03, 0x25, 0x02, 0x11, 0x02, 0x22, 0x01, 0x15,
+    0x01, 0x1F, 0x02, 0x17, 0x02, 0x1C, 0x01, 0x1B, 0x01, 0x1A, 0x01, 0x36,
+    0x01, 0x1E, 0x01, 0x17, 0x01, 0x20, 0x01, 0x15, 0x01, 0x5A, 0x01, 0x70,
+    0x01, 0xA8, 0x01, 0x01, 0x19, 0x09, 0x2D, 0x02, 0x09, 0x01, 0x2B, 0x01,
+    0x0C, 0x01, 0x29, 0x01, 0x0E, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10, 0x01,
+    0x5D, 0x01, 0x82, 0x01, 0x01, 0x19, 0x0C, 0x2D, 0x05, 0x0C, 0x04, 0x27,
+    0x02, 0x15, 0x03, 0x22, 0x02, 0x1A, 0x02, 0x1E, 0x02, 0x1E, 0x01, 0x1B,
+    0x02, 0x21, 0x02, 0x18, 0x01, 0x25, 0x01, 0x16, 0x01, 0x27, 0x01, 0x14,
+    0x01, 0x29, 0x01, 0x12, 0x01, 0x2B, 0x01, 0x10, 0x01, 0x2D, 0x01, 0x3E,
+    0x01, 0x0D, 0x01, 0x3C, 0x01, 0x31, 0x01, 0x3E, 0x01, 0x09, 0x01, 0x18,
+    0x03, 0x38, 0x03, 0x03, 0x03, 0x16, 0x01, 0x07, 0x01, 0x14, 0x02, 0x09,
+    0x02, 0x30, 0x01, 0x0D, 0x01, 0x14, 0x01, 0x05, 0x01, 0x13, 0x01, 0x0F,
+    0x01, 0x3E, 0x01, 0x2B, 0x01, 0x25, 0x01, 0x03, 0x01, 0x12, 0x01, 0x13,
+    0x01, 0x7C, 0x01, 0x27, 0x01, 0x28, 0x01, 0x01, 0x01, 0xA5, 0x01, 0x01,
+    0x25, 0x01, 0xE4, 0x01, 0x01, 0xDF, 0x07, 0x01, 0x8E, 0x01, 0x01, 0x93,
+    0x01, 0x01, 0x13, 0x01, 0x50, 0x01, 0x28, 0x01, 0x2A, 0x01, 0x53, 0x01,
+    0x12, 0x01, 0x3E, 0x01, 0x12, 0x01, 0x12, 0x01, 0x29, 0x01, 0x18, 0x01,
+    0x13, 0x01, 0x3E, 0x01, 0x0D, 0x02, 0x13, 0x01, 0x06, 0x01, 0x14, 0x02,
+    0x0A, 0x01, 0x33, 0x03, 0x03, 0x04, 0x15, 0x01, 0x08, 0x01, 0x18, 0x03,
+    0x56, 0x01, 0x0A, 0x01, 0x31, 0x01, 0x0C, 0x01, 0x6D, 0x01, 0x0E, 0x01,
+    0x2D, 0x01, 0x10, 0x01, 0x2B, 0x01, 0x12, 0x01, 0x29, 0x01, 0x14, 0x01,
+    0x27, 0x01, 0x16, 0x01, 0x25, 0x01, 0x18, 0x02, 0x21, 0x02, 0x1B, 0x02,
+    0x1E, 0x01, 0x1F, 0x02, 0x1A, 0x02, 0x22, 0x02, 0x15, 0x03, 0x26, 0x04,
+    0x0D, 0x04, 0x1E, 0x0A, 0x13, 0x11, 0x09, 0x04, 0x0A, 0x03, 0x28, 0x02,
+    0x11, 0x03, 0x24, 0x01, 0x16, 0x01, 0x21, 0x02, 0x18, 0x02, 0x1E, 0x01,
+    0x1C, 0x01, 0x1C, 0x01, 0x1E, 0x01, 0x19, 0x01, 0x21, 0x01, 0x19, 0x01,
+    0x21, 0x01, 0x76, 0x01, 0x3B, 0x01, 0x76, 0x01, 0x91, 0x01, 0x0A, 0x16,
+    0x01, 0x18, 0x02, 0x0A, 0x01, 0x2D, 0x01, 0x0D, 0x02, 0x2A, 0x01, 0x24,
+    0x01, 0x14, 0x01, 0x11, 0x01, 0x3B, 0x01, 0x26, 0x01, 0x8A, 0x01, 0x01,
+    0x12, 0x01, 0x94, 0x02, 0x01, 0x91, 0x0A, 0x01, 0xFD, 0x01, 0x01, 0x27,
+    0x01, 0x9B, 0x01, 0x01, 0x13, 0x01, 0x27, 0x01, 0x11, 0x01, 0x13, 0x01,
+    0x50, 0x02, 0x0E, 0x01, 0x2C, 0x01, 0x0B, 0x02, 0x14, 0x01, 0x19, 0x04,
+    0x03, 0x04, 0x34, 0x03, 0x54, 0x01, 0x74, 0x01, 0x74, 0x01, 0x39, 0x01,
+    0x18, 0x01, 0x20, 0x01, 0x1A, 0x01, 0x3B, 0x01, 0x1D, 0x01, 0x1D, 0x01,
+    0x1B, 0x01, 0x1F, 0x01, 0x18, 0x02, 0x21, 0x01, 0x15, 0x02, 0x24, 0x02,
+    0x11, 0x02, 0x28, 0x03, 0x0A, 0x04, 0x2D, 0x0A, 0x14, 0x0B, 0x2E, 0x03,
+    0x0B, 0x03, 0x09, 0x11, 0x0E, 0x03, 0x11, 0x02, 0x25, 0x01, 0x16, 0x01,
+    0x22, 0x02, 0x18, 0x01, 0x20, 0x01, 0x1B, 0x01, 0x1E, 0x01, 0x1D, 0x01,
+    0x1C, 0x01, 0x1F, 0x01, 0x1A, 0x01, 0x21, 0x02, 0x17, 0x01, 0x76, 0x01,
+    0x76, 0x01, 0x76, 0x01, 0x1A, 0x02, 0x36, 0x04, 0x02, 0x04, 0x30, 0x02,
+    0x0A, 0x02, 0x18, 0x01, 0x14, 0x01, 0x0E, 0x01, 0x2B, 0x01, 0x10, 0x01,
+    0x3C, 0x01, 0x28, 0x01, 0x27, 0x01, 0x4E, 0x01, 0xEE, 0x01, 0x01, 0xA0,
+    0x01, 0x01, 0xAF, 0x09, 0x01, 0xC6, 0x01, 0x01, 0xDD, 0x01, 0x01, 0x12,
+    0x01, 0x78, 0x01, 0x4E, 0x01, 0x15, 0x01, 0x13, 0x01, 0x10, 0x01, 0x2B,
+    0x01, 0x0E, 0x01, 0x2D, 0x02, 0x0A, 0x02, 0x19, 0x01, 0x16, 0x04, 0x03,
+    0x03, 0x36, 0x03, 0x1F, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x3C,
+    0x01, 0x1F, 0x01, 0x1C, 0x01, 0x1D, 0x01, 0x1E, 0x01, 0x1B, 0x01, 0x20,
+    0x02, 0x18, 0x01, 0x23, 0x01, 0x16, 0x01, 0x25, 0x03, 0x11, 0x02, 0x29,
+    0x03, 0x0A, 0x04, 0x2E, 0x0A, 0x1C, 0x08, 0x01, 0x11, 0x08, 0x03, 0x08,
+    0x01, 0x18, 0x01, 0x1D, 0x01, 0x04, 0x02, 0x22, 0x01, 0x48, 0x01, 0x23,
+    0x01, 0x23, 0x01, 0x9D, 0x03, 0x0C, 0x17, 0x02, 0x22, 0x01, 0x23, 0x01,
+    0x23, 0x01, 0x23, 0x01, 0x48, 0x01, 0x16, 0x0D, 0x27, 0x04, 0x0D, 0x04,
+    0x21, 0x02, 0x15, 0x03, 0x1C, 0x02, 0x1A, 0x02, 0x18, 0x02, 0x1E, 0x02,
+    0x15, 0x01, 0x22, 0x01, 0x12, 0x02, 0x24, 0x01, 0x10, 0x01, 0x27, 0x01,
+    0x0E, 0x01, 0x29, 0x01, 0x38, 0x01, 0x0B, 0x01, 0x2C, 0x01, 0x09, 0x01,
+    0x66, 0x01, 0x07, 0x01, 0x4D, 0x04, 0x17, 0x01, 0x05, 0x01, 0x13, 0x03,
+    0x04, 0x03, 0x2D, 0x01, 0x0A, 0x02, 0x13, 0x01, 0x16, 0x01, 0x24, 0x01,
+    0x20, 0x01, 0x28, 0x01, 0x0F, 0x01, 0x82, 0x01, 0x01, 0x95, 0x01, 0x13,
+    0x14, 0x01, 0x38, 0x01, 0x38, 0x01, 0x23, 0x01, 0x14, 0x01, 0x38, 0x02,
+    0x38, 0x02, 0x1F, 0x01, 0x18, 0x02, 0x38, 0x02, 0x1C, 0x01, 0x1B, 0x03,
+    0x38, 0x02, 0x18, 0x01, 0x1F, 0x03, 0x16, 0x01, 0x21, 0x02, 0x15, 0x01,
+    0x22, 0x01, 0x15, 0x01, 0x22, 0x02, 0x14, 0x01, 0x23, 0x02, 0x13, 0x02,
+    0x23, 0x01, 0x14, 0x01, 0x23, 0x01, 0x14, 0x02, 0x22, 0x01, 0x15, 0x02,
+    0x21, 0x01, 0x16, 0x02, 0x20, 0x01, 0x17, 0x02, 0x1F, 0x01, 0x18, 0x03,
+    0x1D, 0x01, 0x1A, 0x02, 0x38, 0x02, 0x1A, 0x01, 0x1D, 0x02, 0x38, 0x02,
+    0x38, 0x02, 0x38, 0x01, 0x14, 0x01, 0x23, 0x01, 0x38, 0x01, 0x13, 0x12,
+    0x13, 0x01, 0xF2, 0x01, 0x01, 0x11, 0x01, 0x4A, 0x01, 0x25, 0x01, 0x25,
+    0x01, 0x12, 0x01, 0x0F, 0x01, 0x12, 0x01, 0x15, 0x02, 0x0B, 0x02, 0x2B,
+    0x05, 0x02, 0x04, 0x18, 0x01, 0x19, 0x02, 0x18, 0x01, 0x04, 0x01, 0x69,
+    0x01, 0x06, 0x01, 0x2F, 0x01, 0x08, 0x01, 0x38, 0x01, 0x2C, 0x01, 0x0B,
+    0x01, 0x2A, 0x01, 0x0D, 0x01, 0x28, 0x01, 0x0F, 0x01, 0x26, 0x01, 0x11,
+    0x01, 0x23, 0x02, 0x13, 0x02, 0x20, 0x01, 0x17, 0x02, 0x1B, 0x03, 0x1A,
+    0x03, 0x16, 0x02, 0x20, 0x04, 0x0D, 0x05, 0x09, 0x13, 0xC9, 0x05, 0x09,
+    0x13, 0x0B, 0xFB, 0x03, 0x09, 0x13, 0x0B, 0x96, 0x0D, 0x01, 0x60, 0x01,
+    0x4E, 0x02, 0x27, 0x08, 0x58, 0x01, 0x75, 0x01, 0x4E, 0x01, 0x4E, 0x01,
+    0x27, 0x01, 0x27, 0x01, 0x27, 0x02, 0x27, 0x02, 0x12, 0x01, 0x14, 0x03,
+    0x0B, 0x04, 0x00, 0x12, 0x14, 0x12, 0x9A, 0x18, 0x01, 0x4A, 0x01, 0x5D,
+    0x01, 0x10, 0x01, 0x36, 0x01, 0x14, 0x01, 0x13, 0x01, 0x0D, 0x01, 0x2A,
+    0x02, 0x08, 0x03, 0x2D, 0x08, 0x52, 0x01, 0x70, 0x01, 0x70, 0x01, 0x70,
+    0x01, 0x21, 0x01, 0x16, 0x01, 0x1F, 0x01, 0x18, 0x01, 0x1D, 0x01, 0x1A,
+    0x01, 0x1B, 0x01, 0x1C, 0x01, 0x18, 0x02, 0x1E, 0x01, 0x16, 0x01, 0x21,
+    0x03, 0x11, 0x02, 0x25, 0x03, 0x0A, 0x04, 0x09, 0x11, 0x00, 0x14, 0x16,
+    0x14, 0x28, 0x01, 0x12, 0x01, 0xB8, 0x01, 0x01, 0x12, 0x01, 0x13, 0x01,
+    0x12, 0x01, 0x7D, 0x01, 0x37, 0x01, 0x17, 0x01, 0x4E, 0x01, 0x55, 0x01,
+    0x35, 0x01, 0x56, 0x01, 0x2A, 0x01, 0x21, 0x01, 0x4E, 0x01, 0x83, 0x01,
+    0x01, 0x11, 0x01, 0x0D, 0x01, 0x11, 0x01, 0x85, 0x01, 0x01, 0x4E, 0x01,
+    0x1D, 0x01, 0x2A, 0x01, 0x5C, 0x01, 0x2D, 0x01, 0x5D, 0x01, 0x46, 0x01,
+    0x21, 0x01, 0x2B, 0x01, 0x5F, 0x01, 0x2B, 0x01, 0x29, 0x01, 0x2B, 0x01,
+    0x9E, 0x01, 0x01, 0x10, 0x01, 0x16, 0x01, 0x2B, 0x01, 0x63, 0x01, 0x62,
+    0x01, 0x27, 0x01, 0x40, 0x01, 0x28, 0x01, 0x23, 0x01, 0x66, 0x01, 0x2C,
+    0x01, 0x4E, 0x01, 0x0F, 0x01, 0x95, 0x01, 0x01, 0x0F, 0x01, 0x0F, 0x01,
+    0xD4, 0x01, 0x01, 0x1D, 0x01, 0x99, 0x01, 0x01, 0x58, 0x01, 0x9B, 0x01,
+    0x01, 0x19, 0x01, 0x9D, 0x01, 0x01, 0x54, 0x01, 0x9F, 0x01, 0x01, 0x15,
+    0x01, 0xA1, 0x01, 0x01, 0x50, 0x01, 0xA3, 0x01, 0x01, 0x11, 0x01, 0x00,
+    0x12, 0x13, 0x0E, 0x13, 0x12, 0x57, 0x01, 0x24, 0x01, 0x20, 0x01, 0x6A,
+    0x01, 0x32, 0x01, 0x36, 0x01, 0x68, 0x01, 0x32, 0x01, 0x5A, 0x01, 0x42,
+    0x01, 0x47, 0x01, 0x45, 0x01, 0x48, 0x01, 0x41, 0x01, 0x5C, 0x01, 0x32,
+    0x01, 0x43, 0x01, 0x21, 0x01, 0x68, 0x01, 0x5E, 0x01, 0x10, 0x01, 0x21,
+    0x01, 0x99, 0x01, 0x01, 0x79, 0x01, 0x10, 0x01, 0x3B, 0x01, 0x24, 0x01,
+    0x10, 0x01, 0x61, 0x01, 0xC8, 0x01, 0x01, 0x19, 0x01, 0x46, 0x01, 0x1B,
+    0x01, 0x18, 0x01, 0x4F, 0x01, 0x7A, 0x01, 0x17, 0x01, 0x64, 0x01, 0x16,
+    0x01, 0x0D, 0x01, 0x14, 0x01, 0x9B, 0x01, 0x01, 0x0D, 0x01, 0x34, 0x01,
+    0x38, 0x01, 0x23, 0x01, 0x0D, 0x01, 0x34, 0x01, 0x7D, 0x01, 0x0D, 0x01,
+    0x03, 0x01, 0x67, 0x01, 0x23, 0x01, 0x0D, 0x01, 0x46, 0x01, 0x47, 0x01,
+    0x25, 0x01, 0x0D, 0x01, 0x8D, 0x01, 0x01, 0x0D, 0x01, 0x15, 0x01, 0x0F,
+    0x01, 0x6A, 0x01, 0x0F, 0x01, 0x15, 0x01, 0x0D, 0x01, 0x99, 0x01, 0x01,
+    0x7D, 0x01, 0x3A, 0x01, 0x31, 0x01, 0x73, 0x01, 0x7D, 0x01, 0x3C, 0x01,
+    0x31, 0x01, 0x71, 0x01, 0xBC, 0x01, 0x01, 0x18, 0x01, 0x70, 0x01, 0x17,
+    0x01, 0xBE, 0x01, 0x01, 0x6E, 0x01, 0x30, 0x01, 0x41, 0x01, 0x7E, 0x01,
+    0x6C, 0x01, 0x30, 0x01, 0x43, 0x01, 0x7E, 0x01, 0x9B, 0x01, 0x01, 0x26,
+    0x01, 0x76, 0x01, 0x26, 0x01, 0x99, 0x01, 0x01, 0x26, 0x01, 0x9F, 0x01,
+    0x01, 0x01, 0x14, 0x13, 0x14, 0x28, 0x01, 0x13, 0x01, 0x02, 0x01, 0x13,
+    0x01, 0x61, 0x01, 0x04, 0x01, 0x23, 0x01, 0x2C, 0x01, 0x22, 0x01, 0x06,
+    0x01, 0x21, 0x01, 0x2E, 0x01, 0x20, 0x01, 0x08, 0x01, 0x1F, 0x01, 0x12,
+    0x01, 0x1D, 0x01, 0x29, 0x01, 0x30, 0x01, 0x1F, 0x01, 0x09, 0x01, 0x1F,
+    0x01, 0x2E, 0x01, 0x21, 0x01, 0x07, 0x01, 0x21, 0x01, 0x2C, 0x01, 0x23,
+    0x01, 0x05, 0x01, 0x23, 0x01, 0x2A, 0x01, 0x25, 0x01, 0x29, 0x01, 0x16,
+    0x01, 0x11, 0x01, 0x27, 0x01, 0x29, 0x01, 0x14, 0x01, 0x11, 0x01, 0x29,
+    0x01, 0x29, 0x01, 0x24, 0x01, 0x55, 0x01, 0x22, 0x01, 0x57, 0x01, 0x20,
+    0x01, 0x3B, 0x01, 0x1D, 0x01, 0x5A, 0x01, 0x1F, 0x01, 0x58, 0x01, 0x21,
+    0x01, 0x56, 0x01, 0x23, 0x01, 0x54, 0x01, 0x25, 0x01, 0x52, 0x01, 0x27,
+    0x01, 0x3C, 0x01, 0x51, 0x01, 0x26, 0x01, 0x16, 0x01, 0x61, 0x01, 0x18,
+    0x01, 0x5F, 0x01, 0x1A, 0x01, 0x5D, 0x01, 0x1C, 0x01, 0x5B, 0x01, 0x1E,
+    0x01, 0x59, 0x01, 0x20, 0x01, 0x57, 0x01, 0x22, 0x01, 0x55, 0x01, 0x24,
+    0x01, 0x2A, 0x01, 0x28, 0x01, 0x12, 0x01, 0x13, 0x01, 0x51, 0x01, 0x12,
+    0x01, 0x02, 0x01, 0x12, 0x01, 0x4F, 0x01, 0x12, 0x01, 0x04, 0x01, 0x12,
+    0x01, 0x3D, 0x01, 0x0F, 0x01, 0x12, 0x01, 0x06, 0x01, 0x50, 0x01, 0x0D,
+    0x01, 0x12, 0x01, 0x08, 0x01, 0x50, 0x01, 0x0B, 0x01, 0x1D, 0x01, 0x1D,
+    0x01, 0x13, 0x01, 0x1E, 0x01, 0x29, 0x01, 0x1B, 0x01, 0x13, 0x01, 0x20,
+    0x01, 0x29, 0x01, 0x19, 0x01, 0x13, 0x01, 0x22, 0x01, 0x29, 0x01, 0x17,
+    0x01, 0x13, 0x01, 0x24, 0x01, 0x29, 0x01, 0x15, 0x01, 0x13, 0x01, 0x26,
+    0x01, 0x29, 0x01, 0x00, 0x14, 0x15, 0x14, 0x3C, 0x01, 0x3D, 0x01, 0x64,
+    0x01, 0x28, 0x01, 0x26, 0x01, 0x3F, 0x01, 0x75, 0x01, 0x17, 0x01, 0x11,
+    0x01, 0x17, 0x01, 0xB0, 0x01, 0x01, 0x29, 0x01, 0x19, 0x01, 0x12, 0x01,
+    0x5E, 0x01, 0x45, 0x01, 0x20, 0x01, 0x2E, 0x01, 0x5C, 0x01, 0x47, 0x01,
+    0x1E, 0x01, 0x4E, 0x01, 0x1E, 0x01, 0x2A, 0x01, 0x59, 0x01, 0x4E, 0x01,
+    0x20, 0x01, 0x2A, 0x01, 0x69, 0x01, 0x2A, 0x01, 0x22, 0x01, 0x4E, 0x01,
+    0x55, 0x01, 0x2A, 0x01, 0x24, 0x01, 0x4E, 0x01, 0x16, 0x01, 0x51, 0x01,
+    0x15, 0x01, 0x75, 0x01, 0x14, 0x01, 0x16, 0x01, 0x50, 0x01, 0x4D, 0x01,
+    0x55, 0x01, 0x10, 0x01, 0x3D, 0x01, 0x4D, 0x01, 0x1A, 0x01, 0x9A, 0x01,
+    0x01, 0x59, 0x01, 0x98, 0x01, 0x01, 0x1E, 0x01, 0x96, 0x01, 0x01, 0x5D,
+    0x01, 0x94, 0x01, 0x01, 0x22, 0x01, 0x92, 0x01, 0x01, 0x61, 0x01, 0x90,
+    0x01, 0x01, 0x26, 0x01, 0x8E, 0x01, 0x01, 0x65, 0x01, 0x8C, 0x01, 0x01,
+    0x2A, 0x01, 0x8A, 0x01, 0x01, 0x68, 0x01, 0x89, 0x01, 0x01, 0x2B, 0x01,
+    0x89, 0x01, 0x01, 0x2B, 0x01, 0x78, 0x01, 0x4D, 0x01, 0x2A, 0x01, 0x3B,
+    0x01, 0x3A, 0x02, 0x12, 0x01, 0x20, 0x08, 0x50, 0x01, 0xB5, 0x01, 0x01,
+    0x3B, 0x01, 0x78, 0x01, 0x3B, 0x01, 0x78, 0x01, 0x3B, 0x01, 0x3A, 0x02,
+    0x3A, 0x01, 0x3A, 0x02, 0x2B, 0x03, 0x0A, 0x03, 0x01, 0x34, 0xBD, 0x05,
+    0x01, 0x38, 0x1E, 0x14, 0x01, 0x34, 0x01, 0x21, 0x01, 0x48, 0x01, 0x21,
+    0x01, 0x34, 0x01, 0x13, 0x01, 0x34, 0x01, 0x21, 0x01, 0x48, 0x01, 0x21,
+    0x01, 0x12, 0x01, 0x21, 0x01, 0x48, 0x01, 0x21, 0x01, 0x34, 0x01, 0x13,
+    0x01, 0x34, 0x01, 0x21, 0x01, 0x48, 0x01, 0x21, 0x01, 0x12, 0x01, 0x21,
+    0x01, 0x48, 0x01, 0x21, 0x01, 0x34, 0x01, 0x13, 0x01, 0x34, 0x01, 0x21,
+    0x01, 0x48, 0x01, 0x21, 0x01, 0x12, 0x01, 0x21, 0x01, 0x48, 0x01, 0x21,
+    0x01, 0x34, 0x01, 0x13, 0x01, 0x34, 0x01, 0x21, 0x01, 0x48, 0x01, 0x21,
+    0x01, 0x12, 0x01, 0x21, 0x01, 0x48, 0x01, 0x21, 0x01, 0x34, 0x01, 0x13,
+    0x01, 0x34, 0x01, 0x21, 0x01, 0x48, 0x01, 0x21, 0x01, 0x12, 0x01, 0x21,
+    0x01, 0x48, 0x01, 0x21, 0x01, 0x34, 0x01, 0x13, 0x01, 0x34, 0x01, 0x21,
+    0x01, 0x49, 0x20, 0x01, 0x01, 0x34, 0x01, 0x20, 0x01, 0x20, 0x03, 0x1F,
+    0x02, 0x04, 0x01, 0x1B, 0x02, 0x20, 0x02, 0x21, 0x01, 0x0B, 0x01, 0x16,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x0F, 0x01, 0x12, 0x01, 0x22, 0x01, 0x35,
+    0x01, 0x10, 0x01, 0x11, 0x01, 0x10, 0x01, 0x10, 0x02, 0x34, 0x01, 0x10,
+    0x01, 0x22, 0x01, 0x12, 0x01, 0x57, 0x01, 0x12, 0x01, 0x7B, 0x01, 0x36,
+    0x01, 0x93, 0x07, 0x01, 0x36, 0x01, 0x8E, 0x01, 0x01, 0x10, 0x01, 0x59,
+    0x01, 0x10, 0x01, 0x11, 0x01, 0x22, 0x01, 0x21, 0x02, 0x12, 0x01, 0x0B,
+    0x04, 0x13, 0x01, 0x46, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x21,
+    0x02, 0x46, 0x01, 0x24, 0x02, 0x24, 0x01, 0x24, 0x01, 0x48, 0x01, 0x0D,
+    0x04, 0x13, 0x01, 0x10, 0x02, 0x24, 0x01, 0x11, 0x01, 0x12, 0x01, 0x35,
+    0x01, 0x12, 0x01, 0x48, 0x01, 0x10, 0x01, 0x7F, 0x01, 0x58, 0x01, 0x97,
+    0x07, 0x01, 0x7C, 0x01, 0x37, 0x01, 0x34, 0x01, 0x37, 0x01, 0x10, 0x01,
+    0x37, 0x01, 0x10, 0x01, 0x24, 0x01, 0x12, 0x01, 0x11, 0x01, 0x12, 0x01,
+    0x11, 0x01, 0x24, 0x01, 0x11, 0x01, 0x24, 0x01, 0x24, 0x01, 0x0F, 0x01,
+    0x14, 0x01, 0x24, 0x01, 0x24, 0x02, 0x0A, 0x01, 0x19, 0x01, 0x24, 0x02,
+    0x24, 0x02, 0x04, 0x01, 0x1F, 0x02, 0x00, 0x0D, 0x03, 0x02, 0x24, 0x02,
+    0x1F, 0x01, 0x04, 0x02, 0x24, 0x02, 0x24, 0x02, 0x18, 0x01, 0x0B, 0x01,
+    0x24, 0x01, 0x24, 0x01, 0x14, 0x01, 0x0F, 0x01, 0x24, 0x01, 0x24, 0x01,
+    0x11, 0x01, 0x12, 0x01, 0x11, 0x01, 0x24, 0x01, 0x11, 0x01, 0x12, 0x01,
+    0x24, 0x01, 0x10, 0x01, 0x13, 0x01, 0x34, 0x01, 0x37, 0x01, 0x34, 0x01,
+    0x37, 0x01, 0x58, 0x01, 0xF3, 0x06, 0x01, 0x7C, 0x01, 0x7F, 0x01, 0x10,
+    0x01, 0x5B, 0x01, 0x10, 0x01, 0x24, 0x01, 0x12, 0x01, 0x11, 0x01, 0x24,
+    0x02, 0x10, 0x01, 0x13, 0x04, 0x31, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24,
+    0x01, 0x24, 0x02, 0x47, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x13, 0x04, 0x1E, 0x02, 0x0F, 0x01, 0x11,
+    0x01, 0x22, 0x01, 0x11, 0x01, 0x34, 0x01, 0x35, 0x01, 0x10, 0x01, 0x8E,
+    0x01, 0x01, 0x5A, 0x01, 0x93, 0x07, 0x01, 0x5A, 0x01, 0x57, 0x01, 0x12,
+    0x01, 0x57, 0x01, 0x12, 0x01, 0x22, 0x01, 0x10, 0x01, 0x11, 0x01, 0x22,
+    0x01, 0x11, 0x01, 0x10, 0x01, 0x11, 0x01, 0x10, 0x01, 0x35, 0x01, 0x22,
+    0x01, 0x12, 0x01, 0x0F, 0x01, 0x22, 0x01, 0x22, 0x01, 0x16, 0x01, 0x0A,
+    0x02, 0x21, 0x01, 0x21, 0x02, 0x1B, 0x01, 0x04, 0x02, 0x20, 0x02, 0x10,
+    0x08, 0x39, 0x03, 0x08, 0x03, 0x34, 0x02, 0x0E, 0x02, 0x19, 0x0E, 0x0A,
+    0x01, 0x12, 0x02, 0x24, 0x01, 0x08, 0x02, 0x15, 0x01, 0x2B, 0x01, 0x18,
+    0x01, 0x44, 0x01, 0x13, 0x01, 0x14, 0x01, 0x1B, 0x01, 0x26, 0x01, 0x1D,
+    0x01, 0x24, 0x01, 0x1F, 0x01, 0x44, 0x01, 0x0E, 0x01, 0x12, 0x01, 0x22,
+    0x01, 0x50, 0x01, 0x0E, 0x01, 0x03, 0x01, 0x24, 0x01, 0x44, 0x02, 0x08,
+    0x01, 0x3B, 0x01, 0x06, 0x01, 0x13, 0x01, 0x10, 0x06, 0x13, 0x06, 0x10,
+    0x01, 0x13, 0x01, 0x06, 0x02, 0x3A, 0x01, 0x09, 0x01, 0x25, 0x01, 0x1E,
+    0x01, 0x28, 0x01, 0x0E, 0x01, 0x0C, 0x01, 0x66, 0x01, 0x12, 0x01, 0x0E,
+    0x01, 0x20, 0x01, 0x23, 0x01, 0x44, 0x01, 0x1D, 0x01, 0x26, 0x01, 0x1B,
+    0x01, 0x28, 0x01, 0x19, 0x01, 0x2A, 0x01, 0x17, 0x01, 0x2C, 0x01, 0x15,
+    0x01, 0x0A, 0x0E, 0x16, 0x02, 0x12, 0x01, 0x31, 0x02, 0x0E, 0x02, 0x34,
+    0x02, 0x09, 0x03};
+
+static const GFXglyph Roboto_Condensed_SemiBold75pt7bRLEGlyphs[] = {
+    {0, 1, 1, 34, 0, 0},           // 0x20 ' '
+    {0, 21, 106, 38, 9, -104},     // 0x21 '!'
+    {59, 36, 39, 47, 6, -109},     // 0x22 '"'
+    {78, 68, 105, 78, 6, -104},    // 0x23 '#'
+    {217, 60, 136, 74, 7, -120},   // 0x24 '$'
+    {523, 80, 107, 94, 7, -105},   // 0x25 '%'
+    {974, 76, 108, 84, 6, -105},   // 0x26 '&'
+    {1363, 14, 38, 24, 5, -109},   // 0x27 '''
+    {1371, 34, 150, 47, 9, -116},  // 0x28 '('
+    {1576, 35, 150, 47, 4, -116},  // 0x29 ')'
+    {1783, 63, 63, 66, 2, -104},   // 0x2A '*'
+    {2011, 60, 76, 71, 5, -86},    // 0x2B '+'
+    {2023, 24, 42, 34, 2, -16},    // 0x2C ','
+    {2078, 33, 15, 49, 8, -51},    // 0x2D '-'
+    {2080, 22, 21, 42, 9, -19},    // 0x2E '.'
+    {2126, 47, 114, 50, 0, -104},  // 0x2F '/'
+    {2285, 60, 107, 74, 7, -105},  // 0x30 '0'
+    {2497, 39, 105, 74, 11, -104}, // 0x31 '1'
+    {2548, 62, 106, 74, 6, -105},  // 0x32 '2'
+    {2802, 61, 107, 74, 5, -105},  // 0x33 '3'
+    {3074, 65, 105, 74, 4, -104},  // 0x34 '4'
+    {3210, 60, 106, 74, 8, -104},  // 0x35 '5'
+    {3411, 60, 106, 74, 8, -104},  // 0x36 '6'
+    {3680, 63, 105, 74, 5, -104},  // 0x37 '7'
+    {3831, 59, 107, 74, 7, -105},  // 0x38 '8'
+    {4158, 59, 106, 74, 7, -105},  // 0x39 '9'
+    {4427, 22, 81, 39, 9, -79},    // 0x3A ':'
+    {4522, 26, 105, 36, 4, -79},   // 0x3B ';'
+    {4627, 51, 68, 66, 5, -78},    // 0x3C '<'
+    {4795, 53, 47, 73, 10, -70},   // 0x3D '='
+    {4803, 53, 68, 67, 9, -78},    // 0x3E '>'
+    {4971, 55, 107, 65, 4, -105},  // 0x3F '?'
+    {5184, 101, 135, 113, 6, -101}, // 0x40 '@'
+    {5769, 83, 105, 87, 2, -104},  // 0x41 'A'
+    {5998, 66, 105, 82, 9, -104},  // 0x42 'B'
+    {6184, 72, 107, 84, 7, -105},  // 0x43 'C'
+    {6427, 67, 105, 83, 9, -104},  // 0x44 'D'
+    {6572, 59, 105, 72, 9, -104},  // 0x45 'E'
+    {6586, 57, 105, 70, 9, -104},  // 0x46 'F'
+    {6597, 72, 107, 86, 7, -105},  // 0x47 'G'
+    {6826, 72, 105, 90, 9, -104},  // 0x48 'H'
+    {6836, 19, 105, 39, 10, -104}, // 0x49 'I'
+    {6838, 59, 106, 72, 4, -104},  // 0x4A 'J'
+    {6937, 72, 105, 81, 9, -104},  // 0x4B 'K'
+    {7185, 57, 105, 70, 9, -104},  // 0x4C 'L'
+    {7190, 93, 105, 111, 9, -104}, // 0x4D 'M'
+    {7403, 72, 105, 90, 9, -104},  // 0x4E 'N'
+    {7580, 74, 107, 89, 7, -105},  // 0x4F 'O'
+    {7843, 69, 105, 83, 9, -104},  // 0x50 'P'
+    {7963, 75, 124, 89, 7, -105},  // 0x51 'Q'
+    {8299, 69, 105, 81, 9, -104},  // 0x52 'R'
+    {8472, 67, 107, 79, 6, -105},  // 0x53 'S'
+    {8800, 71, 105, 79, 4, -104},  // 0x54 'T'
+    {8807, 68, 106, 84, 8, -104},  // 0x55 'U'
+    {8912, 81, 105, 84, 2, -104},  // 0x56 'V'
+    {9130, 103, 105, 111, 4, -104}, // 0x57 'W'
+    {9391, 76, 105, 82, 3, -104},  // 0x58 'X'
+    {9727, 77, 105, 79, 1, -104},  // 0x59 'Y'
+    {9916, 67, 105, 78, 6, -104},  // 0x5A 'Z'
+    {10099, 27, 145, 38, 8, -120}, // 0x5B '['
+    {10107, 56, 114, 56, 1, -104}, // 0x5C '\'
+    {10268, 27, 145, 38, 2, -120}, // 0x5D ']'
+    {10276, 49, 52, 57, 4, -104},  // 0x5E '^'
+    {10390, 55, 15, 59, 2, 1},     // 0x5F '_'
+    {10392, 35, 22, 48, 4, -109},  // 0x60 '`'
+    {10460, 58, 80, 70, 6, -78},   // 0x61 'a'
+    {10653, 59, 111, 73, 8, -109}, // 0x62 'b'
+    {10803, 57, 80, 68, 6, -78},   // 0x63 'c'
+    {10989, 60, 111, 73, 5, -109}, // 0x64 'd'
+    {11138, 59, 80, 70, 6, -78},   // 0x65 'e'
+    {11345, 43, 112, 48, 3, -111}, // 0x66 'f'
+    {11397, 61, 110, 74, 5, -78},  // 0x67 'g'
+    {11637, 56, 110, 72, 8, -109}, // 0x68 'h'
+    {11706, 20, 108, 36, 8, -107}, // 0x69 'i'
+    {11754, 31, 139, 35, -3, -107}, // 0x6A 'j'
+    {11836, 61, 110, 69, 8, -109}, // 0x6B 'k'
+    {12017, 18, 110, 36, 9, -109}, // 0x6C 'l'
+    {12019, 93, 79, 109, 8, -78},  // 0x6D 'm'
+    {12141, 56, 79, 72, 8, -78},   // 0x6E 'n'
+    {12209, 62, 80, 73, 6, -78},   // 0x6F 'o'
+    {12422, 59, 109, 73, 8, -78},  // 0x70 'p'
+    {12572, 60, 109, 73, 5, -78},  // 0x71 'q'
+    {12725, 37, 79, 48, 8, -78},   // 0x72 'r'
+    {12762, 56, 80, 67, 5, -78},   // 0x73 's'
+    {13015, 39, 98, 45, 2, -96},   // 0x74 't'
+    {13058, 56, 79, 72, 8, -77},   // 0x75 'u'
+    {13125, 61, 78, 65, 2, -77},   // 0x76 'v'
+    {13271, 88, 78, 94, 3, -77},   // 0x77 'w'
+    {13477, 61, 78, 66, 3, -77},   // 0x78 'x'
+    {13719, 61, 109, 65, 2, -77},  // 0x79 'y'
+    {13916, 54, 78, 66, 6, -77},   // 0x7A 'z'
+    {14047, 36, 141, 44, 4, -114}, // 0x7B '{'
+    {14226, 13, 124, 37, 12, -104}, // 0x7C '|'
+    {14228, 36, 141, 44, 4, -114}, // 0x7D '}'
+    {14411, 68, 32, 83, 8, -58}};  // 0x7E '~'
+
+const GFXfontRLE Roboto_Condensed_SemiBold75pt7bRLE = {
+    {(uint8_t *)Roboto_Condensed_SemiBold75pt7bRLEBitmaps,
+     (GFXglyph *)Roboto_Condensed_SemiBold75pt7bRLEGlyphs,
+     0x20, 0x7E, 172},
+    64552, 14547,
+    NULL, 0};
+
+static const uint8_t Roboto_Condensed_SemiBold60pt7bRLEBitmaps[] = {
+    0x01, 0x0F, 0xEF, 0x03, 0x01, 0x1E, 0x01, 0xCE, 0x03, 0x0D, 0xA0, 0x01,
+    0x07, 0x09, 0x01, 0x07, 0x02, 0x05, 0x02, 0x0A, 0x01, 0x14, 0x01, 0x0D,
+    0x01, 0x22, 0x02, 0x21, 0x01, 0x20, 0x01, 0x12, 0x01, 0x0D, 0x01, 0x14,
+    0x02, 0x0A, 0x01, 0x06, 0x01, 0x07, 0x02, 0x00, 0x0B, 0x07, 0x0A, 0xCE,
+    0x01, 0x01, 0xB2, 0x02, 0x01, 0x11, 0x01, 0x84, 0x02, 0x01, 0x11, 0x01,
+    0x14, 0x09, 0x09, 0x0A, 0x35, 0x01, 0x4F, 0x01, 0x47, 0x01, 0x62, 0x01,
+    0x7D, 0x01, 0x4F, 0x01, 0x47, 0x01, 0x62, 0x01, 0x47, 0x01, 0x4F, 0x01,
+    0x7D, 0x01, 0x62, 0x01, 0x47, 0x01, 0x4F, 0x01, 0x29, 0x0C, 0x0A, 0x09,
+    0x09, 0x0A, 0xEA, 0x03, 0x0B, 0x09, 0x09, 0x09, 0x0C, 0x44, 0x01, 0x47,
+    0x01, 0x98, 0x01, 0x01, 0x47, 0x01, 0x4F, 0x01, 0x47, 0x01, 0x62, 0x01,
+    0x7D, 0x01, 0x19, 0x01, 0x5F, 0x0C, 0x0A, 0x09, 0x09, 0x0A, 0xEA, 0x03,
+    0x0B, 0x09, 0x09, 0x09, 0x0C, 0x44, 0x01, 0x47, 0x01, 0x62, 0x01, 0x47,
+    0x01, 0x4F, 0x01, 0x7D, 0x01, 0x62, 0x01, 0x47, 0x01, 0x4F, 0x01, 0x47,
+    0x01, 0x62, 0x01, 0x7D, 0x01, 0x19, 0x01, 0x15, 0x09, 0xB6, 0x04, 0x01,
+    0x2B, 0x04, 0x0A, 0x03, 0x1D, 0x02, 0x11, 0x03, 0x18, 0x02, 0x16, 0x01,
+    0x16, 0x01, 0x19, 0x02, 0x12, 0x02, 0x1C, 0x01, 0x10, 0x01, 0x1F, 0x01,
+    0x0E, 0x01, 0x21, 0x01, 0x30, 0x01, 0x0B, 0x01, 0x2E, 0x01, 0x25, 0x01,
+    0x38, 0x01, 0x13, 0x01, 0x13, 0x01, 0x18, 0x03, 0x01, 0x03, 0x28, 0x01,
+    0x07, 0x01, 0x10, 0x01, 0x05, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x24, 0x01,
+    0x0B, 0x01, 0x60, 0x01, 0x0E, 0x01, 0x12, 0x01, 0x20, 0x01, 0xAD, 0x01,
+    0x01, 0x6E, 0x01, 0x32, 0x01, 0x0E, 0x01, 0x0F, 0x0F, 0x42, 0x01, 0x60,
+    0x01, 0x1F, 0x01, 0x10, 0x01, 0x30, 0x01, 0x30, 0x02, 0x1C, 0x01, 0x13,
+    0x01, 0x1C, 0x01, 0x13, 0x02, 0x30, 0x02, 0x19, 0x01, 0x16, 0x02, 0x18,
+    0x01, 0x17, 0x02, 0x17, 0x01, 0x18, 0x02, 0x16, 0x01, 0x19, 0x01, 0x16,
+    0x01, 0x19, 0x02, 0x15, 0x01, 0x1A, 0x01, 0x15, 0x02, 0x19, 0x01, 0x16,
+    0x01, 0x19, 0x01, 0x16, 0x02, 0x18, 0x01, 0x17, 0x02, 0x17, 0x01, 0x18,
+    0x02, 0x16, 0x01, 0x19, 0x02, 0x30, 0x02, 0x13, 0x01, 0x1C, 0x02, 0x30,
+    0x01, 0x11, 0x01, 0x1E, 0x01, 0x30, 0x01, 0x10, 0x01, 0x1F, 0x01, 0x60,
+    0x01, 0x40, 0x0E, 0x42, 0x01, 0x0E, 0x01, 0x3E, 0x01, 0xB0, 0x01, 0x01,
+    0x20, 0x01, 0x1E, 0x01, 0x20, 0x01, 0x3F, 0x01, 0x0E, 0x01, 0x41, 0x01,
+    0x0F, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x13, 0x02, 0x08, 0x02, 0x26, 0x03,
+    0x01, 0x04, 0x16, 0x01, 0x14, 0x01, 0x15, 0x01, 0x05, 0x01, 0x58, 0x01,
+    0x07, 0x01, 0x26, 0x01, 0x09, 0x01, 0x24, 0x01, 0x0B, 0x01, 0x30, 0x01,
+    0x20, 0x02, 0x0E, 0x01, 0x1E, 0x01, 0x11, 0x02, 0x1B, 0x01, 0x14, 0x01,
+    0x18, 0x02, 0x16, 0x03, 0x13, 0x02, 0x1B, 0x04, 0x0B, 0x04, 0x21, 0x01,
+    0x08, 0x02, 0x0B, 0x09, 0x34, 0x03, 0x09, 0x02, 0x31, 0x01, 0x0E, 0x02,
+    0x2D, 0x02, 0x11, 0x01, 0x2B, 0x01, 0x14, 0x01, 0x29, 0x01, 0x16, 0x01,
+    0x40, 0x01, 0x26, 0x01, 0x59, 0x01, 0x24, 0x01, 0x0B, 0x04, 0x1C, 0x01,
+    0x1E, 0x01, 0x04, 0x02, 0x0A, 0x01, 0x0E, 0x01, 0x01, 0x02, 0x10, 0x01,
+    0x0A, 0x01, 0x24, 0x02, 0x18, 0x01, 0x08, 0x01, 0x17, 0x01, 0x06, 0x01,
+    0x40, 0x01, 0x36, 0x01, 0x29, 0x01, 0x09, 0x01, 0x14, 0x01, 0x35, 0x01,
+    0x48, 0x01, 0x35, 0x01, 0x48, 0x01, 0x35, 0x01, 0x48, 0x01, 0x35, 0x01,
+    0x48, 0x01, 0x24, 0x01, 0x09, 0x01, 0x06, 0x01, 0x3E, 0x01, 0x09, 0x01,
+    0x1B, 0x01, 0x22, 0x01, 0x25, 0x01, 0x0F, 0x01, 0x1C, 0x01, 0x0A, 0x01,
+    0x20, 0x01, 0x1F, 0x01, 0x04, 0x02, 0x0A, 0x01, 0x04, 0x01, 0x1E, 0x01,
+    0x0B, 0x04, 0x1A, 0x01, 0x30, 0x01, 0x04, 0x01, 0x20, 0x01, 0x27, 0x01,
+    0x30, 0x01, 0x04, 0x01, 0x22, 0x01, 0x16, 0x01, 0x0E, 0x01, 0x1A, 0x01,
+    0x14, 0x01, 0x05, 0x01, 0x25, 0x02, 0x11, 0x01, 0x0F, 0x01, 0x1E, 0x01,
+    0x0E, 0x02, 0x06, 0x01, 0x29, 0x03, 0x08, 0x03, 0x11, 0x01, 0x23, 0x08,
+    0x0A, 0x01, 0x48, 0x01, 0x35, 0x01, 0x48, 0x01, 0x35, 0x01, 0x3E, 0x01,
+    0x09, 0x01, 0x3E, 0x01, 0x35, 0x01, 0x48, 0x01, 0x09, 0x09, 0x23, 0x01,
+    0x11, 0x02, 0x09, 0x03, 0x29, 0x01, 0x06, 0x02, 0x0E, 0x01, 0x1E, 0x01,
+    0x0F, 0x01, 0x11, 0x02, 0x25, 0x01, 0x05, 0x01, 0x14, 0x01, 0x1A, 0x01,
+    0x0E, 0x01, 0x39, 0x01, 0x04, 0x01, 0x17, 0x01, 0x18, 0x01, 0x0D, 0x01,
+    0x19, 0x01, 0x20, 0x01, 0x35, 0x01, 0x0D, 0x01, 0x0B, 0x05, 0x0B, 0x01,
+    0x1E, 0x01, 0x0F, 0x01, 0x05, 0x01, 0x1F, 0x01, 0x18, 0x01, 0x07, 0x01,
+    0x27, 0x01, 0x35, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01,
+    0x1B, 0x01, 0x35, 0x01, 0x3E, 0x01, 0x09, 0x01, 0x3E, 0x01, 0x35, 0x01,
+    0x48, 0x01, 0x35, 0x01, 0x48, 0x01, 0x35, 0x01, 0x48, 0x01, 0x35, 0x01,
+    0x48, 0x01, 0x15, 0x01, 0x1F, 0x01, 0x15, 0x01, 0x13, 0x01, 0x09, 0x01,
+    0x14, 0x01, 0x17, 0x01, 0x1E, 0x02, 0x27, 0x01, 0x18, 0x02, 0x04, 0x01,
+    0x19, 0x02, 0x04, 0x01, 0x1B, 0x01, 0x12, 0x01, 0x0C, 0x04, 0x0B, 0x01,
+    0x11, 0x03, 0x50, 0x01, 0x19, 0x01, 0x26, 0x01, 0x17, 0x01, 0x28, 0x01,
+    0x40, 0x01, 0x14, 0x01, 0x2B, 0x01, 0x11, 0x02, 0x2D, 0x02, 0x0E, 0x01,
+    0x31, 0x02, 0x09, 0x03, 0x14, 0x0A, 0x30, 0x03, 0x0A, 0x03, 0x2B, 0x02,
+    0x10, 0x02, 0x27, 0x02, 0x14, 0x01, 0x25, 0x01, 0x17, 0x01, 0x23, 0x01,
+    0x19, 0x01, 0x21, 0x01, 0x1B, 0x01, 0x1F, 0x01, 0x1D, 0x01, 0x3D, 0x01,
+    0x1C, 0x01, 0x5D, 0x01, 0x1A, 0x01, 0x4D, 0x02, 0x10, 0x01, 0x28, 0x02,
+    0x02, 0x02, 0x27, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x34, 0x01, 0x08, 0x01,
+    0x3D, 0x01, 0x31, 0x01, 0x17, 0x01, 0x53, 0x01, 0x9F, 0x01, 0x01, 0x90,
+    0x01, 0x01, 0x18, 0x01, 0x31, 0x01, 0x46, 0x01, 0x0C, 0x01, 0x63, 0x01,
+    0x07, 0x01, 0x0C, 0x01, 0x19, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x3A, 0x01,
+    0x0E, 0x01, 0x1B, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x3B, 0x01, 0x0F, 0x01,
+    0x1D, 0x01, 0x1D, 0x01, 0x3B, 0x01, 0x20, 0x01, 0x1A, 0x01, 0x3B, 0x01,
+    0x23, 0x01, 0x17, 0x01, 0x3B, 0x01, 0x26, 0x01, 0x14, 0x01, 0x3A, 0x02,
+    0x28, 0x01, 0x3B, 0x01, 0x3B, 0x01, 0x14, 0x01, 0x26, 0x01, 0x16, 0x01,
+    0x0B, 0x0D, 0x0C, 0x01, 0x18, 0x01, 0x22, 0x01, 0x3B, 0x01, 0x1B, 0x01,
+    0x1F, 0x01, 0x1D, 0x01, 0x5A, 0x01, 0x0E, 0x01, 0x10, 0x01, 0x1B, 0x01,
+    0x0E, 0x01, 0x01, 0x01, 0x10, 0x01, 0x2C, 0x01, 0x10, 0x01, 0x18, 0x01,
+    0x0E, 0x01, 0x04, 0x01, 0x14, 0x01, 0x0C, 0x01, 0x2B, 0x01, 0x25, 0x01,
+    0x06, 0x01, 0x10, 0x01, 0x15, 0x01, 0x16, 0x01, 0x4D, 0x02, 0x2B, 0x01,
+    0x3D, 0x01, 0x1C, 0x01, 0x14, 0x01, 0x48, 0x01, 0x3D, 0x01, 0x19, 0x01,
+    0x15, 0x01, 0x0D, 0x01, 0x7A, 0x01, 0x16, 0x01, 0x26, 0x01, 0x51, 0x01,
+    0x18, 0x01, 0x0F, 0x01, 0x2D, 0x01, 0x0F, 0x01, 0x11, 0x01, 0x0A, 0x01,
+    0x1F, 0x01, 0x2D, 0x01, 0x0D, 0x01, 0x12, 0x01, 0x1C, 0x02, 0x09, 0x02,
+    0x14, 0x01, 0x0A, 0x01, 0x12, 0x03, 0x02, 0x04, 0x37, 0x02, 0x1B, 0x01,
+    0x0A, 0x01, 0x32, 0x01, 0x0A, 0x01, 0x32, 0x01, 0x47, 0x01, 0x32, 0x01,
+    0x0A, 0x01, 0x32, 0x01, 0x0A, 0x01, 0x3D, 0x01, 0x1E, 0x03, 0x10, 0x01,
+    0x0B, 0x02, 0x1B, 0x01, 0x03, 0x01, 0x10, 0x01, 0x0C, 0x01, 0x18, 0x02,
+    0x05, 0x01, 0x1D, 0x03, 0x12, 0x03, 0x18, 0x01, 0x0F, 0x03, 0x0B, 0x04,
+    0x0B, 0x11, 0x00, 0x0C, 0x6B, 0x01, 0xB2, 0x01, 0x01, 0x18, 0x01, 0x1A,
+    0x01, 0x19, 0x02, 0x02, 0x01, 0x16, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x07,
+    0x01, 0x12, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x0B, 0x01, 0x1B, 0x01, 0x0E,
+    0x01, 0x0B, 0x01, 0x0E, 0x01, 0x0B, 0x01, 0x1A, 0x01, 0x0F, 0x01, 0x1A,
+    0x01, 0x0B, 0x01, 0x1A, 0x01, 0x0F, 0x01, 0x26, 0x01, 0x0F, 0x01, 0x26,
+    0x01, 0x0F, 0x01, 0x26, 0x01, 0x0F, 0x01, 0x26, 0x01, 0x0F, 0x01, 0x42,
+    0x01, 0x0F, 0x01, 0x42, 0x01, 0x0F, 0x01, 0x52, 0x01, 0x0B, 0x01, 0x62,
+    0x01, 0x27, 0x01, 0x62, 0x01, 0x7B, 0x01, 0x46, 0x01, 0xE7, 0x04, 0x01,
+    0x60, 0x01, 0x63, 0x01, 0x7C, 0x01, 0x0F, 0x01, 0x70, 0x01, 0x0B, 0x01,
+    0x48, 0x01, 0x27, 0x01, 0x2C, 0x01, 0x27, 0x01, 0x2C, 0x01, 0x27, 0x01,
+    0x10, 0x01, 0x27, 0x01, 0x10, 0x01, 0x27, 0x01, 0x10, 0x01, 0x27, 0x01,
+    0x10, 0x01, 0x27, 0x01, 0x10, 0x01, 0x1C, 0x01, 0x0A, 0x01, 0x1C, 0x01,
+    0x10, 0x01, 0x0B, 0x01, 0x10, 0x01, 0x27, 0x01, 0x10, 0x01, 0x1C, 0x01,
+    0x1C, 0x01, 0x1C, 0x01, 0x07, 0x01, 0x14, 0x01, 0x1C, 0x01, 0x1C, 0x02,
+    0x02, 0x01, 0x19, 0x01, 0x03, 0x01, 0x1A, 0x01, 0x01, 0x01, 0x1C, 0x02,
+    0x1C, 0x01, 0x15, 0x01, 0x06, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0x11, 0x01,
+    0x0A, 0x01, 0x1C, 0x01, 0x0F, 0x01, 0x1C, 0x01, 0x0B, 0x01, 0x10, 0x01,
+    0x0B, 0x01, 0x10, 0x01, 0x27, 0x01, 0x10, 0x01, 0x0B, 0x01, 0x2C, 0x01,
+    0x0B, 0x01, 0x10, 0x01, 0x27, 0x01, 0x10, 0x01, 0x0B, 0x01, 0x38, 0x01,
+    0x0F, 0x01, 0x38, 0x01, 0x0B, 0x01, 0x38, 0x01, 0x0F, 0x01, 0x44, 0x01,
+    0x0F, 0x01, 0x44, 0x01, 0x2B, 0x01, 0x28, 0x01, 0x7F, 0x01, 0x0C, 0x01,
+    0x8C, 0x01, 0x01, 0x46, 0x01, 0x9F, 0x05, 0x01, 0x60, 0x01, 0x99, 0x01,
+    0x01, 0x0C, 0x01, 0x6E, 0x01, 0x0E, 0x01, 0x43, 0x01, 0x2A, 0x01, 0x27,
+    0x01, 0x2A, 0x01, 0x27, 0x01, 0x2A, 0x01, 0x0B, 0x01, 0x46, 0x01, 0x0B,
+    0x01, 0x2A, 0x01, 0x0B, 0x01, 0x2A, 0x01, 0x0B, 0x01, 0x1A, 0x01, 0x0F,
+    0x01, 0x1A, 0x01, 0x0B, 0x01, 0x1A, 0x01, 0x0F, 0x01, 0x1A, 0x01, 0x0B,
+    0x01, 0x0E, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x27, 0x01, 0x0F, 0x01, 0x0A,
+    0x01, 0x1A, 0x01, 0x1A, 0x01, 0x13, 0x01, 0x06, 0x01, 0x1A, 0x01, 0x19,
+    0x02, 0x17, 0x01, 0x01, 0x01, 0x14, 0x0A, 0xEF, 0x04, 0x02, 0x29, 0x01,
+    0x05, 0x01, 0x02, 0x02, 0x25, 0x02, 0x0B, 0x03, 0x1F, 0x03, 0x10, 0x02,
+    0x11, 0x01, 0x09, 0x02, 0x06, 0x01, 0x03, 0x01, 0x0A, 0x03, 0x05, 0x01,
+    0x0F, 0x03, 0x1A, 0x02, 0x11, 0x02, 0x1F, 0x03, 0x0B, 0x03, 0x0E, 0x01,
+    0x01, 0x01, 0x13, 0x01, 0x08, 0x02, 0x76, 0x03, 0x32, 0x03, 0x29, 0x04,
+    0x05, 0x04, 0x21, 0x04, 0x0D, 0x04, 0x1A, 0x03, 0x15, 0x03, 0x13, 0x04,
+    0x1B, 0x01, 0x0F, 0x03, 0x1F, 0x01, 0x41, 0x01, 0x20, 0x01, 0x11, 0x01,
+    0x1E, 0x01, 0x13, 0x01, 0x1C, 0x01, 0x15, 0x01, 0x1A, 0x01, 0x0B, 0x01,
+    0x30, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x18, 0x01, 0x0A, 0x01, 0x0E, 0x01,
+    0x16, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x14, 0x01, 0x0B, 0x01, 0x05, 0x01,
+    0x1E, 0x01, 0x0B, 0x01, 0x12, 0x01, 0x26, 0x01, 0x0B, 0x01, 0x10, 0x01,
+    0x0B, 0x01, 0x09, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x0B, 0x01, 0x17, 0x01,
+    0x0C, 0x01, 0x18, 0x01, 0x18, 0x02, 0x0A, 0x01, 0x27, 0x01, 0x17, 0x01,
+    0x09, 0x02, 0x0F, 0x02, 0x06, 0x01, 0x0F, 0x01, 0x07, 0x01, 0x13, 0x01,
+    0x04, 0x01, 0x16, 0x02, 0x15, 0x02, 0x14, 0x01, 0x03, 0x01, 0x19, 0x02,
+    0x13, 0x01, 0x01, 0x01, 0x11, 0x0E, 0xB1, 0x08, 0x11, 0x0E, 0x11, 0xF0,
+    0x04, 0x11, 0x0E, 0x11, 0x06, 0x0D, 0xAF, 0x02, 0x01, 0x05, 0x01, 0x37,
+    0x01, 0x0C, 0x01, 0x24, 0x01, 0x05, 0x01, 0x24, 0x01, 0x0C, 0x01, 0x11,
+    0x01, 0x05, 0x01, 0x1E, 0x01, 0x05, 0x01, 0x0B, 0x01, 0x06, 0x02, 0x13,
+    0x01, 0x08, 0x01, 0x0A, 0x02, 0x05, 0x01, 0x0D, 0x02, 0x02, 0x01, 0x00,
+    0x1B, 0x06, 0x04, 0x0A, 0x03, 0x04, 0x03, 0x06, 0x01, 0x0A, 0x01, 0x04,
+    0x01, 0x0C, 0x01, 0x11, 0x01, 0x01, 0x01, 0x20, 0x01, 0x65, 0x02, 0x11,
+    0x01, 0x0D, 0x01, 0x03, 0x01, 0x0B, 0x01, 0x05, 0x02, 0x07, 0x02, 0x1B,
+    0x0B, 0x1A, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x30,
+    0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x30, 0x01, 0x65, 0x01, 0x0A,
+    0x01, 0x65, 0x01, 0x30, 0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x30,
+    0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x30, 0x01, 0x65, 0x01, 0x0A,
+    0x01, 0x65, 0x01, 0x30, 0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x0A,
+    0x01, 0x65, 0x01, 0x30, 0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x30,
+    0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x30, 0x01, 0x65, 0x01, 0x0A,
+    0x01, 0x65, 0x01, 0x30, 0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x30,
+    0x01, 0x65, 0x01, 0x0A, 0x01, 0x65, 0x01, 0x30, 0x01, 0x13, 0x0A, 0x22,
+    0x04, 0x0A, 0x03, 0x1D, 0x02, 0x11, 0x02, 0x19, 0x02, 0x15, 0x02, 0x16,
+    0x01, 0x19, 0x01, 0x14, 0x01, 0x1B, 0x01, 0x12, 0x01, 0x1D, 0x01, 0x10,
+    0x01, 0x1F, 0x01, 0x0E, 0x01, 0x21, 0x01, 0x30, 0x01, 0x0B, 0x01, 0x2E,
+    0x01, 0x25, 0x01, 0x1B, 0x03, 0x1A, 0x01, 0x10, 0x02, 0x03, 0x03, 0x0F,
+    0x01, 0x17, 0x01, 0x08, 0x01, 0x25, 0x01, 0x19, 0x01, 0x05, 0x01, 0x0E,
+    0x01, 0x0B, 0x01, 0x30, 0x01, 0x21, 0x01, 0x1C, 0x01, 0x03, 0x01, 0x4D,
+    0x01, 0x4F, 0x01, 0x4E, 0x01, 0x01, 0x01, 0xAF, 0x01, 0x01, 0xDE, 0x02,
+    0x01, 0x8F, 0x07, 0x01, 0x90, 0x02, 0x01, 0x3F, 0x01, 0x8D, 0x01, 0x01,
+    0x10, 0x01, 0x3F, 0x01, 0x11, 0x01, 0x5B, 0x01, 0x12, 0x01, 0x3D, 0x01,
+    0x13, 0x01, 0x0E, 0x01, 0x0B, 0x01, 0x24, 0x01, 0x19, 0x01, 0x06, 0x01,
+    0x0F, 0x01, 0x08, 0x01, 0x27, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x1A, 0x03,
+    0x1B, 0x01, 0x25, 0x01, 0x0A, 0x01, 0x53, 0x01, 0x0C, 0x01, 0x21, 0x01,
+    0x0E, 0x01, 0x1F, 0x01, 0x10, 0x01, 0x1D, 0x01, 0x12, 0x01, 0x1B, 0x01,
+    0x14, 0x01, 0x19, 0x01, 0x16, 0x02, 0x15, 0x02, 0x19, 0x02, 0x11, 0x02,
+    0x1D, 0x04, 0x0A, 0x03, 0x1C, 0x03, 0x1A, 0x02, 0x1B, 0x02, 0x1A, 0x03,
+    0x1A, 0x02, 0x1A, 0x03, 0x1A, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x1A, 0x02,
+    0x1A, 0x03, 0x1A, 0x02, 0x1B, 0x02, 0xC8, 0x01, 0x01, 0x1C, 0x02, 0x1A,
+    0x03, 0x19, 0x03, 0x1A, 0x02, 0x1A, 0x03, 0x1A, 0x02, 0x1C, 0x01, 0x14,
+    0x0B, 0x24, 0x04, 0x0B, 0x04, 0x1E, 0x02, 0x13, 0x02, 0x1A, 0x02, 0x17,
+    0x02, 0x17, 0x01, 0x1B, 0x01, 0x14, 0x02, 0x1D, 0x02, 0x11, 0x01, 0x21,
+    0x01, 0x0F, 0x01, 0x56, 0x01, 0x0D, 0x01, 0x25, 0x01, 0x0B, 0x01, 0x31,
+    0x01, 0x28, 0x01, 0x1D, 0x02, 0x1C, 0x01, 0x11, 0x03, 0x02, 0x03, 0x11,
+    0x01, 0x17, 0x02, 0x08, 0x01, 0x27, 0x01, 0x0B, 0x01, 0x16, 0x01, 0x1C,
+    0x01, 0x0F, 0x01, 0x14, 0x01, 0x41, 0x01, 0x13, 0x01, 0x0E, 0x01, 0xCA,
+    0x01, 0x01, 0x11, 0x01, 0x11, 0x01, 0x86, 0x01, 0x01, 0x11, 0x0F, 0xDD,
+    0x01, 0x01, 0x0E, 0x01, 0x88, 0x01, 0x01, 0x0E, 0x01, 0x55, 0x01, 0x41,
+    0x01, 0x22, 0x01, 0x31, 0x01, 0x0F, 0x01, 0x54, 0x01, 0x0F, 0x01, 0x21,
+    0x01, 0x0F, 0x01, 0x54, 0x01, 0x0F, 0x01, 0x21, 0x01, 0x42, 0x01, 0x21,
+    0x01, 0x0F, 0x01, 0x21, 0x01, 0x0F, 0x01, 0x21, 0x01, 0x31, 0x01, 0x10,
+    0x01, 0x31, 0x01, 0x21, 0x01, 0x0F, 0x01, 0x21, 0x01, 0x0F, 0x01, 0x21,
+    0x01, 0x42, 0x01, 0x21, 0x01, 0x0F, 0x01, 0x21, 0x01, 0x0F, 0x01, 0x21,
+    0x01, 0x31, 0x01, 0x10, 0x01, 0x31, 0x01, 0x21, 0x01, 0x31, 0x01, 0x10,
+    0x01, 0x20, 0x01, 0x10, 0x01, 0x20, 0x01, 0x10, 0x01, 0x53, 0x01, 0x10,
+    0x01, 0x20, 0x01, 0x10, 0x01, 0x20, 0x01, 0x43, 0x01, 0x20, 0x01, 0x10,
+    0x01, 0x20, 0x01, 0x10, 0x01, 0x20, 0x01, 0x31, 0x01, 0x12, 0x1E, 0x13,
+    0x0B, 0x22, 0x04, 0x0B, 0x04, 0x1C, 0x02, 0x13, 0x02, 0x18, 0x02, 0x17,
+    0x02, 0x15, 0x01, 0x1B, 0x02, 0x12, 0x01, 0x1E, 0x01, 0x10, 0x01, 0x20,
+    0x01, 0x0E, 0x01, 0x22, 0x01, 0x0C, 0x01, 0x24, 0x01, 0x0A, 0x01, 0x2F,
+    0x01, 0x27, 0x01, 0x38, 0x01, 0x14, 0x01, 0x14, 0x01, 0x17, 0x04, 0x01,
+    0x04, 0x16, 0x01, 0x10, 0x01, 0x09, 0x01, 0x10, 0x01, 0x14, 0x01, 0x0B,
+    0x01, 0x23, 0x01, 0x0D, 0x01, 0x43, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E,
+    0x01, 0xC6, 0x01, 0x0F, 0x94, 0x02, 0x01, 0x21, 0x01, 0x6F, 0x01, 0x21,
+    0x01, 0x2F, 0x01, 0x2F, 0x01, 0x0F, 0x01, 0x1E, 0x02, 0x0F, 0x01, 0x14,
+    0x0B, 0x41, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2E, 0x02, 0x2E, 0x01, 0x30,
+    0x01, 0x31, 0x02, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x14,
+    0x0B, 0x12, 0x01, 0x1E, 0x03, 0x31, 0x01, 0x0F, 0x01, 0x21, 0x01, 0x40,
+    0x01, 0x21, 0x01, 0x62, 0x01, 0x3F, 0x01, 0xF5, 0x01, 0x0F, 0xB5, 0x01,
+    0x01, 0x0E, 0x01, 0x42, 0x01, 0x0E, 0x01, 0x41, 0x01, 0x0F, 0x01, 0x21,
+    0x01, 0x0D, 0x01, 0x12, 0x01, 0x10, 0x01, 0x1C, 0x01, 0x14, 0x01, 0x09,
+    0x02, 0x14, 0x01, 0x11, 0x03, 0x03, 0x03, 0x11, 0x01, 0x19, 0x03, 0x1A,
+    0x01, 0x29, 0x01, 0x38, 0x01, 0x27, 0x01, 0x09, 0x01, 0x25, 0x01, 0x0B,
+    0x01, 0x23, 0x01, 0x0D, 0x01, 0x21, 0x01, 0x0F, 0x01, 0x1F, 0x01, 0x11,
+    0x02, 0x1B, 0x02, 0x14, 0x02, 0x17, 0x02, 0x18, 0x02, 0x13, 0x02, 0x1C,
+    0x04, 0x0B, 0x04, 0x1C, 0x10, 0x55, 0x01, 0x64, 0x01, 0x64, 0x01, 0x64,
+    0x01, 0x64, 0x01, 0x64, 0x01, 0x64, 0x01, 0x64, 0x01, 0x64, 0x01, 0x31,
+    0x01, 0x64, 0x01, 0x64, 0x01, 0x0B, 0x01, 0x58, 0x01, 0x0B, 0x01, 0x58,
+    0x01, 0x0B, 0x01, 0x58, 0x01, 0x0B, 0x01, 0x58, 0x01, 0x0B, 0x01, 0x58,
+    0x01, 0x0B, 0x01, 0x58, 0x01, 0x0B, 0x01, 0x58, 0x01, 0x31, 0x01, 0x0C,
+    0x01, 0x57, 0x01, 0x0C, 0x01, 0x57, 0x01, 0x0C, 0x01, 0x57, 0x01, 0x0C,
+    0x01, 0x57, 0x01, 0x0C, 0x01, 0x57, 0x01, 0x0C, 0x01, 0x57, 0x01, 0x0C,
+    0x01, 0x57, 0x01, 0x0C, 0x01, 0x32, 0x0F, 0x0F, 0x08, 0xB0, 0x04, 0x1D,
+    0x0F, 0x07, 0x06, 0x28, 0xA7, 0x02, 0x01, 0xAC, 0x02, 0x1C, 0x96, 0x01,
+    0x01, 0xFC, 0x01, 0x01, 0x91, 0x02, 0x01, 0x43, 0x09, 0x24, 0x03, 0x09,
+    0x03, 0x1F, 0x02, 0x0F, 0x02, 0x1C, 0x01, 0x13, 0x02, 0x30, 0x01, 0x30,
+    0x01, 0x30, 0x01, 0x30, 0x01, 0x37, 0x01, 0x28, 0x01, 0x30, 0x01, 0x46,
+    0x07, 0x13, 0x01, 0x13, 0x02, 0x07, 0x02, 0x16, 0x04, 0x0A, 0x01, 0x0B,
+    0x02, 0x18, 0x04, 0x05, 0x01, 0x1E, 0x01, 0x0B, 0x03, 0x01, 0x01, 0x0F,
+    0x01, 0x1E, 0x01, 0x11, 0x01, 0x6F, 0x01, 0x20, 0x01, 0x9F, 0x04, 0x0F,
+    0xB1, 0x01, 0x01, 0x0E, 0x01, 0x10, 0x01, 0x0E, 0x01, 0x70, 0x01, 0x0E,
+    0x01, 0x11, 0x01, 0x0F, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x13, 0x01, 0x0A,
+    0x01, 0x25, 0x01, 0x08, 0x01, 0x10, 0x01, 0x04, 0x01, 0x11, 0x03, 0x02,
+    0x03, 0x17, 0x01, 0x13, 0x02, 0x13, 0x01, 0x37, 0x01, 0x26, 0x01, 0x09,
+    0x01, 0x24, 0x01, 0x3B, 0x01, 0x22, 0x01, 0x0D, 0x02, 0x1F, 0x01, 0x10,
+    0x01, 0x1C, 0x02, 0x12, 0x01, 0x1A, 0x01, 0x15, 0x02, 0x16, 0x02, 0x18,
+    0x02, 0x12, 0x02, 0x1C, 0x04, 0x0A, 0x04, 0x1D, 0x09, 0x24, 0x04, 0x2A,
+    0x03, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x01, 0x2E, 0x02, 0x2E, 0x01, 0x2F,
+    0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x45, 0x08, 0x13,
+    0x01, 0x12, 0x03, 0x1A, 0x01, 0x11, 0x02, 0x2E, 0x01, 0x1E, 0x01, 0x10,
+    0x01, 0x2F, 0x01, 0x1F, 0x01, 0x0F, 0x01, 0x2F, 0x01, 0x20, 0x01, 0x0E,
+    0x01, 0x60, 0x01, 0x21, 0x01, 0x3E, 0x01, 0x52, 0x01, 0x3E, 0x01, 0x07,
+    0x09, 0x25, 0x03, 0x09, 0x03, 0x21, 0x01, 0x0F, 0x02, 0x1D, 0x02, 0x12,
+    0x01, 0x0B, 0x01, 0x0F, 0x01, 0x15, 0x02, 0x17, 0x02, 0x18, 0x01, 0x16,
+    0x01, 0x4B, 0x01, 0x31, 0x01, 0x62, 0x01, 0x04, 0x01, 0x47, 0x03, 0x13,
+    0x01, 0x17, 0x03, 0x03, 0x02, 0x28, 0x01, 0x08, 0x02, 0x10, 0x01, 0x14,
+    0x01, 0x0B, 0x01, 0x23, 0x01, 0x2F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x41,
+    0x01, 0x10, 0x01, 0xC4, 0x01, 0x01, 0x3F, 0x01, 0xF5, 0x01, 0x01, 0xA1,
+    0x01, 0x01, 0x20, 0x01, 0x21, 0x01, 0x41, 0x01, 0x3F, 0x01, 0x40, 0x01,
+    0x0E, 0x01, 0x03, 0x01, 0x0E, 0x01, 0x3E, 0x01, 0x23, 0x01, 0x0B, 0x01,
+    0x0F, 0x01, 0x05, 0x01, 0x0F, 0x01, 0x31, 0x01, 0x07, 0x02, 0x17, 0x01,
+    0x10, 0x03, 0x01, 0x03, 0x11, 0x01, 0x1B, 0x01, 0x1D, 0x01, 0x26, 0x01,
+    0x0A, 0x01, 0x24, 0x01, 0x3D, 0x01, 0x22, 0x01, 0x0E, 0x01, 0x20, 0x01,
+    0x10, 0x01, 0x1E, 0x01, 0x12, 0x01, 0x1C, 0x01, 0x14, 0x02, 0x18, 0x02,
+    0x17, 0x01, 0x15, 0x02, 0x1A, 0x02, 0x11, 0x02, 0x1E, 0x04, 0x0A, 0x03,
+    0x00, 0x32, 0xA5, 0x04, 0x24, 0x31, 0x01, 0x0D, 0x01, 0x86, 0x01, 0x01,
+    0x0D, 0x01, 0x54, 0x01, 0x3F, 0x01, 0x54, 0x01, 0x3F, 0x01, 0x54, 0x01,
+    0x3F, 0x01, 0x22, 0x01, 0x3F, 0x01, 0x54, 0x01, 0x3F, 0x01, 0x54, 0x01,
+    0x3F, 0x01, 0x22, 0x01, 0x71, 0x01, 0x22, 0x01, 0x62, 0x01, 0x0E, 0x01,
+    0x62, 0x01, 0x22, 0x01, 0x71, 0x01, 0x22, 0x01, 0x62, 0x01, 0x0E, 0x01,
+    0x85, 0x01, 0x01, 0x0E, 0x01, 0x85, 0x01, 0x01, 0x0E, 0x01, 0x53, 0x01,
+    0x0E, 0x01, 0x85, 0x01, 0x01, 0x0E, 0x01, 0x85, 0x01, 0x01, 0x0E, 0x01,
+    0x53, 0x01, 0x40, 0x01, 0x53, 0x01, 0x0E, 0x01, 0x53, 0x01, 0x40, 0x01,
+    0x53, 0x01, 0x40, 0x01, 0x53, 0x01, 0x40, 0x01, 0x21, 0x01, 0x72, 0x01,
+    0x21, 0x01, 0x40, 0x01, 0x53, 0x01, 0x40, 0x01, 0x12, 0x0B, 0x21, 0x03,
+    0x0B, 0x04, 0x1B, 0x02, 0x12, 0x02, 0x17, 0x02, 0x16, 0x02, 0x13, 0x02,
+    0x1A, 0x01, 0x11, 0x01, 0x1D, 0x01, 0x0F, 0x01, 0x1F, 0x01, 0x0D, 0x01,
+    0x21, 0x01, 0x2F, 0x01, 0x0A, 0x01, 0x2D, 0x01, 0x25, 0x01, 0x2F, 0x01,
+    0x06, 0x01, 0x13, 0x01, 0x2B, 0x03, 0x01, 0x03, 0x27, 0x01, 0x07, 0x01,
+    0x10, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x2F, 0x01, 0x22, 0x01,
+    0x4A, 0x01, 0x1F, 0x01, 0x11, 0x01, 0x0E, 0x01, 0x8A, 0x02, 0x01, 0x6C,
+    0x01, 0x1C, 0x01, 0x1F, 0x01, 0x41, 0x01, 0x0E, 0x01, 0x1A, 0x01, 0x1F,
+    0x01, 0x14, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x25, 0x01, 0x07, 0x01, 0x0F,
+    0x01, 0x07, 0x01, 0x0F, 0x03, 0x02, 0x02, 0x0F, 0x01, 0x09, 0x01, 0x11,
+    0x02, 0x3F, 0x01, 0x0B, 0x01, 0x21, 0x01, 0x0D, 0x01, 0x1F, 0x01, 0x0F,
+    0x02, 0x1C, 0x01, 0x12, 0x01, 0x19, 0x02, 0x13, 0x01, 0x19, 0x02, 0x11,
+    0x02, 0x1C, 0x01, 0x0F, 0x01, 0x1F, 0x01, 0x0D, 0x01, 0x21, 0x01, 0x0B,
+    0x01, 0x23, 0x01, 0x09, 0x01, 0x25, 0x01, 0x19, 0x05, 0x11, 0x01, 0x06,
+    0x01, 0x0F, 0x02, 0x05, 0x02, 0x25, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x04,
+    0x01, 0x0E, 0x01, 0x0B, 0x01, 0x2F, 0x01, 0x0E, 0x01, 0x02, 0x01, 0x0E,
+    0x01, 0x3D, 0x01, 0x1E, 0x01, 0x1E, 0x02, 0xDB, 0x01, 0x01, 0x5D, 0x01,
+    0xD9, 0x01, 0x01, 0x1F, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x3C, 0x01, 0x0F,
+    0x01, 0x11, 0x01, 0x0B, 0x01, 0x12, 0x01, 0x10, 0x01, 0x09, 0x01, 0x25,
+    0x04, 0x02, 0x03, 0x11, 0x01, 0x03, 0x01, 0x14, 0x02, 0x42, 0x01, 0x05,
+    0x01, 0x27, 0x01, 0x07, 0x01, 0x54, 0x01, 0x09, 0x01, 0x23, 0x01, 0x0B,
+    0x01, 0x21, 0x01, 0x0D, 0x02, 0x1E, 0x01, 0x10, 0x01, 0x1B, 0x02, 0x12,
+    0x02, 0x17, 0x02, 0x16, 0x02, 0x13, 0x02, 0x1A, 0x04, 0x0B, 0x04, 0x13,
+    0x0A, 0x23, 0x03, 0x0A, 0x03, 0x1E, 0x02, 0x10, 0x02, 0x1A, 0x02, 0x14,
+    0x02, 0x17, 0x01, 0x18, 0x01, 0x15, 0x01, 0x1A, 0x01, 0x13, 0x01, 0x1C,
+    0x01, 0x11, 0x01, 0x1E, 0x01, 0x0F, 0x01, 0x20, 0x01, 0x0D, 0x01, 0x22,
+    0x01, 0x0B, 0x01, 0x54, 0x01, 0x09, 0x01, 0x12, 0x02, 0x2C, 0x02, 0x02,
+    0x02, 0x10, 0x01, 0x07, 0x01, 0x0F, 0x02, 0x06, 0x01, 0x30, 0x01, 0x0F,
+    0x01, 0x05, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x23, 0x01, 0x0C, 0x01, 0x3E,
+    0x01, 0x33, 0x01, 0x0E, 0x01, 0x0E, 0x01, 0x3E, 0x01, 0x70, 0x01, 0x10,
+    0x01, 0x3F, 0x01, 0x5E, 0x01, 0xC0, 0x01, 0x01, 0x6E, 0x01, 0xC0, 0x01,
+    0x01, 0x20, 0x01, 0x1E, 0x01, 0x50, 0x01, 0x0D, 0x01, 0x22, 0x01, 0x0B,
+    0x01, 0x13, 0x01, 0x10, 0x01, 0x09, 0x01, 0x26, 0x01, 0x06, 0x02, 0x16,
+    0x01, 0x11, 0x06, 0x49, 0x01, 0x5A, 0x01, 0x05, 0x01, 0x30, 0x01, 0x30,
+    0x01, 0x30, 0x01, 0x17, 0x01, 0x18, 0x01, 0x14, 0x02, 0x1A, 0x01, 0x12,
+    0x01, 0x1D, 0x02, 0x0E, 0x02, 0x03, 0x01, 0x0D, 0x01, 0x0E, 0x03, 0x09,
+    0x02, 0x25, 0x09, 0x66, 0x01, 0x0D, 0x01, 0x80, 0x01, 0x01, 0x0D, 0x01,
+    0x50, 0x01, 0x2E, 0x01, 0x0E, 0x01, 0x1F, 0x01, 0x2E, 0x01, 0x0F, 0x01,
+    0x1E, 0x01, 0x2E, 0x01, 0x10, 0x01, 0x1C, 0x02, 0x10, 0x01, 0x19, 0x04,
+    0x25, 0x07, 0x15, 0x01, 0x2E, 0x01, 0x5E, 0x01, 0x2E, 0x01, 0x2E, 0x01,
+    0x2D, 0x02, 0x2D, 0x01, 0x2D, 0x02, 0x2D, 0x01, 0x2C, 0x03, 0x2A, 0x03,
+    0x29, 0x04, 0x07, 0x04, 0x0B, 0x03, 0x04, 0x03, 0x07, 0x01, 0x0A, 0x01,
+    0x05, 0x01, 0x0C, 0x01, 0x03, 0x01, 0x0E, 0x01, 0x24, 0x01, 0x12, 0x01,
+    0x11, 0x01, 0x46, 0x01, 0x01, 0x01, 0x12, 0x01, 0x0D, 0x01, 0x04, 0x01,
+    0x0B, 0x01, 0x06, 0x02, 0x07, 0x02, 0x09, 0x07, 0xA8, 0x04, 0x04, 0x0B,
+    0x03, 0x04, 0x03, 0x07, 0x01, 0x0A, 0x01, 0x05, 0x01, 0x0C, 0x01, 0x12,
+    0x01, 0x02, 0x01, 0x21, 0x01, 0x6B, 0x01, 0x01, 0x01, 0x12, 0x01, 0x0D,
+    0x01, 0x04, 0x01, 0x0B, 0x01, 0x06, 0x02, 0x07, 0x02, 0x0A, 0x04, 0x0E,
+    0x03, 0x04, 0x03, 0x0A, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0C, 0x01, 0x06,
+    0x01, 0x0E, 0x01, 0x2A, 0x01, 0x03, 0x01, 0x3E, 0x01, 0x3A, 0x01, 0x04,
+    0x01, 0x15, 0x01, 0x0D, 0x01, 0x07, 0x01, 0x0B, 0x01, 0x09, 0x02, 0x07,
+    0x02, 0x0C, 0x07, 0xAB, 0x05, 0x0D, 0xE4, 0x02, 0x01, 0x07, 0x01, 0x3D,
+    0x01, 0x0C, 0x01, 0x1B, 0x01, 0x0C, 0x01, 0x1B, 0x01, 0x0C, 0x01, 0x1B,
+    0x01, 0x0C, 0x01, 0x13, 0x01, 0x07, 0x01, 0x14, 0x02, 0x0A, 0x01, 0x0A,
+    0x02, 0x07, 0x01, 0x0D, 0x02, 0x04, 0x01, 0x10, 0x01, 0x02, 0x01, 0x28,
+    0x01, 0x26, 0x02, 0x25, 0x02, 0x25, 0x02, 0x25, 0x02, 0x25, 0x02, 0x25,
+    0x02, 0x26, 0x01, 0x26, 0x02, 0x25, 0x02, 0x25, 0x02, 0x25, 0x02, 0x25,
+    0x02, 0x25, 0x02, 0x25, 0x02, 0x25, 0x02, 0x1B, 0x01, 0x09, 0x02, 0x1B,
+    0x02, 0x08, 0x02, 0x1B, 0x02, 0x08, 0x02, 0x1B, 0x02, 0x08, 0x02, 0x1B,
+    0x02, 0x08, 0x02, 0x1A, 0x03, 0x09, 0x01, 0x1A, 0x02, 0x25, 0x02, 0x25,
+    0x02, 0x25, 0x02, 0x25, 0x02, 0x25, 0x02, 0x24, 0x03, 0x26, 0x02, 0x29,
+    0x02, 0x29, 0x03, 0x29, 0x02, 0x29, 0x02, 0x29, 0x02, 0x0E, 0x01, 0x1A,
+    0x02, 0x0D, 0x02, 0x1A, 0x02, 0x0D, 0x02, 0x1A, 0x03, 0x0C, 0x02, 0x1B,
+    0x02, 0x0C, 0x02, 0x1B, 0x02, 0x0C, 0x02, 0x1B, 0x02, 0x0C, 0x02, 0x1B,
+    0x01, 0x0D, 0x02, 0x29, 0x02, 0x29, 0x02, 0x29, 0x02, 0x29, 0x02, 0x29,
+    0x02, 0x29, 0x02, 0x29, 0x01, 0x29, 0x02, 0x29, 0x02, 0x29, 0x02, 0x29,
+    0x02, 0x29, 0x02, 0x29, 0x02, 0x00, 0x2B, 0x84, 0x04, 0x2B, 0xD9, 0x03,
+    0x2B, 0x00, 0x01, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B,
+    0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B,
+    0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x0E, 0x02, 0x1B, 0x02, 0x0E,
+    0x02, 0x1B, 0x02, 0x0E, 0x02, 0x1B, 0x02, 0x0E, 0x02, 0x1B, 0x02, 0x0E,
+    0x02, 0x1B, 0x02, 0x0E, 0x03, 0x1A, 0x02, 0x0F, 0x02, 0x1A, 0x02, 0x0F,
+    0x02, 0x2B, 0x02, 0x2B, 0x03, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x29,
+    0x02, 0x26, 0x03, 0x26, 0x02, 0x27, 0x02, 0x27, 0x02, 0x27, 0x02, 0x26,
+    0x03, 0x1A, 0x02, 0x0A, 0x02, 0x1B, 0x02, 0x0A, 0x02, 0x1B, 0x02, 0x0A,
+    0x02, 0x1B, 0x02, 0x0A, 0x02, 0x1B, 0x02, 0x0A, 0x02, 0x1B, 0x02, 0x0A,
+    0x02, 0x1B, 0x02, 0x27, 0x02, 0x27, 0x02, 0x27, 0x02, 0x27, 0x02, 0x27,
+    0x02, 0x27, 0x02, 0x27, 0x02, 0x27, 0x02, 0x27, 0x02, 0x27, 0x02, 0x27,
+    0x02, 0x27, 0x02, 0x27, 0x02, 0x27, 0x02, 0x11, 0x0B, 0x1F, 0x03, 0x0B,
+    0x04, 0x18, 0x03, 0x12, 0x02, 0x15, 0x01, 0x17, 0x02, 0x11, 0x02, 0x1A,
+    0x01, 0x0F, 0x01, 0x1D, 0x01, 0x0D, 0x01, 0x1F, 0x01, 0x0B, 0x01, 0x21,
+    0x01, 0x09, 0x01, 0x23, 0x01, 0x34, 0x01, 0x25, 0x01, 0x32, 0x01, 0x27,
+    0x01, 0x16, 0x06, 0x14, 0x01, 0x10, 0x02, 0x06, 0x01, 0x10, 0x01, 0x12,
+    0x01, 0x09, 0x01, 0x4E, 0x01, 0x0B, 0x01, 0x6A, 0x01, 0x0E, 0x01, 0x0D,
+    0x01, 0x3B, 0x01, 0x2D, 0x0F, 0x4A, 0x01, 0x4A, 0x01, 0x85, 0x01, 0x01,
+    0x3B, 0x01, 0x1C, 0x01, 0x2B, 0x01, 0x0F, 0x01, 0x48, 0x01, 0x0F, 0x01,
+    0x1B, 0x01, 0x2B, 0x01, 0x10, 0x01, 0x2B, 0x01, 0x1B, 0x01, 0x2B, 0x01,
+    0x10, 0x01, 0x1A, 0x01, 0x10, 0x01, 0x1A, 0x01, 0x10, 0x01, 0x2B, 0x01,
+    0x1B, 0x01, 0x2B, 0x01, 0x10, 0x01, 0x2B, 0x01, 0x2B, 0x01, 0x1C, 0x01,
+    0x0E, 0x01, 0x58, 0x01, 0x1D, 0x01, 0x3A, 0x01, 0x85, 0x01, 0x01, 0x80,
+    0x02, 0x0D, 0xB8, 0x03, 0x08, 0x23, 0x02, 0x08, 0x01, 0x21, 0x01, 0x0B,
+    0x01, 0x2D, 0x01, 0x1E, 0x01, 0x68, 0x01, 0x1C, 0x01, 0x2C, 0x01, 0x69,
+    0x01, 0x4A, 0x01, 0x0D, 0x01, 0x1F, 0x01, 0x2D, 0x01, 0x0A, 0x01, 0x22,
+    0x02, 0x06, 0x02, 0x24, 0x0D, 0x40, 0x04, 0x0D, 0x05, 0x38, 0x03, 0x16,
+    0x02, 0x34, 0x02, 0x1B, 0x03, 0x2F, 0x02, 0x20, 0x02, 0x2B, 0x02, 0x24,
+    0x01, 0x29, 0x01, 0x27, 0x02, 0x25, 0x02, 0x2A, 0x01, 0x23, 0x01, 0x2D,
+    0x01, 0x21, 0x01, 0x12, 0x0B, 0x12, 0x01, 0x1F, 0x01, 0x0F, 0x04, 0x0B,
+    0x04, 0x0F, 0x01, 0x1D, 0x01, 0x0E, 0x02, 0x13, 0x03, 0x0D, 0x01, 0x1B,
+    0x01, 0x0D, 0x02, 0x18, 0x02, 0x0C, 0x01, 0x19, 0x01, 0x0C, 0x02, 0x1C,
+    0x01, 0x0C, 0x01, 0x17, 0x01, 0x0C, 0x01, 0x1F, 0x01, 0x22, 0x01, 0x0C,
+    0x01, 0x21, 0x02, 0x0A, 0x01, 0x21, 0x01, 0x24, 0x01, 0x0A, 0x01, 0x13,
+    0x01, 0x0B, 0x01, 0x26, 0x01, 0x1C, 0x01, 0x0B, 0x01, 0x32, 0x01, 0x1C,
+    0x01, 0x29, 0x01, 0x1A, 0x01, 0x0A, 0x01, 0x2B, 0x01, 0x09, 0x01, 0x5F,
+    0x01, 0x0A, 0x01, 0x2D, 0x01, 0x09, 0x01, 0x17, 0x01, 0x2F, 0x01, 0x15,
+    0x01, 0x44, 0x01, 0x15, 0x01, 0x16, 0x09, 0x26, 0x01, 0x1E, 0x03, 0x09,
+    0x03, 0x0F, 0x01, 0x1D, 0x01, 0x12, 0x02, 0x0F, 0x02, 0x17, 0x01, 0x08,
+    0x01, 0x1C, 0x01, 0x13, 0x01, 0x0D, 0x01, 0x1B, 0x01, 0x11, 0x01, 0x15,
+    0x01, 0x39, 0x01, 0x17, 0x02, 0x1B, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x13,
+    0x01, 0x10, 0x01, 0x0F, 0x01, 0x26, 0x01, 0x28, 0x01, 0x1C, 0x01, 0x19,
+    0x01, 0x18, 0x01, 0x41, 0x01, 0x1B, 0x07, 0x3C, 0x01, 0x0B, 0x02, 0x26,
+    0x01, 0x27, 0x01, 0x1F, 0x01, 0x0C, 0x01, 0x17, 0x01, 0x0A, 0x01, 0x37,
+    0x01, 0x5D, 0x01, 0x0A, 0x01, 0x5B, 0x01, 0x39, 0x01, 0x0A, 0x01, 0x2E,
+    0x01, 0x5A, 0x01, 0x5C, 0x01, 0x0A, 0x01, 0x67, 0x01, 0xCF, 0x01, 0x01,
+    0x3A, 0x01, 0x20, 0x01, 0x8A, 0x01, 0x01, 0xAC, 0x01, 0x01, 0x18, 0x01,
+    0x9E, 0x03, 0x01, 0x0D, 0x01, 0x2A, 0x01, 0x2E, 0x01, 0x72, 0x01, 0xC6,
+    0x01, 0x01, 0x08, 0x01, 0x0C, 0x01, 0x22, 0x01, 0x74, 0x01, 0x2B, 0x01,
+    0x17, 0x01, 0x21, 0x01, 0x0B, 0x01, 0x2B, 0x01, 0x2E, 0x01, 0x17, 0x01,
+    0x59, 0x01, 0x26, 0x01, 0x07, 0x01, 0x0D, 0x01, 0x09, 0x01, 0x24, 0x01,
+    0x0C, 0x01, 0x05, 0x01, 0x17, 0x01, 0x09, 0x01, 0x10, 0x01, 0x18, 0x05,
+    0x10, 0x01, 0x06, 0x01, 0x11, 0x01, 0x38, 0x06, 0x0A, 0x01, 0x1D, 0x01,
+    0x67, 0x02, 0x19, 0x01, 0x13, 0x01, 0x0B, 0x01, 0x14, 0x01, 0x1A, 0x01,
+    0x21, 0x01, 0x16, 0x01, 0x16, 0x01, 0x0B, 0x01, 0x17, 0x01, 0x11, 0x01,
+    0x04, 0x01, 0x14, 0x01, 0x17, 0x01, 0x0D, 0x01, 0x0E, 0x02, 0x06, 0x01,
+    0x11, 0x02, 0x27, 0x01, 0x0C, 0x01, 0x09, 0x02, 0x0E, 0x01, 0x10, 0x01,
+    0x0A, 0x01, 0x0E, 0x03, 0x07, 0x02, 0x0C, 0x02, 0x09, 0x03, 0x2E, 0x07,
+    0x10, 0x09, 0x66, 0x01, 0x0A, 0x01, 0x51, 0x01, 0x45, 0x01, 0x5C, 0x01,
+    0x45, 0x01, 0x0B, 0x01, 0x51, 0x01, 0x44, 0x01, 0x0C, 0x01, 0x44, 0x01,
+    0x0C, 0x01, 0x51, 0x01, 0x43, 0x01, 0x0D, 0x01, 0x43, 0x01, 0x0D, 0x02,
+    0x1C, 0x02, 0x24, 0x01, 0x0E, 0x02, 0x17, 0x03, 0x37, 0x03, 0x11, 0x03,
+    0x2A, 0x01, 0x12, 0x07, 0x03, 0x07, 0x2E, 0x02, 0x17, 0x03, 0x0F, 0x01,
+    0x27, 0x01, 0x51, 0x01, 0x51, 0x02, 0x51, 0x01, 0x24, 0x01, 0x2C, 0x02,
+    0x21, 0x01, 0x2F, 0x03, 0x1C, 0x02, 0x33, 0x03, 0x16, 0x03, 0x38, 0x04,
+    0x0D, 0x05, 0x1A, 0x0E, 0x75, 0x01, 0x0E, 0x01, 0xB5, 0x01, 0x01, 0x10,
+    0x01, 0xB3, 0x01, 0x01, 0x12, 0x01, 0xB1, 0x01, 0x01, 0x14, 0x01, 0xAF,
+    0x01, 0x01, 0x58, 0x01, 0x6B, 0x01, 0x5A, 0x01, 0xAB, 0x01, 0x01, 0x1A,
+    0x01, 0x75, 0x02, 0x32, 0x01, 0x1C, 0x01, 0x73, 0x01, 0x02, 0x01, 0x30,
+    0x01, 0x1E, 0x01, 0xA5, 0x01, 0x01, 0x0D, 0x01, 0x04, 0x01, 0x0D, 0x01,
+    0xA3, 0x01, 0x01, 0x4F, 0x01, 0x06, 0x01, 0x0D, 0x01, 0x5F, 0x01, 0x4F,
+    0x01, 0x08, 0x01, 0x0D, 0x01, 0x9F, 0x01, 0x01, 0x26, 0x01, 0x28, 0x01,
+    0x0A, 0x01, 0x69, 0x01, 0x28, 0x01, 0x68, 0x01, 0x0C, 0x01, 0x25, 0x01,
+    0x2A, 0x01, 0x66, 0x01, 0x32, 0x01, 0x1D, 0x01, 0x0E, 0x01, 0x97, 0x01,
+    0x01, 0x0E, 0x01, 0x10, 0x01, 0x30, 0x12, 0x0E, 0x01, 0x95, 0x01, 0x01,
+    0x30, 0x01, 0x93, 0x01, 0x01, 0x32, 0x01, 0x91, 0x01, 0x01, 0x34, 0x01,
+    0x8F, 0x01, 0x01, 0x36, 0x01, 0x1A, 0x18, 0x29, 0x01, 0x18, 0x01, 0x18,
+    0x01, 0x38, 0x01, 0x59, 0x01, 0x31, 0x01, 0x2A, 0x01, 0x51, 0x01, 0x57,
+    0x01, 0x1C, 0x01, 0x14, 0x01, 0x3C, 0x01, 0x87, 0x01, 0x01, 0x0F, 0x01,
+    0x1E, 0x01, 0x0F, 0x01, 0x85, 0x01, 0x01, 0x0F, 0x01, 0x30, 0x01, 0x31,
+    0x01, 0x00, 0x21, 0x35, 0x04, 0x35, 0x03, 0x35, 0x02, 0x35, 0x01, 0x35,
+    0x02, 0x35, 0x01, 0x35, 0x01, 0x6A, 0x01, 0x35, 0x01, 0x6A, 0x01, 0x13,
+    0x0E, 0x35, 0x02, 0x35, 0x02, 0x10, 0x01, 0x59, 0x01, 0x6A, 0x01, 0x79,
+    0x01, 0xD3, 0x01, 0x01, 0xC3, 0x01, 0x01, 0x43, 0x01, 0x24, 0x01, 0x68,
+    0x01, 0x0F, 0x01, 0x22, 0x02, 0x0F, 0x01, 0x1F, 0x04, 0x26, 0x0B, 0x14,
+    0x01, 0x33, 0x01, 0x33, 0x01, 0x32, 0x02, 0x32, 0x01, 0x34, 0x01, 0x35,
+    0x02, 0x35, 0x01, 0x35, 0x02, 0x6A, 0x01, 0x14, 0x0F, 0x12, 0x01, 0x22,
+    0x03, 0x35, 0x01, 0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x5A, 0x01, 0x44,
+    0x01, 0x8F, 0x01, 0x01, 0xD3, 0x01, 0x01, 0xD2, 0x01, 0x01, 0x44, 0x01,
+    0x23, 0x01, 0x67, 0x02, 0x31, 0x02, 0x12, 0x01, 0x11, 0x0F, 0x48, 0x01,
+    0x68, 0x01, 0x33, 0x01, 0x68, 0x01, 0x32, 0x02, 0x32, 0x01, 0x33, 0x01,
+    0x32, 0x02, 0x30, 0x03, 0x2E, 0x04, 0x17, 0x0C, 0x29, 0x04, 0x0C, 0x05,
+    0x21, 0x03, 0x15, 0x02, 0x1D, 0x02, 0x1A, 0x02, 0x1A, 0x01, 0x1E, 0x02,
+    0x16, 0x02, 0x21, 0x01, 0x14, 0x01, 0x24, 0x01, 0x12, 0x01, 0x26, 0x01,
+    0x10, 0x01, 0x28, 0x01, 0x0E, 0x01, 0x2A, 0x01, 0x39, 0x01, 0x0B, 0x01,
+    0x37, 0x01, 0x2E, 0x01, 0x1C, 0x0A, 0x1B, 0x01, 0x11, 0x02, 0x0A, 0x03,
+    0x10, 0x01, 0x18, 0x01, 0x0F, 0x01, 0x16, 0x01, 0x10, 0x01, 0x11, 0x01,
+    0x0F, 0x01, 0x15, 0x01, 0x27, 0x01, 0x0F, 0x01, 0x14, 0x01, 0x48, 0x01,
+    0x12, 0x01, 0x16, 0x01, 0x11, 0x01, 0x80, 0x01, 0x01, 0x27, 0x01, 0x62,
+    0x01, 0x0F, 0x01, 0x80, 0x01, 0x01, 0x53, 0x0F, 0xAD, 0x0C, 0x0F, 0x0F,
+    0x01, 0x62, 0x01, 0x28, 0x01, 0xB9, 0x01, 0x01, 0x10, 0x01, 0x29, 0x01,
+    0x5F, 0x01, 0x21, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x14, 0x01, 0x0F, 0x01,
+    0x4D, 0x01, 0x12, 0x01, 0x0F, 0x01, 0x05, 0x01, 0x10, 0x02, 0x0E, 0x02,
+    0x29, 0x02, 0x0A, 0x02, 0x19, 0x01, 0x13, 0x0A, 0x13, 0x01, 0x08, 0x01,
+    0x2E, 0x01, 0x43, 0x01, 0x2C, 0x01, 0x0C, 0x01, 0x2A, 0x01, 0x0E, 0x01,
+    0x28, 0x01, 0x10, 0x01, 0x26, 0x01, 0x12, 0x01, 0x24, 0x01, 0x14, 0x02,
+    0x21, 0x01, 0x17, 0x01, 0x1E, 0x02, 0x19, 0x02, 0x1A, 0x02, 0x1D, 0x03,
+    0x14, 0x03, 0x22, 0x04, 0x0C, 0x04, 0x00, 0x1C, 0x36, 0x05, 0x36, 0x02,
+    0x36, 0x03, 0x36, 0x01, 0x36, 0x02, 0x36, 0x01, 0x36, 0x01, 0x36, 0x02,
+    0x6C, 0x01, 0x36, 0x01, 0x36, 0x01, 0x16, 0x0B, 0x36, 0x03, 0x12, 0x01,
+    0x23, 0x02, 0x11, 0x01, 0x24, 0x01, 0x36, 0x01, 0x10, 0x01, 0x25, 0x01,
+    0x36, 0x01, 0x45, 0x01, 0x26, 0x01, 0x7B, 0x01, 0x26, 0x01, 0x9D, 0x02,
+    0x01, 0x92, 0x01, 0x01, 0x81, 0x08, 0x01, 0x9C, 0x02, 0x01, 0x91, 0x01,
+    0x01, 0x7A, 0x01, 0x5B, 0x01, 0x44, 0x01, 0x25, 0x01, 0x34, 0x01, 0x34,
+    0x01, 0x10, 0x01, 0x23, 0x01, 0x33, 0x02, 0x11, 0x01, 0x20, 0x02, 0x12,
+    0x01, 0x15, 0x0C, 0x49, 0x01, 0x34, 0x01, 0x34, 0x01, 0x69, 0x02, 0x33,
+    0x01, 0x34, 0x01, 0x33, 0x02, 0x33, 0x01, 0x32, 0x03, 0x30, 0x03, 0x2F,
+    0x04, 0x00, 0x30, 0xD0, 0x04, 0x20, 0xD0, 0x07, 0x1B, 0xD5, 0x04, 0x1B,
+    0xE5, 0x08, 0x20, 0x00, 0x2E, 0xB8, 0x04, 0x1E, 0x84, 0x08, 0x1B, 0xBB,
+    0x04, 0x1B, 0x17, 0x0D, 0x28, 0x04, 0x0D, 0x04, 0x21, 0x03, 0x15, 0x03,
+    0x1C, 0x02, 0x1B, 0x02, 0x19, 0x01, 0x1F, 0x02, 0x15, 0x02, 0x22, 0x01,
+    0x13, 0x01, 0x25, 0x01, 0x11, 0x01, 0x27, 0x01, 0x0F, 0x01, 0x29, 0x01,
+    0x0D, 0x01, 0x2B, 0x01, 0x0B, 0x01, 0x66, 0x01, 0x09, 0x01, 0x2F, 0x01,
+    0x1C, 0x09, 0x1B, 0x01, 0x11, 0x03, 0x09, 0x03, 0x11, 0x01, 0x17, 0x01,
+    0x0F, 0x01, 0x16, 0x01, 0x10, 0x01, 0x11, 0x01, 0x25, 0x01, 0x13, 0x01,
+    0x0F, 0x01, 0x03, 0x01, 0x48, 0x01, 0x15, 0x01, 0x4A, 0x01, 0x0F, 0x01,
+    0x26, 0x01, 0x29, 0x01, 0x58, 0x01, 0x61, 0x01, 0x62, 0x0F, 0x81, 0x01,
+    0x01, 0x80, 0x05, 0x1C, 0x90, 0x05, 0x0D, 0x57, 0x01, 0x8D, 0x02, 0x01,
+    0x48, 0x01, 0x9B, 0x01, 0x01, 0x48, 0x01, 0x62, 0x01, 0x0F, 0x01, 0x39,
+    0x01, 0x39, 0x01, 0x27, 0x01, 0x11, 0x01, 0x12, 0x02, 0x25, 0x01, 0x10,
+    0x01, 0x15, 0x01, 0x12, 0x03, 0x0A, 0x03, 0x2C, 0x0A, 0x1A, 0x01, 0x39,
+    0x01, 0x39, 0x01, 0x30, 0x01, 0x37, 0x01, 0x09, 0x01, 0x2D, 0x01, 0x0B,
+    0x02, 0x29, 0x02, 0x0E, 0x01, 0x27, 0x01, 0x11, 0x01, 0x24, 0x02, 0x13,
+    0x02, 0x20, 0x02, 0x17, 0x02, 0x1C, 0x02, 0x1B, 0x03, 0x16, 0x03, 0x20,
+    0x04, 0x0E, 0x04, 0x00, 0x10, 0x1B, 0x0F, 0x8A, 0x0F, 0x1B, 0xD7, 0x05,
+    0x1B, 0x00, 0x0F, 0x20, 0x10, 0xE0, 0x15, 0x0F, 0xB0, 0x01, 0x01, 0x0F,
+    0x01, 0x6F, 0x01, 0x40, 0x01, 0x0F, 0x01, 0x1D, 0x01, 0x1F, 0x01, 0x22,
+    0x01, 0x0B, 0x01, 0x13, 0x01, 0x10, 0x01, 0x09, 0x01, 0x10, 0x01, 0x15,
+    0x02, 0x06, 0x01, 0x29, 0x06, 0x17, 0x01, 0x29, 0x01, 0x2E, 0x01, 0x07,
+    0x01, 0x30, 0x01, 0x25, 0x01, 0x0A, 0x01, 0x23, 0x01, 0x2E, 0x01, 0x0D,
+    0x01, 0x20, 0x01, 0x0F, 0x02, 0x1D, 0x01, 0x12, 0x01, 0x1B, 0x01, 0x14,
+    0x02, 0x17, 0x02, 0x17, 0x02, 0x12, 0x03, 0x1B, 0x04, 0x0B, 0x03, 0x00,
+    0x10, 0x16, 0x13, 0x60, 0x01, 0x12, 0x01, 0x38, 0x01, 0x26, 0x01, 0x38,
+    0x01, 0x12, 0x01, 0x38, 0x01, 0x26, 0x01, 0x4B, 0x01, 0x26, 0x01, 0x11,
+    0x01, 0x26, 0x01, 0x4B, 0x01, 0x26, 0x01, 0x11, 0x01, 0x38, 0x01, 0x27,
+    0x01, 0x38, 0x01, 0x11, 0x01, 0x38, 0x01, 0x27, 0x01, 0x4A, 0x01, 0x27,
+    0x01, 0x10, 0x01, 0x27, 0x01, 0x4A, 0x01, 0x27, 0x01, 0x10, 0x01, 0x27,
+    0x01, 0x4A, 0x01, 0x27, 0x01, 0x10, 0x01, 0x61, 0x01, 0x10, 0x01, 0x27,
+    0x01, 0x10, 0x01, 0x61, 0x01, 0x10, 0x01, 0x38, 0x01, 0x28, 0x01, 0x38,
+    0x01, 0x10, 0x01, 0x38, 0x01, 0x28, 0x01, 0x38, 0x01, 0x10, 0x01, 0x73,
+    0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x3A,
+    0x01, 0x28, 0x01, 0x3A, 0x01, 0x10, 0x01, 0x26, 0x01, 0x38, 0x01, 0x03,
+    0x01, 0x10, 0x01, 0x23, 0x01, 0x38, 0x01, 0x06, 0x01, 0x10, 0x01, 0x5A,
+    0x01, 0x08, 0x01, 0x10, 0x01, 0x1E, 0x01, 0x44, 0x01, 0x10, 0x01, 0x3A,
+    0x01, 0x28, 0x01, 0x4B, 0x01, 0x28, 0x01, 0x4B, 0x01, 0x28, 0x01, 0x4B,
+    0x01, 0x28, 0x01, 0x4B, 0x01, 0x28, 0x01, 0x4B, 0x01, 0x28, 0x01, 0x11,
+    0x01, 0x62, 0x01, 0x11, 0x01, 0x62, 0x01, 0x11, 0x01, 0x62, 0x01, 0x11,
+    0x01, 0x62, 0x01, 0x11, 0x01, 0x62, 0x01, 0x11, 0x01, 0x3A, 0x01, 0x27,
+    0x01, 0x00, 0x10, 0xC2, 0x19, 0x1E, 0x00, 0x14, 0x24, 0x13, 0x37, 0x01,
+    0x72, 0x01, 0x6C, 0x01, 0xBF, 0x01, 0x01, 0x6A, 0x01, 0x76, 0x01, 0x68,
+    0x01, 0x78, 0x01, 0x66, 0x01, 0xC5, 0x01, 0x01, 0x64, 0x01, 0x7C, 0x01,
+    0x62, 0x01, 0x7E, 0x01, 0x60, 0x01, 0x80, 0x01, 0x01, 0x20, 0x01, 0x67,
+    0x01, 0x20, 0x01, 0x82, 0x01, 0x01, 0x1E, 0x01, 0x3D, 0x01, 0x2B, 0x01,
+    0x49, 0x01, 0x0E, 0x01, 0x1C, 0x01, 0x3D, 0x01, 0x2D, 0x01, 0x58, 0x01,
+    0x58, 0x01, 0x0C, 0x01, 0x22, 0x01, 0xA3, 0x01, 0x01, 0x18, 0x01, 0x03,
+    0x01, 0x20, 0x01, 0x18, 0x01, 0x8A, 0x01, 0x01, 0x16, 0x01, 0x26, 0x01,
+    0x16, 0x01, 0x8C, 0x01, 0x01, 0x52, 0x01, 0x0C, 0x01, 0x28, 0x01, 0x58,
+    0x01, 0x5D, 0x01, 0x2A, 0x01, 0x12, 0x01, 0x90, 0x01, 0x01, 0x10, 0x01,
+    0x2C, 0x01, 0x10, 0x01, 0x92, 0x01, 0x01, 0x3D, 0x01, 0x0E, 0x01, 0x0C,
+    0x01, 0x87, 0x01, 0x01, 0x3D, 0x01, 0x19, 0x01, 0x92, 0x02, 0x01, 0x17,
+    0x01, 0xC9, 0x01, 0x01, 0x15, 0x01, 0xCB, 0x01, 0x01, 0x13, 0x01, 0xCD,
+    0x01, 0x01, 0x5C, 0x01, 0x84, 0x01, 0x01, 0x5A, 0x01, 0xD1, 0x01, 0x01,
+    0x0D, 0x01, 0xD3, 0x01, 0x01, 0x00, 0x0F, 0x1C, 0x0F, 0x0F, 0x01, 0x74,
+    0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74,
+    0x01, 0x74, 0x01, 0x74, 0x01, 0x3A, 0x01, 0xAE, 0x01, 0x01, 0x3A, 0x01,
+    0x74, 0x01, 0x74, 0x01, 0x65, 0x01, 0x0E, 0x01, 0x65, 0x01, 0x0E, 0x01,
+    0x65, 0x01, 0x0E, 0x01, 0x2B, 0x01, 0x48, 0x01, 0x2B, 0x01, 0x48, 0x01,
+    0x2B, 0x01, 0x48, 0x01, 0x2B, 0x01, 0x48, 0x01, 0x2B, 0x01, 0x48, 0x01,
+    0x2B, 0x01, 0x48, 0x01, 0x2B, 0x01, 0x48, 0x01, 0x2B, 0x01, 0x48, 0x01,
+    0x2B, 0x01, 0x48, 0x01, 0x2B, 0x01, 0x48, 0x01, 0x2B, 0x01, 0x74, 0x01,
+    0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01,
+    0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01, 0x74, 0x01,
+    0x74, 0x01, 0x18, 0x0B, 0x2C, 0x04, 0x0B, 0x04, 0x25, 0x03, 0x13, 0x03,
+    0x20, 0x02, 0x19, 0x02, 0x1C, 0x02, 0x1D, 0x02, 0x19, 0x01, 0x21, 0x01,
+    0x17, 0x01, 0x23, 0x01, 0x15, 0x01, 0x25, 0x01, 0x13, 0x01, 0x27, 0x01,
+    0x11, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x2B, 0x01, 0x0D, 0x01, 0x2D, 0x01,
+    0x46, 0x01, 0x14, 0x07, 0x14, 0x01, 0x09, 0x01, 0x12, 0x03, 0x07, 0x03,
+    0x12, 0x01, 0x19, 0x02, 0x0D, 0x01, 0x19, 0x01, 0x10, 0x01, 0x10, 0x02,
+    0x10, 0x01, 0x51, 0x01, 0x13, 0x01, 0x15, 0x01, 0x0F, 0x01, 0x15, 0x01,
+    0x0F, 0x01, 0x4E, 0x01, 0x17, 0x01, 0x12, 0x01, 0x37, 0x01, 0x4C, 0x01,
+    0x19, 0x01, 0x86, 0x01, 0x01, 0x39, 0x01, 0x66, 0x01, 0x1E, 0x01, 0xB8,
+    0x0C, 0x01, 0x1B, 0x01, 0x85, 0x01, 0x01, 0x39, 0x01, 0x4B, 0x01, 0x54,
+    0x01, 0x11, 0x01, 0x4A, 0x01, 0x27, 0x01, 0x2A, 0x01, 0x23, 0x01, 0x15,
+    0x01, 0x14, 0x01, 0x35, 0x01, 0x15, 0x01, 0x13, 0x01, 0x16, 0x01, 0x10,
+    0x01, 0x11, 0x01, 0x10, 0x01, 0x18, 0x02, 0x0D, 0x02, 0x19, 0x01, 0x12,
+    0x03, 0x08, 0x02, 0x12, 0x01, 0x1E, 0x08, 0x1E, 0x01, 0x2F, 0x01, 0x0B,
+    0x01, 0x2D, 0x01, 0x0D, 0x01, 0x66, 0x01, 0x0F, 0x01, 0x29, 0x01, 0x11,
+    0x02, 0x26, 0x01, 0x14, 0x01, 0x23, 0x02, 0x16, 0x01, 0x21, 0x01, 0x19,
+    0x02, 0x1D, 0x02, 0x1C, 0x02, 0x19, 0x02, 0x20, 0x03, 0x14, 0x02, 0x25,
+    0x03, 0x0D, 0x04, 0x00, 0x22, 0x37, 0x04, 0x37, 0x03, 0x37, 0x02, 0x37,
+    0x01, 0x37, 0x02, 0x37, 0x01, 0x37, 0x01, 0x37, 0x01, 0x37, 0x01, 0x6E,
+    0x01, 0x37, 0x01, 0x13, 0x10, 0x37, 0x02, 0x12, 0x01, 0x24, 0x01, 0x37,
+    0x01, 0x37, 0x01, 0x10, 0x01, 0x26, 0x01, 0x6E, 0x01, 0x0F, 0x01, 0x83,
+    0x02, 0x01, 0x92, 0x02, 0x01, 0xDA, 0x01, 0x01, 0x46, 0x01, 0x5C, 0x01,
+    0x35, 0x01, 0x10, 0x01, 0x24, 0x01, 0x34, 0x02, 0x24, 0x11, 0x13, 0x01,
+    0x35, 0x01, 0x6C, 0x01, 0x35, 0x01, 0x35, 0x01, 0x35, 0x01, 0x35, 0x01,
+    0x35, 0x01, 0x34, 0x02, 0x33, 0x02, 0x33, 0x02, 0x31, 0x04, 0x20, 0x13,
+    0x17, 0x0C, 0x2C, 0x04, 0x0C, 0x04, 0x26, 0x02, 0x14, 0x03, 0x21, 0x02,
+    0x19, 0x02, 0x1D, 0x02, 0x1D, 0x02, 0x1A, 0x01, 0x21, 0x01, 0x17, 0x02,
+    0x23, 0x01, 0x15, 0x01, 0x26, 0x01, 0x13, 0x01, 0x28, 0x01, 0x3C, 0x01,
+    0x10, 0x01, 0x2B, 0x01, 0x0E, 0x01, 0x2D, 0x01, 0x0C, 0x01, 0x50, 0x07,
+    0x14, 0x01, 0x0A, 0x01, 0x12, 0x03, 0x07, 0x03, 0x12, 0x01, 0x1A, 0x02,
+    0x0D, 0x01, 0x1A, 0x01, 0x10, 0x01, 0x10, 0x01, 0x29, 0x01, 0x12, 0x01,
+    0x10, 0x01, 0x06, 0x01, 0x24, 0x01, 0x26, 0x01, 0x15, 0x01, 0x0F, 0x01,
+    0x40, 0x01, 0x0F, 0x01, 0x17, 0x01, 0x4B, 0x01, 0x12, 0x01, 0x55, 0x01,
+    0x11, 0x01, 0xB1, 0x01, 0x01, 0x10, 0x01, 0xCF, 0x01, 0x01, 0x9F, 0x0B,
+    0x01, 0x97, 0x01, 0x01, 0x66, 0x01, 0x01, 0x01, 0xA1, 0x01, 0x01, 0x21,
+    0x01, 0x64, 0x01, 0x03, 0x01, 0x0F, 0x01, 0x17, 0x01, 0x60, 0x01, 0x15,
+    0x01, 0x0F, 0x01, 0x05, 0x01, 0x24, 0x01, 0x27, 0x01, 0x2B, 0x01, 0x10,
+    0x01, 0x10, 0x02, 0x10, 0x01, 0x19, 0x02, 0x0D, 0x01, 0x1B, 0x01, 0x12,
+    0x02, 0x08, 0x03, 0x12, 0x01, 0x1E, 0x08, 0x14, 0x01, 0x0B, 0x01, 0x3C,
+    0x01, 0x2D, 0x01, 0x0E, 0x01, 0x2B, 0x01, 0x3A, 0x01, 0x11, 0x01, 0x28,
+    0x01, 0x13, 0x01, 0x26, 0x01, 0x15, 0x02, 0x3C, 0x01, 0x23, 0x01, 0x18,
+    0x02, 0x22, 0x02, 0x18, 0x02, 0x22, 0x01, 0x19, 0x02, 0x21, 0x01, 0x1A,
+    0x05, 0x1D, 0x01, 0x1E, 0x0B, 0x13, 0x01, 0x28, 0x01, 0x13, 0x01, 0x28,
+    0x02, 0x12, 0x01, 0x29, 0x01, 0x12, 0x01, 0x29, 0x01, 0x12, 0x01, 0x29,
+    0x01, 0x3C, 0x01, 0x10, 0x01, 0x2B, 0x01, 0x0E, 0x01, 0x2D, 0x01, 0x0C,
+    0x01, 0x2F, 0x01, 0x0A, 0x01, 0x31, 0x01, 0x08, 0x01, 0x33, 0x01, 0x06,
+    0x01, 0x35, 0x01, 0x03, 0x02, 0x37, 0x01, 0x01, 0x01, 0x00, 0x21, 0x37,
+    0x04, 0x37, 0x03, 0x37, 0x02, 0x37, 0x02, 0x37, 0x01, 0x37, 0x01, 0x37,
+    0x01, 0x37, 0x01, 0x37, 0x01, 0x6E, 0x01, 0x4C, 0x0F, 0x13, 0x01, 0x23,
+    0x02, 0x37, 0x01, 0x37, 0x01, 0x10, 0x01, 0x5D, 0x01, 0x6E, 0x01, 0x46,
+    0x01, 0xEE, 0x03, 0x01, 0x5D, 0x01, 0x6C, 0x01, 0x46, 0x01, 0x25, 0x01,
+    0x34, 0x02, 0x10, 0x01, 0x22, 0x02, 0x27, 0x0E, 0x13, 0x01, 0x6C, 0x01,
+    0x35, 0x01, 0x35, 0x01, 0x35, 0x01, 0x35, 0x01, 0x35, 0x01, 0x34, 0x02,
+    0xDA, 0x01, 0x01, 0x1D, 0x0A, 0x47, 0x01, 0x26, 0x01, 0x47, 0x01, 0x26,
+    0x01, 0x7E, 0x01, 0x26, 0x01, 0x47, 0x01, 0x26, 0x01, 0x47, 0x01, 0x26,
+    0x01, 0x7E, 0x01, 0x26, 0x01, 0x47, 0x01, 0x26, 0x01, 0x47, 0x01, 0x5D,
+    0x01, 0x47, 0x01, 0x26, 0x01, 0x47, 0x01, 0x5D, 0x01, 0x10, 0x01, 0x5D,
+    0x01, 0x47, 0x01, 0x26, 0x01, 0x47, 0x01, 0x5D, 0x01, 0x16, 0x0C, 0x26,
+    0x04, 0x0C, 0x04, 0x1F, 0x03, 0x14, 0x02, 0x1B, 0x02, 0x19, 0x02, 0x18,
+    0x01, 0x1D, 0x01, 0x15, 0x02, 0x1F, 0x02, 0x12, 0x01, 0x23, 0x01, 0x10,
+    0x01, 0x25, 0x01, 0x0E, 0x01, 0x27, 0x01, 0x0C, 0x01, 0x29, 0x01, 0x40,
+    0x01, 0x2B, 0x01, 0x08, 0x01, 0x2D, 0x01, 0x1A, 0x09, 0x19, 0x01, 0x11,
+    0x02, 0x09, 0x02, 0x11, 0x01, 0x16, 0x01, 0x0D, 0x01, 0x26, 0x01, 0x0F,
+    0x01, 0x36, 0x01, 0x0F, 0x01, 0x03, 0x01, 0x0F, 0x01, 0x48, 0x01, 0x57,
+    0x01, 0x23, 0x01, 0x92, 0x01, 0x01, 0x20, 0x01, 0x4B, 0x0F, 0x48, 0x01,
+    0x25, 0x01, 0x10, 0x01, 0x36, 0x01, 0x36, 0x02, 0x22, 0x01, 0x13, 0x01,
+    0x36, 0x02, 0x20, 0x01, 0x15, 0x02, 0x1F, 0x01, 0x16, 0x03, 0x36, 0x02,
+    0x1B, 0x01, 0x1A, 0x03, 0x19, 0x01, 0x1C, 0x02, 0x18, 0x01, 0x1D, 0x02,
+    0x17, 0x02, 0x1D, 0x01, 0x18, 0x01, 0x1D, 0x02, 0x17, 0x01, 0x1E, 0x01,
+    0x17, 0x02, 0x1D, 0x02, 0x17, 0x02, 0x1D, 0x01, 0x18, 0x02, 0x1C, 0x01,
+    0x19, 0x02, 0x1B, 0x01, 0x1A, 0x02, 0x1A, 0x01, 0x1B, 0x03, 0x36, 0x02,
+    0x16, 0x01, 0x1F, 0x02, 0x15, 0x01, 0x20, 0x02, 0x36, 0x02, 0x12, 0x01,
+    0x23, 0x01, 0x36, 0x01, 0x36, 0x01, 0x10, 0x01, 0x25, 0x01, 0x6C, 0x01,
+    0x0F, 0x10, 0x92, 0x01, 0x01, 0xB1, 0x01, 0x01, 0x81, 0x01, 0x01, 0x10,
+    0x01, 0x0F, 0x01, 0x36, 0x01, 0x12, 0x01, 0x23, 0x01, 0x21, 0x01, 0x02,
+    0x01, 0x11, 0x01, 0x0F, 0x01, 0x26, 0x02, 0x0B, 0x02, 0x15, 0x01, 0x13,
+    0x0B, 0x12, 0x01, 0x05, 0x01, 0x64, 0x01, 0x07, 0x01, 0x2C, 0x01, 0x09,
+    0x01, 0x36, 0x01, 0x29, 0x01, 0x0C, 0x01, 0x27, 0x01, 0x0E, 0x01, 0x24,
+    0x02, 0x10, 0x02, 0x21, 0x01, 0x14, 0x01, 0x1E, 0x02, 0x16, 0x02, 0x1A,
+    0x02, 0x1A, 0x03, 0x15, 0x02, 0x1F, 0x05, 0x0C, 0x04, 0x00, 0x39, 0xAC,
+    0x05, 0x15, 0x0F, 0x15, 0x00, 0x10, 0x17, 0x10, 0xE4, 0x19, 0x01, 0xDA,
+    0x01, 0x01, 0x10, 0x01, 0x15, 0x01, 0x48, 0x01, 0x0F, 0x01, 0x4A, 0x01,
+    0x0F, 0x01, 0x13, 0x01, 0x11, 0x01, 0x25, 0x01, 0x0F, 0x01, 0x15, 0x01,
+    0x11, 0x03, 0x0A, 0x02, 0x11, 0x01, 0x19, 0x0A, 0x19, 0x01, 0x2F, 0x01,
+    0x07, 0x01, 0x64, 0x01, 0x09, 0x01, 0x2B, 0x01, 0x0B, 0x01, 0x29, 0x01,
+    0x0D, 0x01, 0x27, 0x01, 0x0F, 0x01, 0x25, 0x01, 0x11, 0x01, 0x23, 0x01,
+    0x13, 0x02, 0x1F, 0x02, 0x16, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x15, 0x03,
+    0x1F, 0x04, 0x0D, 0x04, 0x00, 0x10, 0x1F, 0x11, 0x50, 0x01, 0x2F, 0x01,
+    0x3E, 0x01, 0x2E, 0x01, 0x62, 0x01, 0x2C, 0x01, 0x02, 0x01, 0x6B, 0x01,
+    0x4F, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x99, 0x01, 0x01, 0x4F, 0x01, 0x06,
+    0x01, 0x0F, 0x01, 0x97, 0x01, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x4F, 0x01,
+    0x70, 0x01, 0x24, 0x01, 0x0F, 0x01, 0x5A, 0x01, 0x63, 0x01, 0x0C, 0x01,
+    0x22, 0x01, 0x6C, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2F, 0x01, 0x6E, 0x01,
+    0x1F, 0x01, 0x10, 0x01, 0x5E, 0x01, 0x4E, 0x01, 0x12, 0x01, 0x0E, 0x01,
+    0x8D, 0x01, 0x01, 0x23, 0x01, 0x2A, 0x01, 0x23, 0x01, 0x8B, 0x01, 0x01,
+    0x0E, 0x01, 0x16, 0x01, 0x4E, 0x01, 0x71, 0x01, 0x17, 0x01, 0x0E, 0x01,
+    0x67, 0x01, 0x56, 0x01, 0x1A, 0x01, 0x15, 0x01, 0x78, 0x01, 0x14, 0x01,
+    0x1C, 0x01, 0x53, 0x01, 0x7A, 0x01, 0x12, 0x01, 0x1E, 0x01, 0x51, 0x01,
+    0x4D, 0x01, 0x20, 0x01, 0x0D, 0x01, 0x81, 0x01, 0x01, 0x30, 0x01, 0x1C,
+    0x01, 0x30, 0x01, 0x8D, 0x01, 0x01, 0x24, 0x01, 0x99, 0x01, 0x01, 0x26,
+    0x01, 0xD7, 0x01, 0x01, 0x28, 0x01, 0x95, 0x01, 0x01, 0x2A, 0x01, 0xD3,
+    0x01, 0x01, 0x2C, 0x01, 0x91, 0x01, 0x01, 0x2E, 0x01, 0x00, 0x0F, 0x14,
+    0x0D, 0x14, 0x0F, 0x0F, 0x01, 0x73, 0x01, 0x22, 0x01, 0x21, 0x01, 0x20,
+    0x01, 0x61, 0x01, 0xD7, 0x01, 0x01, 0x31, 0x01, 0x43, 0x01, 0x1F, 0x01,
+    0x20, 0x01, 0x0E, 0x01, 0xAC, 0x02, 0x01, 0x22, 0x01, 0x0E, 0x01, 0x0E,
+    0x01, 0x73, 0x01, 0x0E, 0x01, 0xDB, 0x01, 0x01, 0x22, 0x01, 0x1B, 0x01,
+    0x82, 0x01, 0x01, 0x15, 0x01, 0x80, 0x01, 0x01, 0x46, 0x01, 0x3C, 0x01,
+    0x38, 0x01, 0x9C, 0x01, 0x01, 0x17, 0x01, 0x74, 0x01, 0x09, 0x01, 0x30,
+    0x01, 0x3A, 0x01, 0x76, 0x01, 0x23, 0x01, 0x6C, 0x01, 0x21, 0x01, 0x38,
+    0x01, 0x0D, 0x01, 0x66, 0x01, 0x1A, 0x01, 0x21, 0x01, 0x76, 0x01, 0x3D,
+    0x01, 0x36, 0x01, 0x0F, 0x01, 0x3C, 0x01, 0x11, 0x01, 0x32, 0x01, 0x35,
+    0x01, 0x60, 0x01, 0x3F, 0x01, 0x34, 0x01, 0x11, 0x01, 0x4C, 0x01, 0x42,
+    0x01, 0x44, 0x01, 0x33, 0x01, 0x4F, 0x01, 0x10, 0x01, 0x35, 0x01, 0x3E,
+    0x01, 0x0B, 0x01, 0x89, 0x01, 0x01, 0x60, 0x01, 0x31, 0x01, 0x37, 0x01,
+    0x0B, 0x02, 0x2F, 0x01, 0x0B, 0x01, 0x8B, 0x01, 0x01, 0x90, 0x01, 0x01,
+    0x39, 0x01, 0x46, 0x01, 0xE0, 0x01, 0x01, 0x24, 0x01, 0x69, 0x01, 0x2D,
+    0x01, 0xE2, 0x01, 0x01, 0x24, 0x01, 0x42, 0x01, 0x24, 0x01, 0xB7, 0x02,
+    0x01, 0x2D, 0x01, 0x12, 0x01, 0x77, 0x01, 0xE6, 0x01, 0x01, 0x2D, 0x01,
+    0x10, 0x01, 0x77, 0x01, 0xE8, 0x01, 0x01, 0x01, 0x12, 0x19, 0x11, 0x01,
+    0x01, 0x29, 0x01, 0x10, 0x01, 0x13, 0x01, 0x2B, 0x01, 0x27, 0x01, 0x10,
+    0x01, 0x15, 0x01, 0x2B, 0x01, 0x25, 0x01, 0x10, 0x01, 0x43, 0x01, 0x10,
+    0x01, 0x23, 0x01, 0x2B, 0x01, 0x19, 0x01, 0x10, 0x01, 0x21, 0x01, 0x2B,
+    0x01, 0x1B, 0x01, 0x10, 0x01, 0x1F, 0x01, 0x2B, 0x01, 0x1D, 0x01, 0x10,
+    0x01, 0x1D, 0x01, 0x4B, 0x01, 0x1C, 0x01, 0x0F, 0x01, 0x20, 0x01, 0x2C,
+    0x01, 0x1A, 0x01, 0x0F, 0x01, 0x22, 0x01, 0x2C, 0x01, 0x18, 0x01, 0x0F,
+    0x01, 0x24, 0x01, 0x2C, 0x01, 0x26, 0x01, 0x26, 0x01, 0x05, 0x01, 0x26,
+    0x01, 0x24, 0x01, 0x2C, 0x01, 0x28, 0x01, 0x0F, 0x01, 0x12, 0x01, 0x2C,
+    0x01, 0x2A, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x59, 0x01, 0x0F, 0x01, 0x0E,
+    0x01, 0x5B, 0x01, 0x1C, 0x01, 0x5D, 0x01, 0x1A, 0x01, 0x5F, 0x01, 0x18,
+    0x01, 0x61, 0x01, 0x16, 0x01, 0x63, 0x01, 0x14, 0x01, 0x65, 0x01, 0x12,
+    0x01, 0x29, 0x01, 0x12, 0x01, 0x65, 0x01, 0x14, 0x01, 0x63, 0x01, 0x16,
+    0x01, 0x61, 0x01, 0x18, 0x01, 0x5F, 0x01, 0x1A, 0x01, 0x5D, 0x01, 0x1C,
+    0x01, 0x5B, 0x01, 0x1E, 0x01, 0x2C, 0x01, 0x2C, 0x01, 0x10, 0x01, 0x0F,
+    0x01, 0x2A, 0x01, 0x2C, 0x01, 0x12, 0x01, 0x0F, 0x01, 0x55, 0x01, 0x0F,
+    0x01, 0x14, 0x01, 0x2C, 0x01, 0x26, 0x01, 0x0F, 0x01, 0x16, 0x01, 0x2C,
+    0x01, 0x24, 0x01, 0x0F, 0x01, 0x18, 0x01, 0x2C, 0x01, 0x22, 0x01, 0x0F,
+    0x01, 0x1A, 0x01, 0x4D, 0x01, 0x1B, 0x01, 0x10, 0x01, 0x1F, 0x01, 0x2B,
+    0x01, 0x1D, 0x01, 0x10, 0x01, 0x1D, 0x01, 0x2B, 0x01, 0x1F, 0x01, 0x10,
+    0x01, 0x1B, 0x01, 0x2B, 0x01, 0x32, 0x01, 0x2B, 0x01, 0x19, 0x01, 0x10,
+    0x01, 0x23, 0x01, 0x2B, 0x01, 0x17, 0x01, 0x10, 0x01, 0x25, 0x01, 0x2B,
+    0x01, 0x15, 0x01, 0x10, 0x01, 0x27, 0x01, 0x2B, 0x01, 0x13, 0x01, 0x3A,
+    0x01, 0x12, 0x01, 0x00, 0x11, 0x1B, 0x12, 0x10, 0x01, 0x67, 0x01, 0x01,
+    0x01, 0x29, 0x01, 0x23, 0x01, 0x28, 0x01, 0x2B, 0x01, 0x14, 0x01, 0x4D,
+    0x01, 0x26, 0x01, 0x05, 0x01, 0x25, 0x01, 0x4C, 0x01, 0x07, 0x01, 0x0F,
+    0x01, 0x50, 0x01, 0x0F, 0x01, 0x46, 0x01, 0x0F, 0x01, 0x4E, 0x01, 0x0F,
+    0x01, 0x0B, 0x01, 0x4C, 0x01, 0x1F, 0x01, 0x0D, 0x01, 0x1E, 0x01, 0x2D,
+    0x01, 0x1D, 0x01, 0x4C, 0x01, 0x1C, 0x01, 0x2F, 0x01, 0x1B, 0x01, 0x11,
+    0x01, 0x1A, 0x01, 0x4B, 0x01, 0x13, 0x01, 0x0E, 0x01, 0x46, 0x01, 0x0E,
+    0x01, 0x52, 0x01, 0x0E, 0x01, 0x44, 0x01, 0x0E, 0x01, 0x17, 0x01, 0x4B,
+    0x01, 0x14, 0x01, 0x19, 0x01, 0x13, 0x01, 0x37, 0x01, 0x12, 0x01, 0x58,
+    0x01, 0x11, 0x01, 0x39, 0x01, 0x10, 0x01, 0x1D, 0x01, 0x4C, 0x01, 0x0D,
+    0x01, 0x1F, 0x01, 0x0D, 0x01, 0x4A, 0x01, 0x5E, 0x01, 0x56, 0x01, 0x23,
+    0x01, 0x54, 0x01, 0x25, 0x01, 0x52, 0x01, 0x64, 0x01, 0x50, 0x01, 0x29,
+    0x01, 0x4E, 0x01, 0x2B, 0x01, 0x00, 0x36, 0x9B, 0x04, 0x01, 0x34, 0x01,
+    0x37, 0x24, 0x0F, 0x01, 0x25, 0x01, 0x34, 0x01, 0x0F, 0x01, 0x5A, 0x01,
+    0x0F, 0x01, 0x34, 0x01, 0x25, 0x01, 0x44, 0x01, 0x25, 0x01, 0x34, 0x01,
+    0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x34, 0x01, 0x25, 0x01, 0x44, 0x01,
+    0x25, 0x01, 0x34, 0x01, 0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x34, 0x01,
+    0x25, 0x01, 0x44, 0x01, 0x25, 0x01, 0x34, 0x01, 0x0F, 0x01, 0x5A, 0x01,
+    0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x24, 0x01, 0x0F, 0x01, 0x5A, 0x01,
+    0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x24, 0x01,
+    0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x5A, 0x01,
+    0x0F, 0x01, 0x24, 0x01, 0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x5A, 0x01,
+    0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x24, 0x01, 0x0F, 0x01, 0x5A, 0x01,
+    0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x5A, 0x01, 0x0F, 0x01, 0x24, 0x01,
+    0x0F, 0x01, 0x5A, 0x01, 0x10, 0x23, 0x37, 0x01, 0x00, 0x15, 0xF6, 0x01,
+    0x06, 0x86, 0x0F, 0x06, 0x00, 0x0F, 0x1D, 0x01, 0x0E, 0x01, 0x75, 0x01,
+    0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01, 0x3A, 0x01, 0x49, 0x01,
+    0x3A, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01,
+    0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01,
+    0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01,
+    0x3A, 0x01, 0x49, 0x01, 0x3A, 0x01, 0x49, 0x01, 0x3A, 0x01, 0x75, 0x01,
+    0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01,
+    0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01,
+    0x0E, 0x01, 0x75, 0x01, 0x3A, 0x01, 0x49, 0x01, 0x3A, 0x01, 0x49, 0x01,
+    0x3A, 0x01, 0x49, 0x01, 0x3A, 0x01, 0x75, 0x01, 0x0E, 0x01, 0x75, 0x01,
+    0x0E, 0x01, 0x00, 0x16, 0xF2, 0x01, 0x07, 0xE1, 0x0F, 0x07, 0x0E, 0x0B,
+    0x28, 0x01, 0x43, 0x01, 0x34, 0x01, 0x41, 0x01, 0x36, 0x01, 0x3F, 0x01,
+    0x38, 0x01, 0x3D, 0x01, 0x3A, 0x01, 0x3B, 0x01, 0x3C, 0x01, 0x1C, 0x02,
+    0x1B, 0x01, 0x16, 0x01, 0x42, 0x01, 0x1C, 0x01, 0x0D, 0x01, 0x0A, 0x01,
+    0x35, 0x01, 0x32, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x33, 0x01, 0x32, 0x01,
+    0x11, 0x01, 0x1C, 0x01, 0x14, 0x01, 0x32, 0x01, 0x13, 0x01, 0x1C, 0x01,
+    0x12, 0x01, 0x48, 0x01, 0x11, 0x01, 0x0A, 0x01, 0x10, 0x01, 0x4A, 0x01,
+    0x0F, 0x01, 0x1B, 0x01, 0x18, 0x01, 0x33, 0x01, 0x29, 0x01, 0x0B, 0x01,
+    0x0E, 0x01, 0x00, 0x2D, 0x00, 0x11, 0x0B, 0x01, 0x10, 0x01, 0x0B, 0x01,
+    0x10, 0x01, 0x0B, 0x01, 0x1C, 0x01, 0x0F, 0x01, 0x0C, 0x01, 0x0F, 0x01,
+    0x0C, 0x01, 0x1C, 0x01, 0x0E, 0x01, 0x29, 0x01, 0x0E, 0x01, 0x0D, 0x01,
+    0x0E, 0x01, 0x0D, 0x01, 0x1C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0D, 0x01,
+    0x0E, 0x01, 0x1C, 0x01, 0x0C, 0x01, 0x2B, 0x01, 0x0C, 0x01, 0x12, 0x0B,
+    0x20, 0x04, 0x0B, 0x04, 0x1A, 0x02, 0x13, 0x02, 0x16, 0x02, 0x17, 0x02,
+    0x13, 0x01, 0x1B, 0x01, 0x10, 0x02, 0x1D, 0x01, 0x0E, 0x01, 0x20, 0x01,
+    0x0C, 0x01, 0x22, 0x01, 0x2F, 0x01, 0x09, 0x01, 0x2D, 0x01, 0x26, 0x01,
+    0x35, 0x01, 0x10, 0x07, 0x27, 0x01, 0x07, 0x02, 0x0F, 0x01, 0x14, 0x01,
+    0x1E, 0x01, 0x0E, 0x01, 0x0B, 0x01, 0x8D, 0x01, 0x01, 0x41, 0x0F, 0xED,
+    0x01, 0x0C, 0x1F, 0x04, 0x28, 0x03, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x01,
+    0x2D, 0x01, 0x2D, 0x01, 0x2D, 0x01, 0x41, 0x08, 0x13, 0x01, 0x10, 0x03,
+    0x2B, 0x01, 0x1D, 0x01, 0x0F, 0x01, 0x2D, 0x01, 0x1E, 0x01, 0x3D, 0x01,
+    0x85, 0x03, 0x01, 0x20, 0x01, 0x0C, 0x01, 0x22, 0x01, 0x0A, 0x01, 0x24,
+    0x01, 0x06, 0x03, 0x14, 0x01, 0x11, 0x06, 0x43, 0x01, 0x03, 0x01, 0x5E,
+    0x01, 0x2F, 0x01, 0x48, 0x01, 0x15, 0x01, 0x19, 0x01, 0x0E, 0x01, 0x06,
+    0x02, 0x15, 0x01, 0x19, 0x01, 0x12, 0x02, 0x1B, 0x02, 0x0F, 0x01, 0x14,
+    0x01, 0x0A, 0x03, 0x09, 0x03, 0x06, 0x10, 0x00, 0x0F, 0xE9, 0x09, 0x09,
+    0x24, 0x03, 0x09, 0x03, 0x1F, 0x02, 0x0F, 0x02, 0x1C, 0x01, 0x13, 0x02,
+    0x19, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x15, 0x01, 0x1A, 0x01,
+    0x60, 0x01, 0x60, 0x01, 0x4A, 0x01, 0x15, 0x01, 0x15, 0x04, 0x01, 0x04,
+    0x26, 0x01, 0x09, 0x02, 0x23, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x11, 0x01,
+    0x2E, 0x01, 0x0F, 0x01, 0x90, 0x01, 0x01, 0x0E, 0x01, 0xFF, 0x08, 0x01,
+    0x20, 0x01, 0x4E, 0x01, 0x0F, 0x01, 0x20, 0x01, 0x30, 0x01, 0x0C, 0x01,
+    0x0F, 0x01, 0x13, 0x01, 0x0A, 0x01, 0x25, 0x04, 0x01, 0x05, 0x2A, 0x01,
+    0x15, 0x01, 0x5E, 0x01, 0x5E, 0x01, 0x12, 0x01, 0x1B, 0x01, 0x14, 0x01,
+    0x30, 0x01, 0x18, 0x01, 0x17, 0x01, 0x16, 0x01, 0x19, 0x01, 0x13, 0x02,
+    0x1B, 0x02, 0x0F, 0x02, 0x0A, 0x0E, 0x07, 0x03, 0x09, 0x03, 0x13, 0x0B,
+    0x20, 0x04, 0x0B, 0x04, 0x1A, 0x02, 0x13, 0x02, 0x16, 0x02, 0x17, 0x02,
+    0x13, 0x01, 0x1B, 0x01, 0x10, 0x02, 0x1D, 0x01, 0x0E, 0x01, 0x20, 0x01,
+    0x2F, 0x01, 0x0B, 0x01, 0x23, 0x01, 0x09, 0x01, 0x54, 0x01, 0x07, 0x01,
+    0x41, 0x03, 0x12, 0x01, 0x05, 0x01, 0x10, 0x03, 0x03, 0x03, 0x25, 0x01,
+    0x09, 0x01, 0x0F, 0x01, 0x03, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x21, 0x01,
+    0x3C, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x2C, 0x01, 0x20, 0x01, 0x7B, 0x01,
+    0x40, 0x0E, 0x2F, 0x01, 0xB3, 0x04, 0x01, 0xCA, 0x01, 0x01, 0x11, 0x0E,
+    0x5F, 0x01, 0x3D, 0x01, 0x0F, 0x01, 0x0D, 0x01, 0x40, 0x01, 0x0D, 0x01,
+    0x11, 0x01, 0x3E, 0x02, 0x09, 0x02, 0x0E, 0x01, 0x04, 0x01, 0x10, 0x03,
+    0x03, 0x03, 0x29, 0x03, 0x12, 0x01, 0x06, 0x01, 0x55, 0x01, 0x08, 0x01,
+    0x2F, 0x01, 0x23, 0x01, 0x2D, 0x01, 0x0C, 0x01, 0x20, 0x01, 0x0E, 0x02,
+    0x1D, 0x01, 0x11, 0x01, 0x1A, 0x02, 0x13, 0x02, 0x17, 0x01, 0x17, 0x02,
+    0x12, 0x03, 0x1A, 0x04, 0x0B, 0x03, 0x21, 0x0F, 0xC0, 0x09, 0x09, 0x24,
+    0x03, 0x09, 0x02, 0x20, 0x02, 0x0E, 0x02, 0x1C, 0x02, 0x12, 0x01, 0x1A,
+    0x01, 0x15, 0x01, 0x18, 0x01, 0x17, 0x01, 0x16, 0x01, 0x19, 0x01, 0x14,
+    0x01, 0x5E, 0x01, 0x5E, 0x01, 0x44, 0x01, 0x19, 0x01, 0x11, 0x04, 0x01,
+    0x04, 0x26, 0x01, 0x09, 0x02, 0x23, 0x01, 0x0C, 0x01, 0x21, 0x01, 0x1F,
+    0x01, 0x1E, 0x01, 0x1F, 0x01, 0xBE, 0x01, 0x01, 0x20, 0x01, 0xDF, 0x06,
+    0x01, 0x3E, 0x01, 0xC0, 0x01, 0x01, 0x20, 0x01, 0x1E, 0x01, 0x20, 0x01,
+    0x30, 0x01, 0x0C, 0x01, 0x12, 0x01, 0x10, 0x01, 0x09, 0x02, 0x25, 0x09,
+    0x46, 0x01, 0x60, 0x01, 0x30, 0x01, 0x4B, 0x01, 0x14, 0x01, 0x19, 0x01,
+    0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x15, 0x01, 0x1A, 0x02, 0x12, 0x01,
+    0x1D, 0x02, 0x0E, 0x02, 0x20, 0x03, 0x09, 0x02, 0x07, 0x0E, 0x13, 0x0B,
+    0x21, 0x04, 0x0B, 0x04, 0x1B, 0x02, 0x13, 0x02, 0x17, 0x02, 0x17, 0x01,
+    0x15, 0x01, 0x1A, 0x02, 0x11, 0x02, 0x1D, 0x01, 0x0F, 0x01, 0x20, 0x01,
+    0x0D, 0x01, 0x22, 0x01, 0x3B, 0x01, 0x24, 0x01, 0x09, 0x01, 0x26, 0x01,
+    0x37, 0x01, 0x13, 0x03, 0x12, 0x01, 0x17, 0x03, 0x03, 0x03, 0x15, 0x01,
+    0x0F, 0x02, 0x09, 0x01, 0x23, 0x01, 0x0C, 0x01, 0x0E, 0x01, 0x33, 0x01,
+    0x0E, 0x01, 0x0E, 0x01, 0x6E, 0x01, 0x10, 0x01, 0x10, 0x01, 0x0F, 0x01,
+    0xFE, 0x01, 0x12, 0x6E, 0x01, 0x8F, 0x03, 0x21, 0xFF, 0x01, 0x01, 0x20,
+    0x01, 0x6F, 0x01, 0x17, 0x01, 0x2E, 0x01, 0x01, 0x01, 0x07, 0x01, 0x0F,
+    0x01, 0x13, 0x02, 0x03, 0x01, 0x17, 0x01, 0x11, 0x01, 0x0D, 0x01, 0x10,
+    0x02, 0x0D, 0x02, 0x07, 0x01, 0x19, 0x04, 0x04, 0x05, 0x0A, 0x01, 0x06,
+    0x01, 0x15, 0x04, 0x40, 0x01, 0x06, 0x01, 0x29, 0x01, 0x06, 0x01, 0x28,
+    0x01, 0x07, 0x01, 0x26, 0x01, 0x2E, 0x01, 0x0A, 0x02, 0x22, 0x01, 0x0D,
+    0x01, 0x20, 0x01, 0x0F, 0x01, 0x1D, 0x02, 0x11, 0x02, 0x19, 0x02, 0x15,
+    0x03, 0x14, 0x02, 0x1A, 0x04, 0x0C, 0x04, 0x16, 0x0A, 0x15, 0x03, 0x0A,
+    0x02, 0x11, 0x02, 0x1E, 0x02, 0x1F, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x20, 0x01, 0x42, 0x01, 0x64, 0x01, 0x11, 0x08, 0x18, 0x02, 0x41,
+    0x01, 0x33, 0x01, 0x0E, 0x01, 0xBD, 0x02, 0x07, 0x0F, 0x0A, 0xD6, 0x02,
+    0x07, 0x0F, 0x0A, 0x11, 0x09, 0x24, 0x04, 0x09, 0x03, 0x06, 0x0E, 0x0B,
+    0x02, 0x10, 0x01, 0x1D, 0x01, 0x13, 0x02, 0x1A, 0x01, 0x16, 0x01, 0x17,
+    0x02, 0x18, 0x01, 0x31, 0x01, 0x14, 0x01, 0x2F, 0x01, 0x60, 0x01, 0x60,
+    0x01, 0x15, 0x01, 0x2C, 0x04, 0x01, 0x04, 0x15, 0x01, 0x10, 0x02, 0x09,
+    0x02, 0x31, 0x01, 0x22, 0x01, 0x2F, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x3F,
+    0x01, 0xF3, 0x01, 0x01, 0x21, 0x01, 0xAD, 0x05, 0x01, 0x3F, 0x01, 0xF5,
+    0x01, 0x01, 0x21, 0x01, 0x40, 0x01, 0x40, 0x01, 0x21, 0x01, 0x0D, 0x01,
+    0x12, 0x01, 0x10, 0x02, 0x09, 0x02, 0x26, 0x09, 0x16, 0x01, 0x62, 0x01,
+    0x62, 0x01, 0x31, 0x01, 0x31, 0x01, 0x19, 0x01, 0x17, 0x01, 0x17, 0x01,
+    0x19, 0x01, 0x15, 0x01, 0x1B, 0x01, 0x13, 0x01, 0x1D, 0x02, 0x0F, 0x02,
+    0x20, 0x03, 0x09, 0x03, 0x25, 0x09, 0xCC, 0x01, 0x01, 0x0E, 0x01, 0x6B,
+    0x02, 0x15, 0x01, 0x1B, 0x01, 0x2D, 0x01, 0x03, 0x02, 0x11, 0x01, 0x0F,
+    0x01, 0x0F, 0x02, 0x0E, 0x01, 0x19, 0x01, 0x08, 0x03, 0x08, 0x03, 0x26,
+    0x08, 0x13, 0x01, 0x08, 0x01, 0x57, 0x01, 0x08, 0x01, 0x26, 0x01, 0x2F,
+    0x01, 0x2F, 0x01, 0x0B, 0x02, 0x22, 0x01, 0x0E, 0x01, 0x20, 0x01, 0x10,
+    0x02, 0x1D, 0x01, 0x13, 0x02, 0x19, 0x02, 0x16, 0x03, 0x13, 0x03, 0x1B,
+    0x04, 0x0B, 0x04, 0x00, 0x0F, 0xB5, 0x09, 0x09, 0x22, 0x03, 0x09, 0x03,
+    0x1E, 0x01, 0x0F, 0x02, 0x1A, 0x02, 0x12, 0x01, 0x18, 0x01, 0x15, 0x01,
+    0x16, 0x01, 0x17, 0x01, 0x14, 0x01, 0x19, 0x01, 0x5C, 0x01, 0x5C, 0x01,
+    0x71, 0x08, 0x11, 0x01, 0x12, 0x02, 0x08, 0x02, 0x21, 0x01, 0x3A, 0x01,
+    0x1F, 0x01, 0x6A, 0x01, 0x3C, 0x01, 0x05, 0x07, 0x08, 0x02, 0x07, 0x02,
+    0x05, 0x01, 0x0B, 0x01, 0x14, 0x01, 0x0D, 0x01, 0x12, 0x01, 0x0F, 0x01,
+    0x33, 0x01, 0x0F, 0x01, 0x12, 0x01, 0x0D, 0x01, 0x14, 0x01, 0x0B, 0x01,
+    0x05, 0x02, 0x07, 0x02, 0x08, 0x07, 0x7D, 0x0F, 0x0E, 0x06, 0x11, 0x02,
+    0x06, 0x02, 0x0E, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0C, 0x01, 0x19, 0x01,
+    0x09, 0x01, 0x95, 0x01, 0x01, 0x27, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0C,
+    0x01, 0x0A, 0x01, 0x0E, 0x02, 0x06, 0x02, 0x11, 0x06, 0xBE, 0x01, 0x0F,
+    0xDF, 0x0D, 0x01, 0x27, 0x01, 0x08, 0x01, 0x10, 0x08, 0x41, 0x01, 0x30,
+    0x01, 0x30, 0x01, 0x17, 0x01, 0x2F, 0x02, 0x16, 0x01, 0x16, 0x02, 0x08,
+    0x02, 0x0A, 0x03, 0x00, 0x0F, 0xD5, 0x0A, 0x11, 0x20, 0x01, 0x30, 0x01,
+    0x11, 0x01, 0x30, 0x01, 0x1F, 0x01, 0x10, 0x01, 0x1F, 0x01, 0x42, 0x01,
+    0x1F, 0x01, 0x10, 0x01, 0x51, 0x01, 0x10, 0x01, 0x1F, 0x01, 0x10, 0x01,
+    0x30, 0x01, 0x20, 0x01, 0x30, 0x01, 0x10, 0x01, 0x30, 0x01, 0x20, 0x01,
+    0x0F, 0x01, 0x20, 0x01, 0x41, 0x01, 0x20, 0x01, 0x0F, 0x01, 0x20, 0x01,
+    0x41, 0x01, 0x20, 0x01, 0x0F, 0x01, 0x20, 0x01, 0x0F, 0x01, 0x62, 0x01,
+    0x30, 0x01, 0x31, 0x01, 0x64, 0x01, 0x64, 0x01, 0x64, 0x01, 0x32, 0x01,
+    0x64, 0x01, 0x54, 0x01, 0x0F, 0x01, 0x20, 0x01, 0x01, 0x01, 0x41, 0x01,
+    0x1E, 0x01, 0x03, 0x01, 0x2C, 0x01, 0x14, 0x01, 0x1B, 0x01, 0x06, 0x01,
+    0x0F, 0x01, 0x54, 0x01, 0x0F, 0x01, 0x54, 0x01, 0x0F, 0x01, 0x54, 0x01,
+    0x0F, 0x01, 0x32, 0x01, 0x21, 0x01, 0x42, 0x01, 0x21, 0x01, 0x42, 0x01,
+    0x21, 0x01, 0x42, 0x01, 0x21, 0x01, 0x42, 0x01, 0x21, 0x01, 0x10, 0x01,
+    0x53, 0x01, 0x10, 0x01, 0x00, 0x0F, 0x19, 0x08, 0x15, 0x09, 0x0C, 0x0E,
+    0x08, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x09, 0x03, 0x1D, 0x02, 0x0E, 0x02,
+    0x0B, 0x02, 0x0F, 0x02, 0x19, 0x02, 0x12, 0x01, 0x08, 0x02, 0x13, 0x01,
+    0x14, 0x01, 0x02, 0x01, 0x15, 0x01, 0x06, 0x01, 0x16, 0x01, 0x15, 0x01,
+    0x17, 0x01, 0x04, 0x01, 0x18, 0x01, 0x13, 0x01, 0x19, 0x01, 0x02, 0x01,
+    0x1A, 0x01, 0x78, 0x02, 0x1C, 0x01, 0x96, 0x01, 0x01, 0xAA, 0x01, 0x08,
+    0x16, 0x08, 0x24, 0x01, 0x08, 0x01, 0x14, 0x01, 0x08, 0x01, 0x10, 0x01,
+    0x11, 0x01, 0x0A, 0x01, 0x12, 0x01, 0x0A, 0x01, 0x20, 0x01, 0x2A, 0x01,
+    0x1E, 0x01, 0x0D, 0x01, 0x10, 0x01, 0x94, 0x01, 0x01, 0xD1, 0x01, 0x01,
+    0x1D, 0x01, 0x19, 0x08, 0x0D, 0x0E, 0x08, 0x03, 0x08, 0x03, 0x1E, 0x02,
+    0x0E, 0x02, 0x1A, 0x02, 0x12, 0x01, 0x18, 0x01, 0x15, 0x01, 0x16, 0x01,
+    0x17, 0x01, 0x14, 0x01, 0x19, 0x01, 0x12, 0x01, 0x49, 0x01, 0x5C, 0x01,
+    0x71, 0x08, 0x11, 0x01, 0x13, 0x01, 0x08, 0x02, 0x22, 0x01, 0x2C, 0x01,
+    0x0C, 0x01, 0x1F, 0x01, 0x6A, 0x01, 0x3C, 0x01, 0x14, 0x0B, 0x23, 0x04,
+    0x0B, 0x04, 0x1D, 0x02, 0x13, 0x02, 0x19, 0x02, 0x17, 0x02, 0x16, 0x01,
+    0x1B, 0x01, 0x13, 0x02, 0x1D, 0x01, 0x11, 0x01, 0x20, 0x01, 0x0F, 0x01,
+    0x22, 0x01, 0x32, 0x01, 0x0C, 0x01, 0x25, 0x01, 0x0A, 0x01, 0x27, 0x01,
+    0x3A, 0x01, 0x13, 0x03, 0x13, 0x01, 0x18, 0x03, 0x03, 0x03, 0x17, 0x01,
+    0x10, 0x01, 0x09, 0x01, 0x10, 0x01, 0x15, 0x01, 0x0B, 0x01, 0x14, 0x01,
+    0x0F, 0x01, 0x0D, 0x01, 0x41, 0x01, 0x12, 0x01, 0x0F, 0x01, 0x43, 0x01,
+    0x0E, 0x01, 0x43, 0x01, 0x0E, 0x01, 0xA5, 0x01, 0x01, 0x54, 0x01, 0x22,
+    0x01, 0xD0, 0x03, 0x01, 0x22, 0x01, 0x4F, 0x01, 0xE9, 0x01, 0x01, 0x10,
+    0x01, 0x11, 0x01, 0x10, 0x01, 0x73, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x03,
+    0x01, 0x0F, 0x01, 0x0D, 0x01, 0x24, 0x01, 0x0B, 0x01, 0x15, 0x01, 0x10,
+    0x01, 0x09, 0x01, 0x10, 0x01, 0x17, 0x03, 0x03, 0x03, 0x18, 0x01, 0x13,
+    0x03, 0x13, 0x01, 0x3A, 0x01, 0x27, 0x01, 0x0A, 0x01, 0x25, 0x01, 0x30,
+    0x01, 0x0D, 0x01, 0x22, 0x01, 0x0F, 0x01, 0x20, 0x01, 0x11, 0x02, 0x1D,
+    0x01, 0x14, 0x01, 0x1B, 0x01, 0x16, 0x02, 0x17, 0x02, 0x19, 0x02, 0x13,
+    0x02, 0x1D, 0x04, 0x0B, 0x04, 0x18, 0x09, 0x0F, 0x0E, 0x07, 0x03, 0x09,
+    0x03, 0x1F, 0x02, 0x0F, 0x02, 0x1C, 0x01, 0x13, 0x01, 0x1A, 0x01, 0x15,
+    0x02, 0x17, 0x01, 0x18, 0x01, 0x14, 0x02, 0x4A, 0x01, 0x30, 0x01, 0x60,
+    0x01, 0x4A, 0x01, 0x15, 0x01, 0x15, 0x04, 0x01, 0x04, 0x25, 0x02, 0x09,
+    0x01, 0x23, 0x01, 0x0C, 0x01, 0x10, 0x01, 0x1F, 0x01, 0x20, 0x01, 0x3F,
+    0x01, 0x6F, 0x01, 0x20, 0x01, 0x9F, 0x08, 0x01, 0x0E, 0x01, 0x9F, 0x01,
+    0x01, 0x0F, 0x01, 0x2E, 0x01, 0x0F, 0x01, 0x11, 0x01, 0x30, 0x02, 0x09,
+    0x02, 0x25, 0x03, 0x03, 0x03, 0x11, 0x01, 0x18, 0x03, 0x73, 0x01, 0x5E,
+    0x01, 0x2E, 0x01, 0x14, 0x01, 0x19, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18,
+    0x01, 0x15, 0x01, 0x1A, 0x01, 0x13, 0x01, 0x1C, 0x02, 0x0F, 0x02, 0x1F,
+    0x03, 0x09, 0x03, 0x24, 0x09, 0x10, 0x09, 0x24, 0x03, 0x09, 0x03, 0x07,
+    0x0D, 0x0B, 0x02, 0x0F, 0x01, 0x1C, 0x02, 0x12, 0x02, 0x19, 0x01, 0x16,
+    0x01, 0x02, 0x01, 0x14, 0x01, 0x18, 0x01, 0x15, 0x01, 0x2E, 0x01, 0x1B,
+    0x01, 0x42, 0x01, 0x5E, 0x01, 0x43, 0x03, 0x18, 0x01, 0x11, 0x03, 0x03,
+    0x04, 0x25, 0x01, 0x0A, 0x01, 0x23, 0x01, 0x0C, 0x01, 0x21, 0x01, 0x0E,
+    0x01, 0x10, 0x01, 0x3E, 0x01, 0xBE, 0x01, 0x01, 0x20, 0x01, 0xDF, 0x06,
+    0x01, 0x3E, 0x01, 0xC0, 0x01, 0x01, 0x20, 0x01, 0x3F, 0x01, 0x0E, 0x01,
+    0x21, 0x01, 0x0C, 0x01, 0x12, 0x01, 0x10, 0x01, 0x0A, 0x01, 0x25, 0x03,
+    0x03, 0x04, 0x29, 0x03, 0x19, 0x01, 0x60, 0x01, 0x30, 0x01, 0x60, 0x01,
+    0x30, 0x01, 0x18, 0x01, 0x17, 0x01, 0x16, 0x01, 0x19, 0x02, 0x12, 0x02,
+    0x1C, 0x02, 0x0F, 0x01, 0x20, 0x03, 0x09, 0x03, 0x24, 0x09, 0x16, 0x07,
+    0x01, 0x0E, 0x06, 0x02, 0x07, 0x01, 0x13, 0x01, 0x18, 0x01, 0x03, 0x01,
+    0x1C, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0x93, 0x02, 0x09, 0x13, 0x02, 0x1B,
+    0x01, 0x1C, 0x01, 0x1C, 0x01, 0x3A, 0x01, 0x11, 0x0C, 0x1E, 0x03, 0x0C,
+    0x03, 0x19, 0x02, 0x12, 0x03, 0x14, 0x02, 0x17, 0x01, 0x11, 0x02, 0x1A,
+    0x02, 0x0E, 0x01, 0x1E, 0x01, 0x0C, 0x01, 0x20, 0x01, 0x0A, 0x01, 0x22,
+    0x01, 0x2D, 0x01, 0x07, 0x01, 0x2B, 0x01, 0x26, 0x01, 0x18, 0x01, 0x29,
+    0x03, 0x01, 0x04, 0x10, 0x01, 0x03, 0x01, 0x0E, 0x02, 0x08, 0x01, 0x2D,
+    0x01, 0x20, 0x01, 0x39, 0x01, 0x0E, 0x01, 0x78, 0x0F, 0x10, 0x01, 0x2D,
+    0x01, 0x2D, 0x01, 0x2D, 0x02, 0x1A, 0x01, 0x12, 0x02, 0x2D, 0x02, 0x17,
+    0x01, 0x15, 0x02, 0x2D, 0x03, 0x13, 0x01, 0x19, 0x02, 0x12, 0x01, 0x1A,
+    0x02, 0x11, 0x01, 0x1B, 0x02, 0x10, 0x01, 0x1C, 0x01, 0x10, 0x02, 0x1B,
+    0x02, 0x10, 0x01, 0x1C, 0x01, 0x10, 0x02, 0x1B, 0x01, 0x11, 0x02, 0x1A,
+    0x01, 0x12, 0x02, 0x19, 0x01, 0x13, 0x03, 0x2D, 0x02, 0x15, 0x01, 0x17,
+    0x02, 0x2D, 0x02, 0x2D, 0x02, 0x10, 0x01, 0x1C, 0x01, 0x2D, 0x01, 0x0F,
+    0x0E, 0x3D, 0x01, 0x49, 0x01, 0x1E, 0x01, 0x1D, 0x01, 0x1D, 0x01, 0x2D,
+    0x01, 0x0C, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x22,
+    0x0A, 0x13, 0x01, 0x28, 0x01, 0x31, 0x01, 0x26, 0x01, 0x06, 0x01, 0x24,
+    0x01, 0x08, 0x01, 0x2D, 0x01, 0x21, 0x01, 0x0B, 0x01, 0x1E, 0x02, 0x0D,
+    0x01, 0x1C, 0x01, 0x10, 0x02, 0x18, 0x02, 0x13, 0x02, 0x14, 0x02, 0x17,
+    0x04, 0x0C, 0x04, 0x08, 0x0F, 0xE9, 0x03, 0x08, 0x0F, 0x09, 0xC0, 0x02,
+    0x08, 0x0F, 0x09, 0x97, 0x09, 0x01, 0x20, 0x01, 0x0F, 0x01, 0x10, 0x07,
+    0x69, 0x01, 0x40, 0x01, 0x40, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x02,
+    0x20, 0x03, 0x09, 0x04, 0x00, 0x0F, 0x10, 0x0F, 0xF7, 0x0F, 0x01, 0x0E,
+    0x01, 0x3D, 0x01, 0x1C, 0x01, 0x20, 0x01, 0x0B, 0x01, 0x22, 0x01, 0x08,
+    0x02, 0x24, 0x08, 0x15, 0x01, 0x8A, 0x01, 0x01, 0x5C, 0x01, 0x2E, 0x01,
+    0x19, 0x01, 0x14, 0x01, 0x17, 0x01, 0x01, 0x01, 0x14, 0x01, 0x15, 0x01,
+    0x18, 0x01, 0x13, 0x01, 0x1A, 0x02, 0x0F, 0x02, 0x1D, 0x03, 0x09, 0x03,
+    0x07, 0x0E, 0x00, 0x0F, 0x12, 0x0F, 0x0F, 0x01, 0x40, 0x01, 0x0F, 0x01,
+    0x2E, 0x01, 0x61, 0x01, 0x0E, 0x01, 0x3E, 0x01, 0x0E, 0x01, 0x63, 0x01,
+    0x0E, 0x01, 0x1B, 0x01, 0x50, 0x01, 0x14, 0x01, 0x58, 0x01, 0x15, 0x01,
+    0x3A, 0x01, 0x16, 0x01, 0x56, 0x01, 0x39, 0x01, 0x0D, 0x01, 0x38, 0x01,
+    0x0D, 0x01, 0x6B, 0x01, 0x0D, 0x01, 0x44, 0x01, 0x21, 0x01, 0x1B, 0x01,
+    0x50, 0x01, 0x1C, 0x01, 0x34, 0x01, 0x1D, 0x01, 0x4E, 0x01, 0x1E, 0x01,
+    0x22, 0x01, 0x3F, 0x01, 0x0C, 0x01, 0x73, 0x01, 0x0C, 0x01, 0x3D, 0x01,
+    0x22, 0x01, 0x22, 0x01, 0x48, 0x01, 0x77, 0x01, 0x46, 0x01, 0x79, 0x01,
+    0x14, 0x01, 0x7B, 0x01, 0x42, 0x01, 0x7D, 0x01, 0x40, 0x01, 0x4F, 0x01,
+    0x3E, 0x01, 0x00, 0x0F, 0x0F, 0x0B, 0x0F, 0x10, 0x8C, 0x01, 0x01, 0x1D,
+    0x01, 0x0B, 0x01, 0xAC, 0x01, 0x01, 0x0D, 0x01, 0x27, 0x01, 0x0D, 0x01,
+    0x1D, 0x01, 0x0D, 0x01, 0xF3, 0x01, 0x01, 0x0D, 0x01, 0x0A, 0x01, 0x0F,
+    0x01, 0x18, 0x01, 0x38, 0x01, 0xA1, 0x01, 0x01, 0x16, 0x01, 0x11, 0x01,
+    0x5D, 0x01, 0x14, 0x01, 0x23, 0x01, 0x71, 0x01, 0x13, 0x01, 0x1D, 0x01,
+    0x3D, 0x01, 0xA4, 0x01, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x17,
+    0x01, 0x1D, 0x01, 0x64, 0x01, 0x63, 0x01, 0x17, 0x01, 0x2A, 0x01, 0x0E,
+    0x01, 0x01, 0x01, 0x28, 0x01, 0x2C, 0x01, 0x0C, 0x01, 0x63, 0x01, 0x19,
+    0x01, 0x37, 0x01, 0x03, 0x01, 0x28, 0x01, 0x53, 0x01, 0x2A, 0x01, 0x1C,
+    0x01, 0x1B, 0x02, 0x34, 0x01, 0x05, 0x01, 0x6F, 0x01, 0x35, 0x01, 0x6E,
+    0x01, 0x07, 0x01, 0xB6, 0x01, 0x01, 0x33, 0x01, 0x27, 0x01, 0x09, 0x01,
+    0xB6, 0x01, 0x01, 0x59, 0x01, 0x0B, 0x01, 0x12, 0x01, 0xEA, 0x01, 0x01,
+    0x10, 0x01, 0x0D, 0x01, 0x10, 0x01, 0xEC, 0x01, 0x01, 0x0E, 0x01, 0x0F,
+    0x01, 0x55, 0x01, 0xB4, 0x01, 0x01, 0x11, 0x01, 0x27, 0x01, 0x2B, 0x01,
+    0x01, 0x10, 0x0F, 0x10, 0x33, 0x01, 0x0F, 0x01, 0x1D, 0x01, 0x20, 0x01,
+    0x13, 0x01, 0x0F, 0x01, 0x1B, 0x01, 0x05, 0x01, 0x1A, 0x01, 0x25, 0x01,
+    0x19, 0x01, 0x07, 0x01, 0x18, 0x01, 0x27, 0x01, 0x17, 0x01, 0x09, 0x01,
+    0x16, 0x01, 0x0E, 0x01, 0x1A, 0x01, 0x21, 0x01, 0x23, 0x01, 0x1C, 0x01,
+    0x04, 0x01, 0x1C, 0x01, 0x21, 0x01, 0x1E, 0x01, 0x02, 0x01, 0x1E, 0x01,
+    0x1F, 0x01, 0x20, 0x02, 0x20, 0x01, 0x1D, 0x01, 0x44, 0x01, 0x1B, 0x01,
+    0x46, 0x01, 0x19, 0x01, 0x48, 0x01, 0x17, 0x01, 0x2F, 0x01, 0x1A, 0x01,
+    0x45, 0x01, 0x1C, 0x01, 0x43, 0x01, 0x1E, 0x01, 0x41, 0x01, 0x30, 0x01,
+    0x1F, 0x01, 0x42, 0x01, 0x1D, 0x01, 0x13, 0x01, 0x4C, 0x01, 0x15, 0x01,
+    0x4A, 0x01, 0x17, 0x01, 0x48, 0x01, 0x19, 0x01, 0x46, 0x01, 0x1B, 0x01,
+    0x44, 0x01, 0x0E, 0x01, 0x0E, 0x01, 0x42, 0x01, 0x0E, 0x01, 0x01, 0x01,
+    0x0E, 0x01, 0x40, 0x01, 0x0E, 0x01, 0x03, 0x01, 0x0E, 0x01, 0x3E, 0x01,
+    0x14, 0x01, 0x0E, 0x01, 0x1B, 0x01, 0x15, 0x01, 0x0A, 0x01, 0x16, 0x01,
+    0x28, 0x01, 0x17, 0x01, 0x08, 0x01, 0x18, 0x01, 0x16, 0x01, 0x0F, 0x01,
+    0x19, 0x01, 0x36, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x0F, 0x01, 0x34, 0x01,
+    0x0F, 0x01, 0x0D, 0x01, 0x0F, 0x01, 0x32, 0x01, 0x0F, 0x01, 0x0F, 0x01,
+    0x0F, 0x01, 0x00, 0x10, 0x12, 0x10, 0x0F, 0x01, 0x41, 0x01, 0x3F, 0x01,
+    0x01, 0x01, 0x71, 0x01, 0x0E, 0x01, 0x3F, 0x01, 0x03, 0x01, 0x71, 0x01,
+    0x0C, 0x01, 0x0E, 0x01, 0x05, 0x01, 0xAD, 0x01, 0x01, 0x0E, 0x01, 0x07,
+    0x01, 0x0E, 0x01, 0x7A, 0x01, 0x09, 0x01, 0x3F, 0x01, 0x08, 0x01, 0x6F,
+    0x01, 0x0B, 0x01, 0x46, 0x01, 0x29, 0x01, 0x14, 0x01, 0x0D, 0x01, 0x75,
+    0x01, 0x1D, 0x01, 0x0D, 0x01, 0x12, 0x01, 0x83, 0x01, 0x01, 0x0D, 0x01,
+    0x11, 0x01, 0x0D, 0x01, 0x85, 0x01, 0x01, 0x0E, 0x01, 0x0D, 0x01, 0x52,
+    0x01, 0x3E, 0x01, 0x15, 0x01, 0x93, 0x01, 0x01, 0x18, 0x01, 0x91, 0x01,
+    0x01, 0x19, 0x01, 0x77, 0x01, 0x1B, 0x01, 0xA6, 0x01, 0x01, 0x1D, 0x01,
+    0x73, 0x01, 0x1F, 0x01, 0xA2, 0x01, 0x01, 0x21, 0x01, 0x6F, 0x01, 0x84,
+    0x01, 0x01, 0x3D, 0x01, 0x53, 0x01, 0x3D, 0x01, 0x22, 0x01, 0x60, 0x01,
+    0x2E, 0x02, 0x0E, 0x01, 0x1A, 0x06, 0x40, 0x01, 0x60, 0x01, 0x60, 0x01,
+    0x60, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2E, 0x02, 0x22, 0x02,
+    0x08, 0x03, 0x00, 0x2B, 0xAD, 0x03, 0x01, 0x29, 0x01, 0x01, 0x19, 0x2A,
+    0x01, 0x0F, 0x01, 0x29, 0x01, 0x1A, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x44,
+    0x01, 0x0F, 0x01, 0x29, 0x01, 0x1A, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x29,
+    0x01, 0x1A, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x44, 0x01, 0x0F, 0x01, 0x29,
+    0x01, 0x1A, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x29, 0x01, 0x1A, 0x01, 0x29,
+    0x01, 0x0F, 0x01, 0x29, 0x01, 0x1A, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x44,
+    0x01, 0x0F, 0x01, 0x29, 0x01, 0x1A, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x29,
+    0x01, 0x1A, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x44, 0x01, 0x0F, 0x01, 0x29,
+    0x01, 0x1A, 0x01, 0x29, 0x01, 0x0F, 0x01, 0x29, 0x01, 0x1A, 0x01, 0x0F,
+    0x1B, 0x19, 0x02, 0x19, 0x02, 0x19, 0x02, 0x19, 0x02, 0x06, 0x01, 0x13,
+    0x01, 0x1B, 0x01, 0x1B, 0x01, 0x0B, 0x01, 0x0F, 0x01, 0x1B, 0x01, 0x1B,
+    0x01, 0x0E, 0x01, 0x1B, 0x01, 0x0D, 0x01, 0x0D, 0x01, 0x1B, 0x01, 0x0E,
+    0x01, 0x0C, 0x01, 0x2B, 0x01, 0x29, 0x01, 0x48, 0x01, 0x80, 0x01, 0x01,
+    0xB5, 0x04, 0x01, 0x46, 0x01, 0x0E, 0x01, 0x38, 0x01, 0x0D, 0x01, 0x0D,
+    0x01, 0x1A, 0x02, 0x0E, 0x01, 0x09, 0x03, 0x2C, 0x01, 0x1B, 0x01, 0x1B,
+    0x01, 0x1B, 0x01, 0x1A, 0x02, 0x1B, 0x02, 0x1D, 0x01, 0x1D, 0x01, 0x1D,
+    0x01, 0x1D, 0x01, 0x0A, 0x03, 0x1D, 0x02, 0x0E, 0x01, 0x0E, 0x01, 0x1D,
+    0x01, 0x0D, 0x01, 0x2C, 0x01, 0x2A, 0x01, 0x2C, 0x01, 0xD1, 0x04, 0x01,
+    0x66, 0x01, 0x64, 0x01, 0x0F, 0x01, 0x2A, 0x01, 0x0F, 0x01, 0x2A, 0x01,
+    0x0F, 0x01, 0x0D, 0x01, 0x1D, 0x01, 0x0E, 0x01, 0x0E, 0x01, 0x0E, 0x01,
+    0x1D, 0x01, 0x1D, 0x01, 0x0B, 0x01, 0x11, 0x01, 0x1D, 0x01, 0x1D, 0x02,
+    0x06, 0x01, 0x16, 0x02, 0x1D, 0x02, 0x00, 0x0A, 0x03, 0x01, 0x1B, 0x01,
+    0x01, 0x03, 0x1D, 0x02, 0x1D, 0x01, 0x14, 0x01, 0x08, 0x02, 0x1D, 0x01,
+    0x1D, 0x01, 0x0F, 0x01, 0x0D, 0x01, 0x2B, 0x01, 0x0E, 0x01, 0x0E, 0x02,
+    0x0D, 0x01, 0x0F, 0x01, 0x2A, 0x01, 0x0F, 0x01, 0x2A, 0x01, 0x0F, 0x01,
+    0x64, 0x01, 0x2C, 0x01, 0xBB, 0x01, 0x01, 0xFC, 0x03, 0x01, 0x47, 0x01,
+    0x0F, 0x01, 0x2A, 0x01, 0x1D, 0x01, 0x0E, 0x01, 0x0E, 0x02, 0x0D, 0x01,
+    0x0F, 0x03, 0x28, 0x01, 0x1D, 0x01, 0x1D, 0x02, 0x1D, 0x01, 0x1C, 0x01,
+    0x1A, 0x02, 0x1A, 0x01, 0x1B, 0x01, 0x38, 0x01, 0x0F, 0x03, 0x09, 0x01,
+    0x0E, 0x02, 0x1A, 0x01, 0x1B, 0x01, 0x0E, 0x01, 0x29, 0x01, 0x2B, 0x01,
+    0x96, 0x04, 0x01, 0xBC, 0x01, 0x01, 0x29, 0x01, 0x48, 0x01, 0x29, 0x01,
+    0x0E, 0x01, 0x29, 0x01, 0x0E, 0x01, 0x1A, 0x02, 0x0D, 0x01, 0x0C, 0x01,
+    0x0E, 0x01, 0x2A, 0x01, 0x0D, 0x01, 0x1B, 0x01, 0x1A, 0x02, 0x11, 0x01,
+    0x08, 0x01, 0x1A, 0x02, 0x1A, 0x01, 0x17, 0x01, 0x01, 0x03, 0x0D, 0x07,
+    0x2D, 0x03, 0x07, 0x03, 0x29, 0x01, 0x0D, 0x02, 0x13, 0x0B, 0x07, 0x02,
+    0x10, 0x01, 0x23, 0x01, 0x13, 0x01, 0x10, 0x01, 0x10, 0x01, 0x15, 0x01,
+    0x1A, 0x01, 0x1C, 0x01, 0x1E, 0x01, 0x18, 0x01, 0x1C, 0x01, 0x1A, 0x01,
+    0x0B, 0x01, 0x2B, 0x01, 0x19, 0x01, 0x1D, 0x01, 0x08, 0x01, 0x2E, 0x01,
+    0x06, 0x01, 0x0C, 0x01, 0x23, 0x06, 0x10, 0x01, 0x0D, 0x05, 0x31, 0x01,
+    0x05, 0x02, 0x1E, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x2C, 0x01, 0x0A, 0x01,
+    0x1B, 0x01, 0x3A, 0x01, 0x17, 0x01, 0x19, 0x01, 0x1D, 0x01, 0x17, 0x01,
+    0x10, 0x01, 0x0E, 0x01, 0x15, 0x01, 0x21, 0x02, 0x12, 0x01, 0x24, 0x01,
+    0x10, 0x01, 0x08, 0x0B, 0x13, 0x02, 0x0C, 0x02, 0x29, 0x02, 0x08, 0x02};
+
+static const GFXglyph Roboto_Condensed_SemiBold60pt7bRLEGlyphs[] = {
+    {0, 1, 1, 27, 0, 0},           // 0x20 ' '
+    {0, 17, 85, 30, 7, -83},       // 0x21 '!'
+    {43, 28, 31, 38, 5, -88},      // 0x22 '"'
+    {60, 54, 84, 63, 5, -83},      // 0x23 '#'
+    {163, 48, 109, 59, 6, -96},    // 0x24 '$'
+    {422, 64, 86, 75, 6, -84},     // 0x25 '%'
+    {772, 61, 86, 67, 5, -84},     // 0x26 '&'
+    {1082, 12, 31, 19, 4, -88},    // 0x27 '''
+    {1089, 28, 120, 38, 7, -93},   // 0x28 '('
+    {1252, 28, 120, 38, 3, -93},   // 0x29 ')'
+    {1421, 50, 50, 53, 2, -83},    // 0x2A '*'
+    {1600, 48, 61, 57, 4, -69},    // 0x2B '+'
+    {1612, 19, 34, 28, 2, -13},    // 0x2C ','
+    {1655, 27, 12, 40, 6, -41},    // 0x2D '-'
+    {1657, 17, 17, 34, 8, -15},    // 0x2E '.'
+    {1691, 38, 91, 40, 0, -83},    // 0x2F '/'
+    {1797, 48, 86, 59, 6, -84},    // 0x30 '0'
+    {1972, 31, 84, 59, 9, -83},    // 0x31 '1'
+    {2015, 51, 85, 59, 4, -84},    // 0x32 '2'
+    {2219, 49, 86, 59, 4, -84},    // 0x33 '3'
+    {2439, 51, 84, 59, 4, -83},    // 0x34 '4'
+    {2534, 48, 85, 59, 6, -83},    // 0x35 '5'
+    {2695, 49, 85, 59, 6, -83},    // 0x36 '6'
+    {2916, 50, 84, 59, 4, -83},    // 0x37 '7'
+    {3032, 47, 86, 59, 6, -84},    // 0x38 '8'
+    {3299, 48, 85, 59, 5, -84},    // 0x39 '9'
+    {3518, 18, 65, 31, 7, -63},    // 0x3A ':'
+    {3597, 21, 84, 29, 3, -63},    // 0x3B ';'
+    {3683, 41, 55, 53, 4, -63},    // 0x3C '<'
+    {3821, 43, 38, 59, 8, -56},    // 0x3D '='
+    {3829, 43, 55, 54, 7, -63},    // 0x3E '>'
+    {3967, 45, 86, 52, 3, -84},    // 0x3F '?'
+    {4143, 81, 108, 90, 5, -81},   // 0x40 '@'
+    {4610, 66, 84, 70, 2, -83},    // 0x41 'A'
+    {4789, 53, 84, 66, 7, -83},    // 0x42 'B'
+    {4926, 57, 86, 67, 6, -84},    // 0x43 'C'
+    {5118, 54, 84, 67, 7, -83},    // 0x44 'D'
+    {5233, 48, 84, 58, 7, -83},    // 0x45 'E'
+    {5247, 46, 84, 56, 7, -83},    // 0x46 'F'
+    {5258, 57, 86, 69, 6, -84},    // 0x47 'G'
+    {5439, 58, 84, 73, 7, -83},    // 0x48 'H'
+    {5449, 15, 84, 31, 8, -83},    // 0x49 'I'
+    {5451, 48, 85, 58, 3, -83},    // 0x4A 'J'
+    {5531, 58, 84, 65, 7, -83},    // 0x4B 'K'
+    {5725, 46, 84, 56, 7, -83},    // 0x4C 'L'
+    {5730, 75, 84, 89, 7, -83},    // 0x4D 'M'
+    {5897, 58, 84, 72, 7, -83},    // 0x4E 'N'
+    {6014, 59, 86, 71, 6, -84},    // 0x4F 'O'
+    {6219, 55, 84, 67, 7, -83},    // 0x50 'P'
+    {6312, 60, 100, 71, 6, -84},   // 0x51 'Q'
+    {6573, 55, 84, 65, 7, -83},    // 0x52 'R'
+    {6705, 54, 86, 63, 4, -84},    // 0x53 'S'
+    {6969, 57, 84, 63, 3, -83},    // 0x54 'T'
+    {6976, 55, 85, 67, 6, -83},    // 0x55 'U'
+    {7060, 64, 84, 68, 2, -83},    // 0x56 'V'
+    {7233, 83, 84, 89, 3, -83},    // 0x57 'W'
+    {7435, 61, 84, 66, 2, -83},    // 0x58 'X'
+    {7707, 61, 84, 64, 1, -83},    // 0x59 'Y'
+    {7853, 54, 84, 62, 4, -83},    // 0x5A 'Z'
+    {8000, 21, 116, 31, 7, -96},   // 0x5B '['
+    {8008, 44, 91, 45, 1, -83},    // 0x5C '\'
+    {8126, 22, 116, 31, 2, -96},   // 0x5D ']'
+    {8134, 40, 42, 46, 3, -83},    // 0x5E '^'
+    {8222, 45, 12, 47, 1, 1},      // 0x5F '_'
+    {8224, 28, 18, 38, 3, -88},    // 0x60 '`'
+    {8278, 47, 64, 56, 5, -62},    // 0x61 'a'
+    {8431, 48, 90, 58, 6, -88},    // 0x62 'b'
+    {8554, 47, 64, 54, 4, -62},    // 0x63 'c'
+    {8706, 48, 90, 58, 4, -88},    // 0x64 'd'
+    {8830, 48, 64, 56, 5, -62},    // 0x65 'e'
+    {8995, 34, 90, 38, 3, -89},    // 0x66 'f'
+    {9039, 49, 88, 59, 4, -62},    // 0x67 'g'
+    {9231, 46, 89, 58, 6, -88},    // 0x68 'h'
+    {9282, 17, 86, 29, 6, -85},    // 0x69 'i'
+    {9320, 25, 111, 28, -3, -85},  // 0x6A 'j'
+    {9387, 50, 89, 56, 6, -88},    // 0x6B 'k'
+    {9532, 15, 89, 29, 7, -88},    // 0x6C 'l'
+    {9534, 75, 63, 88, 6, -62},    // 0x6D 'm'
+    {9638, 46, 63, 58, 6, -62},    // 0x6E 'n'
+    {9692, 50, 64, 59, 4, -62},    // 0x6F 'o'
+    {9869, 48, 87, 58, 6, -62},    // 0x70 'p'
+    {9989, 48, 87, 59, 4, -62},    // 0x71 'q'
+    {10114, 30, 63, 38, 6, -62},   // 0x72 'r'
+    {10147, 45, 64, 54, 4, -62},   // 0x73 's'
+    {10347, 32, 79, 36, 1, -77},   // 0x74 't'
+    {10384, 46, 63, 58, 6, -61},   // 0x75 'u'
+    {10442, 48, 62, 52, 2, -61},   // 0x76 'v'
+    {10550, 71, 62, 75, 2, -61},   // 0x77 'w'
+    {10716, 49, 62, 53, 2, -61},   // 0x78 'x'
+    {10910, 49, 87, 52, 1, -61},   // 0x79 'y'
+    {11066, 43, 62, 53, 5, -61},   // 0x7A 'z'
+    {11173, 29, 113, 35, 3, -91},  // 0x7B '{'
+    {11322, 10, 100, 30, 10, -83}, // 0x7C '|'
+    {11324, 29, 113, 35, 3, -91},  // 0x7D '}'
+    {11470, 55, 25, 67, 6, -46}};  // 0x7E '~'
+
+const GFXfontRLE Roboto_Condensed_SemiBold60pt7bRLE = {
+    {(uint8_t *)Roboto_Condensed_SemiBold60pt7bRLEBitmaps,
+     (GFXglyph *)Roboto_Condensed_SemiBold60pt7bRLEGlyphs,
+     0x20, 0x7E, 138},
+    41588, 11580,
+    NULL, 0};
+
+static const uint8_t Roboto_Condensed_SemiBold40pt7bRLEBitmaps[] = {
+    0x00, 0x0A, 0x9B, 0x01, 0x01, 0xD9, 0x01, 0x01, 0x2E, 0x08, 0x3C, 0x05,
+    0x04, 0x02, 0x05, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x14, 0x01, 0x20, 0x02,
+    0x13, 0x01, 0x02, 0x02, 0x05, 0x01, 0x00, 0x07, 0x05, 0x07, 0xE3, 0x01,
+    0x01, 0x06, 0x01, 0x0D, 0x07, 0x05, 0x07, 0x3B, 0x01, 0x0B, 0x01, 0x7C,
+    0x01, 0x2F, 0x01, 0x1D, 0x01, 0x2F, 0x01, 0x7C, 0x01, 0x0B, 0x01, 0x41,
+    0x01, 0x0B, 0x01, 0x09, 0x08, 0x06, 0x06, 0x06, 0x07, 0xB7, 0x01, 0x07,
+    0x06, 0x06, 0x06, 0x08, 0x75, 0x01, 0x0B, 0x01, 0x41, 0x01, 0x0B, 0x01,
+    0x98, 0x01, 0x09, 0x06, 0x06, 0x06, 0x07, 0xB6, 0x01, 0x07, 0x07, 0x05,
+    0x07, 0x08, 0x33, 0x01, 0x2F, 0x01, 0x7C, 0x01, 0x0B, 0x01, 0x41, 0x01,
+    0x0B, 0x01, 0x7C, 0x01, 0x2F, 0x01, 0x1D, 0x01, 0x0E, 0x06, 0xF0, 0x01,
+    0x02, 0x1A, 0x03, 0x08, 0x03, 0x10, 0x01, 0x0E, 0x02, 0x0C, 0x02, 0x11,
+    0x01, 0x0A, 0x01, 0x14, 0x01, 0x08, 0x01, 0x16, 0x01, 0x1F, 0x01, 0x05,
+    0x01, 0x2A, 0x03, 0x0B, 0x01, 0x03, 0x01, 0x0A, 0x02, 0x03, 0x01, 0x18,
+    0x01, 0x06, 0x01, 0x1F, 0x01, 0x09, 0x01, 0x2A, 0x01, 0x66, 0x01, 0x33,
+    0x01, 0x0A, 0x09, 0x2B, 0x01, 0x1F, 0x01, 0x13, 0x01, 0x0B, 0x01, 0x1F,
+    0x02, 0x11, 0x01, 0x0D, 0x02, 0x10, 0x01, 0x0E, 0x02, 0x1F, 0x01, 0x0E,
+    0x01, 0x10, 0x02, 0x0D, 0x02, 0x10, 0x01, 0x0E, 0x01, 0x10, 0x02, 0x0D,
+    0x02, 0x10, 0x01, 0x0E, 0x02, 0x1F, 0x02, 0x0D, 0x01, 0x11, 0x02, 0x0C,
+    0x01, 0x12, 0x01, 0x1F, 0x01, 0x0B, 0x01, 0x13, 0x01, 0x1F, 0x01, 0x29,
+    0x09, 0x1F, 0x01, 0x0B, 0x01, 0x7B, 0x01, 0x13, 0x01, 0x14, 0x01, 0x13,
+    0x01, 0x15, 0x01, 0x07, 0x01, 0x17, 0x02, 0x04, 0x01, 0x0B, 0x01, 0x01,
+    0x01, 0x0C, 0x04, 0x0F, 0x01, 0x1A, 0x01, 0x1D, 0x01, 0x05, 0x01, 0x1F,
+    0x01, 0x16, 0x01, 0x08, 0x02, 0x12, 0x02, 0x0B, 0x01, 0x0F, 0x02, 0x0E,
+    0x03, 0x09, 0x03, 0x13, 0x02, 0x06, 0x01, 0x07, 0x06, 0x22, 0x02, 0x06,
+    0x03, 0x1D, 0x02, 0x0B, 0x01, 0x1B, 0x01, 0x0E, 0x01, 0x43, 0x01, 0x10,
+    0x01, 0x1F, 0x04, 0x12, 0x01, 0x0B, 0x01, 0x06, 0x01, 0x04, 0x01, 0x06,
+    0x01, 0x09, 0x01, 0x01, 0x02, 0x25, 0x01, 0x04, 0x01, 0x38, 0x01, 0x06,
+    0x01, 0x0D, 0x01, 0x2F, 0x01, 0x22, 0x01, 0x2F, 0x01, 0x22, 0x01, 0x2F,
+    0x01, 0x10, 0x01, 0x06, 0x01, 0x0A, 0x01, 0x2F, 0x01, 0x22, 0x01, 0x12,
+    0x01, 0x06, 0x01, 0x04, 0x01, 0x06, 0x01, 0x09, 0x01, 0x14, 0x04, 0x0A,
+    0x01, 0x05, 0x01, 0x0E, 0x01, 0x10, 0x01, 0x2C, 0x01, 0x05, 0x01, 0x10,
+    0x01, 0x0E, 0x01, 0x1B, 0x02, 0x0B, 0x01, 0x03, 0x01, 0x05, 0x01, 0x14,
+    0x02, 0x06, 0x03, 0x21, 0x06, 0x06, 0x01, 0x05, 0x01, 0x4C, 0x01, 0x05,
+    0x01, 0x22, 0x01, 0x2F, 0x01, 0x22, 0x01, 0x0C, 0x06, 0x1D, 0x01, 0x04,
+    0x02, 0x06, 0x03, 0x13, 0x01, 0x09, 0x02, 0x0B, 0x01, 0x18, 0x01, 0x02,
+    0x01, 0x0E, 0x01, 0x10, 0x01, 0x2F, 0x01, 0x02, 0x01, 0x10, 0x01, 0x0E,
+    0x01, 0x10, 0x04, 0x1B, 0x01, 0x02, 0x01, 0x06, 0x01, 0x04, 0x01, 0x06,
+    0x01, 0x0C, 0x01, 0x05, 0x01, 0x4C, 0x01, 0x05, 0x01, 0x0A, 0x01, 0x06,
+    0x01, 0x3A, 0x01, 0x05, 0x01, 0x4C, 0x01, 0x05, 0x01, 0x4C, 0x01, 0x05,
+    0x01, 0x0D, 0x01, 0x14, 0x01, 0x1B, 0x01, 0x0D, 0x01, 0x05, 0x01, 0x24,
+    0x01, 0x0D, 0x01, 0x06, 0x01, 0x04, 0x01, 0x06, 0x01, 0x09, 0x02, 0x01,
+    0x01, 0x11, 0x04, 0x13, 0x01, 0x0B, 0x01, 0x10, 0x01, 0x43, 0x01, 0x0E,
+    0x01, 0x1B, 0x02, 0x0B, 0x01, 0x1E, 0x02, 0x06, 0x03, 0x0D, 0x08, 0x1D,
+    0x03, 0x08, 0x02, 0x1A, 0x01, 0x0D, 0x01, 0x18, 0x01, 0x0F, 0x02, 0x15,
+    0x01, 0x26, 0x01, 0x13, 0x01, 0x28, 0x01, 0x11, 0x01, 0x31, 0x03, 0x1A,
+    0x01, 0x09, 0x01, 0x03, 0x02, 0x08, 0x01, 0x40, 0x01, 0x06, 0x01, 0xC7,
+    0x01, 0x01, 0x20, 0x01, 0x0E, 0x01, 0x1E, 0x01, 0x18, 0x01, 0x09, 0x01,
+    0x03, 0x01, 0x08, 0x01, 0x1D, 0x01, 0x1B, 0x01, 0x09, 0x02, 0x09, 0x01,
+    0x26, 0x01, 0x14, 0x01, 0x11, 0x01, 0x26, 0x01, 0x17, 0x01, 0x0E, 0x01,
+    0x26, 0x01, 0x26, 0x01, 0x1A, 0x01, 0x0C, 0x01, 0x19, 0x01, 0x16, 0x08,
+    0x08, 0x01, 0x0F, 0x01, 0x16, 0x01, 0x11, 0x01, 0x14, 0x01, 0x13, 0x01,
+    0x12, 0x01, 0x09, 0x01, 0x28, 0x01, 0x0A, 0x01, 0x10, 0x01, 0x09, 0x01,
+    0x02, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x33, 0x01, 0x09, 0x01, 0x04, 0x01,
+    0x0A, 0x01, 0x1D, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x3C, 0x01, 0x28, 0x01,
+    0x10, 0x01, 0x17, 0x01, 0x50, 0x01, 0x0D, 0x01, 0x0F, 0x01, 0x0A, 0x01,
+    0x12, 0x01, 0x0A, 0x01, 0x31, 0x01, 0x1E, 0x02, 0x04, 0x03, 0x0D, 0x01,
+    0x06, 0x01, 0x0C, 0x04, 0x11, 0x01, 0x06, 0x01, 0x49, 0x01, 0x06, 0x01,
+    0x21, 0x01, 0x06, 0x01, 0x15, 0x01, 0x0B, 0x01, 0x06, 0x01, 0x13, 0x01,
+    0x01, 0x01, 0x12, 0x02, 0x0F, 0x02, 0x03, 0x01, 0x0A, 0x01, 0x08, 0x03,
+    0x09, 0x03, 0x06, 0x0B, 0x00, 0x07, 0x76, 0x01, 0x0F, 0x01, 0x10, 0x01,
+    0x01, 0x01, 0x0E, 0x01, 0x10, 0x01, 0x10, 0x01, 0x05, 0x01, 0x0A, 0x01,
+    0x10, 0x01, 0x07, 0x01, 0x08, 0x01, 0x07, 0x01, 0x1A, 0x01, 0x07, 0x01,
+    0x10, 0x01, 0x09, 0x01, 0x10, 0x01, 0x07, 0x01, 0x22, 0x01, 0x09, 0x01,
+    0x18, 0x01, 0x09, 0x01, 0x2A, 0x01, 0x09, 0x01, 0x34, 0x01, 0x19, 0x01,
+    0x3E, 0x01, 0x2B, 0x01, 0xD5, 0x02, 0x01, 0x1B, 0x01, 0x50, 0x01, 0x09,
+    0x01, 0x36, 0x01, 0x19, 0x01, 0x1C, 0x01, 0x19, 0x01, 0x0A, 0x01, 0x19,
+    0x01, 0x1C, 0x01, 0x07, 0x01, 0x0A, 0x01, 0x19, 0x01, 0x0A, 0x01, 0x19,
+    0x01, 0x0A, 0x01, 0x07, 0x01, 0x0A, 0x01, 0x07, 0x01, 0x0A, 0x01, 0x12,
+    0x01, 0x05, 0x01, 0x0C, 0x01, 0x12, 0x01, 0x12, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x11, 0x01, 0x01, 0x01, 0x13, 0x01, 0x13, 0x01, 0x0D, 0x01, 0x05,
+    0x01, 0x13, 0x01, 0x0B, 0x01, 0x07, 0x01, 0x0B, 0x01, 0x07, 0x01, 0x1E,
+    0x01, 0x07, 0x01, 0x0B, 0x01, 0x07, 0x01, 0x1E, 0x01, 0x07, 0x01, 0x1E,
+    0x01, 0x07, 0x01, 0x26, 0x01, 0x0A, 0x01, 0x2E, 0x01, 0x0A, 0x01, 0x2E,
+    0x01, 0x1D, 0x01, 0x2E, 0x01, 0x56, 0x01, 0x2E, 0x01, 0xF6, 0x01, 0x01,
+    0x1C, 0x01, 0x66, 0x01, 0x1C, 0x01, 0x2D, 0x01, 0x1C, 0x01, 0x1A, 0x01,
+    0x2F, 0x01, 0x07, 0x01, 0x1C, 0x01, 0x07, 0x01, 0x1C, 0x01, 0x07, 0x01,
+    0x1C, 0x01, 0x07, 0x01, 0x11, 0x01, 0x0A, 0x01, 0x11, 0x01, 0x07, 0x01,
+    0x09, 0x01, 0x07, 0x01, 0x11, 0x01, 0x0B, 0x01, 0x05, 0x01, 0x11, 0x01,
+    0x11, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x0D, 0x07, 0x7D, 0x01, 0x99, 0x01,
+    0x03, 0x18, 0x02, 0x07, 0x02, 0x14, 0x02, 0x02, 0x01, 0x02, 0x01, 0x05,
+    0x03, 0x0E, 0x03, 0x10, 0x02, 0x0A, 0x02, 0x15, 0x02, 0x06, 0x02, 0x0A,
+    0x02, 0x20, 0x02, 0x21, 0x03, 0x19, 0x03, 0x05, 0x04, 0x11, 0x04, 0x0C,
+    0x03, 0x0A, 0x04, 0x12, 0x01, 0x1F, 0x01, 0x0B, 0x01, 0x34, 0x01, 0x06,
+    0x01, 0x06, 0x01, 0x11, 0x01, 0x06, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x09,
+    0x01, 0x07, 0x01, 0x0D, 0x01, 0x07, 0x01, 0x03, 0x01, 0x28, 0x01, 0x0B,
+    0x01, 0x07, 0x01, 0x05, 0x01, 0x07, 0x01, 0x09, 0x01, 0x07, 0x01, 0x07,
+    0x01, 0x07, 0x01, 0x08, 0x01, 0x17, 0x01, 0x09, 0x01, 0x05, 0x01, 0x09,
+    0x01, 0x05, 0x01, 0x0B, 0x02, 0x02, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0D,
+    0x01, 0x01, 0x02, 0x0B, 0x09, 0xCC, 0x03, 0x0B, 0x09, 0x0C, 0x80, 0x02,
+    0x0B, 0x09, 0x0C, 0x04, 0x09, 0x8E, 0x01, 0x01, 0x03, 0x01, 0x21, 0x01,
+    0x03, 0x01, 0x14, 0x01, 0x03, 0x01, 0x14, 0x01, 0x0B, 0x01, 0x05, 0x02,
+    0x04, 0x01, 0x08, 0x02, 0x01, 0x01, 0x00, 0x12, 0x03, 0x05, 0x06, 0x01,
+    0x05, 0x02, 0x03, 0x01, 0x08, 0x01, 0x01, 0x01, 0x22, 0x01, 0x0B, 0x01,
+    0x0C, 0x01, 0x0C, 0x01, 0x08, 0x01, 0x03, 0x01, 0x06, 0x01, 0x11, 0x08,
+    0x31, 0x01, 0x29, 0x01, 0x1F, 0x01, 0x29, 0x01, 0x38, 0x01, 0x29, 0x01,
+    0x1F, 0x01, 0x29, 0x01, 0x1F, 0x01, 0x42, 0x01, 0x1F, 0x01, 0x29, 0x01,
+    0x1F, 0x01, 0x42, 0x01, 0x1F, 0x01, 0x29, 0x01, 0x1F, 0x01, 0x29, 0x01,
+    0x38, 0x01, 0x29, 0x01, 0x1F, 0x01, 0x29, 0x01, 0x38, 0x01, 0x29, 0x01,
+    0x1F, 0x01, 0x29, 0x01, 0x38, 0x01, 0x29, 0x01, 0x1F, 0x01, 0x29, 0x01,
+    0x38, 0x01, 0x29, 0x01, 0x1F, 0x01, 0x29, 0x01, 0x0C, 0x08, 0x14, 0x03,
+    0x08, 0x02, 0x10, 0x02, 0x0D, 0x02, 0x0D, 0x01, 0x11, 0x01, 0x0B, 0x01,
+    0x13, 0x01, 0x09, 0x01, 0x15, 0x01, 0x1F, 0x01, 0x06, 0x01, 0x1D, 0x01,
+    0x0B, 0x03, 0x0B, 0x01, 0x0E, 0x02, 0x03, 0x02, 0x1F, 0x01, 0x09, 0x01,
+    0x02, 0x01, 0x09, 0x01, 0x3C, 0x01, 0x09, 0x01, 0x28, 0x02, 0x90, 0x01,
+    0x01, 0xCC, 0x04, 0x01, 0x66, 0x01, 0x3C, 0x01, 0x0A, 0x01, 0x09, 0x01,
+    0x2A, 0x01, 0x09, 0x01, 0x11, 0x01, 0x14, 0x01, 0x17, 0x02, 0x03, 0x02,
+    0x0E, 0x01, 0x0B, 0x03, 0x0B, 0x01, 0x05, 0x01, 0x36, 0x01, 0x07, 0x01,
+    0x15, 0x01, 0x09, 0x01, 0x13, 0x01, 0x0B, 0x01, 0x11, 0x01, 0x0D, 0x02,
+    0x0D, 0x02, 0x10, 0x03, 0x08, 0x02, 0x12, 0x03, 0x10, 0x02, 0x10, 0x03,
+    0x10, 0x02, 0x11, 0x02, 0x10, 0x03, 0x10, 0x02, 0x10, 0x03, 0x11, 0x01,
+    0x5D, 0x01, 0x11, 0x03, 0x0F, 0x03, 0x10, 0x02, 0x11, 0x02, 0x0C, 0x09,
+    0x15, 0x03, 0x09, 0x03, 0x10, 0x02, 0x0F, 0x02, 0x0D, 0x01, 0x13, 0x01,
+    0x0B, 0x01, 0x15, 0x01, 0x09, 0x01, 0x17, 0x01, 0x07, 0x01, 0x3A, 0x01,
+    0x05, 0x01, 0x0B, 0x04, 0x1C, 0x01, 0x04, 0x02, 0x0A, 0x01, 0x03, 0x01,
+    0x0A, 0x01, 0x1F, 0x01, 0x08, 0x01, 0x2D, 0x01, 0x09, 0x01, 0x0A, 0x01,
+    0x09, 0x01, 0x85, 0x01, 0x0A, 0x15, 0x01, 0x16, 0x01, 0x61, 0x01, 0x09,
+    0x01, 0x36, 0x01, 0x2A, 0x01, 0x15, 0x01, 0x1F, 0x01, 0x0A, 0x01, 0x1F,
+    0x01, 0x15, 0x01, 0x1F, 0x01, 0x0A, 0x01, 0x1F, 0x01, 0x15, 0x01, 0x1F,
+    0x01, 0x0A, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x1F,
+    0x01, 0x15, 0x01, 0x1F, 0x01, 0x0A, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x14,
+    0x01, 0x2B, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x14,
+    0x01, 0x2B, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x14,
+    0x01, 0x0B, 0x14, 0x0B, 0x09, 0x15, 0x02, 0x09, 0x03, 0x10, 0x02, 0x0E,
+    0x02, 0x0C, 0x02, 0x12, 0x01, 0x0A, 0x01, 0x15, 0x01, 0x08, 0x01, 0x17,
+    0x01, 0x20, 0x01, 0x05, 0x01, 0x1A, 0x01, 0x10, 0x04, 0x0F, 0x01, 0x0A,
+    0x02, 0x04, 0x01, 0x18, 0x01, 0x07, 0x01, 0x0A, 0x01, 0x15, 0x01, 0x0B,
+    0x01, 0x09, 0x01, 0x4A, 0x01, 0x0A, 0x0A, 0x6B, 0x01, 0x5E, 0x01, 0x09,
+    0x01, 0x14, 0x01, 0x1E, 0x01, 0x0A, 0x01, 0x0C, 0x08, 0x0A, 0x01, 0x1E,
+    0x01, 0x1E, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x0D, 0x08, 0x0B, 0x01, 0x14, 0x02, 0x0A, 0x01, 0x15, 0x01, 0x40,
+    0x01, 0x09, 0x01, 0x80, 0x01, 0x0A, 0x80, 0x01, 0x01, 0x0A, 0x01, 0x0A,
+    0x01, 0x1E, 0x01, 0x0B, 0x01, 0x08, 0x01, 0x17, 0x02, 0x04, 0x02, 0x0A,
+    0x01, 0x02, 0x01, 0x0C, 0x04, 0x2B, 0x01, 0x04, 0x01, 0x20, 0x01, 0x18,
+    0x01, 0x07, 0x01, 0x15, 0x02, 0x09, 0x01, 0x13, 0x01, 0x0C, 0x02, 0x0F,
+    0x02, 0x0F, 0x03, 0x09, 0x03, 0x13, 0x0B, 0x3A, 0x01, 0x44, 0x01, 0x44,
+    0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x01, 0x21, 0x01, 0x07,
+    0x01, 0x3C, 0x01, 0x07, 0x01, 0x3C, 0x01, 0x07, 0x01, 0x3C, 0x01, 0x07,
+    0x01, 0x3C, 0x01, 0x2A, 0x01, 0x19, 0x01, 0x2A, 0x01, 0x19, 0x01, 0x2A,
+    0x01, 0x19, 0x01, 0x2A, 0x01, 0x19, 0x01, 0x2A, 0x01, 0x19, 0x01, 0x2A,
+    0x01, 0x19, 0x01, 0x08, 0x0A, 0x0A, 0x06, 0x68, 0x01, 0x8C, 0x01, 0x13,
+    0x0A, 0x05, 0x04, 0x1A, 0x85, 0x01, 0x01, 0x88, 0x01, 0x12, 0xAD, 0x01,
+    0x01, 0x16, 0x01, 0x6B, 0x08, 0x16, 0x02, 0x08, 0x02, 0x13, 0x01, 0x0C,
+    0x02, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x24, 0x01, 0x1B, 0x01, 0x0E,
+    0x06, 0x0F, 0x02, 0x07, 0x02, 0x06, 0x01, 0x0B, 0x01, 0x04, 0x04, 0x0C,
+    0x01, 0x13, 0x03, 0x0A, 0x01, 0x40, 0x01, 0x29, 0x01, 0xC0, 0x01, 0x0A,
+    0x4B, 0x01, 0x09, 0x01, 0x20, 0x01, 0x09, 0x01, 0x29, 0x01, 0x16, 0x01,
+    0x07, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x02, 0x04, 0x01, 0x1B, 0x04,
+    0x0B, 0x01, 0x04, 0x01, 0x20, 0x01, 0x18, 0x01, 0x07, 0x01, 0x16, 0x01,
+    0x09, 0x01, 0x14, 0x01, 0x0B, 0x01, 0x12, 0x01, 0x0D, 0x02, 0x0E, 0x02,
+    0x10, 0x03, 0x08, 0x03, 0x12, 0x07, 0x16, 0x03, 0x1B, 0x02, 0x1C, 0x02,
+    0x1D, 0x01, 0x1E, 0x01, 0x1E, 0x01, 0x1E, 0x01, 0x1E, 0x01, 0x10, 0x02,
+    0x0C, 0x01, 0x0C, 0x05, 0x19, 0x02, 0x12, 0x01, 0x0A, 0x01, 0x1E, 0x01,
+    0x14, 0x01, 0x09, 0x01, 0x34, 0x01, 0x09, 0x01, 0x3E, 0x01, 0x15, 0x01,
+    0x2E, 0x07, 0x13, 0x01, 0x02, 0x03, 0x07, 0x02, 0x13, 0x01, 0x0C, 0x01,
+    0x11, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x04, 0x01, 0x1B, 0x01,
+    0x20, 0x01, 0x30, 0x04, 0x1A, 0x02, 0x04, 0x01, 0x0B, 0x01, 0x14, 0x01,
+    0x17, 0x01, 0x08, 0x01, 0x15, 0x01, 0x14, 0x01, 0x15, 0x01, 0xEA, 0x01,
+    0x01, 0x29, 0x01, 0x4A, 0x01, 0x09, 0x01, 0x01, 0x01, 0x09, 0x01, 0x28,
+    0x01, 0x17, 0x01, 0x06, 0x01, 0x0A, 0x01, 0x03, 0x01, 0x0A, 0x02, 0x03,
+    0x01, 0x10, 0x01, 0x0B, 0x03, 0x0B, 0x01, 0x26, 0x01, 0x17, 0x01, 0x08,
+    0x01, 0x15, 0x01, 0x0A, 0x01, 0x13, 0x01, 0x0C, 0x01, 0x11, 0x01, 0x0E,
+    0x02, 0x0D, 0x02, 0x11, 0x02, 0x08, 0x03, 0x00, 0x21, 0xE6, 0x01, 0x17,
+    0x2A, 0x01, 0x37, 0x01, 0x29, 0x01, 0x37, 0x01, 0x29, 0x01, 0x16, 0x01,
+    0x4A, 0x01, 0x16, 0x01, 0x29, 0x01, 0x16, 0x01, 0x4A, 0x01, 0x16, 0x01,
+    0x4A, 0x01, 0x16, 0x01, 0x40, 0x01, 0x09, 0x01, 0x57, 0x01, 0x09, 0x01,
+    0x40, 0x01, 0x16, 0x01, 0x40, 0x01, 0x09, 0x01, 0x57, 0x01, 0x09, 0x01,
+    0x36, 0x01, 0x2A, 0x01, 0x36, 0x01, 0x09, 0x01, 0x57, 0x01, 0x09, 0x01,
+    0x36, 0x01, 0x2A, 0x01, 0x36, 0x01, 0x2A, 0x01, 0x0B, 0x09, 0x14, 0x02,
+    0x09, 0x03, 0x0F, 0x02, 0x0E, 0x01, 0x0D, 0x01, 0x11, 0x02, 0x0A, 0x01,
+    0x14, 0x01, 0x08, 0x01, 0x1D, 0x01, 0x17, 0x01, 0x1F, 0x01, 0x04, 0x01,
+    0x0B, 0x03, 0x1B, 0x01, 0x03, 0x02, 0x0D, 0x01, 0x0A, 0x01, 0x10, 0x01,
+    0x0C, 0x01, 0x07, 0x01, 0x9B, 0x01, 0x01, 0x1E, 0x01, 0x49, 0x01, 0x28,
+    0x01, 0x07, 0x01, 0x09, 0x01, 0x0D, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x03,
+    0x02, 0x09, 0x01, 0x05, 0x01, 0x0A, 0x03, 0x0A, 0x01, 0x07, 0x01, 0x1F,
+    0x01, 0x14, 0x01, 0x0A, 0x01, 0x11, 0x02, 0x0B, 0x01, 0x11, 0x01, 0x0B,
+    0x01, 0x13, 0x01, 0x09, 0x01, 0x15, 0x01, 0x07, 0x01, 0x17, 0x01, 0x05,
+    0x01, 0x0A, 0x05, 0x0A, 0x01, 0x0E, 0x01, 0x05, 0x01, 0x0A, 0x01, 0x02,
+    0x01, 0x09, 0x01, 0x07, 0x01, 0x1F, 0x01, 0x0A, 0x01, 0x09, 0x01, 0x13,
+    0x01, 0x82, 0x02, 0x01, 0x14, 0x01, 0x13, 0x01, 0x15, 0x01, 0x07, 0x01,
+    0x0A, 0x01, 0x0C, 0x02, 0x04, 0x01, 0x0D, 0x01, 0x0C, 0x04, 0x0B, 0x01,
+    0x22, 0x01, 0x19, 0x01, 0x05, 0x01, 0x17, 0x01, 0x07, 0x01, 0x15, 0x01,
+    0x09, 0x01, 0x13, 0x01, 0x0B, 0x02, 0x0F, 0x02, 0x0E, 0x03, 0x09, 0x03,
+    0x0B, 0x08, 0x15, 0x02, 0x08, 0x03, 0x10, 0x02, 0x0D, 0x01, 0x0E, 0x01,
+    0x10, 0x01, 0x0C, 0x01, 0x12, 0x01, 0x0A, 0x01, 0x14, 0x01, 0x08, 0x01,
+    0x16, 0x01, 0x1F, 0x01, 0x05, 0x01, 0x0B, 0x03, 0x1A, 0x02, 0x03, 0x01,
+    0x0A, 0x01, 0x03, 0x01, 0x09, 0x01, 0x06, 0x01, 0x2B, 0x01, 0x09, 0x01,
+    0x08, 0x01, 0x09, 0x01, 0x34, 0x01, 0x32, 0x01, 0x14, 0x01, 0xC3, 0x01,
+    0x01, 0x5D, 0x01, 0x14, 0x01, 0x13, 0x01, 0x15, 0x01, 0x07, 0x01, 0x17,
+    0x01, 0x05, 0x01, 0x0D, 0x01, 0x0B, 0x05, 0x2E, 0x01, 0x1F, 0x01, 0x1A,
+    0x01, 0x23, 0x02, 0x0E, 0x01, 0x10, 0x01, 0x0B, 0x02, 0x12, 0x02, 0x07,
+    0x02, 0x02, 0x01, 0x13, 0x07, 0x0D, 0x01, 0x52, 0x01, 0x08, 0x01, 0x14,
+    0x01, 0x3C, 0x01, 0x09, 0x01, 0x12, 0x02, 0x1B, 0x02, 0x0B, 0x01, 0x0B,
+    0x06, 0x0C, 0x01, 0x3C, 0x01, 0x1D, 0x01, 0x1D, 0x01, 0x1C, 0x02, 0x1B,
+    0x02, 0x1B, 0x02, 0x1A, 0x03, 0x03, 0x05, 0x06, 0x01, 0x05, 0x02, 0x03,
+    0x01, 0x08, 0x01, 0x01, 0x01, 0x22, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0C,
+    0x01, 0x08, 0x01, 0x03, 0x01, 0x05, 0x02, 0x05, 0x05, 0xF7, 0x01, 0x05,
+    0x06, 0x01, 0x05, 0x02, 0x03, 0x01, 0x08, 0x01, 0x01, 0x01, 0x22, 0x01,
+    0x0B, 0x01, 0x0C, 0x01, 0x0C, 0x01, 0x08, 0x01, 0x03, 0x01, 0x06, 0x01,
+    0x05, 0x06, 0x07, 0x01, 0x06, 0x01, 0x05, 0x01, 0x08, 0x01, 0x0E, 0x01,
+    0x02, 0x01, 0x29, 0x01, 0x18, 0x01, 0x03, 0x01, 0x08, 0x01, 0x05, 0x01,
+    0x06, 0x01, 0x07, 0x06, 0xAD, 0x02, 0x09, 0x8B, 0x01, 0x01, 0x12, 0x01,
+    0x15, 0x01, 0x12, 0x01, 0x15, 0x01, 0x04, 0x01, 0x07, 0x01, 0x04, 0x01,
+    0x0D, 0x01, 0x07, 0x01, 0x06, 0x02, 0x04, 0x01, 0x09, 0x02, 0x01, 0x01,
+    0x1B, 0x01, 0x19, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02,
+    0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0x11, 0x02,
+    0x05, 0x02, 0x11, 0x02, 0x05, 0x02, 0x11, 0x02, 0x05, 0x02, 0x11, 0x02,
+    0x06, 0x01, 0x11, 0x02, 0x18, 0x02, 0x17, 0x03, 0x17, 0x02, 0x36, 0x02,
+    0x1C, 0x02, 0x1C, 0x03, 0x0A, 0x01, 0x11, 0x02, 0x09, 0x02, 0x11, 0x02,
+    0x09, 0x02, 0x11, 0x02, 0x09, 0x02, 0x11, 0x02, 0x09, 0x02, 0x11, 0x02,
+    0x09, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02,
+    0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x00, 0x1D, 0xCB, 0x01, 0x1D, 0xCB,
+    0x01, 0x1D, 0x00, 0x01, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02,
+    0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x09, 0x01,
+    0x12, 0x02, 0x08, 0x03, 0x11, 0x02, 0x09, 0x02, 0x11, 0x02, 0x09, 0x02,
+    0x11, 0x02, 0x09, 0x02, 0x11, 0x01, 0x0A, 0x03, 0x1C, 0x02, 0x1C, 0x02,
+    0x36, 0x02, 0x17, 0x03, 0x17, 0x02, 0x18, 0x02, 0x11, 0x01, 0x06, 0x02,
+    0x11, 0x02, 0x05, 0x02, 0x11, 0x02, 0x04, 0x03, 0x11, 0x02, 0x05, 0x01,
+    0x12, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02,
+    0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0x0B, 0x08, 0x12, 0x03,
+    0x08, 0x03, 0x0D, 0x02, 0x0E, 0x02, 0x0A, 0x01, 0x12, 0x01, 0x08, 0x01,
+    0x14, 0x01, 0x06, 0x01, 0x16, 0x01, 0x04, 0x01, 0x35, 0x01, 0x02, 0x01,
+    0x0C, 0x02, 0x19, 0x02, 0x02, 0x02, 0x0A, 0x01, 0x0B, 0x01, 0x06, 0x01,
+    0x0A, 0x01, 0x26, 0x01, 0x25, 0x01, 0x26, 0x0A, 0x43, 0x01, 0x55, 0x01,
+    0x09, 0x01, 0x2E, 0x01, 0x1B, 0x01, 0x0A, 0x01, 0x10, 0x01, 0x0A, 0x01,
+    0x10, 0x01, 0x27, 0x01, 0x10, 0x01, 0x0A, 0x01, 0x10, 0x01, 0x0A, 0x01,
+    0x1B, 0x01, 0x11, 0x01, 0x26, 0x01, 0x11, 0x01, 0x09, 0x01, 0x38, 0x01,
+    0xA4, 0x01, 0x09, 0xA7, 0x01, 0x04, 0x18, 0x01, 0x04, 0x02, 0x15, 0x01,
+    0x07, 0x01, 0x13, 0x01, 0x26, 0x01, 0x56, 0x01, 0x12, 0x01, 0x25, 0x01,
+    0x14, 0x02, 0x05, 0x01, 0x17, 0x0B, 0x28, 0x03, 0x0B, 0x03, 0x23, 0x02,
+    0x11, 0x02, 0x1F, 0x02, 0x15, 0x02, 0x1B, 0x02, 0x19, 0x02, 0x18, 0x01,
+    0x1D, 0x01, 0x16, 0x01, 0x0B, 0x09, 0x0B, 0x01, 0x14, 0x01, 0x09, 0x03,
+    0x09, 0x03, 0x09, 0x01, 0x12, 0x01, 0x08, 0x02, 0x0F, 0x02, 0x08, 0x01,
+    0x10, 0x01, 0x08, 0x01, 0x13, 0x01, 0x17, 0x01, 0x07, 0x02, 0x15, 0x02,
+    0x06, 0x01, 0x15, 0x01, 0x19, 0x01, 0x06, 0x01, 0x0C, 0x01, 0x34, 0x01,
+    0x07, 0x01, 0x1B, 0x01, 0x06, 0x01, 0x11, 0x01, 0x1D, 0x01, 0x0F, 0x01,
+    0x06, 0x01, 0x25, 0x01, 0x1D, 0x07, 0x0B, 0x01, 0x0D, 0x01, 0x06, 0x01,
+    0x0C, 0x02, 0x07, 0x02, 0x29, 0x02, 0x0B, 0x02, 0x08, 0x01, 0x05, 0x01,
+    0x0C, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x13, 0x01, 0x10, 0x01, 0x11, 0x01,
+    0x4E, 0x01, 0x09, 0x01, 0x08, 0x03, 0x0F, 0x01, 0x05, 0x01, 0x03, 0x01,
+    0x0F, 0x01, 0x07, 0x02, 0x03, 0x01, 0x2F, 0x01, 0x2D, 0x01, 0x2C, 0x01,
+    0x0F, 0x01, 0x1E, 0x01, 0x0E, 0x01, 0x3C, 0x01, 0x0E, 0x01, 0x64, 0x01,
+    0x1D, 0x01, 0x07, 0x01, 0x3C, 0x01, 0x8B, 0x01, 0x01, 0x43, 0x01, 0xA4,
+    0x02, 0x01, 0x08, 0x01, 0x05, 0x01, 0x01, 0x01, 0x1D, 0x01, 0x8A, 0x01,
+    0x01, 0x06, 0x01, 0x07, 0x01, 0x06, 0x01, 0x0F, 0x01, 0x05, 0x01, 0x27,
+    0x01, 0x27, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x05, 0x01, 0x1B, 0x04, 0x0A,
+    0x01, 0x04, 0x01, 0x19, 0x01, 0x17, 0x04, 0x06, 0x01, 0x05, 0x01, 0x06,
+    0x01, 0x16, 0x01, 0x26, 0x01, 0x0D, 0x01, 0x11, 0x01, 0x16, 0x01, 0x0B,
+    0x01, 0x02, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x06, 0x01, 0x08, 0x01, 0x09,
+    0x01, 0x04, 0x01, 0x0B, 0x02, 0x1A, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07,
+    0x02, 0x13, 0x01, 0x0A, 0x05, 0x0A, 0x07, 0x0E, 0x01, 0x3D, 0x01, 0x2E,
+    0x01, 0x3D, 0x01, 0x2E, 0x01, 0x07, 0x01, 0x36, 0x02, 0x2C, 0x01, 0x09,
+    0x01, 0x13, 0x01, 0x18, 0x01, 0x09, 0x02, 0x0F, 0x02, 0x1A, 0x01, 0x0A,
+    0x04, 0x07, 0x04, 0x1D, 0x01, 0x0D, 0x07, 0x07, 0x01, 0x1A, 0x01, 0x36,
+    0x02, 0x36, 0x02, 0x16, 0x01, 0x1F, 0x02, 0x12, 0x02, 0x22, 0x03, 0x0B,
+    0x04, 0x11, 0x0A, 0x79, 0x01, 0x0A, 0x01, 0x77, 0x01, 0x0C, 0x01, 0x75,
+    0x01, 0x0E, 0x01, 0x84, 0x01, 0x01, 0x1A, 0x01, 0x60, 0x01, 0x08, 0x01,
+    0x18, 0x01, 0x08, 0x01, 0x62, 0x01, 0x16, 0x01, 0x0B, 0x01, 0x28, 0x01,
+    0x38, 0x01, 0x14, 0x01, 0x0D, 0x01, 0x26, 0x01, 0x3A, 0x01, 0x12, 0x01,
+    0x3B, 0x01, 0x24, 0x01, 0x21, 0x01, 0x1A, 0x01, 0x45, 0x01, 0x08, 0x01,
+    0x18, 0x01, 0x1C, 0x01, 0x4E, 0x01, 0x20, 0x01, 0x14, 0x01, 0x0C, 0x01,
+    0x09, 0x0C, 0x62, 0x01, 0x0A, 0x01, 0x79, 0x01, 0x08, 0x01, 0x61, 0x10,
+    0x0A, 0x01, 0x06, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x47, 0x01, 0x04, 0x01,
+    0x48, 0x01, 0x18, 0x01, 0x20, 0x01, 0x28, 0x01, 0x21, 0x01, 0x16, 0x01,
+    0x20, 0x01, 0x2A, 0x01, 0x00, 0x16, 0x23, 0x04, 0x23, 0x02, 0x23, 0x01,
+    0x23, 0x01, 0x23, 0x01, 0x23, 0x01, 0x46, 0x01, 0x0C, 0x0B, 0x23, 0x01,
+    0x23, 0x01, 0x2D, 0x01, 0x5E, 0x01, 0x45, 0x01, 0x2C, 0x01, 0x5D, 0x01,
+    0x09, 0x01, 0x17, 0x01, 0x17, 0x0B, 0x0A, 0x01, 0x21, 0x01, 0x21, 0x01,
+    0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x23, 0x01, 0x23, 0x01, 0x0D, 0x0B,
+    0x0B, 0x01, 0x17, 0x01, 0x23, 0x01, 0x0A, 0x01, 0x18, 0x01, 0x73, 0x01,
+    0xAE, 0x01, 0x01, 0x17, 0x01, 0x44, 0x01, 0x16, 0x0C, 0x0B, 0x01, 0x44,
+    0x01, 0x44, 0x01, 0x21, 0x01, 0x20, 0x02, 0x1F, 0x02, 0x1E, 0x03, 0x0E,
+    0x0A, 0x19, 0x03, 0x0A, 0x04, 0x13, 0x02, 0x11, 0x02, 0x10, 0x01, 0x15,
+    0x01, 0x0E, 0x01, 0x17, 0x01, 0x0C, 0x01, 0x19, 0x01, 0x0A, 0x01, 0x1B,
+    0x01, 0x08, 0x01, 0x1D, 0x01, 0x06, 0x01, 0x31, 0x09, 0x0B, 0x01, 0x04,
+    0x01, 0x0A, 0x02, 0x09, 0x01, 0x19, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x22,
+    0x01, 0x0C, 0x01, 0x0E, 0x01, 0x57, 0x01, 0x24, 0x01, 0x0A, 0x01, 0x10,
+    0x01, 0x4C, 0x0A, 0xC8, 0x05, 0x0A, 0x1B, 0x01, 0x30, 0x01, 0x09, 0x01,
+    0x1A, 0x01, 0x57, 0x01, 0x0E, 0x01, 0x0C, 0x01, 0x22, 0x01, 0x0D, 0x01,
+    0x0C, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x1B, 0x04, 0x01, 0x05,
+    0x0B, 0x01, 0x05, 0x01, 0x0E, 0x01, 0x17, 0x01, 0x1D, 0x01, 0x24, 0x01,
+    0x09, 0x01, 0x1A, 0x01, 0x0B, 0x02, 0x17, 0x01, 0x0E, 0x01, 0x14, 0x02,
+    0x10, 0x02, 0x10, 0x02, 0x14, 0x03, 0x0A, 0x03, 0x00, 0x13, 0x23, 0x04,
+    0x23, 0x02, 0x23, 0x02, 0x23, 0x01, 0x23, 0x01, 0x23, 0x01, 0x23, 0x01,
+    0x31, 0x0A, 0x0B, 0x01, 0x17, 0x01, 0x0B, 0x01, 0x17, 0x01, 0x23, 0x01,
+    0x23, 0x01, 0x09, 0x01, 0x5F, 0x01, 0x09, 0x01, 0x9A, 0x06, 0x01, 0x09,
+    0x01, 0x5D, 0x01, 0x21, 0x01, 0x0A, 0x01, 0x16, 0x01, 0x21, 0x01, 0x0B,
+    0x01, 0x0C, 0x0A, 0x0B, 0x01, 0x44, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21,
+    0x01, 0x20, 0x02, 0x1F, 0x02, 0x1D, 0x04, 0x00, 0x1F, 0x82, 0x02, 0x15,
+    0x9D, 0x03, 0x12, 0xE6, 0x01, 0x12, 0xBF, 0x03, 0x15, 0x00, 0x1E, 0xFA,
+    0x01, 0x14, 0x90, 0x03, 0x12, 0xFC, 0x01, 0x12, 0x0E, 0x0B, 0x18, 0x03,
+    0x0B, 0x03, 0x13, 0x02, 0x11, 0x02, 0x10, 0x01, 0x15, 0x02, 0x0C, 0x02,
+    0x18, 0x01, 0x0A, 0x01, 0x1B, 0x01, 0x2E, 0x01, 0x1D, 0x01, 0x06, 0x01,
+    0x0F, 0x01, 0x21, 0x04, 0x01, 0x04, 0x0B, 0x01, 0x04, 0x01, 0x0B, 0x01,
+    0x09, 0x01, 0x1A, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x01,
+    0x0D, 0x01, 0x3C, 0x01, 0x35, 0x01, 0x09, 0x02, 0x55, 0x01, 0x11, 0x0A,
+    0xC3, 0x02, 0x13, 0x9D, 0x02, 0x09, 0x86, 0x01, 0x01, 0x41, 0x01, 0x56,
+    0x01, 0x1B, 0x01, 0x30, 0x01, 0x26, 0x01, 0x0D, 0x01, 0x0C, 0x01, 0x0B,
+    0x02, 0x09, 0x02, 0x1B, 0x09, 0x10, 0x01, 0x26, 0x01, 0x20, 0x01, 0x05,
+    0x01, 0x1E, 0x01, 0x07, 0x01, 0x1C, 0x01, 0x09, 0x01, 0x19, 0x02, 0x0B,
+    0x02, 0x16, 0x01, 0x0F, 0x02, 0x11, 0x03, 0x12, 0x03, 0x0B, 0x03, 0x00,
+    0x0A, 0x12, 0x0A, 0xCE, 0x06, 0x12, 0x9E, 0x02, 0x12, 0x00, 0x0A, 0x15,
+    0x0A, 0x9A, 0x09, 0x0A, 0x7C, 0x01, 0x28, 0x01, 0x0A, 0x01, 0x0A, 0x01,
+    0x12, 0x01, 0x0C, 0x01, 0x06, 0x01, 0x18, 0x06, 0x0D, 0x01, 0x1B, 0x01,
+    0x1D, 0x01, 0x04, 0x01, 0x1F, 0x01, 0x17, 0x01, 0x07, 0x01, 0x15, 0x01,
+    0x09, 0x01, 0x12, 0x02, 0x0B, 0x02, 0x0F, 0x01, 0x0F, 0x03, 0x09, 0x03,
+    0x00, 0x0A, 0x0F, 0x0C, 0x19, 0x01, 0x31, 0x01, 0x18, 0x01, 0x0B, 0x01,
+    0x18, 0x01, 0x31, 0x01, 0x18, 0x01, 0x0B, 0x01, 0x3E, 0x01, 0x0B, 0x01,
+    0x18, 0x01, 0x0B, 0x01, 0x3E, 0x01, 0x0B, 0x01, 0x24, 0x01, 0x19, 0x01,
+    0x24, 0x01, 0x0B, 0x01, 0x24, 0x01, 0x19, 0x01, 0x0A, 0x01, 0x19, 0x01,
+    0x30, 0x01, 0x19, 0x01, 0x0A, 0x01, 0x3F, 0x01, 0x0A, 0x01, 0x19, 0x01,
+    0x0A, 0x01, 0x3F, 0x01, 0x0A, 0x01, 0x25, 0x01, 0x26, 0x01, 0x4C, 0x01,
+    0x4C, 0x01, 0x4C, 0x01, 0x1A, 0x01, 0x24, 0x01, 0x01, 0x01, 0x0A, 0x01,
+    0x17, 0x01, 0x29, 0x01, 0x0A, 0x01, 0x15, 0x01, 0x10, 0x01, 0x13, 0x01,
+    0x06, 0x01, 0x31, 0x01, 0x1A, 0x01, 0x31, 0x01, 0x1A, 0x01, 0x31, 0x01,
+    0x1A, 0x01, 0x31, 0x01, 0x1A, 0x01, 0x0B, 0x01, 0x40, 0x01, 0x0B, 0x01,
+    0x40, 0x01, 0x0B, 0x01, 0x40, 0x01, 0x0B, 0x01, 0x40, 0x01, 0x0B, 0x01,
+    0x00, 0x0A, 0xE4, 0x0A, 0x14, 0x00, 0x0D, 0x17, 0x0D, 0x6F, 0x01, 0x15,
+    0x01, 0xAE, 0x01, 0x01, 0x13, 0x01, 0x7F, 0x01, 0x11, 0x01, 0x81, 0x01,
+    0x01, 0x0F, 0x01, 0x83, 0x01, 0x01, 0x0D, 0x01, 0x69, 0x01, 0x12, 0x01,
+    0x39, 0x01, 0x0B, 0x01, 0x38, 0x01, 0x45, 0x01, 0x08, 0x01, 0x09, 0x01,
+    0x38, 0x01, 0x47, 0x01, 0x08, 0x01, 0x07, 0x01, 0x69, 0x01, 0x15, 0x01,
+    0x02, 0x01, 0x08, 0x01, 0x11, 0x01, 0x24, 0x01, 0x38, 0x01, 0x1A, 0x01,
+    0x39, 0x01, 0x03, 0x01, 0x38, 0x01, 0x1C, 0x01, 0x39, 0x01, 0x01, 0x01,
+    0x69, 0x01, 0x1E, 0x01, 0x08, 0x01, 0x69, 0x01, 0x20, 0x01, 0x70, 0x01,
+    0x22, 0x01, 0x93, 0x01, 0x01, 0x0B, 0x01, 0x87, 0x01, 0x01, 0x09, 0x01,
+    0x89, 0x01, 0x01, 0x07, 0x01, 0x00, 0x0A, 0x12, 0x0A, 0x30, 0x01, 0x4C,
+    0x01, 0x4C, 0x01, 0x4C, 0x01, 0x4C, 0x01, 0x4C, 0x01, 0x26, 0x01, 0x4C,
+    0x01, 0x4C, 0x01, 0x4C, 0x01, 0x42, 0x01, 0x09, 0x01, 0x42, 0x01, 0x09,
+    0x01, 0x1C, 0x01, 0x2F, 0x01, 0x1C, 0x01, 0x2F, 0x01, 0x1C, 0x01, 0x2F,
+    0x01, 0x1C, 0x01, 0x2F, 0x01, 0x1C, 0x01, 0x2F, 0x01, 0x1C, 0x01, 0x2F,
+    0x01, 0x1C, 0x01, 0x4C, 0x01, 0x4C, 0x01, 0x4C, 0x01, 0x4C, 0x01, 0x4C,
+    0x01, 0x4C, 0x01, 0x4C, 0x01, 0x4C, 0x01, 0x4C, 0x01, 0x0F, 0x09, 0x1B,
+    0x03, 0x09, 0x03, 0x16, 0x02, 0x0F, 0x02, 0x12, 0x02, 0x13, 0x02, 0x0F,
+    0x01, 0x17, 0x01, 0x0D, 0x01, 0x19, 0x01, 0x0B, 0x01, 0x1B, 0x01, 0x09,
+    0x01, 0x1D, 0x01, 0x2E, 0x01, 0x0B, 0x09, 0x0B, 0x01, 0x05, 0x01, 0x0B,
+    0x01, 0x09, 0x01, 0x0B, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x19, 0x01, 0x0D,
+    0x01, 0x0D, 0x01, 0x23, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x32, 0x01, 0x4C,
+    0x01, 0x0A, 0x01, 0x11, 0x01, 0xC7, 0x06, 0x01, 0x11, 0x01, 0x0A, 0x01,
+    0x25, 0x01, 0x32, 0x01, 0x0F, 0x01, 0x0C, 0x01, 0x23, 0x01, 0x0D, 0x01,
+    0x0D, 0x01, 0x19, 0x01, 0x0B, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x09, 0x01,
+    0x0B, 0x01, 0x11, 0x09, 0x12, 0x01, 0x1F, 0x01, 0x07, 0x01, 0x1D, 0x01,
+    0x09, 0x01, 0x1B, 0x01, 0x0B, 0x01, 0x19, 0x01, 0x0D, 0x01, 0x17, 0x01,
+    0x0F, 0x01, 0x15, 0x01, 0x11, 0x02, 0x11, 0x02, 0x14, 0x04, 0x0A, 0x03,
+    0x00, 0x17, 0x24, 0x03, 0x24, 0x02, 0x24, 0x02, 0x24, 0x01, 0x24, 0x01,
+    0x24, 0x01, 0x48, 0x01, 0x0C, 0x0C, 0x24, 0x01, 0x0B, 0x01, 0x18, 0x01,
+    0x24, 0x01, 0x2E, 0x01, 0x3D, 0x01, 0xD7, 0x01, 0x01, 0x46, 0x01, 0x0A,
+    0x01, 0x3A, 0x02, 0x16, 0x0C, 0x0C, 0x01, 0x46, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x21, 0x02, 0x1F, 0x03, 0x13, 0x0E, 0x0F,
+    0x09, 0x1A, 0x04, 0x09, 0x03, 0x15, 0x02, 0x10, 0x02, 0x12, 0x01, 0x14,
+    0x02, 0x0F, 0x01, 0x17, 0x01, 0x0D, 0x01, 0x19, 0x01, 0x0B, 0x01, 0x1B,
+    0x01, 0x09, 0x01, 0x1D, 0x01, 0x07, 0x01, 0x32, 0x08, 0x0C, 0x01, 0x05,
+    0x01, 0x0B, 0x01, 0x08, 0x02, 0x1B, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x03,
+    0x01, 0x0A, 0x01, 0x0D, 0x01, 0x31, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x32,
+    0x01, 0x30, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0xB2, 0x06, 0x01, 0x14, 0x01,
+    0x1B, 0x02, 0x58, 0x01, 0x0F, 0x01, 0x30, 0x01, 0x02, 0x01, 0x0A, 0x01,
+    0x0D, 0x01, 0x19, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x0B, 0x01,
+    0x09, 0x01, 0x1D, 0x09, 0x0B, 0x01, 0x06, 0x01, 0x27, 0x01, 0x1D, 0x01,
+    0x09, 0x01, 0x1B, 0x01, 0x0B, 0x01, 0x19, 0x01, 0x0D, 0x01, 0x27, 0x01,
+    0x17, 0x01, 0x0F, 0x02, 0x16, 0x01, 0x10, 0x03, 0x14, 0x01, 0x12, 0x0A,
+    0x0B, 0x02, 0x1A, 0x01, 0x0C, 0x01, 0x1A, 0x01, 0x0C, 0x01, 0x1A, 0x01,
+    0x27, 0x01, 0x0A, 0x01, 0x1C, 0x01, 0x08, 0x01, 0x1E, 0x01, 0x06, 0x01,
+    0x20, 0x01, 0x04, 0x01, 0x22, 0x01, 0x01, 0x02, 0x00, 0x16, 0x24, 0x04,
+    0x24, 0x02, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01,
+    0x31, 0x0B, 0x24, 0x01, 0x0B, 0x01, 0x18, 0x01, 0x24, 0x01, 0x9A, 0x01,
+    0x01, 0x23, 0x01, 0x84, 0x01, 0x01, 0x46, 0x01, 0x0A, 0x01, 0x17, 0x01,
+    0x18, 0x0B, 0x0B, 0x01, 0x46, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01,
+    0x21, 0x02, 0x22, 0x01, 0x37, 0x07, 0x0A, 0x01, 0x3D, 0x01, 0x0A, 0x01,
+    0x3D, 0x01, 0x2E, 0x01, 0x3D, 0x01, 0x0A, 0x01, 0x3D, 0x01, 0x0A, 0x01,
+    0x61, 0x01, 0x0A, 0x01, 0x3D, 0x01, 0x0A, 0x01, 0x3D, 0x01, 0x0A, 0x01,
+    0x61, 0x01, 0x0A, 0x01, 0x0D, 0x0A, 0x17, 0x03, 0x0A, 0x03, 0x12, 0x02,
+    0x10, 0x02, 0x0F, 0x01, 0x14, 0x01, 0x0C, 0x02, 0x16, 0x01, 0x0A, 0x01,
+    0x19, 0x01, 0x24, 0x01, 0x07, 0x01, 0x1C, 0x01, 0x05, 0x01, 0x0E, 0x02,
+    0x1F, 0x03, 0x02, 0x03, 0x0B, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0E, 0x01,
+    0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x30, 0x01, 0x0C, 0x01, 0x90, 0x01,
+    0x0A, 0x0C, 0x01, 0x24, 0x01, 0x18, 0x01, 0x0B, 0x01, 0x24, 0x02, 0x16,
+    0x01, 0x0D, 0x02, 0x24, 0x02, 0x13, 0x01, 0x10, 0x02, 0x12, 0x01, 0x11,
+    0x03, 0x10, 0x01, 0x13, 0x02, 0x0F, 0x01, 0x14, 0x01, 0x0F, 0x02, 0x13,
+    0x01, 0x10, 0x02, 0x12, 0x02, 0x10, 0x02, 0x12, 0x01, 0x11, 0x02, 0x11,
+    0x01, 0x12, 0x02, 0x24, 0x03, 0x0D, 0x01, 0x16, 0x01, 0x24, 0x02, 0x0B,
+    0x01, 0x18, 0x01, 0x24, 0x01, 0x2F, 0x0A, 0x19, 0x01, 0x76, 0x01, 0x19,
+    0x01, 0x22, 0x01, 0x0B, 0x01, 0x30, 0x01, 0x0C, 0x01, 0x0A, 0x02, 0x09,
+    0x01, 0x1A, 0x03, 0x03, 0x03, 0x0B, 0x01, 0x03, 0x01, 0x0E, 0x03, 0x31,
+    0x01, 0x05, 0x01, 0x1C, 0x01, 0x07, 0x01, 0x1A, 0x01, 0x09, 0x02, 0x17,
+    0x01, 0x0C, 0x01, 0x15, 0x01, 0x0E, 0x02, 0x11, 0x02, 0x11, 0x04, 0x09,
+    0x04, 0x00, 0x26, 0xB0, 0x02, 0x0E, 0x0A, 0x0E, 0x00, 0x0A, 0x10, 0x0A,
+    0x86, 0x0B, 0x01, 0x3D, 0x01, 0x3C, 0x01, 0x15, 0x01, 0x17, 0x01, 0x18,
+    0x01, 0x0C, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x1A, 0x09, 0x0B, 0x01, 0x03,
+    0x01, 0x42, 0x01, 0x05, 0x01, 0x1C, 0x01, 0x07, 0x01, 0x1A, 0x01, 0x09,
+    0x01, 0x18, 0x01, 0x0B, 0x02, 0x15, 0x01, 0x0E, 0x02, 0x11, 0x02, 0x11,
+    0x03, 0x0A, 0x04, 0x00, 0x0B, 0x15, 0x0B, 0x1F, 0x01, 0x0A, 0x02, 0x0A,
+    0x01, 0x73, 0x01, 0x02, 0x01, 0x1C, 0x01, 0x18, 0x01, 0x4B, 0x01, 0x25,
+    0x01, 0x1F, 0x01, 0x1A, 0x01, 0x44, 0x01, 0x06, 0x01, 0x43, 0x01, 0x1C,
+    0x01, 0x20, 0x01, 0x21, 0x01, 0x4A, 0x01, 0x1E, 0x01, 0x15, 0x01, 0x0A,
+    0x01, 0x6A, 0x01, 0x09, 0x01, 0x0C, 0x01, 0x09, 0x01, 0x77, 0x01, 0x11,
+    0x01, 0x09, 0x01, 0x18, 0x01, 0x66, 0x01, 0x10, 0x01, 0x0F, 0x01, 0x24,
+    0x01, 0x39, 0x01, 0x12, 0x01, 0x38, 0x01, 0x26, 0x01, 0x37, 0x01, 0x14,
+    0x01, 0x36, 0x01, 0x28, 0x01, 0x0A, 0x01, 0x16, 0x01, 0x5F, 0x01, 0x21,
+    0x01, 0x11, 0x01, 0x7F, 0x01, 0x1A, 0x01, 0x64, 0x01, 0x1C, 0x01, 0x81,
+    0x01, 0x01, 0x0B, 0x01, 0x00, 0x0A, 0x0D, 0x09, 0x0D, 0x0A, 0x63, 0x01,
+    0x0A, 0x01, 0x09, 0x01, 0x2B, 0x01, 0x16, 0x01, 0x09, 0x01, 0xBC, 0x01,
+    0x01, 0x33, 0x01, 0x0C, 0x01, 0x09, 0x01, 0x0B, 0x01, 0x09, 0x01, 0xE9,
+    0x01, 0x01, 0x11, 0x01, 0x0D, 0x01, 0x11, 0x01, 0x0E, 0x01, 0x1D, 0x01,
+    0xB4, 0x01, 0x01, 0x0F, 0x01, 0x0F, 0x01, 0x0F, 0x01, 0x1E, 0x01, 0x44,
+    0x01, 0x1A, 0x01, 0x72, 0x01, 0x09, 0x01, 0x07, 0x01, 0x0D, 0x01, 0x08,
+    0x01, 0x15, 0x01, 0x98, 0x01, 0x01, 0x19, 0x01, 0x1F, 0x01, 0x07, 0x01,
+    0x03, 0x01, 0x07, 0x01, 0x16, 0x01, 0x2B, 0x01, 0xB9, 0x01, 0x02, 0x07,
+    0x01, 0x05, 0x01, 0x07, 0x02, 0x15, 0x01, 0x29, 0x01, 0xC2, 0x01, 0x01,
+    0x07, 0x01, 0x55, 0x01, 0x27, 0x01, 0x8B, 0x01, 0x01, 0x09, 0x01, 0x55,
+    0x01, 0x25, 0x01, 0x8B, 0x01, 0x01, 0x0B, 0x01, 0x55, 0x01, 0x23, 0x01,
+    0x54, 0x01, 0x44, 0x01, 0x00, 0x0C, 0x10, 0x0B, 0x01, 0x01, 0x33, 0x01,
+    0x0E, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x33, 0x01, 0x0C, 0x01, 0x0A, 0x01,
+    0x04, 0x01, 0x3E, 0x01, 0x0A, 0x01, 0x06, 0x01, 0x0A, 0x01, 0x3C, 0x01,
+    0x08, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x31, 0x01, 0x0A, 0x01, 0x0A, 0x01,
+    0x06, 0x01, 0x31, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x31, 0x01,
+    0x0E, 0x01, 0x0A, 0x01, 0x2A, 0x01, 0x09, 0x01, 0x10, 0x01, 0x32, 0x02,
+    0x09, 0x01, 0x12, 0x01, 0x3B, 0x01, 0x14, 0x01, 0x39, 0x01, 0x16, 0x01,
+    0x37, 0x01, 0x18, 0x01, 0x35, 0x01, 0x4F, 0x01, 0x19, 0x01, 0x36, 0x01,
+    0x17, 0x01, 0x38, 0x01, 0x15, 0x01, 0x3A, 0x01, 0x13, 0x01, 0x31, 0x01,
+    0x0A, 0x01, 0x11, 0x01, 0x31, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x0F, 0x01,
+    0x35, 0x01, 0x0A, 0x01, 0x0D, 0x01, 0x0A, 0x01, 0x2C, 0x01, 0x0A, 0x01,
+    0x0B, 0x01, 0x0A, 0x01, 0x2E, 0x01, 0x0A, 0x01, 0x09, 0x01, 0x0A, 0x01,
+    0x3B, 0x01, 0x07, 0x01, 0x0A, 0x01, 0x09, 0x01, 0x33, 0x01, 0x05, 0x01,
+    0x16, 0x01, 0x1B, 0x01, 0x17, 0x01, 0x03, 0x01, 0x18, 0x01, 0x19, 0x01,
+    0x19, 0x01, 0x01, 0x01, 0x1A, 0x01, 0x17, 0x01, 0x1B, 0x01, 0x00, 0x0B,
+    0x12, 0x0B, 0x1C, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x1B, 0x01, 0x29, 0x01,
+    0x19, 0x01, 0x0A, 0x01, 0x0D, 0x01, 0x1D, 0x01, 0x22, 0x01, 0x0F, 0x01,
+    0x0C, 0x01, 0x38, 0x01, 0x20, 0x01, 0x11, 0x01, 0x0A, 0x01, 0x12, 0x01,
+    0x1E, 0x01, 0x31, 0x01, 0x09, 0x01, 0x08, 0x01, 0x09, 0x01, 0x5B, 0x01,
+    0x09, 0x01, 0x06, 0x01, 0x09, 0x01, 0x35, 0x01, 0x09, 0x01, 0x04, 0x01,
+    0x09, 0x01, 0x37, 0x01, 0x16, 0x01, 0x1A, 0x01, 0x02, 0x01, 0x43, 0x01,
+    0x14, 0x01, 0x1C, 0x02, 0x1D, 0x01, 0x12, 0x01, 0x3D, 0x01, 0x10, 0x01,
+    0x4E, 0x01, 0x18, 0x01, 0x50, 0x01, 0x0C, 0x01, 0x43, 0x01, 0x0A, 0x01,
+    0x00, 0x23, 0xFB, 0x01, 0x01, 0x25, 0x17, 0x0A, 0x01, 0x18, 0x01, 0x2D,
+    0x01, 0x18, 0x01, 0x09, 0x01, 0x18, 0x01, 0x2D, 0x01, 0x18, 0x01, 0x2D,
+    0x01, 0x18, 0x01, 0x2D, 0x01, 0x18, 0x01, 0x09, 0x01, 0x18, 0x01, 0x2D,
+    0x01, 0x18, 0x01, 0x2D, 0x01, 0x18, 0x01, 0x22, 0x01, 0x0A, 0x01, 0x22,
+    0x01, 0x18, 0x01, 0x2D, 0x01, 0x18, 0x01, 0x2D, 0x01, 0x18, 0x01, 0x22,
+    0x01, 0x0A, 0x01, 0x22, 0x01, 0x18, 0x01, 0x2D, 0x01, 0x18, 0x01, 0x2D,
+    0x01, 0x18, 0x01, 0x22, 0x01, 0x0A, 0x01, 0x22, 0x01, 0x18, 0x01, 0x2D,
+    0x01, 0x18, 0x01, 0x22, 0x01, 0x0A, 0x01, 0x3B, 0x01, 0x0B, 0x17, 0x24,
+    0x01, 0x00, 0x0F, 0x73, 0x05, 0x8E, 0x07, 0x05, 0x00, 0x0A, 0x30, 0x01,
+    0x26, 0x01, 0x30, 0x01, 0x26, 0x01, 0x30, 0x01, 0x26, 0x01, 0x4D, 0x01,
+    0x09, 0x01, 0x4D, 0x01, 0x09, 0x01, 0x4D, 0x01, 0x09, 0x01, 0x4D, 0x01,
+    0x09, 0x01, 0x4D, 0x01, 0x09, 0x01, 0x4D, 0x01, 0x09, 0x01, 0x4D, 0x01,
+    0x09, 0x01, 0x4D, 0x01, 0x26, 0x01, 0x30, 0x01, 0x26, 0x01, 0x30, 0x01,
+    0x26, 0x01, 0x30, 0x01, 0x26, 0x01, 0x30, 0x01, 0x26, 0x01, 0x4D, 0x01,
+    0x09, 0x01, 0x4D, 0x01, 0x09, 0x01, 0x4D, 0x01, 0x09, 0x01, 0x4D, 0x01,
+    0x09, 0x01, 0x00, 0x0F, 0x69, 0x05, 0x8E, 0x07, 0x05, 0x09, 0x08, 0x45,
+    0x01, 0x08, 0x01, 0x43, 0x01, 0x0A, 0x01, 0x34, 0x01, 0x0C, 0x01, 0x3A,
+    0x01, 0x06, 0x01, 0x0A, 0x01, 0x06, 0x01, 0x3C, 0x01, 0x08, 0x01, 0x09,
+    0x01, 0x16, 0x01, 0x24, 0x01, 0x06, 0x01, 0x0B, 0x01, 0x14, 0x01, 0x26,
+    0x01, 0x04, 0x01, 0x27, 0x01, 0x12, 0x01, 0x0E, 0x01, 0x02, 0x01, 0x29,
+    0x01, 0x10, 0x01, 0x10, 0x02, 0x00, 0x1D, 0x00, 0x0C, 0x07, 0x01, 0x13,
+    0x01, 0x0A, 0x01, 0x08, 0x01, 0x13, 0x01, 0x09, 0x01, 0x09, 0x01, 0x09,
+    0x01, 0x09, 0x01, 0x13, 0x01, 0x08, 0x01, 0x13, 0x01, 0x09, 0x01, 0x13,
+    0x01, 0x08, 0x01, 0x0A, 0x01, 0x0B, 0x09, 0x13, 0x03, 0x09, 0x03, 0x0F,
+    0x01, 0x0F, 0x02, 0x0B, 0x02, 0x12, 0x01, 0x09, 0x01, 0x15, 0x01, 0x07,
+    0x01, 0x17, 0x01, 0x24, 0x01, 0x19, 0x01, 0x0F, 0x05, 0x0E, 0x01, 0x0A,
+    0x01, 0x05, 0x01, 0x17, 0x01, 0x26, 0x01, 0x09, 0x01, 0x21, 0x0A, 0x7C,
+    0x09, 0x13, 0x03, 0x1A, 0x02, 0x1C, 0x01, 0x1C, 0x02, 0x3B, 0x01, 0x0B,
+    0x06, 0x0C, 0x01, 0x0A, 0x02, 0x1C, 0x01, 0x32, 0x01, 0x09, 0x01, 0xB9,
+    0x01, 0x01, 0x08, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x05, 0x02, 0x18, 0x05,
+    0x2E, 0x01, 0x1F, 0x01, 0x3E, 0x01, 0x0F, 0x02, 0x09, 0x01, 0x04, 0x02,
+    0x0B, 0x02, 0x12, 0x02, 0x07, 0x02, 0x04, 0x0A, 0x00, 0x0A, 0xA5, 0x04,
+    0x07, 0x17, 0x02, 0x07, 0x03, 0x13, 0x01, 0x0C, 0x01, 0x11, 0x01, 0x0E,
+    0x01, 0x0F, 0x01, 0x10, 0x01, 0x20, 0x01, 0x40, 0x01, 0x10, 0x04, 0x1A,
+    0x02, 0x04, 0x02, 0x0A, 0x01, 0x0C, 0x01, 0x1E, 0x01, 0x09, 0x01, 0x40,
+    0x01, 0x49, 0x01, 0x9F, 0x03, 0x01, 0x35, 0x01, 0x34, 0x01, 0x09, 0x01,
+    0x16, 0x01, 0x20, 0x02, 0x04, 0x02, 0x0A, 0x01, 0x0F, 0x04, 0x2B, 0x01,
+    0x3E, 0x01, 0x0C, 0x02, 0x10, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x11, 0x01,
+    0x0C, 0x01, 0x06, 0x09, 0x04, 0x02, 0x07, 0x03, 0x0C, 0x08, 0x14, 0x03,
+    0x08, 0x03, 0x0F, 0x02, 0x0E, 0x02, 0x0B, 0x02, 0x12, 0x01, 0x09, 0x01,
+    0x15, 0x01, 0x1F, 0x01, 0x06, 0x01, 0x1D, 0x01, 0x19, 0x01, 0x10, 0x04,
+    0x19, 0x02, 0x04, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x01, 0x07, 0x01,
+    0x1F, 0x01, 0x14, 0x01, 0x14, 0x01, 0x3C, 0x01, 0x34, 0x0A, 0xEA, 0x02,
+    0x0A, 0x1F, 0x01, 0x1D, 0x01, 0x0A, 0x01, 0x28, 0x01, 0x0B, 0x01, 0x09,
+    0x01, 0x1F, 0x02, 0x04, 0x02, 0x09, 0x01, 0x0F, 0x04, 0x0F, 0x01, 0x19,
+    0x01, 0x05, 0x01, 0x36, 0x01, 0x07, 0x01, 0x15, 0x01, 0x09, 0x02, 0x11,
+    0x02, 0x0C, 0x01, 0x0F, 0x01, 0x0F, 0x04, 0x08, 0x03, 0x16, 0x09, 0xFA,
+    0x03, 0x07, 0x15, 0x03, 0x07, 0x02, 0x12, 0x01, 0x0C, 0x01, 0x0F, 0x02,
+    0x0E, 0x01, 0x1F, 0x01, 0x0C, 0x01, 0x1D, 0x01, 0x3C, 0x01, 0x0C, 0x04,
+    0x19, 0x02, 0x04, 0x02, 0x16, 0x01, 0x08, 0x01, 0x29, 0x01, 0x09, 0x01,
+    0x0A, 0x01, 0xB7, 0x04, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x33, 0x01, 0x08,
+    0x01, 0x0B, 0x01, 0x0A, 0x02, 0x03, 0x03, 0x19, 0x03, 0x2F, 0x01, 0x1F,
+    0x01, 0x1F, 0x01, 0x10, 0x01, 0x0E, 0x01, 0x0E, 0x01, 0x10, 0x01, 0x0C,
+    0x01, 0x12, 0x03, 0x06, 0x03, 0x03, 0x09, 0x0C, 0x09, 0x14, 0x03, 0x09,
+    0x03, 0x0F, 0x02, 0x0F, 0x01, 0x0D, 0x01, 0x12, 0x01, 0x0B, 0x01, 0x14,
+    0x01, 0x09, 0x01, 0x16, 0x01, 0x07, 0x01, 0x18, 0x01, 0x25, 0x01, 0x0B,
+    0x04, 0x0B, 0x01, 0x0E, 0x02, 0x04, 0x02, 0x20, 0x01, 0x09, 0x01, 0x02,
+    0x01, 0x09, 0x01, 0x29, 0x01, 0x34, 0x01, 0x15, 0x01, 0x3E, 0x01, 0x2A,
+    0x0C, 0xD4, 0x01, 0x16, 0x60, 0x01, 0x09, 0x01, 0x4F, 0x02, 0x0F, 0x01,
+    0x0D, 0x01, 0x07, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x03, 0x01, 0x10, 0x02,
+    0x06, 0x03, 0x05, 0x01, 0x04, 0x01, 0x0C, 0x06, 0x29, 0x01, 0x04, 0x01,
+    0x20, 0x01, 0x19, 0x01, 0x06, 0x01, 0x17, 0x01, 0x08, 0x02, 0x13, 0x02,
+    0x0B, 0x01, 0x10, 0x02, 0x0E, 0x03, 0x0A, 0x03, 0x0E, 0x08, 0x0C, 0x03,
+    0x08, 0x01, 0x0A, 0x01, 0x15, 0x01, 0x0C, 0x01, 0x08, 0x01, 0x15, 0x01,
+    0x15, 0x01, 0x39, 0x04, 0x06, 0x01, 0x0A, 0x02, 0x14, 0x01, 0xBF, 0x01,
+    0x05, 0x0A, 0x06, 0x8C, 0x01, 0x05, 0x0A, 0x06, 0x0A, 0x07, 0x16, 0x03,
+    0x07, 0x03, 0x03, 0x09, 0x06, 0x01, 0x0D, 0x01, 0x10, 0x01, 0x0F, 0x01,
+    0x0E, 0x01, 0x11, 0x01, 0x0C, 0x01, 0x3E, 0x01, 0x2C, 0x03, 0x0F, 0x01,
+    0x0B, 0x02, 0x03, 0x02, 0x18, 0x01, 0x07, 0x01, 0x16, 0x01, 0x09, 0x01,
+    0x2A, 0x01, 0x09, 0x01, 0x95, 0x04, 0x01, 0x09, 0x01, 0x40, 0x01, 0x09,
+    0x01, 0x16, 0x01, 0x07, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x03, 0x02, 0x1B,
+    0x03, 0x10, 0x01, 0x40, 0x01, 0x20, 0x01, 0x10, 0x01, 0x0F, 0x01, 0x0E,
+    0x01, 0x11, 0x01, 0x0C, 0x01, 0x13, 0x03, 0x07, 0x02, 0x17, 0x07, 0x64,
+    0x01, 0x09, 0x01, 0x05, 0x02, 0x20, 0x02, 0x0B, 0x01, 0x0F, 0x01, 0x04,
+    0x02, 0x07, 0x02, 0x17, 0x07, 0x0C, 0x01, 0x04, 0x01, 0x39, 0x01, 0x1E,
+    0x01, 0x06, 0x01, 0x17, 0x01, 0x08, 0x02, 0x14, 0x01, 0x0B, 0x02, 0x10,
+    0x02, 0x0E, 0x03, 0x0A, 0x03, 0x00, 0x0A, 0x83, 0x04, 0x07, 0x15, 0x02,
+    0x07, 0x03, 0x11, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0D, 0x01,
+    0x10, 0x01, 0x3C, 0x01, 0x2C, 0x04, 0x19, 0x01, 0x04, 0x02, 0x0A, 0x01,
+    0x0B, 0x01, 0x1C, 0x01, 0x08, 0x01, 0x05, 0x01, 0x07, 0x03, 0x01, 0x03,
+    0x03, 0x01, 0x07, 0x01, 0x0B, 0x02, 0x2B, 0x01, 0x09, 0x01, 0x01, 0x01,
+    0x0B, 0x01, 0x05, 0x02, 0x04, 0x05, 0x30, 0x0A, 0x0B, 0x01, 0x0D, 0x03,
+    0x01, 0x03, 0x09, 0x01, 0x07, 0x01, 0x07, 0x01, 0x1A, 0x01, 0x32, 0x01,
+    0x06, 0x01, 0x19, 0x01, 0x08, 0x02, 0x05, 0x01, 0x0B, 0x05, 0x4E, 0x09,
+    0xF3, 0x05, 0x01, 0x2C, 0x01, 0x03, 0x02, 0x0C, 0x03, 0x1C, 0x01, 0x20,
+    0x01, 0x0F, 0x01, 0x1F, 0x02, 0x04, 0x01, 0x08, 0x02, 0x00, 0x0A, 0xDB,
+    0x04, 0x0C, 0x20, 0x01, 0x14, 0x01, 0x2B, 0x01, 0x14, 0x01, 0x0A, 0x01,
+    0x14, 0x01, 0x2B, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x14, 0x01, 0x0A, 0x01,
+    0x35, 0x01, 0x0A, 0x01, 0x14, 0x01, 0x0A, 0x01, 0x1F, 0x01, 0x15, 0x01,
+    0x1F, 0x01, 0x0A, 0x01, 0x1F, 0x01, 0x83, 0x01, 0x01, 0x42, 0x01, 0x42,
+    0x01, 0x37, 0x02, 0x09, 0x01, 0x14, 0x01, 0x0C, 0x01, 0x12, 0x01, 0x03,
+    0x01, 0x2B, 0x01, 0x16, 0x01, 0x2B, 0x01, 0x16, 0x01, 0x2B, 0x01, 0x16,
+    0x01, 0x0A, 0x01, 0x37, 0x01, 0x0A, 0x01, 0x37, 0x01, 0x0A, 0x01, 0x37,
+    0x01, 0x0A, 0x01, 0x00, 0x0A, 0x10, 0x07, 0x0C, 0x07, 0x08, 0x09, 0x04,
+    0x03, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02, 0x0F, 0x01, 0x02, 0x01, 0x0C,
+    0x01, 0x05, 0x02, 0x0B, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x03, 0x01, 0x0F,
+    0x01, 0x0D, 0x01, 0x10, 0x01, 0x01, 0x01, 0x30, 0x01, 0x12, 0x01, 0x64,
+    0x01, 0x0E, 0x04, 0x10, 0x04, 0x19, 0x01, 0x04, 0x02, 0x0D, 0x01, 0x04,
+    0x01, 0x17, 0x01, 0x13, 0x01, 0x06, 0x01, 0x15, 0x01, 0x08, 0x01, 0x0A,
+    0x01, 0x12, 0x01, 0x27, 0x01, 0x10, 0x07, 0x07, 0x09, 0x04, 0x03, 0x07,
+    0x02, 0x11, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0D, 0x01, 0x10,
+    0x01, 0x0B, 0x01, 0x30, 0x01, 0x2C, 0x04, 0x19, 0x01, 0x04, 0x02, 0x0A,
+    0x01, 0x0B, 0x01, 0x1C, 0x01, 0x08, 0x01, 0x0C, 0x09, 0x15, 0x03, 0x09,
+    0x03, 0x10, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x12, 0x02, 0x0B, 0x01, 0x15,
+    0x01, 0x09, 0x01, 0x17, 0x01, 0x07, 0x01, 0x3A, 0x01, 0x05, 0x01, 0x0B,
+    0x04, 0x0C, 0x01, 0x0F, 0x01, 0x04, 0x02, 0x0E, 0x01, 0x0A, 0x01, 0x07,
+    0x01, 0x17, 0x01, 0x09, 0x01, 0x09, 0x01, 0x2C, 0x01, 0x16, 0x01, 0x15,
+    0x01, 0x2A, 0x01, 0xAC, 0x03, 0x02, 0x15, 0x01, 0x14, 0x01, 0x42, 0x01,
+    0x09, 0x01, 0x09, 0x01, 0x02, 0x01, 0x0A, 0x01, 0x07, 0x01, 0x19, 0x01,
+    0x05, 0x01, 0x0F, 0x01, 0x0B, 0x05, 0x0B, 0x01, 0x1F, 0x01, 0x06, 0x01,
+    0x21, 0x01, 0x17, 0x01, 0x09, 0x01, 0x15, 0x01, 0x0B, 0x01, 0x13, 0x01,
+    0x0D, 0x02, 0x0F, 0x02, 0x10, 0x03, 0x09, 0x03, 0x0F, 0x07, 0x0A, 0x09,
+    0x04, 0x02, 0x07, 0x03, 0x13, 0x01, 0x0C, 0x01, 0x11, 0x01, 0x0E, 0x01,
+    0x0E, 0x02, 0x10, 0x01, 0x20, 0x01, 0x40, 0x01, 0x10, 0x03, 0x1B, 0x02,
+    0x03, 0x02, 0x0B, 0x01, 0x0C, 0x01, 0x07, 0x01, 0x16, 0x01, 0x09, 0x01,
+    0x60, 0x01, 0x29, 0x01, 0x9F, 0x03, 0x01, 0x15, 0x01, 0x54, 0x01, 0x09,
+    0x01, 0x1E, 0x01, 0x0A, 0x01, 0x0C, 0x02, 0x05, 0x01, 0x1A, 0x05, 0x2B,
+    0x01, 0x3E, 0x01, 0x0D, 0x01, 0x10, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x11,
+    0x01, 0x0C, 0x01, 0x13, 0x02, 0x07, 0x03, 0x16, 0x07, 0x09, 0x08, 0x15,
+    0x02, 0x08, 0x02, 0x04, 0x08, 0x05, 0x02, 0x0C, 0x01, 0x02, 0x01, 0x0C,
+    0x01, 0x0F, 0x01, 0x1F, 0x01, 0x0C, 0x01, 0x1D, 0x01, 0x3C, 0x01, 0x0C,
+    0x04, 0x19, 0x02, 0x04, 0x02, 0x16, 0x01, 0x08, 0x01, 0x1F, 0x01, 0x09,
+    0x01, 0x09, 0x01, 0xC2, 0x04, 0x01, 0x09, 0x01, 0x29, 0x01, 0x14, 0x01,
+    0x08, 0x01, 0x0B, 0x01, 0x0A, 0x02, 0x04, 0x02, 0x19, 0x04, 0x2E, 0x01,
+    0x1F, 0x01, 0x1F, 0x01, 0x10, 0x01, 0x0E, 0x01, 0x0E, 0x01, 0x10, 0x01,
+    0x0C, 0x01, 0x12, 0x03, 0x07, 0x02, 0x16, 0x07, 0x0E, 0x10, 0x03, 0x01,
+    0x11, 0x02, 0x25, 0x01, 0x7A, 0x07, 0x0C, 0x01, 0x12, 0x01, 0x12, 0x01,
+    0x0A, 0x09, 0x12, 0x02, 0x09, 0x03, 0x0D, 0x02, 0x0E, 0x02, 0x0A, 0x01,
+    0x12, 0x01, 0x08, 0x01, 0x14, 0x01, 0x06, 0x01, 0x16, 0x01, 0x04, 0x01,
+    0x18, 0x01, 0x1F, 0x01, 0x0A, 0x06, 0x0A, 0x01, 0x0B, 0x01, 0x06, 0x01,
+    0x14, 0x01, 0x56, 0x01, 0x08, 0x0A, 0x28, 0x02, 0x1D, 0x02, 0x0F, 0x01,
+    0x0D, 0x02, 0x1D, 0x02, 0x0C, 0x01, 0x10, 0x02, 0x0B, 0x01, 0x11, 0x02,
+    0x0A, 0x02, 0x11, 0x02, 0x0A, 0x01, 0x12, 0x01, 0x0A, 0x02, 0x11, 0x01,
+    0x0B, 0x02, 0x10, 0x01, 0x0C, 0x02, 0x1D, 0x03, 0x0C, 0x01, 0x10, 0x01,
+    0x1D, 0x02, 0x27, 0x09, 0x0A, 0x01, 0x2F, 0x01, 0x26, 0x01, 0x09, 0x01,
+    0x09, 0x01, 0x07, 0x01, 0x15, 0x07, 0x0A, 0x01, 0x01, 0x01, 0x36, 0x01,
+    0x03, 0x01, 0x1D, 0x01, 0x16, 0x01, 0x06, 0x02, 0x12, 0x02, 0x09, 0x01,
+    0x0F, 0x02, 0x0C, 0x03, 0x0A, 0x02, 0x05, 0x0A, 0xC3, 0x01, 0x05, 0x0A,
+    0x06, 0x7E, 0x05, 0x0A, 0x06, 0x87, 0x04, 0x01, 0x15, 0x02, 0x02, 0x01,
+    0x05, 0x01, 0x0C, 0x02, 0x31, 0x01, 0x2A, 0x01, 0x15, 0x01, 0x15, 0x02,
+    0x08, 0x02, 0x00, 0x0A, 0x0A, 0x0A, 0x8E, 0x07, 0x01, 0x08, 0x01, 0x0A,
+    0x01, 0x11, 0x01, 0x16, 0x02, 0x03, 0x02, 0x19, 0x03, 0x2D, 0x01, 0x3C,
+    0x01, 0x11, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x0E, 0x02, 0x0B, 0x02, 0x11,
+    0x02, 0x07, 0x02, 0x04, 0x09, 0x00, 0x0B, 0x0B, 0x0B, 0x54, 0x01, 0x09,
+    0x01, 0x21, 0x01, 0x09, 0x01, 0x52, 0x01, 0x03, 0x01, 0x11, 0x01, 0x37,
+    0x01, 0x10, 0x01, 0x25, 0x01, 0x0F, 0x01, 0x39, 0x01, 0x0E, 0x01, 0x07,
+    0x01, 0x4D, 0x01, 0x08, 0x01, 0x29, 0x01, 0x08, 0x01, 0x4B, 0x01, 0x0B,
+    0x01, 0x0A, 0x01, 0x1D, 0x01, 0x29, 0x01, 0x2D, 0x01, 0x08, 0x01, 0x47,
+    0x01, 0x0F, 0x01, 0x4E, 0x01, 0x31, 0x01, 0x4C, 0x01, 0x33, 0x01, 0x4A,
+    0x01, 0x15, 0x01, 0x01, 0x09, 0x0A, 0x07, 0x0B, 0x09, 0x1B, 0x01, 0x09,
+    0x01, 0x42, 0x01, 0x08, 0x01, 0x1A, 0x01, 0x30, 0x01, 0x1A, 0x01, 0x53,
+    0x01, 0x11, 0x01, 0x37, 0x01, 0x03, 0x01, 0x08, 0x01, 0x11, 0x01, 0x51,
+    0x01, 0x49, 0x01, 0x20, 0x01, 0x04, 0x01, 0x0E, 0x01, 0x37, 0x01, 0x03,
+    0x01, 0x64, 0x01, 0x07, 0x01, 0x0B, 0x01, 0x25, 0x01, 0x10, 0x01, 0x0A,
+    0x01, 0x08, 0x01, 0x23, 0x01, 0x37, 0x01, 0x09, 0x01, 0x38, 0x01, 0x09,
+    0x01, 0x08, 0x01, 0x0A, 0x01, 0x36, 0x01, 0x22, 0x01, 0x42, 0x01, 0x1F,
+    0x01, 0x1A, 0x01, 0x3C, 0x01, 0x64, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x3A,
+    0x01, 0x66, 0x01, 0x0A, 0x01, 0x3E, 0x01, 0x09, 0x01, 0x39, 0x01, 0x66,
+    0x01, 0x01, 0x0B, 0x0A, 0x0A, 0x02, 0x01, 0x13, 0x01, 0x17, 0x01, 0x12,
+    0x01, 0x03, 0x01, 0x11, 0x01, 0x19, 0x01, 0x10, 0x01, 0x05, 0x01, 0x0F,
+    0x01, 0x09, 0x01, 0x11, 0x01, 0x16, 0x01, 0x17, 0x01, 0x16, 0x01, 0x13,
+    0x01, 0x09, 0x01, 0x0B, 0x01, 0x16, 0x01, 0x15, 0x01, 0x09, 0x01, 0x09,
+    0x01, 0x2E, 0x01, 0x11, 0x01, 0x30, 0x01, 0x0F, 0x01, 0x32, 0x01, 0x0D,
+    0x01, 0x34, 0x01, 0x0B, 0x01, 0x35, 0x01, 0x2C, 0x01, 0x13, 0x01, 0x0D,
+    0x01, 0x32, 0x01, 0x0F, 0x01, 0x30, 0x01, 0x11, 0x01, 0x2E, 0x01, 0x09,
+    0x01, 0x09, 0x01, 0x2C, 0x01, 0x09, 0x01, 0x01, 0x01, 0x09, 0x01, 0x2A,
+    0x01, 0x0D, 0x01, 0x09, 0x01, 0x12, 0x01, 0x15, 0x01, 0x0F, 0x01, 0x09,
+    0x01, 0x10, 0x01, 0x15, 0x01, 0x11, 0x01, 0x09, 0x01, 0x0E, 0x01, 0x15,
+    0x01, 0x13, 0x01, 0x09, 0x01, 0x0C, 0x01, 0x14, 0x01, 0x00, 0x0A, 0x0C,
+    0x0A, 0x0A, 0x01, 0x15, 0x01, 0x14, 0x01, 0x29, 0x01, 0x2B, 0x01, 0x15,
+    0x01, 0x1C, 0x01, 0x15, 0x01, 0x2D, 0x01, 0x09, 0x01, 0x30, 0x01, 0x15,
+    0x01, 0x2F, 0x01, 0x18, 0x01, 0x10, 0x01, 0x24, 0x01, 0x11, 0x01, 0x36,
+    0x01, 0x12, 0x01, 0x16, 0x01, 0x0B, 0x01, 0x28, 0x01, 0x4B, 0x01, 0x08,
+    0x02, 0x28, 0x01, 0x2D, 0x01, 0x30, 0x01, 0x4F, 0x01, 0x0E, 0x01, 0x51,
+    0x01, 0x2C, 0x01, 0x53, 0x01, 0x0A, 0x01, 0x55, 0x01, 0x28, 0x01, 0x16,
+    0x01, 0x47, 0x01, 0x16, 0x01, 0x3E, 0x01, 0x1C, 0x03, 0x09, 0x01, 0x10,
+    0x03, 0x2B, 0x01, 0x3E, 0x01, 0x1E, 0x01, 0x1E, 0x01, 0x1E, 0x01, 0x15,
+    0x01, 0x07, 0x02, 0x01, 0x1C, 0xAD, 0x01, 0x01, 0x1E, 0x10, 0x0A, 0x01,
+    0x11, 0x01, 0x09, 0x01, 0x11, 0x01, 0x26, 0x01, 0x11, 0x01, 0x26, 0x01,
+    0x11, 0x01, 0x09, 0x01, 0x11, 0x01, 0x26, 0x01, 0x11, 0x01, 0x09, 0x01,
+    0x11, 0x01, 0x26, 0x01, 0x11, 0x01, 0x1B, 0x01, 0x0A, 0x01, 0x1B, 0x01,
+    0x11, 0x01, 0x26, 0x01, 0x11, 0x01, 0x09, 0x01, 0x11, 0x01, 0x26, 0x01,
+    0x11, 0x01, 0x09, 0x01, 0x11, 0x01, 0x26, 0x01, 0x11, 0x01, 0x26, 0x01,
+    0x11, 0x01, 0x0A, 0x12, 0x10, 0x02, 0x0F, 0x02, 0x0F, 0x02, 0x10, 0x01,
+    0x06, 0x01, 0x0A, 0x01, 0x11, 0x01, 0x1B, 0x01, 0x08, 0x01, 0x08, 0x01,
+    0x11, 0x01, 0x09, 0x01, 0x2D, 0x01, 0x09, 0x01, 0xC1, 0x02, 0x01, 0x08,
+    0x01, 0x2E, 0x01, 0x08, 0x01, 0x07, 0x02, 0x0F, 0x02, 0x0A, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x07,
+    0x03, 0x09, 0x01, 0x09, 0x01, 0x13, 0x01, 0x08, 0x01, 0x30, 0x01, 0x08,
+    0x01, 0xBA, 0x02, 0x01, 0x1B, 0x01, 0x1D, 0x01, 0x1B, 0x01, 0x0A, 0x01,
+    0x08, 0x01, 0x13, 0x01, 0x09, 0x01, 0x13, 0x01, 0x13, 0x01, 0x06, 0x01,
+    0x0C, 0x02, 0x13, 0x02, 0x00, 0x06, 0x02, 0x01, 0x11, 0x01, 0x01, 0x02,
+    0x13, 0x02, 0x13, 0x01, 0x0B, 0x01, 0x07, 0x01, 0x13, 0x01, 0x09, 0x01,
+    0x09, 0x01, 0x09, 0x01, 0x13, 0x01, 0x08, 0x01, 0x1D, 0x01, 0x08, 0x01,
+    0x56, 0x01, 0x1B, 0x01, 0x94, 0x02, 0x01, 0x08, 0x01, 0x13, 0x01, 0x09,
+    0x01, 0x09, 0x02, 0x13, 0x01, 0x07, 0x01, 0x13, 0x01, 0x13, 0x02, 0x11,
+    0x02, 0x10, 0x01, 0x11, 0x01, 0x1C, 0x02, 0x06, 0x01, 0x08, 0x02, 0x1A,
+    0x01, 0x08, 0x01, 0x9B, 0x02, 0x01, 0x09, 0x01, 0x5D, 0x01, 0x08, 0x01,
+    0x1B, 0x01, 0x08, 0x01, 0x08, 0x01, 0x11, 0x01, 0x09, 0x01, 0x11, 0x01,
+    0x09, 0x01, 0x07, 0x01, 0x11, 0x01, 0x10, 0x02, 0x0D, 0x01, 0x01, 0x02,
+    0x08, 0x06, 0x1C, 0x02, 0x06, 0x02, 0x0D, 0x07, 0x05, 0x01, 0x0A, 0x01,
+    0x17, 0x01, 0x0C, 0x01, 0x15, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x09, 0x01,
+    0x10, 0x01, 0x24, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x13, 0x01, 0x05, 0x01,
+    0x13, 0x01, 0x0A, 0x02, 0x01, 0x02, 0x12, 0x02, 0x01, 0x02, 0x0A, 0x01,
+    0x19, 0x01, 0x13, 0x01, 0x01, 0x01, 0x07, 0x01, 0x06, 0x01, 0x24, 0x01,
+    0x10, 0x01, 0x13, 0x01, 0x0E, 0x01, 0x15, 0x01, 0x0C, 0x01, 0x0B, 0x01,
+    0x0B, 0x01, 0x0A, 0x01, 0x05, 0x07, 0x0D, 0x02, 0x06, 0x02};
+
+static const GFXglyph Roboto_Condensed_SemiBold40pt7bRLEGlyphs[] = {
+    {0, 1, 1, 18, 0, 0},           // 0x20 ' '
+    {0, 11, 56, 20, 5, -54},       // 0x21 '!'
+    {30, 19, 20, 25, 3, -58},      // 0x22 '"'
+    {39, 36, 55, 42, 3, -54},      // 0x23 '#'
+    {116, 31, 72, 39, 4, -63},     // 0x24 '$'
+    {283, 42, 57, 50, 4, -55},     // 0x25 '%'
+    {513, 40, 57, 44, 3, -55},     // 0x26 '&'
+    {712, 7, 20, 13, 3, -58},      // 0x27 '''
+    {716, 18, 79, 25, 5, -61},     // 0x28 '('
+    {827, 19, 79, 25, 2, -61},     // 0x29 ')'
+    {942, 33, 33, 35, 1, -54},     // 0x2A '*'
+    {1059, 32, 40, 37, 3, -45},    // 0x2B '+'
+    {1071, 13, 22, 18, 1, -8},     // 0x2C ','
+    {1098, 18, 8, 26, 4, -27},     // 0x2D '-'
+    {1100, 12, 11, 22, 5, -9},     // 0x2E '.'
+    {1126, 25, 60, 27, 0, -54},    // 0x2F '/'
+    {1196, 31, 57, 39, 4, -55},    // 0x30 '0'
+    {1302, 21, 55, 39, 6, -54},    // 0x31 '1'
+    {1330, 33, 56, 39, 3, -55},    // 0x32 '2'
+    {1467, 32, 57, 39, 3, -55},    // 0x33 '3'
+    {1613, 35, 55, 39, 2, -54},    // 0x34 '4'
+    {1682, 32, 56, 39, 4, -54},    // 0x35 '5'
+    {1792, 32, 56, 39, 4, -54},    // 0x36 '6'
+    {1939, 33, 55, 39, 3, -54},    // 0x37 '7'
+    {2012, 31, 57, 39, 4, -55},    // 0x38 '8'
+    {2184, 31, 56, 39, 4, -55},    // 0x39 '9'
+    {2321, 12, 43, 21, 5, -41},    // 0x3A ':'
+    {2376, 14, 55, 19, 2, -41},    // 0x3B ';'
+    {2436, 28, 36, 35, 2, -41},    // 0x3C '<'
+    {2526, 29, 24, 39, 5, -36},    // 0x3D '='
+    {2534, 28, 36, 36, 5, -41},    // 0x3E '>'
+    {2624, 29, 57, 34, 2, -55},    // 0x3F '?'
+    {2740, 54, 71, 60, 3, -53},    // 0x40 '@'
+    {3049, 44, 55, 46, 1, -54},    // 0x41 'A'
+    {3160, 35, 55, 44, 5, -54},    // 0x42 'B'
+    {3251, 38, 57, 44, 4, -55},    // 0x43 'C'
+    {3380, 35, 55, 44, 5, -54},    // 0x44 'D'
+    {3451, 31, 55, 38, 5, -54},    // 0x45 'E'
+    {3465, 30, 55, 37, 5, -54},    // 0x46 'F'
+    {3476, 38, 57, 46, 4, -55},    // 0x47 'G'
+    {3599, 38, 55, 48, 5, -54},    // 0x48 'H'
+    {3609, 10, 55, 21, 5, -54},    // 0x49 'I'
+    {3611, 31, 56, 38, 2, -54},    // 0x4A 'J'
+    {3660, 38, 55, 43, 5, -54},    // 0x4B 'K'
+    {3792, 30, 55, 37, 5, -54},    // 0x4C 'L'
+    {3797, 49, 55, 59, 5, -54},    // 0x4D 'M'
+    {3905, 38, 55, 48, 5, -54},    // 0x4E 'N'
+    {3981, 39, 57, 47, 4, -55},    // 0x4F 'O'
+    {4116, 36, 55, 44, 5, -54},    // 0x50 'P'
+    {4175, 39, 66, 47, 4, -55},    // 0x51 'Q'
+    {4340, 36, 55, 43, 5, -54},    // 0x52 'R'
+    {4432, 36, 57, 42, 3, -55},    // 0x53 'S'
+    {4609, 38, 55, 42, 2, -54},    // 0x54 'T'
+    {4616, 36, 56, 44, 4, -54},    // 0x55 'U'
+    {4671, 43, 55, 45, 1, -54},    // 0x56 'V'
+    {4780, 55, 55, 59, 2, -54},    // 0x57 'W'
+    {4912, 40, 55, 44, 2, -54},    // 0x58 'X'
+    {5086, 40, 55, 42, 1, -54},    // 0x59 'Y'
+    {5184, 36, 55, 41, 3, -54},    // 0x5A 'Z'
+    {5281, 15, 77, 20, 4, -63},    // 0x5B '['
+    {5288, 29, 60, 30, 1, -54},    // 0x5C '\'
+    {5366, 15, 77, 20, 1, -63},    // 0x5D ']'
+    {5373, 26, 28, 30, 2, -54},    // 0x5E '^'
+    {5429, 29, 8, 31, 1, 1},       // 0x5F '_'
+    {5431, 19, 12, 25, 2, -58},    // 0x60 '`'
+    {5465, 31, 43, 37, 3, -41},    // 0x61 'a'
+    {5564, 32, 60, 39, 4, -58},    // 0x62 'b'
+    {5648, 31, 43, 36, 3, -41},    // 0x63 'c'
+    {5745, 31, 60, 39, 3, -58},    // 0x64 'd'
+    {5827, 32, 43, 37, 3, -41},    // 0x65 'e'
+    {5936, 23, 60, 25, 2, -59},    // 0x66 'f'
+    {5972, 32, 58, 39, 3, -41},    // 0x67 'g'
+    {6101, 30, 59, 38, 4, -58},    // 0x68 'h'
+    {6138, 11, 57, 19, 4, -56},    // 0x69 'i'
+    {6164, 17, 73, 19, -2, -56},   // 0x6A 'j'
+    {6213, 33, 59, 37, 4, -58},    // 0x6B 'k'
+    {6303, 10, 59, 19, 5, -58},    // 0x6C 'l'
+    {6305, 50, 42, 58, 4, -41},    // 0x6D 'm'
+    {6377, 30, 42, 38, 4, -41},    // 0x6E 'n'
+    {6415, 33, 43, 39, 3, -41},    // 0x6F 'o'
+    {6524, 32, 58, 39, 4, -41},    // 0x70 'p'
+    {6609, 31, 58, 39, 3, -41},    // 0x71 'q'
+    {6692, 20, 42, 25, 4, -41},    // 0x72 'r'
+    {6708, 29, 43, 35, 3, -41},    // 0x73 's'
+    {6834, 21, 52, 24, 1, -50},    // 0x74 't'
+    {6866, 30, 42, 38, 4, -40},    // 0x75 'u'
+    {6905, 32, 41, 35, 1, -40},    // 0x76 'v'
+    {6975, 47, 41, 50, 1, -40},    // 0x77 'w'
+    {7081, 33, 41, 35, 1, -40},    // 0x78 'x'
+    {7209, 32, 57, 34, 1, -40},    // 0x79 'y'
+    {7311, 29, 41, 35, 3, -40},    // 0x7A 'z'
+    {7384, 19, 75, 23, 2, -60},    // 0x7B '{'
+    {7480, 6, 65, 20, 7, -54},     // 0x7C '|'
+    {7482, 19, 75, 23, 2, -60},    // 0x7D '}'
+    {7584, 36, 17, 44, 4, -31}};   // 0x7E '~'
+
+const GFXfontRLE Roboto_Condensed_SemiBold40pt7bRLE = {
+    {(uint8_t *)Roboto_Condensed_SemiBold40pt7bRLEBitmaps,
+     (GFXglyph *)Roboto_Condensed_SemiBold40pt7bRLEGlyphs,
+     0x20, 0x7E, 92},
+    18113, 7666,
+    NULL, 0};
+
@@ -0,0 +1,21 @@
+// Generated by font_pack, do not edit
+#ifndef BADGE_FONTS_H
+#define BADGE_FONTS_H
+
+#include <stdint.h>
+#include "gfxfont.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    extern const GFXfontRLE Roboto_Condensed_SemiBold75pt7bRLE;
+    extern const GFXfontRLE Roboto_Condensed_SemiBold60pt7bRLE;
+    extern const GFXfontRLE Roboto_Condensed_SemiBold40pt7bRLE;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BADGE_FONTS_H
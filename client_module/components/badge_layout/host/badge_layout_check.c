@@ -0,0 +1,179 @@
+// Lays out every badge of an attendee list exactly as the badge will and
+// lists the ones that do not fit, so names can be shortened before the event.
+// Characters the badge fonts have no glyph for are listed too.
+//
+// Input is CSV with the columns first_name,last_name,additional_info; a
+// header row with those names is skipped. Quoted fields may contain commas
+// and "" but no line breaks.
+//
+// Exit status: 0 if every badge fits, 1 if some do not, 2 on bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "badge_layout.h"
+#include "utf8.h"
+
+#define LINE_MAX_LEN 4096
+
+static const char *const field_names[NAME_FIELDS] = {"first name", "last name", "additional info"};
+
+static const char *status_str(layout_status_t status)
+{
+    switch (status)
+    {
+    case LAYOUT_TOO_WIDE:
+        return "a character is wider than the screen";
+    case LAYOUT_TOO_LONG:
+        return "too many lines even in the smallest font";
+    case LAYOUT_TOO_TALL:
+        return "the fields do not fit the screen together";
+    default:
+        return "fits";
+    }
+}
+
+// Notes the first character of a field its fonts have no glyph for; it is
+// drawn as its plain letter if there is one. Such a badge still fits.
+static void note_missing(const char *file, unsigned long lineno, int field, const char *text,
+                         const font_chain_t *fonts)
+{
+    for (const char *p = text, *end = text + strlen(text); p < end;)
+    {
+        const char *at = p;
+        uint32_t c = utf8_next(&p, end);
+        if (font_chain_glyph(fonts, c, NULL, NULL))
+        {
+            continue;
+        }
+        char plain = utf8_fallback(c);
+        if (plain && font_chain_glyph(fonts, (unsigned char)plain, NULL, NULL))
+        {
+            printf("%s:%lu: %s: no glyph for \"%.*s\" (U+%04X), drawn as '%c'\n", file, lineno,
+                   field_names[field], (int)(p - at), at, (unsigned)c, plain);
+        }
+        else
+        {
+            printf("%s:%lu: %s: no glyph for \"%.*s\" (U+%04X), left out\n", file, lineno, field_names[field],
+                   (int)(p - at), at, (unsigned)c);
+        }
+        return;
+    }
+}
+
+// Splits one CSV record in place. Returns the number of fields found.
+static int parse_csv(char *line, char *fields[], int max)
+{
+    int count = 0;
+    char *p = line;
+    while (count < max)
+    {
+        char *out = p;
+        fields[count++] = out;
+        if (*p == '"')
+        {
+            p++;
+            while (*p && !(*p == '"' && p[1] != '"'))
+            {
+                if (*p == '"')
+                {
+                    p++; // "" is a quote
+                }
+                *out++ = *p++;
+            }
+            if (*p == '"')
+            {
+                p++;
+            }
+        }
+        while (*p && *p != ',' && *p != '\n' && *p != '\r')
+        {
+            *out++ = *p++;
+        }
+        bool more = *p == ',';
+        *out = '\0';
+        if (!more)
+        {
+            break;
+        }
+        p++;
+    }
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s attendees.csv|-\n", argv[0]);
+        return 2;
+    }
+    FILE *in = strcmp(argv[1], "-") == 0 ? stdin : fopen(argv[1], "r");
+    if (!in)
+    {
+        perror(argv[1]);
+        return 2;
+    }
+
+    static char line[LINE_MAX_LEN];
+    unsigned long lineno = 0, badges = 0, bad = 0;
+    clock_t spent = 0;
+    while (fgets(line, sizeof(line), in))
+    {
+        lineno++;
+        char *fields[NAME_FIELDS] = {"", "", ""};
+        int count = parse_csv(line, fields, NAME_FIELDS);
+        if (count == 1 && fields[0][0] == '\0')
+        {
+            continue; // blank line
+        }
+        if (lineno == 1 && strcmp(fields[0], "first_name") == 0)
+        {
+            continue;
+        }
+        badges++;
+
+        const char *text[NAME_FIELDS];
+        int too_long = -1;
+        for (int f = 0; f < NAME_FIELDS; f++)
+        {
+            size_t len = strlen(fields[f]);
+            if (len > LAYOUT_NAME_MAX && too_long < 0)
+            {
+                too_long = f;
+            }
+            text[f] = fields[f];
+        }
+        if (too_long >= 0)
+        {
+            printf("%s:%lu: %s: longer than %d bytes, the gateway refuses it\n", argv[1], lineno,
+                   field_names[too_long], LAYOUT_NAME_MAX);
+            bad++;
+            continue;
+        }
+
+        clock_t start = clock();
+        const layout_result_t *l = layout_name_screen(text);
+        spent += clock() - start;
+        if (l->status != LAYOUT_OK)
+        {
+            printf("%s:%lu: %s: %s (\"%s\" \"%s\" \"%s\")\n", argv[1], lineno, field_names[l->overflow],
+                   status_str(l->status), text[NAME_FIRST], text[NAME_LAST], text[NAME_INFO]);
+            bad++;
+        }
+        for (int f = 0; f < NAME_FIELDS; f++)
+        {
+            note_missing(argv[1], lineno, f, text[f], l->font[f]);
+        }
+    }
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+
+    double seconds = (double)spent / CLOCKS_PER_SEC;
+    fprintf(stderr, "%lu badge(s), %lu do not fit; %.0f layouts/s\n", badges, bad,
+            seconds > 0 ? badges / seconds : 0.0);
+    return bad ? 1 : 0;
+}
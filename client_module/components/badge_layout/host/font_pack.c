@@ -0,0 +1,905 @@
+// Builds the badge fonts from Adafruit-GFX font headers, plain ones or those
+// 'fontconvert -r' and 'fontconvert -u' write: run-length coded (see
+// GFXfontRLE in gfxfont.h) and, given a UTF-8 text such as the attendee
+// list, cut down to the code points that text uses and the plain letters
+// the badge falls back to for them. ' ' and '-' are always kept, the layout
+// needs them. The component build runs it over BADGE_FONTS; by hand:
+//
+//   font_pack -o badge_fonts -c attendees.csv Fonts/Roboto_Condensed_SemiBold40pt7b.h ...
+//
+// writes badge_fonts.c and badge_fonts.h with one GFXfontRLE per font, named
+// after it plus RLE, with a range table unless it holds one run of
+// characters up to 0xFF. Without -o it reports what coding and subsetting save
+// and how fast names draw from the plain bitmaps, from the runs with the
+// glyph cache flushed before every name, and through a warm cache, each
+// name redrawn as the badge does when the same names come again.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "badge_layout.h"
+#include "font_rle.h"
+#include "utf8.h"
+
+#define NAME_MAX_LEN 128
+#define LINE_MAX_LEN 4096
+
+#define CODE_POINTS 0x110000
+
+// A font as read, whatever its header held; arrays on the heap
+typedef struct
+{
+    char name[NAME_MAX_LEN]; // without RLE
+    uint8_t yAdvance;
+    uint32_t count;
+    uint32_t *code;  // code point of each glyph, ascending
+    GFXglyph *glyph;
+    uint32_t *offset; // of each glyph's bitmap; bitmapOffset wraps past 64K
+    uint8_t *bitmap;  // as in a plain GFXfont: rows not padded
+} plain_font_t;
+
+static bool has_code(const uint8_t *set, uint32_t c)
+{
+    return set[c >> 3] & (1 << (c & 7));
+}
+
+// Glyph of code point c, or -1
+static long font_index(const plain_font_t *font, uint32_t c)
+{
+    long lo = 0, hi = (long)font->count - 1;
+    while (lo <= hi)
+    {
+        long mid = (lo + hi) / 2;
+        if (font->code[mid] == c)
+        {
+            return mid;
+        }
+        if (font->code[mid] < c)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+    return -1;
+}
+
+// ── Reading font headers ───────────────────────────────────────────────────
+
+typedef enum
+{
+    TOK_END,
+    TOK_INT,
+    TOK_WORD,
+    TOK_OPEN,
+    TOK_CLOSE,
+    TOK_OTHER,
+} tok_t;
+
+// Next token of C source, comments skipped. Words are identifiers.
+static tok_t next_token(const char **p, long *value, const char **word, size_t *word_len)
+{
+    const char *s = *p;
+    while (*s)
+    {
+        if (isspace((unsigned char)*s))
+        {
+            s++;
+        }
+        else if (s[0] == '/' && s[1] == '/')
+        {
+            s += strcspn(s, "\n");
+        }
+        else if (s[0] == '/' && s[1] == '*')
+        {
+            const char *end = strstr(s + 2, "*/");
+            s = end ? end + 2 : s + strlen(s);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    tok_t tok;
+    if (!*s)
+    {
+        tok = TOK_END;
+    }
+    else if (isdigit((unsigned char)*s) || (*s == '-' && isdigit((unsigned char)s[1])))
+    {
+        char *end;
+        *value = strtol(s, &end, 0);
+        s = end;
+        tok = TOK_INT;
+    }
+    else if (isalpha((unsigned char)*s) || *s == '_')
+    {
+        *word = s;
+        while (isalnum((unsigned char)*s) || *s == '_')
+        {
+            s++;
+        }
+        *word_len = s - *word;
+        tok = TOK_WORD;
+    }
+    else
+    {
+        tok = *s == '{' ? TOK_OPEN : *s == '}' ? TOK_CLOSE : TOK_OTHER;
+        s++;
+    }
+    *p = s;
+    return tok;
+}
+
+// Moves past the next occurrence of word, outside comments
+static bool find_word(const char **p, const char *expected)
+{
+    long value;
+    const char *word;
+    size_t len;
+    tok_t tok;
+    while ((tok = next_token(p, &value, &word, &len)) != TOK_END)
+    {
+        if (tok == TOK_WORD && len == strlen(expected) && memcmp(word, expected, len) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The integers of the next brace-enclosed initializer. Returns how many, or
+// -1 if there is none or it holds more than max.
+static long read_ints(const char **p, long *out, long max)
+{
+    long value, count = 0;
+    const char *word;
+    size_t len;
+    int depth = 0;
+    tok_t tok;
+    while ((tok = next_token(p, &value, &word, &len)) != TOK_END)
+    {
+        if (tok == TOK_OPEN)
+        {
+            depth++;
+        }
+        else if (tok == TOK_CLOSE && --depth == 0)
+        {
+            return count;
+        }
+        else if (tok == TOK_INT && depth > 0)
+        {
+            if (count == max)
+            {
+                return -1;
+            }
+            out[count++] = value;
+        }
+    }
+    return -1;
+}
+
+static char *read_file(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+    {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *text = malloc(size + 1);
+    if (text && fread(text, 1, size, f) != (size_t)size)
+    {
+        free(text);
+        text = NULL;
+    }
+    if (text)
+    {
+        text[size] = '\0';
+    }
+    fclose(f);
+    return text;
+}
+
+// The code points of a font's glyphs, from its first and last character or
+// its range table
+static bool read_codes(const char *path, const char *text, const char *name, long first, long last,
+                       long range_count, long *ints, long size, plain_font_t *out)
+{
+    char key[NAME_MAX_LEN + 16];
+    long count = range_count ? 0 : last - first + 1;
+    if (range_count)
+    {
+        snprintf(key, sizeof(key), "%sRanges", name);
+        const char *p = text;
+        if (!find_word(&p, key) || read_ints(&p, ints, size) != 3 * range_count)
+        {
+            fprintf(stderr, "%s: %s is missing or does not match %s\n", path, key, name);
+            return false;
+        }
+        for (long r = 0; r < range_count; r++)
+        {
+            const long *range = &ints[r * 3];
+            if (range[2] != count || range[1] < 1 || range[0] < 0 || range[0] + range[1] > CODE_POINTS ||
+                (r && range[0] < ints[r * 3 - 3] + ints[r * 3 - 2]))
+            {
+                fprintf(stderr, "%s: range %ld of %s is out of order\n", path, r, name);
+                return false;
+            }
+            count += range[1];
+        }
+    }
+    if (count < 1 || !(out->code = malloc(count * sizeof(*out->code))))
+    {
+        fprintf(stderr, count < 1 ? "%s: %s has no glyphs\n" : "out of memory\n", path, name);
+        return false;
+    }
+    out->count = count;
+    for (long i = 0, r = 0; i < count; i++)
+    {
+        if (!range_count)
+        {
+            out->code[i] = first + i;
+            continue;
+        }
+        while (i >= ints[r * 3 + 2] + ints[r * 3 + 1])
+        {
+            r++;
+        }
+        out->code[i] = ints[r * 3] + (i - ints[r * 3 + 2]);
+    }
+    return true;
+}
+
+// Replaces the runs of a coded font by plain bitmaps. size is the bytes of
+// runs; ranges are rebuilt from the code points.
+static bool unpack_runs(const char *path, const char *name, long size, plain_font_t *out)
+{
+    // font_rle_decode() finds the end of a glyph's runs at the next one
+    size_t plain = 0;
+    for (uint32_t i = 0; i < out->count; i++)
+    {
+        const GFXglyph *g = &out->glyph[i];
+        long end = i + 1 < out->count ? out->glyph[i + 1].bitmapOffset : size;
+        if (g->bitmapOffset > end || end > size)
+        {
+            fprintf(stderr, "%s: glyph runs of %s out of order\n", path, name);
+            return false;
+        }
+        plain += (g->width * g->height + 7) / 8;
+    }
+
+    GFXrange *ranges = malloc(out->count * sizeof(*ranges));
+    uint8_t *bitmap = calloc(plain ? plain : 1, 1);
+    uint8_t *rows = malloc(32 * 255); // largest glyph, rows padded
+    out->offset = malloc(out->count * sizeof(*out->offset));
+    if (!ranges || !bitmap || !rows || !out->offset)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    uint16_t range_count = 0;
+    for (uint32_t i = 0; i < out->count; i++)
+    {
+        if (!range_count || ranges[range_count - 1].first + ranges[range_count - 1].count != out->code[i])
+        {
+            ranges[range_count++] = (GFXrange){out->code[i], 0, (uint16_t)i};
+        }
+        ranges[range_count - 1].count++;
+    }
+    GFXfontRLE coded = {{out->bitmap, out->glyph, 0, 0, out->yAdvance}, 0, (uint32_t)size, ranges, range_count};
+
+    size_t offset = 0;
+    for (uint32_t i = 0; i < out->count; i++)
+    {
+        GFXglyph *g = &out->glyph[i];
+        uint16_t stride = (g->width + 7) / 8;
+        font_rle_decode(&coded, (uint16_t)i, rows);
+        out->offset[i] = offset;
+        for (size_t k = 0; k < (size_t)g->width * g->height; k++)
+        {
+            size_t x = k % g->width, y = k / g->width;
+            if (rows[y * stride + x / 8] & (0x80 >> (x & 7)))
+            {
+                bitmap[(offset * 8 + k) / 8] |= 0x80 >> (k & 7);
+            }
+        }
+        offset += (g->width * g->height + 7) / 8;
+    }
+    free(rows);
+    free(ranges);
+    free(out->bitmap);
+    out->bitmap = bitmap;
+    return true;
+}
+
+// Parses a header written by fontconvert or font_pack, text of path. ints
+// holds as many numbers as the text has characters. False, with a message,
+// if it is not one.
+static bool parse_font(const char *path, const char *text, long *ints, long size, plain_font_t *out)
+{
+    const char *p = text, *word;
+    size_t len;
+    long value, count;
+    char name[NAME_MAX_LEN], key[NAME_MAX_LEN + 16];
+    bool coded = find_word(&p, "GFXfontRLE");
+    if (!coded)
+    {
+        p = text;
+    }
+    if ((!coded && !find_word(&p, "GFXfont")) || next_token(&p, &value, &word, &len) != TOK_WORD ||
+        len >= NAME_MAX_LEN)
+    {
+        fprintf(stderr, "%s: no GFXfont found\n", path);
+        return false;
+    }
+    memcpy(name, word, len);
+    name[len] = '\0';
+    // first, last, yAdvance, then rawSize, size and rangeCount if coded
+    long font[6];
+    count = read_ints(&p, font, 6);
+    if (coded ? count < 5 : count != 3)
+    {
+        fprintf(stderr, "%s: %s is not a GFXfont initializer\n", path, name);
+        return false;
+    }
+    // Written out with RLE appended, not twice
+    if (coded && len > 3 && strcmp(name + len - 3, "RLE") == 0)
+    {
+        len -= 3;
+    }
+    snprintf(out->name, sizeof(out->name), "%.*s", (int)len, name);
+    out->yAdvance = font[2];
+    if (!read_codes(path, text, name, font[0], font[1], count == 6 ? font[5] : 0, ints, size, out))
+    {
+        return false;
+    }
+
+    snprintf(key, sizeof(key), "%sGlyphs", name);
+    p = text;
+    if (!find_word(&p, key) || (count = read_ints(&p, ints, size)) < 0 || count != 6L * out->count)
+    {
+        fprintf(stderr, "%s: %s is missing or does not match %s\n", path, key, name);
+        return false;
+    }
+    if (!(out->glyph = malloc(out->count * sizeof(GFXglyph))))
+    {
+        fprintf(stderr, "out of memory\n");
+        return false;
+    }
+    for (uint32_t i = 0; i < out->count; i++)
+    {
+        const long *g = &ints[i * 6];
+        out->glyph[i] = (GFXglyph){(uint16_t)g[0], (uint8_t)g[1], (uint8_t)g[2],
+                                   (uint8_t)g[3], (int8_t)g[4], (int8_t)g[5]};
+    }
+
+    snprintf(key, sizeof(key), "%sBitmaps", name);
+    p = text;
+    if (!find_word(&p, key) || (count = read_ints(&p, ints, size)) < 0)
+    {
+        fprintf(stderr, "%s: %s is missing\n", path, key);
+        return false;
+    }
+    if (!(out->bitmap = malloc(count ? count : 1)))
+    {
+        fprintf(stderr, "out of memory\n");
+        return false;
+    }
+    for (long i = 0; i < count; i++)
+    {
+        out->bitmap[i] = (uint8_t)ints[i];
+    }
+    if (coded)
+    {
+        return unpack_runs(path, name, count, out);
+    }
+
+    // Every glyph has to lie within the bitmaps
+    if (!(out->offset = malloc(out->count * sizeof(*out->offset))))
+    {
+        fprintf(stderr, "out of memory\n");
+        return false;
+    }
+    for (uint32_t i = 0; i < out->count; i++)
+    {
+        const GFXglyph *g = &out->glyph[i];
+        out->offset[i] = g->bitmapOffset;
+        if (g->bitmapOffset + (g->width * g->height + 7) / 8 > count)
+        {
+            fprintf(stderr, "%s: glyph 0x%02X runs past the bitmaps\n", path, out->code[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool load_font(const char *path, plain_font_t *out)
+{
+    char *text = read_file(path);
+    if (!text)
+    {
+        perror(path);
+        return false;
+    }
+    long size = (long)strlen(text);
+    long *ints = malloc(size * sizeof(*ints));
+    bool ok = ints && parse_font(path, text, ints, size, out);
+    if (!ints)
+    {
+        fprintf(stderr, "out of memory\n");
+    }
+    free(ints);
+    free(text);
+    return ok;
+}
+
+// ── Coding and subsetting ──────────────────────────────────────────────────
+
+static void add_code(uint8_t *set, uint32_t c)
+{
+    set[c >> 3] |= 1 << (c & 7);
+}
+
+// Marks the code points of a UTF-8 text file and the plain letters the badge
+// draws instead where a font lacks them
+static bool read_chars(const char *path, uint8_t *keep)
+{
+    FILE *in = fopen(path, "r");
+    if (!in)
+    {
+        perror(path);
+        return false;
+    }
+    static char line[LINE_MAX_LEN];
+    while (fgets(line, sizeof(line), in))
+    {
+        for (const char *p = line, *end = line + strlen(line); p < end;)
+        {
+            uint32_t c = utf8_next(&p, end);
+            char plain = utf8_fallback(c);
+            if (c >= ' ' && c != UTF8_INVALID)
+            {
+                add_code(keep, c);
+            }
+            if (plain)
+            {
+                add_code(keep, (unsigned char)plain);
+            }
+        }
+    }
+    fclose(in);
+    add_code(keep, ' ');
+    add_code(keep, '-');
+    return true;
+}
+
+// Characters asked for that none of the fonts has, nor their plain letter:
+// the badge leaves them out
+static void warn_missing(const plain_font_t *fonts, int count, const uint8_t *keep)
+{
+    bool any = false;
+    for (uint32_t c = ' '; c < CODE_POINTS; c++)
+    {
+        if (!has_code(keep, c))
+        {
+            continue;
+        }
+        char plain = utf8_fallback(c);
+        bool found = false;
+        for (int i = 0; i < count && !found; i++)
+        {
+            found = font_index(&fonts[i], c) >= 0 || (plain && font_index(&fonts[i], (unsigned char)plain) >= 0);
+        }
+        if (!found)
+        {
+            fprintf(stderr, "%s U+%04X", any ? "," : "font_pack: no font has", (unsigned)c);
+            any = true;
+        }
+    }
+    if (any)
+    {
+        fprintf(stderr, "\n");
+    }
+}
+
+// The kept glyphs of a font, coded. NULL keep keeps them all.
+static bool pack(const plain_font_t *in, const uint8_t *keep, GFXfontRLE *out)
+{
+    size_t max = 0;
+    for (uint32_t i = 0; i < in->count; i++)
+    {
+        max += FONT_RLE_ENCODED_MAX(in->glyph[i].width, in->glyph[i].height);
+    }
+    uint8_t *runs = malloc(max ? max : 1);
+    GFXglyph *glyphs = malloc(in->count * sizeof(*glyphs));
+    GFXrange *ranges = malloc(in->count * sizeof(*ranges));
+    if (!runs || !glyphs || !ranges)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    uint32_t kept = 0;
+    uint16_t range_count = 0;
+    size_t size = 0, raw = 0;
+    for (uint32_t i = 0; i < in->count; i++)
+    {
+        uint32_t c = in->code[i];
+        if (keep && !has_code(keep, c))
+        {
+            continue;
+        }
+        if (size > UINT16_MAX || kept > UINT16_MAX)
+        {
+            fprintf(stderr, "%s: over 64K of runs or glyphs, offsets would wrap\n", in->name);
+            return false;
+        }
+        if (!range_count || ranges[range_count - 1].first + ranges[range_count - 1].count != c)
+        {
+            ranges[range_count++] = (GFXrange){c, 0, (uint16_t)kept};
+        }
+        ranges[range_count - 1].count++;
+
+        const GFXglyph *g = &in->glyph[i];
+        glyphs[kept] = *g;
+        glyphs[kept++].bitmapOffset = (uint16_t)size;
+        size += font_rle_encode(in->bitmap + in->offset[i], g->width, g->height, runs + size);
+        raw += (g->width * g->height + 7) / 8;
+    }
+    if (!kept)
+    {
+        fprintf(stderr, "%s: none of the characters are in the font\n", in->name);
+        return false;
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->font.bitmap = runs;
+    out->font.glyph = glyphs;
+    out->font.yAdvance = in->yAdvance;
+    out->rawSize = raw;
+    out->size = size;
+    // A single range up to 0xFF is every character from first to last
+    uint32_t last = ranges[range_count - 1].first + ranges[range_count - 1].count - 1;
+    if (range_count == 1 && last <= 0xFF)
+    {
+        out->font.first = ranges[0].first;
+        out->font.last = last;
+        free(ranges);
+    }
+    else
+    {
+        out->range = ranges;
+        out->rangeCount = range_count;
+    }
+    return true;
+}
+
+static void free_packed(GFXfontRLE *font)
+{
+    free(font->font.bitmap);
+    free(font->font.glyph);
+    free((GFXrange *)font->range);
+}
+
+// ── Writing the sources ────────────────────────────────────────────────────
+
+static void write_font(FILE *out, const char *name, const GFXfontRLE *font)
+{
+    fprintf(out, "static const uint8_t %sRLEBitmaps[] = {", name);
+    for (size_t i = 0; i < font->size; i++)
+    {
+        fprintf(out, "%s0x%02X", i % 12 ? ", " : (i ? ",\n    " : "\n    "), font->font.bitmap[i]);
+    }
+    fprintf(out, "%s};\n\n", font->size ? "" : "0x00");
+
+    uint16_t count = font_rle_glyph_count(font);
+    fprintf(out, "static const GFXglyph %sRLEGlyphs[] = {\n", name);
+    for (uint16_t i = 0, r = 0; i < count; i++)
+    {
+        // Character of glyph i
+        while (font->range && i >= font->range[r].glyph + font->range[r].count)
+        {
+            r++;
+        }
+        int c = font->range ? font->range[r].first + (i - font->range[r].glyph) : font->font.first + i;
+        const GFXglyph *g = &font->font.glyph[i];
+        char entry[48];
+        snprintf(entry, sizeof(entry), "{%u, %u, %u, %u, %d, %d}%s", g->bitmapOffset, g->width, g->height,
+                 g->xAdvance, g->xOffset, g->yOffset, i + 1 < count ? "," : "};");
+        fprintf(out, "    %-30s // 0x%02X", entry, c);
+        if (c >= ' ' && c <= '~')
+        {
+            fprintf(out, " '%c'", c);
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "\n");
+
+    if (font->range)
+    {
+        fprintf(out, "static const GFXrange %sRLERanges[] = {\n", name);
+        for (uint16_t r = 0; r < font->rangeCount; r++)
+        {
+            const GFXrange *range = &font->range[r];
+            fprintf(out, "    {0x%02X, %u, %u}%s\n", range->first, range->count, range->glyph,
+                    r + 1 < font->rangeCount ? "," : "};");
+        }
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "const GFXfontRLE %sRLE = {\n", name);
+    fprintf(out, "    {(uint8_t *)%sRLEBitmaps,\n", name);
+    fprintf(out, "     (GFXglyph *)%sRLEGlyphs,\n", name);
+    fprintf(out, "     0x%02X, 0x%02X, %u},\n", font->font.first, font->font.last, font->font.yAdvance);
+    fprintf(out, "    %u, %u,\n", (unsigned)font->rawSize, (unsigned)font->size);
+    if (font->range)
+    {
+        fprintf(out, "    %sRLERanges, %u};\n\n", name, font->rangeCount);
+    }
+    else
+    {
+        fprintf(out, "    NULL, 0};\n\n");
+    }
+}
+
+static FILE *open_output(const char *base, const char *ext)
+{
+    char path[LINE_MAX_LEN];
+    snprintf(path, sizeof(path), "%s%s", base, ext);
+    FILE *f = fopen(path, "w");
+    if (!f)
+    {
+        perror(path);
+    }
+    return f;
+}
+
+// base.h declares the fonts, base.c holds them
+static int write_sources(const char *base, const char *chars, const plain_font_t *fonts, int count,
+                         const uint8_t *keep)
+{
+    const char *file = strrchr(base, '/') ? strrchr(base, '/') + 1 : base;
+    char guard[NAME_MAX_LEN];
+    size_t n = 0;
+    for (; file[n] && n + 3 < sizeof(guard); n++)
+    {
+        guard[n] = isalnum((unsigned char)file[n]) ? toupper((unsigned char)file[n]) : '_';
+    }
+    strcpy(guard + n, "_H");
+
+    FILE *h = open_output(base, ".h");
+    FILE *c = h ? open_output(base, ".c") : NULL;
+    if (!c)
+    {
+        if (h)
+        {
+            fclose(h);
+        }
+        return 1;
+    }
+
+    fprintf(h, "// Generated by font_pack, do not edit\n");
+    fprintf(h, "#ifndef %s\n#define %s\n\n#include <stdint.h>\n#include \"gfxfont.h\"\n\n", guard, guard);
+    fprintf(h, "#ifdef __cplusplus\nextern \"C\"\n{\n#endif\n\n");
+    fprintf(c, "// Generated by font_pack, do not edit\n");
+    if (chars)
+    {
+        fprintf(c, "// Only the characters of %s\n", chars);
+    }
+    fprintf(c, "#include <stddef.h>\n#include \"%s.h\"\n\n", file);
+
+    int status = 0;
+    for (int i = 0; i < count; i++)
+    {
+        GFXfontRLE packed;
+        if (!pack(&fonts[i], keep, &packed))
+        {
+            status = 1;
+            break;
+        }
+        fprintf(h, "    extern const GFXfontRLE %sRLE;\n", fonts[i].name);
+        write_font(c, fonts[i].name, &packed);
+        printf("%s: %u glyphs, %u bytes\n", fonts[i].name, font_rle_glyph_count(&packed),
+               (unsigned)packed.size);
+        free_packed(&packed);
+    }
+
+    fprintf(h, "\n#ifdef __cplusplus\n}\n#endif\n\n#endif // %s\n", guard);
+    fclose(h);
+    fclose(c);
+    return status;
+}
+
+// ── Report ─────────────────────────────────────────────────────────────────
+
+// The panel, drawn into pixel by pixel as the display driver does
+static uint8_t s_frame[LAYOUT_SCREEN_WIDTH * LAYOUT_SCREEN_HEIGHT / 8];
+
+static void set_pixel(int16_t x, int16_t y)
+{
+    if (x >= 0 && x < LAYOUT_SCREEN_WIDTH && y >= 0 && y < LAYOUT_SCREEN_HEIGHT)
+    {
+        s_frame[(y * LAYOUT_SCREEN_WIDTH + x) / 8] |= 0x80 >> (x & 7);
+    }
+}
+
+// What drawChar() does with a plain font
+static void draw_plain(const plain_font_t *font, const char *text, int16_t x, int16_t y)
+{
+    for (; *text; text++)
+    {
+        long index = font_index(font, (unsigned char)*text);
+        if (index < 0)
+        {
+            continue;
+        }
+        const GFXglyph *g = &font->glyph[index];
+        const uint8_t *bitmap = font->bitmap + font->offset[index];
+        uint8_t bits = 0, bit = 0;
+        for (int yy = 0; yy < g->height; yy++)
+        {
+            for (int xx = 0; xx < g->width; xx++)
+            {
+                if (!(bit++ & 7))
+                {
+                    bits = *bitmap++;
+                }
+                if (bits & 0x80)
+                {
+                    set_pixel(x + g->xOffset + xx, y + g->yOffset + yy);
+                }
+                bits <<= 1;
+            }
+        }
+        x += g->xAdvance;
+    }
+}
+
+// What drawBitmap() does with a decoded glyph
+static void blit(void *ctx, int16_t x, int16_t y, const uint8_t *bitmap, uint16_t w, uint16_t h)
+{
+    (void)ctx;
+    uint16_t stride = (w + 7) / 8;
+    for (int yy = 0; yy < h; yy++)
+    {
+        for (int xx = 0; xx < w; xx++)
+        {
+            if (bitmap[yy * stride + xx / 8] & (0x80 >> (xx & 7)))
+            {
+                set_pixel(x + xx, y + yy);
+            }
+        }
+    }
+}
+
+static const char *const sample_names[] = {"Jan Novak", "Marie Dvorakova", "Bartholomew", "Zoe Li",
+                                           "Wolfgang Amadeus"};
+#define SAMPLES (sizeof(sample_names) / sizeof(sample_names[0]))
+#define ROUNDS 2000
+
+// Names drawn per second; cold flushes the glyph cache before each name
+static double bench(const plain_font_t *plain, const GFXfontRLE *coded, bool cold)
+{
+    const font_chain_t chain = {&coded, 1};
+    clock_t start = clock();
+    for (size_t i = 0; i < SAMPLES; i++)
+    {
+        for (int r = 0; r < ROUNDS; r++)
+        {
+            if (!coded)
+            {
+                draw_plain(plain, sample_names[i], 0, 200);
+                continue;
+            }
+            if (cold)
+            {
+                font_rle_flush();
+            }
+            font_rle_draw(&chain, sample_names[i], strlen(sample_names[i]), 0, 200, blit, NULL);
+        }
+    }
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    return seconds > 0 ? ROUNDS * SAMPLES / seconds : 0.0;
+}
+
+static int report(const plain_font_t *fonts, int count, const uint8_t *keep)
+{
+    printf("%-32s %8s %8s %8s %10s %10s %10s\n", "bytes, names/s", "plain", "coded", "subset", "plain",
+           "cold", "cached");
+    for (int i = 0; i < count; i++)
+    {
+        GFXfontRLE coded, subset;
+        if (!pack(&fonts[i], NULL, &coded) || !pack(&fonts[i], keep, &subset))
+        {
+            return 1;
+        }
+        printf("%-32s %8u %8u %8u", fonts[i].name, (unsigned)coded.rawSize, (unsigned)coded.size,
+               (unsigned)subset.size);
+        printf(" %10.0f", bench(&fonts[i], NULL, false));
+        printf(" %10.0f", bench(&fonts[i], &coded, true));
+        font_rle_flush();
+        printf(" %10.0f\n", bench(&fonts[i], &coded, false));
+        font_rle_flush();
+        free_packed(&coded);
+        free_packed(&subset);
+    }
+
+    font_rle_stats_t stats;
+    font_rle_get_stats(&stats);
+    printf("glyph cache: %u hits, %u misses, %u evictions\n", (unsigned)stats.hits, (unsigned)stats.misses,
+           (unsigned)stats.evictions);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *base = NULL, *chars = NULL;
+    int first = 1;
+    for (; first + 1 < argc && argv[first][0] == '-'; first += 2)
+    {
+        if (strcmp(argv[first], "-o") == 0)
+        {
+            base = argv[first + 1];
+        }
+        else if (strcmp(argv[first], "-c") == 0)
+        {
+            chars = argv[first + 1];
+        }
+        else
+        {
+            break;
+        }
+    }
+    int count = argc - first;
+    if (count < 1 || argv[first][0] == '-')
+    {
+        fprintf(stderr, "usage: %s [-o output] [-c text] font.h...\n", argv[0]);
+        return 2;
+    }
+
+    // An empty -c keeps every character
+    static uint8_t keep[CODE_POINTS / 8];
+    bool subset = chars && *chars;
+    if (subset && !read_chars(chars, keep))
+    {
+        return 2;
+    }
+
+    plain_font_t *fonts = calloc(count, sizeof(*fonts));
+    if (!fonts)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        if (!load_font(argv[first + i], &fonts[i]))
+        {
+            return 1;
+        }
+    }
+    if (subset)
+    {
+        warn_missing(fonts, count, keep);
+    }
+
+    int status = base ? write_sources(base, subset ? chars : NULL, fonts, count, subset ? keep : NULL)
+                      : report(fonts, count, subset ? keep : NULL);
+    for (int i = 0; i < count; i++)
+    {
+        free(fonts[i].code);
+        free(fonts[i].offset);
+        free(fonts[i].bitmap);
+        free(fonts[i].glyph);
+    }
+    free(fonts);
+    return status;
+}
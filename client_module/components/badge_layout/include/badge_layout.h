@@ -0,0 +1,117 @@
+#ifndef BADGE_LAYOUT_H
+#define BADGE_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "font_rle.h"
+
+#define LAYOUT_MAX_FIELDS 4
+#define LAYOUT_FIELD_LINES 4 // most lines one field can be wrapped into
+#define LAYOUT_MAX_LINES (LAYOUT_MAX_FIELDS * LAYOUT_FIELD_LINES)
+// Name screens remembered; the least recently used one makes room
+#define LAYOUT_CACHE 4
+// Longest field of a cached name screen, as in one command field
+#define LAYOUT_NAME_MAX 255
+// The 7.5" panel in landscape
+#define LAYOUT_SCREEN_WIDTH 800
+#define LAYOUT_SCREEN_HEIGHT 480
+
+    typedef enum
+    {
+        LAYOUT_TOP,    // stacked down from the top margin, in field order
+        LAYOUT_BOTTOM, // stacked up to the bottom margin, last field lowest
+    } layout_anchor_t;
+
+    typedef struct
+    {
+        const char *text;          // UTF-8; words are split at spaces
+        const font_chain_t *fonts; // candidates, largest first
+        uint8_t font_count;        // at least 1
+        uint8_t max_lines;         // at most LAYOUT_FIELD_LINES
+        uint8_t anchor;            // layout_anchor_t
+    } layout_field_t;
+
+    typedef struct
+    {
+        uint16_t width, height; // panel
+        uint16_t top, bottom;   // margins
+        uint16_t field_gap;     // between two fields
+        uint16_t line_gap;      // between the lines of one field
+    } layout_box_t;
+
+    typedef enum
+    {
+        LAYOUT_OK,
+        LAYOUT_TOO_WIDE,  // a single character is wider than the panel
+        LAYOUT_TOO_LONG,  // more than max_lines even in the smallest font
+        LAYOUT_TOO_TALL,  // the fields do not fit above each other
+    } layout_status_t;
+
+    /**
+     * One line to draw: field text [start, start + len), plus '-' if hyphen.
+     * Lines always break between code points.
+     */
+    typedef struct
+    {
+        uint8_t field;
+        bool hyphen;
+        uint16_t start, len;
+        int16_t x, y; // cursor: left end of the baseline
+    } layout_line_t;
+
+    typedef struct
+    {
+        uint8_t status;   // layout_status_t
+        int8_t overflow;  // field that does not fit, -1 when status is LAYOUT_OK
+        const font_chain_t *font[LAYOUT_MAX_FIELDS]; // one of the field's fonts
+        uint8_t line_count;
+        layout_line_t lines[LAYOUT_MAX_LINES];
+    } layout_result_t;
+
+    /**
+     * @brief Lay out fields on a panel, each in the largest font that lets
+     *        everything fit.
+     *
+     * Every field first takes the largest font it fits the panel width in
+     * within max_lines, wrapping at spaces; a word wider than the panel is
+     * hyphenated only if no font fits it whole. While the fields are too tall
+     * together, the one in the largest font steps down its list. Fonts only
+     * ever step down, so the search is a single pass over each list.
+     *
+     * If nothing fits, @p out still holds a best effort in the smallest fonts
+     * and the status says why.
+     *
+     * @return True if the layout fits.
+     */
+    bool layout_fit(const layout_field_t *fields, size_t count, const layout_box_t *box, layout_result_t *out);
+
+    typedef enum
+    {
+        NAME_FIRST,
+        NAME_LAST,
+        NAME_INFO,
+        NAME_FIELDS,
+    } name_field_t;
+
+    /**
+     * @brief Layout of the badge name screen: first and last name from the
+     *        top, additional info along the bottom.
+     *
+     * Recent layouts are cached by their text, so redrawing the same names
+     * costs one lookup. Only one task may lay out name screens.
+     *
+     * @return The layout, valid until the next call.
+     */
+    const layout_result_t *layout_name_screen(const char *const text[NAME_FIELDS]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BADGE_LAYOUT_H
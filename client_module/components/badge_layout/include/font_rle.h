@@ -0,0 +1,105 @@
+#ifndef FONT_RLE_H
+#define FONT_RLE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "gfxfont.h"
+
+// RAM for decoded glyphs; the least recently drawn ones make room
+#define FONT_RLE_CACHE_BYTES (16 * 1024)
+#define FONT_RLE_CACHE_GLYPHS 48
+// Largest decoded glyph, (width + 7) / 8 * height bytes; bigger ones are not drawn
+#define FONT_RLE_GLYPH_MAX 4096
+// Worst-case size of a glyph's runs: one byte per pixel
+#define FONT_RLE_ENCODED_MAX(w, h) ((size_t)(w) * (h) + 1)
+
+    /** Called with one decoded glyph, rows padded to whole bytes, MSB first. */
+    typedef void (*font_rle_blit_t)(void *ctx, int16_t x, int16_t y, const uint8_t *bitmap, uint16_t w, uint16_t h);
+
+    typedef struct
+    {
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t evictions;
+        uint32_t bytes; // decoded glyphs held now
+    } font_rle_stats_t;
+
+    /**
+     * @brief Run-length code one glyph (see GFXfontRLE in gfxfont.h).
+     *
+     * @param bits  The glyph as in a plain GFXfont: w * h bits, rows not padded.
+     * @param out   At least FONT_RLE_ENCODED_MAX(w, h) bytes.
+     * @return Bytes written.
+     */
+    size_t font_rle_encode(const uint8_t *bits, uint16_t w, uint16_t h, uint8_t *out);
+
+    /**
+     * @brief Decode glyph @p index of @p font into @p out, rows padded to
+     *        whole bytes. @p out holds at least (width + 7) / 8 * height bytes.
+     */
+    void font_rle_decode(const GFXfontRLE *font, uint16_t index, uint8_t *out);
+
+    /** Glyphs in @p font. */
+    uint16_t font_rle_glyph_count(const GFXfontRLE *font);
+
+    /**
+     * @brief Index of the glyph of code point @p c, or -1 if @p font has
+     *        none. Fonts with a range table are binary searched by range.
+     */
+    int32_t font_rle_index(const GFXfontRLE *font, uint32_t c);
+
+    /**
+     * Fonts tried in turn for each code point, e.g. a Latin font, then one
+     * for another script. The first one sets the line height.
+     */
+    typedef struct
+    {
+        const GFXfontRLE *const *fonts;
+        uint8_t count; // at least 1
+    } font_chain_t;
+
+    /**
+     * @brief Glyph of code point @p c from the first font of @p chain that
+     *        has one, or NULL. @p font and @p index, if not NULL, get where
+     *        it was found.
+     */
+    const GFXglyph *font_chain_glyph(const font_chain_t *chain, uint32_t c, const GFXfontRLE **font,
+                                     uint16_t *index);
+
+    /**
+     * @brief Glyph drawn for @p c: font_chain_glyph(), else that of its
+     *        utf8_fallback() letter, else NULL and @p c is left out.
+     */
+    const GFXglyph *font_chain_lookup(const font_chain_t *chain, uint32_t c, const GFXfontRLE **font,
+                                      uint16_t *index);
+
+    /**
+     * @brief Draw @p len bytes of UTF-8 @p text with the cursor at
+     *        (@p x, @p y), as print() would without wrapping, each code
+     *        point as font_chain_lookup() finds it.
+     *
+     * Glyphs are decoded through the glyph cache and handed to @p blit.
+     * Only one task may draw coded fonts.
+     *
+     * @return The cursor x after the text.
+     */
+    int16_t font_rle_draw(const font_chain_t *chain, const char *text, size_t len, int16_t x, int16_t y,
+                          font_rle_blit_t blit, void *ctx);
+
+    /** Glyph cache counters since boot. */
+    void font_rle_get_stats(font_rle_stats_t *stats);
+
+    /** Drop every cached glyph. */
+    void font_rle_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FONT_RLE_H
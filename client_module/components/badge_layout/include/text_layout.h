@@ -0,0 +1,38 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "font_rle.h"
+
+    /** Ink box of a string drawn with its cursor at (0, 0), like getTextBounds(). */
+    typedef struct
+    {
+        int16_t x1, y1; // upper-left corner, relative to the cursor
+        uint16_t w, h;  // 0 when nothing would be drawn
+    } text_bounds_t;
+
+    /**
+     * @brief Measure @p len bytes of UTF-8 @p text in @p chain in a single
+     *        pass, each code point as font_rle_draw() draws it. Characters
+     *        without a glyph take no room.
+     *
+     * Same box as Adafruit_GFX::getTextBounds() at text size 1 with wrapping
+     * off; '\n' starts a new line.
+     */
+    void text_measure_n(const font_chain_t *chain, const char *text, size_t len, text_bounds_t *out);
+
+    /** text_measure_n() of a NUL-terminated string. */
+    void text_measure(const font_chain_t *chain, const char *text, text_bounds_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEXT_LAYOUT_H
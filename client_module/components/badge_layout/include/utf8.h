@@ -0,0 +1,76 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Stands in for a malformed sequence
+#define UTF8_INVALID 0xFFFD
+
+    /**
+     * @brief Decode the code point at *@p p and move past it.
+     *
+     * A malformed, overlong or cut-off sequence, or a surrogate, decodes as
+     * UTF8_INVALID and takes one byte, so decoding never stalls and always
+     * resynchronises at the next lead byte. *@p p must be below @p end.
+     */
+    static inline uint32_t utf8_next(const char **p, const char *end)
+    {
+        const unsigned char *s = (const unsigned char *)*p;
+        uint32_t c = s[0];
+        int len = c < 0x80 ? 1 : (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 0;
+        if (len == 1)
+        {
+            *p += 1;
+            return c;
+        }
+        if (len == 0 || len > end - *p)
+        {
+            *p += 1;
+            return UTF8_INVALID;
+        }
+        c &= 0x3F >> (len - 1);
+        for (int i = 1; i < len; i++)
+        {
+            if ((s[i] & 0xC0) != 0x80)
+            {
+                *p += 1;
+                return UTF8_INVALID;
+            }
+            c = (c << 6) | (s[i] & 0x3F);
+        }
+        uint32_t min = len == 2 ? 0x80 : len == 3 ? 0x800 : 0x10000;
+        if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+        {
+            *p += 1;
+            return UTF8_INVALID;
+        }
+        *p += len;
+        return c;
+    }
+
+    /**
+     * @brief ASCII stand-in for @p c: the plain letter of an accented Latin
+     *        one ("ř" -> 'r'), straight quotes and dashes for typographic
+     *        ones. 0 if there is none.
+     */
+    char utf8_fallback(uint32_t c);
+
+    /**
+     * @brief Copy @p len bytes of UTF-8 into @p dst as a NUL-terminated
+     *        string, cut at a character boundary if it does not fit.
+     *
+     * @return The length written, excluding the NUL.
+     */
+    size_t utf8_copy(const char *src, size_t len, char *dst, size_t dst_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTF8_H
@@ -0,0 +1,104 @@
+#include "badge_layout.h"
+#include <string.h>
+// Generated at build time from BADGE_FONTS in CMakeLists.txt
+#include "badge_fonts.h"
+
+// Each size is a chain: characters the first font lacks come from the next,
+// e.g. one made with 'fontconvert -u', or are drawn as their plain letters
+static const GFXfontRLE *const name_75[] = {&Roboto_Condensed_SemiBold75pt7bRLE};
+static const GFXfontRLE *const name_60[] = {&Roboto_Condensed_SemiBold60pt7bRLE};
+static const GFXfontRLE *const name_40[] = {&Roboto_Condensed_SemiBold40pt7bRLE};
+
+static const font_chain_t name_fonts[] = {
+    {name_75, sizeof(name_75) / sizeof(name_75[0])},
+    {name_60, sizeof(name_60) / sizeof(name_60[0])},
+    {name_40, sizeof(name_40) / sizeof(name_40[0])}};
+static const font_chain_t info_fonts[] = {{name_40, sizeof(name_40) / sizeof(name_40[0])}};
+
+static const layout_box_t name_box = {
+    .width = LAYOUT_SCREEN_WIDTH,
+    .height = LAYOUT_SCREEN_HEIGHT,
+    .top = 40,
+    .bottom = 20,
+    .field_gap = 50,
+    .line_gap = 20,
+};
+
+typedef struct
+{
+    bool used;
+    uint32_t hash;
+    uint32_t last_use;
+    char text[NAME_FIELDS][LAYOUT_NAME_MAX + 1];
+    layout_result_t result;
+} name_entry_t;
+
+static name_entry_t s_cache[LAYOUT_CACHE];
+static uint32_t s_use;
+static layout_result_t s_uncached;
+
+static uint32_t hash_text(const char *const text[NAME_FIELDS])
+{
+    uint32_t h = 2166136261u; // FNV-1a, fields separated by their NUL
+    for (int f = 0; f < NAME_FIELDS; f++)
+    {
+        for (const char *c = text[f];; c++)
+        {
+            h = (h ^ (unsigned char)*c) * 16777619u;
+            if (!*c)
+            {
+                break;
+            }
+        }
+    }
+    return h;
+}
+
+static void layout(const char *const text[NAME_FIELDS], layout_result_t *out)
+{
+    const layout_field_t fields[NAME_FIELDS] = {
+        [NAME_FIRST] = {text[NAME_FIRST], name_fonts, 3, 2, LAYOUT_TOP},
+        [NAME_LAST] = {text[NAME_LAST], name_fonts, 3, 2, LAYOUT_TOP},
+        [NAME_INFO] = {text[NAME_INFO], info_fonts, 1, 2, LAYOUT_BOTTOM},
+    };
+    layout_fit(fields, NAME_FIELDS, &name_box, out);
+}
+
+const layout_result_t *layout_name_screen(const char *const text[NAME_FIELDS])
+{
+    for (int f = 0; f < NAME_FIELDS; f++)
+    {
+        if (strlen(text[f]) > LAYOUT_NAME_MAX)
+        {
+            layout(text, &s_uncached);
+            return &s_uncached;
+        }
+    }
+
+    uint32_t hash = hash_text(text);
+    name_entry_t *victim = &s_cache[0];
+    for (int i = 0; i < LAYOUT_CACHE; i++)
+    {
+        name_entry_t *e = &s_cache[i];
+        if (e->used && e->hash == hash && strcmp(e->text[NAME_FIRST], text[NAME_FIRST]) == 0 &&
+            strcmp(e->text[NAME_LAST], text[NAME_LAST]) == 0 && strcmp(e->text[NAME_INFO], text[NAME_INFO]) == 0)
+        {
+            e->last_use = ++s_use;
+            return &e->result;
+        }
+        if (!e->used || (victim->used && e->last_use < victim->last_use))
+        {
+            victim = e;
+        }
+    }
+
+    victim->used = true;
+    victim->hash = hash;
+    victim->last_use = ++s_use;
+    for (int f = 0; f < NAME_FIELDS; f++)
+    {
+        strcpy(victim->text[f], text[f]);
+    }
+    layout(text, &victim->result);
+    return &victim->result;
+}
@@ -0,0 +1,52 @@
+#include "text_layout.h"
+#include <string.h>
+#include "utf8.h"
+
+void text_measure_n(const font_chain_t *chain, const char *text, size_t len, text_bounds_t *out)
+{
+    int16_t x = 0, y = 0;
+    // Maxima start at -1 like getTextBounds(): text above the baseline
+    // still gets a box reaching down to it, and centers the same way
+    int16_t minx = INT16_MAX, miny = INT16_MAX, maxx = -1, maxy = -1;
+    for (const char *p = text, *end = text + len; p < end;)
+    {
+        uint32_t c = utf8_next(&p, end);
+        if (c == '\n')
+        {
+            x = 0;
+            y += chain->fonts[0]->font.yAdvance;
+            continue;
+        }
+        const GFXglyph *g = font_chain_lookup(chain, c, NULL, NULL);
+        if (!g)
+        {
+            continue; // not in the font, drawn as nothing
+        }
+        if (g->width && g->height)
+        {
+            int16_t x1 = x + g->xOffset, y1 = y + g->yOffset;
+            minx = x1 < minx ? x1 : minx;
+            miny = y1 < miny ? y1 : miny;
+            maxx = x1 + g->width - 1 > maxx ? x1 + g->width - 1 : maxx;
+            maxy = y1 + g->height - 1 > maxy ? y1 + g->height - 1 : maxy;
+        }
+        x += g->xAdvance;
+    }
+
+    memset(out, 0, sizeof(*out));
+    if (maxx >= minx)
+    {
+        out->x1 = minx;
+        out->w = maxx - minx + 1;
+    }
+    if (maxy >= miny)
+    {
+        out->y1 = miny;
+        out->h = maxy - miny + 1;
+    }
+}
+
+void text_measure(const font_chain_t *chain, const char *text, text_bounds_t *out)
+{
+    text_measure_n(chain, text, strlen(text), out);
+}
@@ -0,0 +1,71 @@
+#include "utf8.h"
+#include <string.h>
+
+// Plain letters of U+00C0 to U+00FF and U+0100 to U+017F, '_' for none
+static const char latin1[] = "AAAAAAACEEEEIIIIDNOOOOOxOUUUUY_s"
+                             "aaaaaaaceeeeiiiidnooooo_ouuuuy_y";
+static const char latin_ext_a[] = "AaAaAaCcCcCcCcDd"
+                                  "DdEeEeEeEeEeGgGg"
+                                  "GgGgHhHhIiIiIiIi"
+                                  "IiIiJjKkkLlLlLlL"
+                                  "lLlNnNnNnnNnOoOo"
+                                  "OoOoRrRrRrSsSsSs"
+                                  "SsTtTtTtUuUuUuUu"
+                                  "UuUuWwYyYZzZzZzs";
+
+char utf8_fallback(uint32_t c)
+{
+    char plain = 0;
+    if (c >= 0xC0 && c <= 0xFF)
+    {
+        plain = latin1[c - 0xC0];
+    }
+    else if (c >= 0x100 && c <= 0x17F)
+    {
+        plain = latin_ext_a[c - 0x100];
+    }
+    else
+    {
+        switch (c)
+        {
+        case 0x00A0: // no-break space
+            return ' ';
+        case 0x2010: // hyphen
+        case 0x2011: // non-breaking hyphen
+        case 0x2013: // en dash
+        case 0x2014: // em dash
+            return '-';
+        case 0x2018:
+        case 0x2019:
+            return '\'';
+        case 0x201C:
+        case 0x201D:
+            return '"';
+        default:
+            return 0;
+        }
+    }
+    return plain == '_' ? 0 : plain;
+}
+
+size_t utf8_copy(const char *src, size_t len, char *dst, size_t dst_size)
+{
+    if (dst_size == 0)
+    {
+        return 0;
+    }
+    size_t n = len < dst_size - 1 ? len : dst_size - 1;
+    // Back off to the lead byte of a sequence that would be cut
+    if (n < len)
+    {
+        size_t lead = n;
+        while (lead > 0 && ((unsigned char)src[lead] & 0xC0) == 0x80)
+        {
+            lead--;
+        }
+        n = lead;
+    }
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+    return n;
+}
@@ -0,0 +1,237 @@
+// Draws the same bitmaps into two Gdew075T7 framebuffers, once through the
+// driver's blitBitmap() fast path and once through the generic Adafruit_GFX
+// loop that calls drawPixel() for every pixel, in all four rotations. The
+// workloads are random blits clipped at the screen edges, opaque and
+// transparent; name glyphs, as font_rle_draw() hands them to drawBitmap();
+// and a full-screen logo streamed through writeBitmapBytes() in transfer
+// chunks. Reports the pixels per second of each path on this machine and
+// checks that both frames reach the panel identical.
+//
+// Usage: blit_bench [-n blits] [-s seed]
+//
+// Exit status: 0 if both paths drew the same frames, 1 if they did not, 2 on
+// bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <gdew075T7.h>
+#include "panel.h"
+
+#define MIN_BENCH_NS 100000000LL // each measurement repeats for at least this long
+#define POOL_SIZE (64 * 1024)    // random bitmap bytes the blits draw from
+#define XFER_CHUNK 234           // logo bytes per transfer chunk (XFER_CHUNK_MAX)
+
+// The generic path: blitBitmap() declines, so drawBitmap() takes one
+// writePixel() per pixel, as it does on every other driver
+class PerPixel : public Gdew075T7
+{
+  public:
+    PerPixel(EpdSpi &io) : Adafruit_GFX(GDEW075T7_WIDTH, GDEW075T7_HEIGHT), Gdew075T7(io) {}
+    bool blitBitmap(int16_t, int16_t, const uint8_t *, int16_t, int16_t, uint16_t, uint16_t, bool) override
+    {
+        return false;
+    }
+    void writeBitmapBytes(uint32_t offset, const uint8_t *data, uint32_t len, uint16_t color, uint16_t bg) override
+    {
+        Epd::writeBitmapBytes(offset, data, len, color, bg);
+    }
+};
+
+typedef struct
+{
+    int16_t x, y, w, h;
+    uint32_t offset; // into the pool
+    bool opaque;
+    uint16_t color;
+} blit_t;
+
+typedef enum
+{
+    WL_CLIPPED,
+    WL_GLYPHS,
+    WL_STREAM,
+    WL_COUNT
+} workload_t;
+
+static const char *const wl_names[WL_COUNT] = {"clipped", "glyphs", "stream"};
+
+static EpdSpi s_io;
+static Gdew075T7 *s_fast;
+static PerPixel *s_slow;
+static uint8_t s_pool[POOL_SIZE];
+static blit_t *s_blits;
+static int s_count = 2000;
+static uint32_t s_rng = 1;
+
+static uint32_t next_rand(void)
+{
+    s_rng = s_rng * 1103515245 + 12345;
+    return s_rng >> 8;
+}
+
+static int16_t rand_range(int lo, int hi)
+{
+    return (int16_t)(lo + (int)(next_rand() % (uint32_t)(hi - lo + 1)));
+}
+
+static void create(void *ctx)
+{
+    (void)ctx;
+    s_fast = new Gdew075T7(s_io);
+    s_slow = new PerPixel(s_io);
+    s_fast->init(false);
+    s_slow->init(false);
+}
+
+// Blits of the workload for a screen of the current rotation
+static void make_blits(workload_t wl, int16_t width, int16_t height)
+{
+    for (int i = 0; i < s_count; i++)
+    {
+        blit_t *b = &s_blits[i];
+        if (wl == WL_CLIPPED)
+        {
+            b->w = rand_range(1, 300);
+            b->h = rand_range(1, 200);
+            b->x = rand_range(-b->w / 2, width - 1);
+            b->y = rand_range(-b->h / 2, height - 1);
+            b->opaque = next_rand() & 1;
+            b->color = (next_rand() & 1) ? EPD_BLACK : EPD_WHITE;
+        }
+        else
+        {
+            // Roboto 40-75 pt glyphs, black on the white name screen
+            b->w = rand_range(30, 110);
+            b->h = rand_range(60, 110);
+            b->x = rand_range(0, width - b->w);
+            b->y = rand_range(0, height - b->h);
+            b->opaque = false;
+            b->color = EPD_BLACK;
+        }
+        uint32_t bytes = (uint32_t)(b->w + 7) / 8 * b->h;
+        b->offset = next_rand() % (POOL_SIZE - bytes);
+    }
+}
+
+static uint64_t clipped_pixels(const blit_t *b, int16_t width, int16_t height)
+{
+    int x0 = b->x < 0 ? 0 : b->x, y0 = b->y < 0 ? 0 : b->y;
+    int x1 = b->x + b->w > width ? width : b->x + b->w;
+    int y1 = b->y + b->h > height ? height : b->y + b->h;
+    return (x1 > x0 && y1 > y0) ? (uint64_t)(x1 - x0) * (y1 - y0) : 0;
+}
+
+// Draws the workload once; returns the pixels drawn
+static uint64_t draw(Epd &d, workload_t wl)
+{
+    uint64_t pixels = 0;
+    if (wl == WL_STREAM)
+    {
+        uint32_t len = (uint32_t)(d.width() + 7) / 8 * d.height();
+        for (uint32_t off = 0; off < len; off += XFER_CHUNK)
+        {
+            uint32_t n = len - off < XFER_CHUNK ? len - off : XFER_CHUNK;
+            d.writeBitmapBytes(off, s_pool + off % (POOL_SIZE - XFER_CHUNK), n, EPD_BLACK, EPD_WHITE);
+        }
+        return (uint64_t)d.width() * d.height();
+    }
+    for (int i = 0; i < s_count; i++)
+    {
+        const blit_t *b = &s_blits[i];
+        if (b->opaque)
+        {
+            d.drawBitmap(b->x, b->y, s_pool + b->offset, b->w, b->h, b->color, b->color ^ EPD_WHITE);
+        }
+        else
+        {
+            d.drawBitmap(b->x, b->y, s_pool + b->offset, b->w, b->h, b->color);
+        }
+        pixels += clipped_pixels(b, d.width(), d.height());
+    }
+    return pixels;
+}
+
+// Pixels per second of drawing the workload over and over
+static double rate(Epd &d, workload_t wl)
+{
+    uint64_t pixels = 0;
+    long long t0 = panel_now_ns(), t;
+    do
+    {
+        pixels += draw(d, wl);
+    } while ((t = panel_now_ns() - t0) < MIN_BENCH_NS);
+    return pixels * 1e9 / t;
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            s_count = atoi(optarg);
+            break;
+        case 's':
+            s_rng = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        default:
+            s_count = 0;
+            break;
+        }
+    }
+    if (s_count <= 0 || optind != argc)
+    {
+        fprintf(stderr, "usage: %s [-n blits] [-s seed]\n", argv[0]);
+        return 2;
+    }
+    s_blits = (blit_t *)calloc((size_t)s_count, sizeof(*s_blits));
+    uint8_t *fast_frame = (uint8_t *)malloc(SPI_MOCK_RAM_SIZE);
+    uint8_t *slow_frame = (uint8_t *)malloc(SPI_MOCK_RAM_SIZE);
+    if (!s_blits || !fast_frame || !slow_frame)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 2;
+    }
+    for (size_t i = 0; i < sizeof(s_pool); i++)
+    {
+        s_pool[i] = (uint8_t)(next_rand() >> 8);
+    }
+    panel_quiet(create, NULL);
+
+    printf("rotation  workload   per-pixel Mpx/s  blit Mpx/s  speedup  frames\n");
+    int differ = 0;
+    for (uint8_t r = 0; r < 4; r++)
+    {
+        s_fast->setRotation(r);
+        s_slow->setRotation(r);
+        for (int wl = 0; wl < WL_COUNT; wl++)
+        {
+            if (wl != WL_STREAM)
+            {
+                make_blits((workload_t)wl, s_fast->width(), s_fast->height());
+            }
+            s_fast->fillScreen(EPD_WHITE);
+            s_slow->fillScreen(EPD_WHITE);
+            draw(*s_fast, (workload_t)wl);
+            draw(*s_slow, (workload_t)wl);
+            panel_capture(*s_fast, fast_frame);
+            panel_capture(*s_slow, slow_frame);
+            bool same = memcmp(fast_frame, slow_frame, SPI_MOCK_RAM_SIZE) == 0;
+            differ += !same;
+
+            double slow = rate(*s_slow, (workload_t)wl);
+            double fast = rate(*s_fast, (workload_t)wl);
+            printf("%5d°    %-8s  %15.1f  %10.1f  %6.1fx  %s\n", r * 90, wl_names[wl], slow / 1e6, fast / 1e6,
+                   fast / slow, same ? "same" : "DIFFER");
+        }
+    }
+
+    free(s_blits);
+    free(fast_frame);
+    free(slow_frame);
+    return differ ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+// Prints attendee names into two Gdew075T7 framebuffers with the bundled
+// Roboto GFXfonts, once through drawChar()'s span path, where each run of
+// set bits in a glyph row is one writeFastHLine() (writeFillRect() when
+// scaled) filled byte-wise by the driver, and once with those calls drawing
+// pixel by pixel, as drawChar() did before. Names land at random positions,
+// some clipped at the screen edges, in all four rotations. Reports the
+// glyphs per second of each path on this machine and checks that both
+// frames reach the panel identical.
+//
+// Usage: glyph_bench [-n names] [-s seed]
+//
+// Exit status: 0 if both paths drew the same frames, 1 if they did not, 2 on
+// bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <gdew075T7.h>
+#include <Fonts/Roboto_Condensed_SemiBold40pt7b.h>
+#include <Fonts/Roboto_Condensed_SemiBold60pt7b.h>
+#include <Fonts/Roboto_Condensed_SemiBold75pt7b.h>
+#include "panel.h"
+
+#define MIN_BENCH_NS 100000000LL // each measurement repeats for at least this long
+
+// Spans drawn one writePixel() at a time
+class PerPixel : public Gdew075T7
+{
+  public:
+    PerPixel(EpdSpi &io) : Adafruit_GFX(GDEW075T7_WIDTH, GDEW075T7_HEIGHT), Gdew075T7(io) {}
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+    {
+        for (int16_t i = 0; i < w; i++)
+        {
+            writePixel(x + i, y, color);
+        }
+    }
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+    {
+        for (int16_t j = 0; j < h; j++)
+        {
+            writeFastHLine(x, y + j, w, color);
+        }
+    }
+};
+
+typedef struct
+{
+    const char *name;
+    const GFXfont *font;
+    uint8_t size;
+} face_t;
+
+typedef struct
+{
+    const char *text;
+    int16_t x, y;
+} label_t;
+
+static const face_t faces[] = {
+    {"40pt", &Roboto_Condensed_SemiBold40pt7b, 1},
+    {"60pt", &Roboto_Condensed_SemiBold60pt7b, 1},
+    {"75pt", &Roboto_Condensed_SemiBold75pt7b, 1},
+    {"40pt x2", &Roboto_Condensed_SemiBold40pt7b, 2},
+};
+
+static const char *const names[] = {
+    "Ada", "Lovelace", "Grace", "Hopper", "Alan", "Turing", "Katherine", "Johnson",
+    "Edsger", "Dijkstra", "Barbara", "Liskov", "Donald", "Knuth", "Margaret", "Hamilton",
+    "Ken", "Thompson", "Frances", "Allen", "Radia", "Perlman", "Niklaus", "Wirth",
+};
+
+static EpdSpi s_io;
+static Gdew075T7 *s_fast;
+static PerPixel *s_slow;
+static label_t *s_labels;
+static int s_count = 200;
+static uint32_t s_rng = 1;
+
+static uint32_t next_rand(void)
+{
+    s_rng = s_rng * 1103515245 + 12345;
+    return s_rng >> 8;
+}
+
+static void create(void *ctx)
+{
+    (void)ctx;
+    s_fast = new Gdew075T7(s_io);
+    s_slow = new PerPixel(s_io);
+    s_fast->init(false);
+    s_slow->init(false);
+}
+
+// The cursor is on the baseline: from above the top edge to below the
+// bottom one, so some names are cut off
+static void make_labels(int16_t width, int16_t height)
+{
+    for (int i = 0; i < s_count; i++)
+    {
+        label_t *l = &s_labels[i];
+        l->text = names[next_rand() % (sizeof(names) / sizeof(names[0]))];
+        l->x = (int16_t)(next_rand() % (width + 100)) - 100;
+        l->y = (int16_t)(next_rand() % (height + 100));
+    }
+}
+
+// Prints every label once; returns the glyphs drawn
+static uint64_t draw(Epd &d, const face_t *face)
+{
+    uint64_t glyphs = 0;
+    d.setFont(face->font);
+    d.setTextSize(face->size);
+    d.setTextColor(EPD_BLACK);
+    d.setTextWrap(false);
+    for (int i = 0; i < s_count; i++)
+    {
+        d.setCursor(s_labels[i].x, s_labels[i].y);
+        d.print(std::string(s_labels[i].text));
+        glyphs += strlen(s_labels[i].text);
+    }
+    return glyphs;
+}
+
+// Glyphs per second of printing the labels over and over
+static double rate(Epd &d, const face_t *face)
+{
+    uint64_t glyphs = 0;
+    long long t0 = panel_now_ns(), t;
+    do
+    {
+        glyphs += draw(d, face);
+    } while ((t = panel_now_ns() - t0) < MIN_BENCH_NS);
+    return glyphs * 1e9 / t;
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            s_count = atoi(optarg);
+            break;
+        case 's':
+            s_rng = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        default:
+            s_count = 0;
+            break;
+        }
+    }
+    if (s_count <= 0 || optind != argc)
+    {
+        fprintf(stderr, "usage: %s [-n names] [-s seed]\n", argv[0]);
+        return 2;
+    }
+    s_labels = (label_t *)calloc((size_t)s_count, sizeof(*s_labels));
+    uint8_t *fast_frame = (uint8_t *)malloc(SPI_MOCK_RAM_SIZE);
+    uint8_t *slow_frame = (uint8_t *)malloc(SPI_MOCK_RAM_SIZE);
+    if (!s_labels || !fast_frame || !slow_frame)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 2;
+    }
+    panel_quiet(create, NULL);
+
+    printf("rotation  font     per-pixel glyphs/s  span glyphs/s  speedup  frames\n");
+    int differ = 0;
+    for (uint8_t r = 0; r < 4; r++)
+    {
+        s_fast->setRotation(r);
+        s_slow->setRotation(r);
+        for (size_t f = 0; f < sizeof(faces) / sizeof(faces[0]); f++)
+        {
+            make_labels(s_fast->width(), s_fast->height());
+            s_fast->fillScreen(EPD_WHITE);
+            s_slow->fillScreen(EPD_WHITE);
+            draw(*s_fast, &faces[f]);
+            draw(*s_slow, &faces[f]);
+            panel_capture(*s_fast, fast_frame);
+            panel_capture(*s_slow, slow_frame);
+            bool same = memcmp(fast_frame, slow_frame, SPI_MOCK_RAM_SIZE) == 0;
+            differ += !same;
+
+            double slow = rate(*s_slow, &faces[f]);
+            double fast = rate(*s_fast, &faces[f]);
+            printf("%5d°    %-7s  %18.0f  %13.0f  %6.1fx  %s\n", r * 90, faces[f].name, slow, fast, fast / slow,
+                   same ? "same" : "DIFFER");
+        }
+    }
+
+    free(s_labels);
+    free(fast_frame);
+    free(slow_frame);
+    return differ ? 1 : 0;
+}
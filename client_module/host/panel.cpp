@@ -0,0 +1,50 @@
+#include "panel.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+void panel_quiet(void (*fn)(void *ctx), void *ctx)
+{
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int null = open("/dev/null", O_WRONLY);
+    if (saved < 0 || null < 0)
+    {
+        fn(ctx);
+    }
+    else
+    {
+        dup2(null, STDOUT_FILENO);
+        fn(ctx);
+        fflush(stdout);
+        dup2(saved, STDOUT_FILENO);
+    }
+    if (null >= 0)
+    {
+        close(null);
+    }
+    if (saved >= 0)
+    {
+        close(saved);
+    }
+}
+
+static void update(void *ctx)
+{
+    ((Epd *)ctx)->update();
+}
+
+void panel_capture(Epd &display, uint8_t *frame)
+{
+    panel_quiet(update, &display);
+    memcpy(frame, spi_mock_ram(false), SPI_MOCK_RAM_SIZE);
+}
+
+long long panel_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
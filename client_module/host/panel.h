@@ -0,0 +1,20 @@
+#ifndef PANEL_H
+#define PANEL_H
+
+#include <stdint.h>
+#include <epd.h>
+#include "spi_mock.h"
+
+// Helpers of the display benchmarks
+
+// Calls fn(ctx) with stdout dropped: the drivers print on every refresh
+void panel_quiet(void (*fn)(void *ctx), void *ctx);
+
+// Refreshes display and copies the frame that reached the controller into
+// frame, SPI_MOCK_RAM_SIZE bytes in the controller's layout
+void panel_capture(Epd &display, uint8_t *frame);
+
+// Real host time, for timing the drawing code itself
+long long panel_now_ns(void);
+
+#endif // PANEL_H
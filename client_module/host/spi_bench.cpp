@@ -0,0 +1,233 @@
+// Sends EPD data phases through EpdSpi to the fake GD7965 of spi_mock.h and
+// reports, for each way of sending them, the SPI transactions it took, the
+// time the bytes spent on the bus, the elapsed time, how long the CPU was
+// busy in the SPI driver and how long the sending task slept waiting for
+// DMA, and the share of the bus time during which the CPU was not busy in
+// the driver (overlap), free to prepare the next chunk or run other tasks:
+// - a full frame as the 480 polled 100-byte lines update() used to send,
+//   each first copied into a line buffer
+// - the same frame with dataQueued(), as update() sends it now
+// - a partial window gathered row by row with dataPipelined(), and through
+//   its polled fallback for when no DMA memory is free
+// - Gdew075T7::update() and updateChanged() end to end, commands included
+// Copying costs the CPU COPY_NS_PER_BYTE of host clock time. Every phase
+// has to leave exactly the bytes it sent in the controller RAM.
+//
+// Usage: spi_bench
+//
+// Exit status: 0 if the controller received every frame intact, 1 if it
+// did not, 2 on bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gdew075T7.h>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "panel.h"
+
+#define COPY_NS_PER_BYTE 5 // memcpy in internal RAM at 240 MHz, roughly
+#define LINE_BYTES (SPI_MOCK_WIDTH / 8)
+// Partial window of the raw phases: 400x240 pixels at (80, 100)
+#define WIN_XB0 10
+#define WIN_XB1 59
+#define WIN_Y0 100
+#define WIN_Y1 339
+
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+    bool (*intact)(void);
+} phase_t;
+
+static EpdSpi s_io;
+static Gdew075T7 *s_display;
+static uint8_t s_frame[SPI_MOCK_RAM_SIZE] __attribute__((aligned(4)));
+static uint8_t s_changed[SPI_MOCK_RAM_SIZE];
+
+static void copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+    memcpy(dst, src, len);
+    host_time_advance_ns((uint64_t)len * COPY_NS_PER_BYTE);
+}
+
+static void frame_polled(void)
+{
+    uint8_t line[LINE_BYTES];
+    for (uint32_t y = 0; y < SPI_MOCK_HEIGHT; y++)
+    {
+        copy_bytes(line, s_frame + y * LINE_BYTES, LINE_BYTES);
+        s_io.data(line, LINE_BYTES);
+    }
+}
+
+static void frame_queued(void)
+{
+    s_io.dataQueued(s_frame, sizeof(s_frame));
+}
+
+static bool frame_intact(void)
+{
+    return memcmp(spi_mock_ram(false), s_frame, sizeof(s_frame)) == 0;
+}
+
+// The window's rows, as Gdew075T7 gathers them
+static void fill_window(void *ctx, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    (void)ctx;
+    const uint32_t row_bytes = WIN_XB1 - WIN_XB0 + 1;
+    while (len > 0)
+    {
+        uint32_t row = offset / row_bytes, col = offset % row_bytes;
+        uint32_t n = row_bytes - col < len ? row_bytes - col : len;
+        copy_bytes(buf, s_frame + (WIN_Y0 + row) * LINE_BYTES + WIN_XB0 + col, n);
+        buf += n;
+        offset += n;
+        len -= n;
+    }
+}
+
+static void window(void)
+{
+    s_io.dataPipelined((WIN_XB1 - WIN_XB0 + 1) * (WIN_Y1 - WIN_Y0 + 1), fill_window, NULL);
+}
+
+static void window_no_dma(void)
+{
+    host_heap_caps_no_dma = true;
+    window();
+    host_heap_caps_no_dma = false;
+}
+
+static bool window_intact(void)
+{
+    const uint8_t *ram = spi_mock_ram(false);
+    for (uint32_t y = WIN_Y0; y <= WIN_Y1; y++)
+    {
+        uint32_t idx = y * LINE_BYTES + WIN_XB0;
+        if (memcmp(ram + idx, s_frame + idx, WIN_XB1 - WIN_XB0 + 1) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void quiet_update(void *ctx)
+{
+    (void)ctx;
+    s_display->update();
+}
+
+static void quiet_update_changed(void *ctx)
+{
+    (void)ctx;
+    s_display->updateChanged();
+}
+
+static void update(void)
+{
+    panel_quiet(quiet_update, NULL);
+}
+
+static void update_changed(void)
+{
+    panel_quiet(quiet_update_changed, NULL);
+}
+
+static bool changed_intact(void)
+{
+    return memcmp(spi_mock_ram(false), s_changed, sizeof(s_changed)) == 0;
+}
+
+static const phase_t phases[] = {
+    {"frame, polled lines", frame_polled, frame_intact},
+    {"frame, dataQueued", frame_queued, frame_intact},
+    {"window, polled", window_no_dma, window_intact},
+    {"window, dataPipelined", window, window_intact},
+    {"update()", update, frame_intact},
+    {"updateChanged()", update_changed, changed_intact},
+};
+
+static void create(void *ctx)
+{
+    (void)ctx;
+    s_display = new Gdew075T7(s_io);
+    s_display->init(false);
+}
+
+// Before each phase: the raw ones start a data phase into the full frame
+// or the window, the driver ones get their frame drawn
+static void prepare(size_t phase)
+{
+    if (phases[phase].run == update)
+    {
+        s_display->writeBitmapBytes(0, s_frame, sizeof(s_frame), EPD_WHITE, EPD_BLACK);
+        return;
+    }
+    if (phases[phase].run == update_changed)
+    {
+        s_display->writeBitmapBytes(0, s_changed, sizeof(s_changed), EPD_WHITE, EPD_BLACK);
+        return;
+    }
+    if (phases[phase].intact == window_intact)
+    {
+        const uint16_t xs = WIN_XB0 * 8, xe = WIN_XB1 * 8 + 7;
+        const uint8_t area[9] = {(uint8_t)(xs >> 8), (uint8_t)xs, (uint8_t)(xe >> 8), (uint8_t)xe,
+                                 WIN_Y0 >> 8, WIN_Y0 & 0xff, WIN_Y1 >> 8, WIN_Y1 & 0xff, 0};
+        s_io.cmd(0x91);
+        s_io.cmd(0x90);
+        for (uint8_t b : area)
+        {
+            s_io.data(b);
+        }
+    }
+    else
+    {
+        s_io.cmd(0x92);
+    }
+    s_io.cmd(0x13);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s\n", argv[0]);
+        return 2;
+    }
+    uint32_t x = 0x12345678;
+    for (size_t i = 0; i < sizeof(s_frame); i++)
+    {
+        x = x * 1103515245 + 12345;
+        s_frame[i] = (uint8_t)(x >> 16);
+    }
+    // A name changed: a band of 320x120 pixels
+    memcpy(s_changed, s_frame, sizeof(s_changed));
+    for (uint32_t y = 180; y < 300; y++)
+    {
+        memset(s_changed + y * LINE_BYTES + 20, 0xff, 40);
+    }
+    panel_quiet(create, NULL);
+
+    printf("%d bytes per frame, SPI at 4 MHz\n", SPI_MOCK_RAM_SIZE);
+    printf("phase                   polled  queued  bus ms  elapsed ms  busy ms  asleep ms  overlap  RAM\n");
+    int broken = 0;
+    for (size_t p = 0; p < sizeof(phases) / sizeof(phases[0]); p++)
+    {
+        prepare(p);
+        spi_mock_reset_stats();
+        uint64_t t0 = host_time_ns();
+        phases[p].run();
+        uint64_t elapsed = host_time_ns() - t0;
+        spi_mock_stats_t st;
+        spi_mock_get_stats(&st);
+        bool intact = phases[p].intact();
+        broken += !intact;
+        printf("%-22s  %6u  %6u  %6.1f  %10.1f  %7.1f  %9.1f  %6.1f%%  %s\n", phases[p].name,
+               (unsigned)st.polled, (unsigned)st.queued, st.bus_ns / 1e6, elapsed / 1e6, st.driver_ns / 1e6,
+               st.wait_ns / 1e6, st.bus_ns ? st.overlap_ns * 100.0 / st.bus_ns : 0.0, intact ? "ok" : "WRONG");
+    }
+    return broken ? 1 : 0;
+}
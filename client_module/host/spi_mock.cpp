@@ -0,0 +1,239 @@
+// Fake GD7965 behind the host SPI master, see spi_mock.h.
+
+#include <assert.h>
+#include <string.h>
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "spi_mock.h"
+
+#define LINE_BYTES (SPI_MOCK_WIDTH / 8)
+#define QUEUE_MAX 8
+
+typedef struct
+{
+    spi_transaction_t *trans;
+    uint64_t start_ns, end_ns; // on the bus
+} queued_t;
+
+struct spi_device_t
+{
+    int clock_hz;
+    int queue_size;
+    queued_t queue[QUEUE_MAX];
+    int head;
+    int count;
+};
+
+static spi_device_t s_dev;
+static int s_max_transfer;
+static spi_mock_stats_t s_stats;
+static uint64_t s_bus_free_ns; // end of the last transaction on the bus
+static uint64_t s_bus_busy_ns; // bus time while the CPU was busy in the driver
+
+// Controller state
+static uint8_t s_ram[2][SPI_MOCK_RAM_SIZE];
+static uint8_t s_cmd;
+static uint32_t s_pos;      // data bytes since the command
+static uint8_t s_window[9]; // data of the last 0x90
+static bool s_partial;
+
+const uint8_t *spi_mock_ram(bool old)
+{
+    return s_ram[old ? 0 : 1];
+}
+
+void spi_mock_get_stats(spi_mock_stats_t *stats)
+{
+    *stats = s_stats;
+    stats->overlap_ns = s_stats.bus_ns - s_bus_busy_ns;
+}
+
+void spi_mock_reset_stats(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_bus_busy_ns = 0;
+}
+
+static void reset_controller(gpio_num_t pin, int level)
+{
+    if (pin == CONFIG_EINK_RST && level == 0)
+    {
+        s_cmd = 0;
+        s_pos = 0;
+        s_partial = false;
+    }
+}
+
+static void write_ram(uint8_t *ram, uint8_t b)
+{
+    uint32_t xb0 = 0, y0 = 0, xb1 = LINE_BYTES - 1;
+    if (s_partial)
+    {
+        xb0 = (s_window[0] << 8 | s_window[1]) / 8;
+        xb1 = (s_window[2] << 8 | s_window[3]) / 8;
+        y0 = s_window[4] << 8 | s_window[5];
+    }
+    uint32_t row_bytes = xb1 - xb0 + 1;
+    uint32_t idx = (y0 + s_pos / row_bytes) * LINE_BYTES + xb0 + s_pos % row_bytes;
+    if (idx < SPI_MOCK_RAM_SIZE)
+    {
+        ram[idx] = b;
+    }
+}
+
+static void controller_byte(bool command, uint8_t b)
+{
+    if (command)
+    {
+        s_cmd = b;
+        s_pos = 0;
+        s_stats.commands++;
+        if (b == 0x91 || b == 0x92)
+        {
+            s_partial = b == 0x91;
+        }
+        return;
+    }
+    switch (s_cmd)
+    {
+    case 0x90:
+        if (s_pos < sizeof(s_window))
+        {
+            s_window[s_pos] = b;
+        }
+        break;
+    case 0x10:
+    case 0x13:
+        write_ram(s_ram[s_cmd == 0x10 ? 0 : 1], b);
+        break;
+    }
+    s_pos++;
+}
+
+static uint64_t max_ns(uint64_t a, uint64_t b)
+{
+    return a > b ? a : b;
+}
+
+static uint64_t bus_time_ns(spi_device_handle_t dev, const spi_transaction_t *t)
+{
+    return (uint64_t)t->length * 1000000000 / dev->clock_hz;
+}
+
+// The CPU spends ns in the driver, while queued transactions may be on the bus
+static void busy(spi_device_handle_t dev, uint64_t ns)
+{
+    uint64_t from = host_time_ns(), to = from + ns;
+    for (int i = 0; i < dev->count; i++)
+    {
+        const queued_t *q = &dev->queue[(dev->head + i) % QUEUE_MAX];
+        uint64_t a = max_ns(q->start_ns, from), b = q->end_ns < to ? q->end_ns : to;
+        if (b > a)
+        {
+            s_bus_busy_ns += b - a;
+        }
+    }
+    host_time_advance_ns(ns);
+    s_stats.driver_ns += ns;
+}
+
+static void transfer(const spi_transaction_t *t)
+{
+    assert(t->length % 8 == 0);
+    size_t len = t->length / 8;
+    assert(len <= (size_t)s_max_transfer);
+    const uint8_t *data = (const uint8_t *)t->tx_buffer;
+    bool command = gpio_get_level((gpio_num_t)CONFIG_EINK_DC) == 0;
+    for (size_t i = 0; i < len; i++)
+    {
+        controller_byte(command, data[i]);
+    }
+    s_stats.bytes += len;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *bus_config, spi_dma_chan_t dma_chan)
+{
+    (void)host;
+    (void)dma_chan;
+    s_max_transfer = bus_config->max_transfer_sz ? bus_config->max_transfer_sz : 4092;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *dev_config,
+                             spi_device_handle_t *handle)
+{
+    (void)host;
+    if (dev_config->queue_size > QUEUE_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(&s_dev, 0, sizeof(s_dev));
+    host_gpio_on_set(reset_controller);
+    s_dev.clock_hz = dev_config->clock_speed_hz;
+    s_dev.queue_size = dev_config->queue_size;
+    *handle = &s_dev;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+    // The driver refuses polling transactions while queued ones are pending
+    if (handle->count > 0)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    busy(handle, SPI_MOCK_POLL_SETUP_NS);
+    uint64_t bus = bus_time_ns(handle, trans);
+    busy(handle, max_ns(s_bus_free_ns, host_time_ns()) - host_time_ns() + bus);
+    s_bus_free_ns = host_time_ns();
+    s_stats.bus_ns += bus;
+    s_bus_busy_ns += bus;
+    transfer(trans);
+    s_stats.polled++;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans, TickType_t ticks_to_wait)
+{
+    (void)ticks_to_wait;
+    if (handle->count == handle->queue_size)
+    {
+        return ESP_ERR_TIMEOUT;
+    }
+    busy(handle, SPI_MOCK_QUEUE_SETUP_NS);
+    queued_t *q = &handle->queue[(handle->head + handle->count++) % QUEUE_MAX];
+    q->trans = trans;
+    // Straight away on an idle bus, else from the interrupt that ends the one before
+    uint64_t now = host_time_ns();
+    q->start_ns = s_bus_free_ns > now ? s_bus_free_ns + SPI_MOCK_ISR_GAP_NS : now;
+    q->end_ns = q->start_ns + bus_time_ns(handle, trans);
+    s_bus_free_ns = q->end_ns;
+    s_stats.bus_ns += q->end_ns - q->start_ns;
+    s_stats.queued++;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans_desc,
+                                      TickType_t ticks_to_wait)
+{
+    (void)ticks_to_wait;
+    if (handle->count == 0)
+    {
+        return ESP_ERR_TIMEOUT;
+    }
+    const queued_t *q = &handle->queue[handle->head];
+    if (q->end_ns > host_time_ns())
+    {
+        s_stats.wait_ns += q->end_ns - host_time_ns();
+        host_time_advance_ns(q->end_ns - host_time_ns());
+    }
+    busy(handle, SPI_MOCK_RESULT_NS);
+    // Sent only now: the buffer must still hold the data it was queued with
+    *trans_desc = q->trans;
+    handle->head = (handle->head + 1) % QUEUE_MAX;
+    handle->count--;
+    transfer(*trans_desc);
+    return ESP_OK;
+}
@@ -0,0 +1,55 @@
+#ifndef SPI_MOCK_H
+#define SPI_MOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * The device end of the host SPI master (stubs/driver/spi_master.h): a GD7965
+ * controller, as on the 7.5" Gdew075T7 panel, reduced to what the data phases
+ * need. A byte sent while DC is low is a command. The data of 0x10 (old) and
+ * 0x13 (new) fill the controller RAM row after row, over the whole frame, or
+ * between 0x91 (partial in) and 0x92 (partial out) over the byte-aligned
+ * window last set with 0x90. RST low resets the controller, RAM excepted.
+ * BUSY is always idle: refreshes take no time.
+ *
+ * Transactions take time on the host clock (esp_timer.h), at the device's
+ * clock_speed_hz plus the per-transaction overheads below, rough figures of
+ * the ESP32 driver (its documentation gives about 10 us per polling and
+ * 28 us per interrupt transaction). A polling transaction keeps the CPU busy
+ * in the driver from setup until the last bit is out. A queued one keeps it
+ * busy for its setup and for collecting the result; meanwhile DMA clocks it
+ * out, starting after the transaction queued before it plus the interrupt
+ * latency, and a task waiting for the result sleeps. Queued data is taken
+ * from its buffer when the result is collected, so a buffer reused too
+ * early shows up in the controller RAM.
+ */
+
+#define SPI_MOCK_POLL_SETUP_NS 10000
+#define SPI_MOCK_QUEUE_SETUP_NS 8000
+#define SPI_MOCK_RESULT_NS 2000
+#define SPI_MOCK_ISR_GAP_NS 18000
+
+#define SPI_MOCK_WIDTH 800
+#define SPI_MOCK_HEIGHT 480
+#define SPI_MOCK_RAM_SIZE (SPI_MOCK_WIDTH / 8 * SPI_MOCK_HEIGHT)
+
+typedef struct
+{
+    uint32_t polled;   // spi_device_polling_transmit() transactions
+    uint32_t queued;   // spi_device_queue_trans() transactions
+    uint32_t commands; // bytes sent with DC low
+    uint64_t bytes;    // every byte on the bus
+    uint64_t bus_ns;     // clocking bytes out
+    uint64_t driver_ns;  // CPU busy in the SPI master calls
+    uint64_t wait_ns;    // caller asleep, waiting for a queued transaction
+    uint64_t overlap_ns; // bus time while the CPU was not busy in the driver
+} spi_mock_stats_t;
+
+// Controller RAM, rows of SPI_MOCK_WIDTH / 8 bytes, MSB the leftmost pixel
+const uint8_t *spi_mock_ram(bool old);
+
+void spi_mock_get_stats(spi_mock_stats_t *stats);
+void spi_mock_reset_stats(void);
+
+#endif // SPI_MOCK_H
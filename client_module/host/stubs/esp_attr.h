@@ -0,0 +1,8 @@
+#ifndef ESP_ATTR_H
+#define ESP_ATTR_H
+
+// One kind of memory on the host
+#define DRAM_ATTR
+#define IRAM_ATTR
+
+#endif // ESP_ATTR_H
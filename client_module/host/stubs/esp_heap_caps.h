@@ -0,0 +1,17 @@
+#ifndef ESP_HEAP_CAPS_H
+#define ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
+
+// Host only: while set, MALLOC_CAP_DMA allocations fail
+extern bool host_heap_caps_no_dma;
+
+#endif // ESP_HEAP_CAPS_H
@@ -0,0 +1,12 @@
+#ifndef ESP_MEMORY_UTILS_H
+#define ESP_MEMORY_UTILS_H
+
+#include <stdbool.h>
+
+// Any host memory will do for the SPI mock
+static inline bool esp_ptr_dma_capable(const void *p)
+{
+    return p != 0;
+}
+
+#endif // ESP_MEMORY_UTILS_H
@@ -0,0 +1,10 @@
+#ifndef ESP_SYSTEM_H
+#define ESP_SYSTEM_H
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 1, 0)
+
+#endif // ESP_SYSTEM_H
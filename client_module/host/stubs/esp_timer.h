@@ -0,0 +1,12 @@
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+#include <stdint.h>
+
+// The host clock is virtual: it only moves when a stand-in that takes time
+// (vTaskDelay(), the SPI mock) or the program itself advances it
+int64_t esp_timer_get_time(void);
+uint64_t host_time_ns(void);
+void host_time_advance_ns(uint64_t ns);
+
+#endif // ESP_TIMER_H
@@ -0,0 +1,22 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_attr.h"
+#include "sdkconfig.h"
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define portMAX_DELAY UINT32_MAX
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR() ((void)0)
+
+size_t xPortGetFreeHeapSize(void);
+
+#endif // FREERTOS_H
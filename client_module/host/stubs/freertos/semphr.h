@@ -0,0 +1,15 @@
+#ifndef SEMPHR_H
+#define SEMPHR_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+typedef struct host_sem *SemaphoreHandle_t;
+
+// Single-threaded: a take that would block waits out its timeout on the host clock
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken);
+
+#endif // SEMPHR_H
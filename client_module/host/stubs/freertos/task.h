@@ -0,0 +1,9 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include "FreeRTOS.h"
+
+// Advances the host clock
+void vTaskDelay(TickType_t ticks);
+
+#endif // TASK_H
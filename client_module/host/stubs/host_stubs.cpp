@@ -0,0 +1,210 @@
+// What the stand-in headers declare and the programs under test do not
+// provide themselves.
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+struct host_sem
+{
+    int count;
+};
+
+static uint64_t s_now_ns;
+static int s_level[GPIO_NUM_MAX];
+static void (*s_gpio_hook)(gpio_num_t pin, int level);
+
+int host_log_level;
+bool host_heap_caps_no_dma;
+
+void host_log(int level, const char *tag, const char *fmt, ...)
+{
+    static const char levels[] = "-EWID";
+    if (level > host_log_level)
+    {
+        return;
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "%c (%s) ", levels[level], tag);
+    vfprintf(stderr, fmt, ap);
+    fputc('\n', stderr);
+    va_end(ap);
+}
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    static char buf[16];
+    snprintf(buf, sizeof(buf), "0x%x", (unsigned)code);
+    return code == ESP_OK ? "ESP_OK" : buf;
+}
+
+uint64_t host_time_ns(void)
+{
+    return s_now_ns;
+}
+
+void host_time_advance_ns(uint64_t ns)
+{
+    s_now_ns += ns;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return (int64_t)(s_now_ns / 1000);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    host_time_advance_ns((uint64_t)ticks * portTICK_PERIOD_MS * 1000000);
+}
+
+size_t xPortGetFreeHeapSize(void)
+{
+    return 0;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    if ((caps & MALLOC_CAP_DMA) && host_heap_caps_no_dma)
+    {
+        return NULL;
+    }
+    return malloc(size);
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return (SemaphoreHandle_t)calloc(1, sizeof(struct host_sem));
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait)
+{
+    if (sem->count > 0)
+    {
+        sem->count--;
+        return pdTRUE;
+    }
+    // Nothing else runs that could give it
+    assert(wait != portMAX_DELAY);
+    vTaskDelay(wait);
+    return pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    if (sem->count > 0)
+    {
+        return pdFALSE;
+    }
+    sem->count = 1;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken)
+{
+    *woken = pdFALSE;
+    return xSemaphoreGive(sem);
+}
+
+esp_err_t gpio_set_direction(gpio_num_t pin, gpio_mode_t mode)
+{
+    (void)pin;
+    (void)mode;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_pull_mode(gpio_num_t pin, gpio_pull_mode_t pull)
+{
+    s_level[pin] = pull == GPIO_PULLUP_ONLY || pull == GPIO_PULLUP_PULLDOWN;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level)
+{
+    s_level[pin] = level != 0;
+    if (s_gpio_hook)
+    {
+        s_gpio_hook(pin, s_level[pin]);
+    }
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t pin)
+{
+    return s_level[pin];
+}
+
+void host_gpio_drive(gpio_num_t pin, int level)
+{
+    s_level[pin] = level != 0;
+}
+
+void host_gpio_on_set(void (*hook)(gpio_num_t pin, int level))
+{
+    s_gpio_hook = hook;
+}
+
+esp_err_t gpio_install_isr_service(int flags)
+{
+    (void)flags;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t isr, void *arg)
+{
+    (void)pin;
+    (void)isr;
+    (void)arg;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type)
+{
+    (void)pin;
+    (void)type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t pin)
+{
+    (void)pin;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t pin)
+{
+    (void)pin;
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type)
+{
+    (void)pin;
+    (void)type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t pin)
+{
+    (void)pin;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup(void)
+{
+    return ESP_OK;
+}
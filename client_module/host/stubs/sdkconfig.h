@@ -0,0 +1,15 @@
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+// The badge's settings (client_module/sdkconfig) that the host builds use
+#define CONFIG_IDF_TARGET_ESP32 1
+#define CONFIG_EINK_SPI_MOSI 23
+#define CONFIG_EINK_SPI_CLK 18
+#define CONFIG_EINK_SPI_CS 5
+#define CONFIG_EINK_DC 17
+#define CONFIG_EINK_RST 16
+#define CONFIG_EINK_BUSY 4
+#define CONFIG_EINK_PARTIAL_FULL_EVERY 5
+#define CONFIG_EINK_PARTIAL_MAX_AREA 40
+
+#endif // SDKCONFIG_H
@@ -6,7 +6,15 @@
 #include "cJSON.h"
 #include "qrcode.h"
 #include "battery.h"
-#include "text_decode_utils.h"
+#include "badge_layout.h"
+#include "font_rle.h"
+#include "utf8.h"
+#include "wifi.h"
+#include "xfer_rx.h"
+#include "img_codec.h"
+#include "telemetry.h"
+#include "cmd_proto.h"
+#include "esp_timer.h"
 
 EpdSpi io;
 
@@ -25,19 +33,262 @@ Gdew075Z08 display(io);
 // ESP-NOW image data
 #define EINK_W 800
 #define EINK_H 480
-#define LOGO_BUF_SIZE ((EINK_W * EINK_H) / 8)
-// buffer & write-offset for incoming logo chunks
-static uint8_t logo_buf[LOGO_BUF_SIZE];
-static size_t logo_offset = 0;
+#define LOGO_SIZE ((EINK_W * EINK_H) / 8)
+// decoded bytes already written into the display framebuffer
+static uint32_t logo_decoded;
 
 static const char *TAG = "DISPLAY";
 
-void display_message_data(const uint8_t *data, int data_len)
+// sender of the frame currently being handled, STATUS replies go back to it
+static uint8_t logo_peer[6];
+static xfer_rx_t logo_rx;
+static bool logo_rx_ready = false;
+// decompresses the transfer payload on the fly; the gateway picks the encoding
+static img_decoder_t logo_dec;
+
+static int logo_link_send(void *ctx, const uint8_t *frame, size_t len)
+{
+    return espnow_send_to(logo_peer, frame, len) == ESP_OK ? 0 : -1;
+}
+
+// The logo is decoded straight into the driver framebuffer at its final
+// position, so no intermediate image buffer is needed. An aborted transfer
+// leaves a partial image there, but it is only shown by the next update()
+// and every other screen starts with fillScreen().
+static void logo_decoded_out(void *ctx, const uint8_t *data, size_t len)
+{
+    display.writeBitmapBytes(logo_decoded, data, len, EPD_BLACK, EPD_WHITE);
+    logo_decoded += len;
+}
+
+static bool logo_sink_begin(void *ctx, uint32_t total_len, uint8_t encoding)
+{
+    if (!img_enc_supported(encoding))
+    {
+        ESP_LOGE(TAG, "Refusing logo with unknown encoding %u", encoding);
+        return false;
+    }
+    // Raw images must be exactly one frame; compressed ones are bounded by the decoder
+    if (total_len == 0 || (encoding == IMG_ENC_RAW && total_len != LOGO_SIZE))
+    {
+        ESP_LOGE(TAG, "Refusing logo of %lu bytes", (unsigned long)total_len);
+        return false;
+    }
+    logo_decoded = 0;
+    img_decoder_init(&logo_dec, (img_enc_t)encoding, LOGO_SIZE, logo_decoded_out, NULL);
+    return true;
+}
+
+static void logo_sink_write(void *ctx, uint32_t offset, const uint8_t *data, size_t len)
+{
+    // Errors are sticky; checked once the transfer completes
+    img_decoder_feed(&logo_dec, data, len);
+}
+
+static uint32_t elapsed_ms(int64_t start)
+{
+    return (uint32_t)((esp_timer_get_time() - start) / 1000);
+}
+
+static void display_logo_frame(const uint8_t *mac, const uint8_t *data, int data_len)
+{
+    if (!logo_rx_ready)
+    {
+        xfer_link_t link = {.send = logo_link_send, .ctx = NULL};
+        xfer_sink_t sink = {.begin = logo_sink_begin, .write = logo_sink_write, .ctx = NULL};
+        xfer_rx_init(&logo_rx, &link, &sink);
+        logo_rx_ready = true;
+    }
+
+    memcpy(logo_peer, mac, sizeof(logo_peer));
+    xfer_rx_result_t res = xfer_rx_handle(&logo_rx, data, data_len);
+    if (res == XFER_RX_ERROR)
+    {
+        ESP_LOGE(TAG, "Logo transfer %u failed", logo_rx.id);
+        telemetry_report(mac, TELEM_EVT_REJECTED, TELEM_OP_IMAGE, logo_rx.id, 0);
+        return;
+    }
+    if (res != XFER_RX_COMPLETE)
+    {
+        return;
+    }
+    if (!img_decoder_done(&logo_dec))
+    {
+        ESP_LOGE(TAG, "Logo transfer %u: malformed enc %u payload (%lu of %d bytes decoded)",
+                 logo_rx.id, logo_rx.encoding, (unsigned long)logo_dec.produced, LOGO_SIZE);
+        telemetry_report(mac, TELEM_EVT_REJECTED, TELEM_OP_IMAGE, logo_rx.id, 0);
+        return;
+    }
+
+    ESP_LOGI(TAG, "Full logo received (%lu bytes, enc %u), rendering…",
+             (unsigned long)logo_rx.total_len, logo_rx.encoding);
+
+    int64_t start = esp_timer_get_time();
+    telemetry_report(mac, TELEM_EVT_ACCEPTED, TELEM_OP_IMAGE, logo_rx.id, 0);
+    gpio_set_level(GPIO_NUM_2, 1);
+    display.updateChanged();
+    gpio_set_level(GPIO_NUM_2, 0);
+    telemetry_report(mac, TELEM_EVT_RENDERED, TELEM_OP_IMAGE, logo_rx.id, elapsed_ms(start));
+}
+
+static void clear_screen(const uint8_t *mac)
+{
+    int64_t start = esp_timer_get_time();
+    telemetry_report(mac, TELEM_EVT_ACCEPTED, TELEM_OP_CLEAR, 0, 0);
+    gpio_set_level(GPIO_NUM_2, 1);
+    display.fillScreen(EPD_WHITE);
+    display.updateChanged();
+    gpio_set_level(GPIO_NUM_2, 0);
+    telemetry_report(mac, TELEM_EVT_RENDERED, TELEM_OP_CLEAR, 0, elapsed_ms(start));
+}
+
+// Decoded glyphs of the run-length coded name fonts
+static void blit_glyph(void *ctx, int16_t x, int16_t y, const uint8_t *bitmap, uint16_t w, uint16_t h)
+{
+    display.drawBitmap(x, y, bitmap, w, h, EPD_BLACK);
+}
+
+// Name screen: first and last name in the largest fonts that fit, the
+// additional info along the bottom. Takes UTF-8 text.
+static void draw_name_screen(const uint8_t *mac, const char *first, const char *last, const char *add)
+{
+    int64_t start = esp_timer_get_time();
+    const char *const text[NAME_FIELDS] = {first, last, add};
+    const layout_result_t *layout = layout_name_screen(text);
+    if (layout->status != LAYOUT_OK)
+    {
+        ESP_LOGW(TAG, "Field %d does not fit (%u), drawing what does", layout->overflow, layout->status);
+    }
+
+    telemetry_report(mac, TELEM_EVT_ACCEPTED, TELEM_OP_TEXT, 0, 0);
+    gpio_set_level(GPIO_NUM_2, 1);
+    display.fillScreen(EPD_WHITE);
+    for (uint8_t i = 0; i < layout->line_count; i++)
+    {
+        const layout_line_t *l = &layout->lines[i];
+        const font_chain_t *fonts = layout->font[l->field];
+        int16_t x = font_rle_draw(fonts, text[l->field] + l->start, l->len, l->x, l->y, blit_glyph, NULL);
+        if (l->hyphen)
+        {
+            font_rle_draw(fonts, "-", 1, x, l->y, blit_glyph, NULL);
+        }
+    }
+    font_rle_stats_t stats;
+    font_rle_get_stats(&stats);
+    ESP_LOGD(TAG, "Glyph cache: %lu hits, %lu misses, %lu bytes", (unsigned long)stats.hits,
+             (unsigned long)stats.misses, (unsigned long)stats.bytes);
+
+    float bat_voltage = measure_batt_voltage();
+    char bat_str[6];
+    sprintf(bat_str, "%0.2fV", bat_voltage / 1000.0f);
+    display.setFont(NULL);
+    display.setCursor(0, 0);
+    display.setTextSize(1);
+    display.println(bat_str);
+
+    display.updateChanged();
+    gpio_set_level(GPIO_NUM_2, 0);
+    telemetry_report(mac, TELEM_EVT_RENDERED, TELEM_OP_TEXT, 0, elapsed_ms(start));
+}
+
+// Binary command messages, reassembled in place: nothing is allocated per
+// update. Only the display worker gets here, so the buffers can be static.
+static cmd_rx_t cmd_rx;
+static bool cmd_rx_ready = false;
+static char cmd_first[CMD_FIELD_MAX + 1];
+static char cmd_last[CMD_FIELD_MAX + 1];
+static char cmd_add[CMD_FIELD_MAX + 1];
+
+static void display_cmd_frame(const uint8_t *mac, const uint8_t *data, int data_len)
 {
-    // ── JSON-based control (clear/text) ────────────────────────────────
+    if (!cmd_rx_ready)
+    {
+        cmd_rx_init(&cmd_rx);
+        cmd_rx_ready = true;
+    }
+
+    const uint8_t *msg;
+    size_t msg_len;
+    cmd_rx_result_t res = cmd_rx_handle(&cmd_rx, data, data_len, &msg, &msg_len);
+    if (res == CMD_RX_ERROR)
+    {
+        ESP_LOGE(TAG, "Command %u refused", cmd_rx.msg_id);
+        telemetry_report(mac, TELEM_EVT_REJECTED, TELEM_OP_NONE, 0, 0);
+        return;
+    }
+    if (res != CMD_RX_COMPLETE)
+    {
+        return;
+    }
+
+    bool clear = false, text = false;
+    cmd_first[0] = cmd_last[0] = cmd_add[0] = '\0';
+    size_t pos = 0;
+    cmd_field_t field;
+    while (cmd_next(msg, msg_len, &pos, &field))
+    {
+        switch (field.tag)
+        {
+        case CMD_TAG_CLEAR:
+            clear = true;
+            break;
+        case CMD_TAG_RESTART:
+            ESP_LOGI(TAG, "Restart requested");
+            esp_restart();
+            break;
+        case CMD_TAG_FIRST_NAME:
+            utf8_copy((const char *)field.value, field.len, cmd_first, sizeof(cmd_first));
+            text = true;
+            break;
+        case CMD_TAG_LAST_NAME:
+            utf8_copy((const char *)field.value, field.len, cmd_last, sizeof(cmd_last));
+            text = true;
+            break;
+        case CMD_TAG_INFO:
+            utf8_copy((const char *)field.value, field.len, cmd_add, sizeof(cmd_add));
+            text = true;
+            break;
+        default:
+            ESP_LOGD(TAG, "Skipping unknown command field 0x%02x", field.tag);
+            break;
+        }
+    }
+    if (pos != msg_len)
+    {
+        ESP_LOGE(TAG, "Command %u truncated at byte %u", cmd_rx.msg_id, (unsigned)pos);
+        telemetry_report(mac, TELEM_EVT_REJECTED, TELEM_OP_NONE, 0, 0);
+        return;
+    }
+
+    if (clear)
+    {
+        clear_screen(mac);
+    }
+    else if (text)
+    {
+        draw_name_screen(mac, cmd_first, cmd_last, cmd_add);
+    }
+}
+
+void display_message_data(const uint8_t *mac, const uint8_t *data, int data_len)
+{
+    // ── Windowed image transfer ─────────────────────────────────────────
+    if (xfer_is_frame(data, data_len, XFER_PKT_DATA))
+    {
+        display_logo_frame(mac, data, data_len);
+        return;
+    }
+
+    // ── Binary commands (clear/text/config) ─────────────────────────────
+    if (cmd_is_frame(data, data_len, CMD_PKT_FRAG))
+    {
+        display_cmd_frame(mac, data, data_len);
+        return;
+    }
+
+    // ── JSON text frames, kept for debugging from any ESP-NOW sender ────
     if (data_len > 0 && data[0] == '{')
     {
-        // existing JSON handling (clear screen or draw text)...
         char *json_str = (char *)malloc(data_len + 1);
         if (!json_str)
         {
@@ -52,18 +303,15 @@ void display_message_data(const uint8_t *data, int data_len)
         if (!root)
         {
             ESP_LOGE(TAG, "Malformed JSON");
+            telemetry_report(mac, TELEM_EVT_REJECTED, TELEM_OP_TEXT, 0, 0);
             return;
         }
 
         // Clear display?
         if (cJSON_GetObjectItemCaseSensitive(root, "clear"))
         {
-            logo_offset = 0;
-            gpio_set_level(GPIO_NUM_2, 1);
-            display.fillScreen(EPD_WHITE);
-            display.update();
-            gpio_set_level(GPIO_NUM_2, 0);
             cJSON_Delete(root);
+            clear_screen(mac);
             return;
         }
 
@@ -76,129 +324,19 @@ void display_message_data(const uint8_t *data, int data_len)
         const char *last = cJSON_IsString(last_item) ? last_item->valuestring : "";
         const char *add = cJSON_IsString(add_item) ? add_item->valuestring : "";
 
-        char *first_clean = remove_diacritics_utf8(first);
-        char *last_clean = remove_diacritics_utf8(last);
-        char *add_clean = remove_diacritics_utf8(add);
-
-        if (add_clean && strcmp(add_clean, "reset666") == 0)
+        if (strcmp(add, "reset666") == 0)
         {
             esp_restart(); // soft-reset the chip
         }
 
-        gpio_set_level(GPIO_NUM_2, 1);
-        display.fillScreen(EPD_WHITE);
-        display.setTextColor(EPD_BLACK);
-
-        uint16_t w = display.width(), h = display.height();
-        uint16_t y = Y_OFFSET, ls = LINE_SPACING, nh = 150;
-
-        if (first_clean[0])
-        {
-            display.setFont(select_font_for_text(first_clean, w, nh));
-            y += print_centered_line(first_clean, y, w) + ls;
-        }
-        if (last_clean[0])
-        {
-            display.setFont(select_font_for_text(last_clean, w, nh));
-            y += print_centered_line(last_clean, y, w) + ls;
-        }
-        if (add_clean[0])
-        {
-            display.setFont(&Roboto_Condensed_SemiBold40pt7b);
-            int16_t tbx, tby;
-            uint16_t tbw, tbh;
-            display.getTextBounds(add_clean, 0, 0, &tbx, &tby, &tbw, &tbh);
-            uint16_t yy = h - tbh - 20;
-            int16_t xx = (w - tbw) / 2 - tbx;
-            display.setCursor(xx, yy + tbh);
-            display.println(add_clean);
-        }
-
-        float bat_voltage = measure_batt_voltage();
-        char bat_str[6];
-        sprintf(bat_str, "%0.2fV", bat_voltage / 1000.0f);
-        display.setFont(NULL);
-        display.setCursor(0, 0);
-        display.setTextSize(1);
-        display.println(bat_str);
-
-        display.update();
-        gpio_set_level(GPIO_NUM_2, 0);
-
-        free(first_clean);
-        free(last_clean);
-        free(add_clean);
+        // Drawn as UTF-8 straight from the parsed strings
+        draw_name_screen(mac, first, last, add);
         cJSON_Delete(root);
         return;
     }
 
-    // ── Binary logo chunks ──────────────────────────────────────────────
-    // sanity check
-    if (logo_offset + data_len > LOGO_BUF_SIZE)
-    {
-        ESP_LOGE(TAG, "Logo buffer overflow: %u + %d > %u",
-                 logo_offset, data_len, (unsigned)LOGO_BUF_SIZE);
-        logo_offset = 0;
-        return;
-    }
-
-    // copy incoming chunk
-    memcpy(logo_buf + logo_offset, data, data_len);
-    logo_offset += data_len;
-
-    // if we've received the full image, render it
-    if (logo_offset >= LOGO_BUF_SIZE)
-    {
-        ESP_LOGI(TAG, "Full logo received (%u bytes), rendering…",
-                 (unsigned)logo_offset);
-
-        gpio_set_level(GPIO_NUM_2, 1);
-        display.fillScreen(EPD_WHITE);
-        // Draw raw 1-bit bitmap at (0,0)
-        display.drawBitmap(0, 0, logo_buf, EINK_W, EINK_H, EPD_BLACK);
-        display.update();
-        gpio_set_level(GPIO_NUM_2, 0);
-
-        // reset for next transfer
-        logo_offset = 0;
-    }
-}
-
-uint16_t print_centered_line(const char *text, uint16_t startY, uint16_t availWidth)
-{
-    int16_t tbx, tby;
-    uint16_t tbw, tbh;
-    display.getTextBounds(text, 0, startY, &tbx, &tby, &tbw, &tbh);
-    uint16_t x = (availWidth - tbw) / 2 - tbx;
-    display.setCursor(x, startY + tbh); // Adjust y to account for text baseline
-    display.println(text);
-    return tbh;
-}
-
-const GFXfont *select_font_for_text(const char *text, uint16_t availWidth, uint16_t availHeight)
-{
-    display.setFont(NULL);
-    display.setTextSize(1);
-    const GFXfont *fonts[3] = {
-        &Roboto_Condensed_SemiBold75pt7b,
-        &Roboto_Condensed_SemiBold60pt7b,
-        &Roboto_Condensed_SemiBold40pt7b};
-
-    int16_t tbx, tby;
-    uint16_t tbw, tbh;
-    for (int i = 0; i < 3; i++)
-    {
-        display.setFont(fonts[i]);
-        display.getTextBounds(text, 0, 0, &tbx, &tby, &tbw, &tbh);
-        ESP_LOGI(TAG, "tbw %d tbh: %d\n", tbw, tbh);
-        if (tbw <= availWidth && tbh <= availHeight)
-        {
-            ESP_LOGI(TAG, "Chosen font: %d\n", i);
-            return fonts[i];
-        }
-    }
-    ESP_LOGI(TAG, "Chosen smallest font\n");
-    return &Roboto_Condensed_SemiBold40pt7b;
+    ESP_LOGW(TAG, "Unknown %d-byte frame dropped", data_len);
+    telemetry_report(mac, TELEM_EVT_REJECTED, TELEM_OP_NONE, 0, 0);
 }
 
 /**
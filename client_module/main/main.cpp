@@ -2,6 +2,9 @@
 #include "wifi.h"
 #include "display.h"
 #include "battery.h"
+#include "power.h"
+#include "wake_proto.h"
+#include "telemetry.h"
 
 // FreeRTOS queue
 #define ESPNOW_MAX_PAYLOAD 250
@@ -28,7 +31,8 @@ void delay(uint32_t millis) { vTaskDelay(millis / portTICK_PERIOD_MS); }
  *
  * Copies a received frame (≤ #ESPNOW_MAX_PAYLOAD) into a local espnow_evt_t
  * and posts it to the global @c espnow_queue with xQueueSendFromISR().
- * Oversize frames are discarded.
+ * Oversize frames, and wake announcements and telemetry of neighbouring
+ * badges, are discarded. Queue depth and losses are counted for telemetry.
  * If the queue send wakes a higher-priority task, portYIELD_FROM_ISR() is
  * invoked to yield immediately.
  *
@@ -41,7 +45,8 @@ void delay(uint32_t millis) { vTaskDelay(millis / portTICK_PERIOD_MS); }
  */
 static void esp_now_recv_callback(const esp_now_recv_info_t *info, const uint8_t *data, int len)
 {
-    if (len > ESPNOW_MAX_PAYLOAD)
+    if (len > ESPNOW_MAX_PAYLOAD || wake_is_frame(data, len, WAKE_PKT_HELLO) ||
+        telem_is_frame(data, len, TELEM_PKT_REPORT))
         return;
 
     espnow_evt_t evt;
@@ -50,7 +55,8 @@ static void esp_now_recv_callback(const esp_now_recv_info_t *info, const uint8_t
     memcpy(evt.data, data, len);
 
     BaseType_t xHigherPrioTaskWoken = pdFALSE;
-    xQueueSendFromISR(espnow_queue, &evt, &xHigherPrioTaskWoken);
+    bool dropped = xQueueSendFromISR(espnow_queue, &evt, &xHigherPrioTaskWoken) != pdTRUE;
+    telemetry_note_rx(info->rx_ctrl->rssi, uxQueueMessagesWaitingFromISR(espnow_queue), dropped);
 
     // If the queue send woke a higher-prio task, request a context-switch
     if (xHigherPrioTaskWoken)
@@ -63,7 +69,8 @@ static void esp_now_recv_callback(const esp_now_recv_info_t *info, const uint8_t
  * Blocks on @c espnow_queue (portMAX_DELAY).
  * Each dequeued ::espnow_evt_t is passed to @c display_message_data() for full
  * JSON/logo parsing and display updates—work that is unsafe in ISR context but
- * fine here.
+ * fine here. The sender MAC travels along so transfer STATUS frames can be
+ * answered. Every frame also keeps the radio awake for the rest of a transfer.
  *
  * @param arg Unused; pass NULL when creating the task.
  */
@@ -75,7 +82,8 @@ static void espnow_worker_task(void *arg)
     {
         if (xQueueReceive(espnow_queue, &evt, portMAX_DELAY) == pdTRUE)
         {
-            display_message_data(evt.data, evt.len);
+            power_activity();
+            display_message_data(evt.mac, evt.data, evt.len);
         }
     }
 }
@@ -86,6 +94,8 @@ void app_main(void)
     wifi_sta_init();
     espnow_queue = xQueueCreate(30, sizeof(espnow_evt_t));
     assert(espnow_queue);
+    // init adc for battery measurement, every telemetry report reads it
+    adc_init();
     ESP_ERROR_CHECK(esp_now_register_recv_cb(esp_now_recv_callback));
 
     /* start the worker */
@@ -97,14 +107,15 @@ void app_main(void)
                             NULL,
                             tskNO_AFFINITY);
 
-    // init adc for battery measurement
-    adc_init();
+    // radio off between wake windows, if enabled
+    power_init();
 
     // power for EInk display
     gpio_set_direction(GPIO_NUM_2, GPIO_MODE_OUTPUT);
     gpio_set_level(GPIO_NUM_2, 1);
     // display default screen
     display_start_screen();
+    telemetry_boot();
     while (1)
     {
         // Turn off power for the EInk display
@@ -0,0 +1,140 @@
+#include "power.h"
+#include "sdkconfig.h"
+
+#if CONFIG_BADGE_POWER_SAVE
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_now.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "wifi.h"
+#include "wake_proto.h"
+
+static const char *TAG = "Power";
+static const uint8_t broadcast_mac[6] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t s_awake_until; // radio stays on until this time (ms)
+
+static int64_t now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+static void keep_awake(uint32_t hold_ms)
+{
+    int64_t until = now_ms() + hold_ms;
+    portENTER_CRITICAL(&s_lock);
+    if (until > s_awake_until)
+    {
+        s_awake_until = until;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void power_activity(void)
+{
+    keep_awake(CONFIG_BADGE_ACTIVE_HOLD_MS);
+}
+
+/**
+ * Opens a listen window every wake interval, announces it with a HELLO and
+ * turns the radio back off once the window and any traffic it attracted are
+ * over. Radio-on time is the dominant energy cost, so it is what gets logged.
+ */
+static void power_task(void *arg)
+{
+    wake_hello_t hello = {
+        .magic = WAKE_MAGIC,
+        .type = WAKE_PKT_HELLO,
+        .flags = WAKE_FLAG_BOOT,
+        .listen_ms = CONFIG_BADGE_WAKE_WINDOW_MS,
+        .interval_ms = CONFIG_BADGE_WAKE_INTERVAL_MS,
+    };
+    int64_t next_hello = now_ms();
+    bool radio_on = true; // wifi_sta_init() leaves it on
+    int64_t on_since = next_hello;
+    int64_t on_total = 0;
+
+    while (true)
+    {
+        int64_t now = now_ms();
+        if (now >= next_hello)
+        {
+            // The window must be open before it is announced
+            keep_awake(CONFIG_BADGE_WAKE_WINDOW_MS);
+            if (!radio_on)
+            {
+                esp_wifi_set_ps(WIFI_PS_NONE);
+                radio_on = true;
+                on_since = now;
+            }
+            espnow_send_to(broadcast_mac, (const uint8_t *)&hello, sizeof(hello));
+            hello.seq++;
+            hello.flags = 0;
+            next_hello += CONFIG_BADGE_WAKE_INTERVAL_MS;
+            if (next_hello <= now)
+            {
+                next_hello = now + CONFIG_BADGE_WAKE_INTERVAL_MS; // stalled, e.g. by a long refresh
+            }
+        }
+
+        portENTER_CRITICAL(&s_lock);
+        int64_t until = s_awake_until;
+        portEXIT_CRITICAL(&s_lock);
+
+        if (radio_on && now >= until)
+        {
+            esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+            radio_on = false;
+            int64_t on = now - on_since;
+            on_total += on;
+            // Plain windows are routine; report the ones that carried an update
+            if (on > 2 * CONFIG_BADGE_WAKE_WINDOW_MS)
+            {
+                ESP_LOGI(TAG, "Radio on %lld ms for an update, %lld.%lld%% of the time since boot",
+                         on, on_total * 100 / now, on_total * 1000 / now % 10);
+            }
+        }
+
+        int64_t wake = next_hello;
+        if (radio_on && until < wake)
+        {
+            wake = until;
+        }
+        vTaskDelay(pdMS_TO_TICKS(wake - now) + 1);
+    }
+}
+
+void power_init(void)
+{
+    esp_pm_config_t pm_config = {
+        .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = CONFIG_XTAL_FREQ,
+        .light_sleep_enable = true,
+    };
+    ESP_ERROR_CHECK(esp_pm_configure(&pm_config));
+
+    // No connectionless wake-ups of its own: the radio listens only in the
+    // windows power_task() opens and announces
+    ESP_ERROR_CHECK(esp_now_set_wake_window(0));
+    ESP_ERROR_CHECK(esp_wifi_connectionless_module_set_wake_interval(CONFIG_BADGE_WAKE_INTERVAL_MS));
+
+    ESP_LOGI(TAG, "Power save: %d ms window every %d ms", CONFIG_BADGE_WAKE_WINDOW_MS,
+             CONFIG_BADGE_WAKE_INTERVAL_MS);
+    xTaskCreate(power_task, "power", 3072, NULL, 3, NULL);
+}
+
+#else
+
+void power_init(void)
+{
+}
+
+void power_activity(void)
+{
+}
+
+#endif
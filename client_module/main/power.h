@@ -0,0 +1,31 @@
+#ifndef POWER_H
+#define POWER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Start the power manager (CONFIG_BADGE_POWER_SAVE).
+     *
+     * Enables automatic light sleep, turns the radio off between wake windows
+     * and announces each window with a HELLO broadcast so the gateway knows
+     * when the badge listens. Does nothing when power saving is disabled.
+     * Call after wifi_sta_init().
+     */
+    void power_init(void);
+
+    /**
+     * @brief Keep the radio on for CONFIG_BADGE_ACTIVE_HOLD_MS from now.
+     *
+     * Called for every received frame so transfers that started inside a
+     * wake window are not cut off.
+     */
+    void power_activity(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
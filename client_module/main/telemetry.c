@@ -0,0 +1,65 @@
+#include "telemetry.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_app_desc.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "battery.h"
+#include "wifi.h"
+
+static const char *TAG = "Telemetry";
+static const uint8_t broadcast_mac[6] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static int8_t s_rssi;
+static uint8_t s_queue_hwm;
+static uint16_t s_dropped;
+static uint16_t s_seq;
+
+void telemetry_note_rx(int8_t rssi, unsigned waiting, bool dropped)
+{
+    portENTER_CRITICAL(&s_lock);
+    s_rssi = rssi;
+    if (waiting > s_queue_hwm)
+    {
+        s_queue_hwm = (waiting > UINT8_MAX) ? UINT8_MAX : (uint8_t)waiting;
+    }
+    if (dropped && s_dropped < UINT16_MAX)
+    {
+        s_dropped++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void telemetry_report(const uint8_t mac[6], telem_event_t event, telem_op_t op, uint8_t xfer_id,
+                      uint32_t render_ms)
+{
+    telem_report_t report = {
+        .magic = TELEM_MAGIC,
+        .type = TELEM_PKT_REPORT,
+        .event = event,
+        .op = op,
+        .xfer_id = xfer_id,
+        .render_ms = render_ms,
+        .battery_mv = (uint16_t)measure_batt_voltage(),
+    };
+    strncpy(report.fw, esp_app_get_description()->version, sizeof(report.fw));
+
+    portENTER_CRITICAL(&s_lock);
+    report.seq = s_seq++;
+    report.rssi = s_rssi;
+    report.queue_hwm = s_queue_hwm;
+    report.dropped = s_dropped;
+    portEXIT_CRITICAL(&s_lock);
+
+    esp_err_t err = espnow_send_to(mac, (const uint8_t *)&report, sizeof(report));
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Report %u to " MACSTR " not sent: %s", report.seq, MAC2STR(mac), esp_err_to_name(err));
+    }
+}
+
+void telemetry_boot(void)
+{
+    telemetry_report(broadcast_mac, TELEM_EVT_BOOT, TELEM_OP_NONE, 0, 0);
+}
@@ -0,0 +1,45 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "telem_proto.h"
+
+    /**
+     * @brief Account for a frame from the ESP-NOW receive callback.
+     *
+     * @param rssi    Signal strength of the frame, dBm.
+     * @param waiting Frames in the receive queue after this one was offered.
+     * @param dropped True if the queue was full and the frame was lost.
+     *
+     * @note Safe in Wi-Fi task context: only a few stores under a spinlock.
+     */
+    void telemetry_note_rx(int8_t rssi, unsigned waiting, bool dropped);
+
+    /**
+     * @brief Send a REPORT about an update to the gateway at @p mac.
+     *
+     * Battery, signal, receive-queue figures and the firmware version are
+     * filled in here. @p render_ms only matters for TELEM_EVT_RENDERED.
+     */
+    void telemetry_report(const uint8_t mac[6], telem_event_t event, telem_op_t op, uint8_t xfer_id,
+                          uint32_t render_ms);
+
+    /**
+     * @brief Broadcast a BOOT report, so the gateway learns the firmware
+     * version and battery of a badge before it sends anything.
+     *
+     * Call once ESP-NOW and the battery ADC are initialised.
+     */
+    void telemetry_boot(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
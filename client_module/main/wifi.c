@@ -4,6 +4,7 @@
 #include "nvs_flash.h"
 #include "esp_log.h"
 #include "esp_now.h"
+#include <string.h>
 
 static const char *TAG = "Wi-Fi";
 
@@ -32,8 +33,23 @@ void wifi_sta_init(void)
 
     // init ESP-NOW
     ESP_ERROR_CHECK(esp_now_init());
-#if CONFIG_ESPNOW_ENABLE_POWER_SAVE
-    ESP_ERROR_CHECK(esp_now_set_wake_window(CONFIG_ESPNOW_WAKE_WINDOW));
-    ESP_ERROR_CHECK(esp_wifi_connectionless_module_set_wake_interval(CONFIG_ESPNOW_WAKE_INTERVAL));
-#endif
-}
\ No newline at end of file
+    // Radio power saving, if enabled, is handled by power_init()
+}
+
+esp_err_t espnow_send_to(const uint8_t mac[6], const uint8_t *data, size_t len)
+{
+    if (!esp_now_is_peer_exist(mac))
+    {
+        esp_now_peer_info_t peer_info = {0};
+        peer_info.channel = 1;
+        peer_info.encrypt = false;
+        memcpy(peer_info.peer_addr, mac, ESP_NOW_ETH_ALEN);
+        esp_err_t err = esp_now_add_peer(&peer_info);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(TAG, "esp_now_add_peer " MACSTR " failed: %s", MAC2STR(mac), esp_err_to_name(err));
+            return err;
+        }
+    }
+    return esp_now_send(mac, data, len);
+}
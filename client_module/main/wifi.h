@@ -6,14 +6,10 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+#include <stddef.h>
 #include "esp_err.h"
 
-#define CONFIG_ESPNOW_ENABLE_POWER_SAVE 0
-// range 0 - 65535 in milliseconds
-#define CONFIG_ESPNOW_WAKE_WINDOW 50
-// range 1 - 65535 in milliseconds
-#define CONFIG_ESPNOW_WAKE_INTERVAL 100
-
     /**
      * @brief Initialize Wi-Fi in station mode and set up ESP-NOW receive.
      *
@@ -21,6 +17,11 @@ extern "C"
      */
     void wifi_sta_init(void);
 
+    /**
+     * @brief Send an ESP-NOW frame back to @p mac, registering it as a peer first if needed.
+     */
+    esp_err_t espnow_send_to(const uint8_t mac[6], const uint8_t *data, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
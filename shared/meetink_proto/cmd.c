@@ -0,0 +1,124 @@
+#include "cmd_proto.h"
+#include <string.h>
+
+bool cmd_put(uint8_t *msg, size_t cap, size_t *len, uint8_t tag, const void *value, size_t value_len)
+{
+    if (value_len > CMD_FIELD_MAX || *len + 2 + value_len > cap)
+    {
+        return false;
+    }
+    msg[*len] = tag;
+    msg[*len + 1] = (uint8_t)value_len;
+    if (value_len)
+    {
+        memcpy(msg + *len + 2, value, value_len);
+    }
+    *len += 2 + value_len;
+    return true;
+}
+
+size_t cmd_frag(uint8_t *frame, const uint8_t *msg, size_t msg_len, uint8_t msg_id, uint8_t index)
+{
+    uint8_t count = cmd_frag_count(msg_len);
+    if (index >= count || msg_len > CMD_MSG_MAX)
+    {
+        return 0;
+    }
+    cmd_frag_hdr_t hdr = {
+        .magic = CMD_MAGIC,
+        .type = CMD_PKT_FRAG,
+        .version = CMD_VERSION,
+        .msg_id = msg_id,
+        .index = index,
+        .count = count,
+        .total_len = (uint16_t)msg_len,
+    };
+    size_t offset = (size_t)index * CMD_FRAG_MAX;
+    size_t chunk = msg_len - offset;
+    if (chunk > CMD_FRAG_MAX)
+    {
+        chunk = CMD_FRAG_MAX;
+    }
+    memcpy(frame, &hdr, CMD_HDR_LEN);
+    memcpy(frame + CMD_HDR_LEN, msg + offset, chunk);
+    return CMD_HDR_LEN + chunk;
+}
+
+bool cmd_next(const uint8_t *msg, size_t msg_len, size_t *pos, cmd_field_t *field)
+{
+    if (*pos + 2 > msg_len || *pos + 2 + msg[*pos + 1] > msg_len)
+    {
+        return false;
+    }
+    field->tag = msg[*pos];
+    field->len = msg[*pos + 1];
+    field->value = msg + *pos + 2;
+    *pos += 2 + field->len;
+    return true;
+}
+
+void cmd_rx_init(cmd_rx_t *rx)
+{
+    memset(rx, 0, sizeof(*rx));
+}
+
+cmd_rx_result_t cmd_rx_handle(cmd_rx_t *rx, const uint8_t *frame, size_t len, const uint8_t **msg,
+                              size_t *msg_len)
+{
+    cmd_frag_hdr_t hdr;
+    if (len < CMD_HDR_LEN || !cmd_is_frame(frame, len, CMD_PKT_FRAG))
+    {
+        return CMD_RX_IGNORED;
+    }
+    memcpy(&hdr, frame, CMD_HDR_LEN);
+    if (hdr.version != CMD_VERSION || hdr.total_len > CMD_MSG_MAX)
+    {
+        return CMD_RX_ERROR;
+    }
+    if (hdr.count != cmd_frag_count(hdr.total_len) || hdr.index >= hdr.count)
+    {
+        return CMD_RX_IGNORED;
+    }
+
+    bool same = (rx->active || rx->finished) && hdr.msg_id == rx->msg_id && hdr.total_len == rx->total_len;
+    if (same && rx->finished)
+    {
+        return CMD_RX_IGNORED; // the sender missed our MAC ack and repeated a fragment
+    }
+    if (!same)
+    {
+        // A new message replaces whatever was being reassembled
+        rx->msg_id = hdr.msg_id;
+        rx->total_len = hdr.total_len;
+        rx->count = hdr.count;
+        rx->have = 0;
+        rx->active = true;
+        rx->finished = false;
+    }
+
+    size_t offset = (size_t)hdr.index * CMD_FRAG_MAX;
+    size_t chunk = hdr.total_len - offset;
+    if (chunk > CMD_FRAG_MAX)
+    {
+        chunk = CMD_FRAG_MAX;
+    }
+    if (len - CMD_HDR_LEN != chunk)
+    {
+        return CMD_RX_IGNORED;
+    }
+    if (rx->have & (1UL << hdr.index))
+    {
+        return CMD_RX_IGNORED;
+    }
+    memcpy(rx->msg + offset, frame + CMD_HDR_LEN, chunk);
+    rx->have |= 1UL << hdr.index;
+    if (rx->have != (1UL << rx->count) - 1)
+    {
+        return CMD_RX_PROGRESS;
+    }
+    rx->active = false;
+    rx->finished = true;
+    *msg = rx->msg;
+    *msg_len = rx->total_len;
+    return CMD_RX_COMPLETE;
+}
@@ -0,0 +1,263 @@
+// Feeds random command messages through cmd_frag() and cmd_rx_handle() the
+// way ESP-NOW can deliver them to a badge: the fragments of a message in
+// any order, some of them twice or three times (the gateway repeats a
+// fragment when it misses the MAC ack), and stray frames in between that
+// are not fragments at all. Now and then a message is cut short and the
+// next one arrives before its last fragment, as when the gateway replaces
+// an update that is still in flight.
+//
+// Every message must complete exactly once, with its last missing fragment,
+// reassembled byte for byte and with the fields it was built from. Repeats
+// of a completed message are ignored, and a message cut short never
+// completes nor leaves anything behind in the next one.
+//
+// Usage: cmd_check [-n messages]
+//
+// Exit status: 0 if every check held, 1 if one did not, 2 on bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "cmd_proto.h"
+
+#define COPIES_MAX 3 // deliveries of one fragment
+#define FIELDS_MAX (CMD_MSG_MAX / 2)
+
+typedef struct
+{
+    uint8_t frame[CMD_FRAME_MAX];
+    size_t len;
+    uint8_t index;
+} delivery_t;
+
+static uint32_t s_rng = 1;
+static unsigned s_errors;
+
+static uint32_t next_rand(void)
+{
+    s_rng = s_rng * 1103515245 + 12345;
+    return s_rng >> 8;
+}
+
+static void fail(long n, const char *what)
+{
+    if (s_errors++ < 20)
+    {
+        printf("FAIL: message %ld: %s\n", n, what);
+    }
+}
+
+// Random fields up to a random length; returns the message length
+static size_t build(uint8_t *msg, cmd_field_t *fields, int *field_count)
+{
+    size_t target = next_rand() % (CMD_MSG_MAX + 1);
+    size_t len = 0;
+    *field_count = 0;
+    while (len + 2 <= target)
+    {
+        uint8_t value[CMD_FIELD_MAX];
+        size_t value_len = next_rand() % (CMD_FIELD_MAX + 1);
+        if (value_len > target - len - 2)
+        {
+            value_len = target - len - 2;
+        }
+        for (size_t i = 0; i < value_len; i++)
+        {
+            value[i] = (uint8_t)next_rand();
+        }
+        uint8_t tag = (uint8_t)next_rand();
+        if (!cmd_put(msg, CMD_MSG_MAX, &len, tag, value, value_len))
+        {
+            break;
+        }
+        fields[*field_count].tag = tag;
+        fields[*field_count].len = (uint8_t)value_len;
+        fields[*field_count].value = msg + len - value_len;
+        (*field_count)++;
+    }
+    return len;
+}
+
+static bool same_fields(const uint8_t *msg, size_t len, const cmd_field_t *fields, int field_count)
+{
+    size_t pos = 0;
+    cmd_field_t field;
+    int i = 0;
+    while (cmd_next(msg, len, &pos, &field))
+    {
+        if (i == field_count || field.tag != fields[i].tag || field.len != fields[i].len ||
+            memcmp(field.value, fields[i].value, field.len) != 0)
+        {
+            return false;
+        }
+        i++;
+    }
+    return i == field_count && pos == len;
+}
+
+// A frame the badge may hear that is not a fragment it can use
+static size_t noise(uint8_t *frame)
+{
+    cmd_frag_hdr_t hdr = {.magic = CMD_MAGIC, .type = CMD_PKT_FRAG, .version = CMD_VERSION};
+    switch (next_rand() % 4)
+    {
+    case 0:
+        memcpy(frame, "{\"info\":\"x\"}", 12); // JSON debug frame
+        return 12;
+    case 1:
+        memcpy(frame, &hdr, CMD_HDR_LEN);
+        return CMD_HDR_LEN - 1; // truncated header
+    case 2:
+        hdr.version = CMD_VERSION + 1;
+        hdr.count = 1;
+        memcpy(frame, &hdr, CMD_HDR_LEN);
+        return CMD_HDR_LEN;
+    default:
+        hdr.total_len = CMD_MSG_MAX + 1;
+        hdr.count = cmd_frag_count(hdr.total_len);
+        memcpy(frame, &hdr, CMD_HDR_LEN);
+        return CMD_HDR_LEN;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    long messages = 20000;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1)
+    {
+        if (opt == 'n')
+        {
+            messages = atol(optarg);
+        }
+        else
+        {
+            messages = 0;
+        }
+    }
+    if (messages <= 0 || optind != argc)
+    {
+        fprintf(stderr, "usage: %s [-n messages]\n", argv[0]);
+        return 2;
+    }
+
+    static cmd_rx_t rx;
+    static uint8_t msg[CMD_MSG_MAX];
+    static cmd_field_t fields[FIELDS_MAX];
+    static delivery_t deliveries[(CMD_MSG_MAX / CMD_FRAG_MAX + 1) * COPIES_MAX];
+    cmd_rx_init(&rx);
+    unsigned long frames = 0, repeats = 0, strays = 0, cut = 0, completed = 0;
+    uint8_t msg_id = (uint8_t)next_rand();
+    for (long n = 0; n < messages; n++)
+    {
+        int field_count;
+        size_t len = build(msg, fields, &field_count);
+        uint8_t count = cmd_frag_count(len);
+        msg_id++;
+
+        int total = 0;
+        for (uint8_t i = 0; i < count; i++)
+        {
+            int copies = 1 + (int)(next_rand() % 4 == 0) + (int)(next_rand() % 8 == 0);
+            for (int c = 0; c < copies; c++)
+            {
+                delivery_t *d = &deliveries[total++];
+                d->len = cmd_frag(d->frame, msg, len, msg_id, i);
+                d->index = i;
+                if (d->len == 0)
+                {
+                    fail(n, "cmd_frag() refused a fragment");
+                }
+            }
+        }
+        for (int i = total - 1; i > 0; i--)
+        {
+            int j = (int)(next_rand() % (uint32_t)(i + 1));
+            delivery_t t = deliveries[i];
+            deliveries[i] = deliveries[j];
+            deliveries[j] = t;
+        }
+        // Cut short: deliver until some fragment is still missing, then move on
+        bool cutting = count > 1 && next_rand() % 8 == 0;
+        int stop_after = cutting ? (int)(next_rand() % (count - 1)) + 1 : count; // distinct fragments
+
+        uint32_t seen = 0;
+        int distinct = 0;
+        bool done = false;
+        for (int i = 0; i < total; i++)
+        {
+            delivery_t *d = &deliveries[i];
+            bool repeat = seen & (1UL << d->index);
+            if (!repeat && distinct == stop_after)
+            {
+                continue; // lost for good
+            }
+            if (next_rand() % 16 == 0)
+            {
+                uint8_t stray[CMD_FRAME_MAX];
+                size_t stray_len = noise(stray);
+                const uint8_t *out;
+                size_t out_len;
+                if (cmd_rx_handle(&rx, stray, stray_len, &out, &out_len) == CMD_RX_COMPLETE)
+                {
+                    fail(n, "a stray frame completed a message");
+                }
+                strays++;
+            }
+
+            const uint8_t *out = NULL;
+            size_t out_len = 0;
+            cmd_rx_result_t res = cmd_rx_handle(&rx, d->frame, d->len, &out, &out_len);
+            frames++;
+            repeats += repeat;
+            if (!repeat)
+            {
+                seen |= 1UL << d->index;
+                distinct++;
+            }
+            if (repeat && res != CMD_RX_IGNORED)
+            {
+                fail(n, done ? "repeat after completion not ignored" : "repeated fragment not ignored");
+            }
+            else if (!repeat && distinct < count && res != CMD_RX_PROGRESS)
+            {
+                fail(n, "fragment not stored");
+            }
+            else if (!repeat && distinct == count)
+            {
+                if (res != CMD_RX_COMPLETE)
+                {
+                    fail(n, "not complete with every fragment in");
+                }
+                else if (out_len != len || memcmp(out, msg, len) != 0)
+                {
+                    fail(n, "reassembled message differs");
+                }
+                else if (!same_fields(out, out_len, fields, field_count))
+                {
+                    fail(n, "fields differ");
+                }
+                else
+                {
+                    completed++;
+                }
+                done = true;
+            }
+        }
+        if (cutting)
+        {
+            cut++;
+        }
+        else if (!done)
+        {
+            fail(n, "never completed");
+        }
+    }
+
+    printf("%ld messages (%lu cut short), %lu fragments delivered, %lu of them repeats, %lu stray frames: "
+           "%lu completed\n",
+           messages, cut, frames, repeats, strays, completed);
+    printf("%s\n", s_errors ? "FAILED" : "ok");
+    return s_errors ? 1 : 0;
+}
@@ -0,0 +1,331 @@
+// Round-trips badge images through every img_codec encoding and reports the
+// compression ratio, encode and decode speed and the airtime of the DATA
+// frames that carry the result at the ESP-NOW default rate. The decoder is
+// fed one transfer chunk at a time, as on the badge.
+//
+// Images are binary PBM (P4) files, whose bit order matches the gateway's
+// 1bpp frames; without any a built-in set of 800x480 badge images is used:
+// blank, text, a logo of solid shapes, a dithered photo and noise.
+//
+// Usage: codec_bench [image.pbm ...]
+//
+// Exit status: 0 if every image decoded back to itself, 1 if one did not,
+// 2 on bad usage or unreadable input.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "img_codec.h"
+#include "xfer_proto.h"
+#include "loopback.h"
+
+#define W 800
+#define H 480
+#define STRIDE (W / 8)
+#define MIN_BENCH_NS 50000000LL // each measurement repeats for at least this long
+
+typedef struct
+{
+    const char *name;
+    uint8_t *data;
+    size_t len;
+} image_t;
+
+typedef struct
+{
+    uint8_t *out;
+    size_t len;
+} out_buf_t;
+
+static const char *const enc_names[] = {"raw", "packbits", "lzss"};
+
+static long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void set_px(uint8_t *img, int x, int y)
+{
+    if (x >= 0 && x < W && y >= 0 && y < H)
+    {
+        img[y * STRIDE + x / 8] |= 0x80 >> (x % 8);
+    }
+}
+
+static void fill_rect(uint8_t *img, int x0, int y0, int w, int h)
+{
+    for (int y = y0; y < y0 + h; y++)
+    {
+        for (int x = x0; x < x0 + w; x++)
+        {
+            set_px(img, x, y);
+        }
+    }
+}
+
+// Lines of word-like clusters of glyph stems and bars
+static void draw_text(uint8_t *img, uint32_t *seed)
+{
+    for (int line = 0; line < 8; line++)
+    {
+        int y = 40 + line * 55;
+        int x = 30;
+        while (x < W - 60)
+        {
+            *seed = *seed * 1103515245 + 12345;
+            int letters = 2 + (*seed >> 16) % 8;
+            for (int l = 0; l < letters && x < W - 40; l++)
+            {
+                *seed = *seed * 1103515245 + 12345;
+                int shape = (*seed >> 16) % 4;
+                fill_rect(img, x, y, 5, 36);
+                if (shape != 0)
+                {
+                    fill_rect(img, x, y + (shape - 1) * 15, 18, 5);
+                }
+                if (shape == 3)
+                {
+                    fill_rect(img, x + 14, y, 5, 36);
+                }
+                x += 24;
+            }
+            x += 20;
+        }
+    }
+}
+
+// A ring, a disc and a frame, as in a typical company logo
+static void draw_logo(uint8_t *img)
+{
+    for (int y = 0; y < H; y++)
+    {
+        for (int x = 0; x < W; x++)
+        {
+            int dx = x - 260, dy = y - 240;
+            int r2 = dx * dx + dy * dy;
+            if ((r2 < 180 * 180 && r2 > 140 * 140) || r2 < 80 * 80)
+            {
+                set_px(img, x, y);
+            }
+        }
+    }
+    fill_rect(img, 10, 10, W - 20, 12);
+    fill_rect(img, 10, H - 22, W - 20, 12);
+    fill_rect(img, 480, 140, 260, 60);
+    fill_rect(img, 480, 280, 200, 60);
+}
+
+// Ordered dither of a radial gradient, the worst a real photo gets
+static void draw_dither(uint8_t *img)
+{
+    static const uint8_t bayer[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+    for (int y = 0; y < H; y++)
+    {
+        for (int x = 0; x < W; x++)
+        {
+            int dx = x - W / 2, dy = y - H / 2;
+            int level = (dx * dx + dy * dy) * 16 / (W * W / 4 + H * H / 4);
+            if (level <= bayer[y % 4][x % 4])
+            {
+                set_px(img, x, y);
+            }
+        }
+    }
+}
+
+static image_t builtin(const char *name)
+{
+    image_t im = {.name = name, .data = calloc(1, STRIDE * H), .len = STRIDE * H};
+    uint32_t seed = 42;
+    if (!im.data)
+    {
+        return im;
+    }
+    if (strcmp(name, "text") == 0)
+    {
+        draw_text(im.data, &seed);
+    }
+    else if (strcmp(name, "logo") == 0)
+    {
+        draw_logo(im.data);
+    }
+    else if (strcmp(name, "dither") == 0)
+    {
+        draw_dither(im.data);
+    }
+    else if (strcmp(name, "noise") == 0)
+    {
+        for (size_t i = 0; i < im.len; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            im.data[i] = (uint8_t)(seed >> 16);
+        }
+    }
+    return im;
+}
+
+static bool skip_pbm_space(FILE *f)
+{
+    int c = fgetc(f);
+    while (c == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n')
+    {
+        if (c == '#')
+        {
+            while (c != '\n' && c != EOF)
+            {
+                c = fgetc(f);
+            }
+        }
+        c = fgetc(f);
+    }
+    return c != EOF && ungetc(c, f) != EOF;
+}
+
+static image_t load_pbm(const char *path)
+{
+    image_t im = {.name = path};
+    FILE *f = fopen(path, "rb");
+    int w = 0, h = 0;
+    if (!f)
+    {
+        perror(path);
+        return im;
+    }
+    if (fgetc(f) != 'P' || fgetc(f) != '4' || !skip_pbm_space(f) || fscanf(f, "%d", &w) != 1 ||
+        !skip_pbm_space(f) || fscanf(f, "%d", &h) != 1 || fgetc(f) == EOF || w <= 0 || h <= 0)
+    {
+        fprintf(stderr, "%s: not a binary PBM file\n", path);
+        fclose(f);
+        return im;
+    }
+    im.len = (size_t)(w + 7) / 8 * h;
+    im.data = malloc(im.len);
+    if (!im.data || fread(im.data, 1, im.len, f) != im.len)
+    {
+        fprintf(stderr, "%s: truncated\n", path);
+        free(im.data);
+        im.data = NULL;
+    }
+    fclose(f);
+    return im;
+}
+
+static void collect(void *ctx, const uint8_t *data, size_t len)
+{
+    out_buf_t *o = ctx;
+    memcpy(o->out + o->len, data, len);
+    o->len += len;
+}
+
+static bool decode(img_enc_t enc, const uint8_t *src, size_t src_len, out_buf_t *o, size_t raw_len)
+{
+    static img_decoder_t d;
+    o->len = 0;
+    img_decoder_init(&d, enc, raw_len, collect, o);
+    for (size_t off = 0; off < src_len; off += XFER_CHUNK_MAX)
+    {
+        size_t n = src_len - off < XFER_CHUNK_MAX ? src_len - off : XFER_CHUNK_MAX;
+        if (!img_decoder_feed(&d, src + off, n))
+        {
+            return false;
+        }
+    }
+    return img_decoder_done(&d);
+}
+
+// Airtime of the DATA frames of one clean unicast transfer
+static double data_airtime_ms(const loopback_t *lb, size_t len)
+{
+    uint64_t us = 0;
+    for (size_t off = 0; off < len; off += XFER_CHUNK_MAX)
+    {
+        size_t n = len - off < XFER_CHUNK_MAX ? len - off : XFER_CHUNK_MAX;
+        us += loopback_airtime_us(lb, XFER_HDR_LEN + n, true);
+    }
+    return us / 1000.0;
+}
+
+// Returns false if the image did not survive the round trip.
+static bool bench(const image_t *im, const loopback_t *lb)
+{
+    size_t cap = im->len * 2 + 64;
+    uint8_t *enc_buf = malloc(cap);
+    out_buf_t o = {.out = malloc(im->len)};
+    bool ok = enc_buf && o.out;
+    size_t best = im->len;
+    const char *best_name = enc_names[IMG_ENC_RAW];
+    for (int e = IMG_ENC_RAW; ok && e <= IMG_ENC_LZSS; e++)
+    {
+        int reps = 0;
+        size_t n = 0;
+        long long t0 = now_ns(), t;
+        do
+        {
+            n = img_encode((img_enc_t)e, im->data, im->len, enc_buf, cap);
+            reps++;
+        } while ((t = now_ns() - t0) < MIN_BENCH_NS && n > 0);
+        double enc_mbs = (double)im->len * reps / t * 1000.0;
+        if (n == 0)
+        {
+            printf("%-10s %-9s encoding failed\n", im->name, enc_names[e]);
+            ok = false;
+            break;
+        }
+
+        reps = 0;
+        bool same = true;
+        t0 = now_ns();
+        do
+        {
+            same = decode((img_enc_t)e, enc_buf, n, &o, im->len) && memcmp(o.out, im->data, im->len) == 0;
+            reps++;
+        } while ((t = now_ns() - t0) < MIN_BENCH_NS && same);
+        double dec_mbs = (double)im->len * reps / t * 1000.0;
+        if (!same)
+        {
+            printf("%-10s %-9s round trip FAILED\n", im->name, enc_names[e]);
+            ok = false;
+            break;
+        }
+        if (n < best)
+        {
+            best = n;
+            best_name = enc_names[e];
+        }
+        printf("%-10s %-9s %7zu  %5.1f%%  %8.1f  %8.1f  %6.0f  %7.1f\n", im->name, enc_names[e], n,
+               n * 100.0 / im->len, enc_mbs, dec_mbs, (double)XFER_CHUNK_COUNT(n), data_airtime_ms(lb, n));
+    }
+    if (ok)
+    {
+        printf("%-10s sent as %s\n", im->name, best_name);
+    }
+    free(enc_buf);
+    free(o.out);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *const builtins[] = {"blank", "text", "logo", "dither", "noise"};
+    loopback_t lb;
+    loopback_hooks_t hooks = {0};
+    loopback_init(&lb, 2, 0, 1, &hooks);
+
+    int count = argc > 1 ? argc - 1 : (int)(sizeof(builtins) / sizeof(builtins[0]));
+    printf("image      encoding    bytes  ratio  enc MB/s  dec MB/s  chunks  air ms\n");
+    bool ok = true;
+    for (int i = 0; i < count; i++)
+    {
+        image_t im = argc > 1 ? load_pbm(argv[i + 1]) : builtin(builtins[i]);
+        if (!im.data)
+        {
+            return 2;
+        }
+        ok &= bench(&im, &lb);
+        free(im.data);
+    }
+    return ok ? 0 : 1;
+}
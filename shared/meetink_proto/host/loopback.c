@@ -0,0 +1,131 @@
+#include "loopback.h"
+#include <string.h>
+
+// 802.11b long preamble and PLCP header, always at 1 Mbit/s
+#define PREAMBLE_US 192
+// DIFS plus the mean backoff of an idle channel (CWmin 15, 20 us slots)
+#define ACCESS_US (50 + 15 * 20 / 2)
+// SIFS, then a 14-byte ACK with its own preamble at 1 Mbit/s
+#define ACK_US (10 + PREAMBLE_US + 14 * 8)
+// MAC header, action category, OUI, random value, vendor element header, FCS
+#define FRAME_OVERHEAD (24 + 1 + 3 + 4 + 7 + 4)
+
+static uint32_t next_rand(loopback_t *lb)
+{
+    // xorshift32
+    uint32_t x = lb->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    lb->rng = x;
+    return x;
+}
+
+static bool lose(loopback_t *lb)
+{
+    return (next_rand(lb) >> 8) < lb->loss;
+}
+
+static bool asleep(loopback_t *lb, int node)
+{
+    if (!lb->hooks.listening || lb->hooks.listening(lb->hooks.ctx, node))
+    {
+        return false;
+    }
+    lb->stats.asleep++;
+    return true;
+}
+
+void loopback_init(loopback_t *lb, int nodes, double loss, uint32_t seed, const loopback_hooks_t *hooks)
+{
+    memset(lb, 0, sizeof(*lb));
+    lb->hooks = *hooks;
+    lb->nodes = nodes;
+    lb->loss = (uint32_t)(loss * (1 << 24));
+    lb->rate_kbps = LOOPBACK_RATE_KBPS;
+    lb->rng = seed ? seed : 1;
+}
+
+uint32_t loopback_airtime_us(const loopback_t *lb, size_t len, bool unicast)
+{
+    uint32_t bits = (uint32_t)(FRAME_OVERHEAD + len) * 8;
+    uint32_t us = ACCESS_US + PREAMBLE_US + (bits * 1000 + lb->rate_kbps - 1) / lb->rate_kbps;
+    return unicast ? us + ACK_US : us;
+}
+
+int loopback_send(loopback_t *lb, int from, int to, const uint8_t *frame, size_t len)
+{
+    if (lb->count == LOOPBACK_QUEUE || len > LOOPBACK_FRAME_MAX)
+    {
+        return -1;
+    }
+    loopback_frame_t *f = &lb->queue[(lb->head + lb->count) % LOOPBACK_QUEUE];
+    uint32_t airtime = loopback_airtime_us(lb, len, to != LOOPBACK_BROADCAST);
+    uint64_t start = (lb->busy_until_us > lb->now_us) ? lb->busy_until_us : lb->now_us;
+    f->from = from;
+    f->to = to;
+    f->len = (uint8_t)len;
+    f->end_us = start + airtime;
+    memcpy(f->data, frame, len);
+    lb->busy_until_us = f->end_us;
+    lb->count++;
+    lb->stats.frames++;
+    lb->stats.bytes += len;
+    lb->stats.airtime_us += airtime;
+    return 0;
+}
+
+void loopback_run(loopback_t *lb, uint64_t now_us)
+{
+    while (lb->count > 0 && lb->queue[lb->head].end_us <= now_us)
+    {
+        // Copied out: the hooks may queue frames into the slot it frees
+        loopback_frame_t f = lb->queue[lb->head];
+        lb->head = (lb->head + 1) % LOOPBACK_QUEUE;
+        lb->count--;
+        lb->now_us = f.end_us;
+
+        bool ok = true;
+        if (f.to == LOOPBACK_BROADCAST)
+        {
+            for (int n = 0; n < lb->nodes; n++)
+            {
+                if (n == f.from || asleep(lb, n))
+                {
+                    continue;
+                }
+                if (lose(lb))
+                {
+                    lb->stats.lost++;
+                }
+                else
+                {
+                    lb->hooks.deliver(lb->hooks.ctx, n, f.from, f.data, f.len);
+                }
+            }
+        }
+        else if (asleep(lb, f.to))
+        {
+            ok = false;
+        }
+        else if (lose(lb))
+        {
+            lb->stats.lost++;
+            ok = false;
+        }
+        else
+        {
+            lb->hooks.deliver(lb->hooks.ctx, f.to, f.from, f.data, f.len);
+            if (lose(lb))
+            {
+                lb->stats.acks_lost++;
+                ok = false;
+            }
+        }
+        lb->hooks.sent(lb->hooks.ctx, f.from, f.to, ok);
+    }
+    if (now_us > lb->now_us)
+    {
+        lb->now_us = now_us;
+    }
+}
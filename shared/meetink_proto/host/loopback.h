@@ -0,0 +1,92 @@
+#ifndef LOOPBACK_H
+#define LOOPBACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Simulated ESP-NOW channel for the host benchmarks.
+ *
+ * Node 0 is the gateway, nodes 1.. are badges. Frames share one medium and go
+ * out one after the other at the configured rate, each taking the airtime of a
+ * real ESP-NOW action frame: channel access, PLCP preamble, MAC and vendor
+ * headers, payload and, for unicast, the MAC-layer ACK. Every delivery is lost
+ * independently with the configured probability, as is every ACK, so a
+ * unicast frame can arrive while its sender is told it failed. Broadcasts are
+ * never acknowledged and always reported as sent. A node whose radio is off
+ * misses every frame that ends meanwhile and acknowledges none. MAC-layer
+ * retries are not modelled: the protocol has to recover from every loss itself.
+ *
+ * The clock is the caller's: loopback_run() delivers everything whose airtime
+ * ended by the given time, calling the hooks in the order it happened.
+ */
+
+#define LOOPBACK_BROADCAST (-1)
+#define LOOPBACK_FRAME_MAX 250 // ESP_NOW_MAX_DATA_LEN
+#define LOOPBACK_QUEUE 128     // frames waiting for the medium, all nodes together
+#define LOOPBACK_RATE_KBPS 1000 // ESP-NOW default PHY rate
+
+typedef struct
+{
+    // Frame from node from arrived at node to.
+    void (*deliver)(void *ctx, int to, int from, const uint8_t *frame, size_t len);
+    // Send callback of node from for a frame to to (LOOPBACK_BROADCAST or a node).
+    void (*sent)(void *ctx, int from, int to, bool ok);
+    // Optional: false while node has its radio off, so it neither receives
+    // nor acknowledges. NULL: every node always listens.
+    bool (*listening)(void *ctx, int node);
+    void *ctx;
+} loopback_hooks_t;
+
+typedef struct
+{
+    uint32_t frames;     // frames put on the air
+    uint32_t bytes;      // payload bytes of those frames
+    uint32_t lost;       // deliveries lost, counted per receiver
+    uint32_t acks_lost;  // unicast frames delivered but reported as failed
+    uint32_t asleep;     // deliveries missed because the receiver was not listening
+    uint64_t airtime_us; // time the medium was busy
+} loopback_stats_t;
+
+typedef struct
+{
+    int from;
+    int to;
+    uint8_t len;
+    uint64_t end_us;
+    uint8_t data[LOOPBACK_FRAME_MAX];
+} loopback_frame_t;
+
+typedef struct
+{
+    loopback_hooks_t hooks;
+    int nodes;
+    uint32_t loss;      // per delivery, in 1/2^24
+    uint32_t rate_kbps;
+    uint32_t rng;
+    uint64_t now_us;
+    uint64_t busy_until_us;
+    loopback_frame_t queue[LOOPBACK_QUEUE];
+    int head;
+    int count;
+    loopback_stats_t stats;
+} loopback_t;
+
+// An idle channel shared by the given number of nodes, at LOOPBACK_RATE_KBPS
+// and losing the given share (0..1) of deliveries; the same seed gives the
+// same losses.
+void loopback_init(loopback_t *lb, int nodes, double loss, uint32_t seed, const loopback_hooks_t *hooks);
+
+// Queues one frame for the medium. Returns 0, or -1 if the queue is full or
+// the frame too long, like a refused esp_now_send().
+int loopback_send(loopback_t *lb, int from, int to, const uint8_t *frame, size_t len);
+
+// Advances the clock to now_us, delivering every frame whose airtime ended by
+// then. Hooks may send again; those frames queue behind the ones on the air.
+void loopback_run(loopback_t *lb, uint64_t now_us);
+
+// Airtime of one frame with len payload bytes.
+uint32_t loopback_airtime_us(const loopback_t *lb, size_t len, bool unicast);
+
+#endif // LOOPBACK_H
@@ -0,0 +1,316 @@
+// Sends one image to a growing number of badges over the simulated ESP-NOW
+// channel of loopback.c, once with xfer_mtx as a single broadcast transfer
+// and once with xfer_tx as one unicast transfer per badge, and reports the
+// DATA frames, airtime and time each took at a range of loss rates. Every
+// badge runs its own xfer_rx and loses frames independently. Then the
+// broadcast is repeated with one badge switched off, which never answers
+// the invitation: the others must still get the image.
+//
+// Usage: mcast_sim [-n runs] [-s bytes]
+//
+// Exit status: 0 if every badge that finished got the image intact and every
+// badge still on got it next to a switched-off one, 1 if not, 2 on bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "xfer_tx.h"
+#include "xfer_mtx.h"
+#include "xfer_rx.h"
+#include "loopback.h"
+
+#define GATEWAY 0
+#define TICK_US 100
+#define GIVE_UP_US (600ULL * 1000 * 1000)
+
+static const int badge_counts[] = {2, 5, 10, 20, 32};
+static const double loss_rates[] = {0.01, 0.05, 0.10};
+
+typedef struct
+{
+    xfer_rx_t rx;
+    uint8_t *out;
+    int node;
+} badge_t;
+
+typedef struct
+{
+    loopback_t lb;
+    xfer_mtx_t mtx;
+    xfer_tx_t tx;
+    bool unicast; // running tx instead of mtx
+    int off;      // node of the badge that is switched off, 0 if none
+    int badges;
+    uint32_t len;
+    badge_t badge[XFER_MTX_MAX_RX];
+} sim_t;
+
+typedef struct
+{
+    double frames;  // DATA frames from the gateway
+    double air_ms;  // airtime of every frame, STATUS included
+    double time_ms; // until the last badge finished
+    int delivered;
+    int corrupt;
+} result_t;
+
+static sim_t s_sim;
+
+static int mcast_send(void *ctx, int receiver, const uint8_t *frame, size_t len)
+{
+    sim_t *s = ctx;
+    return loopback_send(&s->lb, GATEWAY, receiver < 0 ? LOOPBACK_BROADCAST : receiver + 1, frame, len);
+}
+
+static int tx_send(void *ctx, const uint8_t *frame, size_t len)
+{
+    badge_t *b = ctx;
+    return loopback_send(&s_sim.lb, GATEWAY, b->node, frame, len);
+}
+
+static int rx_send(void *ctx, const uint8_t *frame, size_t len)
+{
+    badge_t *b = ctx;
+    return loopback_send(&s_sim.lb, b->node, GATEWAY, frame, len);
+}
+
+static bool sink_begin(void *ctx, uint32_t total_len, uint8_t encoding)
+{
+    (void)ctx;
+    (void)encoding;
+    return total_len == s_sim.len;
+}
+
+static void sink_write(void *ctx, uint32_t offset, const uint8_t *data, size_t len)
+{
+    badge_t *b = ctx;
+    memcpy(b->out + offset, data, len);
+}
+
+static void on_deliver(void *ctx, int to, int from, const uint8_t *frame, size_t len)
+{
+    sim_t *s = ctx;
+    uint32_t now = (uint32_t)(s->lb.now_us / 1000);
+    if (s->off && to == s->off)
+    {
+        return;
+    }
+    if (to != GATEWAY)
+    {
+        xfer_rx_handle(&s->badge[to - 1].rx, frame, len);
+    }
+    else if (s->unicast)
+    {
+        xfer_tx_on_status(&s->tx, frame, len, now);
+    }
+    else
+    {
+        xfer_mtx_on_status(&s->mtx, from - 1, frame, len, now);
+    }
+}
+
+static void on_sent(void *ctx, int from, int to, bool ok)
+{
+    sim_t *s = ctx;
+    (void)to;
+    if (from != GATEWAY)
+    {
+        return;
+    }
+    if (s->unicast)
+    {
+        xfer_tx_on_sent(&s->tx, ok);
+    }
+    else
+    {
+        xfer_mtx_on_sent(&s->mtx, ok);
+    }
+}
+
+static void setup(sim_t *s, int badges, double loss, uint32_t seed)
+{
+    loopback_hooks_t hooks = {.deliver = on_deliver, .sent = on_sent, .ctx = s};
+    loopback_init(&s->lb, badges + 1, loss, seed, &hooks);
+    s->badges = badges;
+    for (int i = 0; i < badges; i++)
+    {
+        badge_t *b = &s->badge[i];
+        xfer_link_t link = {.send = rx_send, .ctx = b};
+        xfer_sink_t sink = {.begin = sink_begin, .write = sink_write, .ctx = b};
+        b->node = i + 1;
+        xfer_rx_init(&b->rx, &link, &sink);
+        memset(b->out, 0, s->len);
+    }
+}
+
+static void check(const sim_t *s, const uint8_t *data, result_t *res)
+{
+    for (int i = 0; i < s->badges; i++)
+    {
+        const xfer_rx_t *rx = &s->badge[i].rx;
+        if (!rx->finished || rx->result_flags != XFER_STATUS_DONE)
+        {
+            continue;
+        }
+        if (memcmp(s->badge[i].out, data, s->len) == 0)
+        {
+            res->delivered++;
+        }
+        else
+        {
+            res->corrupt++;
+        }
+    }
+}
+
+static void run_mcast(sim_t *s, const uint8_t *data, int badges, double loss, uint32_t seed, result_t *res)
+{
+    xfer_mlink_t link = {.send = mcast_send, .ctx = s};
+    setup(s, badges, loss, seed);
+    s->unicast = false;
+    xfer_mtx_begin(&s->mtx, &link, (uint8_t)seed, 0, data, s->len, (uint8_t)badges, 0);
+    uint64_t now = 0;
+    while (s->mtx.state == XFER_TX_RUNNING && now < GIVE_UP_US)
+    {
+        loopback_run(&s->lb, now);
+        xfer_mtx_service(&s->mtx, (uint32_t)(now / 1000));
+        now += TICK_US;
+    }
+    res->frames += s->mtx.stats.frames_sent;
+    res->air_ms += s->lb.stats.airtime_us / 1000.0;
+    res->time_ms += now / 1000.0;
+    check(s, data, res);
+}
+
+// The badges one after the other, as the scheduler did before broadcasting
+static void run_unicast(sim_t *s, const uint8_t *data, int badges, double loss, uint32_t seed, result_t *res)
+{
+    setup(s, badges, loss, seed);
+    s->unicast = true;
+    uint64_t now = 0;
+    for (int i = 0; i < badges; i++)
+    {
+        xfer_link_t link = {.send = tx_send, .ctx = &s->badge[i]};
+        xfer_tx_begin(&s->tx, &link, (uint8_t)(seed + i), 0, data, s->len, (uint32_t)(now / 1000));
+        while (s->tx.state == XFER_TX_RUNNING && now < GIVE_UP_US)
+        {
+            loopback_run(&s->lb, now);
+            xfer_tx_service(&s->tx, (uint32_t)(now / 1000));
+            now += TICK_US;
+        }
+        res->frames += s->tx.stats.frames_sent;
+    }
+    // Let the last STATUS frames land
+    loopback_run(&s->lb, UINT64_MAX);
+    res->air_ms += s->lb.stats.airtime_us / 1000.0;
+    res->time_ms += now / 1000.0;
+    check(s, data, res);
+}
+
+int main(int argc, char **argv)
+{
+    int runs = 10;
+    long size = 48000; // one 800x480 1bpp frame
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            runs = atoi(optarg);
+            break;
+        case 's':
+            size = atol(optarg);
+            break;
+        default:
+            runs = 0;
+            break;
+        }
+    }
+    if (runs <= 0 || size <= 0 || size > (long)XFER_CHUNK_MAX * UINT16_MAX || optind != argc)
+    {
+        fprintf(stderr, "usage: %s [-n runs] [-s bytes]\n", argv[0]);
+        return 2;
+    }
+
+    s_sim.len = (uint32_t)size;
+    uint8_t *data = malloc(s_sim.len);
+    bool ok = data != NULL;
+    for (int i = 0; ok && i < XFER_MTX_MAX_RX; i++)
+    {
+        s_sim.badge[i].out = malloc(s_sim.len);
+        ok = s_sim.badge[i].out != NULL;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 2;
+    }
+    uint32_t x = 0x12345678;
+    for (uint32_t i = 0; i < s_sim.len; i++)
+    {
+        x = x * 1103515245 + 12345;
+        data[i] = (uint8_t)(x >> 16);
+    }
+
+    printf("%u bytes in %u chunks, %d kbit/s, %d runs each\n", (unsigned)s_sim.len, XFER_CHUNK_COUNT(s_sim.len),
+           LOOPBACK_RATE_KBPS, runs);
+    printf("                  ------------ broadcast -----------   ------------- unicast ------------\n");
+    printf("loss  badges      frames  air ms  time ms  delivered      frames  air ms  time ms  delivered\n");
+    int corrupt = 0;
+    for (size_t l = 0; l < sizeof(loss_rates) / sizeof(loss_rates[0]); l++)
+    {
+        for (size_t n = 0; n < sizeof(badge_counts) / sizeof(badge_counts[0]); n++)
+        {
+            int badges = badge_counts[n];
+            result_t mc = {0}, uc = {0};
+            for (int r = 0; r < runs; r++)
+            {
+                uint32_t seed = (uint32_t)(100000 * l + 1000 * n + r + 1);
+                run_mcast(&s_sim, data, badges, loss_rates[l], seed, &mc);
+                run_unicast(&s_sim, data, badges, loss_rates[l], seed, &uc);
+            }
+            corrupt += mc.corrupt + uc.corrupt;
+            printf("%3.0f%%  %6d  %10.0f  %6.0f  %7.0f  %5.1f%%     %7.0f  %6.0f  %7.0f  %5.1f%%\n",
+                   loss_rates[l] * 100, badges, mc.frames / runs, mc.air_ms / runs, mc.time_ms / runs,
+                   mc.delivered * 100.0 / (runs * badges), uc.frames / runs, uc.air_ms / runs, uc.time_ms / runs,
+                   uc.delivered * 100.0 / (runs * badges));
+        }
+    }
+
+    // Each count at 1% loss, the last badge switched off
+    printf("\none badge switched off, 1%% loss\n");
+    printf("badges      frames  time ms  delivered\n");
+    int missed = 0;
+    for (size_t n = 0; n < sizeof(badge_counts) / sizeof(badge_counts[0]); n++)
+    {
+        int badges = badge_counts[n];
+        result_t mc = {0};
+        for (int r = 0; r < runs; r++)
+        {
+            s_sim.off = badges;
+            run_mcast(&s_sim, data, badges, 0.01, (uint32_t)(1000 * n + r + 1), &mc);
+            s_sim.off = 0;
+        }
+        corrupt += mc.corrupt;
+        missed += runs * (badges - 1) - mc.delivered;
+        printf("%6d  %10.0f  %7.0f  %3d/%d\n", badges, mc.frames / runs, mc.time_ms / runs, mc.delivered,
+               runs * (badges - 1));
+    }
+    if (missed)
+    {
+        fprintf(stderr, "%d badges missed the image next to a switched-off one\n", missed);
+    }
+    if (corrupt)
+    {
+        fprintf(stderr, "%d badges got a corrupted image\n", corrupt);
+    }
+
+    for (int i = 0; i < XFER_MTX_MAX_RX; i++)
+    {
+        free(s_sim.badge[i].out);
+    }
+    free(data);
+    return (corrupt || missed) ? 1 : 0;
+}
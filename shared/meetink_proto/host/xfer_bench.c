@@ -0,0 +1,202 @@
+// Sends an image from xfer_tx to xfer_rx over the simulated ESP-NOW channel
+// of loopback.c at a range of loss rates and reports how long it took, the
+// goodput and how many frames and retransmissions it needed. For comparison
+// it also shows the fixed 10 ms pacing the protocol replaced, which took
+// that long whatever the channel and lost the image on any dropped frame.
+//
+// Usage: xfer_bench [-n runs] [-s bytes]
+//
+// Exit status: 0 if every finished transfer delivered the image intact, 1 if
+// one did not, 2 on bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "xfer_tx.h"
+#include "xfer_rx.h"
+#include "loopback.h"
+
+#define GATEWAY 0
+#define BADGE 1
+#define TICK_US 100
+#define GIVE_UP_US (60ULL * 1000 * 1000)
+#define PACED_CHUNK 250 // payload of one frame in the paced sender
+#define PACED_MS 10     // its delay between frames
+
+static const double loss_rates[] = {0.0, 0.01, 0.02, 0.05, 0.10, 0.20, 0.30};
+
+typedef struct
+{
+    loopback_t lb;
+    xfer_tx_t tx;
+    xfer_rx_t rx;
+    uint8_t *out;
+    uint32_t out_len;
+} bench_t;
+
+static bench_t s_bench;
+
+static int tx_send(void *ctx, const uint8_t *frame, size_t len)
+{
+    bench_t *b = ctx;
+    return loopback_send(&b->lb, GATEWAY, BADGE, frame, len);
+}
+
+static int rx_send(void *ctx, const uint8_t *frame, size_t len)
+{
+    bench_t *b = ctx;
+    return loopback_send(&b->lb, BADGE, GATEWAY, frame, len);
+}
+
+static bool sink_begin(void *ctx, uint32_t total_len, uint8_t encoding)
+{
+    bench_t *b = ctx;
+    (void)encoding;
+    return total_len == b->out_len;
+}
+
+static void sink_write(void *ctx, uint32_t offset, const uint8_t *data, size_t len)
+{
+    bench_t *b = ctx;
+    memcpy(b->out + offset, data, len);
+}
+
+static void on_deliver(void *ctx, int to, int from, const uint8_t *frame, size_t len)
+{
+    bench_t *b = ctx;
+    (void)from;
+    if (to == BADGE)
+    {
+        xfer_rx_handle(&b->rx, frame, len);
+    }
+    else
+    {
+        xfer_tx_on_status(&b->tx, frame, len, (uint32_t)(b->lb.now_us / 1000));
+    }
+}
+
+static void on_sent(void *ctx, int from, int to, bool ok)
+{
+    bench_t *b = ctx;
+    (void)to;
+    if (from == GATEWAY)
+    {
+        xfer_tx_on_sent(&b->tx, ok);
+    }
+}
+
+// One transfer; returns the simulated time it took in microseconds.
+static uint64_t run_one(bench_t *b, const uint8_t *data, uint32_t len, double loss, uint32_t seed)
+{
+    loopback_hooks_t hooks = {.deliver = on_deliver, .sent = on_sent, .ctx = b};
+    xfer_link_t tx_link = {.send = tx_send, .ctx = b};
+    xfer_link_t rx_link = {.send = rx_send, .ctx = b};
+    xfer_sink_t sink = {.begin = sink_begin, .write = sink_write, .ctx = b};
+
+    loopback_init(&b->lb, 2, loss, seed, &hooks);
+    xfer_rx_init(&b->rx, &rx_link, &sink);
+    memset(b->out, 0, len);
+    b->out_len = len;
+    xfer_tx_begin(&b->tx, &tx_link, (uint8_t)seed, 0, data, len, 0);
+
+    uint64_t now = 0;
+    while (b->tx.state == XFER_TX_RUNNING && now < GIVE_UP_US)
+    {
+        loopback_run(&b->lb, now);
+        xfer_tx_service(&b->tx, (uint32_t)(now / 1000));
+        now += TICK_US;
+    }
+    return now;
+}
+
+int main(int argc, char **argv)
+{
+    int runs = 20;
+    long size = 48000; // one 800x480 1bpp frame
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            runs = atoi(optarg);
+            break;
+        case 's':
+            size = atol(optarg);
+            break;
+        default:
+            runs = 0;
+            break;
+        }
+    }
+    if (runs <= 0 || size <= 0 || size > (long)XFER_CHUNK_MAX * UINT16_MAX || optind != argc)
+    {
+        fprintf(stderr, "usage: %s [-n runs] [-s bytes]\n", argv[0]);
+        return 2;
+    }
+
+    uint32_t len = (uint32_t)size;
+    uint8_t *data = malloc(len);
+    s_bench.out = malloc(len);
+    if (!data || !s_bench.out)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 2;
+    }
+    uint32_t x = 0x12345678;
+    for (uint32_t i = 0; i < len; i++)
+    {
+        x = x * 1103515245 + 12345;
+        data[i] = (uint8_t)(x >> 16);
+    }
+
+    uint32_t paced_frames = (len + PACED_CHUNK - 1) / PACED_CHUNK;
+    printf("%u bytes in %u chunks, %d kbit/s, %d runs per loss rate\n", (unsigned)len,
+           XFER_CHUNK_COUNT(len), LOOPBACK_RATE_KBPS, runs);
+    printf("loss  done   time ms  kB/s  frames  retx  timeouts  airtime ms | paced ms  intact\n");
+
+    bool corrupt = false;
+    for (size_t l = 0; l < sizeof(loss_rates) / sizeof(loss_rates[0]); l++)
+    {
+        double loss = loss_rates[l];
+        int done = 0;
+        uint64_t time_us = 0;
+        uint64_t frames = 0, retx = 0, timeouts = 0, airtime_us = 0;
+        for (int r = 0; r < runs; r++)
+        {
+            uint64_t t = run_one(&s_bench, data, len, loss, 1000 * (uint32_t)l + (uint32_t)r + 1);
+            frames += s_bench.tx.stats.frames_sent;
+            retx += s_bench.tx.stats.retransmits;
+            timeouts += s_bench.tx.stats.timeouts;
+            airtime_us += s_bench.lb.stats.airtime_us;
+            if (s_bench.tx.state != XFER_TX_DONE)
+            {
+                continue;
+            }
+            if (memcmp(s_bench.out, data, len) != 0)
+            {
+                fprintf(stderr, "loss %.0f%% run %d: image corrupted\n", loss * 100, r);
+                corrupt = true;
+                continue;
+            }
+            done++;
+            time_us += t;
+        }
+
+        // The paced sender lost the image as soon as one of its frames was lost
+        double intact = 1.0;
+        for (uint32_t i = 0; i < paced_frames; i++)
+        {
+            intact *= 1.0 - loss;
+        }
+        double ms = done ? time_us / 1000.0 / done : 0;
+        printf("%3.0f%%  %3d/%-3d %7.0f  %4.0f  %6.0f  %4.0f  %8.1f  %10.0f | %8u  %5.1f%%\n", loss * 100, done, runs,
+               ms, ms > 0 ? len / ms : 0, (double)frames / runs, (double)retx / runs, (double)timeouts / runs,
+               airtime_us / 1000.0 / runs, (unsigned)(paced_frames * PACED_MS), intact * 100);
+    }
+
+    free(data);
+    free(s_bench.out);
+    return corrupt ? 1 : 0;
+}
@@ -0,0 +1,330 @@
+#include "img_codec.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* ── Encoders ─────────────────────────────────────────────────────────── */
+
+static size_t packbits_encode(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+    size_t i = 0, o = 0;
+    while (i < len)
+    {
+        // Length of the run starting at i
+        size_t run = 1;
+        while (i + run < len && run < 128 && src[i + run] == src[i])
+        {
+            run++;
+        }
+        if (run >= 2)
+        {
+            if (o + 2 > cap)
+            {
+                return 0;
+            }
+            dst[o++] = (uint8_t)(257 - run); // -(run-1)
+            dst[o++] = src[i];
+            i += run;
+            continue;
+        }
+
+        // Literal block: stop before the next run of 2+ equal bytes
+        size_t lit = 1;
+        while (i + lit < len && lit < 128 &&
+               !(i + lit + 1 < len && src[i + lit] == src[i + lit + 1]))
+        {
+            lit++;
+        }
+        if (o + 1 + lit > cap)
+        {
+            return 0;
+        }
+        dst[o++] = (uint8_t)(lit - 1);
+        memcpy(dst + o, src + i, lit);
+        o += lit;
+        i += lit;
+    }
+    return o;
+}
+
+typedef struct
+{
+    uint8_t *dst;
+    size_t cap;
+    size_t pos;
+    uint32_t acc;
+    uint8_t bits;
+    bool overflow;
+} bit_writer_t;
+
+static void put_bits(bit_writer_t *w, uint32_t value, uint8_t count)
+{
+    w->acc = (w->acc << count) | (value & ((1UL << count) - 1));
+    w->bits += count;
+    while (w->bits >= 8)
+    {
+        w->bits -= 8;
+        if (w->pos >= w->cap)
+        {
+            w->overflow = true;
+            return;
+        }
+        w->dst[w->pos++] = (uint8_t)(w->acc >> w->bits);
+    }
+}
+
+#define LZ_HASH_BITS 12
+#define LZ_HASH_SIZE (1 << LZ_HASH_BITS)
+#define LZ_MAX_CHAIN 48
+#define LZ_NIL 0xFFFFFFFFu
+
+static inline uint32_t lz_hash(const uint8_t *p)
+{
+    return ((uint32_t)p[0] * 2654435761u ^ (uint32_t)p[1] << 8 ^ p[2]) & (LZ_HASH_SIZE - 1);
+}
+
+static size_t lzss_encode(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+    // Hash chains over the sliding window: head per hash, prev per window slot
+    uint32_t *head = malloc(LZ_HASH_SIZE * sizeof(uint32_t));
+    uint32_t *prev = malloc(IMG_LZ_WINDOW * sizeof(uint32_t));
+    if (!head || !prev)
+    {
+        free(head);
+        free(prev);
+        return 0;
+    }
+    memset(head, 0xFF, LZ_HASH_SIZE * sizeof(uint32_t));
+
+    bit_writer_t w = {.dst = dst, .cap = cap};
+    size_t i = 0;
+    while (i < len && !w.overflow)
+    {
+        size_t best_len = 0, best_dist = 0;
+        if (i + IMG_LZ_MIN_MATCH <= len)
+        {
+            size_t max = len - i;
+            if (max > IMG_LZ_MAX_MATCH)
+            {
+                max = IMG_LZ_MAX_MATCH;
+            }
+            uint32_t cand = head[lz_hash(src + i)];
+            for (int chain = 0; cand != LZ_NIL && chain < LZ_MAX_CHAIN; chain++)
+            {
+                size_t dist = i - cand;
+                if (dist == 0 || dist > IMG_LZ_WINDOW)
+                {
+                    break;
+                }
+                size_t l = 0;
+                // Overlapping matches (dist < length) are fine, the decoder copies byte by byte
+                while (l < max && src[cand + l] == src[i + l])
+                {
+                    l++;
+                }
+                if (l > best_len)
+                {
+                    best_len = l;
+                    best_dist = dist;
+                    if (l == max)
+                    {
+                        break;
+                    }
+                }
+                cand = prev[cand % IMG_LZ_WINDOW];
+            }
+        }
+
+        size_t step;
+        if (best_len >= IMG_LZ_MIN_MATCH)
+        {
+            put_bits(&w, 0, 1);
+            put_bits(&w, (uint32_t)(best_dist - 1), IMG_LZ_WINDOW_BITS);
+            put_bits(&w, (uint32_t)(best_len - IMG_LZ_MIN_MATCH), IMG_LZ_LEN_BITS);
+            step = best_len;
+        }
+        else
+        {
+            put_bits(&w, 0x100 | src[i], 9);
+            step = 1;
+        }
+
+        // Index every position we step over
+        for (size_t k = 0; k < step; k++, i++)
+        {
+            if (i + IMG_LZ_MIN_MATCH <= len)
+            {
+                uint32_t h = lz_hash(src + i);
+                prev[i % IMG_LZ_WINDOW] = head[h];
+                head[h] = (uint32_t)i;
+            }
+        }
+    }
+    if (w.bits > 0 && !w.overflow)
+    {
+        put_bits(&w, 0, 8 - w.bits); // pad the last byte
+    }
+
+    free(head);
+    free(prev);
+    return w.overflow ? 0 : w.pos;
+}
+
+size_t img_encode(img_enc_t enc, const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+    switch (enc)
+    {
+    case IMG_ENC_RAW:
+        if (len > cap)
+        {
+            return 0;
+        }
+        memcpy(dst, src, len);
+        return len;
+    case IMG_ENC_PACKBITS:
+        return packbits_encode(src, len, dst, cap);
+    case IMG_ENC_LZSS:
+        return lzss_encode(src, len, dst, cap);
+    }
+    return 0;
+}
+
+/* ── Streaming decoder ────────────────────────────────────────────────── */
+
+static void flush(img_decoder_t *d)
+{
+    if (d->batch_len)
+    {
+        d->out(d->ctx, d->batch, d->batch_len);
+        d->batch_len = 0;
+    }
+}
+
+static inline bool emit(img_decoder_t *d, uint8_t b)
+{
+    if (d->produced >= d->raw_len)
+    {
+        d->error = true;
+        return false;
+    }
+    d->window[d->wpos] = b;
+    d->wpos = (d->wpos + 1) & (IMG_LZ_WINDOW - 1);
+    d->batch[d->batch_len++] = b;
+    d->produced++;
+    if (d->batch_len == IMG_DEC_BATCH)
+    {
+        flush(d);
+    }
+    return true;
+}
+
+void img_decoder_init(img_decoder_t *d, img_enc_t enc, uint32_t raw_len, img_out_fn out, void *ctx)
+{
+    memset(d, 0, sizeof(*d));
+    d->enc = enc;
+    d->raw_len = raw_len;
+    d->out = out;
+    d->ctx = ctx;
+}
+
+static void packbits_feed(img_decoder_t *d, const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len && !d->error; i++)
+    {
+        uint8_t b = data[i];
+        if (!d->have_header)
+        {
+            int8_t n = (int8_t)b;
+            if (n == -128)
+            {
+                continue; // no-op
+            }
+            d->run = (n >= 0) ? (int16_t)(n + 1) : (int16_t)(n - 1); // literals: +count, repeat: -count
+            d->have_header = true;
+        }
+        else if (d->run > 0)
+        {
+            emit(d, b);
+            if (--d->run == 0)
+            {
+                d->have_header = false;
+            }
+        }
+        else
+        {
+            for (int16_t k = d->run; k < 0 && emit(d, b); k++)
+            {
+            }
+            d->have_header = false;
+        }
+    }
+}
+
+static void lzss_feed(img_decoder_t *d, const uint8_t *data, size_t len)
+{
+    const uint8_t ref_bits = 1 + IMG_LZ_WINDOW_BITS + IMG_LZ_LEN_BITS;
+    for (size_t i = 0; i < len && !d->error && d->produced < d->raw_len; i++)
+    {
+        d->bitbuf = (d->bitbuf << 8) | data[i];
+        d->bitcount += 8;
+
+        while (d->bitcount > 0 && d->produced < d->raw_len && !d->error)
+        {
+            bool literal = (d->bitbuf >> (d->bitcount - 1)) & 1;
+            uint8_t need = literal ? 9 : ref_bits;
+            if (d->bitcount < need)
+            {
+                break;
+            }
+            d->bitcount -= need;
+            uint32_t token = (d->bitbuf >> d->bitcount) & ((1UL << (need - 1)) - 1);
+            if (literal)
+            {
+                emit(d, (uint8_t)token);
+                continue;
+            }
+            uint16_t dist = (token >> IMG_LZ_LEN_BITS) + 1;
+            uint16_t count = (token & ((1 << IMG_LZ_LEN_BITS) - 1)) + IMG_LZ_MIN_MATCH;
+            if (dist > d->produced)
+            {
+                d->error = true; // reference before the start of the image
+                break;
+            }
+            uint16_t from = (d->wpos - dist) & (IMG_LZ_WINDOW - 1);
+            while (count-- && emit(d, d->window[from]))
+            {
+                from = (from + 1) & (IMG_LZ_WINDOW - 1);
+            }
+        }
+    }
+}
+
+bool img_decoder_feed(img_decoder_t *d, const uint8_t *data, size_t len)
+{
+    if (d->error)
+    {
+        return false;
+    }
+    switch (d->enc)
+    {
+    case IMG_ENC_RAW:
+        if (d->produced + len > d->raw_len)
+        {
+            d->error = true;
+            return false;
+        }
+        d->out(d->ctx, data, len);
+        d->produced += len;
+        return true;
+    case IMG_ENC_PACKBITS:
+        packbits_feed(d, data, len);
+        break;
+    case IMG_ENC_LZSS:
+        lzss_feed(d, data, len);
+        break;
+    default:
+        d->error = true;
+        break;
+    }
+    flush(d);
+    return !d->error;
+}
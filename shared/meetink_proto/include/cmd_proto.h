@@ -0,0 +1,139 @@
+#ifndef CMD_PROTO_H
+#define CMD_PROTO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Badge commands (gateway -> badge).
+ *
+ *   FRAG   gateway -> badge   cmd_frag_hdr_t + up to CMD_FRAG_MAX bytes
+ *
+ * A command message is a sequence of TLV fields: tag (1 byte), length
+ * (1 byte), value. Messages longer than one frame are split into fragments
+ * that share a msg_id; the badge reassembles them in a fixed buffer and acts
+ * once all have arrived, so a message is applied whole or not at all. A
+ * fragment of another msg_id restarts reassembly, which is how a newer
+ * update replaces one that is still incomplete. Fields a badge does not know
+ * are skipped; incompatible changes bump CMD_VERSION instead.
+ *
+ * Images are not commands: they use the windowed transfer of xfer_proto.h.
+ * Badges still accept the older JSON text frames ('{' first), which are
+ * handy for debugging from any ESP-NOW sender.
+ *
+ * All multi-byte fields are little-endian (native on ESP32 and x86 hosts).
+ */
+
+#define CMD_MAGIC 0xBA
+#define CMD_VERSION 1
+#define CMD_FRAME_MAX 250 // ESP_NOW_MAX_DATA_LEN
+#define CMD_MSG_MAX 1024  // longest message, all fragments together
+#define CMD_FIELD_MAX 255 // longest field value
+
+    typedef enum
+    {
+        CMD_PKT_FRAG = 0x01,
+    } cmd_pkt_type_t;
+
+    typedef enum
+    {
+        CMD_TAG_CLEAR = 0x01,      // blank the screen, no value
+        CMD_TAG_FIRST_NAME = 0x10, // UTF-8 text lines of the name screen
+        CMD_TAG_LAST_NAME = 0x11,
+        CMD_TAG_INFO = 0x12,
+        CMD_TAG_RESTART = 0x20,    // config: restart the badge, no value
+    } cmd_tag_t;
+
+    typedef struct __attribute__((packed))
+    {
+        uint8_t magic;      // CMD_MAGIC
+        uint8_t type;       // CMD_PKT_FRAG
+        uint8_t version;    // CMD_VERSION
+        uint8_t msg_id;     // same for every fragment of a message
+        uint8_t index;      // fragment number, 0-based
+        uint8_t count;      // fragments in the message
+        uint16_t total_len; // message length
+    } cmd_frag_hdr_t;
+
+#define CMD_HDR_LEN (sizeof(cmd_frag_hdr_t))
+#define CMD_FRAG_MAX (CMD_FRAME_MAX - CMD_HDR_LEN) // message bytes per fragment
+
+    /** One TLV field; value points into the message and is not NUL-terminated. */
+    typedef struct
+    {
+        uint8_t tag;
+        uint8_t len;
+        const uint8_t *value;
+    } cmd_field_t;
+
+    /** True when @p data looks like a command frame of @p type. */
+    static inline bool cmd_is_frame(const uint8_t *data, size_t len, uint8_t type)
+    {
+        return len >= 2 && data[0] == CMD_MAGIC && data[1] == type;
+    }
+
+    /** Fragments needed for a message of @p msg_len bytes. */
+    static inline uint8_t cmd_frag_count(size_t msg_len)
+    {
+        return msg_len == 0 ? 1 : (uint8_t)((msg_len + CMD_FRAG_MAX - 1) / CMD_FRAG_MAX);
+    }
+
+    /**
+     * Append a field to the message in @p msg (capacity @p cap, @p *len bytes
+     * used so far). Returns false, leaving the message unchanged, if it does
+     * not fit.
+     */
+    bool cmd_put(uint8_t *msg, size_t cap, size_t *len, uint8_t tag, const void *value, size_t value_len);
+
+    /**
+     * Build fragment @p index of a message into @p frame (CMD_FRAME_MAX
+     * bytes). Returns the frame length, 0 if @p index is out of range.
+     */
+    size_t cmd_frag(uint8_t *frame, const uint8_t *msg, size_t msg_len, uint8_t msg_id, uint8_t index);
+
+    /**
+     * Step through the fields of a message: start with @p *pos = 0. Returns
+     * false at the end or on a truncated field.
+     */
+    bool cmd_next(const uint8_t *msg, size_t msg_len, size_t *pos, cmd_field_t *field);
+
+    typedef enum
+    {
+        CMD_RX_IGNORED,  // not a fragment, malformed, or repeated
+        CMD_RX_PROGRESS, // fragment stored, message incomplete
+        CMD_RX_COMPLETE, // message reassembled
+        CMD_RX_ERROR,    // unsupported version or oversized message
+    } cmd_rx_result_t;
+
+    /** Badge-side reassembly, no allocation. */
+    typedef struct
+    {
+        uint8_t msg[CMD_MSG_MAX];
+        uint16_t total_len;
+        uint8_t msg_id;
+        uint8_t count;
+        uint32_t have; // bit i: fragment i stored
+        bool active;   // reassembling msg_id
+        bool finished; // msg_id completed: its repeats are ignored
+    } cmd_rx_t;
+
+    void cmd_rx_init(cmd_rx_t *rx);
+
+    /**
+     * Feed one frame. On CMD_RX_COMPLETE @p *msg and @p *msg_len describe the
+     * message, valid until the next call.
+     */
+    cmd_rx_result_t cmd_rx_handle(cmd_rx_t *rx, const uint8_t *frame, size_t len, const uint8_t **msg,
+                                  size_t *msg_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
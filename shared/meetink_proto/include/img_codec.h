@@ -0,0 +1,98 @@
+#ifndef IMG_CODEC_H
+#define IMG_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Compressed wire formats for 1bpp badge images.
+ *
+ *   IMG_ENC_PACKBITS  classic PackBits byte RLE; best on mostly-white logos.
+ *   IMG_ENC_LZSS      heatshrink-style bit-packed LZSS:
+ *                       1 + 8 bits                 literal byte
+ *                       0 + WINDOW_BITS + LEN_BITS back-reference (distance-1, length-MIN)
+ *                     catches repeated rows and patterns that RLE misses.
+ *
+ * The decoder is a push-style state machine: it accepts the encoded stream in
+ * arbitrary slices (ESP-NOW chunks) and emits decoded bytes strictly in order,
+ * keeping only its own LZ window, so the caller never needs the whole image.
+ */
+
+#define IMG_LZ_WINDOW_BITS 10
+#define IMG_LZ_LEN_BITS 7
+#define IMG_LZ_WINDOW (1 << IMG_LZ_WINDOW_BITS)
+#define IMG_LZ_MIN_MATCH 3
+#define IMG_LZ_MAX_MATCH (IMG_LZ_MIN_MATCH + (1 << IMG_LZ_LEN_BITS) - 1)
+#define IMG_DEC_BATCH 64 // decoded bytes handed to the output callback at once
+
+    typedef enum
+    {
+        IMG_ENC_RAW = 0,
+        IMG_ENC_PACKBITS = 1,
+        IMG_ENC_LZSS = 2,
+    } img_enc_t;
+
+    /**
+     * @brief Encode @p len bytes of @p src into @p dst.
+     * @return encoded length, or 0 if the result would not fit into @p cap
+     *         (or scratch memory for LZSS could not be allocated).
+     */
+    size_t img_encode(img_enc_t enc, const uint8_t *src, size_t len, uint8_t *dst, size_t cap);
+
+    /** Receives decoded bytes in order. */
+    typedef void (*img_out_fn)(void *ctx, const uint8_t *data, size_t len);
+
+    typedef struct
+    {
+        img_enc_t enc;
+        img_out_fn out;
+        void *ctx;
+        uint32_t raw_len;  // expected decoded size
+        uint32_t produced; // decoded bytes emitted so far
+        bool error;
+
+        // PackBits state
+        int16_t run;     // >0: literals left, <0: repeats left (waiting for the byte)
+        bool have_header;
+
+        // LZSS state
+        uint32_t bitbuf;
+        uint8_t bitcount;
+        uint16_t wpos;
+        uint8_t window[IMG_LZ_WINDOW];
+
+        uint8_t batch[IMG_DEC_BATCH];
+        uint8_t batch_len;
+    } img_decoder_t;
+
+    void img_decoder_init(img_decoder_t *d, img_enc_t enc, uint32_t raw_len, img_out_fn out, void *ctx);
+
+    /**
+     * @brief Push the next slice of the encoded stream.
+     * @return false on malformed input or output overrun; the decoder stays failed.
+     */
+    bool img_decoder_feed(img_decoder_t *d, const uint8_t *data, size_t len);
+
+    /** True once exactly raw_len bytes were emitted without error. */
+    static inline bool img_decoder_done(const img_decoder_t *d)
+    {
+        return !d->error && d->produced == d->raw_len;
+    }
+
+    /** True for encodings this build can decode. */
+    static inline bool img_enc_supported(uint8_t enc)
+    {
+        return enc == IMG_ENC_RAW || enc == IMG_ENC_PACKBITS || enc == IMG_ENC_LZSS;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef TELEM_PROTO_H
+#define TELEM_PROTO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Badge telemetry (badge -> gateway).
+ *
+ *   REPORT  badge -> gateway     telem_report_t, after every update it handles
+ *   REPORT  badge -> broadcast   telem_report_t with TELEM_EVT_BOOT at startup
+ *
+ * The badge reports what became of each update: ACCEPTED once it parsed the
+ * update and started drawing it, RENDERED with the refresh duration when the
+ * panel is done, REJECTED when the update could not be shown. Every report
+ * also carries the badge's health, so the gateway learns battery, signal and
+ * receive-queue pressure without polling. Reports are fire-and-forget: a
+ * lost one is superseded by the next.
+ *
+ * All multi-byte fields are little-endian (native on ESP32 and x86 hosts).
+ */
+
+#define TELEM_MAGIC 0xB9
+#define TELEM_FW_LEN 16 // firmware version, NUL padded, not always terminated
+
+    typedef enum
+    {
+        TELEM_PKT_REPORT = 0x01,
+    } telem_pkt_type_t;
+
+    typedef enum
+    {
+        TELEM_EVT_BOOT = 0x00,     // badge started, shows its start screen
+        TELEM_EVT_ACCEPTED = 0x01, // update parsed, drawing started
+        TELEM_EVT_RENDERED = 0x02, // panel refresh finished, render_ms is set
+        TELEM_EVT_REJECTED = 0x03, // malformed or failed update, nothing shown
+    } telem_event_t;
+
+    typedef enum
+    {
+        TELEM_OP_NONE = 0x00,
+        TELEM_OP_TEXT = 0x01,  // name/info update
+        TELEM_OP_CLEAR = 0x02, // clear screen
+        TELEM_OP_IMAGE = 0x03, // windowed image transfer, xfer_id is set
+    } telem_op_t;
+
+    typedef struct __attribute__((packed))
+    {
+        uint8_t magic;       // TELEM_MAGIC
+        uint8_t type;        // TELEM_PKT_REPORT
+        uint8_t event;       // telem_event_t
+        uint8_t op;          // telem_op_t the event is about
+        uint16_t seq;        // increments with every report, restarts at boot
+        uint8_t xfer_id;     // id of the image transfer, 0 otherwise
+        int8_t rssi;         // dBm of the last frame the badge received, 0 if none
+        uint32_t render_ms;  // refresh duration for RENDERED, 0 otherwise
+        uint16_t battery_mv; // 0 if not measured
+        uint8_t queue_hwm;   // most frames ever waiting in the receive queue
+        uint8_t reserved;
+        uint16_t dropped;    // frames lost to a full receive queue since boot
+        char fw[TELEM_FW_LEN];
+    } telem_report_t;
+
+    /** True when @p data looks like a telemetry frame of @p type. */
+    static inline bool telem_is_frame(const uint8_t *data, size_t len, uint8_t type)
+    {
+        return len >= 2 && data[0] == TELEM_MAGIC && data[1] == type;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
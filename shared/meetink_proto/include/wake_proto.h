@@ -0,0 +1,87 @@
+#ifndef WAKE_PROTO_H
+#define WAKE_PROTO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Wake-window announcements of power-saving badges (badge -> gateway).
+ *
+ *   HELLO  badge -> broadcast   wake_hello_t
+ *
+ * A badge in power-save mode keeps its radio off except for a short listen
+ * window after each HELLO. The gateway learns the schedule from these frames,
+ * holds updates for sleeping badges and sends them as soon as the next HELLO
+ * arrives. Any frame received inside the window keeps the badge awake a while
+ * longer, so multi-frame transfers started in the window run to completion.
+ * Badges that never announce a schedule are treated as always listening.
+ *
+ * All multi-byte fields are little-endian (native on ESP32 and x86 hosts).
+ */
+
+#define WAKE_MAGIC 0xB8
+// Intervals without a HELLO before the gateway stops trusting the schedule
+#define WAKE_LOST_INTERVALS 3
+// Airtime/processing margin the gateway keeps before the window closes
+#define WAKE_GUARD_MS 10
+
+    typedef enum
+    {
+        WAKE_PKT_HELLO = 0x01,
+    } wake_pkt_type_t;
+
+// HELLO flags
+#define WAKE_FLAG_BOOT 0x01 // first HELLO after a reset, seq restarts
+
+    typedef struct __attribute__((packed))
+    {
+        uint8_t magic;        // WAKE_MAGIC
+        uint8_t type;         // WAKE_PKT_HELLO
+        uint8_t flags;        // WAKE_FLAG_*
+        uint8_t reserved;
+        uint16_t seq;         // increments with every HELLO
+        uint16_t listen_ms;   // radio stays on this long after the frame
+        uint32_t interval_ms; // time until the next HELLO
+    } wake_hello_t;
+
+    /** Schedule of one badge as learned by the gateway. */
+    typedef struct
+    {
+        bool known; // at least one HELLO seen
+        uint16_t seq;
+        uint16_t listen_ms;
+        uint32_t interval_ms;
+        uint32_t last_hello_ms;
+        uint32_t hellos; // HELLOs received
+        uint32_t missed; // HELLOs lost, from gaps in seq
+    } wake_peer_t;
+
+    /** True when @p data looks like a wake-protocol frame of @p type. */
+    static inline bool wake_is_frame(const uint8_t *data, size_t len, uint8_t type)
+    {
+        return len >= 2 && data[0] == WAKE_MAGIC && data[1] == type;
+    }
+
+    /** Record a HELLO frame; returns false if the frame is malformed. */
+    bool wake_peer_on_hello(wake_peer_t *peer, const uint8_t *frame, size_t len, uint32_t now_ms);
+
+    /**
+     * True while a frame sent now is expected to reach the badge: inside its
+     * listen window, or always when the badge has no (or a stale) schedule.
+     */
+    bool wake_peer_listening(const wake_peer_t *peer, uint32_t now_ms);
+
+    /** Milliseconds until the badge is expected to listen again (0 when listening). */
+    uint32_t wake_peer_next_ms(const wake_peer_t *peer, uint32_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef XFER_MTX_H
+#define XFER_MTX_H
+
+#include "xfer_tx.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define XFER_MTX_MAX_RX 32 // receivers in one broadcast transfer
+
+    /**
+     * Frame transmit hook of a broadcast transfer; receiver is the index of the
+     * invited badge for unicast JOIN frames and -1 for the broadcast address.
+     * Returns 0 when the frame was handed to the radio.
+     */
+    typedef struct
+    {
+        int (*send)(void *ctx, int receiver, const uint8_t *frame, size_t len);
+        void *ctx;
+    } xfer_mlink_t;
+
+    typedef struct
+    {
+        uint32_t frames_sent;   // DATA frames broadcast
+        uint32_t retransmits;   // DATA frames broadcast more than once
+        uint32_t joins_sent;    // unicast invitations
+        uint32_t link_failures; // send callback reported a failure
+        uint32_t rounds;        // STATUS collection rounds
+        uint32_t status_rx;     // STATUS frames accepted
+        uint32_t timeouts;      // rounds that ended with some receiver silent
+    } xfer_mtx_stats_t;
+
+    /** What the sender knows about one receiver. */
+    typedef struct
+    {
+        xfer_tx_state_t state;
+        bool joined;       // answered the invitation
+        bool answered;     // STATUS seen in the current round
+        uint8_t silent;    // consecutive rounds without a STATUS
+        uint16_t next_seq; // receiver's cumulative ack
+        uint32_t have;     // bit i: next_seq + i is parked at the receiver
+    } xfer_mrx_t;
+
+    /**
+     * Sender side of one transfer to many receivers at once. Like xfer_tx_t it
+     * is transport- and clock-agnostic. Each chunk is broadcast once per round
+     * for everybody who still needs it, so airtime grows with the loss rate of
+     * the worst receiver instead of with the number of receivers.
+     */
+    typedef struct
+    {
+        xfer_mlink_t link;
+        const uint8_t *data;
+        uint32_t len;
+        uint32_t crc;
+        uint16_t chunk_count;
+        uint8_t id;
+        uint8_t encoding;
+
+        uint8_t rx_count;
+        xfer_mrx_t rx[XFER_MTX_MAX_RX];
+
+        bool waiting;      // round sent, collecting STATUS frames
+        uint16_t base;     // first chunk of the current round
+        uint32_t todo;     // bit i: base + i still to send in this round
+        uint16_t next_new; // first chunk never broadcast
+        uint8_t join_next; // next receiver to invite while joining
+        uint8_t radio_count;
+        uint32_t round_ms; // when the current round finished sending
+
+        xfer_tx_state_t state; // RUNNING until every receiver finished one way or another
+        xfer_mtx_stats_t stats;
+    } xfer_mtx_t;
+
+    /**
+     * Prepare @p tx for broadcasting @p len bytes of @p data, encoded as
+     * @p encoding, to @p rx_count receivers (at most XFER_MTX_MAX_RX); the
+     * buffer must outlive the transfer.
+     */
+    void xfer_mtx_begin(xfer_mtx_t *tx, const xfer_mlink_t *link, uint8_t id, uint8_t encoding,
+                        const uint8_t *data, uint32_t len, uint8_t rx_count, uint32_t now_ms);
+
+    /** Report the radio-level result of the oldest frame handed to link.send(). */
+    void xfer_mtx_on_sent(xfer_mtx_t *tx, bool ok);
+
+    /** Feed a frame received from receiver @p receiver; non-STATUS or foreign frames are ignored. */
+    void xfer_mtx_on_status(xfer_mtx_t *tx, int receiver, const uint8_t *frame, size_t len, uint32_t now_ms);
+
+    /** Handle round timeouts and push as many frames as the radio allows. */
+    void xfer_mtx_service(xfer_mtx_t *tx, uint32_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef XFER_PROTO_H
+#define XFER_PROTO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Windowed, acknowledged bulk transfer over ESP-NOW (gateway -> badge).
+ *
+ *   DATA   gateway -> badge   xfer_data_hdr_t + up to XFER_CHUNK_MAX bytes
+ *   STATUS badge -> gateway   xfer_status_t
+ *
+ * Every data frame carries the whole-transfer length, CRC-32 and payload
+ * encoding, so the badge can (re)start a transfer from whichever frame it sees
+ * first; a badge that cannot decode the encoding answers ABORT and the sender
+ * falls back to a plainer one. The sender keeps at most XFER_WINDOW chunks
+ * outstanding beyond the badge's cumulative ack and asks for a STATUS every
+ * XFER_ACK_EVERY chunks; STATUS carries the cumulative ack plus a NACK bitmap
+ * used for selective retransmission.
+ *
+ * Broadcast mode (one image to many badges): the gateway first invites each
+ * badge with a unicast JOIN frame (a DATA header without payload), then sends
+ * the chunks once to the broadcast address flagged MCAST. Badges only accept
+ * MCAST chunks of the transfer they joined. Chunks go out in rounds of at
+ * most XFER_WINDOW; the last frame of a round asks every badge for a STATUS,
+ * and the next round re-broadcasts whatever any badge is still missing.
+ *
+ * All multi-byte fields are little-endian (native on ESP32 and x86 hosts).
+ */
+
+#define XFER_MAGIC 0xB7
+#define XFER_FRAME_MAX 250 // ESP_NOW_MAX_DATA_LEN
+#define XFER_WINDOW 16     // chunks outstanding beyond the cumulative ack
+#define XFER_ACK_EVERY (XFER_WINDOW / 2)
+
+    typedef enum
+    {
+        XFER_PKT_DATA = 0x01,
+        XFER_PKT_STATUS = 0x02,
+    } xfer_pkt_type_t;
+
+// DATA flags
+#define XFER_FLAG_ACK_REQ 0x01 // receiver must answer with a STATUS frame
+#define XFER_FLAG_JOIN 0x02    // invitation to a broadcast transfer, no payload
+#define XFER_FLAG_MCAST 0x04   // broadcast chunk, only for badges that joined
+
+// STATUS flags
+#define XFER_STATUS_DONE 0x01    // all chunks received and CRC matched
+#define XFER_STATUS_CRC_ERR 0x02 // all chunks received but CRC mismatch
+#define XFER_STATUS_ABORT 0x04   // receiver refused the transfer (size/encoding)
+
+    typedef struct __attribute__((packed))
+    {
+        uint8_t magic;      // XFER_MAGIC
+        uint8_t type;       // XFER_PKT_DATA
+        uint8_t xfer_id;    // changes for every new transfer to the same badge
+        uint8_t flags;      // XFER_FLAG_*
+        uint16_t seq;       // chunk index, payload lives at seq * XFER_CHUNK_MAX
+        uint8_t encoding;   // payload encoding (img_enc_t), fixed for the whole transfer
+        uint32_t total_len; // bytes in the whole transfer
+        uint32_t crc32;     // CRC-32 (IEEE) of the whole transfer
+    } xfer_data_hdr_t;
+
+    typedef struct __attribute__((packed))
+    {
+        uint8_t magic;     // XFER_MAGIC
+        uint8_t type;      // XFER_PKT_STATUS
+        uint8_t xfer_id;   // transfer being acknowledged
+        uint8_t flags;     // XFER_STATUS_*
+        uint16_t next_seq; // cumulative ack: every seq < next_seq was received
+        uint8_t span;      // number of valid bits in nack (highest seen - next_seq + 1)
+        uint8_t reserved;
+        uint32_t nack; // bit i set: seq next_seq + i is missing
+    } xfer_status_t;
+
+#define XFER_HDR_LEN (sizeof(xfer_data_hdr_t))
+#define XFER_CHUNK_MAX (XFER_FRAME_MAX - XFER_HDR_LEN)
+#define XFER_CHUNK_COUNT(len) ((uint16_t)(((len) + XFER_CHUNK_MAX - 1) / XFER_CHUNK_MAX))
+
+    /** Frame transmit hook; returns 0 when the frame was handed to the radio. */
+    typedef struct
+    {
+        int (*send)(void *ctx, const uint8_t *frame, size_t len);
+        void *ctx;
+    } xfer_link_t;
+
+    /**
+     * @brief Incremental CRC-32 (IEEE 802.3, reflected).
+     *
+     * Start with crc = 0 and feed the data in order; chaining calls over
+     * consecutive slices yields the CRC of the concatenation.
+     */
+    uint32_t xfer_crc32(uint32_t crc, const uint8_t *data, size_t len);
+
+    /** True when @p data looks like a transfer-protocol frame of @p type. */
+    static inline bool xfer_is_frame(const uint8_t *data, size_t len, uint8_t type)
+    {
+        return len >= 2 && data[0] == XFER_MAGIC && data[1] == type;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
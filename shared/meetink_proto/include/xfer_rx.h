@@ -0,0 +1,67 @@
+#ifndef XFER_RX_H
+#define XFER_RX_H
+
+#include "xfer_proto.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef enum
+    {
+        XFER_RX_IGNORED,  // not a DATA frame, or a duplicate/out-of-window chunk
+        XFER_RX_PROGRESS, // chunk accepted, transfer still incomplete
+        XFER_RX_COMPLETE, // last chunk delivered and CRC matched
+        XFER_RX_ERROR,    // transfer refused or CRC mismatch
+    } xfer_rx_result_t;
+
+    /**
+     * Consumer of reassembled data. Called strictly in order (offset grows
+     * monotonically from 0), so it may decode or stream the payload directly.
+     * begin() is called once per transfer before the first write() and may
+     * refuse it (unsupported size or encoding), which the sender sees as ABORT.
+     */
+    typedef struct
+    {
+        bool (*begin)(void *ctx, uint32_t total_len, uint8_t encoding);
+        void (*write)(void *ctx, uint32_t offset, const uint8_t *data, size_t len);
+        void *ctx;
+    } xfer_sink_t;
+
+    /**
+     * Receiver side of the transfer protocol. Chunks arriving ahead of a gap are
+     * parked in a XFER_WINDOW-slot reorder buffer (~3.7 KB) until the gap is
+     * retransmitted, so the sink never needs random access.
+     */
+    typedef struct
+    {
+        xfer_link_t link; // STATUS replies go here
+        xfer_sink_t sink;
+
+        bool active;
+        bool finished; // finished transfers keep answering retransmissions
+        uint8_t id;
+        uint8_t encoding;
+        uint8_t result_flags;
+        uint32_t total_len;
+        uint32_t crc_expected;
+        uint32_t crc;
+        uint16_t chunk_count;
+        uint16_t next_seq; // first chunk not yet delivered to the sink
+        uint16_t highest;  // highest seq seen in this transfer
+        uint32_t parked;   // bit i: chunk next_seq + i is in the reorder buffer
+        uint8_t slot_len[XFER_WINDOW];
+        uint8_t slot[XFER_WINDOW][XFER_CHUNK_MAX];
+    } xfer_rx_t;
+
+    void xfer_rx_init(xfer_rx_t *rx, const xfer_link_t *link, const xfer_sink_t *sink);
+
+    /** Process one received frame, replying with STATUS frames through the link as needed. */
+    xfer_rx_result_t xfer_rx_handle(xfer_rx_t *rx, const uint8_t *frame, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef XFER_TX_H
+#define XFER_TX_H
+
+#include "xfer_proto.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define XFER_RADIO_DEPTH 4         // frames handed to the radio awaiting the send callback
+#define XFER_ACK_TIMEOUT_MS 150    // no STATUS for this long -> probe the receiver
+#define XFER_MAX_RETRIES 8         // consecutive probes without progress before giving up
+
+    typedef enum
+    {
+        XFER_TX_RUNNING,
+        XFER_TX_DONE,
+        XFER_TX_FAILED,
+        XFER_TX_REFUSED, // receiver answered ABORT, e.g. unsupported encoding
+    } xfer_tx_state_t;
+
+    typedef struct
+    {
+        uint32_t frames_sent;   // every DATA frame handed to the radio
+        uint32_t retransmits;   // DATA frames sent more than once
+        uint32_t link_failures; // send callback reported no MAC-layer ack
+        uint32_t status_rx;     // STATUS frames accepted
+        uint32_t timeouts;      // probes after XFER_ACK_TIMEOUT_MS of silence
+    } xfer_tx_stats_t;
+
+    /**
+     * Sender side of one transfer. Transport- and clock-agnostic: the owner feeds
+     * send-callback results, received STATUS frames and the current time, and the
+     * state machine calls link.send() whenever the window allows.
+     */
+    typedef struct
+    {
+        xfer_link_t link;
+        const uint8_t *data;
+        uint32_t len;
+        uint32_t crc;
+        uint16_t chunk_count;
+        uint8_t id;
+        uint8_t encoding;
+
+        uint16_t base;     // lowest seq the receiver has not confirmed
+        uint16_t next_new; // next seq never sent
+        uint32_t sent;     // bit i: base + i was sent and is not known to be lost
+        uint32_t acked;    // bit i: base + i selectively acknowledged
+
+        uint16_t radio_seq[XFER_RADIO_DEPTH]; // FIFO of frames awaiting the send callback
+        uint8_t radio_head;
+        uint8_t radio_count;
+
+        bool probe;              // next frame must request a STATUS
+        uint32_t last_status_ms; // time of last STATUS or progress
+        uint8_t retries;
+
+        xfer_tx_state_t state;
+        xfer_tx_stats_t stats;
+    } xfer_tx_t;
+
+    /**
+     * Prepare @p tx for sending @p len bytes of @p data, already encoded as
+     * @p encoding (img_enc_t); the buffer must outlive the transfer.
+     */
+    void xfer_tx_begin(xfer_tx_t *tx, const xfer_link_t *link, uint8_t id, uint8_t encoding,
+                       const uint8_t *data, uint32_t len, uint32_t now_ms);
+
+    /** Report the radio-level result of the oldest frame handed to link.send(). */
+    void xfer_tx_on_sent(xfer_tx_t *tx, bool ok);
+
+    /** Feed a frame received from the peer; non-STATUS or foreign frames are ignored. */
+    void xfer_tx_on_status(xfer_tx_t *tx, const uint8_t *frame, size_t len, uint32_t now_ms);
+
+    /** Handle timeouts and push as many frames as the window and radio allow. */
+    void xfer_tx_service(xfer_tx_t *tx, uint32_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,60 @@
+#include "wake_proto.h"
+#include <string.h>
+
+bool wake_peer_on_hello(wake_peer_t *peer, const uint8_t *frame, size_t len, uint32_t now_ms)
+{
+    wake_hello_t hello;
+    if (len != sizeof(hello) || !wake_is_frame(frame, len, WAKE_PKT_HELLO))
+    {
+        return false;
+    }
+    memcpy(&hello, frame, sizeof(hello));
+    if (hello.interval_ms == 0)
+    {
+        return false;
+    }
+
+    if (peer->known && !(hello.flags & WAKE_FLAG_BOOT))
+    {
+        uint16_t gap = hello.seq - peer->seq;
+        if (gap > 1)
+        {
+            peer->missed += gap - 1;
+        }
+    }
+    peer->known = true;
+    peer->seq = hello.seq;
+    peer->listen_ms = hello.listen_ms;
+    peer->interval_ms = hello.interval_ms;
+    peer->last_hello_ms = now_ms;
+    peer->hellos++;
+    return true;
+}
+
+static bool schedule_valid(const wake_peer_t *peer, uint32_t since)
+{
+    return peer->known && since / peer->interval_ms < WAKE_LOST_INTERVALS;
+}
+
+bool wake_peer_listening(const wake_peer_t *peer, uint32_t now_ms)
+{
+    uint32_t since = now_ms - peer->last_hello_ms;
+    if (!schedule_valid(peer, since))
+    {
+        // Never announced a schedule, or went quiet (powered off, or rebooted
+        // without power saving): sending is the only way to find out
+        return true;
+    }
+    return since + WAKE_GUARD_MS < peer->listen_ms;
+}
+
+uint32_t wake_peer_next_ms(const wake_peer_t *peer, uint32_t now_ms)
+{
+    if (wake_peer_listening(peer, now_ms))
+    {
+        return 0;
+    }
+    // Overdue HELLOs were lost; the badge keeps its own period regardless
+    uint32_t since = now_ms - peer->last_hello_ms;
+    return peer->interval_ms - since % peer->interval_ms;
+}
@@ -0,0 +1,289 @@
+#include "xfer_mtx.h"
+#include <string.h>
+
+static inline uint32_t bit(uint16_t i)
+{
+    return (i < 32) ? (1UL << i) : 0;
+}
+
+static bool running(const xfer_mrx_t *r)
+{
+    return r->state == XFER_TX_RUNNING;
+}
+
+static bool needs(const xfer_mrx_t *r, uint16_t seq)
+{
+    return seq >= r->next_seq && !(r->have & bit(seq - r->next_seq));
+}
+
+static bool send_frame(xfer_mtx_t *tx, int receiver, uint16_t seq, uint8_t flags)
+{
+    uint8_t frame[XFER_FRAME_MAX];
+    xfer_data_hdr_t hdr = {
+        .magic = XFER_MAGIC,
+        .type = XFER_PKT_DATA,
+        .xfer_id = tx->id,
+        .flags = flags,
+        .seq = seq,
+        .encoding = tx->encoding,
+        .total_len = tx->len,
+        .crc32 = tx->crc,
+    };
+    uint32_t chunk = 0;
+    if (!(flags & XFER_FLAG_JOIN))
+    {
+        uint32_t offset = (uint32_t)seq * XFER_CHUNK_MAX;
+        chunk = tx->len - offset;
+        if (chunk > XFER_CHUNK_MAX)
+        {
+            chunk = XFER_CHUNK_MAX;
+        }
+        memcpy(frame + XFER_HDR_LEN, tx->data + offset, chunk);
+    }
+    memcpy(frame, &hdr, XFER_HDR_LEN);
+
+    if (tx->link.send(tx->link.ctx, receiver, frame, XFER_HDR_LEN + chunk) != 0)
+    {
+        return false; // radio queue full, retry on the next service call
+    }
+    tx->radio_count++;
+    return true;
+}
+
+// Plans the next round: invitations while somebody has not joined yet,
+// otherwise every chunk of the window that at least one receiver misses.
+static void start_round(xfer_mtx_t *tx)
+{
+    bool joining = false;
+    uint16_t base = tx->chunk_count;
+    for (uint8_t r = 0; r < tx->rx_count; r++)
+    {
+        xfer_mrx_t *rx = &tx->rx[r];
+        rx->answered = false;
+        if (running(rx))
+        {
+            joining |= !rx->joined;
+            if (rx->next_seq < base)
+            {
+                base = rx->next_seq;
+            }
+        }
+    }
+    tx->waiting = false;
+    tx->join_next = joining ? 0 : tx->rx_count;
+    tx->todo = 0;
+    if (joining)
+    {
+        // Only newcomers are invited: receivers that joined are not asked
+        // for anything this round, so they are not waited for either
+        for (uint8_t r = 0; r < tx->rx_count; r++)
+        {
+            tx->rx[r].answered = tx->rx[r].joined;
+        }
+        return;
+    }
+
+    // Everybody accepts chunks up to XFER_WINDOW past its own cumulative ack,
+    // and the slowest receiver sets the base, so the whole window is safe
+    tx->base = base;
+    for (uint16_t i = 0; i < XFER_WINDOW && base + i < tx->chunk_count; i++)
+    {
+        for (uint8_t r = 0; r < tx->rx_count; r++)
+        {
+            if (running(&tx->rx[r]) && needs(&tx->rx[r], base + i))
+            {
+                tx->todo |= bit(i);
+                break;
+            }
+        }
+    }
+    if (tx->todo == 0)
+    {
+        tx->todo = bit(0); // nothing known missing but no DONE yet: poke
+    }
+}
+
+static void update_state(xfer_mtx_t *tx)
+{
+    for (uint8_t r = 0; r < tx->rx_count; r++)
+    {
+        if (running(&tx->rx[r]))
+        {
+            return;
+        }
+    }
+    tx->state = XFER_TX_DONE;
+}
+
+void xfer_mtx_begin(xfer_mtx_t *tx, const xfer_mlink_t *link, uint8_t id, uint8_t encoding,
+                    const uint8_t *data, uint32_t len, uint8_t rx_count, uint32_t now_ms)
+{
+    memset(tx, 0, sizeof(*tx));
+    tx->link = *link;
+    tx->data = data;
+    tx->len = len;
+    tx->id = id;
+    tx->encoding = encoding;
+    tx->crc = xfer_crc32(0, data, len);
+    tx->chunk_count = XFER_CHUNK_COUNT(len);
+    tx->rx_count = (rx_count > XFER_MTX_MAX_RX) ? XFER_MTX_MAX_RX : rx_count;
+    tx->round_ms = now_ms;
+    tx->state = (len == 0 || tx->rx_count == 0) ? XFER_TX_DONE : XFER_TX_RUNNING;
+    for (uint8_t r = 0; r < tx->rx_count; r++)
+    {
+        tx->rx[r].state = tx->state;
+    }
+    start_round(tx);
+}
+
+void xfer_mtx_on_sent(xfer_mtx_t *tx, bool ok)
+{
+    // Broadcasts are never acked at the MAC layer, and a lost JOIN shows up
+    // as a silent receiver at the end of the round: failures are only counted
+    if (tx->radio_count > 0)
+    {
+        tx->radio_count--;
+        tx->stats.link_failures += !ok;
+    }
+}
+
+void xfer_mtx_on_status(xfer_mtx_t *tx, int receiver, const uint8_t *frame, size_t len, uint32_t now_ms)
+{
+    (void)now_ms; // rounds are timed in xfer_mtx_service()
+    xfer_status_t st;
+    if (tx->state != XFER_TX_RUNNING || receiver < 0 || receiver >= tx->rx_count ||
+        len < sizeof(st) || !xfer_is_frame(frame, len, XFER_PKT_STATUS))
+    {
+        return;
+    }
+    memcpy(&st, frame, sizeof(st));
+    xfer_mrx_t *rx = &tx->rx[receiver];
+    if (st.xfer_id != tx->id || !running(rx))
+    {
+        return;
+    }
+    tx->stats.status_rx++;
+    rx->answered = true;
+    rx->joined = true;
+
+    if (st.flags & (XFER_STATUS_DONE | XFER_STATUS_ABORT | XFER_STATUS_CRC_ERR))
+    {
+        rx->state = (st.flags & XFER_STATUS_DONE)    ? XFER_TX_DONE
+                    : (st.flags & XFER_STATUS_ABORT) ? XFER_TX_REFUSED
+                                                     : XFER_TX_FAILED;
+        update_state(tx);
+        return;
+    }
+
+    if (st.next_seq >= rx->next_seq && st.next_seq <= tx->chunk_count)
+    {
+        uint8_t span = (st.span > 32) ? 32 : st.span;
+        rx->next_seq = st.next_seq;
+        rx->have = 0;
+        for (uint8_t i = 0; i < span; i++)
+        {
+            if (!(st.nack & bit(i)))
+            {
+                rx->have |= bit(i);
+            }
+        }
+    }
+}
+
+void xfer_mtx_service(xfer_mtx_t *tx, uint32_t now_ms)
+{
+    if (tx->state != XFER_TX_RUNNING)
+    {
+        return;
+    }
+
+    if (tx->waiting)
+    {
+        bool all = true;
+        for (uint8_t r = 0; r < tx->rx_count; r++)
+        {
+            all &= !running(&tx->rx[r]) || tx->rx[r].answered;
+        }
+        if (!all && now_ms - tx->round_ms <= XFER_ACK_TIMEOUT_MS)
+        {
+            return;
+        }
+        if (!all)
+        {
+            tx->stats.timeouts++;
+        }
+        for (uint8_t r = 0; r < tx->rx_count; r++)
+        {
+            xfer_mrx_t *rx = &tx->rx[r];
+            if (!running(rx))
+            {
+                continue;
+            }
+            // A receiver that stays silent would hold everybody back: drop it
+            rx->silent = rx->answered ? 0 : rx->silent + 1;
+            if (rx->silent > XFER_MAX_RETRIES)
+            {
+                rx->state = XFER_TX_FAILED;
+            }
+        }
+        update_state(tx);
+        if (tx->state != XFER_TX_RUNNING)
+        {
+            return;
+        }
+        start_round(tx);
+    }
+
+    // Invitations go out one by one to the receivers that have not joined
+    while (tx->join_next < tx->rx_count && tx->radio_count < XFER_RADIO_DEPTH)
+    {
+        xfer_mrx_t *rx = &tx->rx[tx->join_next];
+        if (running(rx) && !rx->joined)
+        {
+            if (!send_frame(tx, tx->join_next, 0, XFER_FLAG_JOIN | XFER_FLAG_ACK_REQ))
+            {
+                return;
+            }
+            tx->stats.joins_sent++;
+        }
+        if (++tx->join_next == tx->rx_count)
+        {
+            tx->stats.rounds++;
+            tx->waiting = true;
+            tx->round_ms = now_ms;
+            return;
+        }
+    }
+
+    // Broadcast the round; its last frame asks everybody for a STATUS
+    while (tx->todo && tx->radio_count < XFER_RADIO_DEPTH)
+    {
+        uint16_t i = 0;
+        while (!(tx->todo & bit(i)))
+        {
+            i++;
+        }
+        uint16_t seq = tx->base + i;
+        bool last = (tx->todo & ~bit(i)) == 0;
+        if (!send_frame(tx, -1, seq, XFER_FLAG_MCAST | (last ? XFER_FLAG_ACK_REQ : 0)))
+        {
+            return;
+        }
+        tx->todo &= ~bit(i);
+        tx->stats.frames_sent++;
+        if (seq < tx->next_new)
+        {
+            tx->stats.retransmits++;
+        }
+        else
+        {
+            tx->next_new = seq + 1;
+        }
+        if (last)
+        {
+            tx->stats.rounds++;
+            tx->waiting = true;
+            tx->round_ms = now_ms;
+        }
+    }
+}
@@ -0,0 +1,167 @@
+#include "xfer_rx.h"
+#include <string.h>
+
+static void send_status(xfer_rx_t *rx)
+{
+    xfer_status_t st = {
+        .magic = XFER_MAGIC,
+        .type = XFER_PKT_STATUS,
+        .xfer_id = rx->id,
+        .flags = rx->result_flags,
+        .next_seq = rx->next_seq,
+        .span = 0,
+        .reserved = 0,
+        .nack = 0,
+    };
+
+    if (!rx->finished && rx->highest >= rx->next_seq)
+    {
+        uint16_t span = rx->highest - rx->next_seq + 1;
+        st.span = (span > 32) ? 32 : (uint8_t)span;
+        for (uint8_t i = 0; i < st.span; i++)
+        {
+            if (!(rx->parked & (1UL << i)))
+            {
+                st.nack |= 1UL << i;
+            }
+        }
+    }
+    rx->link.send(rx->link.ctx, (const uint8_t *)&st, sizeof(st));
+}
+
+static uint32_t chunk_len(const xfer_rx_t *rx, uint16_t seq)
+{
+    uint32_t offset = (uint32_t)seq * XFER_CHUNK_MAX;
+    uint32_t left = rx->total_len - offset;
+    return (left > XFER_CHUNK_MAX) ? XFER_CHUNK_MAX : left;
+}
+
+static void deliver(xfer_rx_t *rx, const uint8_t *data, size_t len)
+{
+    rx->sink.write(rx->sink.ctx, (uint32_t)rx->next_seq * XFER_CHUNK_MAX, data, len);
+    rx->crc = xfer_crc32(rx->crc, data, len);
+    rx->next_seq++;
+    rx->parked >>= 1;
+}
+
+static void start(xfer_rx_t *rx, const xfer_data_hdr_t *hdr)
+{
+    rx->active = true;
+    rx->finished = false;
+    rx->id = hdr->xfer_id;
+    rx->encoding = hdr->encoding;
+    rx->result_flags = 0;
+    rx->total_len = hdr->total_len;
+    rx->crc_expected = hdr->crc32;
+    rx->crc = 0;
+    rx->chunk_count = XFER_CHUNK_COUNT(hdr->total_len);
+    rx->next_seq = 0;
+    rx->highest = 0;
+    rx->parked = 0;
+
+    if (rx->chunk_count == 0 || !rx->sink.begin(rx->sink.ctx, hdr->total_len, hdr->encoding))
+    {
+        rx->finished = true;
+        rx->result_flags = XFER_STATUS_ABORT;
+    }
+}
+
+void xfer_rx_init(xfer_rx_t *rx, const xfer_link_t *link, const xfer_sink_t *sink)
+{
+    memset(rx, 0, sizeof(*rx));
+    rx->link = *link;
+    rx->sink = *sink;
+}
+
+xfer_rx_result_t xfer_rx_handle(xfer_rx_t *rx, const uint8_t *frame, size_t len)
+{
+    xfer_data_hdr_t hdr;
+    if (len < XFER_HDR_LEN || !xfer_is_frame(frame, len, XFER_PKT_DATA))
+    {
+        return XFER_RX_IGNORED;
+    }
+    memcpy(&hdr, frame, XFER_HDR_LEN);
+    const uint8_t *payload = frame + XFER_HDR_LEN;
+    size_t payload_len = len - XFER_HDR_LEN;
+    bool ack_req = hdr.flags & XFER_FLAG_ACK_REQ;
+
+    if (!rx->active || hdr.xfer_id != rx->id || hdr.encoding != rx->encoding ||
+        hdr.total_len != rx->total_len || hdr.crc32 != rx->crc_expected)
+    {
+        if (hdr.flags & XFER_FLAG_MCAST)
+        {
+            return XFER_RX_IGNORED; // broadcast for a transfer we were not invited to
+        }
+        start(rx, &hdr);
+        if (rx->finished)
+        {
+            send_status(rx);
+            return XFER_RX_ERROR;
+        }
+    }
+
+    if (rx->finished)
+    {
+        // Sender missed our final STATUS and is probing: repeat it
+        if (ack_req)
+        {
+            send_status(rx);
+        }
+        return XFER_RX_IGNORED;
+    }
+    if (hdr.flags & XFER_FLAG_JOIN)
+    {
+        // Invitation (or a repeat of it): report where we stand
+        send_status(rx);
+        return XFER_RX_IGNORED;
+    }
+
+    uint16_t seq = hdr.seq;
+    if (seq >= rx->chunk_count || payload_len != chunk_len(rx, seq))
+    {
+        return XFER_RX_IGNORED;
+    }
+    if (seq > rx->highest)
+    {
+        rx->highest = seq;
+    }
+
+    xfer_rx_result_t result = XFER_RX_IGNORED;
+    if (seq == rx->next_seq)
+    {
+        deliver(rx, payload, payload_len);
+        // Drain whatever was parked right behind the gap
+        while (rx->parked & 1)
+        {
+            uint8_t s = rx->next_seq % XFER_WINDOW;
+            deliver(rx, rx->slot[s], rx->slot_len[s]);
+        }
+        result = XFER_RX_PROGRESS;
+    }
+    else if (seq > rx->next_seq && seq - rx->next_seq < XFER_WINDOW)
+    {
+        uint16_t i = seq - rx->next_seq;
+        if (!(rx->parked & (1UL << i)))
+        {
+            uint8_t s = seq % XFER_WINDOW;
+            memcpy(rx->slot[s], payload, payload_len);
+            rx->slot_len[s] = (uint8_t)payload_len;
+            rx->parked |= 1UL << i;
+            result = XFER_RX_PROGRESS;
+        }
+    }
+
+    if (rx->next_seq == rx->chunk_count)
+    {
+        rx->finished = true;
+        rx->result_flags = (rx->crc == rx->crc_expected) ? XFER_STATUS_DONE : XFER_STATUS_CRC_ERR;
+        send_status(rx);
+        return (rx->result_flags & XFER_STATUS_DONE) ? XFER_RX_COMPLETE : XFER_RX_ERROR;
+    }
+
+    if (ack_req)
+    {
+        send_status(rx);
+    }
+    return result;
+}
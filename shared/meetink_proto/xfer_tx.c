@@ -0,0 +1,250 @@
+#include "xfer_tx.h"
+#include <string.h>
+
+static inline uint32_t bit(uint16_t i)
+{
+    return (i < 32) ? (1UL << i) : 0;
+}
+
+static bool in_radio(const xfer_tx_t *tx, uint16_t seq)
+{
+    for (uint8_t i = 0; i < tx->radio_count; i++)
+    {
+        if (tx->radio_seq[(tx->radio_head + i) % XFER_RADIO_DEPTH] == seq)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Slide the window so that new_base becomes bit 0 of the bitmaps.
+static void advance_base(xfer_tx_t *tx, uint16_t new_base)
+{
+    uint16_t shift = new_base - tx->base;
+    tx->sent = (shift < 32) ? (tx->sent >> shift) : 0;
+    tx->acked = (shift < 32) ? (tx->acked >> shift) : 0;
+    tx->base = new_base;
+}
+
+static bool send_chunk(xfer_tx_t *tx, uint16_t seq)
+{
+    uint8_t frame[XFER_FRAME_MAX];
+    xfer_data_hdr_t hdr = {
+        .magic = XFER_MAGIC,
+        .type = XFER_PKT_DATA,
+        .xfer_id = tx->id,
+        .flags = 0,
+        .seq = seq,
+        .encoding = tx->encoding,
+        .total_len = tx->len,
+        .crc32 = tx->crc,
+    };
+
+    bool last = (seq + 1 == tx->chunk_count);
+    bool window_full = (seq + 1 - tx->base >= XFER_WINDOW);
+    if (tx->probe || last || window_full || ((seq + 1) % XFER_ACK_EVERY) == 0)
+    {
+        hdr.flags |= XFER_FLAG_ACK_REQ;
+    }
+
+    uint32_t offset = (uint32_t)seq * XFER_CHUNK_MAX;
+    uint32_t chunk = tx->len - offset;
+    if (chunk > XFER_CHUNK_MAX)
+    {
+        chunk = XFER_CHUNK_MAX;
+    }
+    memcpy(frame, &hdr, XFER_HDR_LEN);
+    memcpy(frame + XFER_HDR_LEN, tx->data + offset, chunk);
+
+    if (tx->link.send(tx->link.ctx, frame, XFER_HDR_LEN + chunk) != 0)
+    {
+        return false; // radio queue full, retry on the next service call
+    }
+
+    tx->radio_seq[(tx->radio_head + tx->radio_count) % XFER_RADIO_DEPTH] = seq;
+    tx->radio_count++;
+    tx->sent |= bit(seq - tx->base);
+    tx->probe = false;
+    tx->stats.frames_sent++;
+    return true;
+}
+
+void xfer_tx_begin(xfer_tx_t *tx, const xfer_link_t *link, uint8_t id, uint8_t encoding,
+                   const uint8_t *data, uint32_t len, uint32_t now_ms)
+{
+    memset(tx, 0, sizeof(*tx));
+    tx->link = *link;
+    tx->data = data;
+    tx->len = len;
+    tx->id = id;
+    tx->encoding = encoding;
+    tx->crc = xfer_crc32(0, data, len);
+    tx->chunk_count = XFER_CHUNK_COUNT(len);
+    tx->last_status_ms = now_ms;
+    tx->state = (len == 0) ? XFER_TX_DONE : XFER_TX_RUNNING;
+}
+
+void xfer_tx_on_sent(xfer_tx_t *tx, bool ok)
+{
+    if (tx->radio_count == 0)
+    {
+        return;
+    }
+    uint16_t seq = tx->radio_seq[tx->radio_head];
+    tx->radio_head = (tx->radio_head + 1) % XFER_RADIO_DEPTH;
+    tx->radio_count--;
+
+    if (!ok)
+    {
+        // No MAC-layer ack: the badge certainly did not get it, resend right away
+        tx->stats.link_failures++;
+        if (seq >= tx->base)
+        {
+            tx->sent &= ~bit(seq - tx->base);
+        }
+    }
+}
+
+void xfer_tx_on_status(xfer_tx_t *tx, const uint8_t *frame, size_t len, uint32_t now_ms)
+{
+    xfer_status_t st;
+    if (tx->state != XFER_TX_RUNNING || len < sizeof(st) ||
+        !xfer_is_frame(frame, len, XFER_PKT_STATUS))
+    {
+        return;
+    }
+    memcpy(&st, frame, sizeof(st));
+    if (st.xfer_id != tx->id)
+    {
+        return; // late answer to an older transfer
+    }
+    tx->stats.status_rx++;
+
+    if (st.flags & XFER_STATUS_DONE)
+    {
+        tx->state = XFER_TX_DONE;
+        return;
+    }
+    if (st.flags & XFER_STATUS_ABORT)
+    {
+        tx->state = XFER_TX_REFUSED;
+        return;
+    }
+    if (st.flags & XFER_STATUS_CRC_ERR)
+    {
+        tx->state = XFER_TX_FAILED;
+        return;
+    }
+
+    uint32_t acked_before = tx->acked;
+    uint16_t base_before = tx->base;
+
+    if (st.next_seq > tx->base && st.next_seq <= tx->next_new)
+    {
+        advance_base(tx, st.next_seq);
+    }
+
+    if (st.next_seq == tx->base)
+    {
+        uint8_t span = (st.span > 32) ? 32 : st.span;
+        for (uint8_t i = 0; i < span; i++)
+        {
+            uint16_t seq = tx->base + i;
+            if (seq >= tx->next_new)
+            {
+                break;
+            }
+            if (st.nack & bit(i))
+            {
+                if (!in_radio(tx, seq))
+                {
+                    tx->sent &= ~bit(i);
+                }
+            }
+            else
+            {
+                tx->acked |= bit(i);
+            }
+        }
+    }
+
+    if (tx->base != base_before || tx->acked != acked_before)
+    {
+        tx->retries = 0;
+        tx->last_status_ms = now_ms;
+    }
+}
+
+void xfer_tx_service(xfer_tx_t *tx, uint32_t now_ms)
+{
+    if (tx->state != XFER_TX_RUNNING)
+    {
+        return;
+    }
+
+    if (tx->radio_count == 0 && now_ms - tx->last_status_ms > XFER_ACK_TIMEOUT_MS)
+    {
+        tx->stats.timeouts++;
+        if (++tx->retries > XFER_MAX_RETRIES)
+        {
+            tx->state = XFER_TX_FAILED;
+            return;
+        }
+        // Resend the oldest unconfirmed chunk and ask for a STATUS; the answer
+        // will NACK anything else that went missing.
+        uint16_t seq = (tx->base < tx->chunk_count) ? tx->base : tx->chunk_count - 1;
+        if (seq >= tx->base)
+        {
+            tx->sent &= ~bit(seq - tx->base);
+            tx->acked &= ~bit(seq - tx->base);
+        }
+        tx->probe = true;
+        tx->last_status_ms = now_ms;
+    }
+
+    while (tx->radio_count < XFER_RADIO_DEPTH)
+    {
+        uint16_t seq = UINT16_MAX;
+        bool resend = false;
+
+        // Selective retransmissions first, oldest gap wins
+        uint16_t outstanding = tx->next_new - tx->base;
+        for (uint16_t i = 0; i < outstanding; i++)
+        {
+            if (!((tx->sent | tx->acked) & bit(i)) && !in_radio(tx, tx->base + i))
+            {
+                seq = tx->base + i;
+                resend = true;
+                break;
+            }
+        }
+        if (tx->probe && !resend && tx->base >= tx->chunk_count && tx->chunk_count > 0)
+        {
+            // Everything was acked cumulatively but DONE got lost: poke the last chunk
+            seq = tx->chunk_count - 1;
+            resend = true;
+        }
+        if (seq == UINT16_MAX)
+        {
+            if (tx->next_new >= tx->chunk_count || outstanding >= XFER_WINDOW)
+            {
+                break; // window closed, wait for a STATUS
+            }
+            seq = tx->next_new;
+        }
+
+        if (!send_chunk(tx, seq))
+        {
+            break;
+        }
+        if (resend)
+        {
+            tx->stats.retransmits++;
+        }
+        else
+        {
+            tx->next_new++;
+        }
+    }
+}
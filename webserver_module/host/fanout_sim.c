@@ -0,0 +1,433 @@
+// Sends one logo to a growing number of badges through the gateway's
+// logo_transfer.c scheduler over the simulated ESP-NOW channel of
+// loopback.c, and reports the time until the last badge had it, the airtime
+// used and how many badges got it intact, at a range of loss rates. Every
+// badge runs its own xfer_rx and decodes the image as the badge firmware
+// does. Three ways of asking are compared: one call for all the badges,
+// which broadcasts from LOGO_MCAST_MIN of them on; one call per badge, all
+// at once, which the scheduler interleaves; and one badge after the other,
+// as the gateway did before it had a scheduler. Compression takes no
+// simulated time.
+//
+// Usage: fanout_sim [-n runs] [-r]
+//   -r  send noise, which does not compress, instead of a logo
+//
+// Exit status: 0 if every badge the gateway reported delivered had the image
+// intact, 1 if one did not, 2 on bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "esp_now.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "logo_transfer.h"
+#include "badge_wake.h"
+#include "delivery_push.h"
+#include "peer_cache.h"
+#include "webserver.h"
+#include "img_codec.h"
+#include "xfer_mtx.h"
+#include "xfer_rx.h"
+#include "loopback.h"
+
+#define GATEWAY 0
+#define GIVE_UP_US (600LL * 1000 * 1000)
+
+static const int badge_counts[] = {1, 2, 5, 10, 20, 32};
+static const double loss_rates[] = {0.0, 0.02, 0.10};
+
+typedef enum
+{
+    MODE_BULK,    // one logo_transfer_queue() call for every badge
+    MODE_EACH,    // one call per badge, all at once
+    MODE_IN_TURN, // the next call once the previous badge is done
+    MODE_COUNT,
+} fanout_mode_t;
+
+typedef struct
+{
+    double time_ms; // until the last badge was done or given up
+    double air_ms;
+    int delivered;
+    int corrupt;
+} result_t;
+
+typedef struct
+{
+    xfer_rx_t rx;
+    img_decoder_t dec;
+    uint8_t mac[6];
+    uint8_t out[LOGO_BUF_SIZE];
+    uint32_t decoded;
+    bool finished; // gateway reported it done or failed
+} badge_t;
+
+static const uint8_t s_broadcast_mac[6] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+
+static uint8_t s_image[LOGO_BUF_SIZE];
+static badge_t s_badges[XFER_MTX_MAX_RX];
+static int s_badge_count;
+static int s_finished;
+static loopback_t s_lb;
+static int64_t s_now_us;
+static result_t s_res;
+
+static void badge_mac(int badge, uint8_t mac[6])
+{
+    const uint8_t base[6] = {0x34, 0x5f, 0x45, 0x00, (uint8_t)(badge >> 8), (uint8_t)badge};
+    memcpy(mac, base, 6);
+}
+
+static badge_t *badge_of(const uint8_t mac[6])
+{
+    for (int i = 0; i < s_badge_count; i++)
+    {
+        if (memcmp(s_badges[i].mac, mac, 6) == 0)
+        {
+            return &s_badges[i];
+        }
+    }
+    return NULL;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return s_now_us;
+}
+
+// Always listening: wake_sim covers badges that sleep
+bool badge_wake_listening(const uint8_t mac[6])
+{
+    (void)mac;
+    return true;
+}
+
+void delivery_push_post(const uint8_t mac[6], delivery_kind_t kind, delivery_state_t state, uint16_t done,
+                        uint16_t total, uint16_t retries)
+{
+    badge_t *b = badge_of(mac);
+    (void)kind;
+    (void)done;
+    (void)total;
+    (void)retries;
+    if (!b || b->finished || (state != DELIVERY_DONE && state != DELIVERY_FAILED))
+    {
+        return;
+    }
+    b->finished = true;
+    s_finished++;
+    s_res.time_ms = s_now_us / 1000.0;
+    if (state != DELIVERY_DONE)
+    {
+        return;
+    }
+    if (b->decoded == sizeof(b->out) && memcmp(b->out, s_image, sizeof(s_image)) == 0)
+    {
+        s_res.delivered++;
+    }
+    else
+    {
+        printf("FAIL: badge %d reported done without the image\n", (int)(b - s_badges));
+        s_res.corrupt++;
+    }
+}
+
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t *peer)
+{
+    (void)peer;
+    return ESP_OK;
+}
+
+esp_err_t esp_now_del_peer(const uint8_t *peer_addr)
+{
+    (void)peer_addr;
+    return ESP_OK;
+}
+
+esp_err_t esp_now_send(const uint8_t *peer_addr, const uint8_t *data, size_t len)
+{
+    badge_t *b = badge_of(peer_addr);
+    int to = b ? (int)(b - s_badges) + 1 : LOOPBACK_BROADCAST;
+    if (!b && memcmp(peer_addr, s_broadcast_mac, 6) != 0)
+    {
+        return ESP_ERR_ESPNOW_NOT_FOUND;
+    }
+    return loopback_send(&s_lb, GATEWAY, to, data, len) == 0 ? ESP_OK : ESP_ERR_ESPNOW_NO_MEM;
+}
+
+static int rx_send(void *ctx, const uint8_t *frame, size_t len)
+{
+    badge_t *b = ctx;
+    return loopback_send(&s_lb, (int)(b - s_badges) + 1, GATEWAY, frame, len);
+}
+
+static void decoded_out(void *ctx, const uint8_t *data, size_t len)
+{
+    badge_t *b = ctx;
+    if (b->decoded + len <= sizeof(b->out))
+    {
+        memcpy(b->out + b->decoded, data, len);
+    }
+    b->decoded += (uint32_t)len;
+}
+
+// As the badge firmware's logo sink (client_module/main/display.cpp)
+static bool sink_begin(void *ctx, uint32_t total_len, uint8_t encoding)
+{
+    badge_t *b = ctx;
+    if (!img_enc_supported(encoding) || total_len == 0 || (encoding == IMG_ENC_RAW && total_len != LOGO_BUF_SIZE))
+    {
+        return false;
+    }
+    b->decoded = 0;
+    img_decoder_init(&b->dec, (img_enc_t)encoding, LOGO_BUF_SIZE, decoded_out, b);
+    return true;
+}
+
+static void sink_write(void *ctx, uint32_t offset, const uint8_t *data, size_t len)
+{
+    badge_t *b = ctx;
+    (void)offset;
+    img_decoder_feed(&b->dec, data, len);
+}
+
+static void on_deliver(void *ctx, int to, int from, const uint8_t *frame, size_t len)
+{
+    (void)ctx;
+    s_now_us = (int64_t)s_lb.now_us;
+    if (to == GATEWAY)
+    {
+        logo_transfer_on_recv(s_badges[from - 1].mac, frame, (int)len);
+    }
+    else if (from == GATEWAY)
+    {
+        xfer_rx_handle(&s_badges[to - 1].rx, frame, len);
+    }
+}
+
+static void on_sent(void *ctx, int from, int to, bool ok)
+{
+    (void)ctx;
+    if (from != GATEWAY)
+    {
+        return;
+    }
+    s_now_us = (int64_t)s_lb.now_us;
+    const uint8_t *mac = to == LOOPBACK_BROADCAST ? s_broadcast_mac : s_badges[to - 1].mac;
+    if (peer_cache_on_sent(mac) == PEER_OWNER_LOGO)
+    {
+        logo_transfer_on_sent(mac, ok);
+    }
+}
+
+// Queues the logo for badges first .. first + count - 1 in one call
+static void queue_logo(int first, int count)
+{
+    uint8_t macs[XFER_MTX_MAX_RX][6];
+    uint8_t *image = malloc(sizeof(s_image));
+    if (!image)
+    {
+        return;
+    }
+    memcpy(image, s_image, sizeof(s_image));
+    for (int i = 0; i < count; i++)
+    {
+        memcpy(macs[i], s_badges[first + i].mac, 6);
+    }
+    logo_transfer_queue((const uint8_t(*)[6])macs, (size_t)count, image, sizeof(s_image));
+}
+
+// One run. logo_transfer.c keeps its state in statics and its task never
+// ends, so the caller gives every run a process of its own.
+static void simulate(fanout_mode_t mode, int badges, double loss, uint32_t seed)
+{
+    loopback_hooks_t hooks = {.deliver = on_deliver, .sent = on_sent};
+    loopback_init(&s_lb, badges + 1, loss, seed, &hooks);
+    s_badge_count = badges;
+    for (int i = 0; i < badges; i++)
+    {
+        badge_t *b = &s_badges[i];
+        xfer_link_t link = {.send = rx_send, .ctx = b};
+        xfer_sink_t sink = {.begin = sink_begin, .write = sink_write, .ctx = b};
+        badge_mac(i, b->mac);
+        xfer_rx_init(&b->rx, &link, &sink);
+    }
+    peer_cache_init();
+    logo_transfer_init();
+    host_task_run();
+
+    int queued = 0;
+    if (mode == MODE_BULK)
+    {
+        queue_logo(0, badges);
+        queued = badges;
+    }
+    else
+    {
+        for (; queued < (mode == MODE_EACH ? badges : 1); queued++)
+        {
+            queue_logo(queued, 1);
+        }
+    }
+    while (true)
+    {
+        host_task_run();
+        if (s_finished == badges)
+        {
+            break;
+        }
+        if (mode == MODE_IN_TURN && queued == s_finished && queued < badges)
+        {
+            queue_logo(queued++, 1);
+            continue;
+        }
+        int64_t t = host_task_next_us();
+        if (s_lb.count > 0 && (int64_t)s_lb.queue[s_lb.head].end_us < t)
+        {
+            t = (int64_t)s_lb.queue[s_lb.head].end_us;
+        }
+        if (t >= GIVE_UP_US)
+        {
+            s_res.time_ms = GIVE_UP_US / 1000.0;
+            break;
+        }
+        loopback_run(&s_lb, (uint64_t)t);
+        s_now_us = t;
+    }
+    s_res.air_ms = s_lb.stats.airtime_us / 1000.0;
+}
+
+static bool run(fanout_mode_t mode, int badges, double loss, uint32_t seed, result_t *res)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        return false;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        simulate(mode, badges, loss, seed);
+        _exit(write(fds[1], &s_res, sizeof(s_res)) == sizeof(s_res) ? 0 : 1);
+    }
+    close(fds[1]);
+    bool ok = pid > 0 && read(fds[0], res, sizeof(*res)) == sizeof(*res);
+    close(fds[0]);
+    int status;
+    return ok && waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static void set_px(int x, int y)
+{
+    if (x >= 0 && x < EINK_W && y >= 0 && y < EINK_H)
+    {
+        s_image[y * (EINK_W / 8) + x / 8] |= 0x80 >> (x % 8);
+    }
+}
+
+// A ring and a disc next to two bars of lettering, as in a typical company logo
+static void draw_logo(void)
+{
+    for (int y = 0; y < EINK_H; y++)
+    {
+        for (int x = 0; x < EINK_W; x++)
+        {
+            int dx = x - 260, dy = y - 240;
+            int r2 = dx * dx + dy * dy;
+            if ((r2 < 180 * 180 && r2 > 140 * 140) || r2 < 80 * 80 || (x >= 480 && x < 740 && y >= 140 && y < 200) ||
+                (x >= 480 && x < 680 && y >= 280 && y < 340))
+            {
+                set_px(x, y);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int runs = 3;
+    bool noise = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:r")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            runs = atoi(optarg);
+            break;
+        case 'r':
+            noise = true;
+            break;
+        default:
+            runs = 0;
+            break;
+        }
+    }
+    if (runs <= 0 || optind != argc)
+    {
+        fprintf(stderr, "usage: %s [-n runs] [-r]\n", argv[0]);
+        return 2;
+    }
+
+    uint32_t x = 0x12345678;
+    for (size_t i = 0; noise && i < sizeof(s_image); i++)
+    {
+        x = x * 1103515245 + 12345;
+        s_image[i] = (uint8_t)(x >> 16);
+    }
+    if (!noise)
+    {
+        draw_logo();
+    }
+    static uint8_t packed[LOGO_BUF_SIZE];
+    size_t lzss = img_encode(IMG_ENC_LZSS, s_image, sizeof(s_image), packed, sizeof(packed));
+    printf("%u-byte %s, ", (unsigned)sizeof(s_image), noise ? "noise image" : "logo");
+    if (lzss)
+    {
+        printf("%u bytes with lzss", (unsigned)lzss);
+    }
+    else
+    {
+        printf("sent raw");
+    }
+    printf(", %d kbit/s, %d runs each\n", LOOPBACK_RATE_KBPS, runs);
+    printf("               ----- one call -----   ---- per badge -----   ----- in turn ------\n");
+    printf("loss  badges   time ms  air ms  done   time ms  air ms  done   time ms  air ms  done\n");
+    int corrupt = 0;
+    for (size_t l = 0; l < sizeof(loss_rates) / sizeof(loss_rates[0]); l++)
+    {
+        for (size_t n = 0; n < sizeof(badge_counts) / sizeof(badge_counts[0]); n++)
+        {
+            int badges = badge_counts[n];
+            printf("%3.0f%%  %6d", loss_rates[l] * 100, badges);
+            for (int m = 0; m < MODE_COUNT; m++)
+            {
+                result_t sum = {0};
+                for (int r = 0; r < runs; r++)
+                {
+                    result_t res;
+                    if (!run((fanout_mode_t)m, badges, loss_rates[l], (uint32_t)(100000 * l + 1000 * n + r + 1), &res))
+                    {
+                        fprintf(stderr, "\nsimulation did not finish\n");
+                        return 1;
+                    }
+                    sum.time_ms += res.time_ms;
+                    sum.air_ms += res.air_ms;
+                    sum.delivered += res.delivered;
+                    sum.corrupt += res.corrupt;
+                }
+                corrupt += sum.corrupt;
+                printf("  %8.0f  %6.0f  %3.0f%%", sum.time_ms / runs, sum.air_ms / runs,
+                       sum.delivered * 100.0 / (runs * badges));
+            }
+            printf("\n");
+        }
+    }
+    return corrupt ? 1 : 0;
+}
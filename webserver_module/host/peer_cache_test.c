@@ -0,0 +1,269 @@
+// Drives peer_cache.c with far more badges than ESP-NOW has peer entries,
+// against a fake radio that enforces the real limits: at most
+// ESP_NOW_MAX_TOTAL_PEER_NUM peers, no duplicate peers, no sends to a badge
+// that is not a peer, and a bounded transmit queue whose send callbacks come
+// back in order. Sends come from both owners, mostly to a few busy badges
+// and otherwise to any of them; now and then a badge is forgotten, frames in
+// flight or not.
+//
+// Fails if a send reaches a badge that is not a peer, a peer with frames in
+// flight is deleted, a send callback is returned to the wrong owner, or the
+// cache stalls while an entry it could evict is idle.
+//
+// Usage: peer_cache_test [badges] [operations]
+//
+// Exit status: 0 if every check held, 1 if one did not, 2 on bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_now.h"
+#include "esp_timer.h"
+#include "peer_cache.h"
+
+#define RADIO_QUEUE 64 // frames ESP-NOW accepts before esp_now_send() fails
+#define HOT_BADGES 12  // badges that get three quarters of the traffic
+#define BROADCAST (-1)
+
+typedef struct
+{
+    int badge; // BROADCAST or index
+    peer_owner_t owner;
+} frame_t;
+
+static int s_badges = 250;
+static uint8_t s_peers[ESP_NOW_MAX_TOTAL_PEER_NUM][6];
+static int s_peer_count;
+static int *s_inflight; // per badge, frames in the radio queue
+static frame_t s_radio[RADIO_QUEUE];
+static int s_radio_head;
+static int s_radio_count;
+static peer_owner_t s_owner; // owner of the send in progress
+static int64_t s_now_us;
+static unsigned s_errors;
+static uint32_t s_rng = 1;
+
+static const uint8_t s_broadcast_mac[6] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+
+static uint32_t next_rand(void)
+{
+    s_rng = s_rng * 1103515245 + 12345;
+    return s_rng >> 8;
+}
+
+static void badge_mac(int badge, uint8_t mac[6])
+{
+    const uint8_t base[6] = {0x34, 0x5f, 0x45, 0x00, (uint8_t)(badge >> 8), (uint8_t)badge};
+    memcpy(mac, base, 6);
+}
+
+static int badge_of(const uint8_t mac[6])
+{
+    return memcmp(mac, s_broadcast_mac, 6) == 0 ? BROADCAST : (mac[4] << 8 | mac[5]);
+}
+
+static void fail(const char *what, const uint8_t mac[6])
+{
+    printf("FAIL: %s (%02x:%02x:%02x:%02x:%02x:%02x)\n", what, mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    s_errors++;
+}
+
+static int find_peer(const uint8_t mac[6])
+{
+    for (int i = 0; i < s_peer_count; i++)
+    {
+        if (memcmp(s_peers[i], mac, 6) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return s_now_us;
+}
+
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t *peer)
+{
+    if (find_peer(peer->peer_addr) >= 0)
+    {
+        fail("peer added twice", peer->peer_addr);
+        return ESP_ERR_ESPNOW_EXIST;
+    }
+    if (s_peer_count == ESP_NOW_MAX_TOTAL_PEER_NUM)
+    {
+        fail("peer table overflow", peer->peer_addr);
+        return ESP_ERR_ESPNOW_FULL;
+    }
+    memcpy(s_peers[s_peer_count++], peer->peer_addr, 6);
+    return ESP_OK;
+}
+
+esp_err_t esp_now_del_peer(const uint8_t *peer_addr)
+{
+    int i = find_peer(peer_addr);
+    if (i < 0)
+    {
+        fail("deleted a peer that does not exist", peer_addr);
+        return ESP_ERR_ESPNOW_NOT_FOUND;
+    }
+    int badge = badge_of(peer_addr);
+    if (badge == BROADCAST || s_inflight[badge] > 0)
+    {
+        fail("deleted a peer with frames in flight", peer_addr);
+    }
+    memmove(s_peers[i], s_peers[i + 1], (size_t)(s_peer_count - i - 1) * 6);
+    s_peer_count--;
+    return ESP_OK;
+}
+
+esp_err_t esp_now_send(const uint8_t *peer_addr, const uint8_t *data, size_t len)
+{
+    (void)data;
+    if (find_peer(peer_addr) < 0)
+    {
+        fail("send to a badge that is not a peer", peer_addr);
+        return ESP_ERR_ESPNOW_NOT_FOUND;
+    }
+    if (len > ESP_NOW_MAX_DATA_LEN)
+    {
+        return ESP_ERR_ESPNOW_ARG;
+    }
+    if (s_radio_count == RADIO_QUEUE)
+    {
+        return ESP_ERR_ESPNOW_NO_MEM;
+    }
+    frame_t *f = &s_radio[(s_radio_head + s_radio_count++) % RADIO_QUEUE];
+    f->badge = badge_of(peer_addr);
+    f->owner = s_owner;
+    if (f->badge != BROADCAST)
+    {
+        s_inflight[f->badge]++;
+    }
+    return ESP_OK;
+}
+
+// The oldest frame leaves the radio and its send callback fires.
+static void complete_one(void)
+{
+    frame_t f = s_radio[s_radio_head];
+    s_radio_head = (s_radio_head + 1) % RADIO_QUEUE;
+    s_radio_count--;
+    uint8_t mac[6];
+    if (f.badge == BROADCAST)
+    {
+        memcpy(mac, s_broadcast_mac, 6);
+    }
+    else
+    {
+        badge_mac(f.badge, mac);
+        s_inflight[f.badge]--;
+    }
+    if (peer_cache_on_sent(mac) != f.owner)
+    {
+        fail("send callback returned to the wrong owner", mac);
+    }
+}
+
+// A stall is only allowed if no badge entry could be given up.
+static void check_stall(const uint8_t mac[6])
+{
+    int badge = badge_of(mac);
+    if (find_peer(mac) >= 0 && s_inflight[badge] >= PEER_CACHE_INFLIGHT_MAX)
+    {
+        return;
+    }
+    for (int i = 0; i < s_peer_count; i++)
+    {
+        int other = badge_of(s_peers[i]);
+        if (other != BROADCAST && s_inflight[other] == 0)
+        {
+            fail("stalled while a peer was idle", mac);
+            return;
+        }
+    }
+    if (s_peer_count < ESP_NOW_MAX_TOTAL_PEER_NUM)
+    {
+        fail("stalled with room in the peer table", mac);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    long ops = 200000;
+    if (argc > 3 || (argc > 1 && (s_badges = atoi(argv[1])) <= 0) || (argc > 2 && (ops = atol(argv[2])) <= 0) ||
+        s_badges > 0xffff)
+    {
+        fprintf(stderr, "usage: %s [badges] [operations]\n", argv[0]);
+        return 2;
+    }
+    s_inflight = calloc((size_t)s_badges, sizeof(*s_inflight));
+    if (!s_inflight)
+    {
+        return 2;
+    }
+
+    peer_cache_init();
+    unsigned long sends = 0, sent = 0, stalls = 0, queue_full = 0, forgets = 0;
+    uint8_t data[10] = {0};
+    for (long op = 0; op < ops; op++)
+    {
+        s_now_us += 1000 + next_rand() % 4000;
+        if (s_radio_count > 0 && (next_rand() % 3 == 0 || s_radio_count > RADIO_QUEUE * 3 / 4))
+        {
+            complete_one();
+            continue;
+        }
+
+        uint8_t mac[6];
+        int badge = (next_rand() % 4) ? (int)(next_rand() % HOT_BADGES) : (int)(next_rand() % s_badges);
+        badge_mac(badge, mac);
+        if (next_rand() % 500 == 0)
+        {
+            peer_cache_forget(mac);
+            forgets++;
+            continue;
+        }
+        s_owner = (next_rand() % 3) ? PEER_OWNER_LOGO : PEER_OWNER_WAKE;
+        if (next_rand() % 50 == 0)
+        {
+            memcpy(mac, s_broadcast_mac, 6);
+            s_owner = PEER_OWNER_LOGO;
+        }
+        sends++;
+        esp_err_t err = peer_cache_send(mac, s_owner, data, sizeof(data));
+        if (err == ESP_OK)
+        {
+            sent++;
+        }
+        else if (err == ESP_ERR_ESPNOW_FULL)
+        {
+            stalls++;
+            check_stall(mac);
+        }
+        else if (err == ESP_ERR_ESPNOW_NO_MEM)
+        {
+            queue_full++;
+        }
+        else
+        {
+            fail("unexpected error", mac);
+        }
+    }
+    while (s_radio_count > 0)
+    {
+        complete_one();
+    }
+
+    peer_cache_stats_t st;
+    peer_cache_get_stats(&st);
+    printf("%d badges, %d peer entries: %lu sends, %lu sent, %lu stalled, %lu radio queue full, %lu forgotten\n",
+           s_badges, ESP_NOW_MAX_TOTAL_PEER_NUM, sends, sent, stalls, queue_full, forgets);
+    printf("cache: %lu hits, %lu adds, %lu evictions, %lu stalls\n", (unsigned long)st.hits,
+           (unsigned long)st.adds, (unsigned long)st.evictions, (unsigned long)st.stalls);
+    printf("%s\n", s_errors ? "FAILED" : "ok");
+    free(s_inflight);
+    return s_errors ? 1 : 0;
+}
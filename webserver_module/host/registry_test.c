@@ -0,0 +1,690 @@
+// Drives badge_registry.c against an in-memory NVS. The registry keeps its
+// state in statics, so each part runs in a child process; the flash they
+// share outlives them, like across a reboot.
+//
+// - churn: random adds and removes at capacity. Half of the badges have MACs
+//   that hash next to the end of the index, so probe runs wrap around and
+//   deletions shift entries back across it. After every step find() and
+//   count() must agree with a model, and now and then list() and macs()
+//   too. Writes to flash fail now and then; once changes stop, the blob on
+//   flash must hold exactly the model.
+// - reload: a fresh registry loads that blob and lists the same badges.
+// - legacy: the mac_N / alias_N keys of older firmware are imported, and
+//   erased only once the blob holding them has been written.
+// - retry: a write that failed is repeated without any further change.
+//
+// Usage: registry_test [operations]
+//
+// Exit status: 0 if every check held, 1 if one did not, 2 on bad usage.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "nvs.h"
+#include "badge_registry.h"
+
+#define NVS_ENTRIES 64
+#define NVS_VALUE_MAX (4 + BADGE_REGISTRY_MAX * sizeof(badge_entry_t))
+#define NVS_HANDLES 4
+
+// Same index layout as badge_registry.c, to pick MACs that collide
+#define INDEX_SIZE (BADGE_REGISTRY_MAX <= 16 ? 32 : 1 << (32 - __builtin_clz(BADGE_REGISTRY_MAX - 1) + 1))
+#define WRAP_WINDOW 8 // clustered MACs hash this close to the end of the index
+
+typedef struct
+{
+    char ns[16];
+    char key[16];
+    bool blob;
+    size_t len;
+    uint8_t value[NVS_VALUE_MAX];
+} nvs_entry_t;
+
+// Lives in memory shared with the children
+typedef struct
+{
+    nvs_entry_t entries[NVS_ENTRIES];
+    badge_entry_t expected[BADGE_REGISTRY_MAX]; // what churn left registered
+    int expected_count;
+} flash_t;
+
+typedef enum
+{
+    FAIL_NONE,
+    FAIL_SET,    // nvs_set_blob() runs out of space
+    FAIL_COMMIT, // nvs_commit() fails
+} fail_mode_t;
+
+typedef struct
+{
+    uint8_t mac[6];
+    char alias[BADGE_ALIAS_LEN];
+    int slot; // -1 while not registered
+} model_t;
+
+static flash_t *s_flash;
+static struct
+{
+    bool open;
+    char ns[16];
+    nvs_open_mode_t mode;
+} s_handles[NVS_HANDLES];
+static fail_mode_t s_fail;
+static unsigned long s_writes;  // blobs written and committed
+static unsigned long s_refused; // writes or commits that failed
+static int64_t s_now_us;
+static long s_ops = 200000;
+static unsigned s_errors;
+static uint32_t s_rng = 1;
+
+static uint32_t next_rand(void)
+{
+    s_rng = s_rng * 1103515245 + 12345;
+    return s_rng >> 8;
+}
+
+static void fail(const char *what, const uint8_t mac[6])
+{
+    if (mac)
+    {
+        printf("FAIL: %s (%02x:%02x:%02x:%02x:%02x:%02x)\n", what, mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    }
+    else
+    {
+        printf("FAIL: %s\n", what);
+    }
+    s_errors++;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return s_now_us;
+}
+
+bool parse_mac(const char *s, uint8_t mac[6])
+{
+    return strlen(s) == 17 && sscanf(s, "%2hhx:%2hhx:%2hhx:%2hhx:%2hhx:%2hhx", &mac[0], &mac[1], &mac[2], &mac[3],
+                                     &mac[4], &mac[5]) == 6;
+}
+
+static nvs_entry_t *find_entry(const char *ns, const char *key)
+{
+    for (int i = 0; i < NVS_ENTRIES; i++)
+    {
+        nvs_entry_t *e = &s_flash->entries[i];
+        if (e->ns[0] && strcmp(e->ns, ns) == 0 && (!key || strcmp(e->key, key) == 0))
+        {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static nvs_entry_t *put_entry(const char *ns, const char *key, bool blob, const void *value, size_t len)
+{
+    nvs_entry_t *e = find_entry(ns, key);
+    for (int i = 0; !e && i < NVS_ENTRIES; i++)
+    {
+        if (!s_flash->entries[i].ns[0])
+        {
+            e = &s_flash->entries[i];
+        }
+    }
+    if (e && len <= NVS_VALUE_MAX)
+    {
+        strlcpy(e->ns, ns, sizeof(e->ns));
+        strlcpy(e->key, key, sizeof(e->key));
+        e->blob = blob;
+        e->len = len;
+        memcpy(e->value, value, len);
+        return e;
+    }
+    return NULL;
+}
+
+static void put_str(const char *ns, const char *key, const char *value)
+{
+    put_entry(ns, key, false, value, strlen(value) + 1);
+}
+
+static const char *handle_ns(nvs_handle_t handle)
+{
+    if (handle == 0 || handle > NVS_HANDLES || !s_handles[handle - 1].open)
+    {
+        fail("NVS used through a closed handle", NULL);
+        return NULL;
+    }
+    return s_handles[handle - 1].ns;
+}
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    if (open_mode == NVS_READONLY && !find_entry(name, NULL))
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    for (int i = 0; i < NVS_HANDLES; i++)
+    {
+        if (!s_handles[i].open)
+        {
+            s_handles[i].open = true;
+            s_handles[i].mode = open_mode;
+            strlcpy(s_handles[i].ns, name, sizeof(s_handles[i].ns));
+            *out_handle = (nvs_handle_t)i + 1;
+            return ESP_OK;
+        }
+    }
+    fail("NVS handles leak", NULL);
+    return ESP_ERR_NO_MEM;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    if (handle_ns(handle))
+    {
+        s_handles[handle - 1].open = false;
+    }
+}
+
+static esp_err_t get_value(nvs_handle_t handle, const char *key, bool blob, void *out_value, size_t *length)
+{
+    const char *ns = handle_ns(handle);
+    nvs_entry_t *e = ns ? find_entry(ns, key) : NULL;
+    if (!e || e->blob != blob)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (out_value && *length < e->len)
+    {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    if (out_value)
+    {
+        memcpy(out_value, e->value, e->len);
+    }
+    *length = e->len;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    return get_value(handle, key, true, out_value, length);
+}
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char *key, char *out_value, size_t *length)
+{
+    return get_value(handle, key, false, out_value, length);
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    const char *ns = handle_ns(handle);
+    if (!ns || s_handles[handle - 1].mode != NVS_READWRITE)
+    {
+        fail("NVS written through a read-only handle", NULL);
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    if (s_fail == FAIL_SET)
+    {
+        s_refused++;
+        return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+    }
+    return put_entry(ns, key, true, value, length) ? ESP_OK : ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle)
+{
+    const char *ns = handle_ns(handle);
+    nvs_entry_t *e;
+    while (ns && (e = find_entry(ns, NULL)) != NULL)
+    {
+        memset(e, 0, sizeof(*e));
+    }
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    if (!handle_ns(handle))
+    {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    if (s_fail == FAIL_COMMIT)
+    {
+        s_refused++;
+        return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+    }
+    s_writes++;
+    return ESP_OK;
+}
+
+// Moves the clock on by ms, running the flush task whenever it is due
+static void advance(uint32_t ms)
+{
+    int64_t end = s_now_us + ms * 1000LL;
+    host_task_run();
+    for (int64_t next = host_task_next_us(); next <= end; next = host_task_next_us())
+    {
+        s_now_us = next;
+        host_task_run();
+    }
+    s_now_us = end;
+}
+
+static uint32_t home(const uint8_t mac[6])
+{
+    uint64_t key = 0;
+    for (int i = 0; i < 6; i++)
+    {
+        key = (key << 8) | mac[i];
+    }
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & (INDEX_SIZE - 1);
+}
+
+static void random_alias(char alias[BADGE_ALIAS_LEN])
+{
+    int len = (int)(next_rand() % BADGE_ALIAS_LEN);
+    for (int i = 0; i < len; i++)
+    {
+        alias[i] = (char)('a' + next_rand() % 26);
+    }
+    alias[len] = '\0';
+}
+
+// Compares badges, as listed or read from a blob, with what should be registered
+static void check_entries(const char *what, const badge_entry_t *got, size_t count, const badge_entry_t *want,
+                          size_t want_count)
+{
+    if (count != want_count)
+    {
+        printf("FAIL: %s has %zu badges instead of %zu\n", what, count, want_count);
+        s_errors++;
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t j = 0;
+        while (j < want_count && memcmp(got[i].mac, want[j].mac, 6) != 0)
+        {
+            j++;
+        }
+        if (j == want_count)
+        {
+            fail(what, got[i].mac);
+        }
+        else if (strncmp(got[i].alias, want[j].alias, BADGE_ALIAS_LEN) != 0)
+        {
+            fail("alias changed", got[i].mac);
+        }
+    }
+}
+
+// The registry blob on flash, 0 badges if there is none
+static size_t read_blob(badge_entry_t *out)
+{
+    nvs_entry_t *e = find_entry("badge_reg", "table");
+    if (!e)
+    {
+        return 0;
+    }
+    uint16_t count;
+    memcpy(&count, e->value + 2, sizeof(count));
+    if (e->value[0] != 1 || e->len != 4 + count * sizeof(badge_entry_t) || count > BADGE_REGISTRY_MAX)
+    {
+        fail("registry blob malformed", NULL);
+        return 0;
+    }
+    memcpy(out, e->value + 4, count * sizeof(badge_entry_t));
+    return count;
+}
+
+static size_t model_entries(const model_t *pool, int pool_size, badge_entry_t *out)
+{
+    size_t n = 0;
+    for (int i = 0; i < pool_size; i++)
+    {
+        if (pool[i].slot >= 0)
+        {
+            memcpy(out[n].mac, pool[i].mac, 6);
+            memcpy(out[n].alias, pool[i].alias, BADGE_ALIAS_LEN);
+            n++;
+        }
+    }
+    return n;
+}
+
+static void check_all(const model_t *pool, int pool_size, int registered)
+{
+    static badge_entry_t listed[BADGE_REGISTRY_MAX], want[BADGE_REGISTRY_MAX];
+    static int slots[BADGE_REGISTRY_MAX];
+    static uint8_t macs[BADGE_REGISTRY_MAX][6];
+    for (int i = 0; i < pool_size; i++)
+    {
+        if (badge_registry_find(pool[i].mac) != pool[i].slot)
+        {
+            fail(pool[i].slot < 0 ? "found a removed badge" : "badge lost or moved", pool[i].mac);
+        }
+    }
+    size_t n = badge_registry_list(listed, slots, BADGE_REGISTRY_MAX);
+    check_entries("list", listed, n, want, model_entries(pool, pool_size, want));
+    for (size_t i = 0; i < n; i++)
+    {
+        if (badge_registry_find(listed[i].mac) != slots[i])
+        {
+            fail("listed under another slot", listed[i].mac);
+        }
+    }
+    if (badge_registry_macs(macs, BADGE_REGISTRY_MAX) != (size_t)registered)
+    {
+        fail("macs() count differs", NULL);
+    }
+    for (int i = 0; i < registered; i++)
+    {
+        if (badge_registry_find(macs[i]) < 0)
+        {
+            fail("macs() lists an unregistered badge", macs[i]);
+        }
+    }
+}
+
+static void churn(long ops)
+{
+    int pool_size = 2 * BADGE_REGISTRY_MAX;
+    model_t *pool = calloc((size_t)pool_size, sizeof(*pool));
+    bool slot_used[BADGE_REGISTRY_MAX] = {false};
+    if (!pool)
+    {
+        fail("out of memory", NULL);
+        return;
+    }
+    for (int i = 0; i < pool_size; i++)
+    {
+        model_t *m = &pool[i];
+        bool clustered = i % 2;
+        uint32_t tag = next_rand();
+        do
+        {
+            const uint8_t mac[6] = {0x02, (uint8_t)(clustered << 7 | i >> 8), (uint8_t)i, (uint8_t)(tag >> 16),
+                                    (uint8_t)(tag >> 8), (uint8_t)tag};
+            memcpy(m->mac, mac, 6);
+            tag++;
+        } while (clustered && ((home(m->mac) + WRAP_WINDOW) & (INDEX_SIZE - 1)) >= 2 * WRAP_WINDOW);
+        m->slot = -1;
+    }
+    if (badge_registry_init() != ESP_OK)
+    {
+        fail("init", NULL);
+    }
+
+    int registered = 0;
+    unsigned long adds = 0, removes = 0, full = 0;
+    for (long op = 0; op < ops; op++)
+    {
+        s_now_us += 1000 + next_rand() % 3000;
+        if (next_rand() % 1000 == 0)
+        {
+            s_fail = (fail_mode_t)(next_rand() % 3);
+        }
+        if (next_rand() % 300 == 0)
+        {
+            advance(2500 + next_rand() % 12000); // let a write, or its retry, happen
+        }
+
+        model_t *m = &pool[next_rand() % pool_size];
+        esp_err_t err;
+        if (m->slot >= 0 && next_rand() % 3 == 0)
+        {
+            err = badge_registry_add(m->mac, "again");
+            if (err != ESP_ERR_INVALID_STATE)
+            {
+                fail("registered twice", m->mac);
+            }
+        }
+        else if (m->slot >= 0)
+        {
+            if (badge_registry_remove(m->mac) != ESP_OK)
+            {
+                fail("remove failed", m->mac);
+            }
+            slot_used[m->slot] = false;
+            m->slot = -1;
+            registered--;
+            removes++;
+        }
+        else if (next_rand() % 5 == 0)
+        {
+            if (badge_registry_remove(m->mac) != ESP_ERR_NOT_FOUND)
+            {
+                fail("removed a badge that was not registered", m->mac);
+            }
+        }
+        else
+        {
+            random_alias(m->alias);
+            err = badge_registry_add(m->mac, m->alias);
+            if (registered == BADGE_REGISTRY_MAX)
+            {
+                full++;
+                if (err != ESP_ERR_NO_MEM)
+                {
+                    fail("added beyond capacity", m->mac);
+                }
+            }
+            else if (err != ESP_OK)
+            {
+                fail("add failed", m->mac);
+            }
+            else
+            {
+                int slot = badge_registry_find(m->mac);
+                if (slot < 0 || slot >= BADGE_REGISTRY_MAX || slot_used[slot])
+                {
+                    fail("added to a bad slot", m->mac);
+                }
+                else
+                {
+                    slot_used[slot] = true;
+                    m->slot = slot;
+                    registered++;
+                    adds++;
+                }
+            }
+        }
+        host_task_run();
+
+        if (badge_registry_find(m->mac) != m->slot)
+        {
+            fail("find() disagrees", m->mac);
+        }
+        if (badge_registry_count() != (size_t)registered)
+        {
+            fail("count() disagrees", NULL);
+        }
+        if (op % 1000 == 0)
+        {
+            check_all(pool, pool_size, registered);
+        }
+    }
+    check_all(pool, pool_size, registered);
+
+    // Once the failures stop, the retry has to bring flash up to date
+    s_fail = FAIL_NONE;
+    advance(15000);
+    static badge_entry_t blob[BADGE_REGISTRY_MAX];
+    size_t n = read_blob(blob);
+    s_flash->expected_count = (int)model_entries(pool, pool_size, s_flash->expected);
+    check_entries("blob", blob, n, s_flash->expected, (size_t)s_flash->expected_count);
+    printf("churn: %ld operations, %lu adds, %lu removes, %lu refused as full, %d registered; "
+           "%lu writes, %lu failed\n",
+           ops, adds, removes, full, registered, s_writes, s_refused);
+    free(pool);
+}
+
+static void reload(void)
+{
+    static badge_entry_t listed[BADGE_REGISTRY_MAX];
+    if (badge_registry_init() != ESP_OK)
+    {
+        fail("init", NULL);
+    }
+    size_t n = badge_registry_list(listed, NULL, BADGE_REGISTRY_MAX);
+    check_entries("reloaded registry", listed, n, s_flash->expected, (size_t)s_flash->expected_count);
+    for (int i = 0; i < s_flash->expected_count; i++)
+    {
+        if (badge_registry_find(s_flash->expected[i].mac) < 0)
+        {
+            fail("not found after reload", s_flash->expected[i].mac);
+        }
+    }
+    advance(60000);
+    if (s_writes > 0)
+    {
+        fail("written back without a change", NULL);
+    }
+    printf("reload: %zu badges\n", n);
+}
+
+static void put_legacy(void)
+{
+    memset(s_flash, 0, sizeof(*s_flash));
+    put_str("mac_store", "mac_0", "aa:bb:cc:00:00:01");
+    put_str("mac_store", "alias_0", "Ada");
+    put_str("mac_store", "mac_3", "AA:BB:CC:00:00:03");
+    put_str("mac_store", "mac_5", "not a mac");
+    put_str("mac_store", "mac_7", "aa:bb:cc:00:00:01"); // the same badge again
+    put_str("mac_store", "alias_7", "Ada twice");
+    put_str("mac_store", "mac_19", "aa:bb:cc:00:00:13");
+    put_str("mac_store", "alias_19", "abcdefghijklmnopqrstuvwxyz012345");
+}
+
+static void check_legacy(void)
+{
+    static const badge_entry_t want[] = {
+        {{0xaa, 0xbb, 0xcc, 0, 0, 0x01}, "Ada"},
+        {{0xaa, 0xbb, 0xcc, 0, 0, 0x03}, ""},
+        {{0xaa, 0xbb, 0xcc, 0, 0, 0x13}, "abcdefghijklmnopqrstuvwxyz012345"},
+    };
+    static badge_entry_t listed[BADGE_REGISTRY_MAX];
+    size_t n = badge_registry_list(listed, NULL, BADGE_REGISTRY_MAX);
+    check_entries("imported registry", listed, n, want, 3);
+    n = read_blob(listed);
+    check_entries("blob after import", listed, n, want, s_fail == FAIL_NONE ? 3 : 0);
+}
+
+static void legacy(void)
+{
+    put_legacy();
+    if (badge_registry_init() != ESP_OK)
+    {
+        fail("init", NULL);
+    }
+    check_legacy();
+    if (find_entry("mac_store", NULL))
+    {
+        fail("legacy keys kept after the import was saved", NULL);
+    }
+    printf("legacy: 3 badges imported\n");
+}
+
+static void legacy_unsaved(void)
+{
+    put_legacy();
+    s_fail = FAIL_SET;
+    if (badge_registry_init() != ESP_OK)
+    {
+        fail("init", NULL);
+    }
+    check_legacy();
+    if (!find_entry("mac_store", "mac_0"))
+    {
+        fail("legacy keys erased though the import was not saved", NULL);
+    }
+    s_fail = FAIL_NONE;
+    advance(15000);
+    check_legacy();
+    printf("legacy, first write failing: imported, saved on retry\n");
+}
+
+static void retry(void)
+{
+    memset(s_flash, 0, sizeof(*s_flash));
+    if (badge_registry_init() != ESP_OK)
+    {
+        fail("init", NULL);
+    }
+    badge_entry_t want[3] = {0};
+    for (int i = 0; i < 3; i++)
+    {
+        const uint8_t mac[6] = {0x02, 0, 0, 0, 0, (uint8_t)i};
+        memcpy(want[i].mac, mac, 6);
+        badge_registry_add(mac, "");
+    }
+    s_fail = FAIL_COMMIT;
+    advance(CONFIG_BADGE_REGISTRY_FLUSH_MS + 500);
+    if (s_refused != 1)
+    {
+        fail("write not attempted", NULL);
+    }
+    s_fail = FAIL_NONE;
+    advance(15000);
+    static badge_entry_t blob[BADGE_REGISTRY_MAX];
+    check_entries("blob after retry", blob, read_blob(blob), want, 3);
+    if (s_writes != 1)
+    {
+        fail("failed write not retried exactly once", NULL);
+    }
+    advance(60000);
+    if (s_writes != 1)
+    {
+        fail("written again after the retry succeeded", NULL);
+    }
+    printf("retry: saved on the second attempt\n");
+}
+
+// Runs part in a child, so that it starts with a registry fresh from boot
+static bool run(void (*part)(void))
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        part();
+        fflush(stdout);
+        _exit(s_errors ? 1 : 0);
+    }
+    int status;
+    return pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static void churn_part(void)
+{
+    churn(s_ops);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 2 || (argc > 1 && (s_ops = atol(argv[1])) <= 0))
+    {
+        fprintf(stderr, "usage: %s [operations]\n", argv[0]);
+        return 2;
+    }
+    s_flash = mmap(NULL, sizeof(*s_flash), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (s_flash == MAP_FAILED)
+    {
+        return 2;
+    }
+
+    bool ok = run(churn_part);
+    ok &= run(reload);
+    ok &= run(legacy);
+    ok &= run(legacy_unsaved);
+    ok &= run(retry);
+    printf("%s\n", ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
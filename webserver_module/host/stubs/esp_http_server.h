@@ -0,0 +1,10 @@
+#ifndef ESP_HTTP_SERVER_H
+#define ESP_HTTP_SERVER_H
+
+#include <stdbool.h>
+
+// Only the handle types the gateway headers mention; no server runs on the host
+typedef void *httpd_handle_t;
+typedef struct httpd_req httpd_req_t;
+
+#endif // ESP_HTTP_SERVER_H
@@ -0,0 +1,14 @@
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+// Log lines up to this level reach stderr: 0 none, 1 errors ... 4 debug
+extern int host_log_level;
+
+void host_log(int level, const char *tag, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+#define ESP_LOGE(tag, fmt, ...) host_log(1, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) host_log(2, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) host_log(3, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) host_log(4, tag, fmt, ##__VA_ARGS__)
+
+#endif // ESP_LOG_H
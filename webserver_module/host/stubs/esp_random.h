@@ -0,0 +1,9 @@
+#ifndef ESP_RANDOM_H
+#define ESP_RANDOM_H
+
+#include <stdint.h>
+
+// Deterministic, so that runs repeat
+uint32_t esp_random(void);
+
+#endif // ESP_RANDOM_H
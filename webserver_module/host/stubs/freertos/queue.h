@@ -0,0 +1,19 @@
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include "FreeRTOS.h"
+
+typedef struct host_queue *QueueHandle_t;
+
+#define errQUEUE_FULL pdFALSE
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+
+// Never blocks: a full queue fails at once, as with a zero wait.
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t wait);
+
+// Blocks only when called from a task (freertos/task.h); elsewhere an empty
+// queue fails at once.
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait);
+
+#endif // QUEUE_H
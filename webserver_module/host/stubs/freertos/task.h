@@ -0,0 +1,26 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void *arg);
+typedef struct host_task *TaskHandle_t;
+
+// Tasks run cooperatively on their own stacks, one at a time, and only give
+// up the CPU where they would block: in xQueueReceive(), vTaskDelay() and
+// ulTaskNotifyTake().
+// Stack size and priority are ignored.
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg, UBaseType_t priority,
+                       TaskHandle_t *handle);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait);
+
+// Driven by the program under test, which owns the clock: runs every task
+// whose wait is over at esp_timer_get_time() until all of them block again.
+void host_task_run(void);
+
+// Time at which the next blocked task times out, INT64_MAX if none will.
+int64_t host_task_next_us(void);
+
+#endif // TASK_H
@@ -0,0 +1,268 @@
+// What the stand-in headers declare and the programs under test do not
+// provide themselves.
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define HOST_TASKS_MAX 8
+#define HOST_STACK_SIZE (256 * 1024)
+
+struct host_sem
+{
+    int taken;
+};
+
+struct host_queue
+{
+    size_t item_size;
+    UBaseType_t length;
+    UBaseType_t head;
+    UBaseType_t count;
+    uint8_t *items;
+};
+
+struct host_task
+{
+    ucontext_t ctx;
+    TaskFunction_t fn;
+    void *arg;
+    bool blocked;
+    struct host_queue *waiting_on; // NULL while in vTaskDelay()
+    bool waiting_notify;           // in ulTaskNotifyTake()
+    uint32_t notify;               // notification count
+    int64_t wake_us;               // INT64_MAX: no timeout
+};
+
+static struct host_task *s_tasks[HOST_TASKS_MAX];
+static int s_task_count;
+static struct host_task *s_current; // NULL outside the tasks
+static ucontext_t s_scheduler;
+
+int host_log_level;
+
+void host_log(int level, const char *tag, const char *fmt, ...)
+{
+    static const char levels[] = "-EWID";
+    if (level > host_log_level)
+    {
+        return;
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "%c (%s) ", levels[level], tag);
+    vfprintf(stderr, fmt, ap);
+    fputc('\n', stderr);
+    va_end(ap);
+}
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    static char buf[16];
+    snprintf(buf, sizeof(buf), "0x%x", (unsigned)code);
+    return code == ESP_OK ? "ESP_OK" : buf;
+}
+
+// Single-threaded: a mutex only checks that it is used in pairs
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return calloc(1, sizeof(struct host_sem));
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait)
+{
+    (void)wait;
+    assert(!sem->taken);
+    sem->taken = 1;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    assert(sem->taken);
+    sem->taken = 0;
+    return pdTRUE;
+}
+
+#ifdef HOST_NEED_STRLCPY
+size_t strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+    if (size > 0)
+    {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
+
+uint32_t esp_random(void)
+{
+    static uint32_t x = 1;
+    x = x * 1103515245 + 12345;
+    return x;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct host_queue *q = calloc(1, sizeof(*q));
+    if (q)
+    {
+        q->item_size = item_size;
+        q->length = length;
+        q->items = malloc((size_t)length * item_size);
+    }
+    return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait)
+{
+    (void)wait;
+    if (q->count == q->length)
+    {
+        return errQUEUE_FULL;
+    }
+    memcpy(q->items + (size_t)((q->head + q->count++) % q->length) * q->item_size, item, q->item_size);
+    return pdTRUE;
+}
+
+// Back to host_task_run() until the queue has an item or the wait is over
+static void block(struct host_queue *q, TickType_t ticks)
+{
+    struct host_task *t = s_current;
+    t->blocked = true;
+    t->waiting_on = q;
+    t->wake_us = ticks == portMAX_DELAY ? INT64_MAX : esp_timer_get_time() + (int64_t)ticks * portTICK_PERIOD_MS * 1000;
+    swapcontext(&t->ctx, &s_scheduler);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait)
+{
+    if (q->count == 0 && wait > 0 && s_current)
+    {
+        block(q, wait);
+    }
+    if (q->count == 0)
+    {
+        return pdFALSE;
+    }
+    memcpy(item, q->items + (size_t)q->head * q->item_size, q->item_size);
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+    return pdTRUE;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    assert(s_current);
+    block(NULL, ticks);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    task->notify++;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait)
+{
+    struct host_task *t = s_current;
+    assert(t);
+    if (t->notify == 0 && wait > 0)
+    {
+        t->waiting_notify = true;
+        block(NULL, wait);
+        t->waiting_notify = false;
+    }
+    uint32_t count = t->notify;
+    t->notify = (clear_on_exit || count == 0) ? 0 : count - 1;
+    return count;
+}
+
+static void task_entry(void)
+{
+    s_current->fn(s_current->arg);
+    fprintf(stderr, "a task returned\n");
+    abort();
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg, UBaseType_t priority,
+                       TaskHandle_t *handle)
+{
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+    struct host_task *t = calloc(1, sizeof(*t));
+    void *stack = malloc(HOST_STACK_SIZE);
+    if (!t || !stack || s_task_count == HOST_TASKS_MAX || getcontext(&t->ctx) != 0)
+    {
+        free(t);
+        free(stack);
+        return pdFALSE;
+    }
+    t->fn = fn;
+    t->arg = arg;
+    t->ctx.uc_stack.ss_sp = stack;
+    t->ctx.uc_stack.ss_size = HOST_STACK_SIZE;
+    t->ctx.uc_link = NULL;
+    makecontext(&t->ctx, task_entry, 0);
+    s_tasks[s_task_count++] = t;
+    if (handle)
+    {
+        *handle = t;
+    }
+    return pdPASS;
+}
+
+static bool task_ready(const struct host_task *t, int64_t now)
+{
+    return !t->blocked || (t->waiting_on && t->waiting_on->count > 0) || (t->waiting_notify && t->notify > 0) ||
+           now >= t->wake_us;
+}
+
+void host_task_run(void)
+{
+    assert(!s_current);
+    bool ran = true;
+    while (ran)
+    {
+        ran = false;
+        for (int i = 0; i < s_task_count; i++)
+        {
+            struct host_task *t = s_tasks[i];
+            if (task_ready(t, esp_timer_get_time()))
+            {
+                t->blocked = false;
+                s_current = t;
+                swapcontext(&s_scheduler, &t->ctx);
+                s_current = NULL;
+                ran = true;
+            }
+        }
+    }
+}
+
+int64_t host_task_next_us(void)
+{
+    int64_t next = INT64_MAX;
+    for (int i = 0; i < s_task_count; i++)
+    {
+        if (s_tasks[i]->blocked && s_tasks[i]->wake_us < next)
+        {
+            next = s_tasks[i]->wake_us;
+        }
+    }
+    return next;
+}
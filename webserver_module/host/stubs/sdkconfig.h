@@ -0,0 +1,8 @@
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+// The gateway's settings (webserver_module/sdkconfig) that the host builds use
+#define CONFIG_BADGE_REGISTRY_MAX 128
+#define CONFIG_BADGE_REGISTRY_FLUSH_MS 2000
+
+#endif // SDKCONFIG_H
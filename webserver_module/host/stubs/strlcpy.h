@@ -0,0 +1,9 @@
+#ifndef STRLCPY_H
+#define STRLCPY_H
+
+#include <stddef.h>
+
+// newlib has strlcpy(), glibc only since 2.38: force-included where missing
+size_t strlcpy(char *dst, const char *src, size_t size);
+
+#endif // STRLCPY_H
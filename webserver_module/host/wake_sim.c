@@ -0,0 +1,564 @@
+// Replays a conference day of badge updates through the gateway's
+// badge_wake.c over the simulated ESP-NOW channel of loopback.c, against
+// badges that sleep between wake windows as client_module/main/power.c does:
+// each announces a window with a HELLO every wake interval, keeps its radio
+// on for the window and, after every frame from the gateway, for the active
+// hold, and misses whatever arrives while it is off. The same day runs with
+// the badges always listening and at a range of wake intervals; for each the
+// harness reports how long updates took to reach the badge, how much of the
+// day the badge radio was on, the badge's energy over the day and the extra
+// energy an update cost compared with the same day without any.
+//
+// The command log has one update per line: seconds since the doors opened,
+// badge number and message length in bytes; # starts a comment. Without one
+// a built-in day is used: every badge gets its name during the first hour of
+// registration, half of them a new session at each hour, all of them a long
+// announcement at once at lunch and a few personal updates in between.
+//
+// Usage: wake_sim [-b badges] [-l loss] [log]
+//
+// Exit status: 0 if every update the gateway reported delivered had reached
+// its badge whole, 1 if one had not, 2 on bad usage or an unreadable log.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "esp_now.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "badge_wake.h"
+#include "badge_registry.h"
+#include "delivery_push.h"
+#include "peer_cache.h"
+#include "cmd_proto.h"
+#include "wake_proto.h"
+#include "loopback.h"
+
+#define GATEWAY 0
+#define WINDOW_MS 60          // CONFIG_BADGE_WAKE_WINDOW_MS
+#define HOLD_MS 1500          // CONFIG_BADGE_ACTIVE_HOLD_MS
+#define DRAIN_US (600LL * 1000 * 1000) // simulated after the last update
+#define MSG_MIN 8             // room for the update number
+#define RADIO_MW 330.0        // ESP32 receiving, about 100 mA at 3.3 V
+#define SLEEP_MW 2.6          // light sleep with the radio off, about 0.8 mA
+
+// 0: power saving off, the radio always on
+static const uint32_t intervals_ms[] = {0, 500, 1000, 2000, 5000};
+
+typedef struct
+{
+    int64_t at_us;
+    int badge;
+    int len;
+    int seq; // position in the log, keeps equal times in order
+} update_t;
+
+typedef struct
+{
+    int updates;
+    int delivered;   // reached the badge whole and not replaced before
+    int failed;      // given up by the gateway, or refused at once
+    int superseded;  // replaced by a newer update before it got there
+    int undelivered; // still on the way when the simulation ended
+    int bad;         // reported delivered but not on the badge
+    double lat_mean_ms;
+    double lat_p95_ms;
+    double lat_max_ms;
+    double on_ms;   // radio-on time, every badge together
+    double span_ms; // simulated time
+    uint32_t frames;
+} result_t;
+
+typedef struct
+{
+    cmd_rx_t rx;
+    uint8_t mac[6];
+    wake_hello_t hello;
+    int64_t next_hello_us;
+    int64_t awake_until_us;
+    int64_t on_since_us;
+    int64_t on_us;
+    bool radio_on;
+    int latest; // newest update sent to it, -1 for none
+    int shown;  // newest update it reassembled
+    int64_t issued_us;
+} badge_t;
+
+static badge_t *s_badges;
+static int s_badge_count = 50;
+static uint32_t s_interval_ms;
+static double s_loss;
+static loopback_t s_lb;
+static int64_t s_now_us;
+static double *s_latency;
+static result_t s_res;
+static uint32_t s_rng = 1;
+
+static uint32_t next_rand(void)
+{
+    s_rng = s_rng * 1103515245 + 12345;
+    return s_rng >> 8;
+}
+
+static void badge_mac(int badge, uint8_t mac[6])
+{
+    const uint8_t base[6] = {0x34, 0x5f, 0x45, 0x00, (uint8_t)(badge >> 8), (uint8_t)badge};
+    memcpy(mac, base, 6);
+}
+
+static badge_t *badge_of(const uint8_t mac[6])
+{
+    uint8_t own[6];
+    int badge = mac[4] << 8 | mac[5];
+    if (badge >= s_badge_count)
+    {
+        return NULL;
+    }
+    badge_mac(badge, own);
+    return memcmp(own, mac, 6) == 0 ? &s_badges[badge] : NULL;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return s_now_us;
+}
+
+int badge_registry_find(const uint8_t mac[6])
+{
+    badge_t *b = badge_of(mac);
+    return b ? (int)(b - s_badges) : -1;
+}
+
+void delivery_push_post(const uint8_t mac[6], delivery_kind_t kind, delivery_state_t state, uint16_t done,
+                        uint16_t total, uint16_t retries)
+{
+    badge_t *b = badge_of(mac);
+    (void)kind;
+    (void)done;
+    (void)total;
+    (void)retries;
+    if (state == DELIVERY_DONE && b->shown != b->latest)
+    {
+        printf("FAIL: update %d reported delivered to badge %d, which shows %d\n", b->latest, (int)(b - s_badges),
+               b->shown);
+        s_res.bad++;
+    }
+    else if (state == DELIVERY_FAILED)
+    {
+        s_res.failed++;
+    }
+}
+
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t *peer)
+{
+    (void)peer;
+    return ESP_OK;
+}
+
+esp_err_t esp_now_del_peer(const uint8_t *peer_addr)
+{
+    (void)peer_addr;
+    return ESP_OK;
+}
+
+esp_err_t esp_now_send(const uint8_t *peer_addr, const uint8_t *data, size_t len)
+{
+    badge_t *b = badge_of(peer_addr);
+    if (!b)
+    {
+        return ESP_ERR_ESPNOW_NOT_FOUND;
+    }
+    return loopback_send(&s_lb, GATEWAY, (int)(b - s_badges) + 1, data, len) == 0 ? ESP_OK : ESP_ERR_ESPNOW_NO_MEM;
+}
+
+// Turns the radio off once the window and the holds are over; true while on.
+static bool settle(badge_t *b, int64_t now)
+{
+    if (b->radio_on && now >= b->awake_until_us)
+    {
+        b->radio_on = false;
+        b->on_us += b->awake_until_us - b->on_since_us;
+    }
+    return b->radio_on;
+}
+
+static void keep_awake(badge_t *b, int64_t now, int64_t hold_us)
+{
+    if (!settle(b, now))
+    {
+        b->radio_on = true;
+        b->on_since_us = now;
+    }
+    if (now + hold_us > b->awake_until_us)
+    {
+        b->awake_until_us = now + hold_us;
+    }
+}
+
+static bool on_listening(void *ctx, int node)
+{
+    (void)ctx;
+    return node == GATEWAY || settle(&s_badges[node - 1], (int64_t)s_lb.now_us);
+}
+
+static void on_deliver(void *ctx, int to, int from, const uint8_t *frame, size_t len)
+{
+    (void)ctx;
+    s_now_us = (int64_t)s_lb.now_us;
+    if (to == GATEWAY)
+    {
+        badge_wake_on_recv(s_badges[from - 1].mac, frame, (int)len);
+        return;
+    }
+    if (from != GATEWAY)
+    {
+        return; // badges drop each other's HELLOs before they count as activity
+    }
+    badge_t *b = &s_badges[to - 1];
+    keep_awake(b, s_now_us, HOLD_MS * 1000LL);
+    const uint8_t *msg;
+    size_t msg_len;
+    if (cmd_rx_handle(&b->rx, frame, len, &msg, &msg_len) == CMD_RX_COMPLETE)
+    {
+        int update;
+        memcpy(&update, msg, sizeof(update));
+        if (update == b->latest && b->shown != update)
+        {
+            s_latency[s_res.delivered++] = (s_now_us - b->issued_us) / 1000.0;
+        }
+        b->shown = update;
+    }
+}
+
+static void on_sent(void *ctx, int from, int to, bool ok)
+{
+    (void)ctx;
+    if (from != GATEWAY)
+    {
+        return;
+    }
+    s_now_us = (int64_t)s_lb.now_us;
+    if (peer_cache_on_sent(s_badges[to - 1].mac) == PEER_OWNER_WAKE)
+    {
+        badge_wake_on_sent(s_badges[to - 1].mac, ok);
+    }
+}
+
+static void send_hello(badge_t *b)
+{
+    keep_awake(b, s_now_us, WINDOW_MS * 1000LL);
+    loopback_send(&s_lb, (int)(b - s_badges) + 1, LOOPBACK_BROADCAST, (const uint8_t *)&b->hello, sizeof(b->hello));
+    b->hello.seq++;
+    b->hello.flags = 0;
+    b->next_hello_us += s_interval_ms * 1000LL;
+}
+
+static void issue(const update_t *u)
+{
+    badge_t *b = &s_badges[u->badge];
+    uint8_t msg[CMD_MSG_MAX];
+    if (b->latest >= 0 && b->shown != b->latest)
+    {
+        s_res.superseded++;
+    }
+    for (int i = 0; i < u->len; i++)
+    {
+        msg[i] = (uint8_t)(u->seq + i);
+    }
+    memcpy(msg, &u->seq, sizeof(u->seq));
+    b->latest = u->seq;
+    b->issued_us = s_now_us;
+    bool queued;
+    if (badge_wake_send(b->mac, msg, (size_t)u->len, &queued) != ESP_OK)
+    {
+        s_res.failed++;
+    }
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// One day at one interval. badge_wake.c keeps its state in statics and its
+// task never ends, so the caller gives every run a process of its own.
+static void simulate(const update_t *log, int count, int64_t end_us)
+{
+    loopback_hooks_t hooks = {.deliver = on_deliver, .sent = on_sent, .listening = on_listening};
+    loopback_init(&s_lb, s_badge_count + 1, s_loss, 7, &hooks);
+    s_latency = malloc(((size_t)count + 1) * sizeof(*s_latency));
+    s_res.updates = count;
+    for (int i = 0; i < s_badge_count; i++)
+    {
+        badge_t *b = &s_badges[i];
+        badge_mac(i, b->mac);
+        cmd_rx_init(&b->rx);
+        b->latest = b->shown = -1;
+        b->radio_on = true;
+        b->awake_until_us = s_interval_ms ? 0 : INT64_MAX;
+        b->hello = (wake_hello_t){.magic = WAKE_MAGIC,
+                                  .type = WAKE_PKT_HELLO,
+                                  .flags = WAKE_FLAG_BOOT,
+                                  .listen_ms = WINDOW_MS,
+                                  .interval_ms = s_interval_ms};
+        // Badges were switched on at different times
+        b->next_hello_us = s_interval_ms ? (int64_t)(next_rand() % (s_interval_ms * 1000)) : INT64_MAX;
+    }
+    peer_cache_init();
+    badge_wake_init();
+
+    int next = 0;
+    while (true)
+    {
+        int64_t t = end_us;
+        if (next < count && log[next].at_us < t)
+        {
+            t = log[next].at_us;
+        }
+        for (int i = 0; i < s_badge_count; i++)
+        {
+            t = s_badges[i].next_hello_us < t ? s_badges[i].next_hello_us : t;
+        }
+        if (s_lb.count > 0 && (int64_t)s_lb.queue[s_lb.head].end_us < t)
+        {
+            t = (int64_t)s_lb.queue[s_lb.head].end_us;
+        }
+        t = host_task_next_us() < t ? host_task_next_us() : t;
+        if (t >= end_us)
+        {
+            break;
+        }
+
+        loopback_run(&s_lb, (uint64_t)t);
+        s_now_us = t;
+        while (next < count && log[next].at_us <= t)
+        {
+            issue(&log[next++]);
+        }
+        for (int i = 0; i < s_badge_count; i++)
+        {
+            if (s_badges[i].next_hello_us <= t)
+            {
+                send_hello(&s_badges[i]);
+            }
+        }
+        host_task_run();
+    }
+
+    for (int i = 0; i < s_badge_count; i++)
+    {
+        badge_t *b = &s_badges[i];
+        if (settle(b, end_us))
+        {
+            b->on_us += end_us - b->on_since_us;
+        }
+        s_res.on_ms += b->on_us / 1000.0;
+        s_res.undelivered += b->latest >= 0 && b->shown != b->latest;
+    }
+    s_res.span_ms = end_us / 1000.0;
+    s_res.frames = s_lb.stats.frames;
+    qsort(s_latency, (size_t)s_res.delivered, sizeof(*s_latency), cmp_double);
+    for (int i = 0; i < s_res.delivered; i++)
+    {
+        s_res.lat_mean_ms += s_latency[i] / s_res.delivered;
+    }
+    if (s_res.delivered > 0)
+    {
+        s_res.lat_p95_ms = s_latency[(s_res.delivered * 95 + 99) / 100 - 1];
+        s_res.lat_max_ms = s_latency[s_res.delivered - 1];
+    }
+}
+
+static bool run(uint32_t interval_ms, double loss, const update_t *log, int count, int64_t end_us, result_t *res)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        return false;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        s_interval_ms = interval_ms;
+        s_loss = loss;
+        simulate(log, count, end_us);
+        _exit(write(fds[1], &s_res, sizeof(s_res)) == sizeof(s_res) ? 0 : 1);
+    }
+    close(fds[1]);
+    bool ok = pid > 0 && read(fds[0], res, sizeof(*res)) == sizeof(*res);
+    close(fds[0]);
+    int status;
+    return ok && waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static int cmp_update(const void *a, const void *b)
+{
+    const update_t *x = a, *y = b;
+    if (x->at_us != y->at_us)
+    {
+        return x->at_us < y->at_us ? -1 : 1;
+    }
+    return x->seq - y->seq;
+}
+
+static void add(update_t *log, int *count, double at_s, int badge, int len)
+{
+    log[*count] = (update_t){.at_us = (int64_t)(at_s * 1e6), .badge = badge, .len = len, .seq = *count};
+    (*count)++;
+}
+
+static update_t *builtin_day(int *count)
+{
+    update_t *log = malloc((size_t)s_badge_count * 16 * sizeof(*log));
+    *count = 0;
+    if (!log)
+    {
+        return NULL;
+    }
+    for (int b = 0; b < s_badge_count; b++)
+    {
+        add(log, count, next_rand() % 3600000 / 1000.0, b, 60 + (int)(next_rand() % 60)); // name and company
+        for (int hour = 1; hour <= 8; hour++)
+        {
+            if (hour != 4 && next_rand() % 2)
+            {
+                add(log, count, hour * 3600 + next_rand() % 60000 / 1000.0, b, 120 + (int)(next_rand() % 120));
+            }
+        }
+        add(log, count, 4 * 3600, b, 600); // lunch announcement, three fragments
+        for (int i = 0; i < 3; i++)
+        {
+            add(log, count, 3600 + next_rand() % (8 * 3600000) / 1000.0, b, MSG_MIN + (int)(next_rand() % 400));
+        }
+    }
+    return log;
+}
+
+static update_t *load_log(const char *path, int *count)
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+    {
+        perror(path);
+        return NULL;
+    }
+    int cap = 256;
+    update_t *log = malloc((size_t)cap * sizeof(*log));
+    char line[256];
+    int lineno = 0;
+    *count = 0;
+    while (log && fgets(line, sizeof(line), f))
+    {
+        lineno++;
+        char *hash = strchr(line, '#');
+        if (hash)
+        {
+            *hash = '\0';
+        }
+        double at_s;
+        int badge, len;
+        char extra;
+        int fields = sscanf(line, "%lf %d %d %c", &at_s, &badge, &len, &extra);
+        if (fields <= 0)
+        {
+            continue;
+        }
+        if (fields != 3 || at_s < 0 || badge < 0 || badge >= s_badge_count || len < MSG_MIN || len > CMD_MSG_MAX)
+        {
+            fprintf(stderr, "%s:%d: expected seconds, badge below %d and %d to %d bytes\n", path, lineno,
+                    s_badge_count, MSG_MIN, CMD_MSG_MAX);
+            free(log);
+            log = NULL;
+            break;
+        }
+        if (*count == cap)
+        {
+            update_t *grown = realloc(log, (size_t)(cap *= 2) * sizeof(*log));
+            if (!grown)
+            {
+                free(log);
+                log = NULL;
+                break;
+            }
+            log = grown;
+        }
+        add(log, count, at_s, badge, len);
+    }
+    fclose(f);
+    return log;
+}
+
+int main(int argc, char **argv)
+{
+    double loss = 0.02;
+    int opt;
+    while ((opt = getopt(argc, argv, "b:l:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'b':
+            s_badge_count = atoi(optarg);
+            break;
+        case 'l':
+            loss = atof(optarg);
+            break;
+        default:
+            s_badge_count = 0;
+            break;
+        }
+    }
+    if (s_badge_count <= 0 || s_badge_count > 0xffff || loss < 0 || loss >= 1 ||
+        optind < argc - 1)
+    {
+        fprintf(stderr, "usage: %s [-b badges] [-l loss] [log]\n", argv[0]);
+        return 2;
+    }
+
+    int count;
+    update_t *log = optind < argc ? load_log(argv[optind], &count) : builtin_day(&count);
+    s_badges = calloc((size_t)s_badge_count, sizeof(*s_badges));
+    if (!log || !s_badges || count == 0)
+    {
+        fprintf(stderr, count == 0 && log ? "no updates in the log\n" : "out of memory\n");
+        return 2;
+    }
+    qsort(log, (size_t)count, sizeof(*log), cmp_update);
+    for (int i = 0; i < count; i++)
+    {
+        log[i].seq = i;
+    }
+    int64_t end_us = log[count - 1].at_us + DRAIN_US;
+
+    printf("%d badges, %d updates over %.1f h, %.0f%% loss; %d ms window, %d ms hold\n", s_badge_count, count,
+           end_us / 3.6e9, loss * 100, WINDOW_MS, HOLD_MS);
+    printf("          ------------ updates -----------   ---- latency ms ----   radio  badge energy  per update\n");
+    printf("interval  delivered  failed  replaced  open     mean    p95    max   on %%       mWh         mJ\n");
+    int bad = 0;
+    for (size_t i = 0; i < sizeof(intervals_ms) / sizeof(intervals_ms[0]); i++)
+    {
+        result_t day, idle;
+        if (!run(intervals_ms[i], loss, log, count, end_us, &day) || !run(intervals_ms[i], loss, log, 0, end_us, &idle))
+        {
+            fprintf(stderr, "simulation at %u ms did not finish\n", (unsigned)intervals_ms[i]);
+            return 1;
+        }
+        bad += day.bad;
+        double on_share = day.on_ms / (day.span_ms * s_badge_count);
+        double badge_mwh = (on_share * RADIO_MW + (1 - on_share) * SLEEP_MW) * day.span_ms / 3.6e6;
+        double update_mj = day.delivered ? (day.on_ms - idle.on_ms) * (RADIO_MW - SLEEP_MW) / 1000 / day.delivered : 0;
+        char interval[16];
+        snprintf(interval, sizeof(interval), intervals_ms[i] ? "%u ms" : "always", (unsigned)intervals_ms[i]);
+        printf("%-8s  %9d  %6d  %8d  %4d  %7.0f  %5.0f  %5.0f  %5.1f  %10.1f  %9.1f\n", interval, day.delivered,
+               day.failed, day.superseded, day.undelivered, day.lat_mean_ms, day.lat_p95_ms, day.lat_max_ms,
+               on_share * 100, badge_mwh, update_mj);
+    }
+    free(log);
+    free(s_badges);
+    return bad ? 1 : 0;
+}
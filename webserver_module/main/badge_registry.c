@@ -0,0 +1,396 @@
+#include "badge_registry.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "nvs.h"
+
+static const char *TAG = "Registry";
+
+#define REGISTRY_NAMESPACE "badge_reg"
+#define REGISTRY_KEY "table"
+#define REGISTRY_VERSION 1
+// A write that failed is tried again after this long, changes or not
+#define REGISTRY_RETRY_MS 10000
+
+// Before the registry every badge had its own mac_N string key
+#define LEGACY_NAMESPACE "mac_store"
+#define LEGACY_ENTRIES 20
+
+// Open-addressing index: a power of two at least twice the capacity keeps
+// probe sequences short even when the registry is full
+#define INDEX_SIZE (BADGE_REGISTRY_MAX <= 16 ? 32 : 1 << (32 - __builtin_clz(BADGE_REGISTRY_MAX - 1) + 1))
+#define INDEX_EMPTY (-1)
+
+typedef struct __attribute__((packed))
+{
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t count;
+} registry_blob_hdr_t;
+
+static badge_entry_t s_entries[BADGE_REGISTRY_MAX];
+static bool s_used[BADGE_REGISTRY_MAX];
+static int16_t s_index[INDEX_SIZE]; // slot of the badge hashed here, or INDEX_EMPTY
+static size_t s_count;
+static uint32_t s_generation; // bumped on every change, tells the writer what it saved
+static uint32_t s_saved_generation;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t s_flush_task;
+
+static uint64_t mac_key(const uint8_t mac[6])
+{
+    uint64_t key = 0;
+    for (int i = 0; i < 6; i++)
+    {
+        key = (key << 8) | mac[i];
+    }
+    return key;
+}
+
+static uint32_t home(const uint8_t mac[6])
+{
+    // Fibonacci hashing: vendor prefixes repeat, so mix all 48 bits
+    return (uint32_t)((mac_key(mac) * 0x9E3779B97F4A7C15ULL) >> 32) & (INDEX_SIZE - 1);
+}
+
+// Caller holds s_lock. Index position of mac, or of the empty entry where it would go.
+static uint32_t probe(const uint8_t mac[6])
+{
+    uint32_t pos = home(mac);
+    while (s_index[pos] != INDEX_EMPTY && memcmp(s_entries[s_index[pos]].mac, mac, 6) != 0)
+    {
+        pos = (pos + 1) & (INDEX_SIZE - 1);
+    }
+    return pos;
+}
+
+// Caller holds s_lock.
+static esp_err_t insert(const uint8_t mac[6], const char *alias)
+{
+    uint32_t pos = probe(mac);
+    if (s_index[pos] != INDEX_EMPTY)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_count == BADGE_REGISTRY_MAX)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    int slot = 0;
+    while (s_used[slot])
+    {
+        slot++;
+    }
+    s_used[slot] = true;
+    memcpy(s_entries[slot].mac, mac, 6);
+    strlcpy(s_entries[slot].alias, alias, sizeof(s_entries[slot].alias));
+    s_index[pos] = slot;
+    s_count++;
+    return ESP_OK;
+}
+
+// Caller holds s_lock. Linear probing with backward-shift deletion, so no
+// tombstones pile up as badges come and go.
+static void erase_at(uint32_t pos)
+{
+    s_used[s_index[pos]] = false;
+    s_count--;
+    uint32_t hole = pos;
+    uint32_t next = (pos + 1) & (INDEX_SIZE - 1);
+    while (s_index[next] != INDEX_EMPTY)
+    {
+        uint32_t want = home(s_entries[s_index[next]].mac);
+        // Move the entry into the hole unless its home lies cyclically in (hole, next]
+        bool stays = (hole <= next) ? (hole < want && want <= next) : (hole < want || want <= next);
+        if (!stays)
+        {
+            s_index[hole] = s_index[next];
+            hole = next;
+        }
+        next = (next + 1) & (INDEX_SIZE - 1);
+    }
+    s_index[hole] = INDEX_EMPTY;
+}
+
+static void schedule_save(void)
+{
+    if (s_flush_task)
+    {
+        xTaskNotifyGive(s_flush_task);
+    }
+}
+
+// Writes the registry to NVS unless nothing changed since the last write.
+static esp_err_t save(void)
+{
+    // Snapshot under the lock, write without it
+    size_t size = sizeof(registry_blob_hdr_t) + BADGE_REGISTRY_MAX * sizeof(badge_entry_t);
+    uint8_t *blob = malloc(size);
+    if (!blob)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    uint32_t generation = s_generation;
+    registry_blob_hdr_t hdr = {.version = REGISTRY_VERSION, .count = s_count};
+    badge_entry_t *out = (badge_entry_t *)(blob + sizeof(hdr));
+    for (int slot = 0, n = 0; n < s_count; slot++)
+    {
+        if (s_used[slot])
+        {
+            out[n++] = s_entries[slot];
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+    memcpy(blob, &hdr, sizeof(hdr));
+
+    if (generation == s_saved_generation)
+    {
+        free(blob);
+        return ESP_OK;
+    }
+
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(REGISTRY_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK)
+    {
+        err = nvs_set_blob(nvs, REGISTRY_KEY, blob, sizeof(hdr) + hdr.count * sizeof(badge_entry_t));
+        if (err == ESP_OK)
+        {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    free(blob);
+
+    if (err == ESP_OK)
+    {
+        s_saved_generation = generation;
+        ESP_LOGI(TAG, "Saved %u badges", hdr.count);
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Saving the registry failed: %s", esp_err_to_name(err));
+    }
+    return err;
+}
+
+static void flush_task(void *arg)
+{
+    // The import of legacy keys at boot may have failed to write already
+    TickType_t idle_wait = (s_generation == s_saved_generation) ? portMAX_DELAY : pdMS_TO_TICKS(REGISTRY_RETRY_MS);
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, idle_wait);
+        // Changes that keep coming in within the delay are written together
+        while (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CONFIG_BADGE_REGISTRY_FLUSH_MS)) > 0)
+        {
+        }
+        // Until the registry is on flash, wake up again without a new change
+        idle_wait = (save() == ESP_OK) ? portMAX_DELAY : pdMS_TO_TICKS(REGISTRY_RETRY_MS);
+    }
+}
+
+static esp_err_t load(void)
+{
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(REGISTRY_NAMESPACE, NVS_READONLY, &nvs);
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+    size_t size = 0;
+    err = nvs_get_blob(nvs, REGISTRY_KEY, NULL, &size);
+    uint8_t *blob = (err == ESP_OK) ? malloc(size) : NULL;
+    if (err == ESP_OK && !blob)
+    {
+        err = ESP_ERR_NO_MEM;
+    }
+    if (err == ESP_OK)
+    {
+        err = nvs_get_blob(nvs, REGISTRY_KEY, blob, &size);
+    }
+    nvs_close(nvs);
+
+    registry_blob_hdr_t hdr = {0};
+    if (err == ESP_OK && size >= sizeof(hdr))
+    {
+        memcpy(&hdr, blob, sizeof(hdr));
+    }
+    if (err == ESP_OK &&
+        (hdr.version != REGISTRY_VERSION || size != sizeof(hdr) + hdr.count * sizeof(badge_entry_t)))
+    {
+        ESP_LOGE(TAG, "Registry blob of %u bytes is not version %d, ignoring it", (unsigned)size, REGISTRY_VERSION);
+        err = ESP_ERR_INVALID_VERSION;
+    }
+    if (err == ESP_OK)
+    {
+        const badge_entry_t *in = (const badge_entry_t *)(blob + sizeof(hdr));
+        for (int i = 0; i < hdr.count; i++)
+        {
+            badge_entry_t e = in[i];
+            e.alias[sizeof(e.alias) - 1] = '\0';
+            if (insert(e.mac, e.alias) == ESP_ERR_NO_MEM)
+            {
+                ESP_LOGW(TAG, "Registry full, dropping " MACSTR, MAC2STR(e.mac));
+            }
+        }
+    }
+    free(blob);
+    return err;
+}
+
+// Imports the mac_N / alias_N keys written by older firmware; they are
+// erased once the registry blob holding them is safely written.
+static void import_legacy(void)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(LEGACY_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK)
+    {
+        return;
+    }
+    char key[16];
+    char mac_str[20];
+    char alias[BADGE_ALIAS_LEN];
+    size_t len;
+    int imported = 0;
+    for (int i = 0; i < LEGACY_ENTRIES; i++)
+    {
+        uint8_t mac[6];
+        snprintf(key, sizeof(key), "mac_%d", i);
+        len = sizeof(mac_str);
+        if (nvs_get_str(nvs, key, mac_str, &len) != ESP_OK || !parse_mac(mac_str, mac))
+        {
+            continue;
+        }
+        snprintf(key, sizeof(key), "alias_%d", i);
+        len = sizeof(alias);
+        if (nvs_get_str(nvs, key, alias, &len) != ESP_OK)
+        {
+            alias[0] = '\0';
+        }
+        if (insert(mac, alias) == ESP_OK)
+        {
+            imported++;
+        }
+    }
+    if (imported > 0)
+    {
+        s_generation++;
+        if (save() == ESP_OK)
+        {
+            nvs_erase_all(nvs);
+            nvs_commit(nvs);
+        }
+        ESP_LOGI(TAG, "Imported %d badges from " LEGACY_NAMESPACE, imported);
+    }
+    nvs_close(nvs);
+}
+
+esp_err_t badge_registry_init(void)
+{
+    for (int i = 0; i < INDEX_SIZE; i++)
+    {
+        s_index[i] = INDEX_EMPTY;
+    }
+    esp_err_t err = load();
+    if (err == ESP_ERR_NVS_NOT_FOUND)
+    {
+        import_legacy();
+    }
+    ESP_LOGI(TAG, "%u of %d badges registered", (unsigned)s_count, BADGE_REGISTRY_MAX);
+
+    if (xTaskCreate(flush_task, "registry", 3072, NULL, 2, &s_flush_task) != pdPASS)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t badge_registry_add(const uint8_t mac[6], const char *alias)
+{
+    portENTER_CRITICAL(&s_lock);
+    esp_err_t err = insert(mac, alias);
+    if (err == ESP_OK)
+    {
+        s_generation++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    if (err == ESP_OK)
+    {
+        schedule_save();
+    }
+    return err;
+}
+
+esp_err_t badge_registry_remove(const uint8_t mac[6])
+{
+    portENTER_CRITICAL(&s_lock);
+    uint32_t pos = probe(mac);
+    bool found = s_index[pos] != INDEX_EMPTY;
+    if (found)
+    {
+        erase_at(pos);
+        s_generation++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    if (!found)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+    schedule_save();
+    return ESP_OK;
+}
+
+int badge_registry_find(const uint8_t mac[6])
+{
+    portENTER_CRITICAL(&s_lock);
+    int slot = s_index[probe(mac)];
+    portEXIT_CRITICAL(&s_lock);
+    return slot;
+}
+
+size_t badge_registry_list(badge_entry_t *out, int *slots, size_t max)
+{
+    size_t n = 0;
+    portENTER_CRITICAL(&s_lock);
+    for (int slot = 0; slot < BADGE_REGISTRY_MAX && n < max; slot++)
+    {
+        if (s_used[slot])
+        {
+            out[n] = s_entries[slot];
+            if (slots)
+            {
+                slots[n] = slot;
+            }
+            n++;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return n;
+}
+
+size_t badge_registry_macs(uint8_t macs[][6], size_t max)
+{
+    size_t n = 0;
+    portENTER_CRITICAL(&s_lock);
+    for (int slot = 0; slot < BADGE_REGISTRY_MAX && n < max; slot++)
+    {
+        if (s_used[slot])
+        {
+            memcpy(macs[n++], s_entries[slot].mac, 6);
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return n;
+}
+
+size_t badge_registry_count(void)
+{
+    return s_count;
+}
@@ -0,0 +1,46 @@
+#ifndef BADGE_REGISTRY_H
+#define BADGE_REGISTRY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "webserver.h"
+
+#define BADGE_REGISTRY_MAX CONFIG_BADGE_REGISTRY_MAX
+
+// One registered badge as persisted
+typedef struct __attribute__((packed))
+{
+    uint8_t mac[6];
+    char alias[BADGE_ALIAS_LEN];
+} badge_entry_t;
+
+// Loads the registry from NVS, importing the old per-slot mac_N keys on the
+// first boot after an upgrade, and starts the write-back task. Must be called
+// after nvs_flash_init() and before anything else in this module.
+esp_err_t badge_registry_init(void);
+
+// Registers mac with an optional alias ("" for none). Returns
+// ESP_ERR_INVALID_STATE if it is already registered and ESP_ERR_NO_MEM when
+// the registry is full. The change reaches flash after
+// CONFIG_BADGE_REGISTRY_FLUSH_MS, coalesced with any that follow.
+esp_err_t badge_registry_add(const uint8_t mac[6], const char *alias);
+
+// Unregisters mac; ESP_ERR_NOT_FOUND if it was not registered.
+esp_err_t badge_registry_remove(const uint8_t mac[6]);
+
+// Slot of mac, stable while it stays registered, or -1. Safe to call from
+// the Wi-Fi task.
+int badge_registry_find(const uint8_t mac[6]);
+
+// Copies up to max entries in slot order into out and, if slots is not
+// NULL, their slot numbers. Returns how many were copied.
+size_t badge_registry_list(badge_entry_t *out, int *slots, size_t max);
+
+// Copies up to max registered MACs into macs; returns how many were copied.
+size_t badge_registry_macs(uint8_t macs[][6], size_t max);
+
+// Number of registered badges.
+size_t badge_registry_count(void);
+
+#endif // BADGE_REGISTRY_H
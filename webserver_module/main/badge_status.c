@@ -0,0 +1,129 @@
+#include "badge_status.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "badge_registry.h"
+
+typedef struct
+{
+    uint8_t mac[6]; // registry slots are reused: tells whose state this is
+    badge_status_t status;
+} status_slot_t;
+
+// One entry per registry slot, so lookups cost one hash probe
+static status_slot_t s_slots[BADGE_REGISTRY_MAX];
+// Updates are a few stores: a spinlock keeps the Wi-Fi task from blocking
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Caller holds s_lock. NULL for badges that are not registered; anything
+// else on the channel is not tracked.
+static status_slot_t *find_slot(const uint8_t mac[6])
+{
+    int slot = badge_registry_find(mac);
+    if (slot < 0)
+    {
+        return NULL;
+    }
+    status_slot_t *s = &s_slots[slot];
+    if (memcmp(s->mac, mac, 6) != 0)
+    {
+        memset(s, 0, sizeof(*s));
+        memcpy(s->mac, mac, 6);
+    }
+    return s;
+}
+
+void badge_status_on_recv(const esp_now_recv_info_t *info)
+{
+    uint32_t now = now_ms();
+    portENTER_CRITICAL(&s_lock);
+    status_slot_t *s = find_slot(info->src_addr);
+    if (s)
+    {
+        s->status.seen = true;
+        s->status.last_seen_ms = now;
+        s->status.rssi = (int8_t)info->rx_ctrl->rssi;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void badge_status_set_content(const uint8_t mac[6], const char *content)
+{
+    portENTER_CRITICAL(&s_lock);
+    status_slot_t *s = find_slot(mac);
+    if (s)
+    {
+        strlcpy(s->status.content, content, sizeof(s->status.content));
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void badge_status_set_battery(const uint8_t mac[6], uint16_t battery_mv)
+{
+    portENTER_CRITICAL(&s_lock);
+    status_slot_t *s = find_slot(mac);
+    if (s)
+    {
+        s->status.battery_mv = battery_mv;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void badge_status_set_delivery(const delivery_event_t *evt)
+{
+    portENTER_CRITICAL(&s_lock);
+    status_slot_t *s = find_slot(evt->mac);
+    if (s)
+    {
+        s->status.delivery = *evt;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void badge_status_on_report(const uint8_t mac[6], const telem_report_t *report)
+{
+    portENTER_CRITICAL(&s_lock);
+    status_slot_t *s = find_slot(mac);
+    if (s)
+    {
+        badge_telemetry_t *t = &s->status.telemetry;
+        t->reported = true;
+        memcpy(t->firmware, report->fw, TELEM_FW_LEN);
+        t->firmware[TELEM_FW_LEN] = '\0';
+        t->rssi = report->rssi;
+        t->queue_hwm = report->queue_hwm;
+        t->dropped = report->dropped;
+        if (report->event == TELEM_EVT_RENDERED)
+        {
+            t->renders++;
+            t->last_render_ms = report->render_ms;
+            t->max_render_ms = (report->render_ms > t->max_render_ms) ? report->render_ms : t->max_render_ms;
+        }
+        else if (report->event == TELEM_EVT_REJECTED)
+        {
+            t->rejected++;
+        }
+        if (report->battery_mv)
+        {
+            s->status.battery_mv = report->battery_mv;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+bool badge_status_get(const uint8_t mac[6], badge_status_t *out)
+{
+    portENTER_CRITICAL(&s_lock);
+    status_slot_t *s = find_slot(mac);
+    if (s)
+    {
+        *out = s->status;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return s != NULL;
+}
@@ -0,0 +1,57 @@
+#ifndef BADGE_STATUS_H
+#define BADGE_STATUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_now.h"
+#include "delivery_push.h"
+#include "telem_proto.h"
+
+// Longest description of what a badge was last sent, including the NUL
+#define BADGE_CONTENT_LEN 64
+
+// What a badge reported about itself, see telem_proto.h.
+typedef struct
+{
+    bool reported;                // a REPORT arrived since boot
+    char firmware[TELEM_FW_LEN + 1];
+    uint32_t renders;             // updates the badge showed since the gateway booted
+    uint32_t rejected;            // updates it could not show
+    uint32_t last_render_ms;      // duration of its latest panel refresh
+    uint32_t max_render_ms;
+    int8_t rssi;                  // how well it hears the gateway, dBm
+    uint8_t queue_hwm;            // deepest its receive queue got since it booted
+    uint16_t dropped;             // frames it lost to a full receive queue since it booted
+} badge_telemetry_t;
+
+// Runtime state of one registered badge, as reported by GET /api/badges.
+typedef struct
+{
+    bool seen;             // a frame from the badge was received since boot
+    uint32_t last_seen_ms; // when the last frame arrived
+    int8_t rssi;           // signal strength of that frame, dBm
+    uint16_t battery_mv;   // last reported battery voltage, 0 if unknown
+    char content[BADGE_CONTENT_LEN];
+    delivery_event_t delivery; // latest step of the latest update
+    badge_telemetry_t telemetry;
+} badge_status_t;
+
+// ESP-NOW receive hook, safe to call from the Wi-Fi task.
+void badge_status_on_recv(const esp_now_recv_info_t *info);
+
+// Records what was last sent to mac, e.g. "Jane Doe" or "image".
+void badge_status_set_content(const uint8_t mac[6], const char *content);
+
+// Records a battery reading of mac in millivolts.
+void badge_status_set_battery(const uint8_t mac[6], uint16_t battery_mv);
+
+// Records the latest delivery step reported for evt->mac.
+void badge_status_set_delivery(const delivery_event_t *evt);
+
+// Folds a telemetry REPORT from mac into its state, battery included.
+void badge_status_on_report(const uint8_t mac[6], const telem_report_t *report);
+
+// Copies the state of mac into out; false if it is not registered.
+bool badge_status_get(const uint8_t mac[6], badge_status_t *out);
+
+#endif // BADGE_STATUS_H
@@ -0,0 +1,114 @@
+#include "badge_telemetry.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "telem_proto.h"
+#include "badge_status.h"
+#include "delivery_push.h"
+
+static const char *TAG = "BadgeTelem";
+
+typedef struct
+{
+    uint8_t mac[6];
+    telem_report_t report;
+} telem_evt_t;
+
+static QueueHandle_t s_evt_queue;
+
+// What the report means for the update the page is watching. Refused images
+// are left to logo_transfer, which retries them raw.
+static void update_delivery(const uint8_t mac[6], const telem_report_t *r)
+{
+    badge_status_t st;
+    if (!badge_status_get(mac, &st))
+    {
+        return;
+    }
+    // Progress and retries of the transfer carry over into the new step
+    delivery_event_t d = st.delivery;
+    delivery_kind_t kind = (r->op == TELEM_OP_IMAGE) ? DELIVERY_IMAGE : DELIVERY_TEXT;
+    if (d.state == DELIVERY_NONE || d.kind != kind)
+    {
+        memset(&d, 0, sizeof(d));
+        memcpy(d.mac, mac, 6);
+        d.kind = kind;
+    }
+    d.render_ms = 0;
+    switch (r->event)
+    {
+    case TELEM_EVT_ACCEPTED:
+        d.state = DELIVERY_RENDERING;
+        d.done = d.total;
+        break;
+    case TELEM_EVT_RENDERED:
+        d.state = DELIVERY_RENDERED;
+        d.done = d.total;
+        d.render_ms = r->render_ms;
+        break;
+    case TELEM_EVT_REJECTED:
+        if (kind == DELIVERY_IMAGE)
+        {
+            return;
+        }
+        d.state = DELIVERY_FAILED;
+        break;
+    default:
+        return;
+    }
+    delivery_push_event(&d);
+}
+
+static void telem_task(void *arg)
+{
+    static const char *const event_str[] = {"boot", "accepted", "rendered", "rejected"};
+    telem_evt_t evt;
+    while (true)
+    {
+        if (xQueueReceive(s_evt_queue, &evt, portMAX_DELAY) != pdTRUE)
+        {
+            continue;
+        }
+        const telem_report_t *r = &evt.report;
+        badge_status_t before;
+        bool known = badge_status_get(evt.mac, &before);
+        ESP_LOGI(TAG, MACSTR " %s op %u xfer %u: %lu ms, %u mV, %d dBm, queue hwm %u, %u dropped, fw %.*s",
+                 MAC2STR(evt.mac), r->event < 4 ? event_str[r->event] : "?", r->op, r->xfer_id,
+                 (unsigned long)r->render_ms, r->battery_mv, r->rssi, r->queue_hwm, r->dropped,
+                 TELEM_FW_LEN, r->fw);
+        if (!known)
+        {
+            continue; // not registered: logged, nothing to aggregate
+        }
+        if (r->dropped > before.telemetry.dropped)
+        {
+            ESP_LOGW(TAG, MACSTR " lost %u frame(s) to a full receive queue", MAC2STR(evt.mac),
+                     r->dropped - before.telemetry.dropped);
+        }
+        badge_status_on_report(evt.mac, r);
+        update_delivery(evt.mac, r);
+    }
+}
+
+void badge_telemetry_init(void)
+{
+    s_evt_queue = xQueueCreate(BADGE_TELEMETRY_QUEUE, sizeof(telem_evt_t));
+    assert(s_evt_queue);
+    xTaskCreate(telem_task, "badge_telem", 3072, NULL, 4, NULL);
+}
+
+// Runs in Wi-Fi task context: only copy and queue.
+void badge_telemetry_on_recv(const uint8_t mac[6], const uint8_t *data, int len)
+{
+    if (len != sizeof(telem_report_t) || !telem_is_frame(data, len, TELEM_PKT_REPORT))
+    {
+        return;
+    }
+    telem_evt_t evt;
+    memcpy(evt.mac, mac, 6);
+    memcpy(&evt.report, data, len);
+    xQueueSend(s_evt_queue, &evt, 0);
+}
@@ -0,0 +1,16 @@
+#ifndef BADGE_TELEMETRY_H
+#define BADGE_TELEMETRY_H
+
+#include <stdint.h>
+
+// Reports waiting for the telemetry task
+#define BADGE_TELEMETRY_QUEUE 16
+
+// Creates the report queue and the task that folds reports into
+// badge_status and the delivery events. Must be called after esp_now_init().
+void badge_telemetry_init(void);
+
+// ESP-NOW receive hook, safe to call from the Wi-Fi task.
+void badge_telemetry_on_recv(const uint8_t mac[6], const uint8_t *data, int len);
+
+#endif // BADGE_TELEMETRY_H
@@ -0,0 +1,327 @@
+#include "badge_wake.h"
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "esp_now.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "wake_proto.h"
+#include "cmd_proto.h"
+#include "webserver.h"
+#include "badge_registry.h"
+#include "peer_cache.h"
+#include "delivery_push.h"
+
+static const char *TAG = "BadgeWake";
+
+typedef struct
+{
+    bool used;
+    uint8_t mac[6];
+    wake_peer_t wake;
+
+    // Held update, sent in the badge's next window
+    bool pending;
+    bool inflight;   // handed to the radio, waiting for the send callback
+    bool superseded; // replaced while in flight, the result is for older data
+    uint8_t attempts;  // failed sends of the current fragment, plus the one in flight
+    uint8_t msg_id;
+    uint8_t next_frag; // first fragment the badge has not acknowledged
+    uint16_t retries;  // failed sends of the whole update
+    uint16_t len;
+    uint32_t queued_ms;
+    uint32_t last_try_ms;
+    uint8_t *msg; // command message, heap; fragmented on the way out
+} badge_slot_t;
+
+typedef enum
+{
+    WAKE_EVT_HELLO, // wake announcement received
+    WAKE_EVT_SENT,  // send callback fired
+    WAKE_EVT_KICK,  // new update held, try to send it now
+} wake_evt_type_t;
+
+typedef struct
+{
+    wake_evt_type_t type;
+    uint8_t mac[6];
+    bool ok;
+    uint32_t at_ms;
+    uint8_t data[sizeof(wake_hello_t)];
+} wake_evt_t;
+
+static badge_slot_t s_slots[BADGE_WAKE_SLOTS];
+static SemaphoreHandle_t s_lock;
+static QueueHandle_t s_evt_queue;
+static volatile int s_inflight; // lets the send callback skip the queue when idle
+static uint8_t s_msg_id;          // last id handed out, random at boot
+
+static uint32_t now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Caller holds s_lock. With create set, a missing badge takes a free slot or
+// evicts the least recently heard one that holds nothing.
+static badge_slot_t *find_slot(const uint8_t mac[6], bool create)
+{
+    badge_slot_t *free_slot = NULL;
+    badge_slot_t *victim = NULL;
+    for (int i = 0; i < BADGE_WAKE_SLOTS; i++)
+    {
+        badge_slot_t *b = &s_slots[i];
+        if (!b->used)
+        {
+            free_slot = free_slot ? free_slot : b;
+        }
+        else if (memcmp(b->mac, mac, 6) == 0)
+        {
+            return b;
+        }
+        else if (!b->pending && !b->inflight &&
+                 (!victim || (int32_t)(b->wake.last_hello_ms - victim->wake.last_hello_ms) < 0))
+        {
+            victim = b;
+        }
+    }
+    if (!create)
+    {
+        return NULL;
+    }
+    badge_slot_t *b = free_slot ? free_slot : victim;
+    if (b)
+    {
+        memset(b, 0, sizeof(*b));
+        b->used = true;
+        memcpy(b->mac, mac, 6);
+    }
+    return b;
+}
+
+static void drop_msg(badge_slot_t *b)
+{
+    free(b->msg);
+    b->msg = NULL;
+    b->pending = false;
+}
+
+static void finish(badge_slot_t *b, bool ok, uint32_t now)
+{
+    b->inflight = false;
+    s_inflight--;
+    if (b->superseded)
+    {
+        // A newer update replaced the data meanwhile: it still has to go out
+        b->superseded = false;
+        return;
+    }
+    uint8_t count = cmd_frag_count(b->len);
+    if (ok)
+    {
+        b->attempts = 0;
+        if (++b->next_frag < count)
+        {
+            // The rest follows right away, the badge is still listening
+            delivery_push_post(b->mac, DELIVERY_TEXT, DELIVERY_SENDING, b->next_frag, count, b->retries);
+            return;
+        }
+        ESP_LOGI(TAG, "Update delivered to " MACSTR " after %lu ms, %u fragment(s), %u retries",
+                 MAC2STR(b->mac), (unsigned long)(now - b->queued_ms), count, b->retries);
+        drop_msg(b);
+        delivery_push_post(b->mac, DELIVERY_TEXT, DELIVERY_DONE, count, count, b->retries);
+        return;
+    }
+    b->retries++;
+    if (b->attempts >= BADGE_WAKE_MAX_ATTEMPTS)
+    {
+        ESP_LOGW(TAG, "Dropping update for " MACSTR " after %u attempts at fragment %u/%u", MAC2STR(b->mac),
+                 b->attempts, b->next_frag + 1, count);
+        drop_msg(b);
+        delivery_push_post(b->mac, DELIVERY_TEXT, DELIVERY_FAILED, b->next_frag, count, b->retries);
+    }
+    else
+    {
+        delivery_push_post(b->mac, DELIVERY_TEXT, DELIVERY_RETRY, b->next_frag, count, b->retries);
+    }
+}
+
+// Caller holds s_lock.
+static void flush(badge_slot_t *b, uint32_t now)
+{
+    if (!b->pending || b->inflight || !wake_peer_listening(&b->wake, now) ||
+        (b->attempts && now - b->last_try_ms < BADGE_WAKE_RETRY_MS))
+    {
+        return;
+    }
+    uint8_t frame[CMD_FRAME_MAX];
+    size_t frame_len = cmd_frag(frame, b->msg, b->len, b->msg_id, b->next_frag);
+    b->attempts++;
+    b->last_try_ms = now;
+    b->inflight = true;
+    s_inflight++;
+    if (peer_cache_send(b->mac, PEER_OWNER_WAKE, frame, frame_len) != ESP_OK)
+    {
+        finish(b, false, now);
+    }
+}
+
+static void wake_task(void *arg)
+{
+    wake_evt_t evt;
+    while (true)
+    {
+        bool got = xQueueReceive(s_evt_queue, &evt, pdMS_TO_TICKS(BADGE_WAKE_RETRY_MS)) == pdTRUE;
+        uint32_t now = now_ms();
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        if (got && evt.type == WAKE_EVT_HELLO)
+        {
+            badge_slot_t *b = find_slot(evt.mac, true);
+            if (b && wake_peer_on_hello(&b->wake, evt.data, sizeof(evt.data), evt.at_ms) &&
+                b->wake.hellos == 1)
+            {
+                ESP_LOGI(TAG, MACSTR " listens %u ms every %lu ms", MAC2STR(evt.mac),
+                         b->wake.listen_ms, (unsigned long)b->wake.interval_ms);
+            }
+        }
+        else if (got && evt.type == WAKE_EVT_SENT)
+        {
+            badge_slot_t *b = find_slot(evt.mac, false);
+            if (b && b->inflight)
+            {
+                finish(b, evt.ok, now);
+            }
+        }
+        for (int i = 0; i < BADGE_WAKE_SLOTS; i++)
+        {
+            if (s_slots[i].used)
+            {
+                flush(&s_slots[i], now);
+            }
+        }
+        xSemaphoreGive(s_lock);
+    }
+}
+
+void badge_wake_init(void)
+{
+    s_lock = xSemaphoreCreateMutex();
+    s_evt_queue = xQueueCreate(16, sizeof(wake_evt_t));
+    assert(s_lock && s_evt_queue);
+    s_msg_id = (uint8_t)esp_random(); // a rebooted gateway must not repeat the last id a badge saw
+    xTaskCreate(wake_task, "badge_wake", 3072, NULL, 5, NULL);
+}
+
+// Runs in Wi-Fi task context: only copy and queue.
+void badge_wake_on_recv(const uint8_t mac[6], const uint8_t *data, int len)
+{
+    if (len != sizeof(wake_hello_t) || !wake_is_frame(data, len, WAKE_PKT_HELLO))
+    {
+        return;
+    }
+    // Timestamped here: the window started when the frame arrived, not when it is processed
+    wake_evt_t evt = {.type = WAKE_EVT_HELLO, .at_ms = now_ms()};
+    memcpy(evt.mac, mac, 6);
+    memcpy(evt.data, data, len);
+    xQueueSend(s_evt_queue, &evt, 0);
+}
+
+void badge_wake_on_sent(const uint8_t mac[6], bool ok)
+{
+    if (s_inflight <= 0)
+    {
+        return;
+    }
+    wake_evt_t evt = {.type = WAKE_EVT_SENT, .ok = ok};
+    memcpy(evt.mac, mac, 6);
+    xQueueSend(s_evt_queue, &evt, 0);
+}
+
+// Without a slot there is no one to wait for send callbacks: every fragment
+// is handed to the radio at once and the badge sorts them out.
+static esp_err_t send_direct(const uint8_t mac[6], const uint8_t *msg, size_t len, uint8_t msg_id)
+{
+    uint8_t frame[CMD_FRAME_MAX];
+    uint8_t count = cmd_frag_count(len);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        esp_err_t err = peer_cache_send(mac, PEER_OWNER_WAKE, frame, cmd_frag(frame, msg, len, msg_id, i));
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t badge_wake_send(const uint8_t mac[6], const uint8_t *msg, size_t len, bool *queued)
+{
+    *queued = false;
+    if (len > CMD_MSG_MAX)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (badge_registry_find(mac) < 0)
+    {
+        return ESP_ERR_ESPNOW_NOT_FOUND;
+    }
+    uint8_t *copy = malloc(len ? len : 1);
+    if (!copy)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(copy, msg, len);
+
+    uint32_t now = now_ms();
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    uint8_t msg_id = ++s_msg_id;
+    badge_slot_t *b = find_slot(mac, true);
+    if (!b)
+    {
+        xSemaphoreGive(s_lock);
+        free(copy);
+        ESP_LOGW(TAG, "No slot to hold an update for " MACSTR ", sending directly", MAC2STR(mac));
+        return send_direct(mac, msg, len, msg_id);
+    }
+    if (b->pending && !b->inflight)
+    {
+        ESP_LOGI(TAG, "Replacing held update for " MACSTR, MAC2STR(mac));
+    }
+    // The radio copied any fragment in flight, the old message can go
+    free(b->msg);
+    b->superseded = b->inflight;
+    b->msg = copy;
+    b->len = (uint16_t)len;
+    b->msg_id = msg_id;
+    b->next_frag = 0;
+    b->pending = true;
+    b->attempts = 0;
+    b->retries = 0;
+    b->queued_ms = now;
+    *queued = !wake_peer_listening(&b->wake, now);
+    if (*queued)
+    {
+        ESP_LOGI(TAG, "Holding update for " MACSTR ", next window in %lu ms", MAC2STR(mac),
+                 (unsigned long)wake_peer_next_ms(&b->wake, now));
+    }
+    delivery_push_post(mac, DELIVERY_TEXT, *queued ? DELIVERY_HELD : DELIVERY_SENDING, 0, cmd_frag_count(len), 0);
+    xSemaphoreGive(s_lock);
+
+    wake_evt_t evt = {.type = WAKE_EVT_KICK};
+    xQueueSend(s_evt_queue, &evt, 0);
+    return ESP_OK;
+}
+
+bool badge_wake_listening(const uint8_t mac[6])
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    badge_slot_t *b = find_slot(mac, false);
+    bool listening = !b || wake_peer_listening(&b->wake, now_ms());
+    xSemaphoreGive(s_lock);
+    return listening;
+}
@@ -0,0 +1,36 @@
+#ifndef BADGE_WAKE_H
+#define BADGE_WAKE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+// Sends of one fragment before a held update is dropped
+#define BADGE_WAKE_MAX_ATTEMPTS 5
+// Minimum spacing of retries while a badge is listening
+#define BADGE_WAKE_RETRY_MS 200
+// Badges whose schedule and held update are tracked at once; the least
+// recently heard idle one makes room for a new one
+#define BADGE_WAKE_SLOTS 32
+
+// Creates the pending-update table and its sender task.
+// Must be called after esp_now_init().
+void badge_wake_init(void);
+
+// ESP-NOW callback hooks, safe to call from the Wi-Fi task.
+void badge_wake_on_recv(const uint8_t mac[6], const uint8_t *data, int len);
+void badge_wake_on_sent(const uint8_t mac[6], bool ok);
+
+// Sends a command message (cmd_proto.h, up to CMD_MSG_MAX bytes) to mac,
+// one fragment after the other. If the badge sleeps between wake windows the
+// message is held (replacing any older held update, the badge only shows the
+// latest one) and sent in its next window; *queued tells which happened.
+// Failed fragments are retried in later windows.
+esp_err_t badge_wake_send(const uint8_t mac[6], const uint8_t *msg, size_t len, bool *queued);
+
+// True while mac is expected to listen; always true for badges without a
+// wake schedule.
+bool badge_wake_listening(const uint8_t mac[6]);
+
+#endif // BADGE_WAKE_H
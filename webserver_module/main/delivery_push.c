@@ -0,0 +1,229 @@
+#include "delivery_push.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "cJSON.h"
+#include "sdkconfig.h"
+#include "webserver.h"
+#include "badge_status.h"
+
+static const char *TAG = "DeliveryPush";
+
+typedef struct
+{
+    uint32_t seq; // consecutive per event, so the page can tell it missed some
+    delivery_event_t evt;
+} queued_event_t;
+
+// Filled by the transfer tasks, drained by the server task
+static queued_event_t s_queue[DELIVERY_PUSH_QUEUE];
+static uint8_t s_head;
+static uint8_t s_count;
+static uint32_t s_seq;
+static uint32_t s_dropped;
+static bool s_work_queued;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Set by the first WebSocket handshake; cleared once no page listens
+static httpd_handle_t s_server;
+static volatile bool s_listening;
+
+static const char *const state_str[] = {"none",   "queued", "held",      "sending", "retry",
+                                        "done",   "failed", "rendering", "rendered"};
+static const char *const kind_str[] = {"text", "image"};
+
+const char *delivery_state_str(delivery_state_t state)
+{
+    return (state < sizeof(state_str) / sizeof(state_str[0])) ? state_str[state] : "none";
+}
+
+const char *delivery_kind_str(delivery_kind_t kind)
+{
+    return (kind < sizeof(kind_str) / sizeof(kind_str[0])) ? kind_str[kind] : "text";
+}
+
+static cJSON *event_json(const queued_event_t *q)
+{
+    char mac[MAC_STR_LEN + 1];
+    snprintf(mac, sizeof(mac), MACSTR, MAC2STR(q->evt.mac));
+    cJSON *obj = cJSON_CreateObject();
+    cJSON_AddNumberToObject(obj, "seq", q->seq);
+    cJSON_AddStringToObject(obj, "mac", mac);
+    cJSON_AddStringToObject(obj, "kind", delivery_kind_str(q->evt.kind));
+    cJSON_AddStringToObject(obj, "state", delivery_state_str(q->evt.state));
+    cJSON_AddNumberToObject(obj, "done", q->evt.done);
+    cJSON_AddNumberToObject(obj, "total", q->evt.total);
+    cJSON_AddNumberToObject(obj, "retries", q->evt.retries);
+    cJSON_AddNumberToObject(obj, "render_ms", q->evt.render_ms);
+    return obj;
+}
+
+// Runs in the server task: sends everything queued as one JSON array to
+// every connected page.
+static void push_work(void *arg)
+{
+    static queued_event_t batch[DELIVERY_PUSH_QUEUE]; // only the server task gets here
+    uint8_t count = 0;
+    uint32_t dropped;
+    portENTER_CRITICAL(&s_lock);
+    while (s_count > 0)
+    {
+        batch[count++] = s_queue[s_head];
+        s_head = (s_head + 1) % DELIVERY_PUSH_QUEUE;
+        s_count--;
+    }
+    dropped = s_dropped;
+    s_dropped = 0;
+    s_work_queued = false;
+    portEXIT_CRITICAL(&s_lock);
+    if (dropped)
+    {
+        ESP_LOGW(TAG, "%lu event(s) dropped, the page will reload the badge list", (unsigned long)dropped);
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    cJSON *list = cJSON_CreateArray();
+    for (uint8_t i = 0; i < count; i++)
+    {
+        cJSON_AddItemToArray(list, event_json(&batch[i]));
+    }
+    char *text = cJSON_PrintUnformatted(list);
+    cJSON_Delete(list);
+    if (!text)
+    {
+        ESP_LOGW(TAG, "No memory for %u event(s)", count);
+        return;
+    }
+
+    int fds[CONFIG_LWIP_MAX_SOCKETS];
+    size_t fd_count = sizeof(fds) / sizeof(fds[0]);
+    int sent = 0;
+    if (httpd_get_client_list(s_server, &fd_count, fds) == ESP_OK)
+    {
+        httpd_ws_frame_t frame = {
+            .type = HTTPD_WS_TYPE_TEXT,
+            .payload = (uint8_t *)text,
+            .len = strlen(text),
+        };
+        for (size_t i = 0; i < fd_count; i++)
+        {
+            if (httpd_ws_get_fd_info(s_server, fds[i]) == HTTPD_WS_CLIENT_WEBSOCKET &&
+                httpd_ws_send_frame_async(s_server, fds[i], &frame) == ESP_OK)
+            {
+                sent++;
+            }
+        }
+    }
+    free(text);
+    if (sent == 0)
+    {
+        s_listening = false;
+    }
+}
+
+// Caller holds s_lock. Progress that was not sent yet is updated in place,
+// so a slow page gets the latest figures instead of a backlog. Only the
+// badge's newest event of the same kind qualifies, or the order of steps
+// would change and an image's progress could replace a text's.
+static bool merge_progress(const delivery_event_t *evt)
+{
+    for (uint8_t i = s_count; i-- > 0;)
+    {
+        delivery_event_t *q = &s_queue[(s_head + i) % DELIVERY_PUSH_QUEUE].evt;
+        if (memcmp(q->mac, evt->mac, 6) == 0)
+        {
+            if (q->state != DELIVERY_SENDING || q->kind != evt->kind)
+            {
+                return false;
+            }
+            *q = *evt;
+            return true;
+        }
+    }
+    return false;
+}
+
+void delivery_push_post(const uint8_t mac[6], delivery_kind_t kind, delivery_state_t state,
+                        uint16_t done, uint16_t total, uint16_t retries)
+{
+    delivery_event_t evt = {
+        .kind = kind,
+        .state = state,
+        .done = done,
+        .total = total,
+        .retries = retries,
+    };
+    memcpy(evt.mac, mac, 6);
+    delivery_push_event(&evt);
+}
+
+void delivery_push_event(const delivery_event_t *evt)
+{
+    badge_status_set_delivery(evt);
+    if (!s_listening)
+    {
+        return;
+    }
+
+    bool kick = false;
+    portENTER_CRITICAL(&s_lock);
+    if (evt->state != DELIVERY_SENDING || !merge_progress(evt))
+    {
+        if (s_count < DELIVERY_PUSH_QUEUE)
+        {
+            queued_event_t *q = &s_queue[(s_head + s_count) % DELIVERY_PUSH_QUEUE];
+            q->seq = s_seq;
+            q->evt = *evt;
+            s_count++;
+        }
+        else
+        {
+            s_dropped++; // the gap in seq tells the page
+        }
+        s_seq++;
+    }
+    kick = !s_work_queued;
+    s_work_queued = true;
+    portEXIT_CRITICAL(&s_lock);
+
+    if (kick && httpd_queue_work(s_server, push_work, NULL) != ESP_OK)
+    {
+        portENTER_CRITICAL(&s_lock);
+        s_work_queued = false;
+        portEXIT_CRITICAL(&s_lock);
+    }
+}
+
+/**
+ * HTTP GET /ws
+ *   • WebSocket; the gateway sends JSON arrays of
+ *     {"seq","mac","kind","state","done","total","retries","render_ms"}
+ *   • seq counts up by one per event: a gap means events were lost and
+ *     the page should reload GET /api/badges
+ *   • Frames from the page are read and ignored
+ */
+esp_err_t delivery_push_ws_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_GET)
+    {
+        ESP_LOGI(TAG, "Page connected for delivery events");
+        s_server = req->handle;
+        s_listening = true;
+        return ESP_OK;
+    }
+
+    uint8_t buf[64];
+    httpd_ws_frame_t frame = {.payload = buf};
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);
+    if (err != ESP_OK || frame.len > sizeof(buf))
+    {
+        return err != ESP_OK ? err : ESP_ERR_INVALID_SIZE;
+    }
+    return frame.len ? httpd_ws_recv_frame(req, &frame, frame.len) : ESP_OK;
+}
@@ -0,0 +1,60 @@
+#ifndef DELIVERY_PUSH_H
+#define DELIVERY_PUSH_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// Events waiting for the server task; progress of one badge is merged
+#define DELIVERY_PUSH_QUEUE 64
+// Minimum spacing of progress events for one transfer
+#define DELIVERY_PUSH_PROGRESS_MS 250
+
+typedef enum
+{
+    DELIVERY_NONE,      // nothing sent since boot
+    DELIVERY_QUEUED,    // accepted, waiting for a transfer slot
+    DELIVERY_HELD,      // badge asleep, sent in its next wake window
+    DELIVERY_SENDING,   // transfer running, done of total chunks confirmed
+    DELIVERY_RETRY,     // attempt failed or was refused, trying again
+    DELIVERY_DONE,      // badge acknowledged the whole update
+    DELIVERY_FAILED,    // given up, or the badge could not show the update
+    DELIVERY_RENDERING, // badge reported it is drawing the update
+    DELIVERY_RENDERED,  // badge reported the refresh finished, render_ms is set
+} delivery_state_t;
+
+typedef enum
+{
+    DELIVERY_TEXT,
+    DELIVERY_IMAGE,
+} delivery_kind_t;
+
+// Where one badge's latest update stands, as pushed to the page.
+typedef struct
+{
+    uint8_t mac[6];
+    uint8_t kind;       // delivery_kind_t
+    uint8_t state;      // delivery_state_t
+    uint16_t done;
+    uint16_t total;
+    uint16_t retries;   // frames sent again, or attempts for single-frame updates
+    uint32_t render_ms; // panel refresh duration reported by the badge
+} delivery_event_t;
+
+// Reports a delivery step of mac. Never blocks: safe from any task. The
+// state is kept in badge_status and, while a page is connected, pushed to it
+// from the server task. total is 0 when there is no progress to report.
+void delivery_push_post(const uint8_t mac[6], delivery_kind_t kind, delivery_state_t state,
+                        uint16_t done, uint16_t total, uint16_t retries);
+
+// Same for a complete event, e.g. one carrying render_ms.
+void delivery_push_event(const delivery_event_t *evt);
+
+// Name of state as used in the JSON events and GET /api/badges.
+const char *delivery_state_str(delivery_state_t state);
+const char *delivery_kind_str(delivery_kind_t kind);
+
+// HTTP GET /ws WebSocket handler; the page listens for event batches there.
+esp_err_t delivery_push_ws_handler(httpd_req_t *req);
+
+#endif // DELIVERY_PUSH_H
@@ -1,2 +1,30 @@
 #!/usr/bin/env bash
-xxd -i webcontent.html > web_content.h
\ No newline at end of file
+# Generates web_content.h: the page, its stylesheet and its script, gzipped.
+# The stylesheet and script are published under URIs that carry their
+# content hash; the page gets an ETag from its own hash instead.
+set -e
+cd "$(dirname "$0")"
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+content_hash() { sha256sum "$1" | cut -c1-8; }
+css_uri="/app-$(content_hash webcontent.css).css"
+js_uri="/app-$(content_hash webcontent.js).js"
+
+sed -e "s#{{CSS_URI}}#$css_uri#" -e "s#{{JS_URI}}#$js_uri#" webcontent.html > "$tmp/webcontent_html"
+html_etag="\\\"$(content_hash "$tmp/webcontent_html")\\\""
+gzip -9 -n -c "$tmp/webcontent_html" > "$tmp/webcontent_html_gz"
+gzip -9 -n -c webcontent.css > "$tmp/webcontent_css_gz"
+gzip -9 -n -c webcontent.js > "$tmp/webcontent_js_gz"
+
+{
+    echo "// Generated by html_gen.sh from webcontent.html/.css/.js, do not edit"
+    echo "#define WEBCONTENT_HTML_ETAG \"$html_etag\""
+    echo "#define WEBCONTENT_CSS_URI \"$css_uri\""
+    echo "#define WEBCONTENT_JS_URI \"$js_uri\""
+    echo
+    # const keeps the arrays in flash instead of copying them to RAM at boot
+    (cd "$tmp" && xxd -i webcontent_html_gz && xxd -i webcontent_css_gz && xxd -i webcontent_js_gz) |
+        sed 's/^unsigned/const unsigned/'
+} > web_content.h
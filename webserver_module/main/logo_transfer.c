@@ -0,0 +1,686 @@
+#include "logo_transfer.h"
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "esp_now.h"
+#include "esp_timer.h"
+#include "xfer_tx.h"
+#include "xfer_mtx.h"
+#include "img_codec.h"
+#include "badge_wake.h"
+#include "webserver.h"
+#include "badge_registry.h"
+#include "peer_cache.h"
+#include "delivery_push.h"
+
+static const char *TAG = "LogoXfer";
+
+typedef enum
+{
+    XFER_EVT_SENT,   // send callback fired for a badge
+    XFER_EVT_STATUS, // STATUS frame received from a badge
+    XFER_EVT_KICK,   // new image queued
+} xfer_evt_type_t;
+
+typedef struct
+{
+    xfer_evt_type_t type;
+    uint8_t mac[6];
+    bool ok;
+    uint8_t len;
+    uint8_t data[sizeof(xfer_status_t)];
+} xfer_evt_t;
+
+// One image on its way to a set of badges, freed after the last delivery
+typedef struct
+{
+    uint8_t *raw;
+    size_t raw_len;
+    uint8_t *packed; // NULL when no encoding beats raw
+    size_t packed_len;
+    img_enc_t enc;
+    uint16_t pending; // deliveries not finished yet
+    uint16_t done;
+    uint16_t failed;
+    uint32_t queued_ms;
+    uint8_t (*targets)[6]; // broadcast jobs: who to send to, NULL otherwise
+    uint16_t target_count;
+} logo_job_t;
+
+typedef struct
+{
+    bool used;
+    bool busy; // a transfer to this badge is running
+    uint8_t mac[6];
+    logo_job_t *queue[LOGO_QUEUE_DEPTH];
+    uint8_t head;
+    uint8_t count;
+} logo_peer_t;
+
+typedef struct
+{
+    logo_peer_t *peer; // NULL while the slot is free
+    logo_job_t *job;
+    img_enc_t enc;
+    uint32_t start_ms;
+    uint32_t pushed_ms; // last progress report
+    uint16_t pushed;    // chunks confirmed at that report
+    xfer_tx_t tx;
+} logo_slot_t;
+
+// The one broadcast transfer that may run next to the unicast slots
+typedef struct
+{
+    logo_job_t *job; // NULL while idle
+    uint32_t start_ms;
+    uint32_t pushed_ms;
+    uint16_t pushed[XFER_MTX_MAX_RX];
+    logo_peer_t *peers[XFER_MTX_MAX_RX];
+    xfer_mtx_t tx;
+} logo_mcast_t;
+
+static const uint8_t s_broadcast_mac[6] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+
+static QueueHandle_t s_evt_queue;
+static SemaphoreHandle_t s_lock; // guards s_peers and the job counters
+static logo_peer_t s_peers[BADGE_REGISTRY_MAX];
+static logo_slot_t s_slots[LOGO_ACTIVE_MAX];
+static logo_mcast_t s_mcast;
+static logo_job_t *s_mcast_queue[LOGO_MCAST_QUEUE];
+static uint8_t s_mcast_head;
+static uint8_t s_mcast_count;
+static volatile int s_active; // running transfers, lets the callbacks skip the queue when idle
+static uint16_t s_next_peer;  // round-robin position for starting transfers
+static uint8_t s_next_slot;   // round-robin position for servicing transfers
+static uint8_t s_next_id;
+
+static uint32_t now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static int link_send(void *ctx, const uint8_t *frame, size_t len)
+{
+    logo_slot_t *slot = ctx;
+    return peer_cache_send(slot->peer->mac, PEER_OWNER_LOGO, frame, len) == ESP_OK ? 0 : -1;
+}
+
+static int mcast_send(void *ctx, int receiver, const uint8_t *frame, size_t len)
+{
+    const uint8_t *mac = (receiver < 0) ? s_broadcast_mac : s_mcast.peers[receiver]->mac;
+    return peer_cache_send(mac, PEER_OWNER_LOGO, frame, len) == ESP_OK ? 0 : -1;
+}
+
+// Index of mac among the broadcast receivers, -1 if it is not one
+static int mcast_receiver(const uint8_t mac[6])
+{
+    if (!s_mcast.job)
+    {
+        return -1;
+    }
+    for (int r = 0; r < s_mcast.tx.rx_count; r++)
+    {
+        if (memcmp(s_mcast.peers[r]->mac, mac, 6) == 0)
+        {
+            return r;
+        }
+    }
+    return -1;
+}
+
+static logo_slot_t *slot_for(const uint8_t mac[6])
+{
+    for (int i = 0; i < LOGO_ACTIVE_MAX; i++)
+    {
+        if (s_slots[i].peer && memcmp(s_slots[i].peer->mac, mac, 6) == 0)
+        {
+            return &s_slots[i];
+        }
+    }
+    return NULL;
+}
+
+// Runs in Wi-Fi task context: only copy and queue.
+void logo_transfer_on_sent(const uint8_t mac[6], bool ok)
+{
+    if (s_active <= 0)
+    {
+        return;
+    }
+    xfer_evt_t evt = {.type = XFER_EVT_SENT, .ok = ok};
+    memcpy(evt.mac, mac, 6);
+    xQueueSend(s_evt_queue, &evt, 0);
+}
+
+void logo_transfer_on_recv(const uint8_t mac[6], const uint8_t *data, int len)
+{
+    if (s_active <= 0 || len != sizeof(xfer_status_t) || !xfer_is_frame(data, len, XFER_PKT_STATUS))
+    {
+        return;
+    }
+    xfer_evt_t evt = {.type = XFER_EVT_STATUS, .len = (uint8_t)len};
+    memcpy(evt.mac, mac, 6);
+    memcpy(evt.data, data, len);
+    xQueueSend(s_evt_queue, &evt, 0);
+}
+
+// Picks the smallest encoding; returns RAW (and *out = NULL) when nothing beats it.
+// On success *out is a heap buffer owned by the caller.
+static img_enc_t compress(const uint8_t *data, size_t len, uint8_t **out, size_t *out_len)
+{
+    static const img_enc_t candidates[] = {IMG_ENC_PACKBITS, IMG_ENC_LZSS};
+    img_enc_t best = IMG_ENC_RAW;
+    *out = NULL;
+    *out_len = len;
+    if (len < 2)
+    {
+        return IMG_ENC_RAW;
+    }
+
+    uint8_t *scratch = malloc(len);
+    if (!scratch)
+    {
+        ESP_LOGW(TAG, "No memory for compression, sending raw");
+        return IMG_ENC_RAW;
+    }
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        // Only accept results strictly smaller than the current best
+        size_t n = img_encode(candidates[i], data, len, scratch, *out_len - 1);
+        if (n == 0)
+        {
+            continue;
+        }
+        uint8_t *kept = realloc(*out, n);
+        if (!kept)
+        {
+            continue;
+        }
+        memcpy(kept, scratch, n);
+        *out = kept;
+        *out_len = n;
+        best = candidates[i];
+    }
+    free(scratch);
+    return best;
+}
+
+static void job_free(logo_job_t *job)
+{
+    free(job->targets);
+    free(job->packed);
+    free(job->raw);
+    free(job);
+}
+
+// Caller holds s_lock.
+static void job_delivered(logo_job_t *job, bool ok)
+{
+    if (ok)
+    {
+        job->done++;
+    }
+    else
+    {
+        job->failed++;
+    }
+    if (--job->pending == 0)
+    {
+        ESP_LOGI(TAG, "Image delivered to %u of %u badges in %lu ms", job->done, job->done + job->failed,
+                 (unsigned long)(now_ms() - job->queued_ms));
+        job_free(job);
+    }
+}
+
+// Caller holds s_lock. Unknown badges take a free entry or one that is idle.
+static logo_peer_t *peer_for(const uint8_t mac[6])
+{
+    logo_peer_t *spare = NULL;
+    for (int i = 0; i < BADGE_REGISTRY_MAX; i++)
+    {
+        logo_peer_t *peer = &s_peers[i];
+        if (peer->used && memcmp(peer->mac, mac, 6) == 0)
+        {
+            return peer;
+        }
+        if (!spare && (!peer->used || (!peer->busy && peer->count == 0)))
+        {
+            spare = peer;
+        }
+    }
+    if (spare)
+    {
+        memset(spare, 0, sizeof(*spare));
+        spare->used = true;
+        memcpy(spare->mac, mac, 6);
+    }
+    return spare;
+}
+
+// True if macs[i] is listed before, each badge gets an image once
+static bool seen_before(const uint8_t macs[][6], size_t i)
+{
+    for (size_t j = 0; j < i; j++)
+    {
+        if (memcmp(macs[j], macs[i], 6) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Caller holds s_lock.
+static void peer_push(logo_peer_t *peer, logo_job_t *job)
+{
+    if (peer->count == LOGO_QUEUE_DEPTH)
+    {
+        ESP_LOGW(TAG, "Queue for " MACSTR " is full, image dropped", MAC2STR(peer->mac));
+        delivery_push_post(peer->mac, DELIVERY_IMAGE, DELIVERY_FAILED, 0, 0, 0);
+        job_delivered(job, false);
+        return;
+    }
+    peer->queue[(peer->head + peer->count) % LOGO_QUEUE_DEPTH] = job;
+    peer->count++;
+}
+
+static void slot_begin(logo_slot_t *slot, img_enc_t enc, uint32_t now)
+{
+    logo_job_t *job = slot->job;
+    xfer_link_t link = {.send = link_send, .ctx = slot};
+    slot->enc = enc;
+    slot->start_ms = now;
+    slot->pushed_ms = now;
+    slot->pushed = 0;
+    if (enc == IMG_ENC_RAW)
+    {
+        xfer_tx_begin(&slot->tx, &link, ++s_next_id, enc, job->raw, job->raw_len, now);
+    }
+    else
+    {
+        xfer_tx_begin(&slot->tx, &link, ++s_next_id, enc, job->packed, job->packed_len, now);
+    }
+    delivery_push_post(slot->peer->mac, DELIVERY_IMAGE, DELIVERY_SENDING, 0, slot->tx.chunk_count, 0);
+}
+
+// Fills free slots with the next waiting badges, round-robin over the peer
+// table so one badge with a deep queue cannot starve the others. Returns true
+// if some badge has images waiting but is asleep right now.
+static bool start_transfers(uint32_t now)
+{
+    bool sleeping = false;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < LOGO_ACTIVE_MAX; i++)
+    {
+        logo_slot_t *slot = &s_slots[i];
+        if (slot->peer)
+        {
+            continue;
+        }
+        for (int n = 0; n < BADGE_REGISTRY_MAX; n++)
+        {
+            logo_peer_t *peer = &s_peers[(s_next_peer + n) % BADGE_REGISTRY_MAX];
+            if (!peer->used || peer->busy || peer->count == 0)
+            {
+                continue;
+            }
+            if (!badge_wake_listening(peer->mac))
+            {
+                sleeping = true;
+                continue;
+            }
+            s_next_peer = (peer - s_peers + 1) % BADGE_REGISTRY_MAX;
+            peer->busy = true;
+            slot->peer = peer;
+            slot->job = peer->queue[peer->head];
+            peer->head = (peer->head + 1) % LOGO_QUEUE_DEPTH;
+            peer->count--;
+            s_active++;
+            slot_begin(slot, slot->job->enc, now);
+            break;
+        }
+    }
+    xSemaphoreGive(s_lock);
+    return sleeping;
+}
+
+static void finish_transfer(logo_slot_t *slot, uint32_t now)
+{
+    static const char *const state_str[] = {"running", "done", "FAILED", "refused"};
+    const xfer_tx_stats_t *st = &slot->tx.stats;
+    ESP_LOGI(TAG, "Transfer %u to " MACSTR " %s in %lu ms: enc %d, %u bytes, %u chunks, %lu frames, %lu retransmits, %lu link failures, %lu timeouts",
+             slot->tx.id, MAC2STR(slot->peer->mac), state_str[slot->tx.state],
+             (unsigned long)(now - slot->start_ms), slot->enc, (unsigned)slot->tx.len,
+             slot->tx.chunk_count, (unsigned long)st->frames_sent, (unsigned long)st->retransmits,
+             (unsigned long)st->link_failures, (unsigned long)st->timeouts);
+
+    if (slot->tx.state == XFER_TX_REFUSED && slot->enc != IMG_ENC_RAW)
+    {
+        // Older badge firmware only understands raw images
+        ESP_LOGW(TAG, "Badge " MACSTR " refused enc %d, falling back to raw", MAC2STR(slot->peer->mac), slot->enc);
+        delivery_push_post(slot->peer->mac, DELIVERY_IMAGE, DELIVERY_RETRY, 0, slot->tx.chunk_count,
+                           (uint16_t)st->retransmits);
+        slot_begin(slot, IMG_ENC_RAW, now);
+        return;
+    }
+
+    bool ok = slot->tx.state == XFER_TX_DONE;
+    delivery_push_post(slot->peer->mac, DELIVERY_IMAGE, ok ? DELIVERY_DONE : DELIVERY_FAILED,
+                       ok ? slot->tx.chunk_count : slot->tx.base, slot->tx.chunk_count, (uint16_t)st->retransmits);
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    job_delivered(slot->job, ok);
+    slot->peer->busy = false;
+    slot->peer = NULL;
+    slot->job = NULL;
+    s_active--;
+    xSemaphoreGive(s_lock);
+}
+
+// Starts the next broadcast image once the previous one is through. Badges
+// that are asleep or busy with a unicast transfer get the image queued for
+// unicast instead; with fewer than two receivers left nothing is broadcast.
+static void start_mcast(uint32_t now)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_mcast.job || s_mcast_count == 0)
+    {
+        xSemaphoreGive(s_lock);
+        return;
+    }
+    logo_job_t *job = s_mcast_queue[s_mcast_head];
+    s_mcast_head = (s_mcast_head + 1) % LOGO_MCAST_QUEUE;
+    s_mcast_count--;
+
+    // Receivers are marked busy and unicast badges get the image queued right
+    // away, so peer_for() cannot recycle a peer picked earlier in the loop
+    int rx_count = 0;
+    uint16_t target_count = job->target_count; // job is freed if every target fails
+    for (int i = 0; i < target_count; i++)
+    {
+        logo_peer_t *peer = peer_for(job->targets[i]);
+        if (!peer)
+        {
+            ESP_LOGW(TAG, "No room to track " MACSTR ", image dropped", MAC2STR(job->targets[i]));
+            delivery_push_post(job->targets[i], DELIVERY_IMAGE, DELIVERY_FAILED, 0, 0, 0);
+            job_delivered(job, false);
+        }
+        else if (peer->busy || rx_count == XFER_MTX_MAX_RX || !badge_wake_listening(peer->mac))
+        {
+            peer_push(peer, job);
+        }
+        else
+        {
+            peer->busy = true;
+            s_mcast.peers[rx_count++] = peer;
+        }
+    }
+    if (rx_count < 2)
+    {
+        for (int r = 0; r < rx_count; r++)
+        {
+            s_mcast.peers[r]->busy = false;
+            peer_push(s_mcast.peers[r], job);
+        }
+        rx_count = 0;
+    }
+
+    if (rx_count > 0)
+    {
+        xfer_mlink_t link = {.send = mcast_send, .ctx = NULL};
+        s_mcast.job = job;
+        s_mcast.start_ms = now;
+        s_mcast.pushed_ms = now;
+        memset(s_mcast.pushed, 0, sizeof(s_mcast.pushed));
+        s_active++;
+        if (job->enc == IMG_ENC_RAW)
+        {
+            xfer_mtx_begin(&s_mcast.tx, &link, ++s_next_id, job->enc, job->raw, job->raw_len, rx_count, now);
+        }
+        else
+        {
+            xfer_mtx_begin(&s_mcast.tx, &link, ++s_next_id, job->enc, job->packed, job->packed_len, rx_count, now);
+        }
+        for (int r = 0; r < rx_count; r++)
+        {
+            delivery_push_post(s_mcast.peers[r]->mac, DELIVERY_IMAGE, DELIVERY_SENDING, 0, s_mcast.tx.chunk_count, 0);
+        }
+    }
+    xSemaphoreGive(s_lock);
+}
+
+// Badges the broadcast did not reach, or that refused its encoding, get a
+// second chance by unicast, which also handles the fall back to raw.
+static void finish_mcast(uint32_t now)
+{
+    const xfer_mtx_t *tx = &s_mcast.tx;
+    const xfer_mtx_stats_t *st = &tx->stats;
+    int done = 0;
+    for (int r = 0; r < tx->rx_count; r++)
+    {
+        done += tx->rx[r].state == XFER_TX_DONE;
+    }
+    ESP_LOGI(TAG, "Broadcast %u to %d of %u badges in %lu ms: enc %d, %u chunks in %lu frames (%lu retransmits), %lu joins, %lu link failures, %lu rounds, %lu status, %lu timeouts",
+             tx->id, done, tx->rx_count, (unsigned long)(now - s_mcast.start_ms), tx->encoding, tx->chunk_count,
+             (unsigned long)st->frames_sent, (unsigned long)st->retransmits, (unsigned long)st->joins_sent,
+             (unsigned long)st->link_failures, (unsigned long)st->rounds, (unsigned long)st->status_rx, (unsigned long)st->timeouts);
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int r = 0; r < tx->rx_count; r++)
+    {
+        logo_peer_t *peer = s_mcast.peers[r];
+        peer->busy = false;
+        if (tx->rx[r].state == XFER_TX_DONE)
+        {
+            delivery_push_post(peer->mac, DELIVERY_IMAGE, DELIVERY_DONE, tx->chunk_count, tx->chunk_count,
+                               (uint16_t)st->retransmits);
+            job_delivered(s_mcast.job, true);
+        }
+        else
+        {
+            ESP_LOGW(TAG, "Broadcast missed " MACSTR ", retrying by unicast", MAC2STR(peer->mac));
+            delivery_push_post(peer->mac, DELIVERY_IMAGE, DELIVERY_RETRY, tx->rx[r].next_seq, tx->chunk_count,
+                               (uint16_t)st->retransmits);
+            peer_push(peer, s_mcast.job);
+        }
+    }
+    s_mcast.job = NULL;
+    s_active--;
+    xSemaphoreGive(s_lock);
+}
+
+// Reports how far the running transfers got, at most every
+// DELIVERY_PUSH_PROGRESS_MS and only when something moved.
+static void push_progress(uint32_t now)
+{
+    for (int i = 0; i < LOGO_ACTIVE_MAX; i++)
+    {
+        logo_slot_t *slot = &s_slots[i];
+        if (slot->peer && slot->tx.base != slot->pushed && now - slot->pushed_ms >= DELIVERY_PUSH_PROGRESS_MS)
+        {
+            slot->pushed = slot->tx.base;
+            slot->pushed_ms = now;
+            delivery_push_post(slot->peer->mac, DELIVERY_IMAGE, DELIVERY_SENDING, slot->tx.base,
+                               slot->tx.chunk_count, (uint16_t)slot->tx.stats.retransmits);
+        }
+    }
+    if (!s_mcast.job || now - s_mcast.pushed_ms < DELIVERY_PUSH_PROGRESS_MS)
+    {
+        return;
+    }
+    s_mcast.pushed_ms = now;
+    const xfer_mtx_t *tx = &s_mcast.tx;
+    for (int r = 0; r < tx->rx_count; r++)
+    {
+        if (tx->rx[r].state == XFER_TX_RUNNING && tx->rx[r].next_seq != s_mcast.pushed[r])
+        {
+            s_mcast.pushed[r] = tx->rx[r].next_seq;
+            delivery_push_post(s_mcast.peers[r]->mac, DELIVERY_IMAGE, DELIVERY_SENDING, tx->rx[r].next_seq,
+                               tx->chunk_count, (uint16_t)tx->stats.retransmits);
+        }
+    }
+}
+
+static void logo_task(void *arg)
+{
+    while (true)
+    {
+        uint32_t now = now_ms();
+        for (int i = 0; i < LOGO_ACTIVE_MAX; i++)
+        {
+            if (s_slots[i].peer && s_slots[i].tx.state != XFER_TX_RUNNING)
+            {
+                finish_transfer(&s_slots[i], now);
+            }
+        }
+        if (s_mcast.job && s_mcast.tx.state != XFER_TX_RUNNING)
+        {
+            finish_mcast(now);
+        }
+        start_mcast(now);
+        bool sleeping = start_transfers(now);
+
+        if (s_mcast.job)
+        {
+            xfer_mtx_service(&s_mcast.tx, now);
+        }
+        // Rotate who fills the radio queue first, so transfers share the airtime
+        for (int i = 0; i < LOGO_ACTIVE_MAX; i++)
+        {
+            logo_slot_t *slot = &s_slots[(s_next_slot + i) % LOGO_ACTIVE_MAX];
+            if (slot->peer)
+            {
+                xfer_tx_service(&slot->tx, now);
+            }
+        }
+        s_next_slot = (s_next_slot + 1) % LOGO_ACTIVE_MAX;
+        push_progress(now);
+
+        TickType_t wait = s_active ? pdMS_TO_TICKS(XFER_SERVICE_MS)
+                          : sleeping ? pdMS_TO_TICKS(LOGO_WAKE_POLL_MS)
+                                     : portMAX_DELAY;
+        xfer_evt_t evt;
+        while (xQueueReceive(s_evt_queue, &evt, wait) == pdTRUE)
+        {
+            logo_slot_t *slot = slot_for(evt.mac);
+            int receiver = mcast_receiver(evt.mac);
+            if (slot && evt.type == XFER_EVT_SENT)
+            {
+                xfer_tx_on_sent(&slot->tx, evt.ok);
+            }
+            else if (slot && evt.type == XFER_EVT_STATUS)
+            {
+                xfer_tx_on_status(&slot->tx, evt.data, evt.len, now_ms());
+            }
+            else if (s_mcast.job && evt.type == XFER_EVT_SENT &&
+                     (receiver >= 0 || memcmp(evt.mac, s_broadcast_mac, 6) == 0))
+            {
+                xfer_mtx_on_sent(&s_mcast.tx, evt.ok);
+            }
+            else if (receiver >= 0 && evt.type == XFER_EVT_STATUS)
+            {
+                xfer_mtx_on_status(&s_mcast.tx, receiver, evt.data, evt.len, now_ms());
+            }
+            wait = 0; // drain what is queued, then go back to sending
+        }
+    }
+}
+
+void logo_transfer_init(void)
+{
+    // Room for a full radio window of every active transfer plus their STATUS
+    // frames, and for the STATUS burst that ends a broadcast round
+    s_evt_queue = xQueueCreate(LOGO_ACTIVE_MAX * (XFER_RADIO_DEPTH + 4) + XFER_MTX_MAX_RX, sizeof(xfer_evt_t));
+    s_lock = xSemaphoreCreateMutex();
+    assert(s_evt_queue && s_lock);
+    xTaskCreate(logo_task, "logo_xfer", 4096, NULL, 5, NULL);
+}
+
+esp_err_t logo_transfer_queue(const uint8_t macs[][6], size_t count, uint8_t *image, size_t len)
+{
+    logo_job_t *job = calloc(1, sizeof(*job));
+    if (!job)
+    {
+        free(image);
+        return ESP_ERR_NO_MEM;
+    }
+    job->raw = image;
+    job->raw_len = len;
+    job->queued_ms = now_ms();
+    // Compressed once here, not per badge
+    job->enc = compress(image, len, &job->packed, &job->packed_len);
+    if (job->packed)
+    {
+        ESP_LOGI(TAG, "Image %u -> %u bytes (enc %d, %u%%)", (unsigned)len, (unsigned)job->packed_len,
+                 job->enc, (unsigned)(job->packed_len * 100 / len));
+    }
+
+    // Broadcast jobs keep their target list until the broadcast starts
+    size_t unique = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        unique += !seen_before(macs, i);
+    }
+    if (unique >= LOGO_MCAST_MIN)
+    {
+        job->targets = malloc(unique * 6);
+        for (size_t i = 0; job->targets && i < count; i++)
+        {
+            if (!seen_before(macs, i))
+            {
+                memcpy(job->targets[job->target_count++], macs[i], 6);
+            }
+        }
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (job->targets && s_mcast_count < LOGO_MCAST_QUEUE)
+    {
+        s_mcast_queue[(s_mcast_head + s_mcast_count) % LOGO_MCAST_QUEUE] = job;
+        s_mcast_count++;
+        job->pending = job->target_count;
+        for (int i = 0; i < job->target_count; i++)
+        {
+            delivery_push_post(job->targets[i], DELIVERY_IMAGE, DELIVERY_QUEUED, 0, 0, 0);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (seen_before(macs, i))
+            {
+                continue;
+            }
+            logo_peer_t *peer = peer_for(macs[i]);
+            if (!peer || peer->count == LOGO_QUEUE_DEPTH)
+            {
+                ESP_LOGW(TAG, "Queue for " MACSTR " is full, image dropped", MAC2STR(macs[i]));
+                delivery_push_post(macs[i], DELIVERY_IMAGE, DELIVERY_FAILED, 0, 0, 0);
+                continue;
+            }
+            peer->queue[(peer->head + peer->count) % LOGO_QUEUE_DEPTH] = job;
+            peer->count++;
+            job->pending++;
+            delivery_push_post(macs[i], DELIVERY_IMAGE, DELIVERY_QUEUED, 0, 0, 0);
+        }
+    }
+    bool queued = job->pending > 0;
+    if (!queued)
+    {
+        job_free(job);
+    }
+    xSemaphoreGive(s_lock);
+
+    if (!queued)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    xfer_evt_t evt = {.type = XFER_EVT_KICK};
+    xQueueSend(s_evt_queue, &evt, portMAX_DELAY);
+    return ESP_OK;
+}
@@ -0,0 +1,41 @@
+#ifndef LOGO_TRANSFER_H
+#define LOGO_TRANSFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+// How often the transfer loop wakes up without events to check timeouts
+#define XFER_SERVICE_MS 10
+// Transfers run at the same time; their frames are interleaved on the radio
+#define LOGO_ACTIVE_MAX 4
+// Images waiting per badge; the oldest is sent first
+#define LOGO_QUEUE_DEPTH 4
+// How often badges that sleep between wake windows are checked again
+#define LOGO_WAKE_POLL_MS 20
+// Images for at least this many listening badges are broadcast once
+#define LOGO_MCAST_MIN 3
+// Broadcast images waiting for their turn
+#define LOGO_MCAST_QUEUE 4
+
+// Creates the event queue and the scheduler task. Must be called after esp_now_init().
+void logo_transfer_init(void);
+
+// ESP-NOW callback hooks, safe to call from the Wi-Fi task.
+void logo_transfer_on_sent(const uint8_t mac[6], bool ok);
+void logo_transfer_on_recv(const uint8_t mac[6], const uint8_t *data, int len);
+
+// Queues one image for delivery to count badges and returns right away.
+// Takes ownership of image, which must come from malloc(). The image is
+// compressed once with whichever img_codec encoding is smallest and re-sent
+// raw to badges that refuse that encoding. Each badge gets its own windowed
+// transfer; up to LOGO_ACTIVE_MAX run interleaved, the rest wait in per-badge
+// queues and are served round-robin. Power-saving badges are served in their
+// wake windows. With LOGO_MCAST_MIN or more targets the image is broadcast
+// once to every badge that is listening, and only badges that miss out get
+// it by unicast. A badge listed more than once gets the image once. Returns
+// ESP_ERR_NO_MEM if no badge could take the image.
+esp_err_t logo_transfer_queue(const uint8_t macs[][6], size_t count, uint8_t *image, size_t len);
+
+#endif // LOGO_TRANSFER_H
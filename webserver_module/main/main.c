@@ -24,6 +24,7 @@
 #include "webserver.h"
 #include "text_decode_utils.h"
 #include "wifi.h"
+#include "badge_registry.h"
 
 static const char *TAG = "webserver";
 
@@ -37,6 +38,7 @@ void app_main(void)
         ret = nvs_flash_init();
     }
     ESP_ERROR_CHECK(ret);
+    ESP_ERROR_CHECK(badge_registry_init());
 
     ESP_LOGI(TAG, "Starting in Access Point mode");
     wifi_init_softap();
@@ -0,0 +1,237 @@
+#include "peer_cache.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "esp_timer.h"
+#include "wifi.h"
+
+static const char *TAG = "PeerCache";
+
+typedef struct
+{
+    bool used;
+    bool stale; // forgotten while frames were in flight, the first to go
+    uint8_t mac[6];
+    uint8_t head;     // oldest entry of owners[]
+    uint8_t inflight; // frames handed to ESP-NOW whose send callback is outstanding
+    uint8_t owners[PEER_CACHE_INFLIGHT_MAX]; // peer_owner_t of those frames, oldest first
+    uint32_t last_ms; // last send, picks the eviction victim
+} cache_entry_t;
+
+static cache_entry_t s_entries[PEER_CACHE_SIZE];
+// The broadcast peer is permanent and never evicted, only its frames are tracked
+static cache_entry_t s_broadcast = {.used = true, .mac = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}};
+static peer_cache_stats_t s_stats;
+// s_lock guards the table and is taken from the Wi-Fi task; s_op_lock
+// serialises sends, so send callbacks come back in the order the owners
+// were recorded, and the slow esp_now_add_peer()/esp_now_del_peer() calls
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t s_op_lock;
+
+static uint32_t now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Caller holds s_lock.
+static cache_entry_t *find(const uint8_t mac[6])
+{
+    if (memcmp(mac, s_broadcast.mac, 6) == 0)
+    {
+        return &s_broadcast;
+    }
+    for (int i = 0; i < PEER_CACHE_SIZE; i++)
+    {
+        if (s_entries[i].used && memcmp(s_entries[i].mac, mac, 6) == 0)
+        {
+            return &s_entries[i];
+        }
+    }
+    return NULL;
+}
+
+// Caller holds s_lock. A free entry, or a forgotten one, or the least
+// recently used one, that has nothing in flight; or NULL.
+static cache_entry_t *victim(void)
+{
+    cache_entry_t *best = NULL;
+    for (int i = 0; i < PEER_CACHE_SIZE; i++)
+    {
+        cache_entry_t *e = &s_entries[i];
+        if (!e->used)
+        {
+            return e;
+        }
+        if (e->inflight == 0 &&
+            (!best || e->stale > best->stale ||
+             (e->stale == best->stale && (int32_t)(e->last_ms - best->last_ms) < 0)))
+        {
+            best = e;
+        }
+    }
+    return best;
+}
+
+// Caller holds s_lock.
+static void push_owner(cache_entry_t *e, peer_owner_t owner, uint32_t now)
+{
+    e->owners[(e->head + e->inflight) % PEER_CACHE_INFLIGHT_MAX] = (uint8_t)owner;
+    e->inflight++;
+    e->last_ms = now;
+    e->stale = false;
+}
+
+static esp_err_t add(const uint8_t mac[6])
+{
+    esp_now_peer_info_t peer_info = {0};
+    peer_info.channel = STA_CHANNEL;
+    peer_info.encrypt = false;
+    memcpy(peer_info.peer_addr, mac, 6);
+    return esp_now_add_peer(&peer_info);
+}
+
+void peer_cache_init(void)
+{
+    s_op_lock = xSemaphoreCreateMutex();
+    assert(s_op_lock);
+    // Broadcast images go to the broadcast address, which must be a peer too
+    ESP_ERROR_CHECK(add(s_broadcast.mac));
+}
+
+// Caller holds s_op_lock. Makes mac a peer and records one frame from owner
+// in flight for it; *out is its entry.
+static esp_err_t acquire(const uint8_t mac[6], peer_owner_t owner, cache_entry_t **out)
+{
+    uint32_t now = now_ms();
+    portENTER_CRITICAL(&s_lock);
+    cache_entry_t *e = find(mac);
+    bool present = e != NULL;
+    bool full = present && e->inflight == PEER_CACHE_INFLIGHT_MAX;
+    uint8_t evicted[6];
+    bool evict = false;
+    if (present && !full)
+    {
+        push_owner(e, owner, now);
+        s_stats.hits++;
+    }
+    else if (!present)
+    {
+        e = victim();
+        if (e && e->used)
+        {
+            memcpy(evicted, e->mac, 6);
+            evict = true;
+        }
+        if (e)
+        {
+            e->used = false; // reserved: the Wi-Fi task must not count frames for it
+        }
+    }
+    if (!e || full)
+    {
+        s_stats.stalls++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    *out = e;
+    esp_err_t err = (e && !full) ? ESP_OK : ESP_ERR_ESPNOW_FULL;
+    if (e && !present)
+    {
+        if (evict)
+        {
+            esp_now_del_peer(evicted);
+        }
+        err = add(mac);
+        portENTER_CRITICAL(&s_lock);
+        if (err == ESP_OK)
+        {
+            memset(e, 0, sizeof(*e));
+            e->used = true;
+            memcpy(e->mac, mac, 6);
+            push_owner(e, owner, now);
+            s_stats.adds++;
+        }
+        s_stats.evictions += evict;
+        uint32_t evictions = s_stats.evictions;
+        portEXIT_CRITICAL(&s_lock);
+
+        if (evict && evictions % PEER_CACHE_LOG_EVERY == 0)
+        {
+            ESP_LOGI(TAG, "%lu hits, %lu adds, %lu evictions, %lu stalls", (unsigned long)s_stats.hits,
+                     (unsigned long)s_stats.adds, (unsigned long)evictions, (unsigned long)s_stats.stalls);
+        }
+    }
+
+    if (err != ESP_OK)
+    {
+        ESP_LOGD(TAG, "No peer entry for " MACSTR ": %s", MAC2STR(mac), esp_err_to_name(err));
+    }
+    return err;
+}
+
+esp_err_t peer_cache_send(const uint8_t mac[6], peer_owner_t owner, const uint8_t *data, size_t len)
+{
+    xSemaphoreTake(s_op_lock, portMAX_DELAY);
+    cache_entry_t *e;
+    esp_err_t err = acquire(mac, owner, &e);
+    if (err == ESP_OK)
+    {
+        err = esp_now_send(mac, data, len);
+        if (err != ESP_OK)
+        {
+            // No send callback will come; ours is the newest owner as s_op_lock is held
+            portENTER_CRITICAL(&s_lock);
+            e->inflight--;
+            portEXIT_CRITICAL(&s_lock);
+        }
+    }
+    xSemaphoreGive(s_op_lock);
+    return err;
+}
+
+peer_owner_t peer_cache_on_sent(const uint8_t mac[6])
+{
+    peer_owner_t owner = PEER_OWNER_NONE;
+    portENTER_CRITICAL(&s_lock);
+    cache_entry_t *e = find(mac);
+    if (e && e->inflight > 0)
+    {
+        owner = (peer_owner_t)e->owners[e->head];
+        e->head = (e->head + 1) % PEER_CACHE_INFLIGHT_MAX;
+        e->inflight--;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return owner;
+}
+
+void peer_cache_forget(const uint8_t mac[6])
+{
+    xSemaphoreTake(s_op_lock, portMAX_DELAY);
+    portENTER_CRITICAL(&s_lock);
+    cache_entry_t *e = find(mac);
+    bool remove = e && e != &s_broadcast && e->inflight == 0;
+    if (remove)
+    {
+        e->used = false;
+    }
+    else if (e && e != &s_broadcast)
+    {
+        // Its send callbacks still have to reach their owners
+        e->stale = true;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    if (remove)
+    {
+        esp_now_del_peer(mac);
+    }
+    xSemaphoreGive(s_op_lock);
+}
+
+void peer_cache_get_stats(peer_cache_stats_t *out)
+{
+    portENTER_CRITICAL(&s_lock);
+    *out = s_stats;
+    portEXIT_CRITICAL(&s_lock);
+}
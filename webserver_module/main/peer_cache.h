@@ -0,0 +1,57 @@
+#ifndef PEER_CACHE_H
+#define PEER_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_now.h"
+
+// ESP-NOW peer entries used as a cache; one is kept for the broadcast address
+#define PEER_CACHE_SIZE (ESP_NOW_MAX_TOTAL_PEER_NUM - 1)
+// A churn summary is logged after this many evictions
+#define PEER_CACHE_LOG_EVERY 32
+// Frames per badge handed to ESP-NOW whose send callback is outstanding
+#define PEER_CACHE_INFLIGHT_MAX 16
+
+// Module a frame was sent for; its send callback goes to that one only
+typedef enum
+{
+    PEER_OWNER_NONE,
+    PEER_OWNER_LOGO, // logo_transfer
+    PEER_OWNER_WAKE, // badge_wake
+} peer_owner_t;
+
+typedef struct
+{
+    uint32_t hits;      // sends to a badge that already was a peer
+    uint32_t adds;      // peers added on demand
+    uint32_t evictions; // idle peers removed to make room
+    uint32_t stalls;    // sends refused because every peer had frames in flight
+} peer_cache_stats_t;
+
+// Adds the permanent broadcast peer. Must be called after esp_now_init().
+void peer_cache_init(void);
+
+// Sends one frame to mac, making it an ESP-NOW peer first if needed. When
+// the peer table is full the least recently used peer without frames in
+// flight is removed. owner is remembered until the frame's send callback.
+// Returns ESP_ERR_ESPNOW_FULL if no peer can be removed right now or mac
+// has PEER_CACHE_INFLIGHT_MAX frames in flight, otherwise the result of
+// esp_now_send().
+esp_err_t peer_cache_send(const uint8_t mac[6], peer_owner_t owner, const uint8_t *data, size_t len);
+
+// ESP-NOW send callback hook, safe to call from the Wi-Fi task. ESP-NOW
+// reports the frames to one address in the order they were sent, so this
+// returns the owner of the oldest frame in flight to mac, or
+// PEER_OWNER_NONE if nothing was sent to it through the cache.
+peer_owner_t peer_cache_on_sent(const uint8_t mac[6]);
+
+// Removes mac from the peer table if it is there, e.g. when it is unregistered.
+// With frames in flight it stays until their send callbacks are through and
+// is the first to make room after that.
+void peer_cache_forget(const uint8_t mac[6]);
+
+void peer_cache_get_stats(peer_cache_stats_t *out);
+
+#endif // PEER_CACHE_H
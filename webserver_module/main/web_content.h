@@ -1,1021 +1,416 @@
-unsigned char webcontent_html[] = {
-  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74,
-  0x6d, 0x6c, 0x3e, 0x0d, 0x0a, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c,
-  0x61, 0x6e, 0x67, 0x3d, 0x22, 0x65, 0x6e, 0x22, 0x3e, 0x0d, 0x0a, 0x0d,
-  0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73,
-  0x65, 0x74, 0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x22, 0x20, 0x2f,
-  0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61,
-  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70,
-  0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69,
-  0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e,
-  0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d,
-  0x31, 0x2e, 0x30, 0x22, 0x20, 0x2f, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x42, 0x61, 0x64, 0x67,
-  0x65, 0x20, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x74, 0x69,
-  0x74, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x7b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0x20, 0x43, 0x6f, 0x72, 0x65, 0x20, 0x50, 0x61, 0x6c, 0x65,
-  0x74, 0x74, 0x65, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20, 0x2a, 0x2f, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2d, 0x2d, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x3a, 0x20, 0x23,
-  0x30, 0x30, 0x36, 0x38, 0x41, 0x32, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x70,
-  0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x2d, 0x68, 0x6f, 0x76, 0x65, 0x72,
-  0x3a, 0x20, 0x23, 0x30, 0x30, 0x35, 0x34, 0x38, 0x30, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2d, 0x2d, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x3a, 0x20, 0x23, 0x46,
-  0x38, 0x42, 0x44, 0x30, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x61, 0x63,
-  0x63, 0x65, 0x6e, 0x74, 0x2d, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x3a, 0x20,
-  0x23, 0x44, 0x39, 0x41, 0x35, 0x30, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d,
-  0x64, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x3a, 0x20, 0x23, 0x44, 0x36, 0x34,
-  0x35, 0x34, 0x35, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x64, 0x61, 0x6e, 0x67,
-  0x65, 0x72, 0x2d, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x3a, 0x20, 0x23, 0x42,
-  0x36, 0x33, 0x42, 0x33, 0x42, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x73, 0x75,
-  0x63, 0x63, 0x65, 0x73, 0x73, 0x3a, 0x20, 0x23, 0x33, 0x34, 0x38, 0x46,
-  0x33, 0x36, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x73, 0x75, 0x63, 0x63, 0x65,
-  0x73, 0x73, 0x2d, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x3a, 0x20, 0x23, 0x32,
-  0x43, 0x37, 0x44, 0x32, 0x43, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d,
-  0x62, 0x67, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x6c, 0x69, 0x6e,
-  0x65, 0x61, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6e, 0x74,
-  0x28, 0x31, 0x33, 0x35, 0x64, 0x65, 0x67, 0x2c, 0x20, 0x23, 0x33, 0x33,
-  0x39, 0x41, 0x43, 0x43, 0x2c, 0x20, 0x23, 0x30, 0x30, 0x35, 0x30, 0x37,
-  0x41, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x62, 0x67, 0x3a, 0x20, 0x23,
-  0x45, 0x41, 0x46, 0x34, 0x46, 0x42, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x73,
-  0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x3a, 0x20, 0x23, 0x46, 0x46, 0x46,
-  0x46, 0x46, 0x46, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x73, 0x75, 0x72, 0x66,
-  0x61, 0x63, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x20, 0x23, 0x44, 0x35,
-  0x45, 0x39, 0x46, 0x39, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x74,
-  0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x3a,
-  0x20, 0x23, 0x30, 0x44, 0x31, 0x46, 0x32, 0x44, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d,
-  0x2d, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64,
-  0x61, 0x72, 0x79, 0x3a, 0x20, 0x23, 0x33, 0x34, 0x35, 0x38, 0x36, 0x44,
-  0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0x20, 0x4d, 0x65, 0x74, 0x72, 0x69, 0x63,
-  0x73, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20,
-  0x2a, 0x2f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73,
-  0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x67,
-  0x61, 0x70, 0x3a, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d,
-  0x2d, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32, 0x34,
-  0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f,
-  0x77, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x20,
-  0x38, 0x70, 0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62,
-  0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
-  0x2e, 0x30, 0x38, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x73, 0x68, 0x61,
-  0x64, 0x6f, 0x77, 0x2d, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x30,
-  0x20, 0x34, 0x70, 0x78, 0x20, 0x36, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62,
-  0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
-  0x2e, 0x30, 0x34, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0x20, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x52, 0x65, 0x73, 0x65, 0x74, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0x20, 0x2a, 0x2f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2a, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2a, 0x3a, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2a, 0x3a, 0x3a, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x7b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x6f, 0x78, 0x2d, 0x73, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x3a, 0x20,
-  0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x78, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d,
-  0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20,
-  0x42, 0x6f, 0x64, 0x79, 0x20, 0x26, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x61,
-  0x69, 0x6e, 0x65, 0x72, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20, 0x2a, 0x2f, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64,
-  0x79, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79,
-  0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x75, 0x73,
-  0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61,
-  0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20,
-  0x66, 0x6c, 0x65, 0x78, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6d, 0x69, 0x6e, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
-  0x20, 0x31, 0x30, 0x30, 0x76, 0x68, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64,
-  0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
-  0x67, 0x61, 0x70, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x41, 0x72, 0x69, 0x61,
-  0x6c, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69,
-  0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
-  0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x67,
-  0x2d, 0x70, 0x61, 0x67, 0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c,
-  0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x74, 0x65,
-  0x78, 0x74, 0x2d, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d,
-  0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e,
-  0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x7b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a,
-  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x67, 0x29, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69,
-  0x75, 0x73, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x72, 0x61,
-  0x64, 0x69, 0x75, 0x73, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d,
-  0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28,
-  0x2d, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x2d, 0x73, 0x74, 0x72,
-  0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69,
-  0x6e, 0x67, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x70, 0x61,
-  0x64, 0x64, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64,
-  0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x38, 0x30,
-  0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x68, 0x31, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72,
-  0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20,
-  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x67, 0x61, 0x70, 0x29, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74,
-  0x3a, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x32, 0x20, 0x7b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x76, 0x61,
-  0x72, 0x28, 0x2d, 0x2d, 0x67, 0x61, 0x70, 0x29, 0x20, 0x30, 0x20, 0x63,
-  0x61, 0x6c, 0x63, 0x28, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x67, 0x61,
-  0x70, 0x29, 0x2f, 0x32, 0x29, 0x20, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x33, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
-  0x3a, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x28, 0x76, 0x61, 0x72, 0x28, 0x2d,
-  0x2d, 0x67, 0x61, 0x70, 0x29, 0x2f, 0x32, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
-  0x74, 0x65, 0x78, 0x74, 0x2d, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61,
-  0x72, 0x79, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0x20, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x20, 0x26,
-  0x20, 0x46, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94,
-  0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20, 0x2a, 0x2f, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74,
-  0x22, 0x5d, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d,
-  0x22, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x5d, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
-  0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
-  0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77,
-  0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x38, 0x70,
-  0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62,
-  0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x28,
-  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x67, 0x61, 0x70, 0x29, 0x2f, 0x32,
-  0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20,
-  0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x63,
-  0x63, 0x63, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
-  0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
-  0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c,
-  0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x74, 0x65,
-  0x78, 0x74, 0x2d, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
-  0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0x20, 0x42, 0x61, 0x64, 0x67, 0x65, 0x20,
-  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0x20, 0x2a, 0x2f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2e, 0x62, 0x61, 0x64, 0x67, 0x65, 0x2d, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b,
-  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28,
-  0x2d, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x61, 0x6c,
-  0x74, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
-  0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28,
-  0x2d, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x29, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20,
-  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77,
-  0x2d, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61,
-  0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
-  0x2d, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f,
-  0x6d, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x67, 0x61, 0x70,
-  0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a,
-  0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x65, 0x78,
-  0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
-  0x2d, 0x67, 0x61, 0x70, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 0x69, 0x67,
-  0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x66, 0x6c, 0x65,
-  0x78, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x62, 0x61, 0x64, 0x67,
-  0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x68, 0x33, 0x20, 0x7b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3a, 0x20, 0x31, 0x20, 0x31, 0x20,
-  0x31, 0x30, 0x30, 0x25, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2e, 0x62, 0x61, 0x64, 0x67, 0x65, 0x2d, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x7b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x66, 0x6c, 0x65, 0x78, 0x3a, 0x20, 0x31, 0x20, 0x31, 0x20, 0x31,
-  0x30, 0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
-  0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-  0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x67, 0x61, 0x70, 0x3a, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x28, 0x76, 0x61,
-  0x72, 0x28, 0x2d, 0x2d, 0x67, 0x61, 0x70, 0x29, 0x2f, 0x32, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d,
-  0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20,
-  0x4c, 0x6f, 0x67, 0x6f, 0x20, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20,
-  0x2a, 0x2f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2e, 0x6c, 0x6f, 0x67, 0x6f, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20,
-  0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3a, 0x20, 0x31, 0x20, 0x31,
-  0x20, 0x32, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63,
-  0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72,
-  0x28, 0x2d, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x61,
-  0x6c, 0x74, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
-  0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x76, 0x61, 0x72,
-  0x28, 0x2d, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x29, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x76, 0x61,
-  0x72, 0x28, 0x2d, 0x2d, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x29,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67,
-  0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x6c, 0x6f,
-  0x67, 0x6f, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x68, 0x33, 0x20,
-  0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f,
-  0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x28, 0x76,
-  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x67, 0x61, 0x70, 0x29, 0x2f, 0x32, 0x29,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2e, 0x6c, 0x6f, 0x67, 0x6f, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20,
-  0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69,
-  0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30,
-  0x25, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20,
-  0x61, 0x75, 0x74, 0x6f, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x76, 0x61,
-  0x72, 0x28, 0x2d, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
-  0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x67, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77,
-  0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x73, 0x68, 0x61, 0x64,
-  0x6f, 0x77, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x29, 0x2c, 0x20,
-  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77,
-  0x2d, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61,
-  0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a,
-  0x20, 0x63, 0x61, 0x6c, 0x63, 0x28, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
-  0x67, 0x61, 0x70, 0x29, 0x2f, 0x32, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x6c, 0x6f, 0x67, 0x6f,
-  0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61,
-  0x73, 0x2e, 0x73, 0x68, 0x6f, 0x77, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69,
-  0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0x20, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x46, 0x6f,
-  0x72, 0x6d, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80,
-  0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20, 0x2a, 0x2f, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x6d, 0x61, 0x63, 0x46,
-  0x6f, 0x72, 0x6d, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
-  0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67,
-  0x61, 0x70, 0x3a, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x28, 0x76, 0x61, 0x72,
-  0x28, 0x2d, 0x2d, 0x67, 0x61, 0x70, 0x29, 0x2f, 0x32, 0x29, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a, 0x20,
-  0x77, 0x72, 0x61, 0x70, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69,
-  0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
-  0x2d, 0x67, 0x61, 0x70, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x6d, 0x61, 0x63, 0x46, 0x6f, 0x72,
-  0x6d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-  0x6c, 0x65, 0x78, 0x3a, 0x20, 0x31, 0x20, 0x31, 0x20, 0x32, 0x30, 0x30,
-  0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2a, 0x20, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0x20, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73, 0x20, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2,
-  0x94, 0x80, 0xe2, 0x94, 0x80, 0xe2, 0x94, 0x80, 0x20, 0x2a, 0x2f, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74,
-  0x74, 0x6f, 0x6e, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61,
-  0x72, 0x61, 0x6e, 0x63, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
-  0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x70, 0x72, 0x69, 0x6d,
-  0x61, 0x72, 0x79, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
-  0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72,
-  0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75,
-  0x73, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x72, 0x61, 0x64,
-  0x69, 0x75, 0x73, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69,
-  0x6e, 0x67, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x31, 0x36, 0x70,
-  0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a,
-  0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x36,
-  0x30, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x74, 0x72,
-  0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x20, 0x75, 0x70, 0x70,
-  0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x74,
-  0x74, 0x65, 0x72, 0x2d, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3a,
-  0x20, 0x30, 0x2e, 0x35, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78,
-  0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x76, 0x61, 0x72,
-  0x28, 0x2d, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x2d, 0x73, 0x74,
-  0x72, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73,
-  0x6f, 0x72, 0x3a, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e,
-  0x3a, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
-  0x20, 0x30, 0x2e, 0x31, 0x35, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2d,
-  0x69, 0x6e, 0x2d, 0x6f, 0x75, 0x74, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
-  0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x3a, 0x6e, 0x6f, 0x74, 0x28, 0x3a,
-  0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x29, 0x20, 0x7b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a,
-  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x70, 0x72, 0x69, 0x6d, 0x61,
-  0x72, 0x79, 0x2d, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x29, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74,
-  0x74, 0x6f, 0x6e, 0x3a, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64,
-  0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3a,
-  0x20, 0x30, 0x2e, 0x35, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f,
-  0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x74, 0x2d, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2a, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74,
-  0x73, 0x20, 0x2a, 0x2f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e, 0x63, 0x6c, 0x65,
-  0x61, 0x72, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
-  0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
-  0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f,
-  0x6e, 0x2e, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x3a, 0x68, 0x6f, 0x76, 0x65,
-  0x72, 0x3a, 0x6e, 0x6f, 0x74, 0x28, 0x3a, 0x64, 0x69, 0x73, 0x61, 0x62,
-  0x6c, 0x65, 0x64, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b,
-  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28,
-  0x2d, 0x2d, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2d, 0x68, 0x6f, 0x76,
-  0x65, 0x72, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e, 0x64, 0x65,
-  0x6c, 0x65, 0x74, 0x65, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b,
-  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28,
-  0x2d, 0x2d, 0x64, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x29, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74,
-  0x74, 0x6f, 0x6e, 0x2e, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x3a, 0x68,
-  0x6f, 0x76, 0x65, 0x72, 0x3a, 0x6e, 0x6f, 0x74, 0x28, 0x3a, 0x64, 0x69,
-  0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x76,
-  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x64, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x2d,
-  0x68, 0x6f, 0x76, 0x65, 0x72, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
-  0x2e, 0x73, 0x65, 0x6e, 0x64, 0x2d, 0x6c, 0x6f, 0x67, 0x6f, 0x2d, 0x62,
-  0x74, 0x6e, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
-  0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
-  0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74,
-  0x6f, 0x6e, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x2d, 0x6c, 0x6f, 0x67, 0x6f,
-  0x2d, 0x62, 0x74, 0x6e, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x3a, 0x6e,
-  0x6f, 0x74, 0x28, 0x3a, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64,
-  0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x73,
-  0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x68, 0x6f, 0x76, 0x65, 0x72,
-  0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x74, 0x79,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61,
-  0x64, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
-  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69,
-  0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x3c, 0x68, 0x31, 0x3e, 0x42, 0x61, 0x64, 0x67, 0x65,
-  0x20, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x68, 0x31, 0x3e,
-  0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x44, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63,
-  0x20, 0x4d, 0x41, 0x43, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0x77,
-  0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e, 0x6a, 0x65, 0x63,
-  0x74, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x2d, 0x2d, 0x3e,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x21,
-  0x2d, 0x2d, 0x20, 0x7b, 0x7b, 0x4d, 0x41, 0x43, 0x5f, 0x4c, 0x49, 0x53,
-  0x54, 0x7d, 0x7d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x20, 0x73,
-  0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
-  0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x34, 0x30, 0x70, 0x78, 0x3b, 0x22,
-  0x3e, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x4e, 0x65,
-  0x77, 0x20, 0x42, 0x61, 0x64, 0x67, 0x65, 0x3c, 0x2f, 0x68, 0x32, 0x3e,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66,
-  0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x61, 0x63, 0x46,
-  0x6f, 0x72, 0x6d, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74,
-  0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x61, 0x63, 0x5f, 0x61, 0x64,
-  0x64, 0x72, 0x65, 0x73, 0x73, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65,
-  0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d,
-  0x61, 0x74, 0x3a, 0x20, 0x41, 0x41, 0x3a, 0x42, 0x42, 0x3a, 0x43, 0x43,
-  0x3a, 0x44, 0x44, 0x3a, 0x45, 0x45, 0x3a, 0x46, 0x46, 0x22, 0x3e, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70,
-  0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x3e, 0x52,
-  0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x3c, 0x2f, 0x62, 0x75, 0x74,
-  0x74, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0d, 0x0a, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
-  0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x57, 0x20,
-  0x3d, 0x20, 0x38, 0x30, 0x30, 0x2c, 0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f,
-  0x48, 0x20, 0x3d, 0x20, 0x34, 0x38, 0x30, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6e,
-  0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72,
-  0x65, 0x6e, 0x64, 0x65, 0x72, 0x41, 0x6e, 0x64, 0x54, 0x68, 0x72, 0x65,
-  0x73, 0x68, 0x6f, 0x6c, 0x64, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x2c, 0x20,
-  0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6d, 0x67, 0x20, 0x3d, 0x20, 0x6e,
-  0x65, 0x77, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x28, 0x29, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x6d, 0x67, 0x2e, 0x73, 0x72, 0x63, 0x20, 0x3d, 0x20, 0x55,
-  0x52, 0x4c, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4f, 0x62, 0x6a,
-  0x65, 0x63, 0x74, 0x55, 0x52, 0x4c, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x29,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x69, 0x6d, 0x67,
-  0x2e, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x3b, 0x0d, 0x0a,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x74, 0x78, 0x20,
-  0x3d, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x2e, 0x67, 0x65, 0x74,
-  0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x27, 0x32, 0x64, 0x27,
-  0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x63, 0x74, 0x78, 0x2e, 0x66, 0x69, 0x6c, 0x6c,
-  0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x77, 0x68, 0x69,
-  0x74, 0x65, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x74, 0x78, 0x2e, 0x66, 0x69,
-  0x6c, 0x6c, 0x52, 0x65, 0x63, 0x74, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c,
-  0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x57, 0x2c, 0x20, 0x45, 0x49, 0x4e,
-  0x4b, 0x5f, 0x48, 0x29, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
-  0x73, 0x74, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x4d,
-  0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69, 0x6e, 0x28, 0x45, 0x49, 0x4e, 0x4b,
-  0x5f, 0x57, 0x20, 0x2f, 0x20, 0x69, 0x6d, 0x67, 0x2e, 0x77, 0x69, 0x64,
-  0x74, 0x68, 0x2c, 0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x48, 0x20, 0x2f,
-  0x20, 0x69, 0x6d, 0x67, 0x2e, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2c,
-  0x20, 0x31, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
-  0x64, 0x77, 0x20, 0x3d, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x28, 0x69, 0x6d, 0x67, 0x2e, 0x77, 0x69, 0x64, 0x74,
-  0x68, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x29, 0x2c, 0x20,
-  0x64, 0x68, 0x20, 0x3d, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x28, 0x69, 0x6d, 0x67, 0x2e, 0x68, 0x65, 0x69, 0x67,
-  0x68, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x78, 0x20, 0x3d,
-  0x20, 0x28, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x57, 0x20, 0x2d, 0x20, 0x64,
-  0x77, 0x29, 0x20, 0x2f, 0x20, 0x32, 0x20, 0x7c, 0x20, 0x30, 0x2c, 0x20,
-  0x64, 0x79, 0x20, 0x3d, 0x20, 0x28, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x48,
-  0x20, 0x2d, 0x20, 0x64, 0x68, 0x29, 0x20, 0x2f, 0x20, 0x32, 0x20, 0x7c,
-  0x20, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x74, 0x78, 0x2e, 0x64, 0x72, 0x61,
-  0x77, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x28, 0x69, 0x6d, 0x67, 0x2c, 0x20,
-  0x64, 0x78, 0x2c, 0x20, 0x64, 0x79, 0x2c, 0x20, 0x64, 0x77, 0x2c, 0x20,
-  0x64, 0x68, 0x29, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
-  0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x63, 0x74, 0x78,
-  0x2e, 0x67, 0x65, 0x74, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74,
-  0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x45, 0x49, 0x4e, 0x4b,
-  0x5f, 0x57, 0x2c, 0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x48, 0x29, 0x2e,
-  0x64, 0x61, 0x74, 0x61, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28,
-  0x6c, 0x65, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69,
-  0x20, 0x3c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
-  0x74, 0x68, 0x3b, 0x20, 0x69, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x29, 0x20,
-  0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-  0x20, 0x61, 0x76, 0x67, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61,
-  0x5b, 0x69, 0x5d, 0x20, 0x2b, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x69,
-  0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, 0x2b, 0x20, 0x64, 0x61, 0x74, 0x61,
-  0x5b, 0x69, 0x20, 0x2b, 0x20, 0x32, 0x5d, 0x29, 0x20, 0x2f, 0x20, 0x33,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-  0x20, 0x76, 0x20, 0x3d, 0x20, 0x61, 0x76, 0x67, 0x20, 0x3c, 0x20, 0x31,
-  0x32, 0x38, 0x20, 0x3f, 0x20, 0x30, 0x20, 0x3a, 0x20, 0x32, 0x35, 0x35,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b,
-  0x69, 0x5d, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x69, 0x20,
-  0x2b, 0x20, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b,
-  0x69, 0x20, 0x2b, 0x20, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x63, 0x74, 0x78, 0x2e, 0x70, 0x75, 0x74, 0x49,
-  0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x28, 0x6e, 0x65, 0x77,
-  0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x28, 0x64,
-  0x61, 0x74, 0x61, 0x2c, 0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x57, 0x2c,
-  0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x48, 0x29, 0x2c, 0x20, 0x30, 0x2c,
-  0x20, 0x30, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x54, 0x6f, 0x42, 0x79, 0x74, 0x65,
-  0x73, 0x28, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x29, 0x20, 0x7b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x74, 0x78, 0x20, 0x3d,
-  0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x43,
-  0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x27, 0x32, 0x64, 0x27, 0x29,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6d, 0x67,
-  0x20, 0x3d, 0x20, 0x63, 0x74, 0x78, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x6d,
-  0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x57, 0x2c, 0x20, 0x45, 0x49,
-  0x4e, 0x4b, 0x5f, 0x48, 0x29, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
-  0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38,
-  0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x28, 0x45, 0x49, 0x4e, 0x4b, 0x5f,
-  0x57, 0x20, 0x2a, 0x20, 0x45, 0x49, 0x4e, 0x4b, 0x5f, 0x48, 0x29, 0x20,
-  0x2f, 0x20, 0x38, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x74, 0x20, 0x62,
-  0x79, 0x74, 0x65, 0x49, 0x64, 0x78, 0x20, 0x3d, 0x20, 0x30, 0x2c, 0x20,
-  0x62, 0x69, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x37, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x20,
-  0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x69, 0x6d, 0x67,
-  0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x69, 0x20, 0x2b,
-  0x3d, 0x20, 0x34, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x69, 0x6d, 0x67, 0x5b, 0x69, 0x5d, 0x20, 0x3d,
-  0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x5b,
-  0x62, 0x79, 0x74, 0x65, 0x49, 0x64, 0x78, 0x5d, 0x20, 0x7c, 0x3d, 0x20,
-  0x31, 0x20, 0x3c, 0x3c, 0x20, 0x62, 0x69, 0x74, 0x50, 0x6f, 0x73, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x69,
-  0x74, 0x50, 0x6f, 0x73, 0x2d, 0x2d, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x30,
-  0x29, 0x20, 0x7b, 0x20, 0x62, 0x69, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x3d,
-  0x20, 0x37, 0x3b, 0x20, 0x62, 0x79, 0x74, 0x65, 0x49, 0x64, 0x78, 0x2b,
-  0x2b, 0x3b, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6e, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x3b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64,
-  0x4c, 0x6f, 0x67, 0x6f, 0x28, 0x6d, 0x61, 0x63, 0x29, 0x20, 0x7b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61,
-  0x73, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42,
-  0x79, 0x49, 0x64, 0x28, 0x60, 0x6c, 0x6f, 0x67, 0x6f, 0x50, 0x72, 0x65,
-  0x76, 0x69, 0x65, 0x77, 0x5f, 0x24, 0x7b, 0x6d, 0x61, 0x63, 0x7d, 0x60,
-  0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x68, 0x65,
-  0x61, 0x64, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x54,
-  0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29,
-  0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x6d, 0x61, 0x63, 0x20,
-  0x2b, 0x20, 0x22, 0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20,
-  0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x42, 0x6c, 0x6f, 0x62, 0x28, 0x5b,
-  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x76,
-  0x61, 0x73, 0x54, 0x6f, 0x42, 0x79, 0x74, 0x65, 0x73, 0x28, 0x63, 0x61,
-  0x6e, 0x76, 0x61, 0x73, 0x29, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-  0x5d, 0x2c, 0x20, 0x7b, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x27,
-  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f,
-  0x6f, 0x63, 0x74, 0x65, 0x74, 0x2d, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
-  0x27, 0x20, 0x7d, 0x29, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
-  0x73, 0x74, 0x20, 0x78, 0x68, 0x72, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77,
-  0x20, 0x58, 0x4d, 0x4c, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75,
-  0x65, 0x73, 0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x68, 0x72, 0x2e,
-  0x6f, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20,
-  0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x78, 0x68, 0x72, 0x2e, 0x73,
-  0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x30,
-  0x30, 0x20, 0x3f, 0x20, 0x27, 0xe2, 0x9c, 0x85, 0x20, 0x4c, 0x6f, 0x67,
-  0x6f, 0x20, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x21, 0x27,
-  0x20, 0x3a, 0x20, 0x27, 0xe2, 0x9d, 0x8c, 0x20, 0x55, 0x70, 0x6c, 0x6f,
-  0x61, 0x64, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x27, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x68, 0x72, 0x2e,
-  0x6f, 0x70, 0x65, 0x6e, 0x28, 0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c,
-  0x20, 0x27, 0x2f, 0x73, 0x65, 0x6e, 0x64, 0x6c, 0x6f, 0x67, 0x6f, 0x27,
-  0x2c, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x68,
-  0x72, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x70, 0x61, 0x79, 0x6c, 0x6f,
-  0x61, 0x64, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
-  0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
-  0x49, 0x64, 0x28, 0x27, 0x6d, 0x61, 0x63, 0x46, 0x6f, 0x72, 0x6d, 0x27,
-  0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x73, 0x75, 0x62, 0x6d,
-  0x69, 0x74, 0x27, 0x2c, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x65,
-  0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x2e, 0x70, 0x72, 0x65,
-  0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28,
-  0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6d, 0x61,
-  0x63, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42,
-  0x79, 0x49, 0x64, 0x28, 0x27, 0x6d, 0x61, 0x63, 0x5f, 0x61, 0x64, 0x64,
-  0x72, 0x65, 0x73, 0x73, 0x27, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65,
-  0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x77,
-  0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2f,
-  0x61, 0x64, 0x64, 0x6d, 0x61, 0x63, 0x27, 0x2c, 0x20, 0x7b, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x20,
-  0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x64,
-  0x65, 0x72, 0x73, 0x3a, 0x20, 0x7b, 0x20, 0x27, 0x43, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3a, 0x20, 0x27,
-  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f,
-  0x6a, 0x73, 0x6f, 0x6e, 0x27, 0x20, 0x7d, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x3a, 0x20, 0x4a, 0x53, 0x4f, 0x4e,
-  0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x28, 0x7b,
-  0x20, 0x6d, 0x61, 0x63, 0x20, 0x7d, 0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x73, 0x2e, 0x6f, 0x6b,
-  0x29, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74,
-  0x28, 0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x2e, 0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29,
-  0x2c, 0x20, 0x31, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c,
-  0x73, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x65,
-  0x72, 0x72, 0x6f, 0x72, 0x28, 0x27, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64,
-  0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72,
-  0x20, 0x4d, 0x41, 0x43, 0x27, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x54, 0x65, 0x78,
-  0x74, 0x28, 0x65, 0x2c, 0x20, 0x6d, 0x61, 0x63, 0x29, 0x20, 0x7b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65,
-  0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x65, 0x2e, 0x74, 0x61,
-  0x72, 0x67, 0x65, 0x74, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68,
-  0x28, 0x27, 0x2f, 0x73, 0x65, 0x6e, 0x64, 0x74, 0x65, 0x78, 0x74, 0x27,
-  0x2c, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74,
-  0x68, 0x6f, 0x64, 0x3a, 0x20, 0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c,
-  0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3a, 0x20, 0x7b, 0x20,
-  0x27, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70,
-  0x65, 0x27, 0x3a, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x27, 0x20, 0x7d,
-  0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x3a,
-  0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
-  0x69, 0x66, 0x79, 0x28, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6d, 0x61, 0x63, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3a, 0x20, 0x66, 0x2e, 0x66, 0x69, 0x72, 0x73, 0x74,
-  0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x61,
-  0x73, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x66, 0x2e, 0x6c,
-  0x61, 0x73, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c,
-  0x75, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f,
-  0x69, 0x6e, 0x66, 0x6f, 0x3a, 0x20, 0x66, 0x2e, 0x61, 0x64, 0x64, 0x69,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x2e,
-  0x76, 0x61, 0x6c, 0x75, 0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x72,
-  0x20, 0x3d, 0x3e, 0x20, 0x72, 0x2e, 0x6f, 0x6b, 0x20, 0x3f, 0x20, 0x63,
-  0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x27,
-  0x53, 0x65, 0x6e, 0x74, 0x27, 0x29, 0x20, 0x3a, 0x20, 0x63, 0x6f, 0x6e,
-  0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x27,
-  0x46, 0x61, 0x69, 0x6c, 0x27, 0x29, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x4d, 0x61, 0x63, 0x28,
-  0x6d, 0x61, 0x63, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x21, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x60, 0x44, 0x65,
-  0x6c, 0x65, 0x74, 0x65, 0x20, 0x24, 0x7b, 0x6d, 0x61, 0x63, 0x7d, 0x20,
-  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x73,
-  0x74, 0x3f, 0x60, 0x29, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2f, 0x64,
-  0x65, 0x6c, 0x65, 0x74, 0x65, 0x6d, 0x61, 0x63, 0x27, 0x2c, 0x20, 0x7b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64,
-  0x3a, 0x20, 0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c, 0x20, 0x68, 0x65,
-  0x61, 0x64, 0x65, 0x72, 0x73, 0x3a, 0x20, 0x7b, 0x20, 0x27, 0x43, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3a,
-  0x20, 0x27, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x27, 0x20, 0x7d, 0x2c, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x3a, 0x20, 0x4a, 0x53,
-  0x4f, 0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79,
-  0x28, 0x7b, 0x20, 0x6d, 0x61, 0x63, 0x20, 0x7d, 0x29, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x72, 0x20, 0x3d, 0x3e, 0x20,
-  0x72, 0x2e, 0x6f, 0x6b, 0x20, 0x3f, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69,
-  0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20,
-  0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x72, 0x65, 0x6c,
-  0x6f, 0x61, 0x64, 0x28, 0x29, 0x2c, 0x20, 0x35, 0x30, 0x30, 0x29, 0x20,
-  0x3a, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x65, 0x72,
-  0x72, 0x6f, 0x72, 0x28, 0x27, 0x46, 0x61, 0x69, 0x6c, 0x27, 0x29, 0x29,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75,
-  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72,
-  0x42, 0x61, 0x64, 0x67, 0x65, 0x28, 0x6d, 0x61, 0x63, 0x29, 0x20, 0x7b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x63, 0x6f, 0x6e, 0x66, 0x69,
-  0x72, 0x6d, 0x28, 0x60, 0x43, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x73, 0x63,
-  0x72, 0x65, 0x65, 0x6e, 0x20, 0x6f, 0x6e, 0x20, 0x24, 0x7b, 0x6d, 0x61,
-  0x63, 0x7d, 0x3f, 0x60, 0x29, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2f,
-  0x63, 0x6c, 0x65, 0x61, 0x72, 0x62, 0x61, 0x64, 0x67, 0x65, 0x27, 0x2c,
-  0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x68,
-  0x6f, 0x64, 0x3a, 0x20, 0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c, 0x20,
-  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3a, 0x20, 0x7b, 0x20, 0x27,
-  0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65,
-  0x27, 0x3a, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x27, 0x20, 0x7d, 0x2c,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x3a, 0x20,
-  0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69,
-  0x66, 0x79, 0x28, 0x7b, 0x20, 0x6d, 0x61, 0x63, 0x20, 0x7d, 0x29, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x72, 0x20, 0x3d,
-  0x3e, 0x20, 0x72, 0x2e, 0x6f, 0x6b, 0x20, 0x3f, 0x20, 0x73, 0x65, 0x74,
-  0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x28, 0x29, 0x20, 0x3d,
-  0x3e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x72,
-  0x65, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29, 0x2c, 0x20, 0x35, 0x30, 0x30,
-  0x29, 0x20, 0x3a, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
-  0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x27, 0x46, 0x61, 0x69, 0x6c, 0x27,
-  0x29, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61,
-  0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
-  0x6e, 0x65, 0x72, 0x28, 0x27, 0x44, 0x4f, 0x4d, 0x43, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x4c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x27, 0x2c, 0x20,
-  0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53,
-  0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x27,
-  0x2e, 0x62, 0x61, 0x64, 0x67, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
-  0x27, 0x29, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6d, 0x61, 0x63,
-  0x20, 0x3d, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2e, 0x64, 0x61, 0x74,
-  0x61, 0x73, 0x65, 0x74, 0x2e, 0x6d, 0x61, 0x63, 0x3b, 0x0d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x42, 0x79, 0x49, 0x64, 0x28, 0x60, 0x6c, 0x6f, 0x67, 0x6f, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x5f, 0x24, 0x7b, 0x6d, 0x61, 0x63, 0x7d, 0x60, 0x29,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-  0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x6f,
-  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x60, 0x6c,
-  0x6f, 0x67, 0x6f, 0x50, 0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x24,
-  0x7b, 0x6d, 0x61, 0x63, 0x7d, 0x60, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x74, 0x6e, 0x20,
-  0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
-  0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
-  0x64, 0x28, 0x60, 0x73, 0x65, 0x6e, 0x64, 0x4c, 0x6f, 0x67, 0x6f, 0x42,
-  0x74, 0x6e, 0x5f, 0x24, 0x7b, 0x6d, 0x61, 0x63, 0x7d, 0x60, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x20, 0x7c, 0x7c, 0x20, 0x21, 0x63, 0x61, 0x6e,
-  0x76, 0x61, 0x73, 0x20, 0x7c, 0x7c, 0x20, 0x21, 0x62, 0x74, 0x6e, 0x29,
-  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x61, 0x64,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
-  0x65, 0x72, 0x28, 0x27, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x27, 0x2c,
-  0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x28, 0x29, 0x20, 0x3d, 0x3e,
-  0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72,
-  0x41, 0x6e, 0x64, 0x54, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x73,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x29,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x61, 0x6e, 0x76, 0x61, 0x73, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c,
-  0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x27, 0x73, 0x68, 0x6f,
-  0x77, 0x27, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x74, 0x6e, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c,
-  0x65, 0x64, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x74, 0x6e, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27,
-  0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x20, 0x28, 0x29, 0x20, 0x3d,
-  0x3e, 0x20, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x4c, 0x6f, 0x67, 0x6f,
-  0x28, 0x6d, 0x61, 0x63, 0x29, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b,
-  0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29,
-  0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x63, 0x72,
-  0x69, 0x70, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79,
-  0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e
+// Generated by html_gen.sh from webcontent.html/.css/.js, do not edit
+#define WEBCONTENT_HTML_ETAG "\"a46d45ad\""
+#define WEBCONTENT_CSS_URI "/app-c3ce5069.css"
+#define WEBCONTENT_JS_URI "/app-8212facc.js"
+
+const unsigned char webcontent_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x93,
+  0xc9, 0x8e, 0x9c, 0x30, 0x10, 0x86, 0xef, 0xfd, 0x14, 0x35, 0x3e, 0x25,
+  0x52, 0x68, 0xba, 0x7b, 0x92, 0x68, 0x42, 0x30, 0xd2, 0xf4, 0x76, 0x9c,
+  0x44, 0x51, 0x2e, 0x39, 0x45, 0xc6, 0x2e, 0xc0, 0x89, 0xb1, 0x91, 0x5d,
+  0xbd, 0xbd, 0x7d, 0xcc, 0x22, 0x35, 0xea, 0x5b, 0xb8, 0x00, 0xf5, 0x9b,
+  0xaf, 0xb6, 0x9f, 0xfc, 0x69, 0xff, 0x6d, 0xf7, 0xf3, 0xd7, 0xf7, 0x03,
+  0x34, 0xd4, 0x9a, 0x62, 0x91, 0xf7, 0x37, 0x30, 0xc2, 0xd6, 0x9c, 0xa1,
+  0x65, 0xc5, 0x22, 0x46, 0x50, 0xa8, 0x62, 0x01, 0xf1, 0xca, 0x5b, 0x24,
+  0x01, 0xb2, 0x11, 0x3e, 0x20, 0x71, 0x76, 0xa2, 0x2a, 0x79, 0x61, 0x90,
+  0xce, 0x45, 0x2b, 0x5a, 0xe4, 0xec, 0xac, 0xf1, 0xd2, 0x39, 0x4f, 0x0c,
+  0xa4, 0xb3, 0x84, 0x36, 0x1e, 0xbe, 0x68, 0x45, 0x0d, 0x57, 0x78, 0xd6,
+  0x12, 0x93, 0xe1, 0xe5, 0x03, 0x68, 0xab, 0x49, 0x0b, 0x93, 0x04, 0x29,
+  0x0c, 0xf2, 0xf5, 0x72, 0x75, 0x87, 0x91, 0x26, 0x83, 0xc5, 0x56, 0xa8,
+  0x1a, 0xe1, 0xa0, 0x34, 0x39, 0x9f, 0xa7, 0x63, 0x6c, 0xd4, 0x8d, 0xb6,
+  0x7f, 0xc1, 0xa3, 0xe1, 0x2c, 0xd0, 0xcd, 0x60, 0x68, 0x10, 0x63, 0xb6,
+  0xc6, 0x63, 0xc5, 0x59, 0x2a, 0xba, 0x2e, 0x91, 0xcf, 0x12, 0x3f, 0xad,
+  0x3e, 0x7f, 0x59, 0xca, 0x10, 0x06, 0x6c, 0x9e, 0x8e, 0x8d, 0x2c, 0xf2,
+  0xd2, 0xa9, 0xdb, 0x84, 0x51, 0xfa, 0x0c, 0xd2, 0x88, 0x10, 0x38, 0xeb,
+  0x2b, 0x15, 0xda, 0xa2, 0x67, 0xa3, 0x36, 0xe8, 0xcd, 0xfa, 0xa1, 0x86,
+  0x18, 0x58, 0xdc, 0xe5, 0xa7, 0x24, 0x81, 0xa3, 0x36, 0x06, 0x15, 0x54,
+  0xde, 0xb5, 0x10, 0x33, 0xeb, 0xb4, 0xec, 0x3f, 0x08, 0x50, 0xde, 0x80,
+  0x1a, 0x84, 0x20, 0xbd, 0xee, 0x08, 0x92, 0x64, 0x46, 0xed, 0xb3, 0x6a,
+  0xc5, 0xd9, 0x78, 0x92, 0x15, 0x79, 0x1a, 0x23, 0x73, 0x6e, 0xb3, 0x81,
+  0xa1, 0x2d, 0xce, 0x5a, 0xe1, 0x6b, 0x6d, 0x13, 0x72, 0x5d, 0x06, 0x1f,
+  0x57, 0xdd, 0xf5, 0x2b, 0x2b, 0x7e, 0x60, 0xad, 0x03, 0xa1, 0x87, 0x37,
+  0xbc, 0xc0, 0x50, 0x5d, 0x2c, 0x6b, 0x33, 0xc3, 0x57, 0xce, 0xb7, 0x03,
+  0xbf, 0x15, 0xf2, 0x18, 0x9f, 0x67, 0x0d, 0x0d, 0xba, 0xb6, 0xdd, 0x89,
+  0x80, 0x6e, 0x5d, 0xe4, 0x13, 0x5e, 0xe3, 0xdc, 0xa6, 0xc3, 0xbf, 0x85,
+  0x52, 0x1e, 0xfb, 0x79, 0x75, 0x46, 0x48, 0x6c, 0x9c, 0x51, 0xe8, 0x39,
+  0xeb, 0x79, 0x82, 0x32, 0x78, 0x7d, 0xcd, 0xb6, 0xdb, 0x6c, 0xb7, 0xcb,
+  0xf6, 0xfb, 0xec, 0x70, 0xc8, 0x8e, 0xc7, 0xff, 0x00, 0x1b, 0x2d, 0x1e,
+  0xb1, 0x6f, 0xd1, 0x2a, 0xf0, 0xce, 0x75, 0xa4, 0x9d, 0x15, 0xe6, 0x3d,
+  0x83, 0x56, 0x5c, 0x0d, 0xda, 0x3a, 0xda, 0x84, 0x3d, 0x6f, 0x1e, 0xd9,
+  0xe5, 0x89, 0xc8, 0xd9, 0x09, 0x1e, 0x4e, 0x65, 0xab, 0xe9, 0x3e, 0x8a,
+  0x3c, 0x1d, 0xe5, 0xd9, 0x10, 0xd2, 0xbe, 0xea, 0x69, 0xcb, 0xb3, 0xf1,
+  0xe6, 0xd3, 0x3e, 0x82, 0x97, 0x93, 0x51, 0x5e, 0x36, 0xeb, 0x4d, 0x25,
+  0xa4, 0x5c, 0xfe, 0x19, 0x36, 0x31, 0xea, 0xbd, 0x5d, 0x46, 0x9b, 0xf4,
+  0xbe, 0xe9, 0xff, 0x8c, 0x7f, 0xe1, 0x3f, 0xe7, 0xd6, 0x29, 0x03, 0x00,
+  0x00
 };
-unsigned int webcontent_html_len = 12216;
+const unsigned int webcontent_html_gz_len = 457;
+const unsigned char webcontent_css_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x58,
+  0xdb, 0x6e, 0xe3, 0x36, 0x10, 0x7d, 0xf7, 0x57, 0x08, 0x09, 0x5a, 0xc4,
+  0x81, 0xe5, 0xc8, 0xd7, 0x75, 0x1c, 0xf4, 0xc1, 0x8e, 0xd7, 0x45, 0x81,
+  0x16, 0x28, 0xf6, 0xa1, 0x2f, 0x8b, 0x7d, 0xa0, 0x24, 0x4a, 0x66, 0x57,
+  0x26, 0x05, 0x92, 0x8a, 0xed, 0x2e, 0x0a, 0xf4, 0x23, 0xfa, 0x85, 0xfd,
+  0x92, 0x0e, 0x2f, 0xba, 0xd9, 0x92, 0xe3, 0x74, 0x0b, 0xac, 0x13, 0x23,
+  0x88, 0x87, 0x9c, 0xe1, 0xcc, 0xf0, 0xcc, 0xe1, 0x90, 0x73, 0xce, 0x98,
+  0x74, 0xbe, 0x74, 0x1c, 0xf8, 0x79, 0xb8, 0x77, 0xfe, 0xf9, 0xfb, 0x2f,
+  0xf3, 0x71, 0x9e, 0x19, 0xc7, 0xce, 0xaf, 0x28, 0xc1, 0x52, 0xe2, 0x52,
+  0xfc, 0x6d, 0x3f, 0xce, 0xfd, 0x83, 0x76, 0xd4, 0x75, 0x53, 0x4e, 0xb6,
+  0x88, 0x1f, 0xe6, 0xce, 0xad, 0xe7, 0x4d, 0x67, 0x8b, 0xe1, 0x53, 0x5d,
+  0xee, 0x6e, 0xd8, 0x0b, 0xe6, 0x7a, 0x74, 0x32, 0x9e, 0x79, 0xf9, 0x28,
+  0x0a, 0x02, 0x4c, 0x25, 0x88, 0xd7, 0xb3, 0xe5, 0xca, 0x3b, 0x12, 0x17,
+  0x3a, 0xab, 0xc7, 0xc5, 0xa4, 0x1c, 0x0c, 0x11, 0x8d, 0x8d, 0x78, 0x3a,
+  0x9e, 0x8c, 0x27, 0x75, 0x71, 0xa1, 0xb3, 0x9c, 0x8e, 0x96, 0xa3, 0x65,
+  0x3e, 0x28, 0x32, 0xb0, 0x28, 0x04, 0xc8, 0x47, 0xe3, 0xd9, 0x7a, 0x34,
+  0x3d, 0x92, 0x17, 0x5a, 0xc3, 0xe7, 0x77, 0xab, 0xe1, 0xf3, 0x53, 0xc7,
+  0x0e, 0xfb, 0xb1, 0x9b, 0xa2, 0x18, 0xcf, 0x9d, 0x84, 0x50, 0x8c, 0xb8,
+  0x1b, 0x73, 0x14, 0x12, 0xf0, 0xec, 0x6e, 0x30, 0x9a, 0x84, 0x38, 0xee,
+  0x81, 0xb9, 0xd1, 0xe3, 0xe2, 0xf9, 0xb9, 0xa7, 0xe3, 0xf2, 0xde, 0x2d,
+  0xba, 0x4f, 0x85, 0x26, 0x58, 0x7b, 0xbf, 0x58, 0x8f, 0xd7, 0x15, 0x1f,
+  0x78, 0x84, 0x02, 0xac, 0x82, 0xd5, 0x3f, 0x47, 0x72, 0x17, 0x25, 0x2a,
+  0x11, 0xab, 0xc9, 0xfb, 0xc7, 0xf5, 0x63, 0xe1, 0x81, 0xc4, 0x7b, 0x59,
+  0xcd, 0xed, 0x6a, 0xb0, 0x1e, 0xae, 0x9e, 0xaa, 0x83, 0x02, 0x07, 0x8c,
+  0x86, 0x66, 0x78, 0x34, 0x9e, 0xcc, 0xa6, 0x2b, 0xab, 0x5c, 0x03, 0xcf,
+  0x2f, 0x58, 0x72, 0x12, 0x88, 0x6b, 0xc1, 0xcd, 0x39, 0x24, 0xa9, 0x1c,
+  0x67, 0xb0, 0x55, 0x83, 0x61, 0xba, 0xcf, 0x23, 0x8d, 0x51, 0x0a, 0x82,
+  0x69, 0x29, 0x48, 0x51, 0x18, 0x12, 0x0a, 0x49, 0x1e, 0x8e, 0x4b, 0xa1,
+  0xd8, 0xa0, 0x90, 0xed, 0x5c, 0x21, 0x39, 0x53, 0x43, 0x9e, 0x33, 0x4b,
+  0xf7, 0xce, 0xd0, 0x83, 0x3f, 0x3c, 0xf6, 0xd1, 0x9d, 0xd7, 0x73, 0xec,
+  0xa7, 0xef, 0xcd, 0xba, 0x47, 0x4a, 0x09, 0x89, 0x37, 0x52, 0xe9, 0x80,
+  0x3d, 0x67, 0xda, 0xa4, 0x32, 0x06, 0x95, 0x3f, 0x3b, 0x9d, 0x5a, 0x5a,
+  0x7f, 0x4c, 0x98, 0x8f, 0x12, 0xe7, 0x03, 0x16, 0x58, 0x3a, 0x57, 0x97,
+  0xcf, 0xfb, 0x5e, 0xe7, 0x7e, 0x3e, 0xf7, 0x71, 0x04, 0xcc, 0xa1, 0xff,
+  0x45, 0x91, 0xc4, 0xdc, 0x72, 0x8b, 0xcf, 0xf6, 0xae, 0x20, 0x7f, 0xe8,
+  0x24, 0xfa, 0x8c, 0x87, 0x50, 0x3b, 0x20, 0x32, 0x59, 0x01, 0xb4, 0xc5,
+  0x84, 0x42, 0x36, 0xcc, 0xd7, 0x22, 0xd9, 0xde, 0x69, 0x06, 0x96, 0x2c,
+  0x3c, 0x38, 0xdf, 0x03, 0x39, 0x51, 0x89, 0xa0, 0x48, 0xb8, 0xf3, 0x8d,
+  0x63, 0xf6, 0x95, 0x3f, 0x26, 0xc2, 0x90, 0x88, 0x34, 0x41, 0x50, 0x17,
+  0x51, 0x82, 0x6d, 0x60, 0xbf, 0x67, 0x42, 0x92, 0xe8, 0xe0, 0x42, 0xc9,
+  0x48, 0x4d, 0x3c, 0x8a, 0x67, 0x30, 0x37, 0x83, 0x08, 0x30, 0x40, 0x5d,
+  0x22, 0xf1, 0x56, 0x18, 0x1d, 0x40, 0x12, 0xe2, 0xd2, 0xa6, 0x84, 0x50,
+  0x77, 0x83, 0x0d, 0x48, 0x06, 0x9e, 0xf7, 0xb2, 0x39, 0x4a, 0xcd, 0x0b,
+  0xe2, 0x77, 0x1a, 0xa7, 0x16, 0x58, 0x11, 0xac, 0xe0, 0x46, 0x68, 0x4b,
+  0x12, 0x70, 0x60, 0xc1, 0x09, 0x4a, 0x7a, 0x8e, 0x40, 0x54, 0x40, 0xbd,
+  0x72, 0x12, 0x99, 0x39, 0x3e, 0x0a, 0x3e, 0xc7, 0x9c, 0x65, 0x34, 0xcc,
+  0xf5, 0x2d, 0xe1, 0x58, 0x1b, 0x01, 0x4b, 0x18, 0xcf, 0x87, 0xaa, 0x4c,
+  0x60, 0x90, 0xd8, 0x0f, 0x8a, 0xa4, 0x7f, 0x69, 0xb5, 0x67, 0x4d, 0xd9,
+  0x1d, 0xce, 0x6b, 0xcb, 0x8c, 0x9a, 0x6f, 0xc5, 0x8c, 0xbd, 0xad, 0x85,
+  0x7c, 0xb8, 0x56, 0x4e, 0xdd, 0xc6, 0x78, 0xed, 0x57, 0x3b, 0xb8, 0x23,
+  0xa1, 0xdc, 0xe8, 0xf4, 0x7c, 0x97, 0xe3, 0x68, 0xef, 0x5a, 0xe1, 0xcc,
+  0xf3, 0x54, 0xa1, 0x82, 0xdb, 0x9b, 0x81, 0x75, 0xd7, 0xa0, 0x0c, 0x50,
+  0x27, 0x25, 0xdb, 0xb6, 0x64, 0x70, 0x67, 0x53, 0x4e, 0x19, 0xdf, 0xa2,
+  0xc4, 0xe8, 0x0f, 0x6b, 0xfa, 0x55, 0x45, 0x28, 0xdf, 0x00, 0x25, 0xc1,
+  0x5d, 0x29, 0x79, 0x18, 0x76, 0x73, 0x14, 0xb7, 0xda, 0x1b, 0x35, 0xfb,
+  0x73, 0x6a, 0xa9, 0x6d, 0x57, 0x0a, 0x0a, 0x6e, 0x60, 0x88, 0x9f, 0x68,
+  0x9a, 0x49, 0x01, 0x15, 0xb2, 0x86, 0x15, 0xaf, 0x83, 0x7f, 0x55, 0x99,
+  0x10, 0xe5, 0xd6, 0x47, 0x79, 0x48, 0xf1, 0x0f, 0x37, 0x2a, 0x86, 0x9b,
+  0x4f, 0xbd, 0x9a, 0x2c, 0x22, 0x09, 0x56, 0x32, 0x81, 0x13, 0x1c, 0xc8,
+  0x5e, 0x47, 0xcd, 0x41, 0x1c, 0x23, 0x9b, 0xaa, 0x93, 0x9d, 0x2e, 0x70,
+  0x31, 0x4b, 0x6b, 0x1c, 0xf2, 0x6a, 0x36, 0x0d, 0x30, 0xc1, 0x14, 0x50,
+  0xae, 0x60, 0x09, 0x09, 0x9d, 0xdb, 0x20, 0x08, 0x1a, 0x41, 0x5b, 0x30,
+  0x7d, 0x15, 0xe7, 0xb7, 0x51, 0x14, 0xbd, 0x5e, 0x2d, 0xc5, 0xfe, 0x03,
+  0xe3, 0xc1, 0x09, 0x3c, 0x18, 0x5b, 0x2c, 0xd6, 0xa9, 0x0c, 0x85, 0x31,
+  0x76, 0x96, 0x09, 0x0b, 0x3e, 0x5f, 0x1f, 0x97, 0xf7, 0x7d, 0xe5, 0x9d,
+  0xeb, 0x6b, 0xef, 0xda, 0xca, 0xbd, 0xd2, 0x4a, 0x7c, 0x7d, 0xdd, 0xeb,
+  0x13, 0xf1, 0x92, 0xb2, 0x7f, 0xa5, 0x8e, 0x1b, 0x68, 0x58, 0x93, 0xeb,
+  0x8e, 0xab, 0x43, 0x5d, 0xfd, 0x35, 0x42, 0x7d, 0xc6, 0x1f, 0x2b, 0xb7,
+  0x72, 0xb2, 0xe2, 0xbf, 0x6a, 0x4a, 0x8a, 0x2a, 0x56, 0x93, 0x60, 0x87,
+  0xd5, 0xaf, 0x46, 0x67, 0x39, 0x11, 0x34, 0x65, 0x26, 0x5a, 0xa6, 0x55,
+  0x02, 0x91, 0x2c, 0x3d, 0xc5, 0xab, 0x7b, 0x59, 0xf9, 0x1f, 0x03, 0x6d,
+  0x64, 0x81, 0x66, 0x5d, 0x08, 0x71, 0x42, 0xa0, 0xd3, 0x3c, 0x7c, 0xad,
+  0x13, 0x17, 0x2c, 0x31, 0xc7, 0xdb, 0x54, 0x9e, 0x1c, 0x85, 0x94, 0x51,
+  0xdc, 0x34, 0xfb, 0x63, 0x88, 0x24, 0xd2, 0x19, 0x82, 0xe2, 0x0f, 0x61,
+  0x92, 0x2a, 0xfe, 0x73, 0x73, 0x38, 0xa6, 0x00, 0x2c, 0x1c, 0xde, 0x7c,
+  0xb2, 0x4b, 0xd4, 0xf2, 0x62, 0xfb, 0xea, 0xee, 0xab, 0x4b, 0x45, 0x08,
+  0x88, 0xa6, 0xc5, 0x88, 0xe9, 0xe8, 0xbb, 0xa7, 0x7b, 0x0d, 0xfd, 0xcc,
+  0xb6, 0x29, 0x83, 0x39, 0x3f, 0xb4, 0x21, 0x2e, 0x24, 0x1c, 0xc8, 0x8c,
+  0x30, 0x38, 0x33, 0x60, 0xa1, 0x6c, 0x4b, 0x2b, 0xc0, 0x6b, 0xe2, 0xa7,
+  0x63, 0x82, 0xf8, 0x99, 0xc5, 0xec, 0x1a, 0xf9, 0x21, 0xa7, 0x88, 0x04,
+  0xfc, 0xab, 0x31, 0x44, 0x99, 0x9d, 0x61, 0x99, 0x9d, 0xff, 0x87, 0x36,
+  0xce, 0x32, 0x82, 0x2e, 0x0b, 0x5d, 0xba, 0x65, 0x87, 0xa5, 0x36, 0xb1,
+  0xe2, 0xe0, 0x5b, 0x4e, 0xdd, 0x23, 0xd5, 0x00, 0xd1, 0x17, 0x24, 0x9a,
+  0x91, 0xdd, 0x78, 0x38, 0xe5, 0x7d, 0x1b, 0xca, 0x24, 0xbb, 0x98, 0x16,
+  0xcf, 0xf5, 0x52, 0xe7, 0x3b, 0xa5, 0x5e, 0x3b, 0x8f, 0xfe, 0xd7, 0x60,
+  0xfb, 0x62, 0xc3, 0x76, 0xc7, 0x11, 0xeb, 0x09, 0xa7, 0x28, 0xfd, 0x80,
+  0x63, 0x22, 0x54, 0x9f, 0xaf, 0x3a, 0x8e, 0x6b, 0x7a, 0x28, 0xb8, 0xdd,
+  0xa2, 0x60, 0x5d, 0x96, 0x6e, 0x43, 0x95, 0xb6, 0x56, 0x62, 0xeb, 0xa1,
+  0x51, 0x65, 0xcb, 0xea, 0xd9, 0x01, 0x49, 0x29, 0x96, 0xd3, 0x7d, 0x4d,
+  0x5b, 0x45, 0x9c, 0x34, 0x01, 0x19, 0x6c, 0x0d, 0xbd, 0xf2, 0x8b, 0xb2,
+  0xaf, 0x9d, 0xb4, 0x21, 0xa1, 0x34, 0xc5, 0x88, 0x23, 0xaa, 0x9e, 0x16,
+  0xca, 0x22, 0x38, 0xc5, 0x6f, 0xbd, 0x1b, 0xb2, 0x4c, 0x5b, 0xb6, 0x4f,
+  0x79, 0x23, 0x56, 0x31, 0x71, 0x39, 0x09, 0x0c, 0xd4, 0x25, 0xbb, 0xbc,
+  0x9f, 0x9f, 0xb4, 0x5a, 0x27, 0xfd, 0xf7, 0x34, 0x7f, 0xcf, 0xd1, 0x54,
+  0x21, 0xc1, 0x7d, 0xa1, 0x58, 0x7d, 0xee, 0x64, 0x10, 0x0d, 0x0f, 0x90,
+  0xb0, 0x3e, 0xe8, 0xd7, 0x2e, 0xee, 0x8a, 0x14, 0x05, 0xe6, 0x06, 0xda,
+  0x9f, 0x14, 0x3c, 0x76, 0xd1, 0x85, 0x25, 0xc8, 0xb8, 0x50, 0x81, 0xa6,
+  0x8c, 0x94, 0x37, 0x3d, 0xbd, 0x1e, 0x31, 0x27, 0x41, 0x99, 0x28, 0x30,
+  0x3e, 0x98, 0x08, 0x07, 0xc3, 0xe2, 0x2e, 0x60, 0x8a, 0x65, 0xa6, 0xcd,
+  0x30, 0xc9, 0x9e, 0x9b, 0x27, 0x22, 0xca, 0xe4, 0xdd, 0x1c, 0x90, 0x8b,
+  0x7c, 0x38, 0xb6, 0xba, 0xad, 0x8d, 0x58, 0xed, 0xd5, 0xab, 0x5b, 0x35,
+  0x93, 0xeb, 0x5a, 0x55, 0xa6, 0x02, 0x93, 0x07, 0x1d, 0x58, 0xdd, 0x61,
+  0x58, 0x09, 0x28, 0x34, 0x61, 0x3b, 0x1c, 0xe6, 0x28, 0xfd, 0x0d, 0xc1,
+  0x3d, 0x92, 0xc2, 0x6d, 0xa2, 0x80, 0x40, 0x3f, 0x48, 0x60, 0xef, 0x5b,
+  0xdd, 0x30, 0xef, 0x68, 0xd5, 0xf5, 0x8d, 0xc2, 0xdb, 0x82, 0xa9, 0xbe,
+  0xc6, 0xd5, 0x6c, 0xc1, 0x89, 0x8e, 0x25, 0x6e, 0xd5, 0xab, 0x9e, 0xdf,
+  0x35, 0x8d, 0xb7, 0x2d, 0x5f, 0x7d, 0xd8, 0xab, 0x19, 0x13, 0xd0, 0x82,
+  0xb8, 0x86, 0x2a, 0x25, 0x3d, 0xd3, 0x13, 0x57, 0x5a, 0x91, 0x26, 0xcd,
+  0xb7, 0x79, 0x53, 0x7b, 0x31, 0xd4, 0x46, 0xff, 0x05, 0xa7, 0xc6, 0x4e,
+  0x80, 0xb1, 0x15, 0x00, 0x00
+};
+const unsigned int webcontent_css_gz_len = 1313;
+const unsigned char webcontent_js_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x59,
+  0xdd, 0x6e, 0xdb, 0xc8, 0x15, 0xbe, 0xf7, 0x53, 0xcc, 0x06, 0xe9, 0x92,
+  0xdc, 0xc8, 0x94, 0xed, 0xed, 0xa2, 0x81, 0x14, 0x6f, 0x10, 0x27, 0x31,
+  0xe2, 0x36, 0x3f, 0x8b, 0xd8, 0xe9, 0x16, 0x70, 0x8d, 0x78, 0x48, 0x8e,
+  0x24, 0x26, 0xd4, 0x90, 0x3b, 0x1c, 0x59, 0x16, 0x1c, 0x01, 0x7d, 0x80,
+  0xde, 0xf5, 0xa2, 0x40, 0xd1, 0x02, 0xbd, 0xea, 0x2b, 0xf4, 0xbe, 0x8f,
+  0x92, 0x27, 0xe9, 0x77, 0x66, 0x86, 0x14, 0x47, 0x92, 0xb3, 0xd9, 0x45,
+  0xd1, 0xa2, 0x01, 0x76, 0x23, 0xce, 0x9c, 0xf3, 0x9d, 0x33, 0x67, 0xce,
+  0x9c, 0xbf, 0xa4, 0xa5, 0xac, 0x35, 0x7b, 0x7a, 0xf2, 0xf2, 0x37, 0x6f,
+  0xbf, 0x67, 0x87, 0xec, 0xfe, 0xde, 0x5e, 0xcf, 0x7e, 0x3d, 0xc3, 0xd7,
+  0x2f, 0xef, 0xef, 0x0d, 0x77, 0x76, 0x78, 0xbd, 0x90, 0x29, 0x1b, 0xcd,
+  0x64, 0xaa, 0xf3, 0x52, 0x32, 0x25, 0x64, 0x26, 0xd4, 0x23, 0x99, 0x9d,
+  0x4d, 0x94, 0xa8, 0x27, 0x65, 0x91, 0x85, 0xa3, 0xbc, 0x10, 0x3d, 0x96,
+  0x72, 0x79, 0xc5, 0xeb, 0x88, 0xdd, 0xec, 0x30, 0xfc, 0x49, 0x0d, 0x70,
+  0x3e, 0x1d, 0x03, 0x47, 0x8a, 0x39, 0x3b, 0x99, 0xf2, 0xb1, 0x08, 0xa3,
+  0xa1, 0xd9, 0xc4, 0x72, 0x5c, 0xab, 0x14, 0x5b, 0x6f, 0x5e, 0x3f, 0x8f,
+  0x53, 0x25, 0xb8, 0x16, 0xaf, 0x92, 0x77, 0x22, 0xd5, 0xf8, 0x36, 0x70,
+  0x8e, 0x90, 0xcf, 0x79, 0x6e, 0x50, 0xe2, 0x4c, 0xa4, 0x65, 0x66, 0x00,
+  0x3a, 0xf0, 0xa9, 0xbe, 0x06, 0x86, 0x15, 0x1c, 0x8f, 0x85, 0x7e, 0x5c,
+  0x4a, 0x2d, 0xae, 0x75, 0x18, 0x1c, 0x64, 0x81, 0x43, 0x00, 0x49, 0x0c,
+  0xc0, 0xe2, 0x54, 0x2f, 0x0a, 0x01, 0xe2, 0x60, 0x3e, 0xc9, 0xb5, 0x08,
+  0xfc, 0xcd, 0xd7, 0x90, 0x1c, 0xe2, 0xe4, 0xcd, 0xe1, 0xbf, 0x6f, 0x8c,
+  0xe0, 0x8b, 0xab, 0x53, 0x6e, 0x30, 0x5e, 0x70, 0x3d, 0x89, 0xa7, 0xb9,
+  0x0c, 0x9d, 0xdd, 0xfa, 0x46, 0xc3, 0x79, 0x9e, 0xe9, 0x49, 0x6b, 0x3d,
+  0xbb, 0x36, 0x11, 0xf9, 0x78, 0xa2, 0x7b, 0x6c, 0xbf, 0xd1, 0xc6, 0xe0,
+  0x64, 0xf3, 0x06, 0x44, 0x95, 0x33, 0x99, 0x85, 0x2d, 0x37, 0xfb, 0xca,
+  0xca, 0x88, 0x7a, 0x2c, 0x9b, 0x6c, 0xd2, 0x58, 0xb4, 0x96, 0xc8, 0x83,
+  0x24, 0x43, 0x34, 0xfa, 0xec, 0x42, 0x42, 0x04, 0x0d, 0x0e, 0xd8, 0x07,
+  0x3a, 0x52, 0xb6, 0x68, 0xf7, 0x9e, 0xd1, 0xde, 0xa4, 0xdd, 0x5b, 0x59,
+  0x21, 0x53, 0x7c, 0x6e, 0xaf, 0x08, 0x82, 0xc0, 0x72, 0x4d, 0x6c, 0xf8,
+  0x6f, 0x4e, 0x9a, 0xf8, 0x56, 0xc8, 0xb8, 0xe6, 0x64, 0x75, 0x70, 0xc1,
+  0xe4, 0x86, 0xe9, 0x09, 0x96, 0xb6, 0xdb, 0x2f, 0x26, 0x6a, 0x2b, 0x66,
+  0x54, 0x2a, 0x16, 0x16, 0x02, 0xd7, 0x09, 0xee, 0xbd, 0x21, 0xfe, 0x7a,
+  0x60, 0xb0, 0xe2, 0x42, 0xc8, 0xb1, 0x9e, 0xd0, 0xc2, 0x3d, 0xf8, 0x5c,
+  0xe3, 0x40, 0x2b, 0x81, 0xfc, 0x8a, 0x9c, 0x28, 0x24, 0xda, 0xf3, 0xfc,
+  0x82, 0xdd, 0x63, 0xf6, 0x17, 0x7e, 0xec, 0x7b, 0x5f, 0x07, 0x17, 0x74,
+  0xb0, 0xaf, 0x87, 0x6b, 0xec, 0x57, 0x60, 0x26, 0x88, 0x07, 0x6c, 0xff,
+  0xe0, 0x3e, 0x7b, 0xc8, 0xf6, 0xd8, 0x80, 0x1d, 0x7c, 0xf3, 0xcd, 0x8a,
+  0xac, 0x01, 0x3e, 0xf4, 0x80, 0x0f, 0xbb, 0xc0, 0xf8, 0xba, 0xb2, 0x0c,
+  0xcb, 0xd6, 0x64, 0xd5, 0xac, 0x73, 0xf8, 0xd6, 0xc5, 0xcd, 0x17, 0x71,
+  0x6e, 0x98, 0xc2, 0x98, 0x67, 0x0f, 0xb6, 0x5c, 0xee, 0xec, 0xb4, 0xaf,
+  0xc9, 0xfa, 0xee, 0x59, 0x79, 0xb4, 0xd0, 0xa2, 0x0e, 0xb7, 0x3d, 0xa1,
+  0xcf, 0xf1, 0xf1, 0xce, 0x5b, 0xfb, 0xc9, 0xd7, 0x62, 0x99, 0x13, 0x92,
+  0xef, 0x9e, 0xea, 0x9b, 0x5c, 0xea, 0xfb, 0x8f, 0x94, 0xe2, 0x8b, 0xb0,
+  0xf1, 0xa8, 0xaf, 0x1a, 0x46, 0x18, 0xf8, 0xbe, 0x93, 0x4a, 0x57, 0x49,
+  0x6c, 0x27, 0xc6, 0xf7, 0x20, 0x23, 0xc9, 0xf5, 0x77, 0x25, 0x81, 0xfc,
+  0xea, 0xf6, 0x0b, 0x27, 0x37, 0xbe, 0xfd, 0xbe, 0xf3, 0x11, 0x23, 0xff,
+  0x33, 0x97, 0x71, 0x08, 0x9e, 0xc8, 0xea, 0x75, 0xee, 0xc4, 0x5c, 0xb0,
+  0x0f, 0x87, 0x6c, 0x9f, 0x3d, 0x78, 0xe0, 0x44, 0x0d, 0x3d, 0x46, 0xbb,
+  0xb6, 0xbb, 0xdb, 0xb0, 0xde, 0x74, 0x15, 0x6a, 0x34, 0xbd, 0x77, 0x6f,
+  0xe8, 0xae, 0xd0, 0xfe, 0x5f, 0x09, 0x3d, 0x53, 0xd2, 0x8a, 0xf1, 0x6f,
+  0x66, 0x56, 0x15, 0x25, 0xcf, 0x9e, 0x97, 0xe3, 0x32, 0x9c, 0xf2, 0x74,
+  0xed, 0x4e, 0xcc, 0x6d, 0x90, 0x8b, 0x94, 0xe9, 0x6c, 0x2a, 0xa4, 0x26,
+  0x93, 0x3f, 0x2d, 0x04, 0xfd, 0x3c, 0x5a, 0x9c, 0x64, 0xe1, 0x65, 0x01,
+  0xbe, 0xef, 0x94, 0xb8, 0xca, 0xc5, 0xfc, 0xed, 0xdd, 0x1b, 0x00, 0x2c,
+  0x2f, 0xbd, 0xcb, 0x9a, 0x08, 0x8e, 0x28, 0xea, 0x0c, 0x7e, 0x86, 0xfb,
+  0x7c, 0x2a, 0x29, 0xbe, 0xa9, 0x30, 0x8a, 0x85, 0xf9, 0x45, 0x42, 0xe1,
+  0x7a, 0x77, 0x7e, 0x2f, 0xef, 0x78, 0x8c, 0x15, 0x5f, 0x90, 0x5e, 0x8e,
+  0xf3, 0xa8, 0x28, 0x93, 0xf0, 0xdc, 0x82, 0xf5, 0xb6, 0x3b, 0x53, 0x9c,
+  0xcc, 0x46, 0x23, 0xa1, 0x2e, 0x7a, 0x30, 0x88, 0x5e, 0x54, 0x62, 0xc0,
+  0x02, 0x5e, 0x55, 0x45, 0x9e, 0x72, 0x3a, 0x66, 0xbf, 0x4c, 0xb5, 0xd0,
+  0xbb, 0xb5, 0x46, 0x0c, 0x9e, 0x06, 0x6c, 0xd9, 0x3c, 0xf5, 0x7e, 0x9f,
+  0xbd, 0x92, 0xc5, 0x82, 0xe9, 0x89, 0x70, 0x96, 0x60, 0x79, 0x0d, 0x6b,
+  0x55, 0xa5, 0xd2, 0x22, 0x83, 0xfa, 0x4a, 0x0c, 0xcd, 0x66, 0x26, 0x8a,
+  0xfc, 0x4a, 0xa8, 0x05, 0xcb, 0x75, 0x2d, 0x8a, 0x11, 0xe3, 0x4a, 0xe1,
+  0xbb, 0x66, 0xb0, 0x60, 0x7f, 0x5e, 0x77, 0x14, 0xbf, 0x9e, 0x34, 0xc7,
+  0xfd, 0xdd, 0x8b, 0xe7, 0xcf, 0xb4, 0xae, 0x5e, 0x8b, 0x1f, 0x66, 0xa2,
+  0xd6, 0x4d, 0x4e, 0xc0, 0x7e, 0x6c, 0x25, 0xc5, 0xa5, 0xac, 0x54, 0x39,
+  0x46, 0x76, 0x21, 0x13, 0x23, 0xe0, 0x7e, 0xcb, 0x90, 0x67, 0xe6, 0x4f,
+  0x9c, 0x24, 0xb2, 0x0c, 0x1d, 0xe6, 0x7d, 0x2e, 0x33, 0x1c, 0x26, 0x27,
+  0x4f, 0x0f, 0x7a, 0xac, 0xd6, 0x48, 0x22, 0xf8, 0xb6, 0x18, 0xb9, 0x1c,
+  0x63, 0x2d, 0x2b, 0x25, 0x96, 0x44, 0x4c, 0x2b, 0x22, 0xeb, 0x31, 0x5d,
+  0x6a, 0x5e, 0xd0, 0x82, 0xf9, 0x61, 0x4e, 0xdb, 0x88, 0x2e, 0xa5, 0x21,
+  0x92, 0x64, 0xd9, 0x30, 0x22, 0x99, 0xbe, 0x5b, 0x12, 0x0d, 0x89, 0x98,
+  0xd5, 0xc6, 0xbf, 0x0e, 0xf6, 0xe0, 0x61, 0xc4, 0x71, 0xc4, 0xb3, 0x31,
+  0x8c, 0x1d, 0xad, 0x7c, 0x51, 0x14, 0xb5, 0x60, 0x88, 0xcf, 0x0a, 0x6f,
+  0xf4, 0xe3, 0xdf, 0xfe, 0xc8, 0xde, 0x58, 0xf3, 0x8d, 0x38, 0xd2, 0x5a,
+  0xfb, 0x64, 0x97, 0xce, 0xce, 0x46, 0x74, 0x25, 0x64, 0x18, 0x7c, 0xf7,
+  0xea, 0xf4, 0x0c, 0x2a, 0x07, 0xfd, 0x1a, 0x4a, 0x90, 0xfb, 0xe0, 0x43,
+  0xab, 0x99, 0xe8, 0xe8, 0x48, 0x3b, 0xa1, 0x73, 0x80, 0xb5, 0x38, 0x22,
+  0x8a, 0x50, 0x73, 0x04, 0x6e, 0x18, 0xae, 0x22, 0xab, 0xdd, 0x2c, 0x7b,
+  0x2c, 0x8e, 0xe3, 0x74, 0x92, 0x17, 0x19, 0x32, 0xb6, 0xef, 0xbe, 0x12,
+  0xfe, 0x05, 0x1a, 0x9b, 0x71, 0x63, 0x5e, 0xd7, 0xf9, 0x58, 0x86, 0xad,
+  0x2b, 0xdb, 0x74, 0xec, 0xbc, 0x99, 0x50, 0x23, 0x07, 0xeb, 0x34, 0x21,
+  0xee, 0x18, 0x2e, 0x44, 0xca, 0x74, 0x45, 0x0c, 0xbb, 0x0f, 0x8a, 0x88,
+  0x7c, 0x0d, 0x33, 0x51, 0xa7, 0x2a, 0x4f, 0xc4, 0xa9, 0x31, 0x62, 0x98,
+  0xf8, 0x2a, 0x55, 0x5c, 0x69, 0xd2, 0xfb, 0x3c, 0x89, 0x0b, 0x5e, 0xeb,
+  0xb7, 0xb5, 0x10, 0xd2, 0x18, 0x5a, 0xce, 0x8a, 0x02, 0x41, 0x3b, 0x78,
+  0x59, 0x9a, 0x47, 0xa3, 0x60, 0x48, 0x55, 0x4e, 0xd9, 0x42, 0xe8, 0x00,
+  0x71, 0xfc, 0xf2, 0x39, 0xa7, 0xbc, 0x4c, 0xc4, 0x77, 0x6f, 0x3a, 0xac,
+  0x4b, 0x56, 0x33, 0x3e, 0x2e, 0x2f, 0x2f, 0x5c, 0xbd, 0x41, 0xe1, 0x21,
+  0x56, 0x38, 0x28, 0xfb, 0xc2, 0x61, 0x46, 0x56, 0x24, 0xa2, 0x78, 0x3d,
+  0x09, 0x2f, 0x89, 0x99, 0xb6, 0x97, 0x2c, 0x3b, 0x9a, 0x36, 0x2f, 0xd5,
+  0x72, 0x25, 0x5c, 0x6b, 0xf2, 0xef, 0xdb, 0x18, 0x3b, 0x24, 0x7d, 0xb6,
+  0xbf, 0x07, 0xbf, 0x80, 0x77, 0x1d, 0xe7, 0xd7, 0x22, 0x0b, 0x0f, 0xa2,
+  0x25, 0xfb, 0xad, 0x8f, 0x96, 0x52, 0xf4, 0x96, 0xda, 0x07, 0x39, 0x85,
+  0x77, 0xc3, 0x61, 0x07, 0xe6, 0x0c, 0x8e, 0x62, 0x2d, 0x5e, 0x68, 0xd8,
+  0x26, 0x89, 0xb5, 0xa0, 0x5b, 0xd1, 0x6a, 0xb1, 0x82, 0xd4, 0xdd, 0xf8,
+  0xd9, 0x05, 0x3d, 0xce, 0xd5, 0x74, 0xce, 0x95, 0x00, 0xa8, 0x46, 0x91,
+  0x63, 0x3f, 0x5a, 0xd4, 0x96, 0x3d, 0xb6, 0xf5, 0x5c, 0xed, 0x6b, 0x44,
+  0x86, 0xc4, 0x55, 0x8e, 0xa8, 0xc2, 0x03, 0x00, 0xc8, 0x8c, 0x69, 0x2d,
+  0xed, 0xdb, 0x69, 0xbd, 0x71, 0xd4, 0x7d, 0x1c, 0xb5, 0xde, 0x04, 0xcf,
+  0xe0, 0x37, 0x95, 0xc8, 0x7c, 0xf0, 0x8f, 0x7f, 0xf9, 0xbb, 0x51, 0xca,
+  0x6d, 0x2e, 0x71, 0xa3, 0x7c, 0x8a, 0x90, 0x51, 0x94, 0x10, 0x0a, 0x4f,
+  0xa1, 0xb0, 0x92, 0xd0, 0xb3, 0x6a, 0xf0, 0xbc, 0x50, 0x6d, 0x91, 0xde,
+  0x95, 0x28, 0xbf, 0x02, 0xf6, 0xaf, 0x7f, 0xb2, 0x20, 0xda, 0xee, 0x67,
+  0x6d, 0xb8, 0xc8, 0x1a, 0x0b, 0x91, 0x4a, 0x5f, 0xe0, 0xcb, 0x01, 0x05,
+  0x41, 0xd7, 0xc0, 0xf3, 0x09, 0x27, 0x1b, 0x67, 0x31, 0x85, 0x15, 0xe3,
+  0x79, 0x2e, 0xb2, 0x90, 0xf3, 0x9d, 0xd8, 0x5f, 0x88, 0x2e, 0x6f, 0x2a,
+  0x64, 0x4e, 0xe1, 0x71, 0x56, 0xa9, 0x65, 0xb4, 0x31, 0xe5, 0x5b, 0x24,
+  0xa8, 0x87, 0xec, 0x12, 0x07, 0x34, 0xc5, 0xdb, 0xa8, 0x28, 0x4b, 0x15,
+  0x66, 0x31, 0x45, 0x22, 0x64, 0x51, 0x18, 0x0d, 0xa6, 0x73, 0xb4, 0xd1,
+  0xf2, 0x17, 0x97, 0x84, 0xe9, 0xa1, 0x41, 0x39, 0x95, 0x9b, 0x54, 0x9c,
+  0xc5, 0xcd, 0x6f, 0xc2, 0xc3, 0x49, 0xef, 0xde, 0xb4, 0x4b, 0xcb, 0xee,
+  0x87, 0xd1, 0x96, 0xa4, 0x06, 0xb4, 0xb0, 0x30, 0x7a, 0xba, 0xad, 0x60,
+  0xd9, 0x95, 0x50, 0xcf, 0x73, 0x9d, 0x4e, 0x50, 0x49, 0x99, 0x48, 0x26,
+  0xbc, 0x4a, 0x8b, 0x23, 0x68, 0x75, 0x62, 0xe7, 0xa0, 0xb1, 0x12, 0x3c,
+  0x9c, 0x4c, 0xb3, 0x64, 0xed, 0xde, 0xdd, 0x1b, 0x9c, 0x78, 0x79, 0x39,
+  0x5c, 0xe3, 0x45, 0x30, 0x9f, 0x21, 0xbe, 0x6d, 0x32, 0xda, 0x8d, 0x0d,
+  0xfa, 0x89, 0x28, 0xb6, 0x51, 0x53, 0xc1, 0x0f, 0x21, 0xa6, 0x78, 0x68,
+  0x1d, 0x01, 0x81, 0x1b, 0x1b, 0xef, 0x29, 0x15, 0x6d, 0xe0, 0x50, 0x50,
+  0xdc, 0xae, 0xb1, 0xdb, 0xb1, 0xfa, 0xde, 0xbd, 0x69, 0x4c, 0xb7, 0x81,
+  0x60, 0xad, 0xb6, 0xc9, 0x6f, 0xd6, 0x0d, 0xc0, 0xad, 0xac, 0x74, 0xad,
+  0x5b, 0x38, 0x5d, 0x52, 0x44, 0xa2, 0xfc, 0xf8, 0xd7, 0x3f, 0x7d, 0x82,
+  0xdd, 0xe5, 0x84, 0x4d, 0x00, 0xbb, 0x01, 0xee, 0x3f, 0x7f, 0x52, 0x6f,
+  0x7a, 0x8d, 0xdb, 0xcf, 0xde, 0x6a, 0xd0, 0x73, 0x16, 0x34, 0xd9, 0xdb,
+  0xbc, 0x67, 0x30, 0x7c, 0xfc, 0xc3, 0x3f, 0x7e, 0x14, 0x77, 0xab, 0x5e,
+  0x94, 0x87, 0xa5, 0xf7, 0x46, 0xe9, 0x84, 0x2c, 0x44, 0x88, 0xc8, 0xe2,
+  0x1f, 0x89, 0x0e, 0xd1, 0x86, 0x48, 0xef, 0x5d, 0x93, 0x93, 0x76, 0xdf,
+  0xf1, 0x66, 0xca, 0xcf, 0xfc, 0x94, 0x91, 0x14, 0x65, 0xfa, 0xbe, 0x5b,
+  0x83, 0xc1, 0xd1, 0xd4, 0xe2, 0x14, 0x21, 0x32, 0xd5, 0x78, 0x73, 0x97,
+  0xb1, 0xd1, 0x6f, 0xd7, 0x90, 0x9d, 0x53, 0xbd, 0xbb, 0x0b, 0x94, 0xc3,
+  0x3b, 0xb6, 0x1a, 0xbb, 0x73, 0xd1, 0x8d, 0xcb, 0x5f, 0x18, 0xa2, 0x26,
+  0x32, 0x74, 0x9f, 0x63, 0x91, 0x4b, 0x4a, 0x95, 0x66, 0x7f, 0x4d, 0x40,
+  0xe0, 0x04, 0x34, 0x15, 0x50, 0x93, 0xda, 0x89, 0x25, 0xa6, 0x12, 0xfd,
+  0xb1, 0x8d, 0xe4, 0xa4, 0xe2, 0x66, 0x4c, 0xea, 0xd0, 0x92, 0x6e, 0xb5,
+  0xd0, 0xf6, 0x51, 0x12, 0x35, 0x9e, 0xb2, 0x7b, 0xa2, 0xee, 0xf1, 0x76,
+  0xed, 0x62, 0x84, 0x1e, 0x91, 0x3e, 0xeb, 0x39, 0x94, 0x2a, 0x46, 0xca,
+  0x12, 0xf8, 0xbb, 0x7b, 0x04, 0xbc, 0xa4, 0x29, 0xd5, 0x51, 0x45, 0x18,
+  0xd0, 0xcf, 0x80, 0x6a, 0x27, 0x6c, 0xcc, 0x92, 0x69, 0xae, 0x07, 0xae,
+  0xbc, 0xc2, 0xcd, 0x51, 0x11, 0x1a, 0xa2, 0x8d, 0x37, 0xc5, 0xee, 0xb2,
+  0xd7, 0x29, 0x67, 0xc2, 0x20, 0x97, 0x68, 0x76, 0x82, 0x4e, 0x05, 0x49,
+  0xc7, 0xc3, 0xb7, 0x44, 0xdc, 0xc6, 0x17, 0xb2, 0x0b, 0x92, 0x03, 0x7d,
+  0x60, 0xad, 0x2a, 0x78, 0x2a, 0x68, 0x2c, 0x20, 0x14, 0xb6, 0x8e, 0x69,
+  0x8b, 0xbd, 0xa4, 0x2d, 0x94, 0x5b, 0x3f, 0x09, 0xd5, 0x64, 0x9c, 0xad,
+  0xa0, 0x26, 0xe9, 0xff, 0x2c, 0x4c, 0x9e, 0x65, 0x39, 0x59, 0x91, 0x17,
+  0x6f, 0x73, 0x39, 0x2a, 0x37, 0x90, 0x1f, 0xb5, 0xfb, 0xec, 0x84, 0xf6,
+  0x37, 0xf0, 0xb3, 0xfc, 0xca, 0xa0, 0xd7, 0x34, 0x4e, 0x00, 0x43, 0x96,
+  0xd7, 0x40, 0x58, 0x0c, 0x46, 0x85, 0xb8, 0x1e, 0xb2, 0x31, 0xaf, 0x06,
+  0xf7, 0x2b, 0xfc, 0x98, 0x72, 0x35, 0xce, 0xe5, 0xae, 0x2e, 0xed, 0x77,
+  0xd0, 0x35, 0x68, 0x03, 0x95, 0xcc, 0xb4, 0x2e, 0x65, 0x57, 0x57, 0x7b,
+  0x27, 0x44, 0xcc, 0x82, 0x53, 0x5c, 0x49, 0x10, 0x7d, 0x0e, 0x57, 0xbb,
+  0x92, 0xc2, 0x62, 0xf5, 0x4b, 0x7b, 0xd0, 0xb4, 0x40, 0xad, 0x84, 0xb5,
+  0x52, 0xa6, 0x28, 0xf5, 0xdf, 0x0f, 0x5c, 0x4d, 0x6b, 0x96, 0x4d, 0xc9,
+  0x1a, 0xba, 0x7b, 0x66, 0xc1, 0x63, 0x43, 0xfa, 0xf3, 0x45, 0xc1, 0xff,
+  0x85, 0x16, 0x9b, 0xb2, 0xec, 0xfa, 0x0b, 0x9e, 0xae, 0x44, 0x3d, 0xb1,
+  0xa4, 0x51, 0xe4, 0x4f, 0x14, 0xcc, 0xa5, 0x39, 0x17, 0xdd, 0xb8, 0x40,
+  0x9a, 0x06, 0xe1, 0x3b, 0x47, 0xad, 0x6f, 0xba, 0xaa, 0x13, 0x22, 0x68,
+  0x7a, 0xaa, 0x1e, 0xe3, 0x69, 0x2a, 0x2a, 0xdd, 0xf4, 0x01, 0xfd, 0xaf,
+  0x82, 0xb6, 0xaa, 0x5f, 0x6b, 0xd5, 0x08, 0xdc, 0x7e, 0x18, 0xf4, 0x16,
+  0x6f, 0xad, 0x4b, 0xeb, 0x31, 0x33, 0x89, 0x19, 0xb4, 0x1d, 0xb3, 0x1d,
+  0xba, 0x0c, 0x9a, 0xb9, 0x8e, 0x8f, 0x9e, 0x68, 0xe9, 0xa0, 0x3b, 0xc6,
+  0x32, 0xd0, 0xf4, 0xa4, 0xa8, 0x79, 0x3c, 0xd2, 0x72, 0x05, 0xdd, 0x35,
+  0x1b, 0x11, 0xec, 0x92, 0x02, 0xbb, 0x00, 0xa1, 0x5e, 0x25, 0xaf, 0x79,
+  0x82, 0xa0, 0x3f, 0x30, 0x55, 0x7f, 0xeb, 0x03, 0x76, 0xaa, 0xd0, 0xc4,
+  0x16, 0x63, 0x9d, 0x18, 0x5e, 0xfc, 0xf4, 0x0a, 0x91, 0xe5, 0x79, 0x5e,
+  0x23, 0xc0, 0xa0, 0x69, 0x0c, 0xd2, 0x09, 0x97, 0xa6, 0x0b, 0xb2, 0xc3,
+  0xba, 0xf5, 0x06, 0xc6, 0x8e, 0xd1, 0xb6, 0x4c, 0xee, 0x2c, 0x1e, 0x99,
+  0xb8, 0x3e, 0xdf, 0xbb, 0x68, 0x67, 0x78, 0xdd, 0x8c, 0x60, 0xe6, 0x0e,
+  0x46, 0x71, 0x12, 0x47, 0xb2, 0xc3, 0x80, 0x62, 0x73, 0xd0, 0xa1, 0xc2,
+  0x09, 0xe2, 0x46, 0x7f, 0xd8, 0x63, 0xc4, 0xd1, 0x02, 0xb9, 0x10, 0xef,
+  0xa8, 0x88, 0x62, 0x8b, 0xda, 0xe4, 0x2f, 0xd0, 0xda, 0xea, 0xbb, 0xd6,
+  0x71, 0xfb, 0x3e, 0xd2, 0x44, 0xfb, 0xee, 0x23, 0xec, 0x9a, 0xb3, 0x13,
+  0xec, 0x83, 0xf5, 0xf0, 0x35, 0xf9, 0x9a, 0xc8, 0x61, 0xd1, 0x24, 0xe6,
+  0x45, 0xce, 0x4d, 0x41, 0x45, 0xa5, 0xb6, 0xf9, 0x58, 0x52, 0xf6, 0xa2,
+  0xfb, 0x89, 0xa8, 0x54, 0x22, 0xc1, 0x3e, 0x73, 0x75, 0x8b, 0x28, 0xdb,
+  0x0c, 0x9a, 0xc7, 0xba, 0xd1, 0xda, 0x7c, 0x26, 0x44, 0x9b, 0x39, 0xbc,
+  0x30, 0x43, 0x41, 0x7a, 0x7b, 0xd0, 0xe9, 0x22, 0x58, 0xcf, 0x69, 0x8e,
+  0xeb, 0x1f, 0xd3, 0xd6, 0xab, 0xae, 0xf1, 0xc4, 0xcb, 0xb6, 0x6e, 0xd3,
+  0xdc, 0x6e, 0x8f, 0x2e, 0x23, 0x6a, 0xee, 0xc5, 0x24, 0xb6, 0x26, 0x03,
+  0xd9, 0x0c, 0xd2, 0xe6, 0x8f, 0x66, 0x38, 0x42, 0x34, 0x26, 0x09, 0xf5,
+  0xfb, 0xec, 0xb5, 0x48, 0x66, 0x68, 0xf8, 0x6a, 0x5b, 0x01, 0xd0, 0x0e,
+  0x7a, 0xfd, 0x91, 0xcd, 0x4a, 0xb4, 0xc8, 0xe9, 0xc9, 0x4d, 0x05, 0x43,
+  0xf9, 0x36, 0xc7, 0x5d, 0xdb, 0x21, 0x41, 0x89, 0xff, 0x29, 0x9a, 0x09,
+  0x14, 0x0b, 0x36, 0x16, 0x9a, 0x70, 0xb0, 0x92, 0x2b, 0xe6, 0x3a, 0x6a,
+  0x93, 0x65, 0x5d, 0x79, 0x42, 0x25, 0x4b, 0x5d, 0x1a, 0x2b, 0xd4, 0x2c,
+  0x11, 0xa6, 0x16, 0xcc, 0x0b, 0x72, 0xac, 0x5c, 0x32, 0xea, 0x67, 0x0a,
+  0x31, 0xd2, 0xe8, 0xaf, 0x51, 0x79, 0xc5, 0xeb, 0xb3, 0xe9, 0x6e, 0x43,
+  0xee, 0xa5, 0x46, 0x65, 0x2a, 0x6a, 0xfb, 0x0c, 0x46, 0x02, 0x45, 0x70,
+  0x18, 0xf4, 0x79, 0x95, 0xf7, 0xad, 0xda, 0x41, 0xb7, 0x14, 0x00, 0x69,
+  0x5c, 0xb6, 0xb5, 0x80, 0xe1, 0x2f, 0x0b, 0x11, 0x0b, 0xa5, 0x28, 0xe7,
+  0x1f, 0xdb, 0xc2, 0x0c, 0xf5, 0xa8, 0x69, 0xea, 0x7d, 0xfe, 0xa6, 0x64,
+  0xa8, 0x75, 0x2b, 0x8c, 0xd0, 0xde, 0xd5, 0xa5, 0x0c, 0xfd, 0xa0, 0x84,
+  0xca, 0x80, 0xe3, 0xcc, 0xea, 0x13, 0x23, 0xa4, 0x60, 0x1b, 0xb6, 0xb8,
+  0x06, 0x38, 0x99, 0xc4, 0x4e, 0x52, 0x5e, 0xf0, 0x2a, 0x3c, 0xa7, 0x1e,
+  0xbc, 0xc1, 0x6b, 0xbb, 0xf1, 0x0b, 0xdc, 0x65, 0x15, 0x4a, 0x7a, 0x56,
+  0xe7, 0xb2, 0x7b, 0xbf, 0x48, 0x85, 0x17, 0xd1, 0x0a, 0xd3, 0xb1, 0x29,
+  0x61, 0xf2, 0xe0, 0x63, 0xc7, 0x4d, 0x7d, 0x3d, 0x1d, 0xc3, 0x80, 0x24,
+  0x7e, 0x2c, 0x59, 0x7b, 0x8e, 0x4e, 0x21, 0xd2, 0x3e, 0x34, 0xa5, 0x47,
+  0xc4, 0x3e, 0x7c, 0xf0, 0x8b, 0x94, 0x4e, 0x9c, 0xf8, 0x44, 0x19, 0xe5,
+  0xde, 0x53, 0x74, 0x4b, 0xe9, 0xd4, 0xbe, 0xad, 0x15, 0x9a, 0xef, 0x9e,
+  0x36, 0xda, 0xb4, 0x75, 0x15, 0x94, 0x87, 0x0b, 0x3d, 0xe5, 0xb8, 0xea,
+  0x64, 0x63, 0x82, 0x94, 0x58, 0x4b, 0x24, 0x71, 0xf3, 0x02, 0xa3, 0xa8,
+  0xf1, 0xef, 0x33, 0xb8, 0xeb, 0x18, 0x95, 0xd7, 0x9c, 0x2f, 0x18, 0xb5,
+  0xab, 0x70, 0x1c, 0x61, 0xe6, 0x5b, 0xed, 0xa0, 0x0b, 0xc1, 0xab, 0x8a,
+  0xd9, 0x23, 0x4a, 0xf6, 0xe4, 0x92, 0xb5, 0xf8, 0x81, 0x4d, 0x05, 0x97,
+  0x86, 0x4e, 0xea, 0x1a, 0x6e, 0xaf, 0x04, 0x21, 0x51, 0x3b, 0x8b, 0x80,
+  0x8c, 0x10, 0x2e, 0xe1, 0xff, 0x74, 0x69, 0xcd, 0x6c, 0x6c, 0x0e, 0x33,
+  0x0b, 0x0a, 0xf8, 0xb0, 0xa5, 0x84, 0x15, 0x28, 0xe8, 0x27, 0xa0, 0xc1,
+  0x89, 0x8c, 0x57, 0xd1, 0x93, 0x31, 0x27, 0xd8, 0xa1, 0xe9, 0x29, 0xd5,
+  0x41, 0xa7, 0x10, 0x62, 0xc7, 0x0f, 0xc3, 0x55, 0x25, 0x58, 0x98, 0x38,
+  0x7a, 0x5c, 0x2a, 0x77, 0xae, 0x7c, 0xc3, 0xed, 0xe7, 0xcd, 0x48, 0xf7,
+  0x7b, 0x91, 0x9c, 0xc2, 0x4a, 0xb8, 0xa3, 0xcb, 0x79, 0x3d, 0xe8, 0xf7,
+  0xef, 0xde, 0xc0, 0x68, 0x66, 0x00, 0x18, 0x4f, 0xa0, 0xe6, 0xb2, 0x3f,
+  0x6f, 0x9b, 0xf7, 0x39, 0xdc, 0x5f, 0xd2, 0x48, 0xea, 0x96, 0x41, 0x58,
+  0xa3, 0xce, 0x6a, 0x1e, 0xb2, 0x7d, 0x0c, 0xb6, 0xae, 0xb6, 0x9b, 0x7a,
+  0xb5, 0x22, 0xd0, 0xf1, 0xd7, 0x14, 0xa5, 0xdc, 0x84, 0x6f, 0x25, 0x84,
+  0xce, 0x4c, 0xb6, 0xf5, 0xf2, 0x48, 0x3b, 0x4f, 0x76, 0xef, 0xe0, 0x8a,
+  0x82, 0xce, 0xaf, 0x4f, 0x5f, 0xbd, 0x8c, 0x2b, 0xae, 0x6a, 0x11, 0xda,
+  0x2a, 0x3a, 0xea, 0xb6, 0xb4, 0xf4, 0x87, 0x70, 0x3e, 0x7c, 0x38, 0x64,
+  0xeb, 0x4a, 0xb3, 0x2f, 0xbf, 0x04, 0x46, 0x5c, 0xbb, 0xa5, 0x66, 0xfb,
+  0x1e, 0xdb, 0x1f, 0x7a, 0xfc, 0xab, 0x43, 0x58, 0x6a, 0x7f, 0xd7, 0xf3,
+  0x29, 0x10, 0x18, 0xa7, 0x12, 0x57, 0x1d, 0x23, 0x2c, 0x3d, 0xd3, 0x41,
+  0x9b, 0x6d, 0xd6, 0xea, 0x5a, 0x25, 0x85, 0xd7, 0x88, 0x2d, 0x96, 0x5f,
+  0x29, 0xd2, 0xfc, 0x7a, 0xf8, 0x90, 0xed, 0x76, 0xb4, 0xc5, 0xf3, 0x3e,
+  0xcb, 0xa7, 0xa2, 0x9c, 0xe9, 0x70, 0x8b, 0x5f, 0xf4, 0x68, 0x60, 0xb9,
+  0xb7, 0x92, 0x07, 0x5f, 0xbf, 0x35, 0xee, 0xe0, 0x14, 0xc7, 0xd4, 0x27,
+  0x44, 0x5b, 0x12, 0xb6, 0xab, 0x50, 0x9b, 0x3a, 0xa3, 0x73, 0x73, 0x22,
+  0xae, 0x94, 0x79, 0x00, 0x4f, 0xc4, 0x88, 0xcf, 0x0a, 0xed, 0x07, 0x3c,
+  0x9b, 0x58, 0x3e, 0x25, 0xf2, 0x2d, 0x84, 0xd1, 0xc4, 0x17, 0x62, 0xaf,
+  0x78, 0x31, 0x43, 0x07, 0xa5, 0xf2, 0xa9, 0x0f, 0x62, 0x73, 0xf7, 0x8f,
+  0xc1, 0x10, 0xd1, 0x27, 0x40, 0xb6, 0x66, 0x82, 0x2c, 0x03, 0x2b, 0x25,
+  0xcf, 0xd6, 0x9c, 0x53, 0xa1, 0x27, 0x25, 0x8d, 0x97, 0xdd, 0x58, 0xd6,
+  0x8e, 0xd8, 0xeb, 0x01, 0xb2, 0x70, 0xe0, 0x82, 0xd3, 0xee, 0x19, 0x0a,
+  0xd4, 0x60, 0x6d, 0x9c, 0x4e, 0xb1, 0xde, 0xab, 0x3f, 0x92, 0x32, 0x5b,
+  0x0c, 0xac, 0xa7, 0xd6, 0x9a, 0x9a, 0xf5, 0x7c, 0xb4, 0x08, 0x6f, 0x98,
+  0x71, 0x15, 0x7b, 0xa0, 0x65, 0xe4, 0x55, 0x4a, 0xe4, 0x28, 0x4d, 0x0e,
+  0xda, 0xf4, 0x15, 0x33, 0x5c, 0xbe, 0x35, 0x27, 0x29, 0x31, 0xa6, 0xab,
+  0x52, 0xec, 0xc5, 0xa3, 0xc7, 0x66, 0x2e, 0x46, 0x35, 0xd4, 0xaa, 0xa3,
+  0x5e, 0xef, 0xf2, 0x3e, 0xe7, 0xe6, 0x46, 0xe4, 0xfb, 0xb1, 0x46, 0x3f,
+  0x23, 0xb4, 0xfb, 0x67, 0x1d, 0x67, 0x35, 0x82, 0x73, 0xdd, 0xd5, 0x7f,
+  0xcd, 0x6e, 0xde, 0xf3, 0x23, 0x1b, 0x7a, 0x0b, 0xab, 0x3e, 0x74, 0xc0,
+  0x46, 0xf1, 0xea, 0xcb, 0x3a, 0x43, 0x6f, 0xe3, 0x65, 0xb7, 0xa4, 0xed,
+  0xc7, 0x36, 0xca, 0xb5, 0x9e, 0x91, 0xe8, 0xd7, 0x96, 0x2c, 0xd7, 0xea,
+  0xd1, 0x37, 0x17, 0x1a, 0x23, 0x90, 0xcb, 0x50, 0xd1, 0x23, 0x51, 0xb8,
+  0x4f, 0x94, 0x9d, 0x5e, 0x81, 0x32, 0xd8, 0x76, 0x91, 0x81, 0x4d, 0x45,
+  0x9d, 0x71, 0xa6, 0xd7, 0x45, 0x75, 0x26, 0x99, 0x60, 0xa6, 0xb1, 0x6e,
+  0x78, 0x69, 0xbb, 0x2a, 0x66, 0xab, 0x58, 0x3b, 0x1e, 0x6f, 0x32, 0xc8,
+  0xc3, 0xcb, 0xc8, 0x9f, 0x6a, 0x34, 0x97, 0x67, 0x61, 0xff, 0x07, 0x5e,
+  0xff, 0x9f, 0xb5, 0xce, 0x7a, 0x3f, 0xbb, 0xcd, 0x3c, 0xa6, 0xbf, 0x65,
+  0xa8, 0x22, 0xe8, 0x5f, 0x09, 0x4a, 0xe9, 0xec, 0x74, 0xab, 0x65, 0x0c,
+  0xa4, 0x29, 0x49, 0xfe, 0x2f, 0x4d, 0xb3, 0xe3, 0xc7, 0x8c, 0xad, 0x35,
+  0xc2, 0x70, 0xe7, 0xdf, 0x0c, 0x45, 0x60, 0x41, 0xf7, 0x21, 0x00, 0x00
+};
+const unsigned int webcontent_js_gz_len = 3036;
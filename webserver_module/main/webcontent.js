@@ -0,0 +1,214 @@
+const EINK_W = 800, EINK_H = 480;
+
+async function renderAndThreshold(file, canvas) {
+    const img = new Image();
+    img.src = URL.createObjectURL(file);
+    await img.decode();
+
+    const ctx = canvas.getContext('2d');
+    ctx.fillStyle = 'white';
+    ctx.fillRect(0, 0, EINK_W, EINK_H);
+
+    const scale = Math.min(EINK_W / img.width, EINK_H / img.height, 1);
+    const dw = Math.round(img.width * scale), dh = Math.round(img.height * scale);
+    const dx = (EINK_W - dw) / 2 | 0, dy = (EINK_H - dh) / 2 | 0;
+    ctx.drawImage(img, dx, dy, dw, dh);
+
+    const data = ctx.getImageData(0, 0, EINK_W, EINK_H).data;
+    for (let i = 0; i < data.length; i += 4) {
+        const avg = (data[i] + data[i + 1] + data[i + 2]) / 3;
+        const v = avg < 128 ? 0 : 255;
+        data[i] = data[i + 1] = data[i + 2] = v;
+    }
+    ctx.putImageData(new ImageData(data, EINK_W, EINK_H), 0, 0);
+}
+
+function canvasToBytes(canvas) {
+    const ctx = canvas.getContext('2d');
+    const img = ctx.getImageData(0, 0, EINK_W, EINK_H).data;
+    const bytes = new Uint8Array((EINK_W * EINK_H) / 8);
+    let byteIdx = 0, bitPos = 7;
+    for (let i = 0; i < img.length; i += 4) {
+        if (img[i] === 0) bytes[byteIdx] |= 1 << bitPos;
+        if (bitPos-- === 0) { bitPos = 7; byteIdx++; }
+    }
+    return bytes;
+}
+
+function uploadLogo(mac) {
+    const canvas = document.getElementById(`logoPreview_${mac}`);
+    const header = new TextEncoder().encode(mac + "\n");
+    const payload = new Blob([header, canvasToBytes(canvas).buffer], { type: 'application/octet-stream' });
+
+    // Only the upload is reported here; the delivery itself arrives on /ws
+    const xhr = new XMLHttpRequest();
+    xhr.upload.onprogress = e => showDelivery(mac, { kind: 'image', state: 'uploading', done: e.loaded, total: e.total });
+    xhr.onloadend = () => {
+        if (xhr.status === 200) loadBadges();
+        else alert('❌ Upload failed');
+    };
+
+    xhr.open('POST', '/sendlogo', true);
+    xhr.send(payload);
+}
+
+function el(tag, props = {}, ...children) {
+    const node = Object.assign(document.createElement(tag), props);
+    node.append(...children);
+    return node;
+}
+
+function describeStatus(b) {
+    const parts = [b.last_seen === null ? 'Not heard from yet' : `Last seen ${b.last_seen} s ago`];
+    if (b.rssi !== null) parts.push(`${b.rssi} dBm`);
+    if (b.battery !== null) parts.push(`${(b.battery / 1000).toFixed(2)} V`);
+    if (b.content) parts.push(`Showing: ${b.content}`);
+    const t = b.telemetry;
+    if (t) {
+        parts.push(`Firmware ${t.firmware}`);
+        if (t.renders) parts.push(`last refresh ${(t.last_render_ms / 1000).toFixed(1)} s`);
+        if (t.dropped) parts.push(`⚠ ${t.dropped} frames lost on the badge`);
+    }
+    return parts.join(' · ');
+}
+
+function describeDelivery(d) {
+    if (!d) return '';
+    const what = d.kind === 'image' ? 'Image' : 'Update';
+    const pct = d.total > 1 ? ` ${Math.floor(d.done * 100 / d.total)}%` : '';
+    const retries = d.retries ? ` · ${d.retries} ${d.retries === 1 ? 'retry' : 'retries'}` : '';
+    switch (d.state) {
+        case 'uploading': return `${what} uploading${pct}`;
+        case 'queued': return `${what} queued`;
+        case 'held': return `${what} waiting for the badge to wake up`;
+        case 'sending': return `${what} sending${pct}${retries}`;
+        case 'retry': return `${what} retrying${retries}`;
+        case 'done': return `${what} delivered ✓${retries}`;
+        case 'failed': return `${what} failed ✗${retries}`;
+        case 'rendering': return `${what} delivered, badge is refreshing…${retries}`;
+        case 'rendered': return `${what} shown on the badge ✓ (${(d.render_ms / 1000).toFixed(1)} s)${retries}`;
+    }
+    return '';
+}
+
+function showDelivery(mac, d) {
+    const block = document.querySelector(`.badge-block[data-mac="${mac}"]`);
+    if (!block) return;
+    const line = block.querySelector('.badge-delivery');
+    line.textContent = describeDelivery(d);
+    line.dataset.state = d ? d.state : '';
+}
+
+function badgeBlock(b) {
+    const mac = b.mac;
+    const form = el('form', { onsubmit: e => sendText(e, mac) },
+        el('input', { type: 'text', name: 'first_name', placeholder: 'First Name' }),
+        el('input', { type: 'text', name: 'last_name', placeholder: 'Last Name' }),
+        el('input', { type: 'text', name: 'additional_info', placeholder: 'Additional Info' }),
+        el('div', { style: 'display:flex; gap:8px; margin-top:8px;' },
+            el('button', { type: 'submit' }, 'Send'),
+            el('button', { type: 'button', className: 'clear', onclick: () => clearBadge(mac) }, 'Clear'),
+            el('button', { type: 'button', className: 'delete', onclick: () => deleteMac(mac) }, 'Delete')));
+
+    const input = el('input', { type: 'file', id: `logoInput_${mac}`, accept: 'image/*' });
+    const canvas = el('canvas', { id: `logoPreview_${mac}`, width: EINK_W, height: EINK_H });
+    const btn = el('button', { id: `sendLogoBtn_${mac}`, className: 'send-logo-btn', disabled: true }, 'Send Image');
+    input.addEventListener('change', async () => {
+        await renderAndThreshold(input.files[0], canvas);
+        canvas.classList.add('show');
+        btn.disabled = false;
+    });
+    btn.addEventListener('click', () => uploadLogo(mac));
+
+    const block = el('div', { className: 'badge-block' },
+        el('h3', {}, b.alias ? `${b.alias} (${mac})` : mac),
+        el('p', { className: 'badge-status' }, describeStatus(b)),
+        el('p', { className: 'badge-delivery' }),
+        form,
+        el('div', { className: 'logo-block' }, el('h3', {}, 'Image Upload'), input, canvas, btn));
+    block.dataset.mac = mac;
+    return block;
+}
+
+// Rebuilds the blocks of badges that came or went; the others only get
+// their status line refreshed, so forms being filled in are left alone.
+async function loadBadges() {
+    const res = await fetch('/api/badges');
+    if (!res.ok) return console.error('Failed to load badges');
+    const list = await res.json();
+    const container = document.getElementById('badges');
+    const existing = new Map([...container.children].map(n => [n.dataset.mac, n]));
+    container.replaceChildren(...list.map(b => {
+        const block = existing.get(b.mac) || badgeBlock(b);
+        block.querySelector('.badge-status').textContent = describeStatus(b);
+        return block;
+    }));
+    list.forEach(b => showDelivery(b.mac, b.delivery));
+}
+
+// The gateway pushes every delivery step. A gap in seq means events were
+// lost, and nothing arrives while disconnected: both reload the list.
+let lastSeq = null;
+function listenForDeliveries() {
+    const ws = new WebSocket(`ws://${location.host}/ws`);
+    ws.onopen = () => {
+        if (lastSeq !== null) loadBadges();
+        lastSeq = null;
+    };
+    ws.onmessage = e => {
+        let gap = false;
+        for (const ev of JSON.parse(e.data)) {
+            gap ||= lastSeq !== null && ev.seq !== lastSeq + 1;
+            lastSeq = ev.seq;
+            showDelivery(ev.mac, ev);
+        }
+        if (gap) loadBadges();
+    };
+    ws.onclose = () => {
+        lastSeq = lastSeq ?? -1;
+        setTimeout(listenForDeliveries, 2000);
+    };
+}
+
+document.getElementById('macForm').addEventListener('submit', async e => {
+    e.preventDefault();
+    const mac = document.getElementById('mac_address').value.trim();
+    const alias = document.getElementById('mac_alias').value.trim();
+    const res = await fetch('/addmac', {
+        method: 'POST', headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify({ mac, alias })
+    });
+    if (res.ok) loadBadges();
+    else console.error('Failed to register MAC');
+});
+
+function sendText(e, mac) {
+    e.preventDefault();
+    const f = e.target;
+    fetch('/sendtext', {
+        method: 'POST', headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify({
+            mac,
+            first_name: f.first_name.value,
+            last_name: f.last_name.value,
+            additional_info: f.additional_info.value
+        })
+    }).then(r => r.ok ? loadBadges() : console.error('Fail'));
+}
+function deleteMac(mac) {
+    if (!confirm(`Delete ${mac} from the list?`)) return;
+    fetch('/deletemac', {
+        method: 'POST', headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify({ mac })
+    }).then(r => r.ok ? loadBadges() : console.error('Fail'));
+}
+function clearBadge(mac) {
+    if (!confirm(`Clear screen on ${mac}?`)) return;
+    fetch('/clearbadge', {
+        method: 'POST', headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify({ mac })
+    }).then(r => r.ok ? loadBadges() : console.error('Fail'));
+}
+
+loadBadges();
+listenForDeliveries();
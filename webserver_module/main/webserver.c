@@ -2,131 +2,291 @@
 #include <string.h>
 #include <stdlib.h>
 #include "esp_log.h"
+#include "esp_mac.h"
 #include "esp_http_server.h"
 #include "esp_now.h"
+#include "esp_timer.h"
 #include "cJSON.h"
-#include "nvs.h"
-#include "nvs_flash.h"
-#include "web_content.h" // Contains the index_html constant
+#include "web_content.h" // Page template and gzipped assets, see html_gen.sh
 #include "wifi.h"
+#include "logo_transfer.h"
+#include "badge_wake.h"
+#include "badge_status.h"
+#include "badge_registry.h"
+#include "peer_cache.h"
+#include "delivery_push.h"
+#include "cmd_proto.h"
 
 #include "mbedtls/base64.h"
 
 static const char *TAG = "EInkREST";
 
-static uint8_t logo_buf[LOGO_BUF_SIZE];
+// Longest target list: every registered MAC, comma separated
+#define TARGETS_MAX_LEN (BADGE_REGISTRY_MAX * (MAC_STR_LEN + 1))
 
-char *generate_mac_blocks_html()
+// Resolved target lists can name every registered badge: too big for the httpd stack
+#define TARGETS_ALLOC() malloc(BADGE_REGISTRY_MAX * 6)
+
+// Resolves a target list: "*" selects every registered badge, anything else
+// is a comma-separated list of MACs. Returns the number of targets, 0 if the
+// list is empty or malformed.
+static size_t parse_targets(const char *list, uint8_t macs[][6])
 {
-    // Pre-allocate ~6 KiB for all blocks
-    char *output = calloc(1, 6144);
-    if (!output)
+    if (strcmp(list, "*") == 0)
     {
-        return NULL;
+        return badge_registry_macs(macs, BADGE_REGISTRY_MAX);
     }
-    output[0] = '\0';
 
-    // Open NVS namespace where we keep mac_0…mac_N
-    nvs_handle_t nvs;
-    if (nvs_open("mac_store", NVS_READONLY, &nvs) != ESP_OK)
+    size_t count = 0;
+    while (*list)
     {
-        // on error, return empty page
-        return output;
+        char one[MAC_STR_LEN + 1];
+        size_t len = strcspn(list, ",");
+        if (count == BADGE_REGISTRY_MAX || len != MAC_STR_LEN)
+        {
+            return 0;
+        }
+        memcpy(one, list, len);
+        one[len] = '\0';
+        if (!parse_mac(one, macs[count]))
+        {
+            return 0;
+        }
+        count++;
+        list += len;
+        if (*list == ',')
+        {
+            list++;
+        }
     }
+    return count;
+}
 
-    char key[16];
-    char mac[20];
-    size_t len;
-    char block[2048];
+// Answers a target list that parse_targets() resolved to nothing: "*" only
+// comes back empty when no badge is registered, which is not a typo.
+static esp_err_t send_targets_err(httpd_req_t *req, const char *list)
+{
+    if (strcmp(list, "*") == 0)
+    {
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No badges registered");
+    }
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid MAC format");
+}
 
-    for (int i = 0; i < MAX_MAC_ENTRIES; i++)
+// Sends one command message to every target and answers with the outcome:
+// the first error (or ESP_OK), plus how many updates went out now and how
+// many wait for a sleeping badge's next wake window. content describes the
+// update in the badge list.
+static esp_err_t send_to_targets(httpd_req_t *req, uint8_t macs[][6], size_t count, const uint8_t *msg,
+                                 size_t msg_len, const char *content)
+{
+    esp_err_t first_err = ESP_OK;
+    int sent = 0;
+    int queued = 0;
+    for (size_t i = 0; i < count; i++)
     {
-        // Read the i-th MAC entry
-        snprintf(key, sizeof(key), "mac_%d", i);
-        len = sizeof(mac);
-        if (nvs_get_str(nvs, key, mac, &len) != ESP_OK)
+        bool held;
+        esp_err_t err = badge_wake_send(macs[i], msg, msg_len, &held);
+        if (err != ESP_OK)
+        {
+            ESP_LOGW(TAG, "Send to " MACSTR " failed: %s", MAC2STR(macs[i]), esp_err_to_name(err));
+            first_err = (first_err == ESP_OK) ? err : first_err;
+        }
+        else if (held)
+        {
+            queued++;
+        }
+        else
+        {
+            sent++;
+        }
+        if (err == ESP_OK)
         {
-            continue; // slot empty
+            badge_status_set_content(macs[i], content);
         }
+    }
+
+    cJSON *resp_json = cJSON_CreateObject();
+    cJSON_AddStringToObject(resp_json, "status", esp_err_to_name(first_err));
+    cJSON_AddNumberToObject(resp_json, "sent", sent);
+    cJSON_AddNumberToObject(resp_json, "queued", queued);
+    char *resp_str = cJSON_PrintUnformatted(resp_json);
+    cJSON_Delete(resp_json);
 
-        // Generate the combined badge + logo HTML block
-        snprintf(block, sizeof(block),
-                 "<div class=\"badge-block\" data-mac=\"%s\">"
-                 "<h3>%s</h3>"
-                 "<form onsubmit=\"sendText(event,'%s')\">"
-                 "<input type=\"text\" name=\"first_name\" placeholder=\"First Name\">"
-                 "<input type=\"text\" name=\"last_name\" placeholder=\"Last Name\">"
-                 "<input type=\"text\" name=\"additional_info\" placeholder=\"Additional Info\">"
-                 "<div style=\"display:flex; gap:8px; margin-top:8px;\">"
-                 "<button type=\"submit\">Send</button>"
-                 "<button type=\"button\" class=\"clear\" onclick=\"clearBadge('%s')\">Clear</button>"
-                 "<button type=\"button\" class=\"delete\" onclick=\"deleteMac('%s')\">Delete</button>"
-                 "</div>"
-                 "</form>"
-                 "<div class=\"logo-block\">"
-                 "<h3>Image Upload</h3>"
-                 "<input type=\"file\" id=\"logoInput_%s\" accept=\"image/*\">"
-                 "<canvas id=\"logoPreview_%s\" width=\"800\" height=\"480\"></canvas>"
-                 "<button id=\"sendLogoBtn_%s\" class=\"send-logo-btn\" disabled>Send Image</button>"
-                 "</div>"
-                 "</div>",
-                 mac, // data-mac
-                 mac, // <h3>%s</h3>
-                 mac, // sendText(event,'%s')
-                 mac, // clearBadge('%s')
-                 mac, // deleteMac('%s')
-                 mac, // id="logoInput_%s"
-                 mac, // id="logoPreview_%s"
-                 mac  // id="sendLogoBtn_%s"
-        );
-        strcat(output, block);
-    }
-
-    nvs_close(nvs);
-    return output;
+    httpd_resp_set_type(req, "application/json");
+    esp_err_t res = httpd_resp_send(req, resp_str, HTTPD_RESP_USE_STRLEN);
+    free(resp_str);
+    return res;
 }
 
-static esp_err_t index_get_handler(httpd_req_t *req)
+// Bytes handed to the socket per chunk while streaming an asset from flash
+#define ASSET_CHUNK_LEN 1460
+
+// A static asset embedded gzipped by html_gen.sh. Assets with an ETag are
+// revalidated on every load; the others have their content hash in the URI
+// and are cached for good.
+typedef struct
 {
-    const char *html_template = (const char *)webcontent_html;
-    const char *placeholder = "<!-- {{MAC_LIST}} -->";
-    const char *injection_point = strstr(html_template, placeholder);
+    const char *type;
+    const char *etag;
+    const unsigned char *data;
+    const unsigned int *len;
+} static_asset_t;
+
+static const static_asset_t html_asset = {"text/html", WEBCONTENT_HTML_ETAG, webcontent_html_gz, &webcontent_html_gz_len};
+static const static_asset_t css_asset = {"text/css", NULL, webcontent_css_gz, &webcontent_css_gz_len};
+static const static_asset_t js_asset = {"application/javascript", NULL, webcontent_js_gz, &webcontent_js_gz_len};
 
-    if (!injection_point)
+static bool etag_matches(httpd_req_t *req, const char *etag)
+{
+    char value[64];
+    size_t len = httpd_req_get_hdr_value_len(req, "If-None-Match");
+    if (len == 0 || len >= sizeof(value) ||
+        httpd_req_get_hdr_value_str(req, "If-None-Match", value, sizeof(value)) != ESP_OK)
     {
-        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "MAC list placeholder not found");
+        return false;
     }
+    return strcmp(value, "*") == 0 || strstr(value, etag) != NULL;
+}
 
-    char *mac_html = generate_mac_blocks_html();
-    if (!mac_html)
+// Serves an asset as stored: no decompression and no copy out of flash.
+static esp_err_t asset_get_handler(httpd_req_t *req)
+{
+    const static_asset_t *asset = req->user_ctx;
+    if (asset->etag)
     {
-        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to generate MAC block");
+        httpd_resp_set_hdr(req, "ETag", asset->etag);
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+        if (etag_matches(req, asset->etag))
+        {
+            httpd_resp_set_status(req, "304 Not Modified");
+            return httpd_resp_send(req, NULL, 0);
+        }
     }
+    else
+    {
+        // The URI changes with the content, so a cached copy never goes stale
+        httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=31536000, immutable");
+    }
+    httpd_resp_set_type(req, asset->type);
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
 
-    size_t pre_len = injection_point - html_template;
-    size_t mac_html_len = strlen(mac_html);
-    size_t placeholder_len = strlen(placeholder);
-    size_t post_len = webcontent_html_len - pre_len - placeholder_len;
-    size_t total_len = pre_len + mac_html_len + post_len;
+    const char *data = (const char *)asset->data;
+    size_t len = *asset->len;
+    for (size_t off = 0; off < len; off += ASSET_CHUNK_LEN)
+    {
+        size_t chunk = (len - off < ASSET_CHUNK_LEN) ? len - off : ASSET_CHUNK_LEN;
+        esp_err_t res = httpd_resp_send_chunk(req, data + off, chunk);
+        if (res != ESP_OK)
+        {
+            return res;
+        }
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
 
-    char *final_html = malloc(total_len);
-    if (!final_html)
+/**
+ * HTTP GET /api/badges
+ *   • Returns every registered badge as a JSON array of
+ *     {"mac","alias","last_seen","content","battery","rssi","delivery"}
+ *   • last_seen is in seconds ago; last_seen, battery (mV) and rssi (dBm)
+ *     are null until the badge has been heard from or reported them
+ *   • delivery is the latest step of the latest update, shaped like the
+ *     /ws events, or null if nothing was sent since boot
+ *   • telemetry is what the badge last reported about itself,
+ *     {"firmware","renders","rejected","last_render_ms","max_render_ms",
+ *     "rssi","queue_hwm","dropped"}, or null before its first report
+ */
+static esp_err_t badges_get_handler(httpd_req_t *req)
+{
+    size_t max = badge_registry_count();
+    badge_entry_t *entries = malloc((max ? max : 1) * sizeof(*entries));
+    if (!entries)
     {
-        free(mac_html);
-        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to allocate memory");
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
     }
+    size_t count = badge_registry_list(entries, NULL, max);
 
-    memcpy(final_html, html_template, pre_len);
-    memcpy(final_html + pre_len, mac_html, mac_html_len);
-    memcpy(final_html + pre_len + mac_html_len,
-           injection_point + placeholder_len,
-           post_len);
+    cJSON *list = cJSON_CreateArray();
+    uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
+    for (size_t i = 0; i < count; i++)
+    {
+        badge_status_t st;
+        if (!badge_status_get(entries[i].mac, &st))
+        {
+            continue; // unregistered meanwhile
+        }
 
-    free(mac_html);
+        char mac[MAC_STR_LEN + 1];
+        snprintf(mac, sizeof(mac), MACSTR, MAC2STR(entries[i].mac));
+        cJSON *badge = cJSON_CreateObject();
+        cJSON_AddStringToObject(badge, "mac", mac);
+        cJSON_AddStringToObject(badge, "alias", entries[i].alias);
+        if (st.seen)
+        {
+            cJSON_AddNumberToObject(badge, "last_seen", (now - st.last_seen_ms) / 1000);
+            cJSON_AddNumberToObject(badge, "rssi", st.rssi);
+        }
+        else
+        {
+            cJSON_AddNullToObject(badge, "last_seen");
+            cJSON_AddNullToObject(badge, "rssi");
+        }
+        cJSON_AddStringToObject(badge, "content", st.content);
+        if (st.battery_mv)
+        {
+            cJSON_AddNumberToObject(badge, "battery", st.battery_mv);
+        }
+        else
+        {
+            cJSON_AddNullToObject(badge, "battery");
+        }
+        if (st.delivery.state != DELIVERY_NONE)
+        {
+            cJSON *delivery = cJSON_AddObjectToObject(badge, "delivery");
+            cJSON_AddStringToObject(delivery, "kind", delivery_kind_str(st.delivery.kind));
+            cJSON_AddStringToObject(delivery, "state", delivery_state_str(st.delivery.state));
+            cJSON_AddNumberToObject(delivery, "done", st.delivery.done);
+            cJSON_AddNumberToObject(delivery, "total", st.delivery.total);
+            cJSON_AddNumberToObject(delivery, "retries", st.delivery.retries);
+            cJSON_AddNumberToObject(delivery, "render_ms", st.delivery.render_ms);
+        }
+        else
+        {
+            cJSON_AddNullToObject(badge, "delivery");
+        }
+        if (st.telemetry.reported)
+        {
+            const badge_telemetry_t *t = &st.telemetry;
+            cJSON *telemetry = cJSON_AddObjectToObject(badge, "telemetry");
+            cJSON_AddStringToObject(telemetry, "firmware", t->firmware);
+            cJSON_AddNumberToObject(telemetry, "renders", t->renders);
+            cJSON_AddNumberToObject(telemetry, "rejected", t->rejected);
+            cJSON_AddNumberToObject(telemetry, "last_render_ms", t->last_render_ms);
+            cJSON_AddNumberToObject(telemetry, "max_render_ms", t->max_render_ms);
+            cJSON_AddNumberToObject(telemetry, "rssi", t->rssi);
+            cJSON_AddNumberToObject(telemetry, "queue_hwm", t->queue_hwm);
+            cJSON_AddNumberToObject(telemetry, "dropped", t->dropped);
+        }
+        else
+        {
+            cJSON_AddNullToObject(badge, "telemetry");
+        }
+        cJSON_AddItemToArray(list, badge);
+    }
+    free(entries);
+
+    char *resp_str = cJSON_PrintUnformatted(list);
+    cJSON_Delete(list);
+    if (!resp_str)
+    {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+    }
 
-    httpd_resp_set_type(req, "text/html");
-    esp_err_t res = httpd_resp_send(req, final_html, total_len);
-    free(final_html);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    esp_err_t res = httpd_resp_send(req, resp_str, HTTPD_RESP_USE_STRLEN);
+    free(resp_str);
     return res;
 }
 
@@ -160,13 +320,19 @@ static esp_err_t sendtext_post_handler(httpd_req_t *req)
     const char *mac_str = mac_item->valuestring;
     ESP_LOGI(TAG, "Target MAC string from JSON: %s", mac_str);
 
-    uint8_t target_mac[6];
-    if (sscanf(mac_str, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
-               &target_mac[0], &target_mac[1], &target_mac[2],
-               &target_mac[3], &target_mac[4], &target_mac[5]) != 6)
+    uint8_t (*target_macs)[6] = TARGETS_ALLOC();
+    if (!target_macs)
     {
         cJSON_Delete(json);
-        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid MAC format");
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Memory allocation failed");
+    }
+    size_t target_count = parse_targets(mac_str, target_macs);
+    if (target_count == 0)
+    {
+        esp_err_t res = send_targets_err(req, mac_str);
+        free(target_macs);
+        cJSON_Delete(json);
+        return res;
     }
 
     // Parse other fields
@@ -187,43 +353,62 @@ static esp_err_t sendtext_post_handler(httpd_req_t *req)
 
     if (strlen(first_name) == 0 && strlen(last_name) == 0 && strlen(additional_info) == 0)
     {
+        free(target_macs);
         cJSON_Delete(json);
         return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "At least one field must be provided");
     }
 
-    ESP_LOGI(TAG, "Sending to MAC %02X:%02X:%02X:%02X:%02X:%02X -> First: %s, Last: %s, Info: %s",
-             target_mac[0], target_mac[1], target_mac[2],
-             target_mac[3], target_mac[4], target_mac[5],
-             first_name, last_name, additional_info);
-
-    // Format and send
-    cJSON *send_json = cJSON_CreateObject();
-    cJSON_AddStringToObject(send_json, "first_name", first_name);
-    cJSON_AddStringToObject(send_json, "last_name", last_name);
-    cJSON_AddStringToObject(send_json, "additional_info", additional_info);
-    char *send_str = cJSON_PrintUnformatted(send_json);
-    cJSON_Delete(send_json);
-    cJSON_Delete(json);
-
-    esp_err_t err = esp_now_send(target_mac, (uint8_t *)send_str, strlen(send_str));
-    free(send_str);
+    ESP_LOGI(TAG, "Sending to %u badge(s) -> First: %s, Last: %s, Info: %s",
+             (unsigned)target_count, first_name, last_name, additional_info);
 
-    // Response
-    cJSON *resp_json = cJSON_CreateObject();
-    cJSON_AddStringToObject(resp_json, "status", esp_err_to_name(err));
-    char *resp_str = cJSON_PrintUnformatted(resp_json);
-    cJSON_Delete(resp_json);
+    // Too big for the httpd stack
+    uint8_t *msg = malloc(CMD_MSG_MAX);
+    if (!msg)
+    {
+        free(target_macs);
+        cJSON_Delete(json);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Memory allocation failed");
+    }
+    size_t msg_len = 0;
+    bool fits;
+    if (strcmp(additional_info, "reset666") == 0)
+    {
+        // Badges have always restarted on this info text instead of showing it
+        fits = cmd_put(msg, CMD_MSG_MAX, &msg_len, CMD_TAG_RESTART, NULL, 0);
+    }
+    else
+    {
+        fits = cmd_put(msg, CMD_MSG_MAX, &msg_len, CMD_TAG_FIRST_NAME, first_name, strlen(first_name)) &&
+               cmd_put(msg, CMD_MSG_MAX, &msg_len, CMD_TAG_LAST_NAME, last_name, strlen(last_name)) &&
+               cmd_put(msg, CMD_MSG_MAX, &msg_len, CMD_TAG_INFO, additional_info, strlen(additional_info));
+    }
+    if (!fits)
+    {
+        free(msg);
+        free(target_macs);
+        cJSON_Delete(json);
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Text too long");
+    }
 
-    httpd_resp_set_type(req, "application/json");
-    esp_err_t res = httpd_resp_send(req, resp_str, HTTPD_RESP_USE_STRLEN);
-    free(resp_str);
+    char content[BADGE_CONTENT_LEN];
+    bool has_name = *first_name || *last_name;
+    snprintf(content, sizeof(content), "%s%s%s%s%s", first_name, (*first_name && *last_name) ? " " : "",
+             last_name, (has_name && *additional_info) ? ", " : "", additional_info);
+    cJSON_Delete(json);
 
+    esp_err_t res = send_to_targets(req, target_macs, target_count, msg, msg_len, content);
+    free(msg);
+    free(target_macs);
     return res;
 }
 
 static esp_err_t addmac_post_handler(httpd_req_t *req)
 {
-    char buf[64];
+    char buf[64 + 2 * BADGE_ALIAS_LEN];
+    if (req->content_len >= sizeof(buf))
+    {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Request too long");
+    }
     int ret = httpd_req_recv(req, buf, req->content_len);
     if (ret <= 0)
     {
@@ -247,83 +432,41 @@ static esp_err_t addmac_post_handler(httpd_req_t *req)
     const char *mac_str = mac_item->valuestring;
     ESP_LOGI("AddMAC", "Received MAC: %s", mac_str);
 
-    // Validate MAC format: AA:BB:CC:DD:EE:FF
-    uint8_t mac_bin[6];
-    if (sscanf(mac_str, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
-               &mac_bin[0], &mac_bin[1], &mac_bin[2],
-               &mac_bin[3], &mac_bin[4], &mac_bin[5]) != 6)
+    // Optional display name, shown in the badge list
+    const char *alias = "";
+    cJSON *alias_item = cJSON_GetObjectItemCaseSensitive(json, "alias");
+    if (cJSON_IsString(alias_item) && alias_item->valuestring)
     {
-        cJSON_Delete(json);
-        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid MAC format");
+        alias = alias_item->valuestring;
     }
-
-    nvs_handle_t nvs;
-    if (nvs_open("mac_store", NVS_READWRITE, &nvs) != ESP_OK)
+    if (strlen(alias) >= BADGE_ALIAS_LEN)
     {
         cJSON_Delete(json);
-        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to open NVS");
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Alias too long");
     }
 
-    // Check for duplicates first
-    char key[16], existing[20];
-    size_t len;
-    bool already_registered = false;
-
-    for (int i = 0; i < MAX_MAC_ENTRIES; i++)
+    // Validate MAC format: AA:BB:CC:DD:EE:FF
+    uint8_t mac_bin[6];
+    if (!parse_mac(mac_str, mac_bin))
     {
-        snprintf(key, sizeof(key), "mac_%d", i);
-        len = sizeof(existing);
-        if (nvs_get_str(nvs, key, existing, &len) == ESP_OK)
-        {
-            if (strcasecmp(existing, mac_str) == 0)
-            {
-                already_registered = true;
-                break;
-            }
-        }
+        cJSON_Delete(json);
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid MAC format");
     }
 
-    if (already_registered)
+    esp_err_t err = badge_registry_add(mac_bin, alias);
+    cJSON_Delete(json);
+    if (err == ESP_ERR_INVALID_STATE)
     {
-        nvs_close(nvs);
-        cJSON_Delete(json);
         ESP_LOGI("AddMAC", "This MAC is already registered");
         return httpd_resp_send(req, "Already registered", HTTPD_RESP_USE_STRLEN);
     }
-
-    // Store in the first empty slot
-    for (int i = 0; i < MAX_MAC_ENTRIES; i++)
+    if (err != ESP_OK)
     {
-        snprintf(key, sizeof(key), "mac_%d", i);
-        len = sizeof(existing);
-        if (nvs_get_str(nvs, key, existing, &len) == ESP_ERR_NVS_NOT_FOUND)
-        {
-            esp_err_t err = nvs_set_str(nvs, key, mac_str);
-            if (err == ESP_OK)
-            {
-                nvs_commit(nvs);
-                nvs_close(nvs);
-                cJSON_Delete(json);
-                ESP_LOGI("AddMAC", "MAC is saved");
-
-                // add peer
-                add_peer(mac_bin);
-                return httpd_resp_send(req, "MAC saved", HTTPD_RESP_USE_STRLEN);
-            }
-            else
-            {
-                nvs_close(nvs);
-                cJSON_Delete(json);
-                ESP_LOGE("AddMAC", "Failed to save MAC");
-                return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save MAC");
-            }
-        }
+        ESP_LOGE("AddMAC", "Failed to save MAC: %s", esp_err_to_name(err));
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Registry full");
     }
-
-    // Should never reach here
-    nvs_close(nvs);
-    cJSON_Delete(json);
-    return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Unexpected failure");
+    ESP_LOGI("AddMAC", "MAC is saved");
+    return httpd_resp_send(req, "MAC saved", HTTPD_RESP_USE_STRLEN);
 }
 
 static esp_err_t deletemac_post_handler(httpd_req_t *req)
@@ -352,46 +495,12 @@ static esp_err_t deletemac_post_handler(httpd_req_t *req)
     const char *target_mac = mac_item->valuestring;
     ESP_LOGI("DeleteMAC", "Attempting to delete: %s", target_mac);
 
-    nvs_handle_t nvs;
-    if (nvs_open("mac_store", NVS_READWRITE, &nvs) != ESP_OK)
-    {
-        cJSON_Delete(json);
-        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to open NVS");
-    }
-
-    char key[16], value[20];
-    size_t len;
-    bool found = false;
-
-    for (int i = 0; i < MAX_MAC_ENTRIES; i++)
-    {
-        snprintf(key, sizeof(key), "mac_%d", i);
-        len = sizeof(value);
-        if (nvs_get_str(nvs, key, value, &len) == ESP_OK)
-        {
-            if (strcasecmp(value, target_mac) == 0)
-            {
-                ESP_LOGI("DeleteMAC", "Found at %s. Deleting...", key);
-                esp_err_t err = nvs_erase_key(nvs, key);
-                if (err == ESP_OK)
-                {
-                    nvs_commit(nvs);
-                    found = true;
-                }
-                break;
-            }
-        }
-    }
-
+    uint8_t mac_bin[6];
     esp_err_t retval;
-    if (found)
+    if (parse_mac(target_mac, mac_bin) && badge_registry_remove(mac_bin) == ESP_OK)
     {
         // delete esp-now peer
-        uint8_t mac_bin[6];
-        sscanf(target_mac, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
-               &mac_bin[0], &mac_bin[1], &mac_bin[2],
-               &mac_bin[3], &mac_bin[4], &mac_bin[5]);
-        delete_peer(mac_bin);
+        peer_cache_forget(mac_bin);
         retval = httpd_resp_send(req, "MAC deleted", HTTPD_RESP_USE_STRLEN);
     }
     else
@@ -400,22 +509,32 @@ static esp_err_t deletemac_post_handler(httpd_req_t *req)
         retval = httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "MAC not found");
     }
 
-    nvs_close(nvs);
     cJSON_Delete(json);
     return (retval);
 }
 
 static esp_err_t clearbadge_post_handler(httpd_req_t *req)
 {
-    char buf[64];
+    // Room for a full target list
+    if (req->content_len >= TARGETS_MAX_LEN + 32)
+    {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Request too long");
+    }
+    char *buf = malloc(req->content_len + 1);
+    if (!buf)
+    {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Memory allocation failed");
+    }
     int ret = httpd_req_recv(req, buf, req->content_len);
     if (ret <= 0)
     {
+        free(buf);
         return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No data received");
     }
     buf[ret] = '\0';
 
     cJSON *json = cJSON_Parse(buf);
+    free(buf);
     if (!json)
     {
         return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON");
@@ -431,35 +550,28 @@ static esp_err_t clearbadge_post_handler(httpd_req_t *req)
     const char *mac_str = mac_item->valuestring;
     ESP_LOGI("ClearBadge", "Attempting to clear: %s", mac_str);
 
-    uint8_t target_mac[6];
-    if (sscanf(mac_str, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
-               &target_mac[0], &target_mac[1], &target_mac[2],
-               &target_mac[3], &target_mac[4], &target_mac[5]) != 6)
+    uint8_t (*target_macs)[6] = TARGETS_ALLOC();
+    if (!target_macs)
     {
         cJSON_Delete(json);
-        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid MAC format");
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Memory allocation failed");
+    }
+    size_t target_count = parse_targets(mac_str, target_macs);
+    if (target_count == 0)
+    {
+        esp_err_t res = send_targets_err(req, mac_str);
+        free(target_macs);
+        cJSON_Delete(json);
+        return res;
     }
 
-    // Format and send
-    cJSON *send_json = cJSON_CreateObject();
-    cJSON_AddStringToObject(send_json, "clear", "1");
-    char *send_str = cJSON_PrintUnformatted(send_json);
-    cJSON_Delete(send_json);
     cJSON_Delete(json);
 
-    esp_err_t err = esp_now_send(target_mac, (uint8_t *)send_str, strlen(send_str));
-    free(send_str);
-
-    // Response
-    cJSON *resp_json = cJSON_CreateObject();
-    cJSON_AddStringToObject(resp_json, "status", esp_err_to_name(err));
-    char *resp_str = cJSON_PrintUnformatted(resp_json);
-    cJSON_Delete(resp_json);
-
-    httpd_resp_set_type(req, "application/json");
-    esp_err_t res = httpd_resp_send(req, resp_str, HTTPD_RESP_USE_STRLEN);
-    free(resp_str);
-
+    uint8_t msg[2];
+    size_t msg_len = 0;
+    cmd_put(msg, sizeof(msg), &msg_len, CMD_TAG_CLEAR, NULL, 0);
+    esp_err_t res = send_to_targets(req, target_macs, target_count, msg, msg_len, "");
+    free(target_macs);
     return res;
 }
 
@@ -477,131 +589,129 @@ bool parse_mac(const char *s, uint8_t mac[6])
     return false;
 }
 
-static void send_logo_task(void *arg)
-{
-    struct
-    {
-        uint8_t addr[6];
-        size_t len;
-    } *p = arg;
-
-    size_t total = p->len;
-    size_t offset = 0;
-    int pid = 0;
-
-    while (offset < total)
-    {
-        size_t chunk = (total - offset > 250) ? 250 : (total - offset);
-        esp_err_t err = esp_now_send(p->addr, logo_buf + offset, chunk);
-        if (err != ESP_OK)
-        {
-            ESP_LOGE(TAG, "ESP-NOW pkt %d failed: %d", pid, err);
-        }
-        offset += chunk;
-        pid++;
-        vTaskDelay(pdMS_TO_TICKS(10));
-    }
-    ESP_LOGI(TAG, "All %d chunks sent to %02X:%02X:%02X:%02X:%02X:%02X",
-             pid, p->addr[0], p->addr[1], p->addr[2],
-             p->addr[3], p->addr[4], p->addr[5]);
-
-    free(p);
-    vTaskDelete(NULL);
-}
-
 /**
  * HTTP POST /sendlogo
- *   • Reads up to LOGO_BUF_SIZE bytes into logo_buf
- *   • Replies “200 OK” immediately
- *   • Spawns send_logo_task() so ESP-NOW happens off the HTTP thread
+ *   • Body: target list + '\n', then the 1bpp image. The target list is one
+ *     MAC, several comma separated, or "*" for every registered badge
+ *   • Queues the image for all targets and replies right away; the
+ *     transfers run in the logo_transfer scheduler and report their
+ *     progress on /ws
  */
 static esp_err_t sendlogo_post_handler(httpd_req_t *req)
 {
     size_t remaining = req->content_len;
-    if (remaining < HEADER_LEN || remaining > HEADER_LEN + LOGO_BUF_SIZE)
+    if (remaining < 2 || remaining > TARGETS_MAX_LEN + 1 + LOGO_BUF_SIZE)
     {
         ESP_LOGE(TAG, "Bad length: %u", (unsigned)remaining);
         httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad payload size");
         return ESP_FAIL;
     }
 
-    // 1) Read the MAC header + '\n'
-    char mac_hdr[HEADER_LEN + 1];
-    size_t to_read = HEADER_LEN;
-    char *hdr_ptr = mac_hdr;
-    while (to_read)
+    // Target lists can name every registered badge: too big for the stack
+    char *hdr = malloc(TARGETS_MAX_LEN + 2);
+    uint8_t (*peer_macs)[6] = TARGETS_ALLOC();
+    if (!hdr || !peer_macs)
+    {
+        free(hdr);
+        free(peer_macs);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+        return ESP_FAIL;
+    }
+
+    // 1) Read until the end of the target line; what follows is image data
+    size_t want = remaining < TARGETS_MAX_LEN + 1 ? remaining : TARGETS_MAX_LEN + 1;
+    size_t got = 0;
+    char *nl = NULL;
+    while (!nl && got < want)
     {
-        int r = httpd_req_recv(req, hdr_ptr, to_read);
+        int r = httpd_req_recv(req, hdr + got, want - got);
         if (r <= 0)
         {
             if (r == HTTPD_SOCK_ERR_TIMEOUT)
                 continue;
             ESP_LOGE(TAG, "Header recv err: %d", r);
+            free(hdr);
+            free(peer_macs);
             httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Header error");
             return ESP_FAIL;
         }
-        hdr_ptr += r;
-        to_read -= r;
+        nl = memchr(hdr + got, '\n', r);
+        got += r;
     }
-    mac_hdr[HEADER_LEN] = '\0'; // NUL-terminate
-    // strip trailing newline
-    if (mac_hdr[MAC_STR_LEN] != '\n')
+    if (!nl)
     {
-        ESP_LOGE(TAG, "Missing newline after MAC");
+        ESP_LOGE(TAG, "Missing newline after target list");
+        free(hdr);
+        free(peer_macs);
         httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Malformed header");
         return ESP_FAIL;
     }
-    mac_hdr[MAC_STR_LEN] = '\0';
+    *nl = '\0';
+    size_t hdr_len = nl - hdr + 1;
 
-    uint8_t peer_mac[6];
-    if (!parse_mac(mac_hdr, peer_mac))
+    size_t peer_count = parse_targets(hdr, peer_macs);
+    if (peer_count == 0)
     {
-        ESP_LOGE(TAG, "Invalid MAC: %s", mac_hdr);
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid MAC");
+        ESP_LOGE(TAG, "No targets in list: %s", hdr);
+        send_targets_err(req, hdr);
+        free(hdr);
+        free(peer_macs);
         return ESP_FAIL;
     }
 
-    // 2) Read the remaining bytes into logo_buf
-    size_t logo_len = remaining - HEADER_LEN;
-    uint8_t *bufptr = logo_buf;
-    while (logo_len)
+    size_t logo_len = remaining - hdr_len;
+    if (logo_len == 0 || logo_len > LOGO_BUF_SIZE)
     {
-        int r = httpd_req_recv(req, (char *)bufptr, logo_len);
+        ESP_LOGE(TAG, "Bad image size: %u", (unsigned)logo_len);
+        free(hdr);
+        free(peer_macs);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad payload size");
+        return ESP_FAIL;
+    }
+
+    // 2) Every upload gets its own buffer, owned by the scheduler once queued
+    uint8_t *image = malloc(logo_len);
+    if (!image)
+    {
+        ESP_LOGE(TAG, "OOM allocating %u byte image", (unsigned)logo_len);
+        free(hdr);
+        free(peer_macs);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+        return ESP_FAIL;
+    }
+    size_t have = got - hdr_len;
+    memcpy(image, nl + 1, have);
+    free(hdr);
+    while (have < logo_len)
+    {
+        int r = httpd_req_recv(req, (char *)image + have, logo_len - have);
         if (r <= 0)
         {
             if (r == HTTPD_SOCK_ERR_TIMEOUT)
                 continue;
             ESP_LOGE(TAG, "Logo recv err: %d", r);
+            free(image);
+            free(peer_macs);
             httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Data error");
             return ESP_FAIL;
         }
-        bufptr += r;
-        logo_len -= r;
+        have += r;
     }
-    ESP_LOGI(TAG, "Got %u logo bytes for %s",
-             (unsigned)(remaining - HEADER_LEN), mac_hdr);
-
-    // 3) Immediate HTTP response
-    httpd_resp_sendstr(req, "Logo uploaded");
-
-    // 4) Spawn ESP-NOW send task
-    struct
-    {
-        uint8_t addr[6];
-        size_t len;
-    } *task_arg = malloc(sizeof(*task_arg));
+    ESP_LOGI(TAG, "Got %u logo bytes for %u badge(s)", (unsigned)logo_len, (unsigned)peer_count);
 
-    if (task_arg)
+    // 3) Hand over to the scheduler, then answer
+    if (logo_transfer_queue(peer_macs, peer_count, image, logo_len) != ESP_OK)
     {
-        memcpy(task_arg->addr, peer_mac, 6);
-        task_arg->len = remaining - HEADER_LEN;
-        xTaskCreate(send_logo_task, "send_logo", 2048, task_arg, 5, NULL);
+        free(peer_macs);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Transfer queues full");
+        return ESP_FAIL;
     }
-    else
+    for (size_t i = 0; i < peer_count; i++)
     {
-        ESP_LOGE(TAG, "OOM allocating task arg");
+        badge_status_set_content(peer_macs[i], "image");
     }
-
+    free(peer_macs);
+    httpd_resp_sendstr(req, "Logo uploaded");
     return ESP_OK;
 }
 
@@ -609,9 +719,34 @@ static esp_err_t sendlogo_post_handler(httpd_req_t *req)
 static const httpd_uri_t index_uri = {
     .uri = "/",
     .method = HTTP_GET,
-    .handler = index_get_handler,
+    .handler = asset_get_handler,
+    .user_ctx = (void *)&html_asset};
+
+static const httpd_uri_t css_uri = {
+    .uri = WEBCONTENT_CSS_URI,
+    .method = HTTP_GET,
+    .handler = asset_get_handler,
+    .user_ctx = (void *)&css_asset};
+
+static const httpd_uri_t js_uri = {
+    .uri = WEBCONTENT_JS_URI,
+    .method = HTTP_GET,
+    .handler = asset_get_handler,
+    .user_ctx = (void *)&js_asset};
+
+static const httpd_uri_t badges_uri = {
+    .uri = "/api/badges",
+    .method = HTTP_GET,
+    .handler = badges_get_handler,
     .user_ctx = NULL};
 
+static const httpd_uri_t ws_uri = {
+    .uri = "/ws",
+    .method = HTTP_GET,
+    .handler = delivery_push_ws_handler,
+    .user_ctx = NULL,
+    .is_websocket = true};
+
 static const httpd_uri_t sendtext_uri = {
     .uri = "/sendtext",
     .method = HTTP_POST,
@@ -647,11 +782,16 @@ httpd_handle_t start_webserver(void)
 {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.lru_purge_enable = true;
+    config.max_uri_handlers = 12;
     httpd_handle_t server = NULL;
     ESP_LOGI(TAG, "Starting server on port: '%d'", config.server_port);
     if (httpd_start(&server, &config) == ESP_OK)
     {
         httpd_register_uri_handler(server, &index_uri);
+        httpd_register_uri_handler(server, &css_uri);
+        httpd_register_uri_handler(server, &js_uri);
+        httpd_register_uri_handler(server, &badges_uri);
+        httpd_register_uri_handler(server, &ws_uri);
         httpd_register_uri_handler(server, &sendtext_uri);
         httpd_register_uri_handler(server, &addmac_uri);
         httpd_register_uri_handler(server, &deletemac_uri);
@@ -3,14 +3,13 @@
 
 #include "esp_http_server.h"
 
-#define MAX_MAC_ENTRIES 20
 #define EINK_W 800
 #define EINK_H 480
 #define ESP_NOW_MAX_DATA_LEN 250
 // one bit per pixel
 #define LOGO_BUF_SIZE ((EINK_W * EINK_H) / 8)
 #define MAC_STR_LEN 17               // "AA:BB:CC:DD:EE:FF"
-#define HEADER_LEN (MAC_STR_LEN + 1) // + '\n'
+#define BADGE_ALIAS_LEN 33           // display name, up to 32 characters
 
 // Starts the HTTP server and returns the server handle.
 httpd_handle_t start_webserver(void);
@@ -8,6 +8,11 @@
 #include "esp_log.h"
 #include "nvs_flash.h"
 #include "webserver.h"
+#include "logo_transfer.h"
+#include "badge_wake.h"
+#include "badge_status.h"
+#include "peer_cache.h"
+#include "badge_telemetry.h"
 
 static const char *TAG = "wifi";
 
@@ -68,55 +73,42 @@ static void connect_handler(void *arg, esp_event_base_t event_base,
     }
 }
 
-void add_peer(uint8_t esp_mac[6])
+// ESP-NOW has a single send and receive callback: send results go to the
+// module that sent the frame, received frames to every module
+static void espnow_send_cb(const uint8_t *mac_addr, esp_now_send_status_t status)
 {
-    esp_now_peer_info_t peer_info = {0};
-    peer_info.channel = STA_CHANNEL;
-    peer_info.encrypt = false;
-
-    memcpy(peer_info.peer_addr, esp_mac, 6);
-    ESP_LOGI(TAG, "esp_now_add_peer: %x:%x:%x:%x:%x:%x", esp_mac[0], esp_mac[1], esp_mac[2], esp_mac[3], esp_mac[4], esp_mac[5]);
-    ESP_ERROR_CHECK(esp_now_add_peer(&peer_info));
+    bool ok = (status == ESP_NOW_SEND_SUCCESS);
+    switch (peer_cache_on_sent(mac_addr))
+    {
+    case PEER_OWNER_LOGO:
+        logo_transfer_on_sent(mac_addr, ok);
+        break;
+    case PEER_OWNER_WAKE:
+        badge_wake_on_sent(mac_addr, ok);
+        break;
+    default:
+        break;
+    }
 }
 
-void delete_peer(uint8_t esp_mac[6])
+static void espnow_recv_cb(const esp_now_recv_info_t *info, const uint8_t *data, int len)
 {
-    ESP_LOGI(TAG, "esp_now_del_peer: %hhx:%hhx:%hhx:%hhx:%hhx:%hhx", esp_mac[0], esp_mac[1], esp_mac[2], esp_mac[3], esp_mac[4], esp_mac[5]);
-    ESP_ERROR_CHECK(esp_now_del_peer(esp_mac));
+    badge_status_on_recv(info);
+    logo_transfer_on_recv(info->src_addr, data, len);
+    badge_wake_on_recv(info->src_addr, data, len);
+    badge_telemetry_on_recv(info->src_addr, data, len);
 }
 
 void init_esp_now(void)
 {
     ESP_ERROR_CHECK(esp_now_init());
-
-    // Open NVS namespace where we keep mac_0…mac_N
-    nvs_handle_t nvs;
-    if (nvs_open("mac_store", NVS_READONLY, &nvs) != ESP_OK)
-    {
-        // on error, return
-        return;
-    }
-
-    char key[16];
-    char mac[20];
-    size_t len;
-    for (int i = 0; i < MAX_MAC_ENTRIES; i++)
-    {
-        // Read the i-th MAC entry
-        snprintf(key, sizeof(key), "mac_%d", i);
-        len = sizeof(mac);
-        if (nvs_get_str(nvs, key, mac, &len) != ESP_OK)
-        {
-            continue; // slot empty
-        }
-        uint8_t parsed_mac[6];
-        if (parse_mac(mac, parsed_mac))
-        {
-            add_peer(parsed_mac);
-        }
-    }
-
-    nvs_close(nvs);
+    // Badges become peers on demand when something is sent to them
+    peer_cache_init();
+    logo_transfer_init();
+    badge_wake_init();
+    badge_telemetry_init();
+    ESP_ERROR_CHECK(esp_now_register_send_cb(espnow_send_cb));
+    ESP_ERROR_CHECK(esp_now_register_recv_cb(espnow_recv_cb));
 }
 
 void wifi_init_softap(void)
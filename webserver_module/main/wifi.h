@@ -14,8 +14,4 @@
 
 void wifi_init_softap(void);
 
-void add_peer(uint8_t esp_mac[6]);
-
-void delete_peer(uint8_t esp_mac[6]);
-
 #endif // WEBSERVER_H
\ No newline at end of file